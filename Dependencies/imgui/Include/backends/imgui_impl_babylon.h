@@ -6,6 +6,11 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'ID3D11ShaderResourceView*' as ImTextureID. Read the FAQ about ImTextureID!
 //  [X] Renderer: Support for large meshes (64k+ vertices) with 16-bit indices.
+//  [X] Renderer: Support for 32-bit indices (build with the IMGUI_USE_32BIT_INDICES CMake option).
+//  [X] Renderer: Optional on-disk font atlas cache (pass a filename to ImGui_ImplBabylon_Init).
+//  [X] Renderer: Glyphs rasterized on first use (ImFontConfig::GlyphRangesDynamic), uploaded as the dirty part of the atlas.
+//  [X] Renderer: Signed distance field font atlases (ImFontAtlasFlags_SignedDistanceField), drawn at any scale from a single size.
+//  [X] Renderer: Signed distance field font atlases (ImFontAtlasFlags_SignedDistanceField), drawn at any scale from a single size.
 
 // You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this. 
 // Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
@@ -16,7 +21,7 @@
 #include "imgui.h"      // IMGUI_IMPL_API
 #include <Babylon/Graphics/DeviceContext.h>
 
-IMGUI_IMPL_API bool ImGui_ImplBabylon_Init(uint32_t width, uint32_t height, float fontSize = 16.0f);
+IMGUI_IMPL_API bool ImGui_ImplBabylon_Init(uint32_t width, uint32_t height, float fontSize = 16.0f, const char* fontCacheFilename = nullptr);
 IMGUI_IMPL_API void ImGui_ImplBabylon_SetContext(Babylon::Graphics::DeviceContext* context);
 IMGUI_IMPL_API void ImGui_ImplBabylon_Shutdown();
 IMGUI_IMPL_API void ImGui_ImplBabylon_NewFrame();
@@ -30,7 +30,7 @@ Index of this file:
 // [SECTION] Helpers: Memory allocations macros, ImVector<>
 // [SECTION] ImGuiStyle
 // [SECTION] ImGuiIO
-// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs)
+// [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload, ImGuiTableSortSpecs, ImGuiTableColumnSortSpecs, ImGuiFrameStats)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
@@ -135,17 +135,21 @@ struct ImDrawChannel;               // Temporary storage to output draw commands
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
+struct ImDrawListBufferPool;        // Pool recycling draw list buffers between window draw lists (internal)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
+struct ImFontAtlasDynamicGlyphs;    // Opaque state of the on-demand glyph rasterizer (see ImFontConfig::GlyphRangesDynamic)
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
+struct ImGuiFrameStats;             // Counters and timings of the last rendered frame, see GetFrameStats()
+struct ImGuiFrameStatsWindow;       // Draw list size of one window, within ImGuiFrameStats
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
@@ -160,6 +164,7 @@ struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextFilterIndex;        // Helper to filter large lists of strings with ImGuiTextFilter
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enums/Flags (declared as int for compatibility with old C++, to allow using as flags without overhead, and to not pollute the top of this file)
@@ -304,6 +309,7 @@ namespace ImGui
     IMGUI_API void          ShowFontSelector(const char* label);        // add font selector block (not a window), essentially a combo listing the loaded fonts.
     IMGUI_API void          ShowUserGuide();                            // add basic help/info block (not a window): how to manipulate ImGui as a end-user (mouse/keyboard controls).
     IMGUI_API const char*   GetVersion();                               // get the compiled version string e.g. "1.80 WIP" (essentially the value for IMGUI_VERSION from the compiled version of imgui.cpp)
+    IMGUI_API const ImGuiFrameStats& GetFrameStats();                   // get counters and timings of the last frame, updated by Render(). set io.ConfigDebugFrameStats for timings and per-window sizes.
 
     // Styles
     IMGUI_API void          StyleColorsDark(ImGuiStyle* dst = NULL);    // new, recommended style (default)
@@ -933,6 +939,7 @@ namespace ImGui
     IMGUI_API void          GetAllocatorFunctions(ImGuiMemAllocFunc* p_alloc_func, ImGuiMemFreeFunc* p_free_func, void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void*         MemAllocFrame(size_t size);                 // allocate scratch memory which stays valid until the next NewFrame(), 16-bytes aligned. don't free it. requires a current context.
 
 } // namespace ImGui
 
@@ -1923,6 +1930,8 @@ struct ImGuiIO
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // Enable allowing to move windows only when clicking on their title bar. Does not apply to windows without a title bar.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    int         ConfigMemoryDrawListPoolSize;   // = 4 MB           // Max bytes of draw list buffers kept after compacting windows, to be reused by growing draw lists instead of reallocating. Set to 0 to disable pooling.
+    bool        ConfigDebugFrameStats;          // = false          // Measure NewFrame()/EndFrame()/Render() durations and per-window draw list sizes into GetFrameStats(). Counters are always collected.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1988,8 +1997,10 @@ struct ImGuiIO
     int         MetricsRenderVertices;              // Vertices output during last call to Render()
     int         MetricsRenderIndices;               // Indices output during last call to Render() = number of triangles * 3
     int         MetricsRenderWindows;               // Number of visible windows
+    int         MetricsRenderCulledPrimitives;      // Primitives rejected on the CPU by ImDrawList clip rectangle culling during last call to Render()
     int         MetricsActiveWindows;               // Number of active windows
-    int         MetricsActiveAllocations;           // Number of active allocations, updated by MemAlloc/MemFree based on current context. May be off if you have multiple imgui contexts.
+    int         MetricsActiveAllocations;           // Number of active allocations, counted by MemAlloc/MemFree based on current context and published by NewFrame() and Render(). May be off if you have multiple imgui contexts.
+    int         MetricsFrameAllocations;            // Number of MemAlloc calls made between the last two calls to NewFrame(). Usually 0 once the UI is stable. MemAllocFrame() doesn't count unless it needs more memory.
     ImVec2      MouseDelta;                         // Mouse delta. Note that this is zero if either current or previous position are invalid (-FLT_MAX,-FLT_MAX), so a disappearing/reappearing mouse won't have a huge delta.
 
     // Legacy: before 1.87, we required backend to fill io.KeyMap[] (imgui->native map) during initialization and io.KeysDown[] (native indices) every frame.
@@ -2142,6 +2153,43 @@ struct ImGuiTableSortSpecs
     ImGuiTableSortSpecs()       { memset(this, 0, sizeof(*this)); }
 };
 
+// Draw list size of one window, within ImGuiFrameStats::Windows[]
+struct ImGuiFrameStatsWindow
+{
+    const char*     Name;               // Window name. Owned by the window: copy it if you keep the stats around.
+    int             DrawCmds;
+    int             Vertices;
+    int             Indices;
+};
+
+// Counters and timings of the last rendered frame. Obtained by calling GetFrameStats(), updated at the end of Render().
+// A frame spans from the end of a Render() call to the end of the next one, so work done by your renderer backend is accounted to the next frame.
+// Use AppendCsv()/AppendJson() to export one line per frame, e.g. to feed a dashboard.
+struct ImGuiFrameStats
+{
+    int             FrameCount;         // ImGui::GetFrameCount() of the frame
+    float           DeltaTime;          // io.DeltaTime of the frame
+    int             Allocs;             // Calls to MemAlloc()
+    int             Frees;              // Calls to MemFree() with a non-NULL pointer
+    ImU64           AllocBytes;         // Bytes requested by MemAlloc() calls
+    int             IdHashes;           // IDs hashed by GetID() and the widgets (labels reused from the previous frame by ImGuiWindow::IDMemo are not counted)
+    int             StorageLookups;     // ImGuiStorage accesses (window/tree node state, pools). Counted for all contexts.
+    int             DrawLists;          // Draw lists in the draw data
+    int             DrawCmds;
+    int             Vertices;
+    int             Indices;
+    float           NewFrameMs;         // Time spent in NewFrame(). 0.0f unless io.ConfigDebugFrameStats is set.
+    float           EndFrameMs;         // Time spent in EndFrame(), including when called by Render(). 0.0f unless io.ConfigDebugFrameStats is set.
+    float           RenderMs;           // Time spent in Render(), excluding EndFrame(). 0.0f unless io.ConfigDebugFrameStats is set.
+    ImVector<ImGuiFrameStatsWindow> Windows; // Visible windows and their draw list size. Empty unless io.ConfigDebugFrameStats is set.
+
+    ImGuiFrameStats()                   { Clear(); }
+    void            Clear()             { FrameCount = Allocs = Frees = IdHashes = StorageLookups = DrawLists = DrawCmds = Vertices = Indices = 0; AllocBytes = 0; DeltaTime = NewFrameMs = EndFrameMs = RenderMs = 0.0f; Windows.resize(0); }
+    IMGUI_API static void AppendCsvHeader(ImGuiTextBuffer* buf);    // Append the column names of AppendCsv(), with a trailing newline
+    IMGUI_API void  AppendCsv(ImGuiTextBuffer* buf) const;          // Append one line of comma-separated values. Per-window sizes are left out.
+    IMGUI_API void  AppendJson(ImGuiTextBuffer* buf) const;         // Append one JSON object on a single line (JSON Lines), including per-window sizes
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
 //-----------------------------------------------------------------------------
@@ -2169,6 +2217,7 @@ struct ImGuiTextFilter
     IMGUI_API           ImGuiTextFilter(const char* default_filter = "");
     IMGUI_API bool      Draw(const char* label = "Filter (inc,-exc)", float width = 0.0f);  // Helper calling InputText+Build
     IMGUI_API bool      PassFilter(const char* text, const char* text_end = NULL) const;
+    IMGUI_API void      Filter(const ImGuiTextFilterIndex& index, ImVector<int>* out_items) const;  // Append the indices of the items of 'index' passing the filter. Much faster than PassFilter() on each item of a large list.
     IMGUI_API void      Build();
     void                Clear()          { InputBuf[0] = 0; Build(); }
     bool                IsActive() const { return !Filters.empty(); }
@@ -2189,6 +2238,18 @@ struct ImGuiTextFilter
     int                     CountGrep;
 };
 
+// Helper: Lowercased copy of a list of strings, for ImGuiTextFilter::Filter()
+// Build it once (and when the list changes), rather than on each change of the filter.
+struct ImGuiTextFilterIndex
+{
+    ImVector<char>      Buf;                    // Lowercased items (ASCII letters only), each followed by a zero
+    ImVector<int>       Offsets;                // Offset of each item in Buf
+
+    void                clear()                 { Buf.clear(); Offsets.clear(); }
+    int                 size() const            { return Offsets.Size; }
+    IMGUI_API void      append(const char* text, const char* text_end = NULL);
+};
+
 // Helper: Growable text buffer for logging/accumulating text
 // (this could be called 'ImGuiTextBuilder' / 'ImGuiStringBuilder')
 struct ImGuiTextBuffer
@@ -2213,7 +2274,7 @@ struct ImGuiTextBuffer
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
-// This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// Pairs are stored in a contiguous buffer, indexed by an open-addressing hash table: lookup and insertion are O(1).
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2229,13 +2290,20 @@ struct ImGuiStorage
         ImGuiStoragePair(ImGuiID _key, float _val_f)    { key = _key; val_f = _val_f; }
         ImGuiStoragePair(ImGuiID _key, void* _val_p)    { key = _key; val_p = _val_p; }
     };
+    struct ImGuiStorageSlot
+    {
+        ImGuiID key;
+        int     index;                              // Index into Data[], -1 for an empty slot
+    };
 
-    ImVector<ImGuiStoragePair>      Data;
+    ImVector<ImGuiStoragePair>      Data;           // Pairs in insertion order (sorted by key after BuildSortByKey())
+    ImVector<ImGuiStorageSlot>      Index;          // Linear probing hash table (power-of-two size, at most half full)
+    int                             IndexedCount;   // Data.Size when Index was last updated. If you modify Data directly, Index is rebuilt on next insertion (or call BuildSortByKey())
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. A query is O(1)
     // - Set***() functions find pair, insertion on demand if missing.
-    // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    ImGuiStorage()      { IndexedCount = 0; }
+    void                Clear() { Data.clear(); Index.clear(); IndexedCount = 0; }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2257,7 +2325,7 @@ struct ImGuiStorage
     // Use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
-    // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents to Data and then sort/index once.
     IMGUI_API void      BuildSortByKey();
 };
 
@@ -2485,7 +2553,8 @@ enum ImDrawListFlags_
 // You can interleave normal ImGui:: calls and adding primitives to the current draw list.
 // In single viewport mode, top-left is == GetMainViewport()->Pos (generally 0,0), bottom-right is == GetMainViewport()->Pos+Size (generally io.DisplaySize).
 // You are totally free to apply whatever transformation matrix to want to the data (depending on the use of the transformation you may want to apply it to ClipRect as well!)
-// Important: Primitives are always added to the list and not culled (culling is done at higher-level by ImGui:: functions), if you use this API a lot consider coarse culling your drawn objects.
+// Primitives whose bounding box lies entirely outside the current clip rectangle are rejected on the CPU before tessellation (see _IsCulled(), and IMGUI_DISABLE_DRAWLIST_CPU_CULLING in imconfig.h).
+// This is only a coarse test: primitives partially overlapping the clip rectangle are still emitted whole and clipped by your renderer.
 struct ImDrawList
 {
     // This is what you have to render
@@ -2506,6 +2575,8 @@ struct ImDrawList
     ImDrawCmdHeader         _CmdHeader;         // [Internal] template of active commands. Fields should match those of CmdBuffer.back().
     ImDrawListSplitter      _Splitter;          // [Internal] for channels api (note: prefer using your own persistent instance of ImDrawListSplitter!)
     float                   _FringeScale;       // [Internal] anti-alias fringe is scaled by this value, this helps to keep things sharp while zooming at vertex buffer content
+    int                     _CulledPrimCount;   // [Internal] number of primitives rejected by _IsCulled() since last _ResetForNewFrame()
+    ImDrawListBufferPool*   _BufferPool;        // [Internal] pool to grow CmdBuffer/IdxBuffer/VtxBuffer from. Only set for window draw lists: the pool isn't thread-safe.
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
     ImDrawList(const ImDrawListSharedData* shared_data) { memset(this, 0, sizeof(*this)); _Data = shared_data; }
@@ -2609,6 +2680,26 @@ struct ImDrawList
     IMGUI_API int   _CalcCircleAutoSegmentCount(float radius) const;
     IMGUI_API void  _PathArcToFastEx(const ImVec2& center, float radius, int a_min_sample, int a_max_sample, int a_step);
     IMGUI_API void  _PathArcToN(const ImVec2& center, float radius, float a_min, float a_max, int num_segments);
+    IMGUI_API bool  _IsCulled(const ImVec2* points, int points_count, float pad);
+    inline    bool  _IsCulled(const ImVec2& bb_min, const ImVec2& bb_max, float pad) // Return true (and count) if the padded bounding box is entirely outside the current clip rectangle
+    {
+#ifndef IMGUI_DISABLE_DRAWLIST_CPU_CULLING
+        // Clip rects and corners given by user code may be inverted: compare the normalized boxes, so nothing a renderer may still draw gets culled
+        const ImVec4& cr = _CmdHeader.ClipRect;
+        const float cr_x1 = cr.x < cr.z ? cr.x : cr.z, cr_x2 = cr.x < cr.z ? cr.z : cr.x;
+        const float cr_y1 = cr.y < cr.w ? cr.y : cr.w, cr_y2 = cr.y < cr.w ? cr.w : cr.y;
+        const float bb_x1 = bb_min.x < bb_max.x ? bb_min.x : bb_max.x, bb_x2 = bb_min.x < bb_max.x ? bb_max.x : bb_min.x;
+        const float bb_y1 = bb_min.y < bb_max.y ? bb_min.y : bb_max.y, bb_y2 = bb_min.y < bb_max.y ? bb_max.y : bb_min.y;
+        if (bb_x2 + pad < cr_x1 || bb_y2 + pad < cr_y1 || bb_x1 - pad > cr_x2 || bb_y1 - pad > cr_y2)
+        {
+            _CulledPrimCount++;
+            return true;
+        }
+#else
+        IM_UNUSED(bb_min); IM_UNUSED(bb_max); IM_UNUSED(pad);
+#endif
+        return false;
+    }
 };
 
 // All draw data to render a Dear ImGui frame
@@ -2641,6 +2732,9 @@ struct ImFontConfig
     void*           FontData;               //          // TTF/OTF data
     int             FontDataSize;           //          // TTF/OTF data size
     bool            FontDataOwnedByAtlas;   // true     // TTF/OTF data ownership taken by the container ImFontAtlas (will delete memory itself).
+    const void*     FontDataCompressed;     // NULL     // stb_compress'ed TTF/OTF data, decompressed into FontData when the atlas is built (not by LoadBuildCacheFromMemory()). Still owned by caller, must persist as long as the atlas. See AddFontFromMemoryCompressedTTF().
+    int             FontDataCompressedSize; // 0        // stb_compress'ed TTF/OTF data size
+    bool            DeferDecompression;     // false    // AddFontFromMemoryCompressedTTF(): reference the compressed data in FontDataCompressed instead of decompressing it right away.
     int             FontNo;                 // 0        // Index of font within TTF/OTF file
     float           SizePixels;             //          // Size in pixels for rasterizer (more or less maps to the resulting font height).
     int             OversampleH;            // 3        // Rasterize at higher quality for sub-pixel positioning. Note the difference between 2 and 3 is minimal so you can reduce this to 2 to save memory. Read https://github.com/nothings/stb/blob/master/tests/oversample/README.md for details.
@@ -2649,6 +2743,7 @@ struct ImFontConfig
     ImVec2          GlyphExtraSpacing;      // 0, 0     // Extra spacing (in pixels) between glyphs. Only X axis is supported for now.
     ImVec2          GlyphOffset;            // 0, 0     // Offset all glyphs from this font input.
     const ImWchar*  GlyphRanges;            // NULL     // Pointer to a user-provided list of Unicode range (2 value per range, values are inclusive, zero-terminated list). THE ARRAY DATA NEEDS TO PERSIST AS LONG AS THE FONT IS ALIVE.
+    const ImWchar*  GlyphRangesDynamic;     // NULL     // Same format as GlyphRanges. Glyphs from those ranges (and not in GlyphRanges) are rasterized on first use into ImFontAtlas::TexDynamicHeight instead of by Build(), e.g. GetGlyphRangesChineseFull(). stb_truetype builder only.
     float           GlyphMinAdvanceX;       // 0        // Minimum AdvanceX for glyphs, set Min to align font icons, set both Min/Max to enforce mono-space font
     float           GlyphMaxAdvanceX;       // FLT_MAX  // Maximum AdvanceX for glyphs
     bool            MergeMode;              // false    // Merge into previous ImFont, so you can combine multiple inputs font into one ImFont (e.g. ASCII font + icons + Japanese glyphs). You may want to use GlyphOffset.y when merge font of different heights.
@@ -2711,6 +2806,7 @@ enum ImFontAtlasFlags_
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
     ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas (save a little texture memory)
     ImFontAtlasFlags_NoBakedLines       = 1 << 2,   // Don't build thick line textures into the atlas (save a little texture memory, allow support for point/nearest filtering). The AntiAliasedLinesUseTex features uses them, otherwise they will be rendered using polygons (more expensive for CPU/GPU).
+    ImFontAtlasFlags_SignedDistanceField= 1 << 3,   // Store a signed distance field of the glyphs instead of their coverage (see TexSdfSpread). Requires a renderer thresholding the texture alpha, which can then draw a single font size at any scale (FontGlobalScale, SetWindowFontScale) without rebuilding. Oversampling and RasterizerMultiply are ignored. Implies ImFontAtlasFlags_NoBakedLines. The white pixel and mouse cursors stay coverage, which the threshold keeps opaque where fully covered. stb_truetype builder only.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2738,7 +2834,7 @@ struct ImFontAtlas
     IMGUI_API ImFont*           AddFontDefault(const ImFontConfig* font_cfg = NULL);
     IMGUI_API ImFont*           AddFontFromFileTTF(const char* filename, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);
     IMGUI_API ImFont*           AddFontFromMemoryTTF(void* font_data, int font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // Note: Transfer ownership of 'ttf_data' to ImFontAtlas! Will be deleted after destruction of the atlas. Set font_cfg->FontDataOwnedByAtlas=false to keep ownership of your data and it won't be freed.
-    IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp.
+    IMGUI_API ImFont*           AddFontFromMemoryCompressedTTF(const void* compressed_font_data, int compressed_font_size, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL); // 'compressed_font_data' still owned by caller. Compress with binary_to_compressed_c.cpp. Set font_cfg->DeferDecompression=true to defer decompression to Build(), 'compressed_font_data' must then persist as long as the atlas.
     IMGUI_API ImFont*           AddFontFromMemoryCompressedBase85TTF(const char* compressed_font_data_base85, float size_pixels, const ImFontConfig* font_cfg = NULL, const ImWchar* glyph_ranges = NULL);              // 'compressed_font_data_base85' still owned by caller. Compress with binary_to_compressed_c.cpp with -base85 parameter.
     IMGUI_API void              ClearInputData();           // Clear input data (all ImFontConfig structures including sizes, TTF data, glyph ranges, etc.) = all the data used to build the texture and fonts.
     IMGUI_API void              ClearTexData();             // Clear output texture data (CPU side). Saves RAM once the texture has been copied to graphics memory.
@@ -2753,6 +2849,11 @@ struct ImFontAtlas
     IMGUI_API bool              Build();                    // Build pixels data. This is called automatically for you by the GetTexData*** functions.
     IMGUI_API void              GetTexDataAsAlpha8(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 1 byte per-pixel
     IMGUI_API void              GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_width, int* out_height, int* out_bytes_per_pixel = NULL);  // 4 bytes-per-pixel
+    IMGUI_API bool              LoadBuildCacheFromDisk(const char* filename);           // Call instead of Build() once fonts are added: restore pixels and glyphs saved by SaveBuildCacheToDisk(). Return false (atlas untouched) if the file is missing or was built from different inputs.
+    IMGUI_API bool              LoadBuildCacheFromMemory(const void* data, size_t data_size);
+    IMGUI_API bool              SaveBuildCacheToDisk(const char* filename);             // Call after Build(), while the CPU side pixels are still available. Return false for atlases with colored glyphs or dynamic glyphs, which aren't supported.
+    IMGUI_API void              SaveBuildCacheToMemory(ImVector<char>* out_buf);
+    IMGUI_API bool              GetTexDataDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h); // Area of TexPixelsAlpha8 (and TexPixelsRGBA32 if allocated) modified by dynamic glyphs since the previous call. Upload it when this returns true. Don't call ClearTexData() on an atlas using dynamic glyphs.
     bool                        IsBuilt() const             { return Fonts.Size > 0 && TexReady; } // Bit ambiguous: used to detect when user didn't built texture but effectively we should check TexID != 0 except that would be backend dependent...
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
@@ -2797,8 +2898,13 @@ struct ImFontAtlas
 
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
-    int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
+    int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. 0 = try each power-of-two width up to TexMaxWidth and keep the one giving the smallest texture.
+    int                         TexMaxWidth;        // Maximum texture width selected by Build() when TexDesiredWidth is 0. Defaults to 4096. Set it to your graphics API texture size limit.
+    int                         TexMaxHeight;       // Maximum height glyphs are packed into. Defaults to 32768. Glyphs which don't fit are left out (with an assert).
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0 (will also need to set AntiAliasedLinesUseTex = false).
+    int                         TexSdfSpread;       // Only with ImFontAtlasFlags_SignedDistanceField: distance in pixels covered by the field on each side of the outline. Defaults to 4. Texels store 128 + 127 * distance / TexSdfSpread (inside is above 128).
+    int                         TexDynamicHeight;   // Height in pixels reserved at the bottom of the texture for glyphs from ImFontConfig::GlyphRangesDynamic. 0 = same as texture width. When full, least recently used glyphs are evicted.
+    int                         BuildThreadsCount;  // Number of threads used by Build() to rasterize glyphs. 0 = one per hardware thread (default), 1 = rasterize on the calling thread. Output is identical whatever the count. The memory allocator (see SetAllocatorFunctions) must be thread-safe.
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
 
     // [Internal]
@@ -2823,6 +2929,15 @@ struct ImFontAtlas
     // [Internal] Packing data
     int                         PackIdMouseCursors; // Custom texture rectangle ID for white pixel and mouse cursors
     int                         PackIdLines;        // Custom texture rectangle ID for baked anti-aliased lines
+    ImFontAtlasDynamicGlyphs*   DynamicGlyphs;      // Set by Build() when at least one ImFontConfig uses GlyphRangesDynamic
+    int                         LookupGeneration;   // Incremented whenever the advances of a font may have changed (lookup table rebuilt, dynamic glyph loaded), invalidating cached text measurements
+
+    // [Internal] Statistics of the last Build(), timings are in milliseconds (filled by the builders, displayed in Metrics/Debugger)
+    float                       BuildTimeParse;     // Font data validation and glyph lookups
+    float                       BuildTimePack;      // Glyph measurement, rectangle packing and texture allocation
+    float                       BuildTimeRaster;    // Glyph rasterization (spread over BuildThreadsCount threads)
+    float                       BuildTimeFinish;    // ImFont setup, custom rects rendering and lookup tables
+    int                         BuildPackedSurface; // Pixels covered by the packed glyphs and custom rects (padding included), to display the texture occupancy
 
     // [Obsolete]
     //typedef ImFontAtlasCustomRect    CustomRect;         // OBSOLETED in 1.72+
@@ -2855,13 +2970,14 @@ struct ImFont
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
+    ImVector<ImU32>             GlyphsUsedBits;     // 12-16 // out //            // Only for fonts with dynamic glyphs: 1-bit per Glyphs[] entry returned by FindGlyph() during the current frame, so they are not evicted while in use.
 
     // Methods
     IMGUI_API ImFont();
     IMGUI_API ~ImFont();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(ImWchar c) const     { float w = ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; return (w >= 0.0f) ? w : FindGlyph(c)->AdvanceX; } // Negative advance: dynamic glyph not rasterized yet
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
 
@@ -2869,6 +2985,7 @@ struct ImFont
     // 'wrap_width' enable automatic word-wrapping across multiple lines to fit into given width. 0.0f to disable.
     IMGUI_API ImVec2            CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end = NULL, const char** remaining = NULL) const; // utf8
     IMGUI_API const char*       CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const;
+    IMGUI_API void              CalcWordWrapLinesA(float scale, const char* text, const char* text_end, float wrap_width, ImVector<int>* out_lines) const; // Lines drawn by RenderText() with this wrap width, as pairs of [begin, end) offsets from 'text'
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const;
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false) const;
 
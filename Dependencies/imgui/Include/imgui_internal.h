@@ -58,6 +58,15 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __AVX__ || defined __SSE4_2__)
+#define IMGUI_ENABLE_SSE4_2
+#include <nmmintrin.h>
+#endif
+#endif
+
+// Hash IDs with the SSE 4.2 CRC32C instructions if available (the lookup table used otherwise gives the same IDs)
+#if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32)
+#define IMGUI_ENABLE_SSE4_2_CRC
 #endif
 
 // Visual Studio warnings
@@ -119,8 +128,10 @@ struct ImGuiContext;                // Main Dear ImGui context
 struct ImGuiContextHook;            // Hook for extensions like ImGuiTestEngine
 struct ImGuiDataTypeInfo;           // Type information associated to a ImGuiDataType enum
 struct ImGuiGroupData;              // Stacked storage data for BeginGroup()/EndGroup()
+struct ImGuiIniSaveThread;          // Background thread writing the .ini file for timed saves
 struct ImGuiInputTextState;         // Internal state of the currently focused/edited text input box
 struct ImGuiLastItemData;           // Status storage for last submitted items
+struct ImGuiMemCounters;            // Atomic allocation counters updated by MemAlloc()/MemFree(), which may run on other threads
 struct ImGuiMenuColumns;            // Simple column measurement, currently used for MenuItem() only
 struct ImGuiNavItemData;            // Result of a gamepad/keyboard directional navigation move query result
 struct ImGuiMetricsConfig;          // Storage for ShowMetricsWindow() and DebugNodeXXX() functions
@@ -140,6 +151,8 @@ struct ImGuiTableInstanceData;      // Storage for one instance of a same table
 struct ImGuiTableTempData;          // Temporary storage for one table (one per table in the stack), shared between tables.
 struct ImGuiTableSettings;          // Storage for a table .ini settings
 struct ImGuiTableColumnsSettings;   // Storage for a column .ini settings
+struct ImGuiTextLayout;             // Storage for the line breaks and size of a long wrapped text, reused across frames
+struct ImGuiTextSizeCacheEntry;     // Storage for a wrapped text measurement reused by CalcTextSize()
 struct ImGuiWindow;                 // Storage for one window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame, in practice we currently keep it for each window)
 struct ImGuiWindowSettings;         // Storage for a window .ini settings (we keep one of those even if the actual window wasn't instanced during this session)
@@ -297,6 +310,7 @@ namespace ImStb
 // - Helper: ImBitArray
 // - Helper: ImBitVector
 // - Helper: ImSpan<>, ImSpanAllocator<>
+// - Helper: ImFrameArena
 // - Helper: ImPool<>
 // - Helper: ImChunkStream<>
 //-----------------------------------------------------------------------------
@@ -332,6 +346,7 @@ IMGUI_API const char*   ImStristr(const char* haystack, const char* haystack_end
 IMGUI_API void          ImStrTrimBlanks(char* str);
 IMGUI_API const char*   ImStrSkipBlank(const char* str);
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
+static inline char      ImToLowerA(char c)              { return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c; }
 static inline bool      ImCharIsBlankW(unsigned int c)  { return c == ' ' || c == '\t' || c == 0x3000; }
 
 // Helpers: Formatting
@@ -628,6 +643,33 @@ struct ImSpanAllocator
     inline void  GetSpan(int n, ImSpan<T>* span)    { span->set((T*)GetSpanPtrBegin(n), (T*)GetSpanPtrEnd(n)); }
 };
 
+// Helper: ImFrameArena
+// Linear allocator for frame-scoped scratch memory, rewound by Reset(). Allocations are never freed individually.
+// - Chunks are allocated with IM_ALLOC(), so they go through the allocator given to SetAllocatorFunctions().
+// - Reset() merges the chunks into a single one, so a frame which doesn't use more memory than the previous one makes no heap allocation.
+// - Reset() shrinks the chunk after IM_FRAME_ARENA_SHRINK_FRAMES frames using less than a quarter of it, so a one-off large allocation (e.g. pasting a large text) doesn't stay reserved.
+#define IM_FRAME_ARENA_SHRINK_FRAMES    60
+struct IMGUI_API ImFrameArena
+{
+    ImVector<char*> Chunks;             // Chunks allocated with IM_ALLOC(). The last one is the current one.
+    char*           Ptr;                // Next free byte in the current chunk
+    char*           PtrEnd;
+    size_t          TotalSize;          // Sum of all chunk sizes
+    size_t          UsedSize;           // Bytes handed out since the last Reset()
+    int             AllocCount;         // Allocations since the last Reset()
+    size_t          LastUsedSize;       // UsedSize and AllocCount before the last Reset(), for display purpose
+    int             LastAllocCount;
+    size_t          UnderusedPeakSize;  // Max UsedSize over the last UnderusedFrames frames
+    int             UnderusedFrames;    // Consecutive frames which used less than a quarter of TotalSize
+
+    ImFrameArena()                      { Ptr = PtrEnd = NULL; TotalSize = UsedSize = LastUsedSize = UnderusedPeakSize = 0; AllocCount = LastAllocCount = UnderusedFrames = 0; }
+    ~ImFrameArena()                     { Clear(); }
+    inline void*    Alloc(size_t sz)    { sz = IM_MEMALIGN(sz, 16); if ((size_t)(PtrEnd - Ptr) < sz) AddChunk(sz); void* p = Ptr; Ptr += sz; UsedSize += sz; AllocCount++; return p; }
+    void            AddChunk(size_t min_sz);
+    void            Reset();
+    void            Clear();
+};
+
 // Helper: ImPool<>
 // Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
@@ -717,6 +759,42 @@ struct ImChunkStream
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImDrawList: Pool recycling CmdBuffer/IdxBuffer/VtxBuffer storage between draw lists (e.g. from compacted windows to new ones).
+// Blocks are sorted in power-of-two size classes, per buffer type so a block's capacity is always a whole number of elements.
+// A budget of 0 disables pooling: blocks are then allocated with the exact requested capacity and freed right away, like ImVector<> does.
+// Not thread-safe: only window draw lists (filled by the thread owning the context) use the context's pool, see ImDrawList::_BufferPool.
+#define IM_DRAWLIST_POOL_CLASS_COUNT    31  // Class n holds blocks with room for (1 << n) elements
+enum ImDrawListPoolBuffer_ { ImDrawListPoolBuffer_Cmd, ImDrawListPoolBuffer_Idx, ImDrawListPoolBuffer_Vtx, ImDrawListPoolBuffer_COUNT };
+
+struct IMGUI_API ImDrawListBufferPool
+{
+    ImVector<void*> FreeBlocks[ImDrawListPoolBuffer_COUNT][IM_DRAWLIST_POOL_CLASS_COUNT];
+    size_t          Budget;                 // Max bytes kept in FreeBlocks[]. The context's pool is set from io.ConfigMemoryDrawListPoolSize by NewFrame().
+    size_t          FreeSize;               // Bytes currently kept in FreeBlocks[]
+    size_t          FreeSizeHighWater;      // Max value reached by FreeSize
+    size_t          UsedSize;               // Bytes held by the draw lists growing from the pool, measured by Render(): not counted by Reserve/Release, as ~ImDrawList() and ImDrawListSplitter free and swap buffers behind the pool's back
+    size_t          UsedSizeHighWater;      // Max value measured for UsedSize
+    int             BlocksAllocated;        // Blocks allocated with IM_ALLOC() because no free block was available
+    int             BlocksReused;           // Blocks taken from FreeBlocks[]
+    int             BlocksFreed;            // Blocks returned to the pool but freed because they were over budget
+
+    ImDrawListBufferPool()                  { Budget = FreeSize = FreeSizeHighWater = UsedSize = UsedSizeHighWater = 0; BlocksAllocated = BlocksReused = BlocksFreed = 0; }
+    ~ImDrawListBufferPool()                 { Clear(); }
+    void    ReserveBuffer(int type, size_t elem_size, void** p_data, int size, int* p_capacity, int new_capacity);
+    void    ReleaseBuffer(int type, size_t elem_size, void** p_data, int* p_size, int* p_capacity);
+    void    Trim(size_t budget);            // Free blocks until FreeSize <= budget
+    void    Clear()                         { Trim(0); }
+
+    inline void Reserve(ImVector<ImDrawCmd>& v, int new_capacity)     { ReserveVector(ImDrawListPoolBuffer_Cmd, v, new_capacity); }
+    inline void Reserve(ImVector<ImDrawIdx>& v, int new_capacity)     { ReserveVector(ImDrawListPoolBuffer_Idx, v, new_capacity); }
+    inline void Reserve(ImVector<ImDrawVert>& v, int new_capacity)    { ReserveVector(ImDrawListPoolBuffer_Vtx, v, new_capacity); }
+    inline void Release(ImVector<ImDrawCmd>& v)                       { ReleaseVector(ImDrawListPoolBuffer_Cmd, v); }
+    inline void Release(ImVector<ImDrawIdx>& v)                       { ReleaseVector(ImDrawListPoolBuffer_Idx, v); }
+    inline void Release(ImVector<ImDrawVert>& v)                      { ReleaseVector(ImDrawListPoolBuffer_Vtx, v); }
+    template<typename T> void ReserveVector(int type, ImVector<T>& v, int new_capacity) { if (new_capacity <= v.Capacity) return; void* data = v.Data; ReserveBuffer(type, sizeof(T), &data, v.Size, &v.Capacity, new_capacity); v.Data = (T*)data; }
+    template<typename T> void ReleaseVector(int type, ImVector<T>& v)                   { void* data = v.Data; ReleaseBuffer(type, sizeof(T), &data, &v.Size, &v.Capacity); v.Data = NULL; }
+};
+
 // Data shared between all ImDrawList instances
 // You may want to create your own instance of this if you want to use ImDrawList completely without ImGui. In that case, watch out for future changes to this structure.
 struct IMGUI_API ImDrawListSharedData
@@ -1164,6 +1242,30 @@ struct ImGuiPtrOrIndex
     ImGuiPtrOrIndex(int index)  { Ptr = NULL; Index = index; }
 };
 
+// Line breaks and size of a wrapped text, reused as long as the text, font, font size, wrap width and font advances are unchanged.
+// Only long texts are cached (see FindOrCreateTextLayout()): short ones wrap about as fast as they hash.
+struct ImGuiTextLayout
+{
+    ImGuiID         Key;            // Hash of text, font, font size and wrap width
+    int             TextLen;
+    int             Generation;     // ImFontAtlas::LookupGeneration at the time of layout
+    int             LastFrameUsed;
+    ImVec2          Size;           // Same as CalcTextSize() with this wrap width
+    ImVector<int>   Lines;          // Output of ImFont::CalcWordWrapLinesA()
+
+    ImGuiTextLayout()   { Key = 0; TextLen = Generation = 0; LastFrameUsed = -1; }
+};
+
+// Result of a CalcTextSize() call on wrapped text, reused as long as the text, font, font size, wrap width and font advances are unchanged.
+// (not worth it for unwrapped text, which measures faster than it hashes)
+struct ImGuiTextSizeCacheEntry
+{
+    ImGuiID     Key;            // Hash of text, font, font size and wrap width
+    int         TextLen;
+    int         Generation;     // ImFontAtlas::LookupGeneration at the time of measurement
+    ImVec2      Size;
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Inputs support
 //-----------------------------------------------------------------------------
@@ -1479,6 +1581,9 @@ struct ImGuiWindowSettings
     ImVec2ih    Size;
     bool        Collapsed;
     bool        WantApply;      // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    bool        WantSave;       // Set when the data changed since it was last written to .ini data
+    int         IniTextOffset;  // Offset/size of our text in the last .ini data written by the handler (see g.SettingsWindowsIniText), size 0 when not written
+    int         IniTextSize;
 
     ImGuiWindowSettings()       { memset(this, 0, sizeof(*this)); }
     char* GetName()             { return (char*)(this + 1); }
@@ -1595,6 +1700,7 @@ struct ImGuiContext
     float                   FontSize;                           // (Shortcut) == FontBaseSize * g.CurrentWindow->FontWindowScale == window->FontSize(). Text height for current window.
     float                   FontBaseSize;                       // (Shortcut) == IO.FontGlobalScale * Font->Scale * Font->FontSize. Base text height.
     ImDrawListSharedData    DrawListSharedData;
+    ImDrawListBufferPool    DrawListBufferPool;                 // Recycle draw list buffers of compacted windows, see io.ConfigMemoryDrawListPoolSize
     double                  Time;
     int                     FrameCount;
     int                     FrameCountEnded;
@@ -1813,6 +1919,9 @@ struct ImGuiContext
     ImVector<ImGuiSettingsHandler>      SettingsHandlers;       // List of .ini settings handlers
     ImChunkStream<ImGuiWindowSettings>  SettingsWindows;        // ImGuiWindow .ini settings entries
     ImChunkStream<ImGuiTableSettings>   SettingsTables;         // ImGuiTable .ini settings entries
+    ImGuiTextBuffer                     SettingsWindowsIniText; // Text last written by the windows handler, reused for unchanged entries
+    ImGuiTextBuffer                     SettingsTablesIniText;  // Text last written by the tables handler, reused for unchanged entries
+    ImGuiIniSaveThread*                 SettingsSaveThread;     // Writes the .ini file of timed saves in the background (created on first use)
     ImVector<ImGuiContextHook>          Hooks;                  // Hooks for extensions (e.g. test engine)
     ImGuiID                             HookIdNext;             // Next available HookId
 
@@ -1847,6 +1956,16 @@ struct ImGuiContext
     int                     WantCaptureKeyboardNextFrame;       // "
     int                     WantTextInputNextFrame;
     ImVector<char>          TempBuffer;                         // Temporary text buffer
+    ImFrameArena            FrameArena;                         // Scratch memory returned by MemAllocFrame(), rewound by NewFrame()
+    ImGuiMemCounters*       MemCounters;                        // Created by Initialize(), destroyed by Shutdown()
+    ImU32                   FrameMemAllocsBase;                 // Value of MemCounters->Allocs at the last NewFrame(), see io.MetricsFrameAllocations
+    ImGuiFrameStats         FrameStats[2];                      // [FrameStatsIdx] is being collected, the other one is the last frame returned by GetFrameStats()
+    int                     FrameStatsIdx;
+    ImU32                   FrameStatsStorageLookupsBase;       // Value of the global storage lookup counter when FrameStats[FrameStatsIdx] was started
+    ImU32                   FrameStatsAllocsBase;               // Values of MemCounters when FrameStats[FrameStatsIdx] was started
+    ImU32                   FrameStatsFreesBase;
+    ImU64                   FrameStatsAllocBytesBase;
+    ImGuiTextSizeCacheEntry TextSizeCache[64];                  // Direct-mapped by key. See CalcTextSize().
 
     ImGuiContext(ImFontAtlas* shared_font_atlas)
     {
@@ -1979,6 +2098,7 @@ struct ImGuiContext
 
         SettingsLoaded = false;
         SettingsDirtyTimer = 0.0f;
+        SettingsSaveThread = NULL;
         HookIdNext = 0;
 
         LogEnabled = false;
@@ -1999,6 +2119,12 @@ struct ImGuiContext
         FramerateSecPerFrameIdx = FramerateSecPerFrameCount = 0;
         FramerateSecPerFrameAccum = 0.0f;
         WantCaptureMouseNextFrame = WantCaptureKeyboardNextFrame = WantTextInputNextFrame = -1;
+        MemCounters = NULL;
+        FrameMemAllocsBase = 0;
+        FrameStatsIdx = 0;
+        FrameStatsStorageLookupsBase = FrameStatsAllocsBase = FrameStatsFreesBase = 0;
+        FrameStatsAllocBytesBase = 0;
+        memset(TextSizeCache, 0, sizeof(TextSizeCache));
     }
 };
 
@@ -2056,6 +2182,17 @@ struct IMGUI_API ImGuiWindowTempData
     ImVector<float>         TextWrapPosStack;       // Store text wrap pos to restore (attention: .back() is not == TextWrapPos)
 };
 
+// Hash of a label submitted by a window, see ImGuiWindow::GetID()
+#define IM_ID_MEMO_KEY_SIZE         23      // Longer labels are always hashed
+#define IM_ID_MEMO_MAX_ENTRIES      65536   // Labels submitted by a window past this count in a frame are always hashed
+struct ImGuiIDMemoEntry
+{
+    ImGuiID                 Seed;
+    ImGuiID                 ID;
+    ImU8                    Len;
+    char                    Key[IM_ID_MEMO_KEY_SIZE];   // Copy of the label, compared rather than its address as label buffers are often reused
+};
+
 // Storage for one window
 struct IMGUI_API ImGuiWindow
 {
@@ -2114,6 +2251,8 @@ struct IMGUI_API ImGuiWindow
     ImVec2                  SetWindowPosPivot;                  // store window pivot for positioning. ImVec2(0, 0) when positioning from top-left corner; ImVec2(0.5f, 0.5f) for centering; ImVec2(1, 1) for bottom right.
 
     ImVector<ImGuiID>       IDStack;                            // ID stack. ID are hashes seeded with the value at the top of the stack. (In theory this should be in the TempData structure)
+    ImVector<ImGuiIDMemoEntry> IDMemo;                          // Labels hashed by GetID() in the previous frame, in submission order. Only used when hashing IDs in software.
+    int                     IDMemoIdx;                          // Next entry of IDMemo, reset by the first Begin() of the frame.
     ImGuiWindowTempData     DC;                                 // Temporary per-window data, reset at the beginning of the frame. This used to be called ImGuiDrawContext, hence the "DC" variable name.
 
     // The best way to understand what those rectangles are is to use the 'Metrics->Tools->Show Windows Rectangles' viewer.
@@ -2133,6 +2272,7 @@ struct IMGUI_API ImGuiWindow
     float                   ItemWidthDefault;
     ImGuiStorage            StateStorage;
     ImVector<ImGuiOldColumns> ColumnsStorage;
+    ImVector<ImGuiTextLayout> TextLayouts;                      // Line breaks of long wrapped texts recently submitted to this window, see FindOrCreateTextLayout()
     float                   FontWindowScale;                    // User scale multiplier per-window, via SetWindowFontScale()
     int                     SettingsOffset;                     // Offset into SettingsWindows[] (offsets are always valid as we only grow the array from the back)
 
@@ -2512,6 +2652,9 @@ struct ImGuiTableSettings
     ImGuiTableColumnIdx         ColumnsCount;
     ImGuiTableColumnIdx         ColumnsCountMax;        // Maximum number of columns this settings instance can store, we can recycle a settings instance with lower number of columns but not higher
     bool                        WantApply;              // Set when loaded from .ini data (to enable merging/loading .ini data into an already running context)
+    bool                        WantSave;               // Set by TableSaveSettings() when the data needs to be written to .ini data again
+    int                         IniTextOffset;          // Offset/size of our text in the last .ini data written by the handler (see g.SettingsTablesIniText), size 0 when not written
+    int                         IniTextSize;
 
     ImGuiTableSettings()        { memset(this, 0, sizeof(*this)); }
     ImGuiTableColumnSettings*   GetColumnSettings()     { return (ImGuiTableColumnSettings*)(this + 1); }
@@ -2809,6 +2952,8 @@ namespace ImGui
     // NB: All position are in absolute pixels coordinates (we are never using window coordinates internally)
     IMGUI_API void          RenderText(ImVec2 pos, const char* text, const char* text_end = NULL, bool hide_text_after_hash = true);
     IMGUI_API void          RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end, float wrap_width);
+    IMGUI_API void          RenderTextLayout(ImVec2 pos, const char* text, const char* text_end, const ImGuiTextLayout* layout);
+    IMGUI_API const ImGuiTextLayout* FindOrCreateTextLayout(const char* text, const char* text_end, float wrap_width); // Return NULL for texts not worth caching
     IMGUI_API void          RenderTextClipped(const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_end, const ImVec2* text_size_if_known, const ImVec2& align = ImVec2(0, 0), const ImRect* clip_rect = NULL);
     IMGUI_API void          RenderTextEllipsis(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, float clip_max_x, float ellipsis_max_x, const char* text, const char* text_end, const ImVec2* text_size_if_known);
@@ -2957,12 +3102,19 @@ IMGUI_API const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype();
 IMGUI_API void      ImFontAtlasBuildInit(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent);
 IMGUI_API void      ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opaque);
+IMGUI_API int       ImFontAtlasBuildPackRects(ImFontAtlas* atlas, void* stbrp_rects_opaque, int rects_count);
 IMGUI_API void      ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void      ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned int in_marker_pixel_value);
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Dynamic glyphs (ImFontConfig::GlyphRangesDynamic)
+IMGUI_API void      ImFontAtlasDynamicGlyphsDestroy(ImFontAtlas* atlas);
+IMGUI_API void      ImFontAtlasDynamicGlyphsNewFrame(ImFontAtlas* atlas);
+IMGUI_API void      ImFontAtlasDynamicGlyphsSetupLookup(ImFont* font);
+IMGUI_API const ImFontGlyph* ImFontAtlasDynamicGlyphsLoad(ImFont* font, ImWchar c);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
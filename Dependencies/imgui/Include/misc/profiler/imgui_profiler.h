@@ -0,0 +1,80 @@
+// dear imgui: scoped CPU zone profiler, with Chrome trace export
+// (headers)
+
+// Usage:
+//   ImGuiProfiler::SetThreadName("Main");
+//   ImGuiProfiler::BeginCapture();
+//   while (running)
+//   {
+//       ImGuiProfiler::FrameMark();
+//       { IMGUI_PROFILE_ZONE("Update"); Update(); }    // Record a zone from here to the end of the scope
+//   }
+//   ImGuiProfiler::ExportChromeTrace("trace.json");    // Open with chrome://tracing or https://ui.perfetto.dev
+// - Each thread records into its own fixed size ring buffer of IMGUI_PROFILER_THREAD_EVENTS events: only the most recent events are kept.
+// - Recording is lock-free and does not allocate, except for the ring buffer of a thread on its first zone.
+// - Zone and thread names are stored by pointer: they must outlive the capture (use string literals).
+// - Zones are only recorded while capturing. '#define IMGUI_DISABLE_PROFILER' compiles IMGUI_PROFILE_ZONE() out.
+
+#pragma once
+
+#include "imgui.h"      // IMGUI_API, ImVector, ImGuiTextBuffer
+
+// Default to 16384 events (512 KB) per thread. Must be a power of two.
+#ifndef IMGUI_PROFILER_THREAD_EVENTS
+#define IMGUI_PROFILER_THREAD_EVENTS    16384
+#endif
+
+// Threads starting zones after this many threads have been seen are not recorded.
+#ifndef IMGUI_PROFILER_MAX_THREADS
+#define IMGUI_PROFILER_MAX_THREADS      64
+#endif
+
+// A zone recorded by BeginZone()/EndZone(), or a frame mark recorded by FrameMark()
+struct ImGuiProfilerEvent
+{
+    const char* Name;           // Zone name, NULL for a frame mark
+    ImU64       StartNs;        // std::chrono::steady_clock time, in nanoseconds
+    ImU64       EndNs;          // == StartNs for a frame mark
+    int         ThreadIdx;      // See ImGuiProfiler::GetThreadName()
+    int         Depth;          // Nesting depth of the zone on its thread (0 for outer zones and frame marks)
+};
+
+namespace ImGuiProfiler
+{
+    IMGUI_API void          BeginCapture();
+    IMGUI_API void          EndCapture();
+    IMGUI_API bool          IsCapturing();
+    IMGUI_API void          Clear();                                // Discard the events recorded so far.
+
+    // Recording (from any thread)
+    IMGUI_API void          SetThreadName(const char* name);        // Name of the calling thread in exports (default: "Thread N").
+    IMGUI_API void          BeginZone(const char* name);
+    IMGUI_API void          EndZone();
+    IMGUI_API void          FrameMark();                            // Mark the start of a frame.
+
+    // Reading (from any thread, can be done while capturing)
+    IMGUI_API int           GetThreadCount();
+    IMGUI_API const char*   GetThreadName(int thread_idx);
+    IMGUI_API void          GetEvents(ImVector<ImGuiProfilerEvent>* out_events);   // Append recorded events, in order of completion on each thread.
+    IMGUI_API void          GetNewEvents(ImVector<ImGuiProfilerEvent>* out_events, ImVector<ImU32>* read_indices); // Append the events recorded since the last call with the same 'read_indices' (one per thread, start with an empty vector).
+    IMGUI_API void          ExportChromeTrace(ImGuiTextBuffer* out_buf);           // Append events in the Chrome trace event JSON format.
+    IMGUI_API bool          ExportChromeTrace(const char* filename);
+
+    // Window showing the last frames as stacked bars, and the zones of the selected frame on each thread. Needs frame marks.
+    // Its "Export trace" button writes "imgui_profiler_trace.json" in the working directory.
+    IMGUI_API void          ShowProfilerWindow(bool* p_open = NULL);
+}
+
+struct ImGuiProfilerScope
+{
+    ImGuiProfilerScope(const char* name)    { ImGuiProfiler::BeginZone(name); }
+    ~ImGuiProfilerScope()                   { ImGuiProfiler::EndZone(); }
+};
+
+#ifndef IMGUI_DISABLE_PROFILER
+#define IMGUI_PROFILE_CONCAT_(A, B)     A##B
+#define IMGUI_PROFILE_CONCAT(A, B)      IMGUI_PROFILE_CONCAT_(A, B)
+#define IMGUI_PROFILE_ZONE(NAME)        ImGuiProfilerScope IMGUI_PROFILE_CONCAT(imgui_profile_zone_, __LINE__)(NAME)
+#else
+#define IMGUI_PROFILE_ZONE(NAME)        (void)0
+#endif
@@ -1,1192 +1,724 @@
-static const uint8_t s_iconsKenneyTtf[46184] =
+static const uint8_t s_iconsKenneyTtfCompressed[27557] =
 {
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x80, 0x00, 0x03, 0x00, 0x30, 0x4f, 0x53, 0x2f, 0x32, // ...........0OS/2
-	0x0f, 0x12, 0x07, 0x0b, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x60, 0x63, 0x6d, 0x61, 0x70, // ...........`cmap
-	0x17, 0x56, 0xd3, 0x6a, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x00, 0x54, 0x67, 0x61, 0x73, 0x70, // .V.j.......Tgasp
-	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x70, 0x00, 0x00, 0x00, 0x08, 0x67, 0x6c, 0x79, 0x66, // .......p....glyf
-	0xe9, 0x95, 0x01, 0xa3, 0x00, 0x00, 0x01, 0x78, 0x00, 0x00, 0xa8, 0x50, 0x68, 0x65, 0x61, 0x64, // .......x...Phead
-	0x08, 0x18, 0x87, 0x75, 0x00, 0x00, 0xa9, 0xc8, 0x00, 0x00, 0x00, 0x36, 0x68, 0x68, 0x65, 0x61, // ...u.......6hhea
-	0x07, 0xbf, 0x04, 0xa9, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78, // ...........$hmtx
-	0x96, 0x00, 0x2c, 0x6a, 0x00, 0x00, 0xaa, 0x24, 0x00, 0x00, 0x03, 0xa0, 0x6c, 0x6f, 0x63, 0x61, // ..,j...$....loca
-	0x60, 0xfb, 0x35, 0xe6, 0x00, 0x00, 0xad, 0xc4, 0x00, 0x00, 0x01, 0xd2, 0x6d, 0x61, 0x78, 0x70, // `.5.........maxp
-	0x00, 0xf2, 0x01, 0x07, 0x00, 0x00, 0xaf, 0x98, 0x00, 0x00, 0x00, 0x20, 0x6e, 0x61, 0x6d, 0x65, // ........... name
-	0x7a, 0x55, 0x5f, 0x41, 0x00, 0x00, 0xaf, 0xb8, 0x00, 0x00, 0x04, 0x8f, 0x70, 0x6f, 0x73, 0x74, // zU_A........post
-	0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x48, 0x00, 0x00, 0x00, 0x20, 0x00, 0x03, 0x03, 0xfe, // .......H... ....
-	0x01, 0x90, 0x00, 0x05, 0x00, 0x00, 0x02, 0x99, 0x02, 0xcc, 0x00, 0x00, 0x00, 0x8f, 0x02, 0x99, // ................
-	0x02, 0xcc, 0x00, 0x00, 0x01, 0xeb, 0x00, 0x33, 0x01, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .......3........
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xe9, 0xe3, // ...........@....
-	0x03, 0xc0, 0xff, 0xc0, 0x00, 0x40, 0x03, 0xc0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .....@...@......
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, // ......... ......
-	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x01, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, // ................
-	0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0a, // ...........8....
-	0x00, 0x08, 0x00, 0x02, 0x00, 0x02, 0x00, 0x01, 0x00, 0x20, 0xe9, 0xe3, 0xff, 0xfd, 0xff, 0xff, // ......... ......
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xe9, 0x00, 0xff, 0xfd, 0xff, 0xff, 0x00, 0x01, 0xff, 0xe3, // ..... ..........
-	0x17, 0x04, 0x00, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x01, 0x00, 0x01, 0xff, 0xff, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x37, 0x39, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ......79........
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x37, 0x39, 0x01, 0x00, 0x00, 0x00, // ..........79....
-	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x37, 0x39, // ..............79
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x19, // ................
-	0x00, 0x00, 0x05, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x23, 0x35, 0x09, 0x01, 0x15, // ...#"&'..5.#5...
-	0x23, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x01, 0x82, 0xbe, 0x0d, // #......+..#.....
-	0x17, 0x0a, 0x09, 0x08, 0x7f, 0x01, 0xfa, 0x01, 0xfa, 0x7f, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0xbe, // ................
-	0xfc, 0x3a, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x01, 0x3c, 0x7e, 0x01, 0xfa, 0xfe, 0x06, 0x7e, 0xfe, // .:......<~....~.
-	0xc4, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x01, 0x7c, 0xfe, 0x84, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, // .......|........
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x2c, 0x00, 0x3d, 0x00, 0x00, 0x13, 0x35, 0x3e, 0x03, // .......,.=...5>.
-	0x33, 0x17, 0x1e, 0x03, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x07, 0x23, // 3..............#
-	0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x33, 0x05, 0x27, 0x11, 0x37, // "..'..54>.73.'.7
-	0x3e, 0x01, 0x37, 0x33, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x9b, 0x25, 0x52, // >.73>.54&'..'.%R
-	0x59, 0x61, 0x34, 0x20, 0x2f, 0x57, 0x52, 0x4b, 0x22, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, // Ya4 /WRK"%8%..%8
-	0x25, 0x22, 0x4b, 0x52, 0x57, 0x2f, 0x20, 0x34, 0x61, 0x59, 0x52, 0x25, 0x25, 0x38, 0x25, 0x13, // %"KRW/ 4aYR%%8%.
-	0x13, 0x24, 0x38, 0x24, 0x02, 0x01, 0x85, 0x20, 0x20, 0x37, 0x60, 0x29, 0x02, 0x2e, 0x2e, 0x2e, // .$8$...  7`)....
-	0x2e, 0x2a, 0x61, 0x37, 0x03, 0x25, 0x02, 0x24, 0x38, 0x24, 0x13, 0x02, 0x02, 0x15, 0x25, 0x35, // .*a7.%.$8$....%5
-	0x22, 0x25, 0x52, 0x59, 0x61, 0x34, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x22, 0x34, 0x25, 0x15, 0x03, // "%RYa45aZR%"4%..
-	0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x34, 0x61, 0x59, 0x52, 0x25, 0x2b, 0x02, // .$8$%RZa54aYR%+.
-	0xfd, 0x86, 0x02, 0x05, 0x2e, 0x29, 0x2d, 0x71, 0x42, 0x42, 0x70, 0x2e, 0x29, 0x2d, 0x04, 0x00, // .....)-qBBp.)-..
-	0x00, 0x02, 0x00, 0x08, 0xff, 0xca, 0x03, 0xfa, 0x03, 0xb6, 0x00, 0x16, 0x00, 0x5a, 0x00, 0x00, // .............Z..
-	0x25, 0x26, 0x22, 0x07, 0x15, 0x0f, 0x02, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, // %&".........3267
-	0x3e, 0x01, 0x35, 0x2f, 0x02, 0x01, 0x1e, 0x01, 0x17, 0x15, 0x07, 0x01, 0x1e, 0x01, 0x1f, 0x01, // >.5/............
-	0x14, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x35, 0x2f, 0x03, 0x17, 0x2e, 0x01, // ......#"&'5/....
-	0x27, 0x35, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x1f, 0x02, 0x37, 0x35, // '5..7>.7>.?...75
-	0x37, 0x3e, 0x01, 0x2f, 0x03, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x33, 0x37, // 7>./.&67>.7>.737
-	0x1e, 0x01, 0x17, 0x23, 0x03, 0x60, 0x19, 0x33, 0x1a, 0x0f, 0x01, 0x03, 0x09, 0x0a, 0x0b, 0x1b, // ...#.`.3........
-	0x0e, 0x0f, 0x19, 0x0a, 0x0c, 0x0c, 0x03, 0x13, 0x02, 0xfe, 0xdf, 0x2c, 0x32, 0x07, 0x03, 0x01, // ...........,2...
-	0x1b, 0x1b, 0x1e, 0x03, 0x02, 0x1e, 0x1e, 0x02, 0x1c, 0x4a, 0x2f, 0x29, 0x4a, 0x1f, 0xbc, 0x05, // .........J/)J...
-	0x5d, 0x54, 0x03, 0x37, 0x5e, 0x27, 0x38, 0x31, 0x07, 0x01, 0x09, 0x09, 0x02, 0x05, 0x04, 0x10, // ]T.7^'81........
-	0x0c, 0xb5, 0x22, 0x20, 0x4c, 0x0c, 0x06, 0x06, 0x0e, 0xb4, 0x06, 0x02, 0x01, 0x02, 0x02, 0x05, // .." L...........
-	0x04, 0x0b, 0x13, 0x0a, 0x01, 0x97, 0x31, 0x56, 0x25, 0x02, 0xc3, 0x16, 0x16, 0x01, 0x1b, 0x03, // ......1V%.......
-	0x13, 0x0e, 0x19, 0x0c, 0x09, 0x0a, 0x09, 0x0a, 0x0c, 0x19, 0x0e, 0x14, 0x1d, 0x01, 0x02, 0x96, // ................
-	0x27, 0x61, 0x3a, 0x33, 0x24, 0xfe, 0xe8, 0x17, 0x3b, 0x23, 0x1c, 0x2c, 0x4a, 0x1d, 0x02, 0x1c, // 'a:3$...;#.,J...
-	0x1c, 0x1c, 0x1c, 0x02, 0xba, 0x0d, 0x59, 0x04, 0x01, 0x08, 0x2e, 0x25, 0x02, 0x3a, 0x82, 0x47, // ......Y....%.:.G
-	0x17, 0x2e, 0x17, 0x04, 0x08, 0x02, 0x03, 0x08, 0xb4, 0x13, 0x11, 0x02, 0x4f, 0x0b, 0x18, 0x0c, // ............O...
-	0x17, 0xac, 0x0c, 0x05, 0x08, 0x03, 0x04, 0x06, 0x01, 0x06, 0x09, 0x03, 0x04, 0x08, 0x2f, 0x26, // ............../&
-	0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x18, 0x00, 0x31, 0x00, 0xb3, // .............1..
-	0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, // ...2..........#"
-	0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x35, 0x22, 0x06, 0x07, 0x0e, // &'..5467>.35"...
-	0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, // .......3267>.54&
-	0x27, 0x2e, 0x01, 0x23, 0x05, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x07, // '..#.........+..
-	0x1f, 0x01, 0x16, 0x14, 0x07, 0x0e, 0x01, 0x0f, 0x01, 0x2f, 0x01, 0x07, 0x17, 0x16, 0x14, 0x0f, // ........./......
-	0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x27, 0x0f, 0x01, 0x06, 0x22, // ...#"&'..=.'..."
-	0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x27, 0x07, 0x06, 0x22, 0x2f, // '..'..546?.'.."/
-	0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x37, 0x2f, 0x01, 0x26, 0x34, // ...5467>.;.7/.&4
-	0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x3e, 0x01, 0x37, 0x27, 0x26, // 7>.7>.32...>.7'&
-	0x34, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x17, // 47>.7>.32.......
-	0x37, 0x3e, 0x01, 0x37, 0x36, 0x32, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x0f, 0x01, // 7>.762..........
-	0x17, 0x37, 0x36, 0x32, 0x1f, 0x01, 0x02, 0x00, 0x19, 0x2c, 0x12, 0x12, 0x12, 0x12, 0x12, 0x12, // .762.....,......
-	0x2c, 0x19, 0x19, 0x2c, 0x12, 0x11, 0x12, 0x12, 0x11, 0x12, 0x2c, 0x19, 0x33, 0x56, 0x25, 0x23, // ,..,......,.3V%#
-	0x24, 0x24, 0x23, 0x25, 0x56, 0x33, 0x33, 0x56, 0x25, 0x23, 0x24, 0x24, 0x23, 0x25, 0x56, 0x33, // $$#%V33V%#$$#%V3
-	0x01, 0xd4, 0x13, 0x13, 0x06, 0x05, 0x06, 0x0d, 0x08, 0x69, 0x0c, 0x62, 0x14, 0x03, 0x03, 0x12, // .........i.b....
-	0x38, 0x26, 0x19, 0x1b, 0x4a, 0x38, 0x29, 0x04, 0x04, 0x14, 0x2d, 0x62, 0x35, 0x08, 0x0d, 0x06, // 8&..J8)...-b5...
-	0x05, 0x06, 0x41, 0x27, 0x15, 0x07, 0x0e, 0x07, 0x2e, 0x53, 0x25, 0x06, 0x05, 0x05, 0x06, 0x4a, // ..A'.....S%....J
-	0x26, 0x62, 0x07, 0x0e, 0x07, 0x15, 0x13, 0x13, 0x06, 0x05, 0x06, 0x0d, 0x08, 0x69, 0x0c, 0x62, // &b...........i.b
-	0x14, 0x03, 0x03, 0x12, 0x38, 0x26, 0x05, 0x0d, 0x07, 0x08, 0x0e, 0x05, 0x4a, 0x0e, 0x1b, 0x0f, // ....8&......J...
-	0x29, 0x04, 0x04, 0x03, 0x0a, 0x07, 0x2d, 0x62, 0x35, 0x08, 0x0d, 0x06, 0x05, 0x06, 0x41, 0x29, // ).....-b5.....A)
-	0x02, 0x0a, 0x07, 0x07, 0x0f, 0x08, 0x1d, 0x38, 0x1b, 0x34, 0x06, 0x05, 0x0b, 0x49, 0x25, 0x62, // .......8.4...I%b
-	0x07, 0x0e, 0x07, 0x15, 0x02, 0x3a, 0x12, 0x11, 0x12, 0x2c, 0x19, 0x19, 0x2c, 0x12, 0x12, 0x12, // .....:...,..,...
-	0x12, 0x12, 0x12, 0x2c, 0x19, 0x19, 0x2c, 0x12, 0x11, 0x12, 0x7b, 0x24, 0x23, 0x25, 0x56, 0x33, // ...,..,...{$#%V3
-	0x33, 0x56, 0x25, 0x23, 0x24, 0x24, 0x23, 0x25, 0x56, 0x33, 0x33, 0x56, 0x25, 0x23, 0x24, 0x31, // 3V%#$$#%V33V%#$1
-	0x2d, 0x62, 0x35, 0x08, 0x0d, 0x06, 0x05, 0x06, 0x41, 0x29, 0x14, 0x07, 0x0f, 0x07, 0x2d, 0x53, // -b5.....A)....-S
-	0x26, 0x09, 0x09, 0x4b, 0x26, 0x61, 0x07, 0x0e, 0x07, 0x15, 0x13, 0x13, 0x06, 0x05, 0x06, 0x0e, // &..K&a..........
-	0x07, 0x69, 0x0b, 0x61, 0x14, 0x03, 0x03, 0x12, 0x37, 0x25, 0x06, 0x0d, 0x08, 0x08, 0x0e, 0x05, // .i.a....7%......
-	0x4b, 0x37, 0x29, 0x03, 0x03, 0x14, 0x2d, 0x62, 0x35, 0x08, 0x0d, 0x06, 0x05, 0x06, 0x41, 0x27, // K7)...-b5.....A'
-	0x15, 0x07, 0x0e, 0x07, 0x2e, 0x53, 0x25, 0x06, 0x05, 0x05, 0x06, 0x4a, 0x0b, 0x13, 0x08, 0x62, // .....S%....J...b
-	0x07, 0x0e, 0x07, 0x07, 0x0b, 0x03, 0x13, 0x13, 0x06, 0x05, 0x06, 0x0d, 0x08, 0x69, 0x0c, 0x62, // .............i.b
-	0x07, 0x0a, 0x03, 0x03, 0x03, 0x0c, 0x20, 0x15, 0x2f, 0x05, 0x0e, 0x08, 0x19, 0x4a, 0x38, 0x29, // ...... ./....J8)
-	0x04, 0x04, 0x14, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x14, // ................
-	0x00, 0x62, 0x00, 0x00, 0x01, 0x17, 0x11, 0x0f, 0x01, 0x23, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, // .b.......#'..5.4
-	0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1f, 0x01, 0x15, 0x1e, 0x03, 0x15, 0x14, // 67>.;.2.........
-	0x0e, 0x02, 0x0f, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, // ......#"..'..54>
-	0x02, 0x3f, 0x02, 0x3e, 0x01, 0x17, 0x32, 0x16, 0x1f, 0x02, 0x0f, 0x02, 0x0e, 0x01, 0x15, 0x14, // .?.>..2.........
-	0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x3f, 0x02, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x23, // ....326?.>.54&'#
-	0x2f, 0x01, 0x34, 0x36, 0x3f, 0x01, 0x3e, 0x01, 0x33, 0x17, 0x02, 0x51, 0x09, 0x09, 0x16, 0x79, // /.46?.>.3..Q...y
-	0x16, 0x04, 0x05, 0x05, 0x04, 0x05, 0x0a, 0x07, 0x79, 0x06, 0x0b, 0x05, 0xfb, 0x1a, 0x25, 0x37, // ........y.....%7
-	0x25, 0x13, 0x13, 0x25, 0x37, 0x25, 0x02, 0x24, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, // %..%7%.$QYa55aYR
-	0x25, 0x25, 0x37, 0x25, 0x13, 0x12, 0x24, 0x35, 0x23, 0x06, 0x18, 0x05, 0x0b, 0x07, 0x06, 0x0a, // %%7%..$5#.......
-	0x04, 0x4e, 0x07, 0x0a, 0x0c, 0x05, 0x2d, 0x2d, 0x2f, 0x30, 0x2f, 0x72, 0x43, 0x41, 0x70, 0x2f, // .N....--/0/rCAp/
-	0x04, 0x05, 0x2d, 0x2d, 0x2f, 0x30, 0x01, 0x0e, 0x0a, 0x03, 0x04, 0x4f, 0x04, 0x0b, 0x07, 0x15, // ..--/0.....O....
-	0x03, 0xb1, 0x15, 0xfe, 0x00, 0x15, 0x09, 0x09, 0x04, 0x0b, 0x06, 0x02, 0x00, 0x06, 0x0a, 0x05, // ................
-	0x04, 0x05, 0x05, 0x04, 0x7d, 0x17, 0x01, 0x25, 0x51, 0x58, 0x60, 0x34, 0x34, 0x60, 0x58, 0x50, // ....}..%QX`44`XP
-	0x24, 0x02, 0x24, 0x37, 0x24, 0x13, 0x13, 0x24, 0x37, 0x24, 0x25, 0x51, 0x58, 0x60, 0x34, 0x33, // $.$7$..$7$%QX`43
-	0x5e, 0x57, 0x4f, 0x25, 0x07, 0x15, 0x04, 0x03, 0x01, 0x05, 0x05, 0x5c, 0x15, 0x15, 0x0b, 0x04, // ^WO%............
-	0x2f, 0x6f, 0x41, 0x42, 0x71, 0x2f, 0x2e, 0x2f, 0x2c, 0x2d, 0x04, 0x05, 0x2e, 0x6e, 0x41, 0x42, // /oABq/./,-...nAB
-	0x71, 0x2f, 0x0d, 0x15, 0x06, 0x0b, 0x04, 0x5c, 0x05, 0x06, 0x06, 0x00, 0x00, 0x04, 0x00, 0x06, // q/..............
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x00, // ........... .+..
-	0x01, 0x33, 0x17, 0x35, 0x33, 0x11, 0x21, 0x35, 0x33, 0x27, 0x35, 0x21, 0x33, 0x15, 0x37, 0x33, // .3.53.!53'5!3.73
-	0x15, 0x07, 0x33, 0x15, 0x21, 0x11, 0x01, 0x37, 0x23, 0x35, 0x21, 0x11, 0x23, 0x35, 0x07, 0x23, // ..3.!..7#5!.#5.#
-	0x35, 0x21, 0x15, 0x23, 0x11, 0x21, 0x15, 0x23, 0x17, 0x15, 0x23, 0x27, 0x02, 0x7e, 0x7f, 0x7e, // 5!.#.!.#..#'.~.~
-	0x7f, 0xfe, 0x84, 0x7f, 0x7f, 0xfd, 0x88, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0xfe, 0x84, 0x02, 0x78, // ........~......x
-	0x7f, 0x7f, 0x01, 0x7c, 0x7f, 0x7e, 0x7f, 0xfe, 0x07, 0x7f, 0x01, 0x7c, 0x7f, 0x7f, 0x7f, 0x7e, // ...|.~.....|...~
-	0x01, 0x42, 0x7f, 0x7f, 0xfe, 0x84, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x01, 0x7c, // .B.....~....~..|
-	0x01, 0x7b, 0x7e, 0x7f, 0xfe, 0x84, 0x7f, 0x7f, 0x7f, 0x7f, 0x01, 0x7c, 0x7f, 0x7e, 0x7f, 0x7f, // .{~........|.~..
-	0x00, 0x04, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x20, // ............... 
-	0x00, 0x2b, 0x00, 0x00, 0x25, 0x17, 0x15, 0x23, 0x27, 0x15, 0x23, 0x11, 0x21, 0x15, 0x23, 0x25, // .+..%..#'.#.!.#%
-	0x21, 0x11, 0x23, 0x35, 0x07, 0x23, 0x35, 0x37, 0x23, 0x35, 0x01, 0x11, 0x21, 0x35, 0x33, 0x27, // !.#5.#57#5..!53'
-	0x35, 0x33, 0x17, 0x35, 0x33, 0x21, 0x15, 0x07, 0x33, 0x15, 0x21, 0x11, 0x33, 0x15, 0x37, 0x33, // 53.53!..3.!.3.73
-	0x03, 0x7b, 0x7f, 0x7f, 0x7e, 0x7f, 0x01, 0x7c, 0x7f, 0xfc, 0x8b, 0x01, 0x7c, 0x7f, 0x7e, 0x7f, // .{..~..|....|.~.
-	0x7f, 0x7f, 0x01, 0x7c, 0xfe, 0x84, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x02, 0x78, 0x7f, 0x7f, 0xfe, // ...|.....~..x...
-	0x84, 0x7f, 0x7e, 0x7f, 0xc3, 0x7e, 0x7f, 0x7f, 0x7f, 0x01, 0x7c, 0x7f, 0x7f, 0xfe, 0x84, 0x7f, // ..~..~....|.....
-	0x7f, 0x7f, 0x7e, 0x7f, 0x02, 0x78, 0xfe, 0x84, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, // ..~..x...~....~.
-	0x01, 0x7c, 0x7f, 0x7f, 0x00, 0x09, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x04, // .|..............
-	0x00, 0x09, 0x00, 0x0e, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x3f, 0x00, 0x44, // ...........".?.D
-	0x00, 0x00, 0x13, 0x33, 0x35, 0x23, 0x15, 0x1d, 0x01, 0x33, 0x35, 0x23, 0x13, 0x35, 0x23, 0x15, // ...35#...35#.5#.
-	0x33, 0x01, 0x11, 0x21, 0x11, 0x21, 0x13, 0x33, 0x35, 0x23, 0x15, 0x11, 0x33, 0x35, 0x23, 0x15, // 3..!.!.35#..35#.
-	0x01, 0x11, 0x21, 0x11, 0x21, 0x25, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, // ..!.!%......#!"&
-	0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, // '..5.467>.3!2...
-	0x01, 0x15, 0x07, 0x23, 0x15, 0x33, 0x35, 0x64, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x01, // ...#.35d|||||||.
-	0xdc, 0xfe, 0x85, 0x01, 0x7b, 0x5f, 0x7d, 0x7d, 0x7d, 0x7d, 0xfe, 0x26, 0x01, 0x7b, 0xfe, 0x85, // ....{_}}}}.&.{..
-	0x02, 0xb9, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, // ................
-	0x09, 0x17, 0x0e, 0x03, 0x74, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x62, 0x7d, 0x7d, 0x01, 0x81, 0x9e, // ....t.....b}}...
-	0x9e, 0xbe, 0x9e, 0x9e, 0x01, 0xfa, 0x9e, 0x9e, 0xfd, 0x68, 0x01, 0x5c, 0xfe, 0xa4, 0x01, 0x5c, // .........h......
-	0x9e, 0x9e, 0xfe, 0xa4, 0x9e, 0x9e, 0x03, 0x36, 0xfe, 0x85, 0x01, 0x7b, 0x1f, 0xfc, 0x8c, 0x0e, // .......6...{....
-	0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, 0x09, 0x0a, // ..........s.....
-	0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x1f, 0x9e, 0x9e, 0x00, 0x01, 0x00, 0x35, 0xff, 0xc6, 0x03, 0xcd, // ...........5....
-	0x03, 0xba, 0x00, 0x1e, 0x00, 0x00, 0x01, 0x05, 0x21, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, // ........!......#
-	0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x27, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x25, // !"&'..5.'&67>.7%
-	0x17, 0x1e, 0x01, 0x1f, 0x01, 0x03, 0xb1, 0xfd, 0x90, 0x02, 0x8c, 0x08, 0x09, 0x09, 0x14, 0x0b, // ................
-	0xfd, 0x0f, 0x0c, 0x15, 0x09, 0x08, 0x08, 0x34, 0x03, 0x02, 0x06, 0x06, 0x12, 0x0c, 0x02, 0xd6, // .......4........
-	0x2b, 0x0b, 0x0f, 0x03, 0x35, 0x02, 0xce, 0xa8, 0xfd, 0xda, 0x0c, 0x15, 0x09, 0x08, 0x08, 0x08, // +...5...........
-	0x08, 0x09, 0x15, 0x0c, 0x01, 0xec, 0xc2, 0x0c, 0x17, 0x0a, 0x0b, 0x0e, 0x04, 0xc2, 0x06, 0x06, // ................
-	0x11, 0x0c, 0xc3, 0x00, 0x00, 0x03, 0x00, 0x06, 0xff, 0xf0, 0x03, 0xf9, 0x03, 0x90, 0x00, 0x18, // ................
-	0x00, 0x31, 0x00, 0x5c, 0x00, 0x00, 0x25, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, // .1....%467>.32..
-	0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x21, // ........#"&'..5!
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, // 467>.32.........
-	0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x01, 0x17, 0x1e, 0x01, 0x07, 0x15, 0x03, 0x07, // .#"&'..5........
-	0x0e, 0x01, 0x0f, 0x02, 0x21, 0x22, 0x26, 0x27, 0x23, 0x2e, 0x01, 0x27, 0x35, 0x03, 0x23, 0x22, // ....!"&'#..'5.#"
-	0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x17, 0x21, 0x32, // &'..=.467>.3!.!2
-	0x16, 0x17, 0x02, 0xae, 0x12, 0x12, 0x12, 0x2c, 0x1a, 0x19, 0x2b, 0x12, 0x13, 0x12, 0x12, 0x13, // .......,..+.....
-	0x12, 0x2b, 0x19, 0x1a, 0x2c, 0x12, 0x12, 0x12, 0xfe, 0x50, 0x11, 0x12, 0x13, 0x2c, 0x19, 0x1a, // .+..,....P...,..
-	0x2b, 0x12, 0x12, 0x13, 0x13, 0x12, 0x12, 0x2b, 0x1a, 0x19, 0x2c, 0x13, 0x12, 0x11, 0x02, 0xdd, // +......+..,.....
-	0x02, 0x11, 0x0e, 0x03, 0x4e, 0x01, 0x03, 0x17, 0x14, 0x05, 0x3e, 0xfe, 0x31, 0x14, 0x1f, 0x0d, // ....N.....>.1...
-	0x01, 0x15, 0x18, 0x03, 0x47, 0x8d, 0x06, 0x0b, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x0b, 0x06, // ....G...........
-	0x01, 0x71, 0x0a, 0x01, 0xe6, 0x1a, 0x2a, 0x11, 0x6b, 0x1a, 0x2c, 0x13, 0x11, 0x12, 0x12, 0x11, // .q....*.k.,.....
-	0x13, 0x2c, 0x1a, 0x19, 0x2b, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x2b, 0x19, 0x1a, 0x2c, 0x13, // .,..+......+..,.
-	0x11, 0x12, 0x12, 0x11, 0x13, 0x2c, 0x1a, 0x19, 0x2b, 0x12, 0x13, 0x12, 0x12, 0x13, 0x12, 0x2b, // .....,..+......+
-	0x19, 0x03, 0x00, 0x01, 0x13, 0x2c, 0x19, 0x04, 0xfe, 0x67, 0x01, 0x13, 0x20, 0x0d, 0x01, 0x0e, // .....,...g.. ...
-	0x07, 0x08, 0x0d, 0x20, 0x13, 0x01, 0x01, 0x81, 0x04, 0x05, 0x05, 0x0a, 0x07, 0x5c, 0x07, 0x0a, // ... ............
-	0x05, 0x05, 0x04, 0x01, 0x12, 0x12, 0x00, 0x00, 0x00, 0x03, 0x00, 0x22, 0xff, 0xc6, 0x03, 0xde, // ..........."....
-	0x03, 0xba, 0x00, 0x18, 0x00, 0x33, 0x00, 0x4e, 0x00, 0x00, 0x17, 0x2e, 0x01, 0x27, 0x03, 0x26, // .....3.N.....'.&
-	0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x07, 0x03, 0x07, 0x0e, 0x01, // 67>.3!2.........
-	0x23, 0x21, 0x27, 0x01, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, // #!'..........#"&
-	0x2f, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x07, 0x14, // /...5467>.32....
-	0x06, 0x0f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x3f, 0x01, // .....#"&'..546?.
-	0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x86, 0x09, 0x0a, 0x01, 0x50, 0x02, 0x05, // >.32.........P..
-	0x07, 0x08, 0x16, 0x0e, 0x03, 0x4f, 0x0d, 0x15, 0x08, 0x08, 0x07, 0x02, 0x50, 0x15, 0x09, 0x13, // .....O......P...
-	0x0b, 0xfd, 0x5b, 0x27, 0x02, 0x40, 0xe4, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x23, 0x14, 0x14, 0x22, // ..['.@......#.."
-	0x0e, 0xe4, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x22, 0x14, 0x15, 0x22, 0x0f, 0xe9, 0x0e, 0x0d, 0xe4, // ......."..".....
-	0x0f, 0x23, 0x14, 0x15, 0x22, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0xe4, 0x0e, 0x22, 0x15, 0x14, 0x23, // .#.."......."..#
-	0x0f, 0x0d, 0x0e, 0x2e, 0x06, 0x0d, 0x08, 0x01, 0xa8, 0x0b, 0x15, 0x09, 0x09, 0x08, 0x09, 0x08, // ................
-	0x09, 0x14, 0x0b, 0xfe, 0x57, 0x1b, 0x06, 0x06, 0x0c, 0x03, 0xca, 0xe4, 0x0e, 0x22, 0x14, 0x14, // ....W........"..
-	0x23, 0x0f, 0x0e, 0x0e, 0x0e, 0x0e, 0xe4, 0x0f, 0x23, 0x14, 0x14, 0x22, 0x0e, 0x0f, 0x0f, 0x0f, // #.......#.."....
-	0x0f, 0x44, 0x14, 0x23, 0x0f, 0xe4, 0x0e, 0x0e, 0x0e, 0x0e, 0x0f, 0x23, 0x14, 0x14, 0x23, 0x0d, // .D.#.......#..#.
-	0xe4, 0x0f, 0x0f, 0x0f, 0x0f, 0x0e, 0x22, 0x14, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ......".........
-	0x03, 0xba, 0x00, 0x1f, 0x00, 0x3d, 0x00, 0x00, 0x01, 0x21, 0x32, 0x16, 0x1f, 0x01, 0x11, 0x0f, // .....=...!2.....
-	0x01, 0x2f, 0x01, 0x0f, 0x01, 0x27, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x27, 0x2e, // ./...'...546?.'.
-	0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x03, 0x23, 0x11, 0x21, 0x35, 0x33, 0x15, 0x14, // .5467>.3.#.!53..
-	0x06, 0x07, 0x23, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, // ..#..#!"&'..5.46
-	0x37, 0x3e, 0x01, 0x3b, 0x01, 0x15, 0x01, 0xa9, 0x02, 0x2e, 0x07, 0x0c, 0x05, 0x0b, 0x0b, 0x18, // 7>.;............
-	0x19, 0x73, 0xfe, 0x19, 0x18, 0xfe, 0xe9, 0x05, 0x06, 0x06, 0x05, 0xfe, 0x73, 0x05, 0x05, 0x05, // .s..........s...
-	0x05, 0x06, 0x0c, 0x07, 0x8c, 0x8b, 0x02, 0x2e, 0x8b, 0x09, 0x0a, 0x02, 0x0a, 0x19, 0x0d, 0xfd, // ................
-	0x46, 0x0f, 0x19, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x19, 0x0f, 0xd1, 0x03, 0xba, 0x06, 0x05, // F...............
-	0x18, 0xfd, 0xd2, 0x19, 0x0a, 0x0a, 0x73, 0xfe, 0x0b, 0x0b, 0x01, 0x17, 0x05, 0x0c, 0x07, 0x07, // ......s.........
-	0x0c, 0x06, 0xfe, 0x73, 0x06, 0x0c, 0x07, 0x07, 0x0c, 0x05, 0x05, 0x06, 0xfe, 0xc6, 0xfd, 0xd2, // ...s............
-	0x8b, 0xd1, 0x0f, 0x19, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a, 0x19, 0x0f, 0x02, 0xb8, 0x0f, 0x19, // ................
-	0x0a, 0x0b, 0x0a, 0x8b, 0x00, 0x01, 0x00, 0x22, 0xff, 0xc6, 0x03, 0xde, 0x03, 0xba, 0x00, 0x48, // .......".......H
-	0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, // ...2..........#"
-	0x26, 0x2f, 0x01, 0x07, 0x17, 0x07, 0x17, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, // &/.....7>.32....
-	0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x37, 0x27, 0x07, // ......#"&'..57'.
-	0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, // ..#"&'..5467>.32
-	0x16, 0x1f, 0x01, 0x37, 0x27, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x03, 0x15, 0x29, 0x47, 0x1e, // ...7'467>.3..)G.
-	0x1d, 0x1e, 0x1d, 0x1e, 0x1e, 0x47, 0x29, 0x2a, 0x48, 0x1d, 0x10, 0xc5, 0x04, 0x07, 0xc7, 0x11, // .....G)*H.......
-	0x1d, 0x48, 0x2a, 0x29, 0x47, 0x1e, 0x1d, 0x1e, 0x1d, 0x1e, 0x1e, 0x47, 0x29, 0x2a, 0x48, 0x1d, // .H*)G......G)*H.
-	0x1d, 0x1d, 0x03, 0xd3, 0x03, 0x1e, 0x47, 0x29, 0x2a, 0x48, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, 0x1d, // ......G)*H......
-	0x48, 0x2a, 0x29, 0x47, 0x1e, 0x0b, 0xcb, 0x03, 0x1d, 0x1d, 0x1d, 0x48, 0x2a, 0x03, 0xba, 0x1d, // H*)G.......H*...
-	0x1d, 0x1e, 0x48, 0x2b, 0x29, 0x47, 0x1e, 0x1d, 0x1e, 0x1e, 0x1d, 0x11, 0x88, 0x29, 0x36, 0x7e, // ..H+)G.......)6~
-	0x13, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, 0x48, 0x2a, 0x2a, 0x48, 0x1d, 0x1e, 0x1e, 0x1e, 0x1e, 0x1d, // ......H**H......
-	0x48, 0x2a, 0x1e, 0x85, 0x03, 0x1d, 0x1e, 0x1e, 0x1d, 0x1e, 0x48, 0x2a, 0x2a, 0x48, 0x1d, 0x1e, // H*........H**H..
-	0x1d, 0x1d, 0x1e, 0x0b, 0x8a, 0x20, 0x2b, 0x48, 0x1e, 0x1d, 0x1d, 0x00, 0x00, 0x01, 0x00, 0x07, // ..... +H........
-	0x00, 0x01, 0x03, 0xf9, 0x03, 0x7f, 0x00, 0x21, 0x00, 0x00, 0x13, 0x1e, 0x01, 0x1f, 0x01, 0x01, // .......!........
-	0x3e, 0x01, 0x37, 0x36, 0x16, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x16, 0x06, 0x07, 0x01, 0x07, 0x23, // >.76...........#
-	0x27, 0x01, 0x2e, 0x01, 0x37, 0x34, 0x36, 0x3f, 0x01, 0x3e, 0x01, 0x17, 0xf2, 0x0a, 0x10, 0x08, // '...746?.>......
-	0x9e, 0x01, 0x3c, 0x06, 0x0f, 0x09, 0x0a, 0x10, 0x07, 0xbd, 0x07, 0x08, 0x01, 0x05, 0x05, 0xfd, // ..<.............
-	0xe6, 0x16, 0x19, 0x18, 0xfe, 0x83, 0x07, 0x05, 0x01, 0x08, 0x07, 0xbb, 0x08, 0x11, 0x08, 0x02, // ................
-	0xc4, 0x01, 0x08, 0x07, 0xbe, 0x01, 0x77, 0x08, 0x08, 0x02, 0x01, 0x06, 0x06, 0xa2, 0x05, 0x0f, // ......w.........
-	0x0a, 0x09, 0x12, 0x07, 0xfd, 0x7d, 0x0e, 0x0e, 0x01, 0xc8, 0x08, 0x10, 0x09, 0x0a, 0x10, 0x06, // .....}..........
-	0xa1, 0x06, 0x06, 0x01, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x3c, // ...............<
-	0x00, 0x00, 0x13, 0x34, 0x36, 0x3f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x37, 0x3e, // ...46?.>.32...7>
-	0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x17, 0x1e, 0x01, // .32.............
-	0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x07, 0x0e, 0x01, 0x23, // .......#"&/....#
-	0x22, 0x26, 0x2f, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x06, // "&/...546?.'..5.
-	0x0a, 0x0b, 0xac, 0x09, 0x17, 0x0f, 0x0e, 0x18, 0x0b, 0xd9, 0xdd, 0x09, 0x18, 0x0e, 0x0d, 0x18, // ................
-	0x0a, 0xac, 0x09, 0x0a, 0x0a, 0x09, 0xdb, 0xdb, 0x09, 0x0a, 0x0a, 0x09, 0xac, 0x0a, 0x18, 0x0d, // ................
-	0x0e, 0x18, 0x09, 0xdd, 0xd9, 0x0b, 0x18, 0x0e, 0x0f, 0x17, 0x09, 0xac, 0x0a, 0x0b, 0x0a, 0x0b, // ................
-	0xdb, 0xdb, 0x0a, 0x0b, 0x02, 0xca, 0x0f, 0x17, 0x09, 0xac, 0x0a, 0x0b, 0x0a, 0x0b, 0xdb, 0xdb, // ................
-	0x0a, 0x0b, 0x0a, 0x0b, 0xac, 0x09, 0x17, 0x0f, 0x0d, 0x18, 0x0a, 0xdb, 0xdd, 0x09, 0x17, 0x0d, // ................
-	0x0f, 0x18, 0x0a, 0xac, 0x09, 0x0a, 0x0a, 0x09, 0xdd, 0xdd, 0x09, 0x0a, 0x0a, 0x09, 0xac, 0x0a, // ................
-	0x18, 0x0f, 0x0d, 0x17, 0x09, 0xdd, 0xdb, 0x0a, 0x18, 0x0d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x2e, 0x00, 0x6b, 0x00, 0x00, 0x01, 0x27, 0x2e, 0x03, // .........k...'..
-	0x27, 0x07, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x03, 0x15, 0x14, 0x1e, 0x02, 0x1f, // '.#"............
-	0x01, 0x1e, 0x03, 0x17, 0x3e, 0x03, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x2e, 0x02, // ....>.7>.7>.54..
-	0x27, 0x03, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x23, 0x06, 0x26, 0x2f, 0x01, // '..........#.&/.
-	0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x27, // ...#"&/...546?.'
-	0x2e, 0x01, 0x37, 0x34, 0x36, 0x3f, 0x01, 0x3e, 0x01, 0x37, 0x32, 0x16, 0x1f, 0x01, 0x37, 0x3e, // ..746?.>.72...7>
-	0x01, 0x33, 0x1e, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x16, 0x06, 0x0f, 0x01, 0x17, 0x03, 0x7b, // .3.............{
-	0x16, 0x25, 0x51, 0x59, 0x60, 0x34, 0x01, 0x02, 0x39, 0x67, 0x2f, 0x29, 0x4b, 0x22, 0x26, 0x37, // .%QY`4..9g/)K"&7
-	0x25, 0x12, 0x13, 0x25, 0x37, 0x25, 0x16, 0x23, 0x4e, 0x54, 0x5a, 0x30, 0x35, 0x61, 0x5a, 0x52, // %..%7%.#NTZ05aZR
-	0x25, 0x22, 0x35, 0x12, 0x15, 0x16, 0x10, 0x20, 0x2f, 0x20, 0x8d, 0x0a, 0x09, 0x08, 0x08, 0x2e, // %"5.... / ......
-	0x09, 0x17, 0x0d, 0x0e, 0x17, 0x09, 0x6f, 0x6f, 0x09, 0x17, 0x0e, 0x0e, 0x16, 0x08, 0x2e, 0x09, // ......oo........
-	0x08, 0x09, 0x0a, 0x6e, 0x70, 0x09, 0x09, 0x01, 0x0a, 0x09, 0x2e, 0x08, 0x16, 0x0c, 0x0d, 0x16, // ...np...........
-	0x0a, 0x70, 0x70, 0x0a, 0x16, 0x0d, 0x0c, 0x16, 0x0a, 0x2e, 0x08, 0x09, 0x01, 0x09, 0x09, 0x71, // .pp............q
-	0x6f, 0x03, 0x0e, 0x16, 0x25, 0x37, 0x25, 0x14, 0x01, 0x02, 0x15, 0x15, 0x13, 0x35, 0x22, 0x25, // o...%7%......5"%
-	0x52, 0x59, 0x61, 0x35, 0x34, 0x60, 0x58, 0x51, 0x25, 0x16, 0x1f, 0x2f, 0x20, 0x11, 0x01, 0x01, // RYa54`XQ%../ ...
-	0x13, 0x25, 0x38, 0x25, 0x22, 0x4b, 0x29, 0x2e, 0x67, 0x39, 0x30, 0x5b, 0x53, 0x4d, 0x23, 0xfe, // .%8%"K).g90[SM#.
-	0x3c, 0x0a, 0x16, 0x0c, 0x0e, 0x15, 0x08, 0x2d, 0x0a, 0x09, 0x01, 0x09, 0x09, 0x70, 0x6e, 0x0a, // <......-.....pn.
-	0x09, 0x08, 0x07, 0x2e, 0x09, 0x17, 0x0e, 0x0c, 0x16, 0x0a, 0x6e, 0x70, 0x09, 0x18, 0x0e, 0x0c, // ..........np....
-	0x15, 0x0a, 0x2d, 0x08, 0x0a, 0x01, 0x0b, 0x09, 0x70, 0x70, 0x09, 0x0a, 0x01, 0x09, 0x09, 0x2e, // ..-.....pp......
-	0x09, 0x16, 0x0b, 0x0d, 0x16, 0x09, 0x70, 0x70, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ......pp........
-	0x03, 0xba, 0x00, 0x3c, 0x00, 0x00, 0x13, 0x21, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, // ...<...!.467>.;.
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x14, // 2......!2.......
-	0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, // ....#!......+."&
-	0x27, 0x2e, 0x01, 0x35, 0x11, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, // '..5.!"&'..=.467
-	0x3e, 0x01, 0x33, 0x46, 0x01, 0x3c, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, // >.3F.<.....~....
-	0x09, 0x01, 0x3c, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfe, 0xc4, 0x09, // ..<.............
-	0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0xfe, 0xc4, 0x0e, 0x17, 0x09, 0x09, // ....~...........
-	0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x02, 0x3e, 0x01, 0x3b, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, // .......>.;......
-	0x09, 0x0a, 0x16, 0x0d, 0xfe, 0xc4, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, // ...........~....
-	0x08, 0xfe, 0xc4, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x01, 0x3c, 0x08, // ..............<.
-	0x09, 0x09, 0x17, 0x0e, 0x7d, 0x0d, 0x17, 0x09, 0x0a, 0x09, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, // ....}...........
-	0xff, 0xc3, 0x03, 0xfd, 0x03, 0xbd, 0x00, 0x2e, 0x00, 0x6b, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x27, // .........k.....'
-	0x2e, 0x03, 0x2f, 0x01, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x23, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x15, // ../."....#......
-	0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x3b, 0x01, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x26, // ......;.>.7>.54&
-	0x27, 0x07, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // '......+.......+
-	0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x35, // ."&'..=.#"&'..'5
-	0x3e, 0x01, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, // >.7>.;.5467>.;.2
-	0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x03, 0xdd, // ......32........
-	0x12, 0x3b, 0x29, 0x22, 0x4c, 0x52, 0x58, 0x2f, 0x20, 0x34, 0x62, 0x5a, 0x52, 0x25, 0x02, 0x28, // .;)"LRX/ 4bZR%.(
-	0x3a, 0x12, 0x10, 0x10, 0x13, 0x25, 0x38, 0x26, 0x25, 0x52, 0x5a, 0x62, 0x34, 0x20, 0x2f, 0x58, // :....%8&%RZb4 /X
-	0x52, 0x4c, 0x22, 0x26, 0x38, 0x25, 0x13, 0x10, 0x10, 0x9f, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x9f, // RL"&8%..........
-	0x09, 0x0a, 0x0a, 0x16, 0x0b, 0x41, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x9f, 0x0e, 0x17, 0x0a, 0x07, // .....A..........
-	0x09, 0x01, 0x01, 0x09, 0x07, 0x0a, 0x17, 0x0e, 0x9f, 0x09, 0x0a, 0x08, 0x17, 0x0d, 0x41, 0x0c, // ..............A.
-	0x16, 0x09, 0x0a, 0x09, 0x9f, 0x0d, 0x16, 0x0a, 0x0a, 0x09, 0x02, 0x75, 0x31, 0x59, 0x28, 0x23, // ...........u1Y(#
-	0x35, 0x25, 0x15, 0x02, 0x02, 0x13, 0x25, 0x37, 0x25, 0x02, 0x28, 0x59, 0x31, 0x2a, 0x5a, 0x31, // 5%....%7%.(Y1*Z1
-	0x35, 0x62, 0x5a, 0x53, 0x25, 0x25, 0x37, 0x25, 0x13, 0x03, 0x15, 0x25, 0x35, 0x22, 0x25, 0x53, // 5bZS%%7%...%5"%S
-	0x5a, 0x62, 0x35, 0x31, 0x5a, 0x2a, 0xde, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x9f, 0x0d, 0x16, 0x0a, // Zb51Z*..........
-	0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x9f, 0x0a, 0x09, 0x09, 0x16, 0x0e, 0x41, 0x0c, 0x15, // .............A..
-	0x0a, 0x09, 0x0a, 0x9f, 0x0d, 0x17, 0x0a, 0x08, 0x09, 0x09, 0x08, 0x0a, 0x17, 0x0d, 0x9f, 0x0a, // ................
-	0x09, 0x0b, 0x15, 0x0b, 0x41, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x01, 0x42, 0x03, 0xfa, // ....A........B..
-	0x02, 0x3e, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, // .>..............
-	0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, // #!"&'..=.467>.3!
-	0x32, 0x16, 0x17, 0x03, 0xe7, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, 0x17, // 2...............
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x74, 0x0d, 0x16, 0x0a, 0x02, 0x2b, 0x09, // .........t....+.
-	0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7d, 0x0d, 0x17, // ..~..........}..
-	0x09, 0x0a, 0x09, 0x09, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ................
-	0x03, 0xba, 0x00, 0x2e, 0x00, 0x4b, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x03, 0x2f, 0x01, // .....K.....'../.
-	0x22, 0x0e, 0x02, 0x07, 0x15, 0x23, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x1e, 0x02, 0x17, // "....#..........
-	0x1e, 0x03, 0x3b, 0x01, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x26, 0x27, 0x07, 0x14, 0x06, // ..;.>.7>.54&'...
-	0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x35, 0x3e, 0x01, 0x37, 0x3e, // ...#!"&'..'5>.7>
-	0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x03, 0xda, 0x12, 0x3b, 0x28, 0x22, // .3!2.........;("
-	0x4b, 0x52, 0x57, 0x2f, 0x20, 0x34, 0x61, 0x59, 0x52, 0x25, 0x02, 0x27, 0x3a, 0x12, 0x10, 0x10, // KRW/ 4aYR%.':...
-	0x13, 0x25, 0x38, 0x25, 0x25, 0x52, 0x59, 0x61, 0x34, 0x20, 0x2f, 0x57, 0x52, 0x4b, 0x22, 0x25, // .%8%%RYa4 /WRK"%
-	0x38, 0x25, 0x13, 0x10, 0x10, 0x9e, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0xfe, 0x06, 0x0d, 0x17, 0x0a, // 8%..............
-	0x08, 0x08, 0x01, 0x01, 0x08, 0x08, 0x0a, 0x17, 0x0d, 0x01, 0xfa, 0x0c, 0x17, 0x09, 0x0a, 0x09, // ................
-	0x02, 0x74, 0x30, 0x59, 0x28, 0x22, 0x35, 0x25, 0x15, 0x02, 0x02, 0x13, 0x24, 0x38, 0x24, 0x02, // .t0Y("5%....$8$.
-	0x28, 0x59, 0x30, 0x2a, 0x5a, 0x30, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x37, 0x25, 0x13, 0x03, // (Y0*Z05aZR%$7%..
-	0x15, 0x25, 0x34, 0x22, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x30, 0x5a, 0x2a, 0xdb, 0x0b, 0x14, 0x08, // .%4"%RZa50Z*....
-	0x08, 0x09, 0x09, 0x08, 0x08, 0x13, 0x0c, 0x4e, 0x0c, 0x13, 0x08, 0x08, 0x09, 0x09, 0x08, 0x08, // .......N........
-	0x14, 0x0b, 0x4e, 0x00, 0x00, 0x02, 0x00, 0xf4, 0xff, 0xc6, 0x03, 0x0c, 0x03, 0xba, 0x00, 0x31, // ..N............1
-	0x00, 0x4c, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x33, 0x32, 0x16, 0x17, // .L...2......32..
-	0x1e, 0x01, 0x1d, 0x01, 0x0f, 0x01, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, // ......!"&'..=.46
-	0x37, 0x35, 0x3e, 0x01, 0x3b, 0x01, 0x11, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, // 75>.;..#"&'..=.4
-	0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, // 67>.3!'..5467>.3
-	0x32, 0x16, 0x17, 0x23, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x35, 0x0e, 0x01, 0x23, 0x22, 0x26, // 2..#......5..#"&
-	0x27, 0x02, 0x3b, 0x12, 0x20, 0x0d, 0x0d, 0x0e, 0x1d, 0x12, 0x20, 0x0d, 0x0d, 0x0e, 0x09, 0x15, // '.;. ..... .....
-	0xfe, 0x24, 0x06, 0x0a, 0x05, 0x04, 0x05, 0x0d, 0x0d, 0x0d, 0x20, 0x13, 0x1d, 0x59, 0x06, 0x0a, // .$........ ..Y..
-	0x05, 0x04, 0x05, 0x05, 0x04, 0x05, 0x0a, 0x06, 0x01, 0x29, 0xa5, 0x15, 0x16, 0x16, 0x15, 0x17, // .........)......
-	0x34, 0x1f, 0x1f, 0x35, 0x16, 0x02, 0x16, 0x17, 0x17, 0x16, 0x15, 0x34, 0x1f, 0x1f, 0x35, 0x16, // 4..5.......4..5.
-	0x02, 0x55, 0x0e, 0x0d, 0x0d, 0x20, 0x12, 0xfe, 0x7e, 0x0e, 0x0d, 0x0d, 0x20, 0x11, 0x3c, 0x15, // .U... ..~... .<.
-	0x09, 0x05, 0x04, 0x05, 0x0a, 0x06, 0x3a, 0x13, 0x1f, 0x0d, 0x01, 0x0d, 0x0e, 0x01, 0x29, 0x05, // ......:.......).
-	0x04, 0x05, 0x0a, 0x06, 0x77, 0x06, 0x0a, 0x05, 0x04, 0x05, 0x66, 0x17, 0x34, 0x1f, 0x1e, 0x34, // ....w.....f.4..4
-	0x16, 0x16, 0x17, 0x17, 0x16, 0x16, 0x34, 0x1e, 0x20, 0x36, 0x15, 0x01, 0x15, 0x16, 0x16, 0x15, // ......4. 6......
-	0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x2c, 0x00, 0x47, 0x00, 0x79, // ...........,.G.y
-	0x00, 0x00, 0x01, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x23, 0x0e, 0x03, 0x15, 0x14, 0x1e, 0x02, 0x17, // ..."....#.......
-	0x1e, 0x03, 0x3b, 0x01, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, // ..;.>.7>.54..'..
-	0x2f, 0x01, 0x15, 0x32, 0x16, 0x17, 0x23, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x35, 0x0e, 0x01, // /..2..#......5..
-	0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x07, 0x33, 0x32, // #"&'..5467>.3.32
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x0f, 0x01, // ......32........
-	0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x35, 0x3e, 0x01, 0x3b, 0x01, // !"&'..=.4675>.;.
-	0x35, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x02, // 5#"&'..=.467>.3.
-	0x00, 0x34, 0x61, 0x59, 0x52, 0x25, 0x02, 0x24, 0x38, 0x24, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, // .4aYR%.$8$..%8%%
-	0x52, 0x59, 0x61, 0x34, 0x20, 0x2f, 0x57, 0x52, 0x4b, 0x22, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, // RYa4 /WRK"%8%..%
-	0x38, 0x25, 0x22, 0x4b, 0x52, 0x57, 0x2f, 0x20, 0x15, 0x24, 0x0f, 0x01, 0x0f, 0x0f, 0x0f, 0x0f, // 8%"KRW/ .$......
-	0x0f, 0x23, 0x15, 0x15, 0x24, 0x0f, 0x0f, 0x0e, 0x0e, 0x0f, 0x0f, 0x24, 0x15, 0xa2, 0xcb, 0x0c, // .#..$......$....
-	0x15, 0x09, 0x09, 0x09, 0x15, 0x0c, 0x15, 0x09, 0x09, 0x09, 0x06, 0x0e, 0xfe, 0xbc, 0x04, 0x07, // ................
-	0x03, 0x03, 0x03, 0x08, 0x09, 0x09, 0x16, 0x0c, 0x15, 0x3d, 0x04, 0x07, 0x03, 0x03, 0x03, 0x03, // .........=......
-	0x03, 0x03, 0x07, 0x04, 0x03, 0xba, 0x13, 0x24, 0x38, 0x24, 0x02, 0x25, 0x52, 0x59, 0x61, 0x34, // .......$8$.%RYa4
-	0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x37, 0x25, 0x13, 0x03, 0x15, 0x25, 0x34, 0x22, 0x25, 0x52, // 5aZR%$7%...%4"%R
-	0x5a, 0x61, 0x35, 0x34, 0x61, 0x59, 0x52, 0x25, 0x22, 0x35, 0x25, 0x15, 0x02, 0x02, 0xa2, 0x0f, // Za54aYR%"5%.....
-	0x0f, 0x0f, 0x24, 0x14, 0x16, 0x24, 0x0f, 0x01, 0x0e, 0x0f, 0x0f, 0x0e, 0x0f, 0x24, 0x15, 0x15, // ..$..$.......$..
-	0x23, 0x0f, 0x0f, 0x0f, 0xf3, 0x09, 0x09, 0x09, 0x15, 0x0c, 0xfe, 0xf8, 0x09, 0x09, 0x09, 0x16, // #...............
-	0x0c, 0x28, 0x0e, 0x06, 0x03, 0x03, 0x03, 0x07, 0x04, 0x27, 0x0d, 0x15, 0x09, 0x01, 0x09, 0x09, // .(.......'......
-	0xcb, 0x03, 0x03, 0x03, 0x07, 0x04, 0x51, 0x04, 0x07, 0x03, 0x03, 0x03, 0x00, 0x02, 0x00, 0xc4, // ......Q.........
-	0xff, 0xc6, 0x03, 0x3c, 0x03, 0xba, 0x00, 0x18, 0x00, 0x5a, 0x00, 0x00, 0x25, 0x32, 0x16, 0x17, // ...<.....Z..%2..
-	0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, // ........#"&'..54
-	0x36, 0x37, 0x3e, 0x01, 0x33, 0x03, 0x0e, 0x01, 0x2b, 0x01, 0x2f, 0x02, 0x3e, 0x01, 0x37, 0x3e, // 67>.3...+./.>.7>
-	0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x33, 0x0f, 0x02, 0x15, // .32.........3...
-	0x0f, 0x01, 0x23, 0x15, 0x33, 0x0f, 0x01, 0x15, 0x0f, 0x01, 0x23, 0x27, 0x2e, 0x01, 0x27, 0x35, // ..#.3.....#'..'5
-	0x33, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x3f, 0x02, 0x27, 0x2e, 0x01, 0x07, 0x22, 0x06, 0x07, 0x35, // 3>.7>.?.'..."..5
-	0x0e, 0x01, 0x0f, 0x01, 0x02, 0x0d, 0x1e, 0x33, 0x15, 0x16, 0x15, 0x15, 0x16, 0x15, 0x33, 0x1e, // .......3......3.
-	0x1d, 0x31, 0x14, 0x15, 0x14, 0x14, 0x15, 0x14, 0x31, 0x1d, 0x41, 0x06, 0x0d, 0x08, 0xc9, 0x13, // .1......1.A.....
-	0x0e, 0x03, 0x06, 0x34, 0x2d, 0x2c, 0x6f, 0x43, 0x44, 0x6d, 0x2b, 0x2c, 0x2b, 0x09, 0x08, 0x12, // ...4-,oCDm+,+...
-	0x02, 0x1d, 0x01, 0x19, 0x3b, 0x18, 0x09, 0x09, 0x06, 0x03, 0x0b, 0x1d, 0xc0, 0x1b, 0x06, 0x06, // ....;...........
-	0x01, 0x05, 0x01, 0x07, 0x05, 0x07, 0x1f, 0x19, 0x55, 0x08, 0x0b, 0x04, 0x0b, 0x07, 0x07, 0x0d, // ........U.......
-	0x06, 0x07, 0x08, 0x02, 0x0e, 0xe3, 0x14, 0x14, 0x14, 0x33, 0x1e, 0x1e, 0x33, 0x16, 0x14, 0x15, // .........3..3...
-	0x15, 0x14, 0x15, 0x33, 0x1f, 0x1e, 0x33, 0x14, 0x14, 0x14, 0x01, 0x80, 0x05, 0x05, 0x07, 0x0e, // ...3..3.........
-	0x18, 0x48, 0x71, 0x28, 0x2a, 0x29, 0x25, 0x24, 0x27, 0x6a, 0x43, 0x20, 0x30, 0x0f, 0x21, 0x2a, // .Hq(*)%$'jC 0.!*
-	0x02, 0x1c, 0x02, 0x39, 0x1b, 0x01, 0x08, 0x1b, 0x16, 0x1a, 0x09, 0x09, 0x06, 0x0d, 0x07, 0x58, // ...9...........X
-	0x0e, 0x17, 0x09, 0x0f, 0x29, 0x1a, 0x55, 0x23, 0x23, 0x06, 0x04, 0x01, 0x06, 0x06, 0x01, 0x0b, // ....).U##.......
-	0x1d, 0x12, 0x19, 0x00, 0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x2c, // ...............,
-	0x00, 0x6e, 0x00, 0x87, 0x00, 0x00, 0x01, 0x22, 0x0e, 0x02, 0x07, 0x15, 0x23, 0x0e, 0x03, 0x15, // .n....."....#...
-	0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x3b, 0x01, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x2e, // ......;.>.7>.54.
-	0x02, 0x27, 0x2e, 0x03, 0x2f, 0x01, 0x17, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, // .'../..2........
-	0x01, 0x33, 0x0f, 0x02, 0x15, 0x0f, 0x01, 0x23, 0x15, 0x33, 0x0f, 0x01, 0x15, 0x0f, 0x01, 0x23, // .3.....#.3.....#
-	0x27, 0x2e, 0x01, 0x3d, 0x01, 0x33, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x3f, 0x02, 0x27, 0x2e, 0x01, // '..=.3>.7>.?.'..
-	0x07, 0x22, 0x06, 0x07, 0x35, 0x0e, 0x01, 0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x2f, 0x02, 0x3e, // ."..5......+./.>
-	0x01, 0x37, 0x3e, 0x01, 0x33, 0x13, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, // .7>.3.2.........
-	0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x02, 0x00, // .#"&'..5467>.3..
-	0x34, 0x61, 0x59, 0x52, 0x25, 0x02, 0x24, 0x38, 0x24, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x52, // 4aYR%.$8$..%8%%R
-	0x59, 0x61, 0x34, 0x20, 0x2f, 0x57, 0x52, 0x4b, 0x22, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, // Ya4 /WRK"%8%..%8
-	0x25, 0x22, 0x4b, 0x52, 0x57, 0x2f, 0x20, 0x06, 0x2b, 0x47, 0x1b, 0x1c, 0x1c, 0x06, 0x06, 0x0b, // %"KRW/ .+G......
-	0x01, 0x12, 0x01, 0x10, 0x26, 0x0f, 0x06, 0x06, 0x04, 0x02, 0x07, 0x12, 0x7c, 0x11, 0x04, 0x04, // ....&.......|...
-	0x03, 0x01, 0x04, 0x03, 0x05, 0x14, 0x10, 0x36, 0x05, 0x07, 0x02, 0x08, 0x04, 0x05, 0x08, 0x03, // .......6........
-	0x05, 0x05, 0x01, 0x0a, 0x03, 0x09, 0x05, 0x80, 0x0d, 0x09, 0x02, 0x04, 0x21, 0x1d, 0x1d, 0x47, // ............!..G
-	0x2b, 0x02, 0x13, 0x21, 0x0e, 0x0e, 0x0d, 0x0d, 0x0e, 0x0e, 0x21, 0x13, 0x12, 0x20, 0x0d, 0x0d, // +..!......!.. ..
-	0x0d, 0x0d, 0x0d, 0x0d, 0x20, 0x12, 0x03, 0xba, 0x13, 0x24, 0x38, 0x24, 0x02, 0x25, 0x52, 0x59, // .... ....$8$.%RY
-	0x61, 0x34, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x37, 0x25, 0x13, 0x03, 0x15, 0x25, 0x34, 0x22, // a45aZR%$7%...%4"
-	0x25, 0x52, 0x5a, 0x61, 0x35, 0x34, 0x61, 0x59, 0x52, 0x25, 0x22, 0x35, 0x25, 0x15, 0x02, 0x02, // %RZa54aYR%"5%...
-	0xb6, 0x17, 0x17, 0x19, 0x44, 0x2b, 0x15, 0x1e, 0x0a, 0x15, 0x1c, 0x01, 0x12, 0x01, 0x24, 0x12, // ....D+........$.
-	0x01, 0x05, 0x11, 0x0e, 0x10, 0x06, 0x06, 0x03, 0x08, 0x05, 0x39, 0x09, 0x0f, 0x05, 0x0a, 0x1a, // ..........9.....
-	0x11, 0x36, 0x17, 0x16, 0x04, 0x03, 0x01, 0x04, 0x04, 0x01, 0x07, 0x13, 0x0c, 0x10, 0x03, 0x03, // .6..............
-	0x04, 0x09, 0x10, 0x2e, 0x49, 0x19, 0x1b, 0x1a, 0xfe, 0x2e, 0x0c, 0x0d, 0x0d, 0x21, 0x13, 0x13, // ....I........!..
-	0x21, 0x0e, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x21, 0x14, 0x13, 0x21, 0x0d, 0x0d, 0x0c, 0x00, 0x00, // !......!..!.....
-	0x00, 0x02, 0x01, 0x79, 0xff, 0xc6, 0x02, 0x87, 0x03, 0xba, 0x00, 0x1a, 0x00, 0x37, 0x00, 0x00, // ...y.........7..
-	0x25, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x23, 0x1e, 0x01, 0x15, 0x14, 0x06, // %467>.32..#.....
-	0x07, 0x35, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x13, 0x1e, 0x01, 0x15, 0x11, // .5..#"&'..5.....
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, // .....+."&'..5.46
-	0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x01, 0x79, 0x14, 0x13, 0x14, 0x30, 0x1c, 0x1d, // 7>.;.2...y...0..
-	0x30, 0x13, 0x02, 0x15, 0x14, 0x14, 0x15, 0x13, 0x2f, 0x1c, 0x1d, 0x30, 0x13, 0x13, 0x14, 0xfa, // 0......./..0....
-	0x0a, 0x0a, 0x0a, 0x0a, 0x0b, 0x17, 0x0e, 0x86, 0x0f, 0x18, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x0a, // ................
-	0x18, 0x0f, 0x86, 0x0e, 0x17, 0x0b, 0x4d, 0x1c, 0x2f, 0x14, 0x14, 0x14, 0x14, 0x14, 0x15, 0x2f, // ......M./....../
-	0x1b, 0x1c, 0x31, 0x15, 0x02, 0x13, 0x14, 0x14, 0x13, 0x14, 0x30, 0x1c, 0x03, 0x58, 0x0a, 0x17, // ..1.......0..X..
-	0x0e, 0xfe, 0x07, 0x0f, 0x18, 0x0a, 0x0a, 0x09, 0x09, 0x0a, 0x0a, 0x18, 0x0f, 0x01, 0xf8, 0x0e, // ................
-	0x18, 0x0a, 0x0a, 0x0b, 0x0b, 0x0a, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ................
-	0x03, 0xba, 0x00, 0x2a, 0x00, 0x47, 0x00, 0x62, 0x00, 0x00, 0x01, 0x22, 0x0e, 0x02, 0x07, 0x15, // ...*.G.b..."....
-	0x23, 0x0e, 0x03, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x3e, // #.........32>.7>
-	0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x23, 0x07, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, // .54..'..#.32....
-	0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, // .......+."&'..5.
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x13, 0x32, 0x16, 0x17, 0x23, 0x1e, 0x01, 0x15, 0x14, 0x06, // 467>.3.2..#.....
-	0x07, 0x35, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, // .5..#"&'..5467>.
-	0x33, 0x02, 0x00, 0x34, 0x61, 0x59, 0x52, 0x25, 0x02, 0x24, 0x38, 0x24, 0x13, 0x13, 0x25, 0x38, // 3..4aYR%.$8$..%8
-	0x25, 0x25, 0x52, 0x59, 0x61, 0x34, 0x34, 0x61, 0x59, 0x52, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, // %%RYa44aYR%%8%..
-	0x25, 0x38, 0x25, 0x25, 0x52, 0x59, 0x61, 0x34, 0x29, 0x52, 0x08, 0x0e, 0x06, 0x06, 0x06, 0x06, // %8%%RYa4)R......
-	0x06, 0x06, 0x0e, 0x08, 0x52, 0x08, 0x0f, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x0f, 0x08, 0x29, // ....R..........)
-	0x11, 0x1d, 0x0c, 0x01, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x1c, 0x11, 0x11, 0x1d, 0x0c, 0x0b, 0x0c, // ................
-	0x0c, 0x0b, 0x0c, 0x1d, 0x11, 0x03, 0xba, 0x13, 0x24, 0x38, 0x24, 0x02, 0x25, 0x52, 0x59, 0x61, // ........$8$.%RYa
-	0x34, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x37, 0x25, 0x13, 0x13, 0x25, 0x37, 0x24, 0x25, 0x52, // 45aZR%$7%..%7$%R
-	0x5a, 0x61, 0x35, 0x34, 0x61, 0x59, 0x52, 0x25, 0x25, 0x38, 0x25, 0x13, 0xca, 0x06, 0x06, 0x06, // Za54aYR%%8%.....
-	0x0e, 0x09, 0xfe, 0xd0, 0x08, 0x0f, 0x06, 0x06, 0x05, 0x05, 0x06, 0x06, 0x0f, 0x08, 0x01, 0x2f, // .............../
-	0x09, 0x0f, 0x06, 0x06, 0x06, 0xfe, 0x42, 0x0c, 0x0c, 0x0c, 0x1d, 0x10, 0x11, 0x1e, 0x0c, 0x01, // ......B.........
-	0x0b, 0x0c, 0x0c, 0x0b, 0x0d, 0x1c, 0x11, 0x11, 0x1c, 0x0c, 0x0c, 0x0c, 0x00, 0x03, 0x00, 0x07, // ................
-	0xff, 0xe6, 0x03, 0xf9, 0x03, 0x93, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x07, // .........7......
-	0x0e, 0x01, 0x15, 0x11, 0x14, 0x16, 0x1f, 0x02, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x11, // ........3267>.5.
-	0x34, 0x26, 0x27, 0x2e, 0x01, 0x2b, 0x01, 0x22, 0x06, 0x07, 0x13, 0x22, 0x06, 0x07, 0x0e, 0x01, // 4&'..+."..."....
-	0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x15, 0x3e, 0x01, 0x35, 0x34, 0x26, // ......3267.>.54&
-	0x27, 0x33, 0x2e, 0x01, 0x23, 0x03, 0x36, 0x32, 0x17, 0x33, 0x1e, 0x01, 0x17, 0x01, 0x1e, 0x01, // '3..#.62.3......
-	0x07, 0x15, 0x0e, 0x01, 0x07, 0x33, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, // .....3..#!"&'..'
-	0x26, 0x36, 0x37, 0x33, 0x01, 0x35, 0x3e, 0x01, 0x37, 0x33, 0x01, 0xd1, 0x0c, 0x09, 0x08, 0x08, // &673.5>.73......
-	0x09, 0x0c, 0x1f, 0x20, 0x0c, 0x15, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x15, 0x0c, 0x20, 0x09, // ... .......... .
-	0x0f, 0x07, 0x2f, 0x10, 0x1b, 0x0c, 0x0a, 0x0b, 0x0b, 0x0a, 0x0c, 0x1b, 0x10, 0x10, 0x1b, 0x0b, // ../.............
-	0x0b, 0x0c, 0x0c, 0x0b, 0x01, 0x0a, 0x1c, 0x11, 0x1d, 0x0f, 0x1e, 0x0f, 0x02, 0x0c, 0x14, 0x07, // ................
-	0x01, 0xa5, 0x07, 0x06, 0x01, 0x02, 0x0e, 0x0b, 0x01, 0x0c, 0x1d, 0x11, 0xfc, 0xb7, 0x12, 0x1d, // ................
-	0x0c, 0x0a, 0x0d, 0x03, 0x02, 0x06, 0x07, 0x02, 0x01, 0xa5, 0x07, 0x15, 0x0d, 0x01, 0x02, 0x9d, // ................
-	0x09, 0x0a, 0x16, 0x0d, 0xfe, 0xee, 0x0d, 0x16, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x16, 0x0d, // ................
-	0x01, 0x14, 0x0c, 0x15, 0x0a, 0x09, 0x09, 0x05, 0x04, 0xfe, 0x3e, 0x0c, 0x0b, 0x0b, 0x1b, 0x10, // ..........>.....
-	0x0f, 0x1b, 0x0b, 0x0c, 0x0b, 0x0b, 0x0c, 0x02, 0x0c, 0x1b, 0x10, 0x10, 0x1a, 0x0c, 0x0b, 0x0c, // ................
-	0x02, 0xb8, 0x07, 0x07, 0x05, 0x14, 0x0f, 0xfd, 0x0c, 0x0e, 0x1f, 0x10, 0x01, 0x12, 0x1c, 0x0b, // ................
-	0x0d, 0x0d, 0x0e, 0x0d, 0x0c, 0x1b, 0x11, 0x10, 0x1f, 0x0f, 0x02, 0xf4, 0x02, 0x0e, 0x13, 0x05, // ................
-	0x00, 0x02, 0x00, 0x12, 0xff, 0xe8, 0x03, 0xfa, 0x03, 0x98, 0x00, 0x18, 0x00, 0x25, 0x00, 0x00, // .............%..
-	0x3f, 0x01, 0x3e, 0x01, 0x33, 0x36, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, // ?.>.36..........
-	0x01, 0x07, 0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x01, 0x17, 0x06, 0x02, 0x0e, 0x01, 0x2f, // ..'..7>.7....../
-	0x01, 0x26, 0x3e, 0x01, 0x24, 0x37, 0x68, 0x03, 0x0e, 0x23, 0x15, 0x14, 0x24, 0x0f, 0x0e, 0x0e, // .&>.$7h..#..$...
-	0x0e, 0x0e, 0x03, 0x1f, 0x3f, 0x21, 0x5f, 0x0f, 0x03, 0x0d, 0x0d, 0x2b, 0x1e, 0x03, 0x2e, 0x64, // ....?!_....+...d
-	0x7b, 0xd9, 0xbe, 0xa3, 0x44, 0x2e, 0x18, 0x40, 0xb1, 0x01, 0x21, 0xc9, 0xc7, 0x03, 0x0e, 0x0e, // {...D..@..!.....
-	0x01, 0x0e, 0x0e, 0x0e, 0x23, 0x15, 0x14, 0x23, 0x0e, 0x03, 0x1e, 0x2a, 0x0d, 0x03, 0x0e, 0x2f, // ....#..#...*.../
-	0x21, 0x21, 0x3f, 0x1e, 0x02, 0xd1, 0x5d, 0xc8, 0xfe, 0xe2, 0xab, 0x38, 0x1d, 0x2e, 0x4a, 0xa4, // !!?...]....8..J.
-	0xb7, 0xc8, 0x6e, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x06, // ..n.............
-	0x00, 0x00, 0x0d, 0x01, 0x27, 0x13, 0x09, 0x02, 0x01, 0x57, 0xfe, 0xe6, 0x37, 0x37, 0x02, 0xa3, // ....'....W..77..
-	0x01, 0x1a, 0xfd, 0x5d, 0x03, 0x37, 0x37, 0x01, 0x1a, 0x02, 0xa3, 0xfe, 0xe7, 0xfd, 0x5c, 0x00, // ...].77.........
-	0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, // .............!..
-	0x25, 0x11, 0x21, 0x11, 0x21, 0x13, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, // %.!.!..........#
-	0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, // !"&'..5.467>.3!2
-	0x16, 0x17, 0x03, 0x51, 0xfd, 0x5e, 0x02, 0xa2, 0x94, 0x0a, 0x0b, 0x0b, 0x0a, 0x0a, 0x17, 0x0e, // ...Q.^..........
-	0xfc, 0x94, 0x0f, 0x18, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x18, 0x0f, 0x03, 0x6c, 0x0e, 0x17, // .............l..
-	0x0a, 0x6f, 0x02, 0xa2, 0xfd, 0x5e, 0x03, 0x36, 0x0a, 0x17, 0x0e, 0xfc, 0x94, 0x0f, 0x18, 0x0a, // .o...^.6........
-	0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x18, 0x0f, 0x03, 0x6b, 0x0e, 0x18, 0x0a, 0x0a, 0x0b, 0x0b, 0x0a, // ........k.......
-	0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x21, 0x00, 0x3e, 0x00, 0x5a, // ...........!.>.Z
-	0x00, 0x00, 0x01, 0x17, 0x27, 0x35, 0x2e, 0x01, 0x0f, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x21, 0x11, // ....'5........!.
-	0x33, 0x1f, 0x01, 0x33, 0x17, 0x33, 0x37, 0x33, 0x37, 0x21, 0x11, 0x3f, 0x01, 0x3e, 0x01, 0x3d, // 3..3.3737!.?.>.=
-	0x01, 0x2e, 0x01, 0x27, 0x37, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, // ...'72..........
-	0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, // .#!"&'..5.467>.3
-	0x21, 0x07, 0x1f, 0x02, 0x07, 0x01, 0x0f, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x03, 0x27, 0x3f, 0x03, // !.......'..'.'?.
-	0x32, 0x16, 0x1f, 0x01, 0x3f, 0x01, 0x3e, 0x01, 0x37, 0x17, 0x03, 0x9f, 0x01, 0x7e, 0x14, 0x2c, // 2...?.>.7....~.,
-	0x18, 0x0c, 0x1f, 0x2d, 0x0f, 0x2f, 0xfe, 0x7b, 0xf3, 0x21, 0x04, 0x03, 0x20, 0x03, 0x10, 0x03, // ...-./.{.!.. ...
-	0x27, 0x01, 0x2a, 0x5e, 0x07, 0x0c, 0x0c, 0x04, 0x18, 0x13, 0x17, 0x0e, 0x17, 0x0a, 0x0a, 0x0b, // '.*^............
-	0x0b, 0x0a, 0x0a, 0x17, 0x0e, 0xfc, 0x94, 0x0f, 0x18, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x18, // ................
-	0x0f, 0x03, 0x6c, 0xd6, 0x02, 0x7d, 0x0a, 0x07, 0xfe, 0x97, 0x0d, 0x07, 0x0a, 0x05, 0x09, 0x03, // ..l..}..........
-	0xfe, 0x09, 0x0c, 0x7d, 0x0a, 0x0c, 0x06, 0x0b, 0x04, 0x6b, 0xd4, 0x02, 0x03, 0x09, 0x06, 0x16, // ...}.....k......
-	0x02, 0xf6, 0x03, 0x6c, 0x01, 0x11, 0x10, 0x01, 0x01, 0x04, 0x1b, 0x17, 0x38, 0xfd, 0x5e, 0x0c, // ...l........8.^.
-	0x02, 0x03, 0x03, 0x0e, 0x01, 0x5b, 0x71, 0x08, 0x13, 0x28, 0x15, 0x0b, 0x1e, 0x2c, 0x0e, 0xc4, // .....[q..(...,..
-	0x0a, 0x0b, 0x0a, 0x17, 0x0e, 0xfc, 0x94, 0x0f, 0x18, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x18, // ................
-	0x0f, 0x03, 0x6b, 0x0e, 0x18, 0x0a, 0x0a, 0x0b, 0xa7, 0x02, 0x6a, 0x14, 0x16, 0xfe, 0x52, 0x0a, // ..k.......j...R.
-	0x02, 0x02, 0x01, 0x05, 0x04, 0x01, 0x2f, 0x18, 0x14, 0x6c, 0x05, 0x03, 0x06, 0x05, 0x7f, 0xfb, // ....../..l......
-	0x02, 0x04, 0x05, 0x01, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ................
-	0x03, 0xba, 0x00, 0x28, 0x00, 0x41, 0x00, 0x00, 0x01, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, 0x07, // ...(.A.....#"...
-	0x0e, 0x03, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x3e, 0x02, 0x37, 0x3e, 0x03, // .........32>.7>.
-	0x35, 0x34, 0x2e, 0x02, 0x27, 0x03, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, // 54..'...#"&'..54
-	0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x03, 0x67, // 67>.32.........g
-	0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, 0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, // %RZa55aYR$%8%..%
-	0x38, 0x25, 0x24, 0x52, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, // 8%$RYa55aZR%%7$.
-	0x13, 0x24, 0x37, 0x25, 0x78, 0x31, 0x78, 0x46, 0x46, 0x77, 0x31, 0x31, 0x32, 0x32, 0x31, 0x31, // .$7%x1xFFw112211
-	0x77, 0x46, 0x46, 0x78, 0x31, 0x31, 0x31, 0x31, 0x31, 0x03, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, // wFFx11111.%%8%..
-	0x25, 0x38, 0x25, 0x24, 0x52, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, // %8%$RYa55aZR%%7$
-	0x13, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, 0x24, 0xfd, // ..$7%%RZa55aYR$.
-	0xac, 0x31, 0x31, 0x31, 0x31, 0x31, 0x78, 0x46, 0x46, 0x77, 0x31, 0x31, 0x32, 0x32, 0x31, 0x31, // .11111xFFw112211
-	0x77, 0x46, 0x46, 0x78, 0x31, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // wFFx1...........
-	0x03, 0xba, 0x00, 0x18, 0x00, 0x31, 0x00, 0x5a, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, // .....1.Z........
-	0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, // ...#"&'..5467>.3
-	0x32, 0x16, 0x17, 0x27, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, // 2..'"..........3
-	0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x25, 0x3e, 0x03, 0x33, // 267>.54&'..#%>.3
-	0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, // 2............#".
-	0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x02, 0xb4, 0x25, 0x24, 0x24, 0x25, 0x26, // .'..54>.7..%$$%&
-	0x5a, 0x34, 0x34, 0x5a, 0x25, 0x25, 0x25, 0x25, 0x25, 0x25, 0x5a, 0x34, 0x34, 0x5a, 0x26, 0xb4, // Z44Z%%%%%%Z44Z&.
-	0x46, 0x77, 0x31, 0x31, 0x32, 0x32, 0x31, 0x31, 0x77, 0x46, 0x46, 0x78, 0x31, 0x31, 0x31, 0x31, // Fw112211wFFx1111
-	0x31, 0x31, 0x78, 0x46, 0xfe, 0x9b, 0x24, 0x52, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, // 11xF..$RYa55aZR%
-	0x25, 0x37, 0x24, 0x13, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, // %7$..$7%%RZa55aY
-	0x52, 0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x02, 0x73, 0x25, 0x5a, 0x34, 0x34, // R$%8%..%8%.s%Z44
-	0x5a, 0x26, 0x25, 0x24, 0x24, 0x25, 0x26, 0x5a, 0x34, 0x34, 0x5a, 0x25, 0x25, 0x25, 0x25, 0x25, // Z&%$$%&Z44Z%%%%%
-	0x9e, 0x32, 0x31, 0x31, 0x77, 0x46, 0x46, 0x78, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x78, 0x46, // .211wFFx111111xF
-	0x46, 0x77, 0x31, 0x31, 0x32, 0x14, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, // Fw112.%8%..%8%$R
-	0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, 0x13, 0x24, 0x37, 0x25, // Ya55aZR%%7$..$7%
-	0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, 0x24, 0x00, 0x00, 0x00, 0x02, 0x00, 0x4a, // %RZa55aYR$.....J
-	0xff, 0xc6, 0x03, 0xb6, 0x03, 0xba, 0x00, 0x13, 0x00, 0x27, 0x00, 0x00, 0x13, 0x34, 0x36, 0x37, // .........'...467
-	0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x1f, 0x01, 0x07, 0x01, 0x07, 0x27, 0x01, 0x2e, 0x01, 0x35, // >.3!2......'...5
-	0x25, 0x17, 0x0f, 0x01, 0x21, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x01, 0x3e, 0x01, 0x33, // %...!'..5467.>.3
-	0x32, 0x16, 0x17, 0x01, 0x4a, 0x05, 0x05, 0x05, 0x0c, 0x07, 0x03, 0x28, 0x07, 0x0c, 0x05, 0x0a, // 2...J......(....
-	0x0a, 0xfe, 0x6c, 0x18, 0x18, 0xfe, 0x6c, 0x05, 0x05, 0x03, 0x62, 0x0a, 0x0a, 0x18, 0xfc, 0xd8, // ..l...l...b.....
-	0x18, 0x05, 0x05, 0x05, 0x05, 0x01, 0x94, 0x05, 0x0c, 0x07, 0x07, 0x0c, 0x05, 0x01, 0x94, 0x01, // ................
-	0x7d, 0x06, 0x0c, 0x05, 0x05, 0x05, 0x05, 0x05, 0x17, 0x18, 0xfe, 0x6c, 0x0b, 0x0a, 0x01, 0x95, // }..........l....
-	0x05, 0x0c, 0x07, 0x9e, 0x18, 0x17, 0x0a, 0x0a, 0x05, 0x0c, 0x06, 0x07, 0x0c, 0x05, 0x01, 0x94, // ................
-	0x06, 0x05, 0x05, 0x05, 0xfe, 0x6b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x0a, 0x03, 0xfa, // .....k..........
-	0x03, 0x76, 0x00, 0x15, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x32, 0x16, 0x1f, 0x01, 0x11, 0x0f, 0x01, // .v...+...2......
-	0x22, 0x26, 0x27, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x01, 0x3e, 0x01, 0x33, 0x01, 0x07, // "&'...5467.>.3..
-	0x01, 0x07, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, // .."&'..5.467>.32
-	0x16, 0x17, 0x01, 0x17, 0x01, 0xbd, 0x06, 0x0c, 0x05, 0x0a, 0x0a, 0x17, 0x07, 0x0c, 0x05, 0xfe, // ................
-	0x6c, 0x06, 0x05, 0x05, 0x05, 0x01, 0x95, 0x05, 0x0c, 0x07, 0x02, 0x3d, 0x0a, 0xfe, 0x6b, 0x18, // l..........=..k.
-	0x06, 0x0c, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0c, 0x06, 0x07, 0x0c, 0x05, 0x01, 0x95, 0x0a, // ................
-	0x03, 0x76, 0x05, 0x05, 0x18, 0xfc, 0xd8, 0x18, 0x0a, 0x05, 0x05, 0x01, 0x94, 0x05, 0x0c, 0x07, // .v..............
-	0x07, 0x0c, 0x05, 0x01, 0x94, 0x05, 0x05, 0xfe, 0x4a, 0x18, 0xfe, 0x6c, 0x0a, 0x05, 0x05, 0x05, // ........J..l....
-	0x0c, 0x07, 0x03, 0x28, 0x07, 0x0c, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfe, 0x6c, 0x18, 0x00, 0x00, // ...(........l...
-	0x00, 0x09, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x56, // .............9.V
-	0x00, 0x73, 0x00, 0x90, 0x00, 0xad, 0x00, 0xca, 0x00, 0xe7, 0x01, 0x04, 0x00, 0x00, 0x25, 0x15, // .s............%.
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, // .....+."&'..=.46
-	0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x03, 0x32, 0x16, 0x17, 0x1e, // 7>.;.2......2...
-	0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, // ........+."&'..=
-	0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x13, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // .467>.;........+
-	0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, // ."&'..=.467>.;.2
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // ...............+
-	0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, // ."&'..=.467>.;.2
-	0x16, 0x17, 0x05, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, // .........+."&'..
-	0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x01, // =.467>.;.2......
-	0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, // .........+."&'..
-	0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x37, 0x33, 0x32, 0x16, // =.467>.;.2..732.
-	0x17, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, // ..........+."&'.
-	0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x03, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, // .=.467>.3.......
-	0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, // +."&'..=.467>.;.
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x21, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, // 2.....!......+."
-	0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, // &'..=.467>.;.2..
-	0x1e, 0x01, 0x15, 0x01, 0x03, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, // ..........~.....
-	0x09, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x3f, 0x0d, 0x16, 0x09, 0x0a, // .....~.....?....
-	0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, // ......~.........
-	0x0e, 0x7e, 0x3f, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, // .~?.....~.......
-	0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x01, 0x68, 0x0a, 0x09, 0x09, 0x0a, 0x09, // ...~......h.....
-	0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, // ..~..........~..
-	0x09, 0x01, 0x8f, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x7e, 0x0d, 0x17, 0x0a, 0x09, 0x08, 0x08, 0x09, // ........~.......
-	0x0a, 0x17, 0x0d, 0x7e, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0xfe, 0x71, 0x0a, 0x09, 0x09, 0x0a, 0x09, // ...~......q.....
-	0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, // ..~..........~..
-	0x09, 0xd1, 0x7e, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x7e, 0x0d, 0x17, // ..~..........~..
-	0x0a, 0x09, 0x08, 0x08, 0x09, 0x0a, 0x17, 0x0d, 0xbe, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, // ..............~.
-	0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x01, // .........~......
-	0x7c, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x7e, 0x0d, 0x17, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x0a, 0x17, // |.....~.........
-	0x0d, 0x7e, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x84, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, // .~......~.......
-	0x09, 0x17, 0x0e, 0x7c, 0x0e, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x01, 0xba, // ...|............
-	0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, // .....~..........
-	0x7d, 0x0d, 0x17, 0x09, 0x0a, 0x09, 0x01, 0x3c, 0x7e, 0x0d, 0x17, 0x0a, 0x08, 0x09, 0x09, 0x08, // }......<~.......
-	0x0a, 0x17, 0x0d, 0x7d, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfd, 0x36, // ...}...........6
-	0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x7c, 0x0e, // ...~..........|.
-	0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x2c, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, // ......,~........
-	0x17, 0x0e, 0x7c, 0x0e, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x01, 0xa7, 0x09, // ..|.............
-	0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7d, 0x0d, 0x17, // ..~..........}..
-	0x09, 0x0a, 0x09, 0x09, 0x0a, 0x13, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, // ...........~....
-	0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7d, 0x0d, 0x17, 0x09, 0x0a, 0x09, 0x01, 0x3c, 0x7e, 0x0d, // ......}......<~.
-	0x17, 0x0a, 0x08, 0x09, 0x09, 0x08, 0x0a, 0x17, 0x0d, 0x7d, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, // .........}......
-	0x09, 0x0a, 0x16, 0x0d, 0x7e, 0x0d, 0x17, 0x0a, 0x08, 0x09, 0x09, 0x08, 0x0a, 0x17, 0x0d, 0x7d, // ....~..........}
-	0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x56, 0x00, 0x73, 0x00, 0x90, // .........9.V.s..
-	0x00, 0xad, 0x00, 0x00, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, // ..........+."&'.
-	0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, // .=.467>.;.2.....
-	0x01, 0x13, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, // ....=.467>.3!2..
-	0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x27, 0x14, // .........#!"&''.
-	0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, // ....+."&'..=.467
-	0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, // >.;.2...........
-	0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, // .+."&'..=.467>.;
-	0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x21, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, // .2......!.....#!
-	0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, // "&'..=.467>.3!2.
-	0x17, 0x1e, 0x01, 0x1d, 0x01, 0x07, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, // ...............#
-	0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, // !"&'..=.467>.3!2
-	0x16, 0x17, 0x01, 0x03, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, // .........~......
-	0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x90, 0x09, 0x08, 0x08, 0x09, 0x09, // ....~...........
-	0x17, 0x0e, 0x01, 0xf9, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfe, 0x07, // ................
-	0x0e, 0x17, 0x09, 0x90, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, // .........~......
-	0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, // ....~..........~
-	0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, // ..........~.....
-	0x02, 0xf7, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfe, 0x07, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, // ................
-	0x09, 0x17, 0x0e, 0x01, 0xf9, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x13, 0x09, 0x0a, 0x0a, 0x09, 0x0a, // ................
-	0x16, 0x0d, 0xfe, 0x07, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x01, 0xf9, // ................
-	0x0d, 0x16, 0x0a, 0x01, 0x81, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7d, // ...............}
-	0x0d, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0xfe, 0x57, 0x09, 0x17, 0x0e, // ..........~.W...
-	0x7c, 0x0e, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, // |..........~....
-	0x09, 0x09, 0x09, 0x2e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x7c, 0x0e, // ..............|.
-	0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x02, 0xf6, 0x0d, 0x17, 0x0a, 0x09, // .........~......
-	0x08, 0x08, 0x09, 0x0a, 0x17, 0x0d, 0x7d, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, // ......}.........
-	0x0d, 0x7e, 0x0d, 0x17, 0x0a, 0x09, 0x08, 0x08, 0x09, 0x0a, 0x17, 0x0d, 0x7d, 0x0d, 0x17, 0x0a, // .~..........}...
-	0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x7e, 0xd1, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, // .......~....~...
-	0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7d, 0x0d, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x00, // .......}........
-	0x00, 0x03, 0x00, 0x06, 0xff, 0xff, 0x03, 0xfa, 0x03, 0x81, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x56, // .............9.V
-	0x00, 0x00, 0x37, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, // ..7..=.467>.3!2.
-	0x17, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x01, // ..........#!"&'.
-	0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, // .........#!"&'..
-	0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x37, 0x14, 0x06, 0x07, // =.467>.3!2..7...
-	0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, // ..#!"&'..=.467>.
-	0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x16, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, // 3!2.............
-	0x0c, 0x03, 0x82, 0x0c, 0x13, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xfc, 0x7e, 0x0c, // ..............~.
-	0x15, 0x08, 0x03, 0xd3, 0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xfc, 0x7e, 0x0c, 0x15, 0x08, // ............~...
-	0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0x03, 0x82, 0x0c, 0x13, 0x09, 0x11, 0x09, 0x08, 0x09, // ................
-	0x13, 0x0c, 0xfc, 0x7e, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0x03, 0x82, // ...~............
-	0x0c, 0x13, 0x09, 0x08, 0x09, 0x0e, 0x08, 0x15, 0x0c, 0x6f, 0x0c, 0x14, 0x08, 0x09, 0x08, 0x08, // .........o......
-	0x09, 0x08, 0x14, 0x0b, 0x70, 0x0c, 0x15, 0x08, 0x08, 0x07, 0x07, 0x08, 0x02, 0x11, 0x08, 0x14, // ....p...........
-	0x0b, 0x70, 0x0c, 0x15, 0x08, 0x08, 0x07, 0x07, 0x08, 0x09, 0x14, 0x0c, 0x6f, 0x0c, 0x14, 0x08, // .p..........o...
-	0x09, 0x08, 0x08, 0x09, 0xba, 0x0c, 0x14, 0x09, 0x08, 0x07, 0x07, 0x08, 0x09, 0x14, 0x0c, 0x6f, // ...............o
-	0x0c, 0x14, 0x09, 0x08, 0x08, 0x08, 0x08, 0x09, 0x14, 0x0b, 0x70, 0x00, 0x00, 0x03, 0x00, 0x06, // ..........p.....
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x56, 0x00, 0x00, 0x13, 0x3e, // .........9.V...>
-	0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // .;.2...........+
-	0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x21, 0x3e, 0x01, 0x3b, 0x01, // ."&'..5.467!>.;.
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, // 2...........+."&
-	0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x05, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // '..5.467.......+
-	0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, // ."&'..5.467>.;.2
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x18, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x09, // .........~......
-	0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x01, 0x7b, 0x09, 0x17, // ....~........{..
-	0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, // .~..........~...
-	0x09, 0x08, 0x08, 0x09, 0x02, 0x67, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x7e, 0x0d, 0x17, 0x0a, 0x09, // .....g.....~....
-	0x08, 0x08, 0x09, 0x0a, 0x17, 0x0d, 0x7e, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x03, 0xa7, 0x09, 0x0a, // ......~.........
-	0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, // ................
-	0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, // ..s.............
-	0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, 0x2d, 0xfc, // ..........s...-.
-	0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, // ............s...
-	0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x01, 0x03, // ................
-	0x01, 0xc0, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, // .............+."
-	0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, // &'..5.467>.;.2..
-	0x1e, 0x01, 0x15, 0x01, 0x03, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, // ..........~.....
-	0x09, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x01, 0x81, 0xfe, 0x85, 0x0e, // .....~..........
-	0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x01, 0x79, 0x0e, 0x17, 0x09, 0x0a, 0x09, // ..........y.....
-	0x09, 0x0a, 0x09, 0x17, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x02, 0x7e, // ...............~
-	0x02, 0xbd, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x00, 0x17, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, // .....9..."&'..5.
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, // 467>.;.2........
-	0x07, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // ...+...........+
-	0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, // ."&'..5.467>.;.2
-	0x16, 0x17, 0x46, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, // ..F..........~..
-	0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x02, 0x25, 0x0a, 0x09, 0x09, 0x0a, 0x09, // ........~.%.....
-	0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, // ..~..........~..
-	0x09, 0x3a, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x01, 0x79, 0x0e, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, // .:......y.......
-	0x09, 0x17, 0x0c, 0xfe, 0x85, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x02, 0xe4, 0x0a, 0x16, 0x0c, 0xfd, // ................
-	0x88, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x02, 0x76, 0x0d, 0x17, 0x0a, // ............v...
-	0x09, 0x0a, 0x0a, 0x09, 0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1c, // ................
-	0x00, 0x39, 0x00, 0x56, 0x00, 0x00, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, // .9.V.........+."
-	0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, // &'..5.467>.;.2..
-	0x1e, 0x01, 0x15, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, // .............+."
-	0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, // &'..5.467>.;.2..
-	0x13, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, // .32...........+.
-	0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x01, 0x03, 0x09, // "&'..5.467>.3...
-	0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x7e, // ....~..........~
-	0x0d, 0x16, 0x09, 0x0a, 0x09, 0x01, 0x68, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x7e, 0x0e, // ......h.......~.
-	0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0xd1, 0x7e, 0x0d, // .........~....~.
-	0x16, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x7e, 0x0d, 0x17, 0x0a, 0x09, 0x08, 0x08, // .........~......
-	0x09, 0x0a, 0x17, 0x0d, 0x01, 0x81, 0xfe, 0x85, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, // ................
-	0x17, 0x0e, 0x01, 0x79, 0x0e, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0x01, 0x29, // ...y...........)
-	0x0a, 0x16, 0x0c, 0xfd, 0x88, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x02, // ................
-	0x76, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x01, 0x10, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, // v...............
-	0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, // ............s...
-	0x09, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0xa5, 0xff, 0xc6, 0x03, 0x5b, 0x03, 0xba, 0x00, 0x10, // ...........[....
-	0x00, 0x31, 0x00, 0x00, 0x05, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x21, 0x11, 0x14, // .1...!"&'..5.!..
-	0x06, 0x07, 0x0e, 0x01, 0x23, 0x03, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x21, 0x35, // ....#.32......!5
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, // 467>.;.5467>.;.2
-	0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x03, 0x21, 0xfd, 0xbe, 0x0c, 0x15, 0x09, 0x08, 0x08, 0x02, // .......!........
-	0xb6, 0x09, 0x09, 0x08, 0x15, 0x0b, 0x91, 0x91, 0x0b, 0x15, 0x08, 0x09, 0x09, 0xfd, 0x4a, 0x08, // ..............J.
-	0x08, 0x09, 0x15, 0x0c, 0x91, 0x08, 0x07, 0x09, 0x15, 0x0c, 0xae, 0x0b, 0x14, 0x09, 0x09, 0x08, // ................
-	0x3a, 0x08, 0x08, 0x09, 0x15, 0x0c, 0x02, 0x45, 0xfd, 0xbb, 0x0c, 0x15, 0x09, 0x08, 0x08, 0x03, // :......E........
-	0x9d, 0x09, 0x08, 0x09, 0x14, 0x0c, 0xaa, 0xa9, 0x0c, 0x15, 0x09, 0x08, 0x09, 0x1b, 0x0d, 0x15, // ................
-	0x08, 0x09, 0x09, 0x09, 0x09, 0x08, 0x15, 0x0b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xb3, // ................
-	0xff, 0xc6, 0x03, 0x4f, 0x03, 0xb8, 0x00, 0x10, 0x00, 0x31, 0x00, 0x00, 0x17, 0x11, 0x21, 0x11, // ...O.....1....!.
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x03, 0x3e, 0x01, // .....#!"&'..5.>.
-	0x3f, 0x01, 0x27, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x36, 0x16, 0x17, 0x1e, 0x01, 0x1f, // ?.'&67>.?.6.....
-	0x01, 0x37, 0x36, 0x16, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x05, 0x27, 0x26, 0x36, 0x37, 0xda, 0x02, // .76.......'&67..
-	0x75, 0x08, 0x07, 0x08, 0x13, 0x0a, 0xfd, 0xf3, 0x0b, 0x13, 0x08, 0x07, 0x07, 0x23, 0x05, 0x10, // u............#..
-	0x0a, 0x7f, 0x05, 0x03, 0x02, 0x05, 0x05, 0x11, 0x0b, 0x98, 0x0a, 0x13, 0x0a, 0x09, 0x0c, 0x03, // ................
-	0x06, 0x7f, 0x0a, 0x15, 0x0a, 0x09, 0x0c, 0x03, 0x27, 0xfd, 0xa1, 0x27, 0x03, 0x02, 0x05, 0x05, // ........'..'....
-	0x02, 0x0f, 0xfd, 0xf1, 0x0b, 0x13, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x13, 0x0b, 0x02, 0xff, // ................
-	0x0a, 0x0d, 0x03, 0x22, 0x18, 0x0b, 0x14, 0x09, 0x0a, 0x0d, 0x02, 0x29, 0x03, 0x04, 0x06, 0x04, // ...".......)....
-	0x0f, 0x0b, 0x19, 0x21, 0x03, 0x02, 0x06, 0x05, 0x10, 0x0b, 0x95, 0xa3, 0x95, 0x0b, 0x13, 0x09, // ...!............
-	0x00, 0x01, 0x00, 0x36, 0xff, 0xf7, 0x03, 0xfa, 0x03, 0x7c, 0x00, 0x4c, 0x00, 0x00, 0x13, 0x0f, // ...6.....|.L....
-	0x01, 0x0e, 0x01, 0x1e, 0x01, 0x17, 0x1e, 0x03, 0x17, 0x16, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x3e, // ..........67>.7>
-	0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x23, 0x2e, 0x01, 0x27, 0x17, 0x2e, 0x01, 0x37, 0x3e, // .'..'..#..'...7>
-	0x01, 0x37, 0x33, 0x36, 0x16, 0x17, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x1f, 0x01, 0x01, 0x17, // .736............
-	0x3e, 0x01, 0x3f, 0x01, 0x03, 0x2f, 0x02, 0x0f, 0x01, 0x2e, 0x01, 0x27, 0x35, 0x2e, 0x02, 0x06, // >.?../.....'5...
-	0x07, 0x0e, 0x03, 0x0f, 0x01, 0x5a, 0x23, 0x01, 0x1a, 0x18, 0x05, 0x20, 0x1f, 0x1e, 0x4b, 0x5a, // .....Z#.... ..KZ
-	0x6a, 0x3c, 0x0a, 0x12, 0x08, 0x07, 0x08, 0x01, 0x09, 0x07, 0x01, 0x01, 0x07, 0x05, 0x07, 0x11, // j<..............
+	0x57, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0x68, 0x00, 0x04, 0x00, 0x00, // W..........h....
+	0x33, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x80, 0x00, 0x03, 0x00, 0x30, 0x4f, 0x53, 0x2f, // 3...........0OS/
+	0x32, 0x0f, 0x12, 0x07, 0x0b, 0x82, 0x11, 0x20, 0xbc, 0x82, 0x03, 0x2c, 0x60, 0x63, 0x6d, 0x61, // 2...... ...,`cma
+	0x70, 0x17, 0x56, 0xd3, 0x6a, 0x00, 0x00, 0x01, 0x1c, 0x82, 0x0f, 0x24, 0x54, 0x67, 0x61, 0x73, // p.V.j......$Tgas
+	0x70, 0x82, 0x07, 0x20, 0x10, 0x82, 0x0f, 0x83, 0x07, 0x28, 0x08, 0x67, 0x6c, 0x79, 0x66, 0xe9, // p.. .....(.glyf.
+	0x95, 0x01, 0xa3, 0x82, 0x0f, 0x30, 0x78, 0x00, 0x00, 0xa8, 0x50, 0x68, 0x65, 0x61, 0x64, 0x08, // .....0x...Phead.
+	0x18, 0x87, 0x75, 0x00, 0x00, 0xa9, 0xc8, 0x82, 0x1f, 0x21, 0x36, 0x68, 0x82, 0x10, 0x26, 0x07, // ..u......!6h..&.
+	0xbf, 0x04, 0xa9, 0x00, 0x00, 0xaa, 0x82, 0x0e, 0x28, 0x00, 0x24, 0x68, 0x6d, 0x74, 0x78, 0x96, // ........(.$hmtx.
+	0x00, 0x2c, 0x82, 0x4f, 0x31, 0xaa, 0x24, 0x00, 0x00, 0x03, 0xa0, 0x6c, 0x6f, 0x63, 0x61, 0x60, // .,.O1.$....loca`
+	0xfb, 0x35, 0xe6, 0x00, 0x00, 0xad, 0xc4, 0x82, 0x43, 0x2c, 0xd2, 0x6d, 0x61, 0x78, 0x70, 0x00, // .5......C,.maxp.
+	0xf2, 0x01, 0x07, 0x00, 0x00, 0xaf, 0x98, 0x82, 0x2f, 0x28, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x7a, // ......../( namez
+	0x55, 0x5f, 0x41, 0x82, 0x0f, 0x28, 0xb8, 0x00, 0x00, 0x04, 0x8f, 0x70, 0x6f, 0x73, 0x74, 0x82, // U_A..(.....post.
+	0xa7, 0x82, 0x00, 0x21, 0xb4, 0x48, 0x83, 0x1f, 0x2d, 0x00, 0x03, 0x03, 0xfe, 0x01, 0x90, 0x00, // ...!.H..-.......
+	0x05, 0x00, 0x00, 0x02, 0x99, 0x02, 0xcc, 0x82, 0x11, 0x20, 0x8f, 0x85, 0x07, 0x25, 0x01, 0xeb, // ......... ...%..
+	0x00, 0x33, 0x01, 0x09, 0x83, 0x27, 0x8a, 0x00, 0x21, 0x01, 0x10, 0x8e, 0x10, 0x2c, 0x00, 0x40, // .3...'..!....,.@
+	0x00, 0x00, 0xe9, 0xe3, 0x03, 0xc0, 0xff, 0xc0, 0x00, 0x40, 0x03, 0x82, 0x03, 0x83, 0x23, 0x8a, // .........@....#.
+	0x1d, 0x20, 0x20, 0x84, 0x05, 0x20, 0x03, 0x86, 0x03, 0x20, 0x1c, 0x82, 0x1b, 0x85, 0x07, 0x20, // .  .. ... ..... 
+	0x03, 0x84, 0x25, 0x24, 0x1c, 0x00, 0x04, 0x00, 0x38, 0x82, 0x07, 0x24, 0x0a, 0x00, 0x08, 0x00, // ..%$....8..$....
+	0x02, 0x82, 0x01, 0x28, 0x01, 0x00, 0x20, 0xe9, 0xe3, 0xff, 0xfd, 0xff, 0xff, 0x85, 0x3b, 0x21, // ...(.. .......;!
+	0xe9, 0x00, 0x84, 0x0b, 0x24, 0x01, 0xff, 0xe3, 0x17, 0x04, 0x86, 0x31, 0x88, 0x87, 0x82, 0x15, // ....$......1....
+	0x22, 0xff, 0x00, 0x0f, 0x8a, 0x13, 0x24, 0x02, 0x00, 0x00, 0x37, 0x39, 0x84, 0x0e, 0xa9, 0x13, // ".....$...79....
+	0x08, 0x4b, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x19, 0x00, 0x00, 0x05, 0x23, 0x22, // .K............#"
+	0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x23, 0x35, 0x09, 0x01, 0x15, 0x23, 0x11, 0x14, 0x06, 0x07, // &'..5.#5...#....
+	0x0e, 0x01, 0x2b, 0x01, 0x11, 0x23, 0x11, 0x01, 0x82, 0xbe, 0x0d, 0x17, 0x0a, 0x09, 0x08, 0x7f, // ..+..#..........
+	0x01, 0xfa, 0x01, 0xfa, 0x7f, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0xbe, 0xfc, 0x3a, 0x09, 0x09, 0x09, // ............:...
+	0x17, 0x0e, 0x01, 0x3c, 0x7e, 0x01, 0xfa, 0xfe, 0x06, 0x7e, 0xfe, 0xc4, 0x0e, 0x17, 0x82, 0x10, // ...<~....~......
+	0x23, 0x01, 0x7c, 0xfe, 0x84, 0x84, 0x61, 0x87, 0x57, 0x2c, 0x2c, 0x00, 0x3d, 0x00, 0x00, 0x13, // #.|...a.W,,.=...
+	0x35, 0x3e, 0x03, 0x33, 0x17, 0x1e, 0x03, 0x82, 0x02, 0x08, 0x20, 0x15, 0x14, 0x0e, 0x02, 0x07, // 5>.3...... .....
+	0x0e, 0x03, 0x07, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x33, // ...#"..'..54>.73
+	0x05, 0x27, 0x11, 0x37, 0x3e, 0x01, 0x37, 0x33, 0x3e, 0x01, 0x35, 0x34, 0x83, 0x82, 0x31, 0x27, // .'.7>.73>.54..1'
+	0x9b, 0x25, 0x52, 0x59, 0x61, 0x34, 0x20, 0x2f, 0x57, 0x52, 0x4b, 0x22, 0x25, 0x38, 0x25, 0x13, // .%RYa4 /WRK"%8%.
+	0x13, 0x82, 0x04, 0x2a, 0x22, 0x4b, 0x52, 0x57, 0x2f, 0x20, 0x34, 0x61, 0x59, 0x52, 0x25, 0x84, // ...*"KRW/ 4aYR%.
+	0x12, 0x2c, 0x24, 0x38, 0x24, 0x02, 0x01, 0x85, 0x20, 0x20, 0x37, 0x60, 0x29, 0x02, 0x2e, 0x82, // .,$8$...  7`)...
+	0x00, 0x25, 0x2a, 0x61, 0x37, 0x03, 0x25, 0x02, 0x82, 0x15, 0x26, 0x13, 0x02, 0x02, 0x15, 0x25, // .%*a7.%...&....%
+	0x35, 0x22, 0x84, 0x42, 0x29, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x22, 0x34, 0x25, 0x15, 0x03, 0x83, // 5".B)5aZR%"4%...
+	0x2f, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x84, 0x41, 0x2c, 0x2b, 0x02, 0xfd, 0x86, 0x02, 0x05, // /$%RZa5.A,+.....
+	0x2e, 0x29, 0x2d, 0x71, 0x42, 0x42, 0x70, 0x82, 0x06, 0x20, 0x04, 0x83, 0xb3, 0x22, 0x08, 0xff, // .)-qBBp.. ..."..
+	0xca, 0x82, 0xb3, 0x35, 0xb6, 0x00, 0x16, 0x00, 0x5a, 0x00, 0x00, 0x25, 0x26, 0x22, 0x07, 0x15, // ...5....Z..%&"..
+	0x0f, 0x02, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x82, 0x9f, 0x28, 0x35, 0x2f, 0x02, // .......326..(5/.
+	0x01, 0x1e, 0x01, 0x17, 0x15, 0x07, 0x82, 0x05, 0x27, 0x1f, 0x01, 0x14, 0x06, 0x0f, 0x01, 0x0e, // ........'.......
+	0x01, 0x41, 0x32, 0x03, 0x23, 0x35, 0x2f, 0x03, 0x17, 0x82, 0xb3, 0x22, 0x35, 0x2e, 0x01, 0x83, // .A2.#5/...."5...
+	0xc4, 0x27, 0x3e, 0x01, 0x3f, 0x01, 0x1f, 0x02, 0x37, 0x35, 0x82, 0x08, 0x23, 0x2f, 0x03, 0x26, // .'>.?...75..#/.&
+	0x36, 0x85, 0x12, 0x22, 0x37, 0x33, 0x37, 0x82, 0x39, 0x08, 0x4a, 0x23, 0x03, 0x60, 0x19, 0x33, // 6.."737.9.J#.`.3
+	0x1a, 0x0f, 0x01, 0x03, 0x09, 0x0a, 0x0b, 0x1b, 0x0e, 0x0f, 0x19, 0x0a, 0x0c, 0x0c, 0x03, 0x13, // ................
+	0x02, 0xfe, 0xdf, 0x2c, 0x32, 0x07, 0x03, 0x01, 0x1b, 0x1b, 0x1e, 0x03, 0x02, 0x1e, 0x1e, 0x02, // ...,2...........
+	0x1c, 0x4a, 0x2f, 0x29, 0x4a, 0x1f, 0xbc, 0x05, 0x5d, 0x54, 0x03, 0x37, 0x5e, 0x27, 0x38, 0x31, // .J/)J...]T.7^'81
+	0x07, 0x01, 0x09, 0x09, 0x02, 0x05, 0x04, 0x10, 0x0c, 0xb5, 0x22, 0x20, 0x4c, 0x0c, 0x06, 0x06, // .........." L...
+	0x0e, 0xb4, 0x06, 0x02, 0x01, 0x02, 0x82, 0x11, 0x08, 0x2e, 0x0b, 0x13, 0x0a, 0x01, 0x97, 0x31, // ...............1
+	0x56, 0x25, 0x02, 0xc3, 0x16, 0x16, 0x01, 0x1b, 0x03, 0x13, 0x0e, 0x19, 0x0c, 0x09, 0x0a, 0x09, // V%..............
+	0x0a, 0x0c, 0x19, 0x0e, 0x14, 0x1d, 0x01, 0x02, 0x96, 0x27, 0x61, 0x3a, 0x33, 0x24, 0xfe, 0xe8, // .........'a:3$..
+	0x17, 0x3b, 0x23, 0x1c, 0x2c, 0x4a, 0x1d, 0x02, 0x1c, 0x82, 0x00, 0x08, 0x2e, 0x02, 0xba, 0x0d, // .;#.,J..........
+	0x59, 0x04, 0x01, 0x08, 0x2e, 0x25, 0x02, 0x3a, 0x82, 0x47, 0x17, 0x2e, 0x17, 0x04, 0x08, 0x02, // Y....%.:.G......
+	0x03, 0x08, 0xb4, 0x13, 0x11, 0x02, 0x4f, 0x0b, 0x18, 0x0c, 0x17, 0xac, 0x0c, 0x05, 0x08, 0x03, // ......O.........
+	0x04, 0x06, 0x01, 0x06, 0x09, 0x03, 0x04, 0x08, 0x2f, 0x26, 0x00, 0x03, 0x41, 0xc3, 0x08, 0x28, // ......../&..A..(
+	0x18, 0x00, 0x31, 0x00, 0xb3, 0x00, 0x00, 0x01, 0x32, 0x41, 0x0b, 0x03, 0x20, 0x15, 0x42, 0x16, // ..1.....2A.. .B.
+	0x04, 0x42, 0x2a, 0x06, 0x20, 0x34, 0x83, 0xdf, 0x22, 0x33, 0x35, 0x22, 0x83, 0x12, 0x20, 0x15, // .B*. 4.."35".. .
+	0x41, 0x2a, 0x0b, 0x41, 0xc6, 0x04, 0x21, 0x23, 0x05, 0x87, 0x2e, 0x26, 0x2b, 0x01, 0x07, 0x1f, // A*.A..!#...&+...
+	0x01, 0x16, 0x14, 0x82, 0x09, 0x27, 0x0f, 0x01, 0x2f, 0x01, 0x07, 0x17, 0x16, 0x14, 0x41, 0x3c, // .....'../.....A<
+	0x07, 0x28, 0x2e, 0x01, 0x3d, 0x01, 0x27, 0x0f, 0x01, 0x06, 0x22, 0x41, 0xf6, 0x03, 0x84, 0x51, // .(..=.'..."A...Q
+	0x27, 0x3f, 0x01, 0x27, 0x07, 0x06, 0x22, 0x2f, 0x01, 0x87, 0x5e, 0x26, 0x3b, 0x01, 0x37, 0x2f, // '?.'.."/..^&;.7/
+	0x01, 0x26, 0x34, 0x41, 0x48, 0x05, 0x24, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x82, 0x09, 0x20, 0x27, // .&4AH.$32..... '
+	0x8a, 0x10, 0x82, 0x75, 0x22, 0x1d, 0x01, 0x17, 0x83, 0x0e, 0x21, 0x36, 0x32, 0x82, 0x0b, 0x21, // ...u".....!62..!
+	0x1f, 0x01, 0x82, 0x75, 0x20, 0x0f, 0x82, 0x10, 0x28, 0x36, 0x32, 0x1f, 0x01, 0x02, 0x00, 0x19, // ...u ...(62.....
+	0x2c, 0x12, 0x84, 0x00, 0x21, 0x2c, 0x19, 0x82, 0x09, 0x21, 0x11, 0x12, 0x82, 0x02, 0x2b, 0x2c, // ,...!,...!....+,
+	0x19, 0x33, 0x56, 0x25, 0x23, 0x24, 0x24, 0x23, 0x25, 0x56, 0x33, 0x89, 0x09, 0x3e, 0x01, 0xd4, // .3V%#$$#%V3..>..
+	0x13, 0x13, 0x06, 0x05, 0x06, 0x0d, 0x08, 0x69, 0x0c, 0x62, 0x14, 0x03, 0x03, 0x12, 0x38, 0x26, // .......i.b....8&
+	0x19, 0x1b, 0x4a, 0x38, 0x29, 0x04, 0x04, 0x14, 0x2d, 0x62, 0x35, 0x08, 0x0d, 0x82, 0x1a, 0x2f, // ..J8)...-b5..../
+	0x41, 0x27, 0x15, 0x07, 0x0e, 0x07, 0x2e, 0x53, 0x25, 0x06, 0x05, 0x05, 0x06, 0x4a, 0x26, 0x62, // A'.....S%....J&b
+	0x82, 0x0c, 0x20, 0x15, 0x8f, 0x33, 0x29, 0x05, 0x0d, 0x07, 0x08, 0x0e, 0x05, 0x4a, 0x0e, 0x1b, // .. ..3)......J..
+	0x0f, 0x82, 0x39, 0x22, 0x03, 0x0a, 0x07, 0x88, 0x3b, 0x2f, 0x29, 0x02, 0x0a, 0x07, 0x07, 0x0f, // ..9"....;/).....
+	0x08, 0x1d, 0x38, 0x1b, 0x34, 0x06, 0x05, 0x0b, 0x49, 0x25, 0x84, 0x3d, 0x21, 0x02, 0x3a, 0x84, // ..8.4...I%.=!.:.
+	0x8e, 0x8e, 0xa2, 0x20, 0x7b, 0x8e, 0x99, 0x84, 0x09, 0x20, 0x31, 0x89, 0x49, 0x2b, 0x14, 0x07, // ... {.... 1.I+..
+	0x0f, 0x07, 0x2d, 0x53, 0x26, 0x09, 0x09, 0x4b, 0x26, 0x61, 0x88, 0x83, 0x24, 0x0e, 0x07, 0x69, // ..-S&..K&a..$..i
+	0x0b, 0x61, 0x83, 0x83, 0x21, 0x37, 0x25, 0x82, 0x8f, 0x82, 0x83, 0x24, 0x4b, 0x37, 0x29, 0x03, // .a..!7%....$K7).
+	0x03, 0x96, 0xbb, 0x22, 0x0b, 0x13, 0x08, 0x83, 0x7f, 0x22, 0x07, 0x0b, 0x03, 0x89, 0xbf, 0x2c, // ...".....".....,
+	0x07, 0x0a, 0x03, 0x03, 0x03, 0x0c, 0x20, 0x15, 0x2f, 0x05, 0x0e, 0x08, 0x19, 0x85, 0xf8, 0x43, // ...... ./......C
+	0xc7, 0x0b, 0x2a, 0x14, 0x00, 0x62, 0x00, 0x00, 0x01, 0x17, 0x11, 0x0f, 0x01, 0x23, 0x44, 0x23, // ..*..b.......#D#
+	0x04, 0x41, 0x9a, 0x06, 0x25, 0x32, 0x16, 0x17, 0x1f, 0x01, 0x15, 0x43, 0xd6, 0x05, 0x23, 0x0f, // .A..%2.....C..#.
+	0x01, 0x0e, 0x03, 0x43, 0xd6, 0x0a, 0x2a, 0x3f, 0x02, 0x3e, 0x01, 0x17, 0x32, 0x16, 0x1f, 0x02, // ...C..*?.>..2...
+	0x0f, 0x02, 0x42, 0x1c, 0x0a, 0x83, 0x15, 0x42, 0x1d, 0x03, 0x22, 0x23, 0x2f, 0x01, 0x41, 0xea, // ..B....B.."#/.A.
+	0x03, 0x39, 0x3e, 0x01, 0x33, 0x17, 0x02, 0x51, 0x09, 0x09, 0x16, 0x79, 0x16, 0x04, 0x05, 0x05, // .9>.3..Q...y....
+	0x04, 0x05, 0x0a, 0x07, 0x79, 0x06, 0x0b, 0x05, 0xfb, 0x1a, 0x25, 0x37, 0x43, 0xf4, 0x03, 0x28, // ....y.....%7C..(
+	0x37, 0x25, 0x02, 0x24, 0x51, 0x59, 0x61, 0x35, 0x35, 0x43, 0xf4, 0x04, 0x82, 0x12, 0x3b, 0x12, // 7%.$QYa55C....;.
+	0x24, 0x35, 0x23, 0x06, 0x18, 0x05, 0x0b, 0x07, 0x06, 0x0a, 0x04, 0x4e, 0x07, 0x0a, 0x0c, 0x05, // $5#........N....
+	0x2d, 0x2d, 0x2f, 0x30, 0x2f, 0x72, 0x43, 0x41, 0x70, 0x2f, 0x04, 0x84, 0x0b, 0x34, 0x01, 0x0e, // --/0/rCAp/...4..
+	0x0a, 0x03, 0x04, 0x4f, 0x04, 0x0b, 0x07, 0x15, 0x03, 0xb1, 0x15, 0xfe, 0x00, 0x15, 0x09, 0x09, // ...O............
+	0x04, 0x0b, 0x06, 0x82, 0xc5, 0x20, 0x0a, 0x82, 0x5b, 0x34, 0x05, 0x04, 0x7d, 0x17, 0x01, 0x25, // ..... ..[4..}..%
+	0x51, 0x58, 0x60, 0x34, 0x34, 0x60, 0x58, 0x50, 0x24, 0x02, 0x24, 0x37, 0x24, 0x13, 0x13, 0x82, // QX`44`XP$.$7$...
+	0x04, 0x84, 0x12, 0x3e, 0x33, 0x5e, 0x57, 0x4f, 0x25, 0x07, 0x15, 0x04, 0x03, 0x01, 0x05, 0x05, // ...>3^WO%.......
+	0x5c, 0x15, 0x15, 0x0b, 0x04, 0x2f, 0x6f, 0x41, 0x42, 0x71, 0x2f, 0x2e, 0x2f, 0x2c, 0x2d, 0x04, // ...../oABq/./,-.
+	0x05, 0x2e, 0x6e, 0x83, 0x0b, 0x2b, 0x0d, 0x15, 0x06, 0x0b, 0x04, 0x5c, 0x05, 0x06, 0x06, 0x00, // ..n..+..........
+	0x00, 0x04, 0x41, 0x17, 0x08, 0x28, 0x0a, 0x00, 0x15, 0x00, 0x20, 0x00, 0x2b, 0x00, 0x00, 0x82, // ..A..(.... .+...
+	0xc8, 0x3b, 0x35, 0x33, 0x11, 0x21, 0x35, 0x33, 0x27, 0x35, 0x21, 0x33, 0x15, 0x37, 0x33, 0x15, // .;53.!53'5!3.73.
+	0x07, 0x33, 0x15, 0x21, 0x11, 0x01, 0x37, 0x23, 0x35, 0x21, 0x11, 0x23, 0x35, 0x07, 0x82, 0x06, // .3.!..7#5!.#5...
+	0x22, 0x15, 0x23, 0x11, 0x82, 0x03, 0x2e, 0x17, 0x15, 0x23, 0x27, 0x02, 0x7e, 0x7f, 0x7e, 0x7f, // ".#......#'.~.~.
+	0xfe, 0x84, 0x7f, 0x7f, 0xfd, 0x88, 0x82, 0x08, 0x20, 0x7f, 0x82, 0x0a, 0x25, 0x02, 0x78, 0x7f, // ........ ...%.x.
+	0x7f, 0x01, 0x7c, 0x83, 0x15, 0x20, 0x07, 0x83, 0x07, 0x24, 0x7f, 0x7f, 0x7e, 0x01, 0x42, 0x83, // ..|.. ...$..~.B.
+	0x17, 0x84, 0x1e, 0x82, 0x04, 0x23, 0x01, 0x7c, 0x01, 0x7b, 0x85, 0x32, 0x86, 0x27, 0x20, 0x7f, // .....#.|.{.2.' .
+	0x93, 0x83, 0x20, 0x25, 0x83, 0x5c, 0x85, 0x66, 0x20, 0x25, 0x86, 0x75, 0x82, 0x7f, 0x20, 0x01, // .. %...f %.u.. .
+	0x85, 0x95, 0x83, 0x9f, 0x20, 0x21, 0x85, 0x95, 0x83, 0x9f, 0x21, 0x03, 0x7b, 0x85, 0x57, 0x22, // .... !....!.{.W"
+	0x7f, 0xfc, 0x8b, 0x85, 0x50, 0x82, 0x0b, 0x84, 0x5f, 0x21, 0x7e, 0x7f, 0x83, 0x8c, 0x84, 0x7a, // ....P..._!~....z
+	0x20, 0xc3, 0x85, 0x16, 0x84, 0x0d, 0x85, 0x18, 0x8b, 0x91, 0x82, 0x83, 0x20, 0x09, 0x88, 0x83, //  ........... ...
+	0x20, 0x04, 0x82, 0x0b, 0x35, 0x0e, 0x00, 0x13, 0x00, 0x18, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x3f, //  ...5........".?
+	0x00, 0x44, 0x00, 0x00, 0x13, 0x33, 0x35, 0x23, 0x15, 0x1d, 0x01, 0x82, 0x05, 0x20, 0x13, 0x82, // .D...35#..... ..
+	0x08, 0x20, 0x33, 0x82, 0x86, 0x21, 0x11, 0x21, 0x84, 0x13, 0x20, 0x11, 0x83, 0x04, 0x84, 0x0e, // . 3..!.!.. .....
+	0x20, 0x25, 0x46, 0x64, 0x05, 0x21, 0x23, 0x21, 0x46, 0x79, 0x06, 0x44, 0x4f, 0x05, 0x20, 0x21, //  %Fd.!#!Fy.DO. !
+	0x44, 0x68, 0x05, 0x20, 0x07, 0x82, 0x34, 0x22, 0x35, 0x64, 0x7c, 0x85, 0x00, 0x27, 0x01, 0xdc, // Dh. ..4"5d|..'..
+	0xfe, 0x85, 0x01, 0x7b, 0x5f, 0x7d, 0x82, 0x00, 0x2e, 0xfe, 0x26, 0x01, 0x7b, 0xfe, 0x85, 0x02, // ...{_}....&.{...
+	0xb9, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x46, 0x77, 0x04, 0x46, 0x8b, 0x04, 0x23, 0x03, // ........Fw.F..#.
+	0x74, 0x0d, 0x16, 0x82, 0x14, 0x3d, 0x62, 0x7d, 0x7d, 0x01, 0x81, 0x9e, 0x9e, 0xbe, 0x9e, 0x9e, // t....=b}}.......
+	0x01, 0xfa, 0x9e, 0x9e, 0xfd, 0x68, 0x01, 0x5c, 0xfe, 0xa4, 0x01, 0x5c, 0x9e, 0x9e, 0xfe, 0xa4, // .....h..........
+	0x9e, 0x9e, 0x03, 0x36, 0x83, 0x46, 0x20, 0x1f, 0x8c, 0x35, 0x20, 0x73, 0x46, 0xdb, 0x03, 0x20, // ...6.F ..5 sF.. 
+	0x0a, 0x84, 0x4d, 0x26, 0x1f, 0x9e, 0x9e, 0x00, 0x01, 0x00, 0x35, 0x82, 0xd3, 0x20, 0xcd, 0x82, // ..M&......5.. ..
+	0xd3, 0x25, 0x1e, 0x00, 0x00, 0x01, 0x05, 0x21, 0x8e, 0xa2, 0x20, 0x27, 0x45, 0xd3, 0x05, 0x20, // .%.....!.. 'E.. 
+	0x25, 0x44, 0x69, 0x04, 0x08, 0x24, 0x03, 0xb1, 0xfd, 0x90, 0x02, 0x8c, 0x08, 0x09, 0x09, 0x14, // %Di..$..........
+	0x0b, 0xfd, 0x0f, 0x0c, 0x15, 0x09, 0x08, 0x08, 0x34, 0x03, 0x02, 0x06, 0x06, 0x12, 0x0c, 0x02, // ........4.......
+	0xd6, 0x2b, 0x0b, 0x0f, 0x03, 0x35, 0x02, 0xce, 0xa8, 0xfd, 0xda, 0x84, 0x17, 0x33, 0x08, 0x08, // .+...5.......3..
+	0x09, 0x15, 0x0c, 0x01, 0xec, 0xc2, 0x0c, 0x17, 0x0a, 0x0b, 0x0e, 0x04, 0xc2, 0x06, 0x06, 0x11, // ................
+	0x0c, 0xc3, 0x48, 0x11, 0x03, 0x26, 0x06, 0xff, 0xf0, 0x03, 0xf9, 0x03, 0x90, 0x45, 0x63, 0x04, // ..H..&.......Ec.
+	0x23, 0x5c, 0x00, 0x00, 0x25, 0x41, 0x01, 0x05, 0x45, 0x69, 0x11, 0x20, 0x21, 0x97, 0x18, 0x20, // #...%A..Ei. !.. 
+	0x01, 0x82, 0x10, 0x22, 0x07, 0x15, 0x03, 0x45, 0x5a, 0x03, 0x20, 0x02, 0x83, 0xa3, 0x20, 0x23, // ..."...EZ. ... #
+	0x46, 0x8a, 0x03, 0x20, 0x03, 0x45, 0x5a, 0x07, 0x41, 0x50, 0x06, 0x20, 0x17, 0x41, 0x52, 0x03, // F.. .EZ.AP. .AR.
+	0x21, 0x02, 0xae, 0x44, 0x63, 0x03, 0x25, 0x1a, 0x19, 0x2b, 0x12, 0x13, 0x12, 0x82, 0x02, 0x22, // !..Dc.%..+....."
+	0x2b, 0x19, 0x1a, 0x44, 0x77, 0x03, 0x28, 0xfe, 0x50, 0x11, 0x12, 0x13, 0x2c, 0x19, 0x1a, 0x2b, // +..Dw.(.P...,..+
+	0x82, 0x13, 0x82, 0x17, 0x08, 0x22, 0x2b, 0x1a, 0x19, 0x2c, 0x13, 0x12, 0x11, 0x02, 0xdd, 0x02, // ....."+..,......
+	0x11, 0x0e, 0x03, 0x4e, 0x01, 0x03, 0x17, 0x14, 0x05, 0x3e, 0xfe, 0x31, 0x14, 0x1f, 0x0d, 0x01, // ...N.....>.1....
+	0x15, 0x18, 0x03, 0x47, 0x8d, 0x06, 0x0b, 0x04, 0x05, 0x82, 0x00, 0x2e, 0x04, 0x0b, 0x06, 0x01, // ...G............
+	0x71, 0x0a, 0x01, 0xe6, 0x1a, 0x2a, 0x11, 0x6b, 0x1a, 0x2c, 0x13, 0x45, 0x56, 0x03, 0x20, 0x13, // q....*.k.,.EV. .
+	0x8d, 0x59, 0x91, 0x13, 0x22, 0x03, 0x00, 0x01, 0x82, 0x67, 0x30, 0x04, 0xfe, 0x67, 0x01, 0x13, // .Y.."....g0..g..
+	0x20, 0x0d, 0x01, 0x0e, 0x07, 0x08, 0x0d, 0x20, 0x13, 0x01, 0x01, 0x81, 0x82, 0x4f, 0x24, 0x0a, //  ...... .....O$.
+	0x07, 0x5c, 0x07, 0x0a, 0x82, 0x54, 0x22, 0x01, 0x12, 0x12, 0x49, 0x25, 0x04, 0x24, 0x22, 0xff, // .....T"...I%.$".
+	0xc6, 0x03, 0xde, 0x46, 0x77, 0x04, 0x24, 0x33, 0x00, 0x4e, 0x00, 0x00, 0x47, 0x5c, 0x03, 0x47, // ...Fw.$3.N..G..G
+	0x49, 0x05, 0x42, 0x19, 0x06, 0x20, 0x07, 0x83, 0xed, 0x23, 0x23, 0x21, 0x27, 0x01, 0x41, 0x0b, // I.B.. ...##!'.A.
+	0x0b, 0x46, 0x30, 0x09, 0x41, 0x24, 0x03, 0x20, 0x07, 0x47, 0x9e, 0x09, 0x46, 0x54, 0x06, 0x41, // .F0.A$. .G..FT.A
+	0x3c, 0x08, 0x3e, 0x86, 0x09, 0x0a, 0x01, 0x50, 0x02, 0x05, 0x07, 0x08, 0x16, 0x0e, 0x03, 0x4f, // <.>....P.......O
+	0x0d, 0x15, 0x08, 0x08, 0x07, 0x02, 0x50, 0x15, 0x09, 0x13, 0x0b, 0xfd, 0x5b, 0x27, 0x02, 0x40, // ......P.....['.@
+	0xe4, 0x0e, 0x82, 0x00, 0x27, 0x0f, 0x23, 0x14, 0x14, 0x22, 0x0e, 0xe4, 0x0f, 0x82, 0x00, 0x29, // ....'.#..".....)
+	0x0e, 0x22, 0x14, 0x15, 0x22, 0x0f, 0xe9, 0x0e, 0x0d, 0xe4, 0x82, 0x14, 0x21, 0x15, 0x22, 0x82, // ."..".......!.".
+	0x1b, 0x35, 0x0f, 0x0e, 0xe4, 0x0e, 0x22, 0x15, 0x14, 0x23, 0x0f, 0x0d, 0x0e, 0x2e, 0x06, 0x0d, // .5...."..#......
+	0x08, 0x01, 0xa8, 0x0b, 0x15, 0x09, 0x09, 0x08, 0x82, 0x01, 0x29, 0x14, 0x0b, 0xfe, 0x57, 0x1b, // ..........)...W.
+	0x06, 0x06, 0x0c, 0x03, 0xca, 0x82, 0x20, 0x20, 0x14, 0x82, 0x20, 0x83, 0x4a, 0x20, 0xe4, 0x85, // ......  .. .J ..
+	0x4b, 0x83, 0x4a, 0x20, 0x44, 0x82, 0x12, 0x88, 0x5e, 0x21, 0x23, 0x0d, 0x87, 0x5e, 0x45, 0x63, // K.J D...^!#..^Ec
+	0x0a, 0x20, 0x1f, 0x49, 0x2b, 0x03, 0x20, 0x01, 0x82, 0xe3, 0x22, 0x1f, 0x01, 0x11, 0x47, 0x27, // . .I+. ..."...G'
+	0x03, 0x23, 0x0f, 0x01, 0x27, 0x01, 0x47, 0x12, 0x07, 0x88, 0xdc, 0x21, 0x03, 0x23, 0x43, 0xce, // .#..'.G....!.#C.
+	0x03, 0x83, 0xf6, 0x20, 0x23, 0x43, 0x38, 0x0f, 0x39, 0x3b, 0x01, 0x15, 0x01, 0xa9, 0x02, 0x2e, // ... #C8.9;......
+	0x07, 0x0c, 0x05, 0x0b, 0x0b, 0x18, 0x19, 0x73, 0xfe, 0x19, 0x18, 0xfe, 0xe9, 0x05, 0x06, 0x06, // .......s........
+	0x05, 0xfe, 0x73, 0x41, 0xb3, 0x03, 0x32, 0x06, 0x0c, 0x07, 0x8c, 0x8b, 0x02, 0x2e, 0x8b, 0x09, // ..sA..2.........
+	0x0a, 0x02, 0x0a, 0x19, 0x0d, 0xfd, 0x46, 0x0f, 0x19, 0x0a, 0x84, 0x00, 0x29, 0x19, 0x0f, 0xd1, // ......F.....)...
+	0x03, 0xba, 0x06, 0x05, 0x18, 0xfd, 0xd2, 0x82, 0x10, 0x2d, 0x73, 0xfe, 0x0b, 0x0b, 0x01, 0x17, // .........-s.....
+	0x05, 0x0c, 0x07, 0x07, 0x0c, 0x06, 0xfe, 0x73, 0x82, 0x32, 0x82, 0x4c, 0x27, 0x05, 0x06, 0xfe, // .......s.2.L'...
+	0xc6, 0xfd, 0xd2, 0x8b, 0xd1, 0x89, 0x30, 0x21, 0x02, 0xb8, 0x82, 0x0b, 0x24, 0x0b, 0x0a, 0x8b, // ......0!....$...
+	0x00, 0x01, 0x41, 0xab, 0x08, 0x20, 0x48, 0x48, 0x1f, 0x10, 0x47, 0xe7, 0x03, 0x21, 0x07, 0x17, // ..A.. HH..G..!..
+	0x42, 0xb4, 0x15, 0x21, 0x37, 0x27, 0x48, 0x43, 0x0f, 0x83, 0xf4, 0x21, 0x37, 0x27, 0x86, 0xe2, // B..!7'HC...!7'..
+	0x24, 0x15, 0x29, 0x47, 0x1e, 0x1d, 0x82, 0x01, 0x2e, 0x1e, 0x47, 0x29, 0x2a, 0x48, 0x1d, 0x10, // $.)G......G)*H..
+	0xc5, 0x04, 0x07, 0xc7, 0x11, 0x1d, 0x48, 0x2a, 0x8c, 0x15, 0x24, 0x1d, 0x1d, 0x03, 0xd3, 0x03, // ......H*..$.....
+	0x87, 0x0a, 0x82, 0x00, 0x84, 0x1e, 0x22, 0x0b, 0xcb, 0x03, 0x84, 0x0a, 0x26, 0x03, 0xba, 0x1d, // ......".....&...
+	0x1d, 0x1e, 0x48, 0x2b, 0x84, 0x30, 0x28, 0x1e, 0x1d, 0x11, 0x88, 0x29, 0x36, 0x7e, 0x13, 0x1e, // ..H+.0(....)6~..
+	0x82, 0x00, 0x82, 0x1a, 0x82, 0x2f, 0x86, 0x09, 0x22, 0x1e, 0x85, 0x03, 0x83, 0x1d, 0x20, 0x1e, // ...../.."..... .
+	0x85, 0x13, 0x82, 0x30, 0x24, 0x0b, 0x8a, 0x20, 0x2b, 0x48, 0x82, 0x08, 0x4b, 0x17, 0x03, 0x2b, // ...0$.. +H..K..+
+	0x07, 0x00, 0x01, 0x03, 0xf9, 0x03, 0x7f, 0x00, 0x21, 0x00, 0x00, 0x13, 0x43, 0xe9, 0x03, 0x48, // ........!...C..H
+	0x74, 0x03, 0x21, 0x36, 0x16, 0x48, 0x5b, 0x04, 0x25, 0x16, 0x06, 0x07, 0x01, 0x07, 0x23, 0x41, // t.!6.H[.%.....#A
+	0x9a, 0x03, 0x20, 0x37, 0x42, 0x58, 0x05, 0x08, 0x25, 0x17, 0xf2, 0x0a, 0x10, 0x08, 0x9e, 0x01, // .. 7BX..%.......
+	0x3c, 0x06, 0x0f, 0x09, 0x0a, 0x10, 0x07, 0xbd, 0x07, 0x08, 0x01, 0x05, 0x05, 0xfd, 0xe6, 0x16, // <...............
+	0x19, 0x18, 0xfe, 0x83, 0x07, 0x05, 0x01, 0x08, 0x07, 0xbb, 0x08, 0x11, 0x08, 0x02, 0xc4, 0x82, // ................
+	0x08, 0x37, 0xbe, 0x01, 0x77, 0x08, 0x08, 0x02, 0x01, 0x06, 0x06, 0xa2, 0x05, 0x0f, 0x0a, 0x09, // .7..w...........
+	0x12, 0x07, 0xfd, 0x7d, 0x0e, 0x0e, 0x01, 0xc8, 0x08, 0x10, 0x82, 0x36, 0x24, 0x06, 0xa1, 0x06, // ...}.......6$...
+	0x06, 0x01, 0x4b, 0x8f, 0x0a, 0x20, 0x3c, 0x82, 0x77, 0x42, 0xb6, 0x08, 0x20, 0x1f, 0x48, 0xfa, // ..K.. <.wB.. .H.
+	0x08, 0x41, 0x47, 0x04, 0x20, 0x0f, 0x42, 0xf8, 0x06, 0x42, 0xe1, 0x06, 0x21, 0x2f, 0x01, 0x43, // .AG. .B..B..!/.C
+	0x01, 0x0c, 0x42, 0x2c, 0x05, 0x32, 0x06, 0x0a, 0x0b, 0xac, 0x09, 0x17, 0x0f, 0x0e, 0x18, 0x0b, // ..B,.2..........
+	0xd9, 0xdd, 0x09, 0x18, 0x0e, 0x0d, 0x18, 0x0a, 0xac, 0x44, 0xe3, 0x03, 0x21, 0xdb, 0xdb, 0x83, // .........D..!...
+	0x05, 0x2d, 0xac, 0x0a, 0x18, 0x0d, 0x0e, 0x18, 0x09, 0xdd, 0xd9, 0x0b, 0x18, 0x0e, 0x0f, 0x17, // .-..............
+	0x82, 0x0e, 0x28, 0x0b, 0x0a, 0x0b, 0xdb, 0xdb, 0x0a, 0x0b, 0x02, 0xca, 0x8b, 0x0d, 0x85, 0x41, // ..(............A
+	0x82, 0x39, 0x25, 0xdb, 0xdd, 0x09, 0x17, 0x0d, 0x0f, 0x86, 0x41, 0x21, 0xdd, 0xdd, 0x86, 0x41, // .9%.......A!...A
+	0x25, 0x0f, 0x0d, 0x17, 0x09, 0xdd, 0xdb, 0x82, 0x49, 0x4b, 0xef, 0x0c, 0x24, 0x2e, 0x00, 0x6b, // %.......IK..$..k
+	0x00, 0x00, 0x82, 0x81, 0x23, 0x03, 0x27, 0x07, 0x23, 0x4a, 0x16, 0x04, 0x26, 0x07, 0x0e, 0x03, // ....#.'.#J..&...
+	0x15, 0x14, 0x1e, 0x02, 0x82, 0xba, 0x23, 0x03, 0x17, 0x3e, 0x03, 0x49, 0xb4, 0x05, 0x25, 0x35, // ......#..>.I..%5
+	0x34, 0x2e, 0x02, 0x27, 0x03, 0x89, 0xc3, 0x20, 0x06, 0x94, 0xc3, 0x41, 0x5d, 0x06, 0x20, 0x37, // 4..'... ...A]. 7
+	0x87, 0xff, 0x49, 0xda, 0x06, 0x20, 0x16, 0x83, 0xff, 0x33, 0x03, 0x7b, 0x16, 0x25, 0x51, 0x59, // ..I.. ...3.{.%QY
+	0x60, 0x34, 0x01, 0x02, 0x39, 0x67, 0x2f, 0x29, 0x4b, 0x22, 0x26, 0x37, 0x25, 0x12, 0x48, 0x2f, // `4..9g/)K"&7%.H/
+	0x03, 0x25, 0x16, 0x23, 0x4e, 0x54, 0x5a, 0x30, 0x4b, 0xf5, 0x05, 0x2d, 0x35, 0x12, 0x15, 0x16, // .%.#NTZ0K..-5...
+	0x10, 0x20, 0x2f, 0x20, 0x8d, 0x0a, 0x09, 0x08, 0x08, 0x2e, 0x82, 0xc2, 0x29, 0x0e, 0x17, 0x09, // . / ........)...
+	0x6f, 0x6f, 0x09, 0x17, 0x0e, 0x0e, 0x16, 0x82, 0x0e, 0x08, 0x23, 0x08, 0x09, 0x0a, 0x6e, 0x70, // oo........#...np
+	0x09, 0x09, 0x01, 0x0a, 0x09, 0x2e, 0x08, 0x16, 0x0c, 0x0d, 0x16, 0x0a, 0x70, 0x70, 0x0a, 0x16, // ............pp..
+	0x0d, 0x0c, 0x16, 0x0a, 0x2e, 0x08, 0x09, 0x01, 0x09, 0x09, 0x71, 0x6f, 0x03, 0x0e, 0x16, 0x82, // ..........qo....
+	0x50, 0x25, 0x14, 0x01, 0x02, 0x15, 0x15, 0x13, 0x4c, 0x4d, 0x05, 0x2c, 0x35, 0x34, 0x60, 0x58, // P%......LM.,54`X
+	0x51, 0x25, 0x16, 0x1f, 0x2f, 0x20, 0x11, 0x01, 0x01, 0x4c, 0x92, 0x05, 0x32, 0x29, 0x2e, 0x67, // Q%../ ...L..2).g
+	0x39, 0x30, 0x5b, 0x53, 0x4d, 0x23, 0xfe, 0x3c, 0x0a, 0x16, 0x0c, 0x0e, 0x15, 0x08, 0x2d, 0x0a, // 90[SM#.<......-.
+	0x83, 0x3d, 0x21, 0x70, 0x6e, 0x82, 0x73, 0x20, 0x07, 0x82, 0x73, 0x20, 0x0e, 0x82, 0x50, 0x82, // .=!pn.s ..s ..P.
+	0x66, 0x2e, 0x18, 0x0e, 0x0c, 0x15, 0x0a, 0x2d, 0x08, 0x0a, 0x01, 0x0b, 0x09, 0x70, 0x70, 0x09, // f......-.....pp.
+	0x0a, 0x82, 0x21, 0x25, 0x2e, 0x09, 0x16, 0x0b, 0x0d, 0x16, 0x82, 0x0d, 0x41, 0xf3, 0x0e, 0x20, // ..!%........A.. 
+	0x21, 0x49, 0x59, 0x0a, 0x82, 0xec, 0x20, 0x11, 0x44, 0xf1, 0x05, 0x21, 0x1d, 0x01, 0x46, 0x84, // !IY... .D..!..F.
+	0x06, 0x4d, 0x94, 0x07, 0x43, 0xf6, 0x06, 0x20, 0x21, 0x45, 0xe6, 0x0c, 0x23, 0x46, 0x01, 0x3c, // .M..C.. !E..#F.<
+	0x08, 0x46, 0xd1, 0x03, 0x20, 0x7e, 0x82, 0x58, 0x82, 0x86, 0x20, 0x3c, 0x47, 0x0d, 0x04, 0x46, // .F.. ~.X.. <G..F
+	0xd7, 0x04, 0x21, 0xfe, 0xc4, 0x4d, 0xb4, 0x04, 0x20, 0x7e, 0x46, 0xf5, 0x03, 0x20, 0x08, 0x4d, // ..!..M.. ~F.. .M
+	0xaa, 0x06, 0x46, 0xfc, 0x04, 0x20, 0x02, 0x82, 0x6a, 0x46, 0xfe, 0x09, 0x98, 0x26, 0x86, 0x58, // ..F.. ..jF...&.X
+	0x22, 0x7d, 0x0d, 0x17, 0x82, 0x20, 0x41, 0xef, 0x04, 0x26, 0x03, 0xff, 0xc3, 0x03, 0xfd, 0x03, // "}... A..&......
+	0xbd, 0x41, 0xef, 0x06, 0x4b, 0xbb, 0x03, 0x28, 0x03, 0x2f, 0x01, 0x22, 0x0e, 0x02, 0x07, 0x15, // .A..K..(./."....
+	0x23, 0x41, 0xf3, 0x03, 0x20, 0x01, 0x41, 0xf3, 0x03, 0x24, 0x17, 0x1e, 0x03, 0x3b, 0x01, 0x41, // #A.. .A..$...;.A
+	0xf3, 0x03, 0x20, 0x03, 0x49, 0xf1, 0x03, 0x20, 0x07, 0x86, 0xba, 0x20, 0x15, 0x8b, 0xc2, 0x20, // .. .I.. ... ... 
+	0x3d, 0x44, 0x05, 0x06, 0x21, 0x27, 0x35, 0x42, 0x18, 0x04, 0x20, 0x3b, 0x4b, 0xf3, 0x08, 0x86, // =D..!'5B.. ;K...
+	0xf6, 0x4b, 0xde, 0x07, 0x08, 0x2b, 0x03, 0xdd, 0x12, 0x3b, 0x29, 0x22, 0x4c, 0x52, 0x58, 0x2f, // .K...+...;)"LRX/
+	0x20, 0x34, 0x62, 0x5a, 0x52, 0x25, 0x02, 0x28, 0x3a, 0x12, 0x10, 0x10, 0x13, 0x25, 0x38, 0x26, //  4bZR%.(:....%8&
+	0x25, 0x52, 0x5a, 0x62, 0x34, 0x20, 0x2f, 0x58, 0x52, 0x4c, 0x22, 0x26, 0x38, 0x25, 0x13, 0x10, // %RZb4 /XRL"&8%..
+	0x10, 0x9f, 0x84, 0xca, 0x20, 0x9f, 0x82, 0xd2, 0x22, 0x16, 0x0b, 0x41, 0x41, 0x09, 0x04, 0x2c, // .... ..."..AA..,
+	0x9f, 0x0e, 0x17, 0x0a, 0x07, 0x09, 0x01, 0x01, 0x09, 0x07, 0x0a, 0x17, 0x0e, 0x82, 0x18, 0x24, // ...............$
+	0x08, 0x17, 0x0d, 0x41, 0x0c, 0x84, 0x18, 0x21, 0x0d, 0x16, 0x82, 0xf8, 0x2a, 0x02, 0x75, 0x31, // ...A...!....*.u1
+	0x59, 0x28, 0x23, 0x35, 0x25, 0x15, 0x02, 0x02, 0x4a, 0x72, 0x04, 0x29, 0x28, 0x59, 0x31, 0x2a, // Y(#5%...Jr.)(Y1*
+	0x5a, 0x31, 0x35, 0x62, 0x5a, 0x53, 0x4a, 0x73, 0x04, 0x20, 0x03, 0x4e, 0x4c, 0x04, 0x27, 0x53, // Z15bZSJs. .NL.'S
+	0x5a, 0x62, 0x35, 0x31, 0x5a, 0x2a, 0xde, 0x41, 0x53, 0x04, 0x20, 0x9f, 0x41, 0x59, 0x09, 0x82, // Zb51Z*.AS. .AY..
+	0x6d, 0x25, 0x09, 0x16, 0x0e, 0x41, 0x0c, 0x15, 0x84, 0x16, 0x27, 0x17, 0x0a, 0x08, 0x09, 0x09, // m%...A....'.....
+	0x08, 0x0a, 0x17, 0x83, 0x16, 0x23, 0x0b, 0x15, 0x0b, 0x41, 0x4f, 0x63, 0x06, 0x27, 0x01, 0x42, // .....#...AOc.'.B
+	0x03, 0xfa, 0x02, 0x3e, 0x00, 0x1c, 0x82, 0x0c, 0x41, 0xcb, 0x0a, 0x47, 0xa2, 0x0d, 0x82, 0xe8, // ...>....A..G....
+	0x21, 0x03, 0xe7, 0x86, 0x54, 0x48, 0xd4, 0x10, 0x21, 0x02, 0x2b, 0x41, 0x96, 0x08, 0x41, 0x88, // !...TH..!.+A..A.
+	0x0a, 0x22, 0x09, 0x0a, 0x00, 0x43, 0x7b, 0x0e, 0x20, 0x4b, 0x41, 0x8b, 0x2c, 0x86, 0x82, 0x41, // ."...C{. KA.,..A
+	0x7b, 0x06, 0x47, 0x5c, 0x06, 0x26, 0x1d, 0x01, 0x03, 0xda, 0x12, 0x3b, 0x28, 0x4f, 0x6d, 0x0a, // {.G..&.....;(Om.
+	0x21, 0x02, 0x27, 0x41, 0x6b, 0x06, 0x20, 0x25, 0x4f, 0x95, 0x0e, 0x22, 0x10, 0x10, 0x9e, 0x82, // !.'Ak. %O.."....
+	0x85, 0x23, 0x17, 0x0c, 0xfe, 0x06, 0x83, 0xf8, 0x23, 0x08, 0x01, 0x01, 0x08, 0x83, 0xfa, 0x22, // .#......#......"
+	0x01, 0xfa, 0x0c, 0x83, 0x9c, 0x25, 0x02, 0x74, 0x30, 0x59, 0x28, 0x22, 0x41, 0x55, 0x05, 0x4f, // .....%.t0Y("AU.O
+	0xaa, 0x03, 0x23, 0x28, 0x59, 0x30, 0x2a, 0x43, 0x99, 0x06, 0x20, 0x24, 0x41, 0x55, 0x05, 0x21, // ..#(Y0*C.. $AU.!
+	0x34, 0x22, 0x4f, 0x8f, 0x04, 0x25, 0x30, 0x5a, 0x2a, 0xdb, 0x0b, 0x14, 0x83, 0xd7, 0x26, 0x08, // 4"O..%0Z*.....&.
+	0x08, 0x13, 0x0c, 0x4e, 0x0c, 0x13, 0x85, 0x0a, 0x22, 0x14, 0x0b, 0x4e, 0x83, 0xdb, 0x20, 0xf4, // ...N...."..N.. .
+	0x82, 0xdb, 0x20, 0x0c, 0x82, 0xdb, 0x22, 0x31, 0x00, 0x4c, 0x46, 0x61, 0x08, 0x20, 0x11, 0x42, // .. ..."1.LFa. .B
+	0x15, 0x07, 0x21, 0x0f, 0x01, 0x41, 0x44, 0x0a, 0x82, 0xc5, 0x22, 0x3b, 0x01, 0x11, 0x48, 0xf8, // ..!..AD...";..H.
+	0x0e, 0x46, 0x60, 0x0b, 0x21, 0x17, 0x23, 0x46, 0x85, 0x05, 0x20, 0x35, 0x46, 0x7a, 0x05, 0x27, // .F`.!.#F.. 5Fz.'
+	0x02, 0x3b, 0x12, 0x20, 0x0d, 0x0d, 0x0e, 0x1d, 0x84, 0x05, 0x23, 0x09, 0x15, 0xfe, 0x24, 0x4c, // .;. ......#...$L
+	0x24, 0x04, 0x26, 0x0d, 0x0d, 0x0d, 0x20, 0x13, 0x1d, 0x59, 0x4c, 0x30, 0x06, 0x35, 0x05, 0x0a, // $.&... ..YL0.5..
+	0x06, 0x01, 0x29, 0xa5, 0x15, 0x16, 0x16, 0x15, 0x17, 0x34, 0x1f, 0x1f, 0x35, 0x16, 0x02, 0x16, // ..)......4..5...
+	0x17, 0x17, 0x16, 0x15, 0x85, 0x0a, 0x21, 0x55, 0x0e, 0x82, 0x2a, 0x22, 0x12, 0xfe, 0x7e, 0x83, // ......!U..*"..~.
+	0x06, 0x23, 0x11, 0x3c, 0x15, 0x09, 0x84, 0x2d, 0x28, 0x3a, 0x13, 0x1f, 0x0d, 0x01, 0x0d, 0x0e, // .#.<...-(:......
+	0x01, 0x29, 0x84, 0x0d, 0x20, 0x77, 0x84, 0x46, 0x20, 0x66, 0x82, 0x3b, 0x22, 0x1e, 0x34, 0x16, // .).. w.F f.;".4.
+	0x83, 0x3a, 0x26, 0x16, 0x34, 0x1e, 0x20, 0x36, 0x15, 0x01, 0x83, 0x50, 0x4f, 0x5f, 0x0a, 0x24, // .:&.4. 6...PO_.$
+	0x2c, 0x00, 0x47, 0x00, 0x79, 0x82, 0xdd, 0x41, 0xb2, 0x06, 0x20, 0x03, 0x41, 0xaf, 0x0f, 0x4d, // ,.G.y..A.. .A..M
+	0x52, 0x04, 0x22, 0x2f, 0x01, 0x15, 0x90, 0xc2, 0x88, 0xdc, 0x21, 0x07, 0x33, 0x41, 0x19, 0x20, // R."/......!.3A. 
+	0x20, 0x35, 0x41, 0x19, 0x0d, 0x21, 0x02, 0x00, 0x41, 0xdb, 0x05, 0x51, 0x2f, 0x03, 0x41, 0xda, //  5A..!..A..Q/.A.
+	0x12, 0x51, 0x70, 0x09, 0x23, 0x15, 0x24, 0x0f, 0x01, 0x48, 0xaa, 0x03, 0x22, 0x0f, 0x23, 0x15, // .Qp.#.$..H..".#.
+	0x82, 0x0a, 0x20, 0x0f, 0x49, 0x01, 0x03, 0x29, 0x24, 0x15, 0xa2, 0xcb, 0x0c, 0x15, 0x09, 0x09, // .. .I..)$.......
+	0x09, 0x15, 0x84, 0x05, 0x2f, 0x06, 0x0e, 0xfe, 0xbc, 0x04, 0x07, 0x03, 0x03, 0x03, 0x08, 0x09, // ..../...........
+	0x09, 0x16, 0x0c, 0x15, 0x3d, 0x84, 0x0b, 0x82, 0x00, 0x23, 0x07, 0x04, 0x03, 0xba, 0x41, 0xfa, // ....=....#....A.
+	0x04, 0x51, 0x89, 0x09, 0x41, 0xf9, 0x0d, 0x84, 0x81, 0x42, 0x22, 0x05, 0x20, 0xa2, 0x82, 0x60, // .Q..A....B". ..`
+	0x22, 0x24, 0x14, 0x16, 0x82, 0x6b, 0x49, 0x61, 0x03, 0x82, 0x61, 0x21, 0x15, 0x23, 0x82, 0x11, // "$...kIa..a!.#..
+	0x20, 0xf3, 0x84, 0x63, 0x21, 0xfe, 0xf8, 0x82, 0x06, 0x24, 0x16, 0x0c, 0x28, 0x0e, 0x06, 0x84, //  ..c!....$..(...
+	0x54, 0x22, 0x27, 0x0d, 0x15, 0x45, 0x62, 0x03, 0x20, 0xcb, 0x84, 0x0c, 0x20, 0x51, 0x84, 0x6c, // T"'..Eb. ... Q.l
+	0x27, 0x00, 0x02, 0x00, 0xc4, 0xff, 0xc6, 0x03, 0x3c, 0x4a, 0x33, 0x04, 0x51, 0xbb, 0x03, 0x50, // '.......<J3.Q..P
+	0xa9, 0x17, 0x20, 0x03, 0x44, 0x78, 0x03, 0x21, 0x2f, 0x02, 0x50, 0x39, 0x0a, 0x46, 0x82, 0x04, // .. .Dx.!/.P9.F..
+	0x29, 0x33, 0x0f, 0x02, 0x15, 0x0f, 0x01, 0x23, 0x15, 0x33, 0x0f, 0x50, 0x39, 0x03, 0x4e, 0xe0, // )3.....#.3.P9.N.
+	0x03, 0x22, 0x27, 0x35, 0x33, 0x51, 0xcb, 0x05, 0x20, 0x02, 0x82, 0x0c, 0x21, 0x07, 0x22, 0x41, // ."'53Q.. ...!."A
+	0x71, 0x04, 0x28, 0x0f, 0x01, 0x02, 0x0d, 0x1e, 0x33, 0x15, 0x16, 0x15, 0x82, 0x02, 0x26, 0x33, // q.(.....3.....&3
+	0x1e, 0x1d, 0x31, 0x14, 0x15, 0x14, 0x82, 0x02, 0x08, 0x4e, 0x31, 0x1d, 0x41, 0x06, 0x0d, 0x08, // ..1......N1.A...
+	0xc9, 0x13, 0x0e, 0x03, 0x06, 0x34, 0x2d, 0x2c, 0x6f, 0x43, 0x44, 0x6d, 0x2b, 0x2c, 0x2b, 0x09, // .....4-,oCDm+,+.
+	0x08, 0x12, 0x02, 0x1d, 0x01, 0x19, 0x3b, 0x18, 0x09, 0x09, 0x06, 0x03, 0x0b, 0x1d, 0xc0, 0x1b, // ......;.........
+	0x06, 0x06, 0x01, 0x05, 0x01, 0x07, 0x05, 0x07, 0x1f, 0x19, 0x55, 0x08, 0x0b, 0x04, 0x0b, 0x07, // ..........U.....
+	0x07, 0x0d, 0x06, 0x07, 0x08, 0x02, 0x0e, 0xe3, 0x14, 0x14, 0x14, 0x33, 0x1e, 0x1e, 0x33, 0x16, // ...........3..3.
+	0x14, 0x15, 0x15, 0x14, 0x15, 0x33, 0x1f, 0x1e, 0x33, 0x82, 0x10, 0x3f, 0x01, 0x80, 0x05, 0x05, // .....3..3..?....
+	0x07, 0x0e, 0x18, 0x48, 0x71, 0x28, 0x2a, 0x29, 0x25, 0x24, 0x27, 0x6a, 0x43, 0x20, 0x30, 0x0f, // ...Hq(*)%$'jC 0.
+	0x21, 0x2a, 0x02, 0x1c, 0x02, 0x39, 0x1b, 0x01, 0x08, 0x1b, 0x16, 0x1a, 0x82, 0x53, 0x2e, 0x0d, // !*...9.......S..
+	0x07, 0x58, 0x0e, 0x17, 0x09, 0x0f, 0x29, 0x1a, 0x55, 0x23, 0x23, 0x06, 0x04, 0x01, 0x82, 0x5d, // .X....).U##....]
+	0x24, 0x0b, 0x1d, 0x12, 0x19, 0x00, 0x42, 0x53, 0x0c, 0x22, 0x6e, 0x00, 0x87, 0x42, 0x53, 0x21, // $.....BS."n..BS!
+	0x20, 0x17, 0x41, 0x04, 0x1b, 0x21, 0x3d, 0x01, 0x41, 0x04, 0x13, 0x41, 0x42, 0x0b, 0x20, 0x13, //  .A..!=.A..AB. .
+	0x41, 0x68, 0x17, 0x42, 0x5e, 0x28, 0x08, 0x44, 0x06, 0x2b, 0x47, 0x1b, 0x1c, 0x1c, 0x06, 0x06, // Ah.B^(.D.+G.....
+	0x0b, 0x01, 0x12, 0x01, 0x10, 0x26, 0x0f, 0x06, 0x06, 0x04, 0x02, 0x07, 0x12, 0x7c, 0x11, 0x04, // .....&.......|..
+	0x04, 0x03, 0x01, 0x04, 0x03, 0x05, 0x14, 0x10, 0x36, 0x05, 0x07, 0x02, 0x08, 0x04, 0x05, 0x08, // ........6.......
+	0x03, 0x05, 0x05, 0x01, 0x0a, 0x03, 0x09, 0x05, 0x80, 0x0d, 0x09, 0x02, 0x04, 0x21, 0x1d, 0x1d, // .............!..
+	0x47, 0x2b, 0x02, 0x13, 0x21, 0x0e, 0x0e, 0x0d, 0x0d, 0x0e, 0x0e, 0x21, 0x13, 0x43, 0xc2, 0x03, // G+..!......!.C..
+	0x83, 0x00, 0x21, 0x20, 0x12, 0x42, 0x71, 0x29, 0x2a, 0xb6, 0x17, 0x17, 0x19, 0x44, 0x2b, 0x15, // ..! .Bq)*....D+.
+	0x1e, 0x0a, 0x15, 0x1c, 0x82, 0x7a, 0x35, 0x24, 0x12, 0x01, 0x05, 0x11, 0x0e, 0x10, 0x06, 0x06, // .....z5$........
+	0x03, 0x08, 0x05, 0x39, 0x09, 0x0f, 0x05, 0x0a, 0x1a, 0x11, 0x36, 0x17, 0x16, 0x83, 0x84, 0x36, // ...9......6....6
+	0x04, 0x01, 0x07, 0x13, 0x0c, 0x10, 0x03, 0x03, 0x04, 0x09, 0x10, 0x2e, 0x49, 0x19, 0x1b, 0x1a, // ............I...
+	0xfe, 0x2e, 0x0c, 0x0d, 0x0d, 0x21, 0x13, 0x82, 0x7c, 0x84, 0x72, 0x26, 0x21, 0x14, 0x13, 0x21, // .....!..|.r&!..!
+	0x0d, 0x0d, 0x0c, 0x45, 0x87, 0x03, 0x2b, 0x01, 0x79, 0xff, 0xc6, 0x02, 0x87, 0x03, 0xba, 0x00, // ...E..+.y.......
+	0x1a, 0x00, 0x37, 0x4d, 0xc9, 0x0b, 0x43, 0xb3, 0x10, 0x20, 0x13, 0x43, 0xa9, 0x03, 0x47, 0xc8, // ..7M..C.. .C..G.
+	0x0d, 0x46, 0xf5, 0x09, 0x2a, 0x01, 0x79, 0x14, 0x13, 0x14, 0x30, 0x1c, 0x1d, 0x30, 0x13, 0x02, // .F..*.y...0..0..
+	0x42, 0x5f, 0x03, 0x21, 0x13, 0x2f, 0x83, 0x0a, 0x22, 0x13, 0x14, 0xfa, 0x4b, 0x79, 0x03, 0x26, // B_.!./.."...Ky.&
+	0x0b, 0x17, 0x0e, 0x86, 0x0f, 0x18, 0x0a, 0x45, 0xf9, 0x03, 0x2a, 0x0a, 0x18, 0x0f, 0x86, 0x0e, // .......E..*.....
+	0x17, 0x0b, 0x4d, 0x1c, 0x2f, 0x14, 0x83, 0x00, 0x28, 0x15, 0x2f, 0x1b, 0x1c, 0x31, 0x15, 0x02, // ..M./...(./..1..
+	0x13, 0x14, 0x84, 0x3c, 0x26, 0x03, 0x58, 0x0a, 0x17, 0x0e, 0xfe, 0x07, 0x89, 0x2a, 0x22, 0x01, // ...<&.X......*".
+	0xf8, 0x0e, 0x82, 0x0b, 0x21, 0x0b, 0x0b, 0x46, 0x30, 0x03, 0x42, 0x23, 0x09, 0x22, 0x2a, 0x00, // ....!..F0.B#."*.
+	0x47, 0x51, 0xd5, 0x04, 0x42, 0x23, 0x0e, 0x23, 0x33, 0x32, 0x3e, 0x02, 0x42, 0x23, 0x09, 0x20, // GQ..B#.#32>.B#. 
+	0x23, 0x44, 0x5b, 0x08, 0x92, 0xb1, 0x42, 0x00, 0x04, 0x44, 0x93, 0x16, 0x42, 0x02, 0x14, 0x55, // #D[...B..D..B..U
+	0xbe, 0x09, 0x87, 0x11, 0x24, 0x29, 0x52, 0x08, 0x0e, 0x06, 0x84, 0x00, 0x26, 0x0e, 0x08, 0x52, // ....$)R.....&..R
+	0x08, 0x0f, 0x06, 0x05, 0x82, 0x01, 0x28, 0x06, 0x0f, 0x08, 0x29, 0x11, 0x1d, 0x0c, 0x01, 0x0c, // ......(...).....
+	0x83, 0x00, 0x21, 0x1c, 0x11, 0x82, 0x0a, 0x21, 0x0b, 0x0c, 0x82, 0x02, 0x21, 0x1d, 0x11, 0x41, // ..!....!....!..A
+	0xde, 0x14, 0x22, 0x13, 0x25, 0x37, 0x55, 0xd9, 0x0a, 0x83, 0x5c, 0x20, 0xca, 0x83, 0x4d, 0x22, // ..".%7U.... ..M"
+	0x09, 0xfe, 0xd0, 0x82, 0x4e, 0x52, 0xef, 0x03, 0x82, 0x4e, 0x22, 0x01, 0x2f, 0x09, 0x82, 0x0b, // ....NR...N"./...
+	0x22, 0x06, 0xfe, 0x42, 0x82, 0x50, 0x25, 0x1d, 0x10, 0x11, 0x1e, 0x0c, 0x01, 0x83, 0x51, 0x20, // "..B.P%.......Q 
+	0x0d, 0x82, 0x5b, 0x20, 0x1c, 0x82, 0x11, 0x2d, 0x00, 0x03, 0x00, 0x07, 0xff, 0xe6, 0x03, 0xf9, // ..[ ...-........
+	0x03, 0x93, 0x00, 0x1c, 0x00, 0x37, 0x4f, 0x87, 0x03, 0x47, 0x36, 0x04, 0x24, 0x11, 0x14, 0x16, // .....7O..G6.$...
+	0x1f, 0x02, 0x54, 0xd0, 0x06, 0x20, 0x11, 0x54, 0xd1, 0x04, 0x82, 0xfd, 0x22, 0x06, 0x07, 0x13, // ..T.. .T...."...
+	0x54, 0xee, 0x0e, 0x20, 0x15, 0x52, 0xd1, 0x05, 0x2c, 0x33, 0x2e, 0x01, 0x23, 0x03, 0x36, 0x32, // T.. .R..,3..#.62
+	0x17, 0x33, 0x1e, 0x01, 0x17, 0x01, 0x4f, 0x93, 0x03, 0x23, 0x0e, 0x01, 0x07, 0x33, 0x47, 0x64, // .3....O..#...3Gd
+	0x09, 0x24, 0x26, 0x36, 0x37, 0x33, 0x01, 0x47, 0x69, 0x03, 0x23, 0x33, 0x01, 0xd1, 0x0c, 0x47, // .$&673.Gi.#3...G
+	0xc6, 0x03, 0x22, 0x0c, 0x1f, 0x20, 0x48, 0x35, 0x03, 0x82, 0x00, 0x2a, 0x0a, 0x15, 0x0c, 0x20, // ..".. H5...*... 
+	0x09, 0x0f, 0x07, 0x2f, 0x10, 0x1b, 0x0c, 0x41, 0xa3, 0x03, 0x25, 0x0c, 0x1b, 0x10, 0x10, 0x1b, // .../...A..%.....
+	0x0b, 0x83, 0x9f, 0x08, 0x23, 0x01, 0x0a, 0x1c, 0x11, 0x1d, 0x0f, 0x1e, 0x0f, 0x02, 0x0c, 0x14, // ....#...........
+	0x07, 0x01, 0xa5, 0x07, 0x06, 0x01, 0x02, 0x0e, 0x0b, 0x01, 0x0c, 0x1d, 0x11, 0xfc, 0xb7, 0x12, // ................
+	0x1d, 0x0c, 0x0a, 0x0d, 0x03, 0x02, 0x06, 0x07, 0x02, 0x82, 0x17, 0x24, 0x15, 0x0d, 0x01, 0x02, // ...........$....
+	0x9d, 0x49, 0xbf, 0x04, 0x22, 0xee, 0x0d, 0x16, 0x48, 0x22, 0x05, 0x23, 0x16, 0x0d, 0x01, 0x14, // .I.."...H".#....
+	0x84, 0x5d, 0x2b, 0x05, 0x04, 0xfe, 0x3e, 0x0c, 0x0b, 0x0b, 0x1b, 0x10, 0x0f, 0x1b, 0x0b, 0x82, // .]+...>.........
+	0x07, 0x21, 0x0c, 0x02, 0x83, 0x5d, 0x21, 0x1a, 0x0c, 0x82, 0x08, 0x08, 0x2e, 0xb8, 0x07, 0x07, // .!...]!.........
+	0x05, 0x14, 0x0f, 0xfd, 0x0c, 0x0e, 0x1f, 0x10, 0x01, 0x12, 0x1c, 0x0b, 0x0d, 0x0d, 0x0e, 0x0d, // ................
+	0x0c, 0x1b, 0x11, 0x10, 0x1f, 0x0f, 0x02, 0xf4, 0x02, 0x0e, 0x13, 0x05, 0x00, 0x02, 0x00, 0x12, // ................
+	0xff, 0xe8, 0x03, 0xfa, 0x03, 0x98, 0x00, 0x18, 0x00, 0x25, 0x00, 0x00, 0x4c, 0x8a, 0x04, 0x20, // .........%..L.. 
+	0x36, 0x44, 0x2d, 0x08, 0x82, 0xdc, 0x20, 0x27, 0x56, 0xf0, 0x05, 0x33, 0x01, 0x17, 0x06, 0x02, // 6D-... 'V..3....
+	0x0e, 0x01, 0x2f, 0x01, 0x26, 0x3e, 0x01, 0x24, 0x37, 0x68, 0x03, 0x0e, 0x23, 0x15, 0x14, 0x24, // ../.&>.$7h..#..$
+	0x4e, 0xfb, 0x04, 0x3e, 0x03, 0x1f, 0x3f, 0x21, 0x5f, 0x0f, 0x03, 0x0d, 0x0d, 0x2b, 0x1e, 0x03, // N..>..?!_....+..
+	0x2e, 0x64, 0x7b, 0xd9, 0xbe, 0xa3, 0x44, 0x2e, 0x18, 0x40, 0xb1, 0x01, 0x21, 0xc9, 0xc7, 0x03, // .d{...D..@..!...
+	0x0e, 0x0e, 0x01, 0x82, 0x21, 0x82, 0x2a, 0x3b, 0x23, 0x0e, 0x03, 0x1e, 0x2a, 0x0d, 0x03, 0x0e, // ....!.*;#...*...
+	0x2f, 0x21, 0x21, 0x3f, 0x1e, 0x02, 0xd1, 0x5d, 0xc8, 0xfe, 0xe2, 0xab, 0x38, 0x1d, 0x2e, 0x4a, // /!!?...]....8..J
+	0xa4, 0xb7, 0xc8, 0x6e, 0x58, 0x9f, 0x0b, 0x3f, 0x06, 0x00, 0x00, 0x0d, 0x01, 0x27, 0x13, 0x09, // ...nX..?.....'..
+	0x02, 0x01, 0x57, 0xfe, 0xe6, 0x37, 0x37, 0x02, 0xa3, 0x01, 0x1a, 0xfd, 0x5d, 0x03, 0x37, 0x37, // ..W..77.....].77
+	0x01, 0x1a, 0x02, 0xa3, 0xfe, 0xe7, 0xfd, 0x5c, 0x49, 0x07, 0x0b, 0x20, 0x04, 0x4d, 0xb5, 0x03, // ........I.. .M..
+	0x20, 0x25, 0x52, 0x6e, 0x04, 0x42, 0xb7, 0x08, 0x52, 0x62, 0x12, 0x26, 0x03, 0x51, 0xfd, 0x5e, //  %Rn.B..Rb.&.Q.^
+	0x02, 0xa2, 0x94, 0x41, 0x72, 0x03, 0x26, 0x0a, 0x17, 0x0e, 0xfc, 0x94, 0x0f, 0x18, 0x49, 0xd4, // ...Ar.&.......I.
+	0x05, 0x2d, 0x18, 0x0f, 0x03, 0x6c, 0x0e, 0x17, 0x0a, 0x6f, 0x02, 0xa2, 0xfd, 0x5e, 0x03, 0x36, // .-...l...o...^.6
+	0x8f, 0x1a, 0x20, 0x6b, 0x43, 0x49, 0x07, 0x43, 0x47, 0x09, 0x22, 0x21, 0x00, 0x3e, 0x46, 0x75, // .. kCI.CG."!.>Fu
+	0x03, 0x21, 0x01, 0x17, 0x58, 0x03, 0x03, 0x41, 0x1a, 0x03, 0x2e, 0x0f, 0x01, 0x21, 0x11, 0x33, // .!..X..A.....!.3
+	0x1f, 0x01, 0x33, 0x17, 0x33, 0x37, 0x33, 0x37, 0x21, 0x11, 0x41, 0x3a, 0x03, 0x20, 0x3d, 0x49, // ..3.3737!.A:. =I
+	0x97, 0x03, 0x20, 0x37, 0x43, 0x49, 0x0b, 0x8f, 0x91, 0x23, 0x07, 0x1f, 0x02, 0x07, 0x4f, 0xf2, // .. 7CI...#....O.
+	0x03, 0x50, 0xed, 0x03, 0x22, 0x27, 0x3f, 0x03, 0x4c, 0xf5, 0x03, 0x4c, 0xfe, 0x04, 0x08, 0x21, // .P.."'?.L..L...!
+	0x17, 0x03, 0x9f, 0x01, 0x7e, 0x14, 0x2c, 0x18, 0x0c, 0x1f, 0x2d, 0x0f, 0x2f, 0xfe, 0x7b, 0xf3, // ....~.,...-./.{.
+	0x21, 0x04, 0x03, 0x20, 0x03, 0x10, 0x03, 0x27, 0x01, 0x2a, 0x5e, 0x07, 0x0c, 0x0c, 0x04, 0x18, // !.. ...'.*^.....
+	0x13, 0x17, 0x82, 0xac, 0x94, 0xc4, 0x08, 0x3e, 0xd6, 0x02, 0x7d, 0x0a, 0x07, 0xfe, 0x97, 0x0d, // .......>..}.....
+	0x07, 0x0a, 0x05, 0x09, 0x03, 0xfe, 0x09, 0x0c, 0x7d, 0x0a, 0x0c, 0x06, 0x0b, 0x04, 0x6b, 0xd4, // ........}.....k.
+	0x02, 0x03, 0x09, 0x06, 0x16, 0x02, 0xf6, 0x03, 0x6c, 0x01, 0x11, 0x10, 0x01, 0x01, 0x04, 0x1b, // ........l.......
+	0x17, 0x38, 0xfd, 0x5e, 0x0c, 0x02, 0x03, 0x03, 0x0e, 0x01, 0x5b, 0x71, 0x08, 0x13, 0x28, 0x15, // .8.^......[q..(.
+	0x0b, 0x1e, 0x2c, 0x0e, 0xc4, 0x0a, 0x0b, 0x95, 0xf9, 0x3c, 0xa7, 0x02, 0x6a, 0x14, 0x16, 0xfe, // ..,......<..j...
+	0x52, 0x0a, 0x02, 0x02, 0x01, 0x05, 0x04, 0x01, 0x2f, 0x18, 0x14, 0x6c, 0x05, 0x03, 0x06, 0x05, // R......./..l....
+	0x7f, 0xfb, 0x02, 0x04, 0x05, 0x01, 0x08, 0x4a, 0x8f, 0x0d, 0x22, 0x28, 0x00, 0x41, 0x4a, 0x8f, // .......J.."(.AJ.
+	0x03, 0x21, 0x03, 0x23, 0x44, 0x60, 0x03, 0x44, 0x5e, 0x14, 0x20, 0x03, 0x50, 0x05, 0x10, 0x46, // .!.#D`.D^. .P..F
+	0x4e, 0x06, 0x21, 0x03, 0x67, 0x43, 0xd1, 0x04, 0x55, 0xf8, 0x03, 0x20, 0x24, 0x44, 0x2e, 0x07, // N.!.gC..U.. $D..
+	0x20, 0x24, 0x4d, 0x82, 0x03, 0x43, 0xf5, 0x04, 0x20, 0x25, 0x55, 0xb9, 0x05, 0x31, 0x25, 0x78, //  $M..C.. %U..1%x
+	0x31, 0x78, 0x46, 0x46, 0x77, 0x31, 0x31, 0x32, 0x32, 0x31, 0x31, 0x77, 0x46, 0x46, 0x78, 0x31, // 1xFFw112211wFFx1
+	0x83, 0x00, 0x21, 0x03, 0x25, 0x99, 0x30, 0x89, 0x54, 0x21, 0xfd, 0xac, 0x84, 0x2c, 0x8e, 0x3f, // ..!.%.0.T!...,.?
+	0x20, 0x00, 0x45, 0x1f, 0x0c, 0x53, 0x93, 0x03, 0x41, 0xd7, 0x03, 0x46, 0xe1, 0x14, 0x82, 0xaa, //  .E..S..A..F....
+	0x20, 0x27, 0x58, 0xf7, 0x17, 0x21, 0x25, 0x3e, 0x82, 0xe5, 0x84, 0xec, 0x5a, 0xee, 0x06, 0x5a, //  'X..!%>....Z..Z
+	0xed, 0x0b, 0x2b, 0x02, 0xb4, 0x25, 0x24, 0x24, 0x25, 0x26, 0x5a, 0x34, 0x34, 0x5a, 0x25, 0x84, // ..+..%$$%&Z44Z%.
+	0x00, 0x83, 0x09, 0x21, 0x26, 0xb4, 0x90, 0xc7, 0x82, 0x9b, 0x21, 0xfe, 0x9b, 0x9b, 0xc2, 0x87, // ...!&.....!.....
+	0xe6, 0x21, 0x02, 0x73, 0x85, 0x42, 0x8d, 0x56, 0x20, 0x9e, 0x8e, 0x4b, 0x84, 0x5f, 0x20, 0x14, // .!.s.B.V ..K._ .
+	0x41, 0x1a, 0x23, 0x41, 0xc3, 0x04, 0x2a, 0x4a, 0xff, 0xc6, 0x03, 0xb6, 0x03, 0xba, 0x00, 0x13, // A.#A..*J........
+	0x00, 0x27, 0x50, 0x89, 0x04, 0x43, 0x34, 0x06, 0x24, 0x1f, 0x01, 0x07, 0x01, 0x07, 0x52, 0x95, // .'P..C4.$.....R.
+	0x04, 0x23, 0x25, 0x17, 0x0f, 0x01, 0x4b, 0x5e, 0x07, 0x53, 0x5c, 0x06, 0x3d, 0x01, 0x4a, 0x05, // .#%...K^.S..=.J.
+	0x05, 0x05, 0x0c, 0x07, 0x03, 0x28, 0x07, 0x0c, 0x05, 0x0a, 0x0a, 0xfe, 0x6c, 0x18, 0x18, 0xfe, // .....(......l...
+	0x6c, 0x05, 0x05, 0x03, 0x62, 0x0a, 0x0a, 0x18, 0xfc, 0xd8, 0x18, 0x52, 0x83, 0x03, 0x21, 0x01, // l...b......R..!.
+	0x94, 0x52, 0x5a, 0x04, 0x82, 0x07, 0x23, 0x01, 0x7d, 0x06, 0x0c, 0x83, 0x11, 0x21, 0x05, 0x17, // .RZ...#.}....!..
+	0x82, 0x24, 0x23, 0x0b, 0x0a, 0x01, 0x95, 0x82, 0x18, 0x27, 0x9e, 0x18, 0x17, 0x0a, 0x0a, 0x05, // .$#......'......
+	0x0c, 0x06, 0x84, 0x20, 0x20, 0x06, 0x82, 0x1b, 0x21, 0xfe, 0x6b, 0x42, 0x4f, 0x05, 0x27, 0x00, // ...  ...!.kBO.'.
+	0x0a, 0x03, 0xfa, 0x03, 0x76, 0x00, 0x15, 0x57, 0x67, 0x04, 0x53, 0x1e, 0x06, 0x21, 0x22, 0x26, // ....v..Wg.S..!"&
+	0x53, 0x1c, 0x06, 0x84, 0x7d, 0x83, 0x96, 0x43, 0x4e, 0x0c, 0x83, 0x8e, 0x22, 0x17, 0x01, 0xbd, // S...}..CN..."...
+	0x82, 0x64, 0x22, 0x0a, 0x0a, 0x17, 0x82, 0x50, 0x21, 0xfe, 0x6c, 0x83, 0x50, 0x84, 0x66, 0x25, // .d"....P!.l.P.f%
+	0x02, 0x3d, 0x0a, 0xfe, 0x6b, 0x18, 0x86, 0x7e, 0x86, 0x6e, 0x25, 0x95, 0x0a, 0x03, 0x76, 0x05, // .=..k..~.n%...v.
+	0x05, 0x83, 0xa6, 0x20, 0x0a, 0x8b, 0xa5, 0x82, 0x82, 0x20, 0x4a, 0x82, 0x9f, 0x20, 0x0a, 0x89, // ... ..... J.. ..
+	0xd7, 0x83, 0x00, 0x82, 0xd9, 0x82, 0x97, 0x56, 0xfb, 0x09, 0x33, 0x1c, 0x00, 0x39, 0x00, 0x56, // .......V..3..9.V
+	0x00, 0x73, 0x00, 0x90, 0x00, 0xad, 0x00, 0xca, 0x00, 0xe7, 0x01, 0x04, 0x00, 0x00, 0x25, 0x4e, // .s............%N
+	0xe5, 0x0e, 0x4f, 0xd4, 0x0c, 0x20, 0x03, 0x4f, 0xd3, 0x0b, 0x8f, 0x22, 0x20, 0x13, 0x9b, 0x39, // ..O.. .O..." ..9
+	0x20, 0x01, 0x98, 0x36, 0x82, 0x1f, 0x20, 0x05, 0xb8, 0x39, 0x21, 0x37, 0x33, 0x99, 0x91, 0x21, //  ..6.. ..9!73..!
+	0x33, 0x03, 0x9b, 0x56, 0x20, 0x21, 0x9c, 0x73, 0x20, 0x03, 0x50, 0x4e, 0x09, 0x4e, 0xcc, 0x05, // 3..V !.s .PN.N..
+	0x50, 0x99, 0x05, 0x20, 0x3f, 0x84, 0x05, 0x90, 0x1b, 0x20, 0x3f, 0x95, 0x2d, 0x21, 0x01, 0x68, // P.. ?.... ?.-!.h
+	0x8b, 0x2b, 0x20, 0x08, 0x50, 0xe1, 0x08, 0x21, 0x01, 0x8f, 0x4f, 0x2b, 0x04, 0x20, 0x7e, 0x5e, // .+ .P..!..O+. ~^
+	0x99, 0x04, 0x23, 0x08, 0x09, 0x0a, 0x17, 0x82, 0x0a, 0x4f, 0x96, 0x03, 0x21, 0xfe, 0x71, 0x95, // ..#......O..!.q.
+	0x2f, 0x21, 0xd1, 0x7e, 0x4f, 0xb5, 0x09, 0x8a, 0x34, 0x20, 0xbe, 0x93, 0x2b, 0x82, 0x75, 0x20, // /!.~O...4 ..+.u 
+	0x7c, 0x95, 0x5d, 0x20, 0x84, 0x8a, 0x9f, 0x22, 0x7c, 0x0e, 0x17, 0x87, 0xc7, 0x21, 0x01, 0xba, // |.] ..."|....!..
+	0x8f, 0x46, 0x4f, 0xa2, 0x05, 0x22, 0x01, 0x3c, 0x7e, 0x50, 0x14, 0x09, 0x20, 0x7d, 0x51, 0x69, // .FO..".<~P.. }Qi
+	0x09, 0x21, 0xfd, 0x36, 0x8d, 0xea, 0x87, 0x4a, 0x20, 0x2c, 0x96, 0x5e, 0x20, 0xa7, 0x4f, 0xff, // .!.6...J ,.^ .O.
+	0x15, 0x20, 0x13, 0xad, 0x75, 0x95, 0x15, 0x23, 0x00, 0x00, 0x00, 0x06, 0x42, 0xcb, 0x14, 0x20, // . ..u..#....B.. 
+	0x00, 0x42, 0x30, 0x18, 0x42, 0x2b, 0x03, 0x20, 0x13, 0x50, 0xbc, 0x0d, 0x50, 0xd8, 0x0d, 0x20, // .B0.B+. .P..P.. 
+	0x27, 0x9b, 0x39, 0x20, 0x11, 0x9b, 0x1c, 0x20, 0x21, 0x51, 0x1d, 0x17, 0x83, 0x1c, 0x20, 0x07, // '.9 ... !Q.... .
+	0x51, 0x3e, 0x1b, 0x42, 0x6e, 0x17, 0x20, 0x90, 0x41, 0x1b, 0x06, 0x21, 0x01, 0xf9, 0x53, 0x10, // Q>.Bn. .A..!..S.
+	0x0a, 0x20, 0x07, 0x82, 0x25, 0x20, 0x90, 0x95, 0x2f, 0x95, 0x15, 0x21, 0x02, 0xf7, 0x89, 0x38, // . ..% ../..!...8
+	0x8d, 0x50, 0x20, 0x13, 0x8b, 0x53, 0x8b, 0x1a, 0x21, 0x01, 0x81, 0x41, 0xb1, 0x11, 0x83, 0x5a, // .P ..S..!..A...Z
+	0x21, 0xfe, 0x57, 0x41, 0xdd, 0x0d, 0x87, 0x6b, 0x20, 0x2e, 0x41, 0xfb, 0x14, 0x22, 0x7e, 0x02, // !.WA...k .A.."~.
+	0xf6, 0x42, 0x84, 0x09, 0x41, 0xcc, 0x0e, 0x92, 0x15, 0x20, 0xd1, 0x52, 0x29, 0x17, 0x46, 0xd7, // .B..A.... .R).F.
+	0x03, 0x24, 0xff, 0x03, 0xfa, 0x03, 0x81, 0x41, 0xe3, 0x06, 0x21, 0x00, 0x37, 0x41, 0xc0, 0x1b, // .$.....A..!.7A..
+	0x52, 0xa8, 0x1c, 0x20, 0x37, 0x41, 0xa3, 0x1b, 0x20, 0x16, 0x5a, 0xec, 0x03, 0x27, 0x08, 0x15, // R.. 7A.. .Z..'..
+	0x0c, 0x03, 0x82, 0x0c, 0x13, 0x09, 0x42, 0x6d, 0x03, 0x29, 0x09, 0x13, 0x0c, 0xfc, 0x7e, 0x0c, // ......Bm.)....~.
+	0x15, 0x08, 0x03, 0xd3, 0x8b, 0x0d, 0x8b, 0x25, 0x20, 0x11, 0x95, 0x16, 0x22, 0x08, 0x09, 0x0e, // .......% ..."...
+	0x82, 0x0a, 0x23, 0x6f, 0x0c, 0x14, 0x08, 0x83, 0xcc, 0x23, 0x08, 0x14, 0x0b, 0x70, 0x83, 0x20, // ..#o.....#...p. 
+	0x24, 0x07, 0x07, 0x08, 0x02, 0x11, 0x8a, 0x0c, 0x21, 0x09, 0x14, 0x88, 0x22, 0x23, 0xba, 0x0c, // $.......!..."#..
+	0x14, 0x09, 0x89, 0x12, 0x5b, 0x75, 0x05, 0x82, 0x28, 0x47, 0xd3, 0x0b, 0x86, 0xfb, 0x20, 0x13, // ....[u..(G.... .
+	0x55, 0x62, 0x0a, 0x4c, 0xd7, 0x10, 0x20, 0x21, 0x9b, 0x1c, 0x20, 0x05, 0x4d, 0xb9, 0x18, 0x82, // Ub.L.. !.. .M...
+	0x2e, 0x20, 0x18, 0x42, 0x44, 0x15, 0x21, 0x01, 0x7b, 0x92, 0x17, 0x82, 0x9b, 0x21, 0x02, 0x67, // . .BD.!.{....!.g
+	0x44, 0x64, 0x15, 0x21, 0x03, 0xa7, 0x54, 0x08, 0x13, 0x5c, 0xa7, 0x0a, 0x90, 0x17, 0x20, 0x2d, // Dd.!..T....... -
+	0x97, 0x29, 0x4b, 0x43, 0x06, 0x23, 0x01, 0x03, 0x01, 0xc0, 0x54, 0x7f, 0x04, 0x9b, 0xbd, 0x43, // .)KC.#....T....C
+	0x40, 0x17, 0x23, 0x01, 0x81, 0xfe, 0x85, 0x56, 0x0b, 0x0a, 0x20, 0x79, 0x42, 0x9b, 0x07, 0x21, // @.#....V.. yB..!
+	0x17, 0x0c, 0x49, 0xef, 0x08, 0x23, 0x02, 0x7e, 0x02, 0xbd, 0x41, 0x5b, 0x04, 0x21, 0x00, 0x17, // ..I..#.~..A[.!..
+	0x93, 0x59, 0x87, 0x75, 0x20, 0x01, 0x4e, 0xf9, 0x1b, 0x20, 0x46, 0x43, 0x88, 0x15, 0x21, 0x02, // .Y.u .N.. FC..!.
+	0x25, 0x45, 0xcf, 0x15, 0x20, 0x3a, 0x90, 0x8d, 0x86, 0xa5, 0x26, 0x02, 0xe4, 0x0a, 0x16, 0x0c, // %E.. :....&.....
+	0xfd, 0x88, 0x56, 0xe4, 0x0a, 0x20, 0x76, 0x41, 0x0f, 0x06, 0x42, 0x07, 0x11, 0x41, 0x0f, 0x1d, // ..V.. vA..B..A..
+	0x9b, 0xad, 0x20, 0x13, 0x4f, 0x16, 0x1b, 0x41, 0x49, 0x18, 0x20, 0x68, 0x46, 0x9b, 0x2c, 0x41, // .. .O..AI. hF.,A
+	0x78, 0x19, 0x21, 0x01, 0x29, 0x97, 0xe3, 0x21, 0x01, 0x10, 0x42, 0x39, 0x17, 0x41, 0xab, 0x04, // x.!.)..!..B9.A..
+	0x20, 0xa5, 0x82, 0xff, 0x20, 0x5b, 0x82, 0xff, 0x25, 0x10, 0x00, 0x31, 0x00, 0x00, 0x05, 0x4c, //  ... [..%..1...L
+	0x82, 0x07, 0x5e, 0xe4, 0x07, 0x20, 0x03, 0x48, 0x08, 0x07, 0x20, 0x21, 0x57, 0x87, 0x07, 0x57, // ..^.. .H.. !W..W
+	0x8f, 0x0e, 0x23, 0x03, 0x21, 0xfd, 0xbe, 0x5e, 0xcf, 0x04, 0x21, 0x02, 0xb6, 0x82, 0xbf, 0x25, // ..#.!..^..!....%
+	0x15, 0x0b, 0x91, 0x91, 0x0b, 0x15, 0x82, 0xc5, 0x21, 0xfd, 0x4a, 0x5e, 0xdf, 0x04, 0x22, 0x91, // ........!.J^..".
+	0x08, 0x07, 0x82, 0x05, 0x22, 0xae, 0x0b, 0x14, 0x82, 0x1b, 0x20, 0x3a, 0x84, 0x11, 0x23, 0x02, // ...."..... :..#.
+	0x45, 0xfd, 0xbb, 0x84, 0x2f, 0x21, 0x03, 0x9d, 0x5d, 0x22, 0x03, 0x22, 0x0c, 0xaa, 0xa9, 0x83, // E.../!..]"."....
+	0x0d, 0x22, 0x09, 0x1b, 0x0d, 0x83, 0x35, 0x84, 0x41, 0x20, 0x1d, 0x42, 0x43, 0x05, 0x20, 0xb3, // ."....5.A .BC. .
+	0x82, 0x97, 0x22, 0x4f, 0x03, 0xb8, 0x85, 0x97, 0x21, 0x17, 0x11, 0x5f, 0x75, 0x0e, 0x20, 0x03, // .."O....!.._u. .
+	0x65, 0x55, 0x03, 0x5f, 0x79, 0x05, 0x21, 0x3f, 0x01, 0x4e, 0x84, 0x04, 0x20, 0x1f, 0x5b, 0x8e, // eU._y.!?.N.. .[.
+	0x03, 0x84, 0x07, 0x20, 0x05, 0x83, 0x17, 0x08, 0x25, 0xda, 0x02, 0x75, 0x08, 0x07, 0x08, 0x13, // ... ....%..u....
+	0x0a, 0xfd, 0xf3, 0x0b, 0x13, 0x08, 0x07, 0x07, 0x23, 0x05, 0x10, 0x0a, 0x7f, 0x05, 0x03, 0x02, // ........#.......
+	0x05, 0x05, 0x11, 0x0b, 0x98, 0x0a, 0x13, 0x0a, 0x09, 0x0c, 0x03, 0x06, 0x7f, 0x0a, 0x15, 0x83, // ................
+	0x07, 0x23, 0x27, 0xfd, 0xa1, 0x27, 0x83, 0x18, 0x23, 0x02, 0x0f, 0xfd, 0xf1, 0x83, 0x2b, 0x20, // .#'..'..#.....+ 
+	0x08, 0x83, 0x37, 0x27, 0x0b, 0x02, 0xff, 0x0a, 0x0d, 0x03, 0x22, 0x18, 0x82, 0xb9, 0x08, 0x21, // ..7'......"....!
+	0x0a, 0x0d, 0x02, 0x29, 0x03, 0x04, 0x06, 0x04, 0x0f, 0x0b, 0x19, 0x21, 0x03, 0x02, 0x06, 0x05, // ...).......!....
+	0x10, 0x0b, 0x95, 0xa3, 0x95, 0x0b, 0x13, 0x09, 0x00, 0x01, 0x00, 0x36, 0xff, 0xf7, 0x03, 0xfa, // ...........6....
+	0x03, 0x7c, 0x56, 0x89, 0x03, 0x20, 0x13, 0x4d, 0xe6, 0x03, 0x21, 0x1e, 0x01, 0x66, 0xd3, 0x03, // .|V.. .M..!..f..
+	0x20, 0x16, 0x83, 0x95, 0x82, 0x02, 0x4d, 0xb8, 0x03, 0x21, 0x2e, 0x01, 0x5f, 0x7e, 0x03, 0x20, //  .....M..!.._~. 
+	0x17, 0x4f, 0x18, 0x05, 0x4f, 0x2d, 0x03, 0x57, 0x7f, 0x04, 0x24, 0x07, 0x1f, 0x01, 0x01, 0x17, // .O..O-.W..$.....
+	0x83, 0xb9, 0x23, 0x03, 0x2f, 0x02, 0x0f, 0x4e, 0x07, 0x03, 0x22, 0x35, 0x2e, 0x02, 0x82, 0xdd, // ..#./..N.."5....
+	0x31, 0x03, 0x0f, 0x01, 0x5a, 0x23, 0x01, 0x1a, 0x18, 0x05, 0x20, 0x1f, 0x1e, 0x4b, 0x5a, 0x6a, // 1...Z#.... ..KZj
+	0x3c, 0x0a, 0x12, 0x82, 0x8a, 0x23, 0x01, 0x09, 0x07, 0x01, 0x54, 0x28, 0x03, 0x08, 0x4b, 0x11, // <....#....T(..K.
 	0x0b, 0x32, 0x4b, 0x19, 0x02, 0x19, 0x06, 0x12, 0x17, 0x50, 0x39, 0x01, 0x28, 0x45, 0x1d, 0x28, // .2K......P9.(E.(
 	0x39, 0x10, 0x07, 0x08, 0x02, 0x02, 0x17, 0x01, 0xc6, 0x24, 0x09, 0x10, 0x06, 0x0c, 0x02, 0x07, // 9........$......
 	0x15, 0x18, 0x19, 0x72, 0x1f, 0x46, 0x26, 0x27, 0x4f, 0x51, 0x52, 0x2b, 0x28, 0x4a, 0x43, 0x3c, // ...r.F&'OQR+(JC<
 	0x1a, 0x05, 0x02, 0xc0, 0x3f, 0x04, 0x33, 0x67, 0x68, 0x69, 0x35, 0x38, 0x54, 0x3a, 0x1e, 0x02, // ....?.3ghi58T:..
-	0x01, 0x05, 0x07, 0x07, 0x11, 0x0a, 0x3b, 0x57, 0x1c, 0x09, 0x11, 0x08, 0x07, 0x08, 0x04, 0x2e, // ......;W........
-	0x2b, 0x02, 0x29, 0x51, 0x29, 0x38, 0x3b, 0x03, 0x01, 0x1c, 0x1d, 0x17, 0x25, 0x0f, 0x05, 0x0e, // +.)Q)8;.....%...
-	0x09, 0x20, 0x19, 0xfe, 0xf9, 0x05, 0x01, 0x08, 0x08, 0x20, 0x02, 0x15, 0x1c, 0x15, 0x07, 0x07, // . ....... ......
-	0x41, 0x29, 0x40, 0x16, 0x02, 0x17, 0x1e, 0x0c, 0x04, 0x0b, 0x09, 0x21, 0x2e, 0x3b, 0x24, 0x05, // A)@........!.;$.
-	0x00, 0x01, 0x00, 0x06, 0xff, 0xf7, 0x03, 0xca, 0x03, 0x7c, 0x00, 0x4d, 0x00, 0x00, 0x01, 0x1f, // .........|.M....
-	0x01, 0x1e, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x03, 0x07, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, // ..........&'..'.
-	0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x3e, 0x01, 0x37, 0x07, 0x3e, 0x01, 0x27, 0x2e, // .7>.7>.3>.7.>.'.
-	0x01, 0x27, 0x23, 0x26, 0x06, 0x07, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x0f, 0x01, 0x01, 0x07, // .'#&............
-	0x2e, 0x01, 0x2f, 0x01, 0x13, 0x3f, 0x03, 0x1f, 0x01, 0x3e, 0x01, 0x37, 0x35, 0x3e, 0x02, 0x16, // ../..?...>.75>..
-	0x17, 0x1e, 0x03, 0x1f, 0x01, 0x03, 0xa6, 0x23, 0x01, 0x1a, 0x17, 0x04, 0x21, 0x1e, 0x1e, 0x4b, // .......#....!..K
-	0x5b, 0x69, 0x3c, 0x0a, 0x12, 0x08, 0x07, 0x08, 0x01, 0x09, 0x07, 0x01, 0x01, 0x07, 0x05, 0x07, // [i<.............
-	0x11, 0x0b, 0x31, 0x4c, 0x19, 0x02, 0x19, 0x06, 0x12, 0x17, 0x50, 0x39, 0x01, 0x28, 0x45, 0x1d, // ..1L......P9.(E.
-	0x28, 0x39, 0x10, 0x07, 0x08, 0x01, 0x01, 0x17, 0xfe, 0x3a, 0x24, 0x09, 0x10, 0x06, 0x0c, 0x02, // (9.......:$.....
-	0x07, 0x13, 0x02, 0x18, 0x19, 0x72, 0x1f, 0x46, 0x26, 0x27, 0x4f, 0x51, 0x52, 0x2a, 0x29, 0x4a, // .....r.F&'OQR*)J
-	0x43, 0x3c, 0x1a, 0x05, 0x02, 0xc0, 0x3f, 0x04, 0x33, 0x67, 0x68, 0x69, 0x35, 0x38, 0x54, 0x3a, // C<....?.3ghi58T:
-	0x1e, 0x02, 0x01, 0x05, 0x07, 0x07, 0x11, 0x0a, 0x3b, 0x57, 0x1c, 0x09, 0x11, 0x08, 0x07, 0x08, // ........;W......
-	0x04, 0x2e, 0x2b, 0x02, 0x29, 0x51, 0x29, 0x38, 0x3b, 0x03, 0x01, 0x1c, 0x1d, 0x17, 0x25, 0x0f, // ..+.)Q)8;.....%.
-	0x05, 0x0e, 0x09, 0x20, 0x19, 0xfe, 0xf9, 0x05, 0x01, 0x08, 0x08, 0x20, 0x02, 0x15, 0x1c, 0x13, // ... ....... ....
-	0x02, 0x07, 0x07, 0x41, 0x29, 0x40, 0x16, 0x02, 0x17, 0x1e, 0x0c, 0x04, 0x0b, 0x09, 0x21, 0x2e, // ...A)@........!.
-	0x3b, 0x24, 0x05, 0x00, 0x00, 0x02, 0x00, 0x56, 0xff, 0xc6, 0x03, 0xaa, 0x03, 0xba, 0x00, 0x1c, // ;$.....V........
-	0x00, 0x3e, 0x00, 0x00, 0x05, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, // .>........#!"&'.
-	0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, // .=.467>.3!2.....
-	0x01, 0x03, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // .......+.......+
-	0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, // ."&'..=.#"&'..=.
-	0x09, 0x01, 0x15, 0x03, 0xaa, 0x08, 0x08, 0x08, 0x13, 0x0a, 0xfd, 0x16, 0x0b, 0x13, 0x08, 0x07, // ................
-	0x08, 0x08, 0x07, 0x08, 0x13, 0x0b, 0x02, 0xea, 0x0a, 0x13, 0x08, 0x08, 0x08, 0x35, 0x08, 0x08, // .............5..
-	0x08, 0x14, 0x0b, 0x9e, 0x08, 0x08, 0x08, 0x14, 0x0b, 0xd3, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x9f, // ................
-	0x0c, 0x13, 0x08, 0x07, 0x08, 0x01, 0x75, 0x01, 0x75, 0x04, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x08, // ......u.u.......
-	0x07, 0x08, 0x13, 0x0c, 0x69, 0x0b, 0x13, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x12, 0x0b, 0x6a, // ....i..........j
-	0x02, 0x14, 0x0b, 0x14, 0x08, 0x07, 0x07, 0xd5, 0x0c, 0x13, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, // ................
-	0x13, 0x0c, 0xd5, 0x07, 0x07, 0x08, 0x14, 0x0b, 0x35, 0x01, 0x75, 0xfe, 0x8b, 0x35, 0x00, 0x00, // ........5.u..5..
-	0x00, 0x02, 0x00, 0x56, 0xff, 0xc6, 0x03, 0xaa, 0x03, 0xba, 0x00, 0x1c, 0x00, 0x3e, 0x00, 0x00, // ...V.........>..
-	0x17, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, // ...=.467>.3!2...
-	0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x01, 0x1e, 0x01, // ........#!"&'...
-	0x1d, 0x01, 0x09, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, // ....5467>.;.5467
-	0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x33, 0x1e, 0x01, 0x17, 0x65, // >.;.2......3...e
-	0x07, 0x08, 0x08, 0x07, 0x08, 0x13, 0x0b, 0x02, 0xea, 0x0a, 0x13, 0x08, 0x08, 0x08, 0x08, 0x08, // ................
-	0x08, 0x13, 0x0a, 0xfd, 0x16, 0x0b, 0x13, 0x08, 0x03, 0x00, 0x08, 0x08, 0xfe, 0x8b, 0xfe, 0x8b, // ................
-	0x08, 0x07, 0x08, 0x13, 0x0c, 0x9f, 0x08, 0x07, 0x08, 0x13, 0x0c, 0xd3, 0x0b, 0x14, 0x08, 0x08, // ................
-	0x08, 0x9e, 0x0b, 0x14, 0x08, 0x2b, 0x08, 0x13, 0x0c, 0x69, 0x0b, 0x13, 0x08, 0x08, 0x08, 0x08, // .....+...i......
-	0x08, 0x08, 0x12, 0x0b, 0x6a, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x08, 0x07, 0x02, 0xcc, 0x08, 0x13, // ....j...........
-	0x0c, 0x35, 0xfe, 0x8c, 0x01, 0x74, 0x35, 0x0c, 0x13, 0x08, 0x07, 0x07, 0xd5, 0x0c, 0x13, 0x08, // .5...t5.........
-	0x07, 0x08, 0x08, 0x07, 0x08, 0x13, 0x0c, 0xd4, 0x01, 0x07, 0x07, 0x00, 0x00, 0x02, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x00, 0x13, 0x32, 0x16, 0x17, // .......,.6...2..
-	0x1e, 0x01, 0x1d, 0x01, 0x21, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, // ....!5467>.;.2..
-	0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, // .........#!"&'..
-	0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x25, 0x15, 0x23, 0x35, 0x23, 0x35, 0x37, // 5.467>.;.%.#5#57
-	0x17, 0x15, 0x23, 0xc4, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x01, 0xfa, 0x08, 0x09, 0x0a, 0x17, 0x0d, // ..#.............
-	0x7e, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, 0x17, 0x09, // ~...............
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x01, 0xba, 0xfc, 0x7f, 0xfd, 0xfd, 0x7f, 0x01, // .......~........
-	0xc0, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0xbe, 0xbc, 0x0e, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, // ................
-	0x17, 0x0c, 0xfe, 0x85, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x01, 0x79, // ...............y
-	0x0e, 0x17, 0x09, 0x0a, 0x09, 0x7e, 0xfc, 0xfc, 0x7f, 0xfd, 0xfd, 0x7f, 0x00, 0x02, 0x00, 0x06, // .....~..........
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x2c, 0x00, 0x36, 0x00, 0x00, 0x01, 0x15, 0x21, 0x35, // .......,.6....!5
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, // 467>.;.2........
-	0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, // ...#!"&'..5.467>
-	0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x01, 0x15, 0x07, 0x27, 0x35, 0x33, 0x35, // .;.2........'535
-	0x33, 0x15, 0x33, 0x01, 0x03, 0x01, 0xfa, 0x08, 0x09, 0x0a, 0x17, 0x0d, 0x7e, 0x0d, 0x16, 0x0a, // 3.3.........~...
-	0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, // ................
-	0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x01, 0xfa, 0xfd, 0xfd, 0x7f, 0xfc, 0x7f, // ...~............
-	0x01, 0x81, 0xbe, 0xbc, 0x0e, 0x17, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0xfe, 0x85, // ................
-	0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x01, 0x79, 0x0e, 0x17, 0x09, 0x0a, // ...........y....
-	0x09, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0x01, 0x3c, 0x7f, 0xfc, 0xfc, 0x7f, 0xfd, 0xfd, 0x00, 0x00, // .......<........
-	0x00, 0x01, 0x00, 0x06, 0x00, 0xc7, 0x03, 0xfa, 0x02, 0xfe, 0x00, 0x25, 0x00, 0x00, 0x01, 0x1e, // ...........%....
-	0x01, 0x17, 0x1e, 0x01, 0x15, 0x0f, 0x02, 0x0e, 0x01, 0x22, 0x26, 0x2f, 0x02, 0x2e, 0x01, 0x35, // ........."&/...5
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, // 467>.7>.7>.32...
-	0x01, 0x17, 0x02, 0xfd, 0x2f, 0x52, 0x23, 0x2c, 0x2d, 0x08, 0x07, 0x0f, 0x80, 0xf5, 0xea, 0xde, // ..../R#,-.......
-	0x6a, 0x0b, 0x08, 0x0e, 0x0e, 0x1b, 0x1a, 0x13, 0x2a, 0x17, 0x05, 0x2f, 0x2a, 0x2f, 0x74, 0x44, // j.......*../*/tD
-	0x43, 0x73, 0x30, 0x16, 0x21, 0x0c, 0x02, 0x42, 0x07, 0x2a, 0x23, 0x2b, 0x6a, 0x3f, 0x42, 0x0d, // Cs0.!..B.*#+j?B.
-	0x04, 0x23, 0x22, 0x22, 0x23, 0x02, 0x07, 0x15, 0x30, 0x1a, 0x25, 0x3f, 0x1a, 0x12, 0x18, 0x06, // .#""#...0.%?....
-	0x38, 0x62, 0x29, 0x2f, 0x2f, 0x2f, 0x2f, 0x16, 0x2e, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, // 8b)////.........
-	0x00, 0x82, 0x03, 0xfa, 0x02, 0xfe, 0x00, 0x38, 0x00, 0x00, 0x25, 0x0e, 0x03, 0x07, 0x35, 0x33, // .......8..%...53
-	0x3f, 0x01, 0x35, 0x27, 0x07, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x33, 0x15, 0x06, 0x2e, 0x02, 0x2f, // ?.5'......3..../
-	0x02, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, // ...5467>.7>.7>.3
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x15, 0x0f, 0x02, 0x03, 0xdc, // 2...............
-	0x29, 0x50, 0x4f, 0x4d, 0x27, 0x4a, 0x12, 0x07, 0xad, 0xac, 0x03, 0x04, 0x11, 0x4a, 0x3e, 0x78, // )POM'J.......J>x
-	0x76, 0x73, 0x38, 0x0b, 0x08, 0x0e, 0x0e, 0x1b, 0x1a, 0x13, 0x2a, 0x17, 0x05, 0x2f, 0x2a, 0x2f, // vs8.......*../*/
-	0x74, 0x44, 0x43, 0x73, 0x30, 0x16, 0x21, 0x0c, 0x2f, 0x52, 0x23, 0x2c, 0x2d, 0x08, 0x07, 0x0f, // tDCs0.!./R#,-...
-	0xc7, 0x0b, 0x12, 0x0f, 0x0b, 0x04, 0xcf, 0x06, 0x13, 0x18, 0xad, 0xad, 0x18, 0x06, 0x09, 0x04, // ................
-	0x06, 0xd9, 0x01, 0x08, 0x11, 0x1b, 0x12, 0x02, 0x08, 0x15, 0x2f, 0x1b, 0x25, 0x3f, 0x1a, 0x12, // ........../.%?..
-	0x18, 0x06, 0x38, 0x61, 0x2a, 0x2e, 0x2f, 0x2f, 0x2e, 0x16, 0x2f, 0x19, 0x08, 0x29, 0x23, 0x2c, // ..8a*.//../..)#,
-	0x6a, 0x3e, 0x43, 0x0c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x94, 0x03, 0xfa, // j>C.............
-	0x02, 0xfe, 0x00, 0x25, 0x00, 0x35, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, // ...%.5.....'..'.
-	0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, // .#".............
-	0x1f, 0x02, 0x1e, 0x01, 0x32, 0x36, 0x3f, 0x03, 0x34, 0x26, 0x27, 0x0f, 0x01, 0x27, 0x35, 0x34, // ....26?.4&'..'54
-	0x36, 0x3f, 0x01, 0x33, 0x35, 0x33, 0x17, 0x33, 0x1f, 0x01, 0x15, 0x03, 0xa1, 0x23, 0x52, 0x2f, // 6?.353.3.....#R/
-	0x0c, 0x21, 0x16, 0x30, 0x73, 0x43, 0x44, 0x74, 0x2f, 0x2a, 0x2f, 0x05, 0x17, 0x2a, 0x13, 0x1a, // .!.0sCDt/*/..*..
-	0x1b, 0x0e, 0x0e, 0x08, 0x0b, 0x6a, 0xde, 0xea, 0xf5, 0x80, 0x0f, 0x07, 0x08, 0x2d, 0x2c, 0xa2, // .....j.......-,.
-	0xad, 0xac, 0x04, 0x03, 0x12, 0x4a, 0x93, 0x01, 0x49, 0x12, 0x07, 0x01, 0xef, 0x22, 0x2a, 0x07, // .....J..I...."*.
-	0x1a, 0x2f, 0x15, 0x2f, 0x2f, 0x2f, 0x2f, 0x29, 0x61, 0x39, 0x06, 0x18, 0x12, 0x1a, 0x3f, 0x25, // ././///)a9....?%
-	0x1a, 0x30, 0x15, 0x07, 0x02, 0x23, 0x22, 0x22, 0x23, 0x04, 0x0d, 0x42, 0x3f, 0x6a, 0x2c, 0xae, // .0...#""#..B?j,.
-	0xad, 0xad, 0x18, 0x06, 0x09, 0x04, 0x06, 0xda, 0xda, 0x06, 0x13, 0x18, 0x00, 0x02, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1f, 0x00, 0x4a, 0x00, 0x00, 0x01, 0x22, 0x06, 0x0f, // .........J..."..
-	0x01, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x3b, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x33, // .........;.7>.73
-	0x3e, 0x01, 0x3f, 0x01, 0x35, 0x34, 0x26, 0x27, 0x35, 0x2e, 0x01, 0x23, 0x35, 0x32, 0x16, 0x17, // >.?.54&'5..#52..
-	0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x14, 0x06, 0x07, 0x0e, 0x01, // ................
-	0x23, 0x22, 0x26, 0x2f, 0x01, 0x30, 0x06, 0x07, 0x0e, 0x01, 0x31, 0x22, 0x26, 0x27, 0x2e, 0x01, // #"&/.0....1"&'..
-	0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x01, 0x8b, 0x35, 0x5c, 0x26, 0x01, 0x25, 0x24, 0x25, // 5467>.3..5.&.%$%
-	0x25, 0x25, 0x5a, 0x35, 0x03, 0x49, 0x1e, 0x36, 0x17, 0x02, 0x17, 0x21, 0x09, 0x09, 0x26, 0x24, // %%Z5.I.6...!..&$
-	0x25, 0x5b, 0x36, 0x52, 0x8a, 0x38, 0x39, 0x38, 0x07, 0x07, 0x1f, 0xf1, 0x12, 0x13, 0x01, 0x12, // %[6R.898........
-	0x12, 0x12, 0x2b, 0x19, 0x1a, 0x2c, 0x11, 0xf0, 0x1b, 0x20, 0x1f, 0x54, 0x51, 0x8a, 0x3a, 0x38, // ..+..,... .TQ.:8
-	0x38, 0x38, 0x38, 0x3b, 0x8a, 0x50, 0x03, 0x35, 0x25, 0x24, 0x02, 0x25, 0x5c, 0x36, 0x35, 0x5a, // 888;.P.5%$.%.65Z
-	0x25, 0x24, 0x26, 0x09, 0x09, 0x21, 0x17, 0x18, 0x34, 0x1e, 0x4a, 0x05, 0x35, 0x59, 0x24, 0x02, // %$&..!..4.J.5Y$.
-	0x24, 0x25, 0x85, 0x39, 0x39, 0x39, 0x8a, 0x52, 0x1e, 0x39, 0x1a, 0x3b, 0xf1, 0x12, 0x2b, 0x19, // $%.999.R.9.;..+.
-	0x19, 0x2b, 0x12, 0x12, 0x12, 0x12, 0x12, 0xf0, 0x11, 0x0b, 0x0a, 0x04, 0x38, 0x39, 0x39, 0x89, // .+..........899.
-	0x50, 0x51, 0x8b, 0x39, 0x39, 0x39, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // PQ.999..........
-	0x03, 0xba, 0x00, 0x09, 0x00, 0x0d, 0x00, 0x2d, 0x00, 0x58, 0x00, 0x00, 0x01, 0x35, 0x33, 0x15, // .......-.X...53.
-	0x33, 0x15, 0x23, 0x15, 0x23, 0x35, 0x31, 0x23, 0x35, 0x33, 0x37, 0x22, 0x06, 0x0f, 0x01, 0x0e, // 3.#.#51#537"....
-	0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x3b, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x33, 0x3e, 0x01, // .......;.7>.73>.
-	0x3f, 0x01, 0x35, 0x34, 0x26, 0x27, 0x35, 0x2e, 0x01, 0x23, 0x35, 0x32, 0x16, 0x17, 0x1e, 0x01, // ?.54&'5..#52....
-	0x15, 0x14, 0x06, 0x0f, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, // ..............#"
-	0x26, 0x2f, 0x01, 0x30, 0x06, 0x07, 0x0e, 0x01, 0x31, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, // &/.0....1"&'..54
-	0x36, 0x37, 0x3e, 0x01, 0x33, 0x01, 0x4d, 0x80, 0x60, 0x60, 0x80, 0x60, 0x60, 0x3e, 0x35, 0x5c, // 67>.3.M.``.``>5.
-	0x26, 0x01, 0x25, 0x24, 0x25, 0x25, 0x25, 0x5a, 0x35, 0x03, 0x49, 0x1e, 0x36, 0x17, 0x02, 0x17, // &.%$%%%Z5.I.6...
-	0x21, 0x09, 0x09, 0x26, 0x24, 0x26, 0x5a, 0x36, 0x52, 0x8a, 0x38, 0x39, 0x38, 0x07, 0x07, 0x1f, // !..&$&Z6R.898...
-	0xf1, 0x12, 0x13, 0x01, 0x12, 0x12, 0x12, 0x2b, 0x19, 0x1a, 0x2c, 0x11, 0xf0, 0x1b, 0x20, 0x1f, // .......+..,... .
-	0x54, 0x51, 0x8a, 0x3a, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x8a, 0x50, 0x02, 0x70, 0x60, 0x60, 0x80, // TQ.:8888;.P.p``.
-	0x60, 0x60, 0x80, 0xc5, 0x25, 0x24, 0x02, 0x25, 0x5c, 0x36, 0x35, 0x5a, 0x25, 0x24, 0x26, 0x09, // ``..%$.%.65Z%$&.
+	0x01, 0x05, 0x07, 0x07, 0x11, 0x0a, 0x3b, 0x57, 0x1c, 0x09, 0x11, 0x82, 0x56, 0x08, 0x31, 0x04, // ......;W....V.1.
+	0x2e, 0x2b, 0x02, 0x29, 0x51, 0x29, 0x38, 0x3b, 0x03, 0x01, 0x1c, 0x1d, 0x17, 0x25, 0x0f, 0x05, // .+.)Q)8;.....%..
+	0x0e, 0x09, 0x20, 0x19, 0xfe, 0xf9, 0x05, 0x01, 0x08, 0x08, 0x20, 0x02, 0x15, 0x1c, 0x15, 0x07, // .. ....... .....
+	0x07, 0x41, 0x29, 0x40, 0x16, 0x02, 0x17, 0x1e, 0x0c, 0x04, 0x0b, 0x09, 0x21, 0x2e, 0x3b, 0x24, // .A)@........!.;$
+	0x05, 0x44, 0x37, 0x04, 0x22, 0xf7, 0x03, 0xca, 0x82, 0xef, 0x22, 0x4d, 0x00, 0x00, 0x5b, 0x7a, // .D7."....."M..[z
+	0x04, 0x5b, 0xcc, 0x04, 0x21, 0x07, 0x06, 0x50, 0xce, 0x04, 0x66, 0xec, 0x07, 0x54, 0x21, 0x03, // .[..!..P..f..T!.
+	0x20, 0x07, 0x85, 0xfc, 0x23, 0x23, 0x26, 0x06, 0x07, 0x41, 0x12, 0x03, 0x22, 0x01, 0x17, 0x0f, //  ...##&..A.."...
+	0x82, 0xc2, 0x26, 0x2e, 0x01, 0x2f, 0x01, 0x13, 0x3f, 0x03, 0x65, 0xad, 0x04, 0x25, 0x35, 0x3e, // ..&../..?.e..%5>
+	0x02, 0x16, 0x17, 0x1e, 0x82, 0x0b, 0x21, 0x03, 0xa6, 0x82, 0xf0, 0x27, 0x17, 0x04, 0x21, 0x1e, // ......!....'..!.
+	0x1e, 0x4b, 0x5b, 0x69, 0x8f, 0xf0, 0x21, 0x31, 0x4c, 0x90, 0xf0, 0x24, 0x01, 0x01, 0x17, 0xfe, // .K[i..!1L..$....
+	0x3a, 0x86, 0xf0, 0x21, 0x13, 0x02, 0x89, 0xf1, 0x21, 0x2a, 0x29, 0xbf, 0xf1, 0x21, 0x13, 0x02, // :..!....!*)..!..
+	0x92, 0xf2, 0x27, 0x00, 0x02, 0x00, 0x56, 0xff, 0xc6, 0x03, 0xaa, 0x44, 0x1f, 0x04, 0x23, 0x3e, // ..'...V....D..#>
+	0x00, 0x00, 0x05, 0x46, 0xe7, 0x1b, 0x20, 0x03, 0x5a, 0xcf, 0x1b, 0x28, 0x3d, 0x01, 0x09, 0x01, // ...F.. .Z..(=...
+	0x15, 0x03, 0xaa, 0x08, 0x08, 0x42, 0x93, 0x03, 0x20, 0x16, 0x42, 0x67, 0x0a, 0x22, 0xea, 0x0a, // .....B.. .Bg."..
+	0x13, 0x82, 0x14, 0x20, 0x35, 0x82, 0x03, 0x22, 0x14, 0x0b, 0x9e, 0x84, 0x05, 0x21, 0xd3, 0x0c, // ... 5..".....!..
+	0x83, 0x1d, 0x20, 0x9f, 0x84, 0x05, 0x25, 0x01, 0x75, 0x01, 0x75, 0x04, 0x0c, 0x87, 0x2d, 0x21, // .. ...%.u.u...-!
+	0x0c, 0x69, 0x82, 0x38, 0x84, 0x00, 0x2a, 0x12, 0x0b, 0x6a, 0x02, 0x14, 0x0b, 0x14, 0x08, 0x07, // .i.8..*..j......
+	0x07, 0xd5, 0x83, 0x1d, 0x82, 0x00, 0x82, 0x1d, 0x20, 0xd5, 0x82, 0x05, 0x28, 0x14, 0x0b, 0x35, // ........ ...(..5
+	0x01, 0x75, 0xfe, 0x8b, 0x35, 0x00, 0x90, 0xbb, 0x20, 0x17, 0x47, 0xdd, 0x20, 0x21, 0x09, 0x01, // .u..5... .G. !..
+	0x43, 0xe4, 0x16, 0x52, 0xc1, 0x03, 0x20, 0x65, 0x8d, 0xb0, 0x89, 0xc8, 0x27, 0x03, 0x00, 0x08, // C..R.. e....'...
+	0x08, 0xfe, 0x8b, 0xfe, 0x8b, 0x84, 0xa0, 0x20, 0x9f, 0x84, 0x05, 0x20, 0xd3, 0x59, 0xbe, 0x03, // ....... ... .Y..
+	0x21, 0x08, 0x9e, 0x82, 0x05, 0x20, 0x2b, 0x8e, 0xb4, 0x86, 0xca, 0x21, 0x02, 0xcc, 0x82, 0x17, // !.... +....!....
+	0x25, 0x35, 0xfe, 0x8c, 0x01, 0x74, 0x35, 0x84, 0xbe, 0x20, 0xd5, 0x89, 0xe2, 0x23, 0xd4, 0x01, // %5...t5.. ...#..
+	0x07, 0x07, 0x6a, 0x2f, 0x0d, 0x23, 0x36, 0x00, 0x00, 0x13, 0x44, 0x85, 0x0f, 0x51, 0x37, 0x19, // ..j/.#6...D..Q7.
+	0x2c, 0x3b, 0x01, 0x25, 0x15, 0x23, 0x35, 0x23, 0x35, 0x37, 0x17, 0x15, 0x23, 0xc4, 0x45, 0x63, // ,;.%.#5#57..#.Ec
+	0x05, 0x20, 0xfa, 0x47, 0x49, 0x0a, 0x45, 0x0b, 0x10, 0x29, 0x7e, 0x01, 0xba, 0xfc, 0x7f, 0xfd, // . .GI.E..)~.....
+	0xfd, 0x7f, 0x01, 0xc0, 0x45, 0x47, 0x04, 0x21, 0xbe, 0xbc, 0x46, 0x3e, 0x10, 0x45, 0x6b, 0x0b, // ....EG.!..F>.Ek.
+	0x21, 0x7e, 0xfc, 0x84, 0x2c, 0x8f, 0x9f, 0x21, 0x01, 0x15, 0xa4, 0x99, 0x46, 0x45, 0x06, 0x2a, // !~..,..!....FE.*
+	0x15, 0x07, 0x27, 0x35, 0x33, 0x35, 0x33, 0x15, 0x33, 0x01, 0x03, 0x9e, 0x9b, 0x86, 0xbf, 0x82, // ..'5353.3.......
+	0x71, 0x23, 0xfc, 0x7f, 0x01, 0x81, 0x9e, 0x9b, 0x46, 0x07, 0x05, 0x21, 0x3c, 0x7f, 0x84, 0xa2, // q#......F..!<...
+	0x5c, 0x67, 0x05, 0x25, 0x00, 0xc7, 0x03, 0xfa, 0x02, 0xfe, 0x53, 0xad, 0x03, 0x44, 0x9b, 0x04, // .g.%......S..D..
+	0x21, 0x01, 0x15, 0x67, 0x7a, 0x03, 0x23, 0x22, 0x26, 0x2f, 0x02, 0x50, 0xb5, 0x07, 0x20, 0x37, // !..gz.#"&/.P.. 7
+	0x58, 0xf9, 0x0a, 0x08, 0x42, 0x17, 0x02, 0xfd, 0x2f, 0x52, 0x23, 0x2c, 0x2d, 0x08, 0x07, 0x0f, // X...B.../R#,-...
+	0x80, 0xf5, 0xea, 0xde, 0x6a, 0x0b, 0x08, 0x0e, 0x0e, 0x1b, 0x1a, 0x13, 0x2a, 0x17, 0x05, 0x2f, // ....j.......*../
+	0x2a, 0x2f, 0x74, 0x44, 0x43, 0x73, 0x30, 0x16, 0x21, 0x0c, 0x02, 0x42, 0x07, 0x2a, 0x23, 0x2b, // */tDCs0.!..B.*#+
+	0x6a, 0x3f, 0x42, 0x0d, 0x04, 0x23, 0x22, 0x22, 0x23, 0x02, 0x07, 0x15, 0x30, 0x1a, 0x25, 0x3f, // j?B..#""#...0.%?
+	0x1a, 0x12, 0x18, 0x06, 0x38, 0x62, 0x29, 0x2f, 0x82, 0x00, 0x22, 0x16, 0x2e, 0x1a, 0x86, 0x7b, // ....8b)/.."....{
+	0x20, 0x82, 0x84, 0x7b, 0x37, 0x38, 0x00, 0x00, 0x25, 0x0e, 0x03, 0x07, 0x35, 0x33, 0x3f, 0x01, //  ..{78..%...53?.
+	0x35, 0x27, 0x07, 0x15, 0x14, 0x16, 0x1f, 0x01, 0x33, 0x15, 0x06, 0x2e, 0x02, 0x96, 0x83, 0x87, // 5'......3.......
+	0xa6, 0x34, 0x03, 0xdc, 0x29, 0x50, 0x4f, 0x4d, 0x27, 0x4a, 0x12, 0x07, 0xad, 0xac, 0x03, 0x04, // .4..)POM'J......
+	0x11, 0x4a, 0x3e, 0x78, 0x76, 0x73, 0x38, 0x94, 0x91, 0x87, 0xb3, 0x3b, 0xc7, 0x0b, 0x12, 0x0f, // .J>xvs8....;....
+	0x0b, 0x04, 0xcf, 0x06, 0x13, 0x18, 0xad, 0xad, 0x18, 0x06, 0x09, 0x04, 0x06, 0xd9, 0x01, 0x08, // ................
+	0x11, 0x1b, 0x12, 0x02, 0x08, 0x15, 0x2f, 0x1b, 0x86, 0xa1, 0x31, 0x61, 0x2a, 0x2e, 0x2f, 0x2f, // ....../...1a*.//
+	0x2e, 0x16, 0x2f, 0x19, 0x08, 0x29, 0x23, 0x2c, 0x6a, 0x3e, 0x43, 0x0c, 0x05, 0x48, 0xaf, 0x06, // ../..)#,j>C..H..
+	0x21, 0x00, 0x94, 0x41, 0x27, 0x06, 0x20, 0x35, 0x5d, 0x2f, 0x06, 0x45, 0xb9, 0x04, 0x60, 0xae, // !..A'. 5]/.E..`.
+	0x06, 0x5d, 0x31, 0x05, 0x2e, 0x16, 0x1f, 0x02, 0x1e, 0x01, 0x32, 0x36, 0x3f, 0x03, 0x34, 0x26, // .]1.......26?.4&
+	0x27, 0x0f, 0x01, 0x27, 0x60, 0x93, 0x04, 0x34, 0x33, 0x35, 0x33, 0x17, 0x33, 0x1f, 0x01, 0x15, // '..'`..4353.3...
+	0x03, 0xa1, 0x23, 0x52, 0x2f, 0x0c, 0x21, 0x16, 0x30, 0x73, 0x43, 0x44, 0x74, 0x82, 0x9a, 0x08, // ..#R/.!.0sCDt...
+	0x27, 0x05, 0x17, 0x2a, 0x13, 0x1a, 0x1b, 0x0e, 0x0e, 0x08, 0x0b, 0x6a, 0xde, 0xea, 0xf5, 0x80, // '..*.......j....
+	0x0f, 0x07, 0x08, 0x2d, 0x2c, 0xa2, 0xad, 0xac, 0x04, 0x03, 0x12, 0x4a, 0x93, 0x01, 0x49, 0x12, // ...-,......J..I.
+	0x07, 0x01, 0xef, 0x22, 0x2a, 0x07, 0x1a, 0x2f, 0x15, 0x41, 0x2f, 0x03, 0x2d, 0x29, 0x61, 0x39, // ..."*../.A/.-)a9
+	0x06, 0x18, 0x12, 0x1a, 0x3f, 0x25, 0x1a, 0x30, 0x15, 0x07, 0x02, 0x41, 0x53, 0x03, 0x26, 0x04, // ....?%.0...AS.&.
+	0x0d, 0x42, 0x3f, 0x6a, 0x2c, 0xae, 0x86, 0xc5, 0x21, 0xda, 0xda, 0x82, 0xd1, 0x64, 0x13, 0x0c, // .B?j,...!....d..
+	0x20, 0x4a, 0x57, 0xa1, 0x03, 0x55, 0x71, 0x04, 0x52, 0x69, 0x05, 0x20, 0x3b, 0x46, 0x5c, 0x05, //  JW..Uq.Ri. ;F..
+	0x46, 0x4f, 0x03, 0x52, 0x6e, 0x03, 0x20, 0x35, 0x82, 0xb9, 0x20, 0x35, 0x53, 0x37, 0x07, 0x62, // FO.Rn. 5.. 5S7.b
+	0x19, 0x04, 0x20, 0x17, 0x52, 0xac, 0x07, 0x22, 0x2f, 0x01, 0x30, 0x83, 0x09, 0x20, 0x31, 0x52, // .. .R.."/.0.. 1R
+	0xb6, 0x0b, 0x27, 0x01, 0x8b, 0x35, 0x5c, 0x26, 0x01, 0x25, 0x24, 0x52, 0x77, 0x03, 0x3d, 0x35, // ..'..5.&.%$Rw.=5
+	0x03, 0x49, 0x1e, 0x36, 0x17, 0x02, 0x17, 0x21, 0x09, 0x09, 0x26, 0x24, 0x25, 0x5b, 0x36, 0x52, // .I.6...!..&$%[6R
+	0x8a, 0x38, 0x39, 0x38, 0x07, 0x07, 0x1f, 0xf1, 0x12, 0x13, 0x01, 0x12, 0x12, 0x65, 0xc6, 0x04, // .898.........e..
+	0x29, 0x11, 0xf0, 0x1b, 0x20, 0x1f, 0x54, 0x51, 0x8a, 0x3a, 0x38, 0x82, 0x00, 0x08, 0x29, 0x3b, // )... .TQ.:8...);
+	0x8a, 0x50, 0x03, 0x35, 0x25, 0x24, 0x02, 0x25, 0x5c, 0x36, 0x35, 0x5a, 0x25, 0x24, 0x26, 0x09, // .P.5%$.%.65Z%$&.
 	0x09, 0x21, 0x17, 0x18, 0x34, 0x1e, 0x4a, 0x05, 0x35, 0x59, 0x24, 0x02, 0x24, 0x25, 0x85, 0x39, // .!..4.J.5Y$.$%.9
-	0x39, 0x39, 0x8a, 0x52, 0x1e, 0x39, 0x1a, 0x3b, 0xf1, 0x12, 0x2b, 0x19, 0x19, 0x2b, 0x12, 0x12, // 99.R.9.;..+..+..
-	0x12, 0x12, 0x12, 0xf0, 0x11, 0x0b, 0x0a, 0x04, 0x38, 0x39, 0x39, 0x89, 0x50, 0x51, 0x8b, 0x39, // ........899.PQ.9
-	0x39, 0x39, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x04, // 99..............
-	0x00, 0x24, 0x00, 0x4f, 0x00, 0x00, 0x01, 0x21, 0x35, 0x21, 0x15, 0x03, 0x22, 0x06, 0x0f, 0x01, // .$.O...!5!.."...
-	0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x3b, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x33, 0x3e, // ........;.7>.73>
-	0x01, 0x3f, 0x01, 0x35, 0x34, 0x26, 0x27, 0x35, 0x2e, 0x01, 0x23, 0x35, 0x32, 0x16, 0x17, 0x1e, // .?.54&'5..#52...
-	0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, // ...............#
-	0x22, 0x26, 0x2f, 0x01, 0x30, 0x06, 0x07, 0x0e, 0x01, 0x31, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, // "&/.0....1"&'..5
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x02, 0x2f, 0xfe, 0xbc, 0x01, 0x44, 0xa4, 0x35, 0x5c, 0x26, // 467>.3./...D.5.&
-	0x01, 0x25, 0x24, 0x25, 0x25, 0x25, 0x5a, 0x35, 0x03, 0x49, 0x1e, 0x36, 0x17, 0x02, 0x17, 0x21, // .%$%%%Z5.I.6...!
-	0x09, 0x09, 0x26, 0x24, 0x26, 0x5a, 0x36, 0x52, 0x8a, 0x38, 0x39, 0x38, 0x07, 0x07, 0x1f, 0xf1, // ..&$&Z6R.898....
-	0x12, 0x13, 0x01, 0x12, 0x12, 0x12, 0x2b, 0x19, 0x1a, 0x2c, 0x11, 0xf0, 0x1b, 0x20, 0x1f, 0x54, // ......+..,... .T
-	0x51, 0x8a, 0x3a, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x8a, 0x50, 0x01, 0xf1, 0x81, 0x81, 0x01, 0x44, // Q.:8888;.P.....D
-	0x25, 0x24, 0x02, 0x25, 0x5c, 0x36, 0x35, 0x5a, 0x25, 0x24, 0x26, 0x09, 0x09, 0x21, 0x17, 0x18, // %$.%.65Z%$&..!..
-	0x34, 0x1e, 0x4a, 0x05, 0x35, 0x59, 0x24, 0x02, 0x24, 0x25, 0x85, 0x39, 0x39, 0x39, 0x8a, 0x52, // 4.J.5Y$.$%.999.R
-	0x1e, 0x39, 0x1a, 0x3b, 0xf1, 0x12, 0x2b, 0x19, 0x19, 0x2b, 0x12, 0x12, 0x12, 0x12, 0x12, 0xf0, // .9.;..+..+......
-	0x11, 0x0b, 0x0a, 0x04, 0x38, 0x39, 0x39, 0x89, 0x50, 0x51, 0x8b, 0x39, 0x39, 0x39, 0x00, 0x00, // ....899.PQ.999..
-	0x00, 0x04, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1f, 0x00, 0x4a, 0x00, 0x4f, // .............J.O
-	0x00, 0x54, 0x00, 0x00, 0x01, 0x22, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, // .T..."..........
-	0x01, 0x3b, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x33, 0x3e, 0x01, 0x3f, 0x01, 0x35, 0x34, 0x26, 0x27, // .;.7>.73>.?.54&'
-	0x35, 0x2e, 0x01, 0x23, 0x35, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x17, // 5..#52..........
-	0x1e, 0x01, 0x17, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x30, 0x06, 0x07, // ........#"&/.0..
-	0x0e, 0x01, 0x31, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x13, // ..1"&'..5467>.3.
-	0x21, 0x35, 0x21, 0x15, 0x15, 0x21, 0x35, 0x21, 0x15, 0x01, 0x8b, 0x35, 0x5c, 0x26, 0x01, 0x25, // !5!..!5!...5.&.%
-	0x24, 0x25, 0x25, 0x25, 0x5a, 0x35, 0x03, 0x49, 0x1e, 0x36, 0x17, 0x02, 0x17, 0x21, 0x09, 0x09, // $%%%Z5.I.6...!..
-	0x26, 0x24, 0x26, 0x5a, 0x36, 0x52, 0x8a, 0x38, 0x39, 0x38, 0x07, 0x07, 0x1f, 0xf1, 0x12, 0x13, // &$&Z6R.898......
-	0x01, 0x12, 0x12, 0x12, 0x2b, 0x19, 0x1a, 0x2c, 0x11, 0xf0, 0x1b, 0x20, 0x1f, 0x54, 0x51, 0x8a, // ....+..,... .TQ.
-	0x3a, 0x38, 0x38, 0x38, 0x38, 0x3b, 0x8a, 0x50, 0xa4, 0xfe, 0xbc, 0x01, 0x44, 0xfe, 0xbc, 0x01, // :8888;.P....D...
-	0x44, 0x03, 0x35, 0x25, 0x24, 0x02, 0x25, 0x5c, 0x36, 0x35, 0x5a, 0x25, 0x24, 0x26, 0x09, 0x09, // D.5%$.%.65Z%$&..
-	0x21, 0x17, 0x18, 0x34, 0x1e, 0x4a, 0x05, 0x35, 0x59, 0x24, 0x02, 0x24, 0x25, 0x85, 0x39, 0x39, // !..4.J.5Y$.$%.99
-	0x39, 0x8a, 0x52, 0x1e, 0x39, 0x1a, 0x3b, 0xf1, 0x12, 0x2b, 0x19, 0x19, 0x2b, 0x12, 0x12, 0x12, // 9.R.9.;..+..+...
-	0x12, 0x12, 0xf0, 0x11, 0x0b, 0x0a, 0x04, 0x38, 0x39, 0x39, 0x89, 0x50, 0x51, 0x8b, 0x39, 0x39, // .......899.PQ.99
-	0x39, 0xfe, 0xa0, 0x61, 0x61, 0xa2, 0x61, 0x61, 0x00, 0x03, 0x00, 0x56, 0xff, 0xc7, 0x03, 0xaa, // 9..aa.aa...V....
-	0x03, 0x1a, 0x00, 0x08, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x00, 0x25, 0x33, 0x35, 0x23, 0x15, 0x33, // .....)....%35#.3
-	0x15, 0x33, 0x35, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, // .35.......#!"&'.
-	0x01, 0x35, 0x11, 0x33, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, // .5.35467>.3!2...
-	0x01, 0x1d, 0x01, 0x33, 0x27, 0x21, 0x15, 0x21, 0x35, 0x02, 0x35, 0x35, 0xd4, 0x35, 0x6a, 0x01, // ...3'!.!5.55.5j.
-	0x75, 0x08, 0x08, 0x08, 0x13, 0x0a, 0xfd, 0x16, 0x0b, 0x13, 0x08, 0x07, 0x08, 0x6b, 0x0f, 0x0f, // u............k..
-	0x10, 0x26, 0x16, 0x01, 0xaa, 0x16, 0x25, 0x0f, 0x10, 0x10, 0x6b, 0xd5, 0xfe, 0x56, 0x01, 0xaa, // .&....%...k..V..
-	0x9b, 0x6b, 0x6b, 0x6a, 0x6a, 0x01, 0x40, 0xfe, 0x21, 0x0b, 0x14, 0x08, 0x07, 0x07, 0x07, 0x07, // .kkjj.@.!.......
-	0x08, 0x14, 0x0b, 0x01, 0xdf, 0xd5, 0x16, 0x25, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x25, 0x15, // .......%......%.
-	0xd5, 0xd5, 0xd5, 0xd5, 0x00, 0x03, 0x00, 0x56, 0xff, 0xc6, 0x03, 0xaa, 0x03, 0xba, 0x00, 0x08, // .......V........
-	0x00, 0x0d, 0x00, 0x32, 0x00, 0x00, 0x25, 0x35, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x13, // ...2..%5#.3.353.
-	0x35, 0x33, 0x15, 0x23, 0x37, 0x15, 0x23, 0x35, 0x21, 0x11, 0x21, 0x11, 0x14, 0x06, 0x07, 0x0e, // 53.#7.#5!.!.....
-	0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x33, 0x11, 0x34, 0x36, 0x37, 0x3e, // .#!"&'..5.3.467>
-	0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x02, 0x6a, 0xd4, 0x35, 0x6a, 0x35, 0x6b, // .3!2......j.5j5k
-	0x6a, 0x6a, 0x6a, 0x6a, 0xfe, 0x56, 0x02, 0x7f, 0x08, 0x08, 0x08, 0x13, 0x0a, 0xfd, 0x16, 0x0b, // jjjj.V..........
-	0x13, 0x08, 0x07, 0x08, 0x6b, 0x0f, 0x0f, 0x10, 0x26, 0x16, 0x01, 0xaa, 0x16, 0x25, 0x0f, 0x10, // ....k...&....%..
-	0x10, 0x9b, 0x6b, 0x6b, 0x6a, 0x6a, 0x01, 0xfa, 0x4e, 0x4e, 0xba, 0x6a, 0x6a, 0xfe, 0x8c, 0xfe, // ..kkjj..NN.jj...
-	0x21, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x13, 0x0c, 0x01, 0xdf, 0x01, 0x74, 0x16, // !.............t.
-	0x25, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x26, 0x15, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x46, // %......&.......F
-	0xff, 0xc6, 0x03, 0xba, 0x03, 0xba, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x17, 0x1e, 0x03, // ................
-	0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x3e, 0x02, // ......#"&'..54>.
-	0x37, 0x3e, 0x01, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, // 7>.7..5467>.32..
-	0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x02, 0xa9, 0x27, 0x48, 0x21, 0x20, 0x31, 0x20, 0x10, 0x40, // ........'H! 1 .@
-	0x41, 0x40, 0x9d, 0x5c, 0x5c, 0x9c, 0x41, 0x40, 0x41, 0x10, 0x20, 0x31, 0x20, 0x21, 0x47, 0x28, // A@....A@A. 1 !G(
-	0x21, 0x21, 0x22, 0x23, 0x22, 0x53, 0x31, 0x32, 0x53, 0x22, 0x23, 0x23, 0x22, 0x22, 0x02, 0x36, // !!"#"S12S"##"".6
-	0x10, 0x2f, 0x1f, 0x1f, 0x46, 0x4b, 0x53, 0x2d, 0x2f, 0x50, 0x20, 0x21, 0x22, 0x22, 0x21, 0x20, // ./..FKS-/P !""! 
-	0x50, 0x2f, 0x2d, 0x53, 0x4b, 0x46, 0x1f, 0x1f, 0x2f, 0x11, 0x21, 0x4f, 0x2e, 0x2f, 0x51, 0x21, // P/-SKF../.!O./Q!
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x50, 0x2f, 0x2e, 0x4f, 0x22, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, // """""P/.O"......
-	0x00, 0x65, 0x03, 0xfa, 0x03, 0x1b, 0x00, 0x2c, 0x00, 0x55, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x1f, // .e.....,.U......
-	0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, // ..........#"&'..
-	0x27, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, // '467>.7..5467>.3
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x37, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, // 2........7467>.3
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x15, 0x14, // 2...............
-	0x06, 0x07, 0x0e, 0x01, 0x23, 0x27, 0x3e, 0x01, 0x27, 0x34, 0x26, 0x27, 0x3e, 0x01, 0x37, 0x2e, // ....#'>.'4&'>.7.
-	0x01, 0x35, 0x01, 0x99, 0x1a, 0x30, 0x16, 0x07, 0x27, 0x27, 0x27, 0x27, 0x07, 0x2b, 0x67, 0x3d, // .5...0..''''.+g=
-	0x3c, 0x68, 0x2a, 0x2a, 0x2b, 0x01, 0x2b, 0x2b, 0x15, 0x2f, 0x1a, 0x16, 0x16, 0x17, 0x17, 0x17, // <h**+.++./......
-	0x37, 0x20, 0x21, 0x37, 0x17, 0x17, 0x16, 0x16, 0x17, 0xa1, 0x17, 0x17, 0x17, 0x37, 0x20, 0x20, // 7 !7.........7  
-	0x38, 0x17, 0x16, 0x17, 0x17, 0x16, 0x1a, 0x30, 0x15, 0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x68, 0x3c, // 8......0.++++*h<
-	0x95, 0x26, 0x24, 0x03, 0x2f, 0x2e, 0x0e, 0x1e, 0x10, 0x17, 0x16, 0x02, 0x11, 0x0b, 0x20, 0x16, // .&$./......... .
-	0x07, 0x2a, 0x65, 0x3a, 0x1f, 0x35, 0x15, 0x05, 0x16, 0x17, 0x17, 0x16, 0x16, 0x37, 0x21, 0x3d, // .*e:.5.......7!=
-	0x68, 0x2b, 0x16, 0x20, 0x0b, 0x16, 0x36, 0x20, 0x21, 0x38, 0x16, 0x18, 0x17, 0x17, 0x18, 0x16, // h+. ..6 !8......
-	0x38, 0x21, 0x20, 0x36, 0x16, 0x6c, 0x21, 0x38, 0x16, 0x18, 0x17, 0x17, 0x18, 0x16, 0x38, 0x21, // 8! 6.l!8......8!
-	0x20, 0x36, 0x16, 0x0b, 0x20, 0x16, 0x2b, 0x68, 0x3d, 0x21, 0x37, 0x16, 0x16, 0x17, 0x15, 0x1c, //  6.. .+h=!7.....
-	0x43, 0x27, 0x45, 0x78, 0x33, 0x0a, 0x10, 0x07, 0x16, 0x36, 0x20, 0x00, 0x00, 0x03, 0x00, 0x06, // C'Ex3....6 .....
-	0x00, 0x66, 0x03, 0xfa, 0x03, 0x1a, 0x00, 0x2b, 0x00, 0x5a, 0x00, 0x84, 0x00, 0x00, 0x01, 0x0e, // .f.....+.Z......
-	0x01, 0x15, 0x14, 0x16, 0x17, 0x07, 0x1f, 0x01, 0x0e, 0x01, 0x07, 0x15, 0x0e, 0x01, 0x1d, 0x01, // ................
-	0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x2e, 0x01, 0x35, // ..'..'5467>.7..5
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x05, 0x1e, 0x01, 0x17, 0x1e, 0x01, // 467>.32.........
-	0x1d, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x35, 0x34, // .......#"&'..'54
-	0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, // 67>.?...5467>.32
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x17, 0x3f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, // .........?.>.32.
-	0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, // ................
-	0x07, 0x0e, 0x01, 0x07, 0x35, 0x34, 0x26, 0x27, 0x35, 0x27, 0x3f, 0x01, 0x27, 0x3e, 0x01, 0x35, // ....54&'5'?.'>.5
-	0x34, 0x26, 0x27, 0x01, 0x3c, 0x08, 0x08, 0x05, 0x05, 0x04, 0x07, 0x06, 0x0e, 0x19, 0x0c, 0x33, // 4&'.<..........3
-	0x33, 0x1b, 0x2f, 0x15, 0x20, 0x20, 0x01, 0x21, 0x20, 0x0f, 0x23, 0x14, 0x11, 0x10, 0x10, 0x11, // 3./.  .! .#.....
-	0x11, 0x2a, 0x18, 0x18, 0x29, 0x11, 0x0a, 0x01, 0x4a, 0x13, 0x23, 0x10, 0x2b, 0x2b, 0x03, 0x2b, // .*..)...J.#.++.+
-	0x28, 0x2a, 0x65, 0x3c, 0x3c, 0x67, 0x2a, 0x28, 0x2a, 0x02, 0x2a, 0x2a, 0x10, 0x24, 0x12, 0x18, // (*e<<g*(*.**.$..
-	0x16, 0x16, 0x17, 0x17, 0x16, 0x37, 0x20, 0x20, 0x37, 0x17, 0x16, 0x16, 0x16, 0x15, 0x16, 0x40, // .....7  7......@
-	0x0a, 0x11, 0x29, 0x18, 0x18, 0x29, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x24, 0x10, 0x1f, 0x20, // ..)..)......$.. 
-	0x20, 0x1f, 0x15, 0x30, 0x1a, 0x34, 0x33, 0x33, 0x08, 0x05, 0x04, 0x05, 0x05, 0x07, 0x08, 0x02, //  ..0.433........
-	0xd0, 0x13, 0x2a, 0x17, 0x11, 0x20, 0x10, 0x03, 0x04, 0x10, 0x09, 0x15, 0x0c, 0x01, 0x33, 0x7d, // ..*.. ........3}
-	0x48, 0x05, 0x03, 0x10, 0x0c, 0x10, 0x28, 0x18, 0x01, 0x2d, 0x4d, 0x20, 0x11, 0x19, 0x08, 0x11, // H.....(..-M ....
-	0x29, 0x17, 0x18, 0x2a, 0x11, 0x11, 0x12, 0x12, 0x11, 0x0c, 0xcb, 0x0a, 0x1b, 0x10, 0x2b, 0x68, // )..*..........+h
-	0x3c, 0x09, 0x1e, 0x32, 0x15, 0x16, 0x17, 0x17, 0x16, 0x15, 0x32, 0x1e, 0x09, 0x3c, 0x68, 0x2b, // <..2......2..<h+
-	0x10, 0x1b, 0x0a, 0x0b, 0x17, 0x35, 0x20, 0x20, 0x38, 0x17, 0x17, 0x18, 0x18, 0x17, 0x17, 0x38, // .....5  8......8
-	0x20, 0x20, 0x36, 0x16, 0x0b, 0xcb, 0x0c, 0x11, 0x12, 0x12, 0x11, 0x11, 0x2a, 0x18, 0x17, 0x29, //   6.........*..)
-	0x11, 0x08, 0x19, 0x11, 0x20, 0x4d, 0x2d, 0x01, 0x18, 0x28, 0x10, 0x0c, 0x10, 0x03, 0x05, 0x48, // .... M-..(.....H
-	0x7d, 0x33, 0x01, 0x2a, 0x11, 0x03, 0x02, 0x10, 0x21, 0x11, 0x17, 0x2a, 0x13, 0x00, 0x00, 0x00, // }3.*....!..*....
-	0x00, 0x02, 0x00, 0x06, 0xff, 0xf7, 0x03, 0xfa, 0x03, 0x89, 0x00, 0x23, 0x00, 0x38, 0x00, 0x00, // ...........#.8..
-	0x01, 0x07, 0x01, 0x07, 0x23, 0x2f, 0x01, 0x35, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, // ....#/.5#"&'..5.
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, // 467>.;.5467>.;.2
-	0x16, 0x17, 0x01, 0x17, 0x13, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, // ..............#!
-	0x35, 0x21, 0x11, 0x21, 0x35, 0x21, 0x32, 0x16, 0x17, 0x03, 0x15, 0x0a, 0xfe, 0xba, 0x17, 0x82, // 5!.!5!2.........
-	0x17, 0x0a, 0xe4, 0x07, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x07, 0xe4, 0x05, 0x05, // ................
-	0x05, 0x0b, 0x07, 0x82, 0x07, 0x0b, 0x05, 0x01, 0x47, 0x09, 0xd3, 0x09, 0x09, 0x09, 0x09, 0x0a, // ........G.......
-	0x18, 0x0e, 0xfe, 0xba, 0x01, 0x05, 0xfe, 0xfb, 0x01, 0x46, 0x0e, 0x18, 0x0a, 0x01, 0xc0, 0x17, // .........F......
-	0xfe, 0xba, 0x0a, 0x0a, 0x17, 0xa3, 0x05, 0x05, 0x05, 0x0b, 0x07, 0x01, 0x04, 0x07, 0x0b, 0x05, // ................
-	0x05, 0x05, 0xa3, 0x07, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfe, 0xba, 0x17, 0x01, 0xb5, 0x0a, // ................
-	0x17, 0x0e, 0xfc, 0xf3, 0x0e, 0x18, 0x0a, 0x09, 0x09, 0x83, 0x02, 0x8c, 0x83, 0x0a, 0x0a, 0x00, // ................
-	0x00, 0x02, 0x00, 0x06, 0xff, 0xf7, 0x03, 0xfa, 0x03, 0x89, 0x00, 0x23, 0x00, 0x38, 0x00, 0x00, // ...........#.8..
-	0x13, 0x37, 0x01, 0x37, 0x33, 0x1f, 0x01, 0x15, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, // .7.73...32......
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, // .....+.......+."
-	0x26, 0x27, 0x01, 0x27, 0x03, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, // &'.'...5.467>.3!
-	0x15, 0x21, 0x11, 0x21, 0x15, 0x21, 0x22, 0x26, 0x27, 0xeb, 0x0a, 0x01, 0x46, 0x17, 0x82, 0x17, // .!.!.!"&'...F...
-	0x0a, 0xe4, 0x07, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x0b, 0x07, 0xe4, 0x05, 0x05, 0x05, // ................
-	0x0b, 0x07, 0x82, 0x07, 0x0b, 0x05, 0xfe, 0xba, 0x0a, 0xd3, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x18, // ................
-	0x0e, 0x01, 0x46, 0xfe, 0xfb, 0x01, 0x05, 0xfe, 0xba, 0x0e, 0x18, 0x0a, 0x01, 0xc0, 0x17, 0x01, // ..F.............
-	0x46, 0x0a, 0x0a, 0x17, 0xa3, 0x05, 0x05, 0x05, 0x0b, 0x07, 0xfe, 0xfc, 0x07, 0x0b, 0x05, 0x05, // F...............
-	0x05, 0xa3, 0x07, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0x01, 0x46, 0x17, 0xfe, 0x4b, 0x0a, 0x17, // ..........F..K..
-	0x0e, 0x03, 0x0d, 0x0e, 0x18, 0x0a, 0x09, 0x09, 0x83, 0xfd, 0x74, 0x83, 0x0a, 0x0a, 0x00, 0x00, // ..........t.....
-	0x00, 0x02, 0x00, 0x06, 0xff, 0xf7, 0x03, 0xfa, 0x03, 0x89, 0x00, 0x14, 0x00, 0x38, 0x00, 0x00, // .............8..
-	0x01, 0x21, 0x11, 0x21, 0x15, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, // .!.!.!"&'..5.467
-	0x3e, 0x01, 0x33, 0x21, 0x15, 0x01, 0x07, 0x01, 0x07, 0x23, 0x2f, 0x01, 0x35, 0x23, 0x22, 0x26, // >.3!.....#/.5#"&
-	0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, // '..5.467>.;.5467
-	0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x01, 0x17, 0x01, 0x8e, 0xfe, 0xfb, 0x01, 0x05, 0xfe, // >.;.2...........
-	0xba, 0x0e, 0x18, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x18, 0x0e, 0x01, 0x46, 0x02, 0x6c, 0x0a, // ............F.l.
-	0xfe, 0xba, 0x17, 0x83, 0x17, 0x09, 0xe5, 0x06, 0x0c, 0x04, 0x05, 0x05, 0x05, 0x05, 0x04, 0x0c, // ................
-	0x06, 0xe5, 0x05, 0x04, 0x05, 0x0c, 0x06, 0x83, 0x06, 0x0c, 0x05, 0x01, 0x46, 0x0a, 0x03, 0x06, // ............F...
-	0xfd, 0x74, 0x83, 0x09, 0x09, 0x0a, 0x18, 0x0e, 0x03, 0x0d, 0x0e, 0x17, 0x0a, 0x0a, 0x0a, 0x83, // .t..............
-	0xfe, 0xba, 0x17, 0xfe, 0xba, 0x0a, 0x0a, 0x17, 0xa3, 0x05, 0x05, 0x05, 0x0b, 0x07, 0x01, 0x04, // ................
-	0x07, 0x0b, 0x05, 0x05, 0x05, 0xa3, 0x07, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x05, 0xfe, 0xba, 0x17, // ................
-	0x00, 0x02, 0x00, 0x06, 0xff, 0xf7, 0x03, 0xfa, 0x03, 0x89, 0x00, 0x14, 0x00, 0x36, 0x00, 0x00, // .............6..
-	0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x35, 0x21, 0x11, 0x21, // ..........#!5!.!
-	0x35, 0x21, 0x32, 0x16, 0x17, 0x03, 0x17, 0x11, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x0f, 0x01, // 5!2........+....
-	0x23, 0x27, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, // #'...5467.>.;.2.
-	0x1f, 0x01, 0x15, 0x33, 0x32, 0x16, 0x17, 0x03, 0xe8, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x18, 0x0e, // ...32...........
-	0xfe, 0xba, 0x01, 0x05, 0xfe, 0xfb, 0x01, 0x46, 0x0e, 0x18, 0x0a, 0xdd, 0x0a, 0x0a, 0x04, 0x0c, // .......F........
-	0x06, 0xe5, 0x09, 0x17, 0x83, 0x17, 0xfe, 0xba, 0x05, 0x05, 0x05, 0x05, 0x01, 0x46, 0x05, 0x0c, // .............F..
-	0x06, 0x83, 0x06, 0x0c, 0x05, 0x09, 0xe5, 0x06, 0x0c, 0x04, 0x03, 0x75, 0x0a, 0x17, 0x0e, 0xfc, // ...........u....
-	0xf3, 0x0e, 0x18, 0x0a, 0x09, 0x09, 0x83, 0x02, 0x8c, 0x83, 0x0a, 0x0a, 0xfe, 0xe4, 0x17, 0xfe, // ................
-	0xfc, 0x17, 0x05, 0x05, 0xa3, 0x17, 0x0a, 0x0a, 0x01, 0x46, 0x05, 0x0b, 0x07, 0x07, 0x0b, 0x05, // .........F......
-	0x01, 0x46, 0x05, 0x05, 0x05, 0x05, 0x17, 0xa3, 0x05, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, // .F.............`
-	0xff, 0xc6, 0x03, 0xa0, 0x03, 0xba, 0x00, 0x21, 0x00, 0x00, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, // .......!........
-	0x01, 0x2b, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, // .+.......+."&'..
-	0x35, 0x11, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x09, 0x01, 0x03, 0xa0, 0x09, 0x08, // 5.#"&'..=.......
-	0x09, 0x16, 0x0d, 0xb1, 0x08, 0x09, 0x09, 0x16, 0x0d, 0xec, 0x0d, 0x15, 0x09, 0x08, 0x08, 0xb3, // ................
-	0x0d, 0x15, 0x09, 0x08, 0x08, 0x01, 0xa0, 0x01, 0xa0, 0x02, 0x19, 0x3b, 0x0d, 0x15, 0x09, 0x09, // ...........;....
-	0x08, 0xfe, 0x60, 0x0d, 0x15, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x15, 0x0d, 0x01, 0xa0, 0x08, // ..`.............
-	0x09, 0x09, 0x15, 0x0d, 0x3b, 0x01, 0xa1, 0xfe, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, // ....;..._.......
-	0x00, 0x20, 0x03, 0xfa, 0x03, 0x60, 0x00, 0x21, 0x00, 0x00, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, // . ...`.!...467>.
-	0x3b, 0x01, 0x09, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x21, 0x22, 0x26, 0x27, // ;...#"&'..=.!"&'
-	0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x35, 0x01, 0xe2, 0x08, 0x09, // ..=.467>.3!5....
-	0x09, 0x15, 0x0d, 0x3b, 0x01, 0xa1, 0xfe, 0x5f, 0x3b, 0x0d, 0x15, 0x09, 0x09, 0x08, 0xfe, 0x60, // ...;..._;......`
-	0x0d, 0x15, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x15, 0x0d, 0x01, 0xa0, 0x03, 0x23, 0x0d, 0x16, // .............#..
-	0x09, 0x08, 0x09, 0xfe, 0x60, 0xfe, 0x60, 0x08, 0x08, 0x09, 0x15, 0x0d, 0xb3, 0x08, 0x08, 0x09, // ....`.`.........
-	0x15, 0x0d, 0xec, 0x0d, 0x16, 0x09, 0x09, 0x08, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x60, // ...............`
-	0xff, 0xc6, 0x03, 0xa0, 0x03, 0xba, 0x00, 0x21, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x1d, 0x01, 0x09, // .......!........
-	0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, // .5467>.;..467>.;
-	0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x33, 0x32, 0x16, 0x17, 0x03, 0x8f, 0x08, 0x09, // .2......32......
-	0xfe, 0x60, 0xfe, 0x60, 0x08, 0x08, 0x09, 0x15, 0x0d, 0xb3, 0x08, 0x08, 0x09, 0x15, 0x0d, 0xec, // .`.`............
-	0x0d, 0x16, 0x09, 0x09, 0x08, 0xb1, 0x0d, 0x16, 0x09, 0x01, 0xcd, 0x09, 0x15, 0x0d, 0x3b, 0xfe, // ..............;.
-	0x5f, 0x01, 0xa1, 0x3b, 0x0d, 0x15, 0x09, 0x09, 0x08, 0x01, 0xa0, 0x0d, 0x15, 0x09, 0x08, 0x09, // _..;............
-	0x09, 0x08, 0x09, 0x15, 0x0d, 0xfe, 0x60, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, // ......`.........
-	0x00, 0x20, 0x03, 0xfa, 0x03, 0x60, 0x00, 0x21, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, // . ...`.!...2....
-	0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // .......#!......+
-	0x01, 0x09, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x21, 0x03, 0xbe, 0x0d, 0x15, // ...32......!....
-	0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x15, 0x0d, 0xfe, 0x60, 0x08, 0x09, 0x09, 0x15, 0x0d, 0x3b, // .........`.....;
-	0xfe, 0x5f, 0x01, 0xa1, 0x3b, 0x0d, 0x15, 0x09, 0x09, 0x08, 0x01, 0xa0, 0x02, 0x72, 0x08, 0x09, // ._..;........r..
-	0x09, 0x16, 0x0c, 0xed, 0x0d, 0x15, 0x09, 0x08, 0x08, 0xb3, 0x0d, 0x15, 0x09, 0x08, 0x08, 0x01, // ................
-	0xa0, 0x01, 0xa0, 0x09, 0x08, 0x09, 0x16, 0x0d, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x21, 0x00, 0x00, 0x09, 0x01, 0x1e, 0x01, 0x17, 0x14, // .......!........
-	0x06, 0x0f, 0x01, 0x0e, 0x01, 0x07, 0x2e, 0x01, 0x27, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x22, 0x26, // ........'....."&
-	0x2f, 0x01, 0x11, 0x21, 0x17, 0x1e, 0x01, 0x15, 0x0e, 0x01, 0x0f, 0x01, 0x02, 0x75, 0x01, 0x6d, // /..!.........u.m
-	0x0b, 0x0c, 0x01, 0x0b, 0x0b, 0xd0, 0x0b, 0x1a, 0x0f, 0x0f, 0x1b, 0x0b, 0xfe, 0x94, 0x9c, 0x0a, // ................
-	0x1b, 0x0f, 0x0f, 0x1a, 0x0b, 0x35, 0x02, 0xda, 0x34, 0x0b, 0x0b, 0x01, 0x0c, 0x0b, 0x9d, 0x02, // .....5..4.......
-	0x81, 0xfe, 0x93, 0x0a, 0x1b, 0x0f, 0x0e, 0x1a, 0x0b, 0xcf, 0x0b, 0x0c, 0x01, 0x01, 0x0c, 0x0b, // ................
-	0x01, 0x6d, 0x9c, 0x0a, 0x0d, 0x02, 0x0b, 0x0b, 0x34, 0x02, 0xda, 0x35, 0x0b, 0x1a, 0x0f, 0x0f, // .m......4..5....
-	0x19, 0x0b, 0x9d, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x21, // ...............!
-	0x00, 0x00, 0x25, 0x2e, 0x01, 0x2f, 0x01, 0x01, 0x0e, 0x01, 0x07, 0x2e, 0x01, 0x2f, 0x01, 0x2e, // ..%../......./..
-	0x01, 0x27, 0x34, 0x36, 0x37, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x3e, 0x01, 0x3f, 0x01, 0x21, 0x11, // .'467.'..'>.?.!.
-	0x07, 0x0e, 0x01, 0x07, 0x03, 0x8f, 0x0f, 0x1a, 0x0b, 0x9d, 0xfe, 0x95, 0x0b, 0x19, 0x0f, 0x0f, // ................
-	0x1a, 0x0b, 0xce, 0x0b, 0x0c, 0x01, 0x0b, 0x0b, 0x01, 0x6b, 0x99, 0x0b, 0x0c, 0x01, 0x01, 0x0c, // .........k......
-	0x0b, 0x32, 0x02, 0xda, 0x35, 0x0b, 0x1b, 0x10, 0x96, 0x01, 0x0d, 0x0b, 0x9c, 0xfe, 0x95, 0x0c, // .2..5...........
-	0x0d, 0x01, 0x01, 0x0d, 0x0c, 0xce, 0x0a, 0x1b, 0x0f, 0x0e, 0x1b, 0x0b, 0x01, 0x6b, 0x9b, 0x0b, // .............k..
-	0x1a, 0x10, 0x10, 0x1b, 0x0b, 0x33, 0xfd, 0x28, 0x33, 0x0b, 0x0d, 0x01, 0x00, 0x01, 0x00, 0x06, // .....3.(3.......
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x21, 0x00, 0x00, 0x13, 0x3e, 0x01, 0x37, 0x32, 0x16, // .......!...>.72.
-	0x17, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x1e, 0x01, 0x1f, 0x01, 0x11, 0x21, 0x27, 0x2e, 0x01, 0x27, // ..7>.7.....!'..'
-	0x3e, 0x01, 0x3f, 0x01, 0x01, 0x2e, 0x01, 0x27, 0x3e, 0x01, 0x3f, 0x01, 0xec, 0x0b, 0x1a, 0x0f, // >.?....'>.?.....
-	0x0f, 0x1b, 0x0a, 0x01, 0x6b, 0x9c, 0x0b, 0x1a, 0x0f, 0x10, 0x1b, 0x0b, 0x35, 0xfd, 0x26, 0x32, // ....k.......5.&2
-	0x0b, 0x0c, 0x01, 0x01, 0x0c, 0x0b, 0x9b, 0xfe, 0x95, 0x0b, 0x0c, 0x01, 0x01, 0x0c, 0x0b, 0xce, // ................
-	0x03, 0xa2, 0x0b, 0x0c, 0x01, 0x0b, 0x0b, 0xfe, 0x93, 0x9b, 0x0b, 0x0c, 0x01, 0x01, 0x0c, 0x0b, // ................
-	0x34, 0xfd, 0x28, 0x35, 0x0b, 0x1a, 0x0f, 0x0f, 0x1c, 0x0b, 0x9c, 0x01, 0x6c, 0x0b, 0x19, 0x0d, // 4.(5........l...
-	0x10, 0x1b, 0x0b, 0xce, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x21, // ...............!
-	0x00, 0x00, 0x01, 0x14, 0x06, 0x07, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x0e, 0x01, 0x0f, 0x01, 0x21, // ...............!
-	0x11, 0x37, 0x3e, 0x01, 0x37, 0x1e, 0x01, 0x1f, 0x01, 0x01, 0x3e, 0x01, 0x37, 0x1e, 0x01, 0x1f, // .7>.7.....>.7...
-	0x01, 0x1e, 0x01, 0x17, 0x03, 0xfa, 0x0c, 0x0c, 0xfe, 0x95, 0x9a, 0x0b, 0x0b, 0x01, 0x01, 0x0b, // ................
-	0x0b, 0x33, 0xfd, 0x28, 0x33, 0x0b, 0x1b, 0x10, 0x0f, 0x1b, 0x0b, 0x9d, 0x01, 0x6b, 0x0a, 0x1a, // .3.(3........k..
-	0x0e, 0x0f, 0x1b, 0x0a, 0xce, 0x0b, 0x0d, 0x02, 0x02, 0x9e, 0x0e, 0x1a, 0x0a, 0xfe, 0x93, 0x9c, // ................
-	0x0a, 0x1b, 0x0f, 0x0f, 0x1b, 0x0c, 0x33, 0x02, 0xd8, 0x34, 0x0b, 0x0c, 0x01, 0x01, 0x0c, 0x0b, // ......3..4......
-	0x9d, 0x01, 0x6d, 0x0b, 0x0c, 0x01, 0x01, 0x0c, 0x0b, 0xce, 0x0b, 0x1c, 0x0f, 0x00, 0x00, 0x00, // ..m.............
-	0x00, 0x01, 0x00, 0x06, 0x00, 0x84, 0x03, 0xfa, 0x02, 0xfc, 0x00, 0x11, 0x00, 0x00, 0x25, 0x0e, // ..............%.
-	0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x09, 0x01, 0x15, 0x14, 0x06, 0x07, // .#!"&'..=.......
-	0x03, 0xe7, 0x0a, 0x17, 0x0d, 0xfc, 0x8d, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x01, 0xfa, 0x01, 0xfa, // ................
-	0x0a, 0x09, 0x95, 0x08, 0x09, 0x09, 0x08, 0x0a, 0x17, 0x0d, 0x3f, 0x01, 0xfa, 0xfe, 0x06, 0x3f, // ..........?....?
-	0x0d, 0x17, 0x0a, 0x00, 0x00, 0x01, 0x00, 0xc4, 0xff, 0xc6, 0x03, 0x3c, 0x03, 0xba, 0x00, 0x11, // ...........<....
-	0x00, 0x00, 0x13, 0x3e, 0x01, 0x3b, 0x01, 0x09, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, // ...>.;...#"&'..5
-	0x11, 0x34, 0x36, 0x37, 0xd5, 0x0a, 0x17, 0x0d, 0x3f, 0x01, 0xfa, 0xfe, 0x06, 0x3f, 0x0d, 0x17, // .467....?....?..
-	0x0a, 0x08, 0x09, 0x09, 0x08, 0x03, 0xa7, 0x09, 0x0a, 0xfe, 0x06, 0xfe, 0x06, 0x09, 0x09, 0x09, // ................
-	0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x84, 0x03, 0xfa, // ...s............
-	0x02, 0xfc, 0x00, 0x11, 0x00, 0x00, 0x01, 0x15, 0x09, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, // ..........5467>.
-	0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x03, 0xfa, 0xfe, 0x06, 0xfe, 0x06, 0x09, 0x09, // 3!2.............
-	0x09, 0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x02, 0xbd, 0x3f, 0xfe, 0x06, 0x01, // ....s.......?...
-	0xfa, 0x3f, 0x0d, 0x17, 0x0a, 0x08, 0x09, 0x09, 0x08, 0x0a, 0x17, 0x0d, 0x00, 0x01, 0x00, 0xc4, // .?..............
-	0xff, 0xc6, 0x03, 0x3c, 0x03, 0xba, 0x00, 0x11, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, // ...<............
-	0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x09, 0x01, 0x33, 0x32, 0x16, 0x17, 0x03, 0x2b, 0x08, 0x09, // ....+...32...+..
-	0x09, 0x08, 0x0a, 0x17, 0x0d, 0x3f, 0xfe, 0x06, 0x01, 0xfa, 0x3f, 0x0d, 0x17, 0x0a, 0x03, 0xa7, // .....?....?.....
-	0x0a, 0x17, 0x0d, 0xfc, 0x8d, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x01, 0xfa, 0x01, 0xfa, 0x0a, 0x09, // ................
-	0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x11, 0x00, 0x00, 0x05, 0x09, // ................
-	0x01, 0x23, 0x15, 0x23, 0x35, 0x23, 0x11, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x3b, 0x01, 0x15, 0x33, // .#.#5#......;..3
-	0x02, 0x00, 0x01, 0xfa, 0xfe, 0x06, 0x7e, 0x7f, 0xfd, 0x13, 0x12, 0x13, 0x2d, 0x1a, 0xfd, 0x7e, // ......~.....-..~
-	0x3a, 0x01, 0xfa, 0x01, 0xfa, 0xfd, 0x7e, 0xfe, 0x07, 0x1a, 0x2d, 0x12, 0x13, 0x13, 0xfd, 0x00, // :.....~...-.....
-	0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x11, 0x00, 0x00, 0x09, 0x02, // ................
-	0x23, 0x35, 0x23, 0x15, 0x23, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x33, 0x02, // #5#.#.467>.;.53.
-	0x00, 0x01, 0xfa, 0xfe, 0x06, 0x7e, 0x7f, 0xfd, 0x13, 0x12, 0x13, 0x2d, 0x1a, 0xfd, 0x7e, 0x03, // .....~.....-..~.
-	0xba, 0xfe, 0x06, 0xfe, 0x06, 0xfd, 0x7e, 0x01, 0xf9, 0x1a, 0x2d, 0x12, 0x13, 0x13, 0xfd, 0x00, // ......~...-.....
-	0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x11, 0x00, 0x00, 0x09, 0x02, // ................
-	0x33, 0x35, 0x33, 0x15, 0x33, 0x11, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x2b, 0x01, 0x35, 0x23, 0x02, // 353.3.4&'..+.5#.
-	0x00, 0xfe, 0x06, 0x01, 0xfa, 0x7e, 0x7f, 0xfd, 0x13, 0x12, 0x13, 0x2d, 0x1a, 0xfd, 0x7e, 0x03, // .....~.....-..~.
-	0xba, 0xfe, 0x06, 0xfe, 0x06, 0xfd, 0x7e, 0x01, 0xf9, 0x1a, 0x2d, 0x12, 0x13, 0x13, 0xfd, 0x00, // ......~...-.....
-	0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x11, 0x00, 0x00, 0x05, 0x09, // ................
-	0x01, 0x33, 0x15, 0x33, 0x35, 0x33, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x23, // .3.353......+..#
-	0x02, 0x00, 0xfe, 0x06, 0x01, 0xfa, 0x7e, 0x7f, 0xfd, 0x13, 0x12, 0x13, 0x2d, 0x1a, 0xfd, 0x7e, // ......~.....-..~
-	0x3a, 0x01, 0xfa, 0x01, 0xfa, 0xfd, 0x7e, 0xfe, 0x07, 0x1a, 0x2d, 0x12, 0x13, 0x13, 0xfd, 0x00, // :.....~...-.....
-	0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x18, 0x00, 0x35, 0x00, 0x00, // .............5..
-	0x17, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, // ."&'..5467>.32..
-	0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, // ........#.>.32..
-	0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x01, 0x0e, 0x01, 0x07, 0x2e, 0x01, 0x27, 0x01, 0x2e, // .............'..
-	0x01, 0x27, 0x34, 0x36, 0x37, 0x01, 0x73, 0x17, 0x27, 0x0f, 0x10, 0x10, 0x10, 0x10, 0x0f, 0x27, // .'467.s.'......'
-	0x17, 0x17, 0x26, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x26, 0x17, 0x01, 0x81, 0x09, 0x13, 0x0c, // ..&......&......
-	0x0b, 0x14, 0x08, 0x01, 0xa8, 0x08, 0x07, 0x09, 0x08, 0xfe, 0xa7, 0x09, 0x13, 0x0c, 0x0a, 0x13, // ................
-	0x08, 0xfe, 0x59, 0x08, 0x09, 0x01, 0x08, 0x09, 0x01, 0x59, 0x3a, 0x27, 0x26, 0x25, 0x5b, 0x36, // ..Y......Y:'&%[6
-	0x36, 0x5c, 0x26, 0x25, 0x26, 0x26, 0x25, 0x26, 0x5c, 0x36, 0x36, 0x5b, 0x25, 0x27, 0x26, 0x03, // 6.&%&&%&.66[%'&.
-	0xe3, 0x08, 0x09, 0x08, 0x07, 0xfe, 0x58, 0x08, 0x14, 0x0b, 0x0b, 0x13, 0x08, 0xfe, 0xa6, 0x08, // ......X.........
-	0x09, 0x01, 0x01, 0x09, 0x08, 0x01, 0xa6, 0x08, 0x13, 0x0b, 0x0c, 0x13, 0x09, 0x01, 0x59, 0x00, // ..............Y.
-	0x00, 0x02, 0x00, 0x6c, 0xff, 0xc6, 0x03, 0x95, 0x03, 0xba, 0x00, 0x25, 0x00, 0x2d, 0x00, 0x00, // ...l.......%.-..
-	0x01, 0x2e, 0x01, 0x2f, 0x01, 0x33, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x01, 0x0e, 0x01, 0x07, // .../.3..#"......
-	0x35, 0x0e, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x35, // 5..........32675
-	0x01, 0x37, 0x35, 0x37, 0x35, 0x27, 0x01, 0x2f, 0x01, 0x37, 0x1f, 0x02, 0x07, 0x03, 0x7c, 0x03, // .7575'./.7....|.
-	0x0c, 0x0a, 0x8f, 0x02, 0x0d, 0x1e, 0x12, 0x12, 0x1e, 0x0c, 0xfe, 0x29, 0x08, 0x0a, 0x03, 0x03, // ...........)....
-	0x03, 0x01, 0x18, 0x02, 0x0c, 0x0b, 0x8c, 0x0c, 0x1e, 0x11, 0x12, 0x1f, 0x0d, 0x01, 0xda, 0x14, // ................
-	0x05, 0x19, 0xfd, 0xf2, 0x86, 0x16, 0xd0, 0x17, 0x05, 0x86, 0xd6, 0x02, 0xdf, 0x10, 0x1a, 0x09, // ................
-	0x8e, 0x0d, 0x0d, 0x0d, 0x0d, 0xfe, 0x27, 0x07, 0x11, 0x0a, 0x01, 0x09, 0x13, 0x0a, 0xe1, 0x0f, // ......'.........
-	0x19, 0x0a, 0x8e, 0x0c, 0x0d, 0x0c, 0x0c, 0x01, 0x01, 0xdb, 0x21, 0x02, 0x23, 0x01, 0xde, 0xfd, // ..........!.#...
-	0x4d, 0x87, 0xd2, 0xd1, 0xc1, 0x09, 0x88, 0xd8, 0x00, 0x04, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // M...............
-	0x03, 0xba, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x14, 0x00, 0x00, 0x37, 0x21, 0x11, 0x21, // ............7!.!
-	0x11, 0x01, 0x11, 0x21, 0x11, 0x21, 0x17, 0x05, 0x35, 0x33, 0x15, 0x23, 0x37, 0x21, 0x15, 0x21, // ...!.!..53.#7!.!
-	0x35, 0x85, 0x02, 0xf6, 0xfd, 0x0a, 0x03, 0x75, 0xfc, 0x0c, 0x02, 0xf7, 0xfd, 0xfe, 0x45, 0x7f, // 5......u......E.
-	0x7f, 0xbe, 0xfe, 0x06, 0x01, 0xfa, 0x45, 0x01, 0x7b, 0xfe, 0x85, 0x02, 0x78, 0xfd, 0x09, 0x03, // ......E.{...x...
-	0xf4, 0xfd, 0x3f, 0x7e, 0x7e, 0xbd, 0xfd, 0xfd, 0x00, 0x02, 0x00, 0x46, 0xff, 0xc6, 0x03, 0xba, // ..?~~......F....
-	0x03, 0xba, 0x00, 0x11, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, // .........2......
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x09, 0x01, 0x33, 0x05, 0x34, 0x36, 0x37, 0x3e, 0x01, // .....+...3.467>.
-	0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, // ;.2...........+.
-	0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x03, 0x7b, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, // "&'..5..{.......
-	0x09, 0x17, 0x0e, 0x3f, 0xfe, 0x06, 0x01, 0xfa, 0x3f, 0xfc, 0xcb, 0x09, 0x0a, 0x09, 0x16, 0x0d, // ...?....?.......
-	0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, 0x09, 0x0a, // ~..........~....
-	0x09, 0x03, 0xba, 0x0a, 0x09, 0x0a, 0x17, 0x0d, 0xfc, 0x8d, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x01, // ................
-	0xfa, 0x01, 0xfa, 0x40, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x17, 0x0d, 0xfc, 0x8d, // ...@............
-	0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x74, 0x00, 0x01, 0x00, 0x06, // ...........t....
-	0x00, 0x16, 0x03, 0xfa, 0x03, 0x6a, 0x00, 0x23, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, // .....j.#........
-	0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x09, // ....+........+..
-	0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x01, 0x33, 0x32, 0x16, 0x17, 0x03, 0xeb, // .32.......32....
-	0x07, 0x08, 0x08, 0x07, 0x08, 0x13, 0x0c, 0x35, 0xfe, 0x8c, 0x08, 0x07, 0x08, 0x13, 0x0c, 0x35, // .......5.......5
-	0xfe, 0x56, 0x01, 0xaa, 0x35, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x01, 0x74, 0x35, 0x0c, 0x13, 0x08, // .V..5......t5...
-	0x03, 0x5a, 0x08, 0x13, 0x0c, 0xfd, 0x18, 0x0b, 0x13, 0x08, 0x07, 0x08, 0x01, 0x75, 0xfe, 0xc0, // .Z...........u..
-	0x0b, 0x13, 0x08, 0x07, 0x08, 0x01, 0xaa, 0x01, 0xaa, 0x08, 0x08, 0x08, 0x13, 0x0c, 0xfe, 0xc2, // ................
-	0x01, 0x75, 0x08, 0x08, 0x00, 0x02, 0x00, 0x46, 0xff, 0xc6, 0x03, 0xba, 0x03, 0xba, 0x00, 0x1c, // .u.....F........
-	0x00, 0x39, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, // .9............+.
-	0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, // "&'..5.467>.;.2.
-	0x17, 0x05, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, // ........+."&'..5
-	0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x01, 0xae, // .467>.;.2.......
-	0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0c, 0xfd, 0x0e, 0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, // ................
-	0x17, 0x0e, 0xfd, 0x0c, 0x16, 0x0a, 0x02, 0x0c, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0xfd, 0x0d, 0x17, // ................
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0d, 0xfd, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x03, 0xa7, // ................
-	0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, // ................
-	0x73, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x2d, 0xfc, 0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, // s.......-.......
-	0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, // ......s.........
-	0x0d, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x16, 0x03, 0xfa, 0x03, 0x6a, 0x00, 0x23, // .............j.#
-	0x00, 0x00, 0x13, 0x33, 0x01, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x09, 0x01, 0x23, // ...3..467>.;...#
-	0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, // "&'..5..#"&'..5.
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x3c, 0x35, 0x01, 0x74, 0x08, 0x07, 0x08, 0x13, 0x0c, 0x35, // 467>.3<5.t.....5
-	0x01, 0xaa, 0xfe, 0x56, 0x35, 0x0c, 0x13, 0x08, 0x07, 0x08, 0xfe, 0x8c, 0x35, 0x0c, 0x13, 0x08, // ...V5.......5...
-	0x07, 0x08, 0x08, 0x07, 0x08, 0x13, 0x0c, 0x03, 0x6a, 0xfe, 0x8b, 0x01, 0x3e, 0x0c, 0x13, 0x08, // ........j...>...
-	0x08, 0x08, 0xfe, 0x56, 0xfe, 0x56, 0x08, 0x07, 0x08, 0x13, 0x0b, 0x01, 0x40, 0xfe, 0x8b, 0x08, // ...V.V......@...
-	0x07, 0x08, 0x13, 0x0b, 0x02, 0xe8, 0x0c, 0x13, 0x08, 0x08, 0x08, 0x00, 0x00, 0x01, 0x00, 0x46, // ...............F
-	0xff, 0xc6, 0x03, 0xba, 0x03, 0xba, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, // ................
-	0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x01, 0x23, 0x22, // ....+."&'..5..#"
-	0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x01, 0x11, 0x34, // &'..5.467>.;...4
-	0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x03, 0xa7, 0x0a, 0x09, 0x09, 0x0a, 0x09, // 67>.;.2.........
-	0x16, 0x0d, 0x7e, 0x0e, 0x17, 0x09, 0x09, 0x08, 0xfe, 0x06, 0x3f, 0x0e, 0x17, 0x09, 0x09, 0x08, // ..~.......?.....
-	0x08, 0x09, 0x09, 0x17, 0x0e, 0x3f, 0x01, 0xfa, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x7e, 0x0d, 0x16, // .....?.......~..
-	0x09, 0x03, 0xa7, 0x0a, 0x16, 0x0d, 0xfc, 0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, // ................
-	0x17, 0x0e, 0x01, 0xba, 0xfe, 0x06, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x03, 0x73, 0x0d, 0x17, 0x0a, // ............s...
-	0x09, 0x0a, 0xfe, 0x06, 0x01, 0xb9, 0x0d, 0x17, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x00, 0x00, 0x00, // ................
-	0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x1e, // ................
-	0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, // ........#!"&'..5
-	0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x03, 0xe5, 0x0a, 0x0b, 0x0b, // .467>.3!2.......
-	0x0a, 0x0a, 0x17, 0x0e, 0xfc, 0x94, 0x0f, 0x18, 0x0a, 0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x18, 0x0f, // ................
-	0x03, 0x6c, 0x0e, 0x17, 0x0a, 0x03, 0xa5, 0x0a, 0x17, 0x0e, 0xfc, 0x94, 0x0f, 0x18, 0x0a, 0x09, // .l..............
-	0x0a, 0x0a, 0x09, 0x0a, 0x18, 0x0f, 0x03, 0x6b, 0x0e, 0x18, 0x0a, 0x0a, 0x0b, 0x0b, 0x0a, 0x00, // .......k........
-	0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x26, 0x00, 0x00, 0x01, 0x1e, // ...........&....
-	0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, // ........#"..'..5
-	0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x1f, 0x01, 0x03, 0xa5, 0x2a, 0x2b, // 4>.7>.32......*+
-	0x2b, 0x2a, 0x3f, 0x25, 0x51, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x51, 0x25, 0x25, 0x37, 0x25, // +*?%QZa55aZQ%%7%
-	0x13, 0x13, 0x25, 0x37, 0x25, 0x25, 0x51, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x51, 0x25, 0x3f, // ..%7%%QZa55aZQ%?
-	0x02, 0xda, 0x3d, 0x8d, 0x50, 0x50, 0x8d, 0x3d, 0x4c, 0x25, 0x37, 0x25, 0x13, 0x13, 0x25, 0x37, // ..=.PP.=L%7%..%7
-	0x25, 0x25, 0x51, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x51, 0x25, 0x25, 0x37, 0x25, 0x13, 0x13, // %%QZa55aZQ%%7%..
-	0x25, 0x37, 0x25, 0x4c, 0x00, 0x01, 0x00, 0x88, 0xff, 0xc6, 0x03, 0x78, 0x03, 0xb8, 0x00, 0x27, // %7%L.......x...'
-	0x00, 0x00, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x13, 0x17, 0x0f, 0x03, 0x2e, 0x01, 0x27, 0x03, 0x07, // .............'..
-	0x0e, 0x01, 0x23, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x03, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, // ..#..'..5.467>.7
-	0x36, 0x16, 0x17, 0x01, 0x1e, 0x01, 0x17, 0x07, 0x03, 0x73, 0x07, 0x12, 0x0b, 0x8d, 0x95, 0x08, // 6........s......
-	0x0b, 0x19, 0xd8, 0x2c, 0x0c, 0x12, 0x06, 0xac, 0x73, 0x0a, 0x16, 0x0c, 0x0b, 0x15, 0x09, 0x09, // ...,....s.......
-	0x09, 0x05, 0x09, 0x08, 0x07, 0x12, 0x0b, 0x0c, 0x16, 0x0a, 0x02, 0x73, 0x0a, 0x0e, 0x04, 0x05, // ...........s....
-	0x01, 0xdf, 0x0a, 0x0f, 0x04, 0x35, 0xfe, 0xf6, 0x21, 0x1f, 0x17, 0x62, 0x04, 0x04, 0x0e, 0x09, // .....5..!..b....
-	0x01, 0x09, 0x5e, 0x07, 0x06, 0x01, 0x09, 0x08, 0x09, 0x16, 0x0c, 0x02, 0xc0, 0x0c, 0x14, 0x09, // ..^.............
-	0x08, 0x0a, 0x01, 0x03, 0x04, 0x07, 0xfe, 0x81, 0x06, 0x13, 0x0c, 0x2d, 0x00, 0x01, 0x00, 0x08, // ...........-....
-	0xff, 0xf5, 0x03, 0xea, 0x03, 0x89, 0x00, 0x38, 0x00, 0x00, 0x01, 0x13, 0x16, 0x06, 0x07, 0x0e, // .......8........
-	0x01, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x26, 0x2f, 0x02, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x3f, 0x02, // ......&/...'..?.
-	0x3e, 0x01, 0x3f, 0x01, 0x3e, 0x01, 0x17, 0x03, 0x2e, 0x01, 0x3f, 0x01, 0x3e, 0x01, 0x3f, 0x01, // >.?.>.....?.>.?.
-	0x3e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x33, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x16, // >......3>.7>.76.
-	0x17, 0x03, 0x1a, 0xd0, 0x14, 0x0a, 0x1d, 0x1e, 0x5c, 0x3e, 0x3e, 0x76, 0x37, 0x38, 0x4c, 0x12, // .........>>v78L.
-	0x1d, 0xf4, 0x1b, 0x28, 0x0e, 0x0c, 0x07, 0x04, 0x03, 0x03, 0x04, 0x13, 0x0e, 0x13, 0x17, 0x31, // ...(...........1
-	0x1b, 0xb8, 0x0a, 0x07, 0x03, 0x03, 0x06, 0x1a, 0x14, 0x02, 0x14, 0x2c, 0x17, 0x17, 0x23, 0x0c, // ...........,..#.
-	0x61, 0x01, 0x13, 0x2c, 0x1a, 0x3e, 0x77, 0x39, 0x36, 0x4a, 0x13, 0x02, 0xf3, 0xfe, 0x96, 0x21, // a..,.>w96J.....!
-	0x51, 0x2f, 0x31, 0x55, 0x24, 0x23, 0x25, 0x01, 0x03, 0x1e, 0x20, 0x30, 0x45, 0x05, 0x1d, 0x18, // Q/1U$#%... 0E...
-	0x13, 0x2a, 0x16, 0x0c, 0x05, 0x10, 0x1e, 0x0d, 0x11, 0x0c, 0x06, 0x07, 0x01, 0x42, 0x12, 0x24, // .*...........B.$
-	0x12, 0x12, 0x17, 0x22, 0x0b, 0x03, 0x0b, 0x06, 0x05, 0x06, 0x1c, 0x15, 0xac, 0x11, 0x20, 0x0e, // ...".......... .
-	0x23, 0x27, 0x03, 0x01, 0x20, 0x20, 0x00, 0x00, 0x00, 0x03, 0x00, 0x7e, 0xff, 0xc8, 0x03, 0x82, // #'..  .....~....
-	0x03, 0xba, 0x00, 0x10, 0x00, 0x25, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x3e, 0x01, 0x37, 0x25, 0x11, // .....%.?...>.7%.
-	0x05, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x27, 0x33, 0x15, 0x23, 0x11, // ..&'..5.467'3.#.
-	0x33, 0x15, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, // 3.#"&'..5.467>.3
-	0x01, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x33, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, // .>.54&'3..#"....
-	0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x01, 0xa5, 0x09, 0x16, 0x0c, 0x01, // ......3267......
-	0xb2, 0xfe, 0x4e, 0x0c, 0x16, 0x09, 0x09, 0x08, 0x08, 0x09, 0xe9, 0x99, 0x5c, 0x5c, 0x99, 0x0d, // ..N.............
-	0x17, 0x09, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0d, 0x01, 0x9e, 0x09, 0x09, 0x09, 0x09, 0x01, // ................
-	0x09, 0x17, 0x0d, 0x0c, 0x16, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x15, 0x0d, 0x0d, 0x16, 0x09, // ................
-	0x03, 0x4c, 0x0b, 0x0d, 0x02, 0x54, 0xfc, 0x61, 0x53, 0x03, 0x05, 0x07, 0x08, 0x14, 0x0e, 0x03, // .L...T.aS.......
-	0x21, 0x0d, 0x18, 0x0b, 0x6b, 0x7c, 0xfd, 0x1b, 0x7c, 0x09, 0x08, 0x09, 0x17, 0x0d, 0x03, 0x5f, // !...k|..|......_
-	0x0d, 0x17, 0x09, 0x09, 0x0a, 0xfd, 0xe4, 0x0a, 0x16, 0x0d, 0x0d, 0x15, 0x09, 0x0a, 0x09, 0x09, // ................
-	0x0a, 0x09, 0x15, 0x0d, 0x0d, 0x16, 0x0a, 0x08, 0x09, 0x09, 0x08, 0x00, 0x00, 0x01, 0x01, 0x03, // ................
-	0xff, 0xc6, 0x02, 0xfd, 0x03, 0xba, 0x00, 0x32, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x17, 0x1e, 0x03, // .......2........
-	0x17, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x3e, // .......#"&'..=.>
-	0x03, 0x37, 0x3e, 0x01, 0x37, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, // .7>.7'..5467>.32
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x02, 0x6a, 0x14, 0x24, 0x10, 0x13, 0x1b, // ..........j.$...
-	0x13, 0x09, 0x01, 0x25, 0x26, 0x24, 0x59, 0x35, 0x35, 0x5a, 0x25, 0x24, 0x25, 0x01, 0x09, 0x12, // ...%&$Y55Z%$%...
-	0x1b, 0x12, 0x11, 0x25, 0x14, 0x1d, 0x1d, 0x1c, 0x1c, 0x1d, 0x1b, 0x44, 0x28, 0x28, 0x45, 0x1c, // ...%.......D((E.
-	0x1c, 0x1c, 0x1c, 0x1c, 0x1f, 0x02, 0x5b, 0x14, 0x39, 0x24, 0x29, 0x5a, 0x63, 0x6b, 0x39, 0x03, // ......[.9$)Zck9.
-	0x1f, 0x35, 0x16, 0x16, 0x17, 0x17, 0x16, 0x16, 0x35, 0x1f, 0x03, 0x39, 0x6b, 0x63, 0x5a, 0x29, // .5......5..9kcZ)
-	0x24, 0x39, 0x15, 0x18, 0x1c, 0x44, 0x27, 0x28, 0x43, 0x1b, 0x1c, 0x1d, 0x1d, 0x1c, 0x1b, 0x43, // $9...D'(C......C
-	0x28, 0x27, 0x44, 0x1c, 0x19, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x55, 0x03, 0xfa, // ('D..........U..
-	0x03, 0x2b, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x60, 0x00, 0x00, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, // .+...9.`...>.32.
-	0x17, 0x35, 0x1e, 0x01, 0x15, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, // .5.........#"&'.
-	0x01, 0x27, 0x35, 0x27, 0x34, 0x36, 0x37, 0x05, 0x34, 0x36, 0x37, 0x15, 0x3e, 0x01, 0x33, 0x32, // .'5'467.467.>.32
-	0x16, 0x17, 0x15, 0x1e, 0x01, 0x15, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, // ............#"&'
-	0x2e, 0x01, 0x2f, 0x01, 0x37, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x17, 0x27, 0x11, 0x37, 0x13, // ../.7"......'.7.
-	0x21, 0x13, 0x17, 0x03, 0x27, 0x37, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, // !...'74&'..#"...
-	0x01, 0x15, 0x17, 0x27, 0x37, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x02, 0x9a, 0x12, 0x2c, 0x19, // ...'74&'..#...,.
-	0x1a, 0x2d, 0x13, 0x11, 0x12, 0x02, 0x04, 0x10, 0x0d, 0x13, 0x2d, 0x1a, 0x19, 0x2c, 0x12, 0x0d, // .-........-..,..
-	0x12, 0x04, 0x02, 0x12, 0x13, 0xfd, 0xf5, 0x12, 0x13, 0x12, 0x2b, 0x1a, 0x19, 0x2d, 0x13, 0x13, // ..........+..-..
-	0x12, 0x02, 0x03, 0x12, 0x0e, 0x12, 0x2d, 0x1a, 0x1a, 0x2b, 0x12, 0x0f, 0x13, 0x02, 0x01, 0x7c, // ......-..+.....|
-	0x23, 0x3c, 0x1a, 0x18, 0x19, 0x01, 0x5c, 0xdd, 0x77, 0x01, 0x35, 0x72, 0xf9, 0x11, 0x51, 0x03, // #<......w.5r..Q.
-	0x19, 0x18, 0x19, 0x3c, 0x24, 0x23, 0x3b, 0x19, 0x19, 0x1a, 0x04, 0x98, 0x02, 0x19, 0x18, 0x1a, // ...<$#;.........
-	0x3c, 0x23, 0x01, 0x2a, 0x12, 0x13, 0x13, 0x12, 0x01, 0x13, 0x2d, 0x19, 0x1e, 0x11, 0x1d, 0x0e, // <#.*......-.....
-	0x11, 0x12, 0x12, 0x11, 0x0e, 0x20, 0x12, 0x01, 0x19, 0x19, 0x2c, 0x13, 0x58, 0x19, 0x2d, 0x13, // ..... ....,.X.-.
-	0x01, 0x12, 0x13, 0x12, 0x12, 0x01, 0x13, 0x2c, 0x19, 0x17, 0x13, 0x22, 0x0e, 0x11, 0x12, 0x12, // .......,..."....
-	0x11, 0x10, 0x23, 0x13, 0x14, 0xa9, 0x18, 0x19, 0x19, 0x3c, 0x23, 0x19, 0x02, 0x01, 0x3b, 0x18, // ..#......<#...;.
-	0x01, 0x1d, 0xfe, 0xf2, 0x27, 0xfe, 0xb3, 0x02, 0x27, 0x22, 0x3d, 0x19, 0x19, 0x18, 0x18, 0x19, // ....'...'"=.....
-	0x19, 0x3d, 0x22, 0x22, 0x04, 0x1e, 0x22, 0x3d, 0x19, 0x19, 0x18, 0x00, 0x00, 0x04, 0x00, 0x06, // .="".."=........
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x18, 0x00, 0x41, 0x00, 0x5a, 0x00, 0x5f, 0x00, 0x00, // .........A.Z._..
-	0x25, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, // %>.54&'..#".....
-	0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x17, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, // .....3267...#"..
-	0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, // '..54>.7>.32....
-	0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x27, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, // ......'..#"&'..5
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, // 467>.32........'
-	0x11, 0x23, 0x11, 0x33, 0x03, 0x0d, 0x37, 0x37, 0x37, 0x37, 0x38, 0x86, 0x4f, 0x4f, 0x86, 0x38, // .#.3..77778.OO.8
-	0x37, 0x37, 0x37, 0x37, 0x38, 0x86, 0x4f, 0x4f, 0x86, 0x38, 0x58, 0x25, 0x51, 0x59, 0x61, 0x35, // 77778.OO.8X%QYa5
-	0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, // 5aZR%$8$..$8$%RZ
-	0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x9b, // a55aYQ%%8%..%8%.
-	0x2a, 0x65, 0x3b, 0x3b, 0x65, 0x29, 0x2a, 0x29, 0x29, 0x2a, 0x29, 0x65, 0x3b, 0x3b, 0x65, 0x2a, // *e;;e)*))*)e;;e*
-	0x29, 0x29, 0x29, 0x29, 0x8b, 0x7e, 0x7e, 0xb3, 0x38, 0x86, 0x4f, 0x4f, 0x86, 0x38, 0x37, 0x37, // )))).~~.8.OO.877
-	0x37, 0x37, 0x38, 0x86, 0x4f, 0x4f, 0x86, 0x38, 0x37, 0x37, 0x37, 0x37, 0x58, 0x25, 0x38, 0x25, // 778.OO.87777X%8%
-	0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, // ..%8%%QYa55aZR%$
-	0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, // 8$..$8$%RZa55aYQ
-	0x25, 0x9b, 0x29, 0x29, 0x29, 0x29, 0x2a, 0x65, 0x3b, 0x3b, 0x65, 0x29, 0x2a, 0x29, 0x29, 0x2a, // %.))))*e;;e)*))*
-	0x29, 0x65, 0x3b, 0x3b, 0x65, 0x2a, 0x2c, 0x01, 0x3c, 0xfe, 0xc4, 0x00, 0x00, 0x02, 0x00, 0x09, // )e;;e*,.<.......
-	0x00, 0x07, 0x03, 0xe7, 0x03, 0x7d, 0x00, 0x1d, 0x00, 0x5e, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x27, // .....}...^.....'
-	0x26, 0x06, 0x07, 0x0e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x16, 0x36, // &..............6
-	0x37, 0x3e, 0x01, 0x27, 0x35, 0x2e, 0x01, 0x2f, 0x02, 0x01, 0x16, 0x06, 0x07, 0x17, 0x16, 0x14, // 7>.'5../........
-	0x0f, 0x02, 0x2f, 0x01, 0x07, 0x1f, 0x01, 0x0f, 0x01, 0x06, 0x22, 0x2f, 0x01, 0x07, 0x1e, 0x01, // ../......."/....
-	0x17, 0x07, 0x16, 0x06, 0x07, 0x0e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x2e, 0x01, 0x27, 0x35, // .......'../...'5
-	0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x17, 0x33, 0x1e, 0x01, 0x17, 0x01, 0x3e, // ..7>.7>.7.3....>
-	0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x01, 0x5b, 0x18, 0x30, 0x19, 0x10, 0x1c, // ..........[.0...
+	0x39, 0x39, 0x8a, 0x52, 0x1e, 0x39, 0x1a, 0x3b, 0xf1, 0x82, 0x3b, 0x21, 0x19, 0x2b, 0x6a, 0xd3, // 99.R.9.;..;!.+j.
+	0x04, 0x2b, 0xf0, 0x11, 0x0b, 0x0a, 0x04, 0x38, 0x39, 0x39, 0x89, 0x50, 0x51, 0x8b, 0x82, 0x1f, // .+.....899.PQ...
+	0x20, 0x00, 0x69, 0x3b, 0x0b, 0x26, 0x09, 0x00, 0x0d, 0x00, 0x2d, 0x00, 0x58, 0x82, 0xdf, 0x43, //  .i;.&....-.X..C
+	0x1d, 0x03, 0x29, 0x15, 0x23, 0x15, 0x23, 0x35, 0x31, 0x23, 0x35, 0x33, 0x37, 0xca, 0xed, 0x23, // ..).#.#51#537..#
+	0x4d, 0x80, 0x60, 0x60, 0x82, 0x02, 0x20, 0x3e, 0x96, 0xf4, 0x21, 0x26, 0x5a, 0xa3, 0xf4, 0x21, // M.``.. >..!&Z..!
+	0x02, 0x70, 0x84, 0x44, 0x21, 0x80, 0xc5, 0xc0, 0xfb, 0x4a, 0x7f, 0x09, 0x24, 0x04, 0x00, 0x24, // .p.D!....J..$..$
+	0x00, 0x4f, 0x65, 0xed, 0x03, 0x23, 0x35, 0x21, 0x15, 0x03, 0xc9, 0xf0, 0x26, 0x02, 0x2f, 0xfe, // .Oe..#5!....&./.
+	0xbc, 0x01, 0x44, 0xa4, 0xbc, 0xee, 0x25, 0x01, 0xf1, 0x81, 0x81, 0x01, 0x44, 0x41, 0xe7, 0x4a, // ..D...%.....DA.J
+	0x42, 0xc3, 0x03, 0x22, 0x4f, 0x00, 0x54, 0x42, 0xc7, 0x4c, 0x20, 0x13, 0x41, 0x38, 0x03, 0x20, // B.."O.TB.L .A8. 
+	0x15, 0x83, 0x04, 0x42, 0xd1, 0x18, 0xa5, 0xed, 0x20, 0xa4, 0x41, 0x30, 0x03, 0x83, 0x03, 0x42, // ...B.... .A0...B
+	0xda, 0x3f, 0x39, 0xfe, 0xa0, 0x61, 0x61, 0xa2, 0x61, 0x61, 0x00, 0x03, 0x00, 0x56, 0xff, 0xc7, // .?9..aa.aa...V..
+	0x03, 0xaa, 0x03, 0x1a, 0x00, 0x08, 0x00, 0x29, 0x00, 0x2e, 0x00, 0x00, 0x25, 0x6a, 0xee, 0x03, // .......)....%j..
+	0x24, 0x33, 0x15, 0x33, 0x35, 0x01, 0x46, 0x26, 0x0e, 0x21, 0x33, 0x35, 0x47, 0x9f, 0x0d, 0x22, // $3.35.F&.!35G.."
+	0x33, 0x27, 0x21, 0x82, 0xd1, 0x27, 0x02, 0x35, 0x35, 0xd4, 0x35, 0x6a, 0x01, 0x75, 0x48, 0x3b, // 3'!..'.55.5j.uH;
+	0x0b, 0x3b, 0x6b, 0x0f, 0x0f, 0x10, 0x26, 0x16, 0x01, 0xaa, 0x16, 0x25, 0x0f, 0x10, 0x10, 0x6b, // .;k...&....%...k
+	0xd5, 0xfe, 0x56, 0x01, 0xaa, 0x9b, 0x6b, 0x6b, 0x6a, 0x6a, 0x01, 0x40, 0xfe, 0x21, 0x48, 0x16, // ..V...kkjj.@.!H.
+	0x04, 0x48, 0x0a, 0x04, 0x22, 0x01, 0xdf, 0xd5, 0x84, 0x20, 0x82, 0x00, 0x22, 0x25, 0x15, 0xd5, // .H..".... .."%..
+	0x82, 0x00, 0x84, 0x8b, 0x48, 0x13, 0x05, 0x24, 0x08, 0x00, 0x0d, 0x00, 0x32, 0x82, 0x8b, 0x86, // ....H..$....2...
+	0x8a, 0x27, 0x33, 0x13, 0x35, 0x33, 0x15, 0x23, 0x37, 0x15, 0x6c, 0x9d, 0x03, 0x6a, 0xe1, 0x0f, // .'3.53.#7.l..j..
+	0x20, 0x33, 0x6b, 0x86, 0x0d, 0x21, 0x02, 0x6a, 0x82, 0x8e, 0x20, 0x35, 0x82, 0x6c, 0x25, 0x6a, //  3k..!.j.. 5.l%j
+	0x6a, 0xfe, 0x56, 0x02, 0x7f, 0x98, 0x96, 0x85, 0x90, 0x23, 0xfa, 0x4e, 0x4e, 0xba, 0x82, 0x28, // j.V......#.NN..(
+	0x22, 0x8c, 0xfe, 0x21, 0x47, 0xe3, 0x09, 0x25, 0x01, 0xdf, 0x01, 0x74, 0x16, 0x25, 0x84, 0x97, // "..!G..%...t.%..
+	0x22, 0x10, 0x26, 0x15, 0x63, 0x13, 0x05, 0x20, 0x46, 0x82, 0x97, 0x20, 0xba, 0x62, 0xb3, 0x04, // ".&.c.. F.. .b..
+	0x46, 0xab, 0x05, 0x20, 0x03, 0x57, 0x62, 0x0d, 0x58, 0x22, 0x03, 0x21, 0x01, 0x37, 0x58, 0x17, // F.. .Wb.X".!.7X.
+	0x11, 0x33, 0x02, 0xa9, 0x27, 0x48, 0x21, 0x20, 0x31, 0x20, 0x10, 0x40, 0x41, 0x40, 0x9d, 0x5c, // .3..'H! 1 .@A@..
+	0x5c, 0x9c, 0x41, 0x40, 0x41, 0x10, 0x82, 0x0e, 0x08, 0x31, 0x21, 0x47, 0x28, 0x21, 0x21, 0x22, // ..A@A....1!G(!!"
+	0x23, 0x22, 0x53, 0x31, 0x32, 0x53, 0x22, 0x23, 0x23, 0x22, 0x22, 0x02, 0x36, 0x10, 0x2f, 0x1f, // #"S12S"##"".6./.
+	0x1f, 0x46, 0x4b, 0x53, 0x2d, 0x2f, 0x50, 0x20, 0x21, 0x22, 0x22, 0x21, 0x20, 0x50, 0x2f, 0x2d, // .FKS-/P !""! P/-
+	0x53, 0x4b, 0x46, 0x1f, 0x1f, 0x2f, 0x11, 0x21, 0x4f, 0x2e, 0x2f, 0x51, 0x82, 0x13, 0x82, 0x00, // SKF../.!O./Q....
+	0x24, 0x50, 0x2f, 0x2e, 0x4f, 0x22, 0x46, 0x13, 0x06, 0x28, 0x65, 0x03, 0xfa, 0x03, 0x1b, 0x00, // $P/.O"F..(e.....
+	0x2c, 0x00, 0x55, 0x84, 0x91, 0x67, 0x6a, 0x08, 0x87, 0x93, 0x68, 0x9b, 0x05, 0x92, 0x92, 0x20, // ,.U..gj...h.... 
+	0x37, 0x8e, 0x0f, 0x20, 0x1e, 0x6a, 0x96, 0x0a, 0x21, 0x27, 0x3e, 0x82, 0x37, 0x21, 0x26, 0x27, // 7.. .j..!'>.7!&'
+	0x85, 0x37, 0x26, 0x01, 0x99, 0x1a, 0x30, 0x16, 0x07, 0x27, 0x82, 0x00, 0x2e, 0x07, 0x2b, 0x67, // .7&...0..'....+g
+	0x3d, 0x3c, 0x68, 0x2a, 0x2a, 0x2b, 0x01, 0x2b, 0x2b, 0x15, 0x2f, 0x1a, 0x62, 0x1a, 0x03, 0x24, // =<h**+.++./.b..$
+	0x17, 0x37, 0x20, 0x21, 0x37, 0x62, 0x21, 0x03, 0x21, 0x17, 0xa1, 0x84, 0x0c, 0x22, 0x20, 0x38, // .7 !7b!.!...." 8
+	0x17, 0x62, 0x30, 0x03, 0x23, 0x1a, 0x30, 0x15, 0x2b, 0x82, 0x00, 0x3a, 0x2a, 0x68, 0x3c, 0x95, // .b0.#.0.+..:*h<.
+	0x26, 0x24, 0x03, 0x2f, 0x2e, 0x0e, 0x1e, 0x10, 0x17, 0x16, 0x02, 0x11, 0x0b, 0x20, 0x16, 0x07, // &$./......... ..
+	0x2a, 0x65, 0x3a, 0x1f, 0x35, 0x15, 0x05, 0x62, 0x56, 0x04, 0x38, 0x37, 0x21, 0x3d, 0x68, 0x2b, // *e:.5..bV.87!=h+
+	0x16, 0x20, 0x0b, 0x16, 0x36, 0x20, 0x21, 0x38, 0x16, 0x18, 0x17, 0x17, 0x18, 0x16, 0x38, 0x21, // . ..6 !8......8!
+	0x20, 0x36, 0x16, 0x6c, 0x8c, 0x0d, 0x82, 0x35, 0x24, 0x2b, 0x68, 0x3d, 0x21, 0x37, 0x82, 0x64, //  6.l...5$+h=!7.d
+	0x29, 0x15, 0x1c, 0x43, 0x27, 0x45, 0x78, 0x33, 0x0a, 0x10, 0x07, 0x82, 0x32, 0x44, 0x97, 0x04, // )..C'Ex3....2D..
+	0x21, 0x00, 0x66, 0x82, 0xff, 0x28, 0x1a, 0x00, 0x2b, 0x00, 0x5a, 0x00, 0x84, 0x00, 0x00, 0x43, // !.f..(..+.Z....C
+	0xa5, 0x06, 0x21, 0x07, 0x1f, 0x4b, 0xf4, 0x03, 0x23, 0x15, 0x0e, 0x01, 0x1d, 0x47, 0x26, 0x06, // ..!..K..#....G&.
+	0x20, 0x35, 0x41, 0x05, 0x10, 0x22, 0x1f, 0x01, 0x05, 0x84, 0xf1, 0x20, 0x1d, 0x4c, 0x1e, 0x04, //  5A.."..... .L..
+	0x65, 0xce, 0x08, 0x84, 0x1e, 0x21, 0x3f, 0x01, 0x41, 0x2e, 0x11, 0x20, 0x17, 0x6b, 0x8a, 0x0a, // e....!?.A.. .k..
+	0x41, 0x2d, 0x07, 0x4a, 0x9a, 0x06, 0x20, 0x07, 0x44, 0x07, 0x04, 0x23, 0x27, 0x3f, 0x01, 0x27, // A-.J.. .D..#'?.'
+	0x59, 0x49, 0x05, 0x08, 0x3c, 0x01, 0x3c, 0x08, 0x08, 0x05, 0x05, 0x04, 0x07, 0x06, 0x0e, 0x19, // YI..<.<.........
+	0x0c, 0x33, 0x33, 0x1b, 0x2f, 0x15, 0x20, 0x20, 0x01, 0x21, 0x20, 0x0f, 0x23, 0x14, 0x11, 0x10, // .33./.  .! .#...
+	0x10, 0x11, 0x11, 0x2a, 0x18, 0x18, 0x29, 0x11, 0x0a, 0x01, 0x4a, 0x13, 0x23, 0x10, 0x2b, 0x2b, // ...*..)...J.#.++
+	0x03, 0x2b, 0x28, 0x2a, 0x65, 0x3c, 0x3c, 0x67, 0x2a, 0x28, 0x2a, 0x02, 0x2a, 0x2a, 0x10, 0x24, // .+(*e<<g*(*.**.$
+	0x12, 0x18, 0x63, 0x6f, 0x04, 0x2d, 0x37, 0x20, 0x20, 0x37, 0x17, 0x16, 0x16, 0x16, 0x15, 0x16, // ..co.-7  7......
+	0x40, 0x0a, 0x11, 0x29, 0x83, 0x30, 0x83, 0x00, 0x2d, 0x13, 0x24, 0x10, 0x1f, 0x20, 0x20, 0x1f, // @..).0..-.$..  .
+	0x15, 0x30, 0x1a, 0x34, 0x33, 0x33, 0x08, 0x63, 0xe8, 0x03, 0x2c, 0x07, 0x08, 0x02, 0xd0, 0x13, // .0.433.c..,.....
+	0x2a, 0x17, 0x11, 0x20, 0x10, 0x03, 0x04, 0x10, 0x6d, 0xa8, 0x03, 0x36, 0x33, 0x7d, 0x48, 0x05, // *.. ....m..63}H.
+	0x03, 0x10, 0x0c, 0x10, 0x28, 0x18, 0x01, 0x2d, 0x4d, 0x20, 0x11, 0x19, 0x08, 0x11, 0x29, 0x17, // ....(..-M ....).
+	0x18, 0x2a, 0x11, 0x6c, 0xd4, 0x03, 0x2b, 0x0c, 0xcb, 0x0a, 0x1b, 0x10, 0x2b, 0x68, 0x3c, 0x09, // .*.l..+.....+h<.
+	0x1e, 0x32, 0x15, 0x64, 0x0e, 0x04, 0x2b, 0x32, 0x1e, 0x09, 0x3c, 0x68, 0x2b, 0x10, 0x1b, 0x0a, // .2.d..+2..<h+...
+	0x0b, 0x17, 0x35, 0x41, 0xb7, 0x03, 0x26, 0x17, 0x18, 0x18, 0x17, 0x17, 0x38, 0x20, 0x41, 0x70, // ..5A..&.....8 Ap
+	0x03, 0x21, 0xcb, 0x0c, 0x83, 0x31, 0x82, 0xaa, 0x2b, 0x17, 0x29, 0x11, 0x08, 0x19, 0x11, 0x20, // .!...1..+.).... 
+	0x4d, 0x2d, 0x01, 0x18, 0x28, 0x82, 0x56, 0x2f, 0x03, 0x05, 0x48, 0x7d, 0x33, 0x01, 0x2a, 0x11, // M-..(.V/..H}3.*.
+	0x03, 0x02, 0x10, 0x21, 0x11, 0x17, 0x2a, 0x13, 0x51, 0x47, 0x07, 0x4e, 0x5f, 0x03, 0x22, 0x89, // ...!..*.QG.N_.".
+	0x00, 0x23, 0x49, 0x45, 0x03, 0x58, 0xd1, 0x03, 0x21, 0x23, 0x2f, 0x63, 0xb6, 0x07, 0x4a, 0x53, // .#IE.X..!#/c..JS
+	0x08, 0x4a, 0x77, 0x0a, 0x21, 0x01, 0x17, 0x5c, 0xde, 0x0b, 0x43, 0xc8, 0x03, 0x20, 0x35, 0x5c, // .Jw.!.....C.. 5.
+	0xd6, 0x04, 0x2a, 0x15, 0x0a, 0xfe, 0xba, 0x17, 0x82, 0x17, 0x0a, 0xe4, 0x07, 0x0b, 0x58, 0xe2, // ..*...........X.
+	0x05, 0x22, 0x0b, 0x07, 0xe4, 0x84, 0x05, 0x20, 0x82, 0x82, 0x10, 0x23, 0x01, 0x47, 0x09, 0xd3, // ."..... ...#.G..
+	0x4a, 0x46, 0x03, 0x36, 0x0a, 0x18, 0x0e, 0xfe, 0xba, 0x01, 0x05, 0xfe, 0xfb, 0x01, 0x46, 0x0e, // JF.6..........F.
+	0x18, 0x0a, 0x01, 0xc0, 0x17, 0xfe, 0xba, 0x0a, 0x0a, 0x17, 0xa3, 0x84, 0x27, 0x21, 0x01, 0x04, // ............'!..
+	0x84, 0x39, 0x20, 0xa3, 0x86, 0x3f, 0x82, 0x4d, 0x21, 0x01, 0xb5, 0x5c, 0x0c, 0x03, 0x20, 0xf3, // .9 ..?.M!..... .
+	0x82, 0x29, 0x27, 0x09, 0x09, 0x83, 0x02, 0x8c, 0x83, 0x0a, 0x0a, 0x90, 0xaf, 0x23, 0x13, 0x37, // .)'..........#.7
+	0x01, 0x37, 0x49, 0x1c, 0x03, 0x51, 0x16, 0x0e, 0x4d, 0x1d, 0x0a, 0x22, 0x01, 0x27, 0x03, 0x5c, // .7I..Q..M..".'..
+	0xee, 0x0a, 0x20, 0x15, 0x82, 0xaf, 0x20, 0x15, 0x44, 0x72, 0x03, 0x23, 0xeb, 0x0a, 0x01, 0x46, // .. ... .Dr.#...F
+	0x98, 0xae, 0x82, 0x95, 0x87, 0xae, 0x21, 0x01, 0x46, 0x82, 0xac, 0x82, 0x10, 0x85, 0xae, 0x21, // ......!.F......!
+	0x01, 0x46, 0x88, 0xae, 0x21, 0xfe, 0xfc, 0x8c, 0xae, 0x82, 0x4d, 0x21, 0xfe, 0x4b, 0x82, 0xae, // .F..!.....M!.K..
+	0x21, 0x03, 0x0d, 0x85, 0xae, 0x21, 0xfd, 0x74, 0x84, 0xae, 0x8a, 0xaf, 0x20, 0x14, 0x41, 0x5f, // !....!.t.... .A_
+	0x04, 0x87, 0x7f, 0x8b, 0x93, 0x41, 0x74, 0x23, 0x21, 0x01, 0x8e, 0x88, 0x87, 0x88, 0x99, 0x21, // .....At#!......!
+	0x02, 0x6c, 0x41, 0x73, 0x03, 0x25, 0x83, 0x17, 0x09, 0xe5, 0x06, 0x0c, 0x6f, 0x20, 0x05, 0x2a, // .lAs.%......o .*
+	0x0c, 0x06, 0xe5, 0x05, 0x04, 0x05, 0x0c, 0x06, 0x83, 0x06, 0x0c, 0x82, 0x91, 0x22, 0x0a, 0x03, // ............."..
+	0x06, 0x82, 0x86, 0x84, 0x2c, 0x82, 0x96, 0x24, 0x17, 0x0a, 0x0a, 0x0a, 0x83, 0x82, 0x2f, 0x41, // ....,..$....../A
+	0x72, 0x1c, 0x8c, 0xaf, 0x20, 0x36, 0x5c, 0x85, 0x05, 0x41, 0xeb, 0x11, 0x21, 0x17, 0x11, 0x41, // r... 6...A..!..A
+	0x65, 0x05, 0x63, 0xb0, 0x03, 0x5b, 0x0e, 0x09, 0x83, 0xa9, 0x41, 0x8a, 0x06, 0x21, 0x03, 0xe8, // e.c..[....A..!..
+	0x41, 0xed, 0x11, 0x22, 0xdd, 0x0a, 0x0a, 0x83, 0x9f, 0x20, 0x09, 0x82, 0xb0, 0x21, 0xfe, 0xba, // A.."..... ...!..
+	0x41, 0x32, 0x05, 0x86, 0xa9, 0x84, 0xbf, 0x21, 0x03, 0x75, 0x41, 0xec, 0x0f, 0x25, 0xfe, 0xe4, // A2.....!.uA..%..
+	0x17, 0xfe, 0xfc, 0x17, 0x82, 0x9e, 0x82, 0xb9, 0x82, 0x2b, 0x21, 0x0b, 0x07, 0x42, 0x48, 0x03, // .........+!..BH.
+	0x20, 0x46, 0x5b, 0xbd, 0x04, 0x82, 0xbe, 0x45, 0xcf, 0x04, 0x24, 0x60, 0xff, 0xc6, 0x03, 0xa0, //  F[....E..$`....
+	0x5f, 0x0b, 0x04, 0x20, 0x00, 0x41, 0xf3, 0x08, 0x53, 0x1a, 0x0e, 0x4f, 0x19, 0x09, 0x27, 0x03, // _.. .A..S..O..'.
+	0xa0, 0x09, 0x08, 0x09, 0x16, 0x0d, 0xb1, 0x60, 0xa8, 0x04, 0x21, 0xec, 0x0d, 0x52, 0x1f, 0x03, // .......`..!..R..
+	0x20, 0xb3, 0x84, 0x05, 0x26, 0x01, 0xa0, 0x01, 0xa0, 0x02, 0x19, 0x3b, 0x82, 0x0b, 0x23, 0x09, //  ...&......;..#.
+	0x08, 0xfe, 0x60, 0x83, 0x12, 0x56, 0x31, 0x03, 0x23, 0x15, 0x0d, 0x01, 0xa0, 0x82, 0x08, 0x26, // ..`..V1.#......&
+	0x15, 0x0d, 0x3b, 0x01, 0xa1, 0xfe, 0x5f, 0x69, 0x53, 0x06, 0x25, 0x00, 0x20, 0x03, 0xfa, 0x03, // ..;..._iS.%. ...
+	0x60, 0x84, 0x6f, 0x41, 0x9d, 0x06, 0x20, 0x09, 0x4f, 0x7b, 0x08, 0x4f, 0xb0, 0x0e, 0x22, 0x35, // `.oA.. .O{.O.."5
+	0x01, 0xe2, 0x89, 0x3e, 0x93, 0x5c, 0x23, 0x03, 0x23, 0x0d, 0x16, 0x82, 0x0a, 0x23, 0xfe, 0x60, // ...>..#.#....#.`
+	0xfe, 0x60, 0x52, 0xb5, 0x03, 0x21, 0x0d, 0xb3, 0x84, 0x05, 0x20, 0xec, 0x61, 0x4c, 0x04, 0x21, // .`R..!.... .aL.!
+	0xb1, 0x00, 0x90, 0xdf, 0x4f, 0x3c, 0x0d, 0x54, 0xe9, 0x0e, 0x41, 0x74, 0x04, 0x20, 0x8f, 0x97, // ....O<.T..At. ..
+	0x4c, 0x5a, 0xb7, 0x03, 0x20, 0xcd, 0x83, 0x8a, 0x23, 0xfe, 0x5f, 0x01, 0xa1, 0x85, 0x8a, 0x21, // LZ.. ...#._....!
+	0x01, 0xa0, 0x89, 0x8a, 0x82, 0x32, 0x20, 0x09, 0x91, 0xdf, 0x4f, 0xbe, 0x0d, 0x41, 0x5d, 0x07, // .....2 ...O..A].
+	0x20, 0x09, 0x6b, 0x1c, 0x08, 0x22, 0x21, 0x03, 0xbe, 0x8d, 0x42, 0x8f, 0x60, 0x21, 0x02, 0x72, //  .k.."!...B.`!.r
+	0x67, 0x9a, 0x04, 0x20, 0xed, 0x41, 0x69, 0x0e, 0x41, 0x84, 0x05, 0x7a, 0x07, 0x0d, 0x82, 0x6f, // g.. .Ai.A..z...o
+	0x20, 0x09, 0x47, 0x90, 0x03, 0x61, 0xe3, 0x06, 0x22, 0x2e, 0x01, 0x27, 0x4d, 0x12, 0x04, 0x49, //  .G..a.."..'M..I
+	0x84, 0x03, 0x21, 0x11, 0x21, 0x83, 0xe0, 0x67, 0x07, 0x04, 0x08, 0x25, 0x75, 0x01, 0x6d, 0x0b, // ..!.!..g...%u.m.
+	0x0c, 0x01, 0x0b, 0x0b, 0xd0, 0x0b, 0x1a, 0x0f, 0x0f, 0x1b, 0x0b, 0xfe, 0x94, 0x9c, 0x0a, 0x1b, // ................
+	0x0f, 0x0f, 0x1a, 0x0b, 0x35, 0x02, 0xda, 0x34, 0x0b, 0x0b, 0x01, 0x0c, 0x0b, 0x9d, 0x02, 0x81, // ....5..4........
+	0xfe, 0x93, 0x82, 0x13, 0x23, 0x0e, 0x1a, 0x0b, 0xcf, 0x82, 0x29, 0x82, 0x11, 0x2b, 0x01, 0x6d, // ....#.....)..+.m
+	0x9c, 0x0a, 0x0d, 0x02, 0x0b, 0x0b, 0x34, 0x02, 0xda, 0x35, 0x83, 0x35, 0x22, 0x19, 0x0b, 0x9d, // ......4..5.5"...
+	0x8e, 0x77, 0x20, 0x25, 0x52, 0x32, 0x03, 0x85, 0x74, 0x6e, 0x06, 0x03, 0x47, 0x70, 0x03, 0x46, // .w %R2..tn..Gp.F
+	0x73, 0x04, 0x46, 0x47, 0x03, 0x20, 0x21, 0x42, 0xe7, 0x03, 0x22, 0x07, 0x03, 0x8f, 0x82, 0x63, // s.FG. !B.."....c
+	0x24, 0x9d, 0xfe, 0x95, 0x0b, 0x19, 0x83, 0x6c, 0x20, 0xce, 0x84, 0x82, 0x22, 0x01, 0x6b, 0x99, // $......l ...".k.
+	0x85, 0x60, 0x20, 0x32, 0x83, 0x58, 0x2f, 0x1b, 0x10, 0x96, 0x01, 0x0d, 0x0b, 0x9c, 0xfe, 0x95, // .` 2.X/.........
+	0x0c, 0x0d, 0x01, 0x01, 0x0d, 0x0c, 0xce, 0x83, 0x82, 0x20, 0x1b, 0x82, 0x23, 0x22, 0x9b, 0x0b, // ......... ..#"..
+	0x1a, 0x63, 0x54, 0x03, 0x26, 0x33, 0xfd, 0x28, 0x33, 0x0b, 0x0d, 0x01, 0x8d, 0x77, 0x20, 0x13, // .cT.&3.(3....w .
+	0x6e, 0x63, 0x04, 0x20, 0x17, 0x4a, 0x8e, 0x04, 0x47, 0xf8, 0x03, 0x21, 0x11, 0x21, 0x87, 0x75, // nc. .J..G..!.!.u
+	0x20, 0x01, 0x86, 0x07, 0x20, 0xec, 0x84, 0xe6, 0x23, 0x0a, 0x01, 0x6b, 0x9c, 0x82, 0x08, 0x82, //  ... ...#..k....
+	0x46, 0x23, 0x35, 0xfd, 0x26, 0x32, 0x85, 0x74, 0x20, 0x9b, 0x82, 0x8c, 0x84, 0x08, 0x22, 0xce, // F#5.&2.t .....".
+	0x03, 0xa2, 0x84, 0x8e, 0x22, 0xfe, 0x93, 0x9b, 0x85, 0x10, 0x22, 0x34, 0xfd, 0x28, 0x84, 0xe7, // ...."....."4.(..
+	0x27, 0x1c, 0x0b, 0x9c, 0x01, 0x6c, 0x0b, 0x19, 0x0d, 0x82, 0x36, 0x20, 0xce, 0x8d, 0x77, 0x41, // '....l....6 ..wA
+	0xd0, 0x03, 0x4a, 0xe7, 0x04, 0x62, 0x30, 0x05, 0x87, 0x7e, 0x20, 0x01, 0x86, 0x07, 0x82, 0x18, // ..J..b0..~ .....
+	0x26, 0x03, 0xfa, 0x0c, 0x0c, 0xfe, 0x95, 0x9a, 0x82, 0xe4, 0x82, 0x59, 0x84, 0xbb, 0x63, 0xc7, // &..........Y..c.
+	0x04, 0x25, 0x9d, 0x01, 0x6b, 0x0a, 0x1a, 0x0e, 0x82, 0x90, 0x2a, 0xce, 0x0b, 0x0d, 0x02, 0x02, // .%..k.....*.....
+	0x9e, 0x0e, 0x1a, 0x0a, 0xfe, 0x93, 0x41, 0x80, 0x04, 0x25, 0x1b, 0x0c, 0x33, 0x02, 0xd8, 0x34, // ......A..%..3..4
+	0x85, 0x7f, 0x20, 0x9d, 0x41, 0xa2, 0x04, 0x83, 0x99, 0x22, 0x0b, 0x1c, 0x0f, 0x42, 0x53, 0x07, // .. .A...."...BS.
+	0x26, 0x84, 0x03, 0xfa, 0x02, 0xfc, 0x00, 0x11, 0x4f, 0xa3, 0x03, 0x52, 0xd6, 0x09, 0x20, 0x09, // &.......O..R.. .
+	0x61, 0x71, 0x05, 0x25, 0xe7, 0x0a, 0x17, 0x0d, 0xfc, 0x8d, 0x50, 0x66, 0x04, 0x7b, 0xe6, 0x03, // aq.%......Pf.{..
+	0x22, 0x0a, 0x09, 0x95, 0x5c, 0x2a, 0x06, 0x20, 0x3f, 0x7b, 0xe0, 0x03, 0x23, 0x3f, 0x0d, 0x17, // "....*. ?{..#?..
+	0x0a, 0x83, 0x43, 0x69, 0x67, 0x07, 0x20, 0x11, 0x59, 0x43, 0x06, 0x43, 0x74, 0x07, 0x45, 0x2b, // ..Cig. .YC.Ct.E+
+	0x04, 0x20, 0xd5, 0x8b, 0x2d, 0x83, 0x3d, 0x58, 0xc8, 0x03, 0x23, 0xfe, 0x06, 0xfe, 0x06, 0x56, // . ..-.=X..#....V
+	0x86, 0x09, 0x8e, 0x87, 0x21, 0x01, 0x15, 0x43, 0x48, 0x07, 0x4a, 0x6e, 0x07, 0x21, 0x03, 0xfa, // ....!..CH.Jn.!..
+	0x8d, 0x30, 0x29, 0x09, 0x0a, 0x02, 0xbd, 0x3f, 0xfe, 0x06, 0x01, 0xfa, 0x3f, 0x5c, 0xbc, 0x09, // .0)....?....?...
+	0x8d, 0x87, 0x57, 0xa6, 0x0b, 0x43, 0x14, 0x05, 0x21, 0x03, 0x2b, 0x87, 0xba, 0x87, 0x38, 0x21, // ..W..C..!.+...8!
+	0x03, 0xa7, 0x8f, 0xdd, 0x41, 0x8b, 0x0a, 0x82, 0x43, 0x20, 0x05, 0x82, 0xc7, 0x52, 0x47, 0x03, // ....A...C ...RG.
+	0x20, 0x11, 0x4c, 0x9a, 0x06, 0x23, 0x15, 0x33, 0x02, 0x00, 0x7c, 0xd7, 0x04, 0x29, 0x7f, 0xfd, //  .L..#.3..|..)..
+	0x13, 0x12, 0x13, 0x2d, 0x1a, 0xfd, 0x7e, 0x3a, 0x83, 0x36, 0x2a, 0xfd, 0x7e, 0xfe, 0x07, 0x1a, // ...-..~:.6*.~...
+	0x2d, 0x12, 0x13, 0x13, 0xfd, 0x00, 0x8d, 0x3f, 0x21, 0x09, 0x02, 0x82, 0x3c, 0x21, 0x15, 0x23, // -......?!...<!.#
+	0x46, 0x30, 0x08, 0x90, 0x3e, 0x21, 0x03, 0xba, 0x83, 0xd6, 0x23, 0xfd, 0x7e, 0x01, 0xf9, 0x96, // F0..>!....#.~...
+	0x3f, 0x52, 0x21, 0x04, 0x66, 0x65, 0x07, 0x23, 0x35, 0x23, 0x02, 0x00, 0x83, 0xba, 0xa8, 0x3f, // ?R!.fe.#5#.....?
+	0x82, 0xbf, 0x4b, 0xd6, 0x04, 0x47, 0x76, 0x08, 0x90, 0x40, 0x90, 0xbf, 0x50, 0x63, 0x09, 0x20, // ..K..Gv..@..Pc. 
+	0x18, 0x51, 0x07, 0x03, 0x20, 0x17, 0x4d, 0x5d, 0x0b, 0x49, 0x9e, 0x08, 0x22, 0x0e, 0x01, 0x23, // .Q.. .M].I.."..#
+	0x61, 0xdc, 0x07, 0x85, 0x10, 0x44, 0x14, 0x07, 0x43, 0x9f, 0x06, 0x22, 0x73, 0x17, 0x27, 0x4c, // a....D..C.."s.'L
+	0x70, 0x04, 0x24, 0x0f, 0x27, 0x17, 0x17, 0x26, 0x4b, 0xe1, 0x06, 0x30, 0x17, 0x01, 0x81, 0x09, // p.$.'..&K..0....
+	0x13, 0x0c, 0x0b, 0x14, 0x08, 0x01, 0xa8, 0x08, 0x07, 0x09, 0x08, 0xfe, 0xa7, 0x82, 0x0d, 0x27, // ...............'
+	0x0a, 0x13, 0x08, 0xfe, 0x59, 0x08, 0x09, 0x01, 0x82, 0x02, 0x2b, 0x59, 0x3a, 0x27, 0x26, 0x25, // ....Y.....+Y:'&%
+	0x5b, 0x36, 0x36, 0x5c, 0x26, 0x25, 0x26, 0x82, 0x02, 0x32, 0x5c, 0x36, 0x36, 0x5b, 0x25, 0x27, // [66.&%&..2.66[%'
+	0x26, 0x03, 0xe3, 0x08, 0x09, 0x08, 0x07, 0xfe, 0x58, 0x08, 0x14, 0x0b, 0x0b, 0x82, 0x2b, 0x20, // &.......X.....+ 
+	0xa6, 0x82, 0x28, 0x29, 0x01, 0x09, 0x08, 0x01, 0xa6, 0x08, 0x13, 0x0b, 0x0c, 0x13, 0x82, 0x34, // ..()...........4
+	0x83, 0xaf, 0x20, 0x6c, 0x82, 0xaf, 0x20, 0x95, 0x82, 0xaf, 0x22, 0x25, 0x00, 0x2d, 0x51, 0xb7, // .. l.. ..."%.-Q.
+	0x04, 0x22, 0x2f, 0x01, 0x33, 0x51, 0xb6, 0x05, 0x83, 0x94, 0x21, 0x35, 0x0e, 0x43, 0x33, 0x04, // ."/.3Q....!5.C3.
+	0x83, 0x03, 0x63, 0x8b, 0x03, 0x26, 0x35, 0x01, 0x37, 0x35, 0x37, 0x35, 0x27, 0x82, 0x23, 0x33, // ..c..&5.7575'.#3
+	0x37, 0x1f, 0x02, 0x07, 0x03, 0x7c, 0x03, 0x0c, 0x0a, 0x8f, 0x02, 0x0d, 0x1e, 0x12, 0x12, 0x1e, // 7....|..........
+	0x0c, 0xfe, 0x29, 0x08, 0x7a, 0xeb, 0x03, 0x3f, 0x01, 0x18, 0x02, 0x0c, 0x0b, 0x8c, 0x0c, 0x1e, // ..).z..?........
+	0x11, 0x12, 0x1f, 0x0d, 0x01, 0xda, 0x14, 0x05, 0x19, 0xfd, 0xf2, 0x86, 0x16, 0xd0, 0x17, 0x05, // ................
+	0x86, 0xd6, 0x02, 0xdf, 0x10, 0x1a, 0x09, 0x8e, 0x69, 0xdd, 0x03, 0x08, 0x22, 0xfe, 0x27, 0x07, // ........i...".'.
+	0x11, 0x0a, 0x01, 0x09, 0x13, 0x0a, 0xe1, 0x0f, 0x19, 0x0a, 0x8e, 0x0c, 0x0d, 0x0c, 0x0c, 0x01, // ................
+	0x01, 0xdb, 0x21, 0x02, 0x23, 0x01, 0xde, 0xfd, 0x4d, 0x87, 0xd2, 0xd1, 0xc1, 0x09, 0x88, 0xd8, // ..!.#...M.......
+	0x4e, 0xe7, 0x0a, 0x29, 0x04, 0x00, 0x0a, 0x00, 0x0f, 0x00, 0x14, 0x00, 0x00, 0x37, 0x4d, 0x54, // N..).........7MT
+	0x03, 0x78, 0xe0, 0x04, 0x21, 0x17, 0x05, 0x4d, 0x67, 0x04, 0x4d, 0xd7, 0x03, 0x30, 0x85, 0x02, // .x..!..Mg.M..0..
+	0xf6, 0xfd, 0x0a, 0x03, 0x75, 0xfc, 0x0c, 0x02, 0xf7, 0xfd, 0xfe, 0x45, 0x7f, 0x7f, 0xbe, 0x41, // ....u......E...A
+	0x9f, 0x03, 0x20, 0x45, 0x78, 0xca, 0x04, 0x2b, 0x78, 0xfd, 0x09, 0x03, 0xf4, 0xfd, 0x3f, 0x7e, // .. Ex..+x.....?~
+	0x7e, 0xbd, 0xfd, 0xfd, 0x82, 0xe7, 0x4d, 0x1b, 0x07, 0x20, 0x11, 0x4d, 0x1d, 0x04, 0x49, 0x4f, // ~.....M.. .M..IO
+	0x0d, 0x23, 0x09, 0x01, 0x33, 0x05, 0x5b, 0x5a, 0x14, 0x43, 0x85, 0x06, 0x21, 0x03, 0x7b, 0x5a, // .#..3.[Z.C..!.{Z
+	0x59, 0x09, 0x42, 0xfd, 0x05, 0x21, 0xfc, 0xcb, 0x5a, 0x71, 0x13, 0x25, 0x0a, 0x09, 0x03, 0xba, // Y.B..!..Zq.%....
+	0x0a, 0x09, 0x43, 0x14, 0x0d, 0x20, 0x40, 0x54, 0x96, 0x07, 0x88, 0x15, 0x43, 0x86, 0x05, 0x20, // ..C.. @T....C.. 
+	0x74, 0x43, 0xb3, 0x04, 0x20, 0x16, 0x82, 0xe3, 0x22, 0x6a, 0x00, 0x23, 0x43, 0x6f, 0x0d, 0x20, // tC.. ..."j.#Co. 
+	0x01, 0x43, 0x78, 0x0d, 0x83, 0x19, 0x43, 0x81, 0x05, 0x20, 0xeb, 0x4d, 0xfb, 0x06, 0x22, 0x35, // .Cx...C.. .M.."5
+	0xfe, 0x8c, 0x86, 0x07, 0x22, 0x56, 0x01, 0xaa, 0x55, 0xfd, 0x04, 0x20, 0x08, 0x56, 0x05, 0x05, // ...."V..U.. .V..
+	0x21, 0x03, 0x5a, 0x82, 0x15, 0x21, 0xfd, 0x18, 0x4e, 0x47, 0x04, 0x23, 0x01, 0x75, 0xfe, 0xc0, // !.Z..!..NG.#.u..
+	0x85, 0x08, 0x21, 0xaa, 0x01, 0x57, 0x33, 0x04, 0x22, 0x0c, 0xfe, 0xc2, 0x4f, 0x00, 0x03, 0x41, // ..!..W3."...O..A
+	0x0b, 0x0a, 0x5c, 0x5b, 0x04, 0x5b, 0x90, 0x1c, 0x5d, 0x98, 0x1c, 0x21, 0x01, 0xae, 0x55, 0x6f, // ...[.[..]..!..Uo
+	0x05, 0x21, 0x0c, 0xfd, 0x41, 0x06, 0x09, 0x24, 0xfd, 0x0c, 0x16, 0x0a, 0x02, 0x7f, 0x33, 0x03, // .!..A..$......3.
+	0x23, 0x16, 0x0d, 0xfd, 0x0d, 0x87, 0xed, 0x82, 0x0a, 0x41, 0x1c, 0x04, 0x20, 0xa7, 0x5d, 0x7d, // #........A.. .]}
+	0x17, 0x5d, 0x69, 0x1a, 0x20, 0x00, 0x41, 0x27, 0x0d, 0x21, 0x13, 0x33, 0x48, 0x1b, 0x08, 0x45, // .]i. .A'.!.3H..E
+	0x25, 0x09, 0x45, 0x2e, 0x0b, 0x26, 0x3e, 0x01, 0x33, 0x3c, 0x35, 0x01, 0x74, 0x41, 0x1f, 0x05, // %.E..&>.3<5.tA..
+	0x23, 0x01, 0xaa, 0xfe, 0x56, 0x41, 0x1f, 0x05, 0x22, 0xfe, 0x8c, 0x35, 0x4f, 0x3b, 0x09, 0x25, // #...VA.."..5O;.%
+	0x03, 0x6a, 0xfe, 0x8b, 0x01, 0x3e, 0x71, 0x14, 0x03, 0x24, 0x08, 0xfe, 0x56, 0xfe, 0x56, 0x57, // .j...>q..$..V.VW
+	0x93, 0x04, 0x21, 0x01, 0x40, 0x57, 0x7e, 0x05, 0x22, 0x0b, 0x02, 0xe8, 0x84, 0x18, 0x4f, 0x4f, // ..!.@W~.".....OO
+	0x11, 0x41, 0x25, 0x0f, 0x8d, 0x75, 0x21, 0x3b, 0x01, 0x48, 0xb4, 0x0b, 0x82, 0xea, 0x5c, 0x93, // .A%..u!;.H......
+	0x0b, 0x22, 0xfe, 0x06, 0x3f, 0x42, 0x41, 0x0a, 0x56, 0xb0, 0x03, 0x42, 0x31, 0x06, 0x41, 0x12, // ."..?BA.V..B1.A.
+	0x10, 0x21, 0x01, 0xba, 0x45, 0xa7, 0x0d, 0x23, 0xfe, 0x06, 0x01, 0xb9, 0x5d, 0x68, 0x07, 0x48, // .!..E..#....]h.H
+	0x53, 0x0c, 0x20, 0x1c, 0x4a, 0xbd, 0x0d, 0x4b, 0x73, 0x0d, 0x83, 0x81, 0x20, 0xe5, 0x69, 0x83, // S. .J..Ks... .i.
+	0x17, 0x21, 0x03, 0xa5, 0x69, 0x7e, 0x18, 0x8a, 0x5f, 0x20, 0x26, 0x85, 0x5f, 0x48, 0xb2, 0x04, // .!..i~.._ &._H..
+	0x67, 0x6a, 0x0c, 0x67, 0x86, 0x05, 0x2a, 0x1f, 0x01, 0x03, 0xa5, 0x2a, 0x2b, 0x2b, 0x2a, 0x3f, // gj.g..*....*++*?
+	0x25, 0x51, 0x66, 0xe2, 0x04, 0x22, 0x5a, 0x51, 0x25, 0x7e, 0x5e, 0x07, 0x89, 0x11, 0x29, 0x3f, // %Qf.."ZQ%~^...)?
+	0x02, 0xda, 0x3d, 0x8d, 0x50, 0x50, 0x8d, 0x3d, 0x4c, 0x91, 0x1b, 0x87, 0x11, 0x20, 0x4c, 0x82, // ..=.PP.=L.... L.
+	0x73, 0x20, 0x88, 0x82, 0x73, 0x22, 0x78, 0x03, 0xb8, 0x67, 0x15, 0x03, 0x69, 0xe8, 0x04, 0x23, // s ..s"x..g..i..#
+	0x13, 0x17, 0x0f, 0x03, 0x69, 0xb1, 0x03, 0x83, 0xd9, 0x18, 0x40, 0xc1, 0x05, 0x20, 0x03, 0x4f, // ....i.....@.. .O
+	0x22, 0x05, 0x20, 0x36, 0x45, 0x32, 0x04, 0x35, 0x17, 0x07, 0x03, 0x73, 0x07, 0x12, 0x0b, 0x8d, // ". 6E2.5...s....
+	0x95, 0x08, 0x0b, 0x19, 0xd8, 0x2c, 0x0c, 0x12, 0x06, 0xac, 0x73, 0x0a, 0x16, 0x0c, 0x7a, 0x32, // .....,....s...z2
+	0x03, 0x23, 0x09, 0x05, 0x09, 0x08, 0x82, 0x19, 0x42, 0x83, 0x03, 0x3a, 0x73, 0x0a, 0x0e, 0x04, // .#......B..:s...
+	0x05, 0x01, 0xdf, 0x0a, 0x0f, 0x04, 0x35, 0xfe, 0xf6, 0x21, 0x1f, 0x17, 0x62, 0x04, 0x04, 0x0e, // ......5..!..b...
+	0x09, 0x01, 0x09, 0x5e, 0x07, 0x06, 0x01, 0x49, 0xa2, 0x03, 0x22, 0x0c, 0x02, 0xc0, 0x60, 0xcc, // ...^...I.."...`.
+	0x03, 0x2a, 0x0a, 0x01, 0x03, 0x04, 0x07, 0xfe, 0x81, 0x06, 0x13, 0x0c, 0x2d, 0x82, 0x87, 0x26, // .*..........-..&
+	0x08, 0xff, 0xf5, 0x03, 0xea, 0x03, 0x89, 0x4c, 0xc9, 0x04, 0x21, 0x13, 0x16, 0x56, 0xb9, 0x07, // .......L..!..V..
+	0x20, 0x06, 0x57, 0xeb, 0x04, 0x82, 0x85, 0x7f, 0x66, 0x03, 0x78, 0x9a, 0x04, 0x82, 0x9c, 0x83, //  .W.....f.x.....
+	0x07, 0x84, 0x0b, 0x45, 0x1d, 0x03, 0x6f, 0xd1, 0x05, 0x83, 0x9d, 0x08, 0x74, 0x03, 0x1a, 0xd0, // ...E..o.....t...
+	0x14, 0x0a, 0x1d, 0x1e, 0x5c, 0x3e, 0x3e, 0x76, 0x37, 0x38, 0x4c, 0x12, 0x1d, 0xf4, 0x1b, 0x28, // .....>>v78L....(
+	0x0e, 0x0c, 0x07, 0x04, 0x03, 0x03, 0x04, 0x13, 0x0e, 0x13, 0x17, 0x31, 0x1b, 0xb8, 0x0a, 0x07, // ...........1....
+	0x03, 0x03, 0x06, 0x1a, 0x14, 0x02, 0x14, 0x2c, 0x17, 0x17, 0x23, 0x0c, 0x61, 0x01, 0x13, 0x2c, // .......,..#.a..,
+	0x1a, 0x3e, 0x77, 0x39, 0x36, 0x4a, 0x13, 0x02, 0xf3, 0xfe, 0x96, 0x21, 0x51, 0x2f, 0x31, 0x55, // .>w96J.....!Q/1U
+	0x24, 0x23, 0x25, 0x01, 0x03, 0x1e, 0x20, 0x30, 0x45, 0x05, 0x1d, 0x18, 0x13, 0x2a, 0x16, 0x0c, // $#%... 0E....*..
+	0x05, 0x10, 0x1e, 0x0d, 0x11, 0x0c, 0x06, 0x07, 0x01, 0x42, 0x12, 0x24, 0x12, 0x12, 0x17, 0x22, // .........B.$..."
+	0x0b, 0x03, 0x0b, 0x06, 0x05, 0x06, 0x1c, 0x15, 0xac, 0x11, 0x20, 0x0e, 0x23, 0x27, 0x03, 0x01, // .......... .#'..
+	0x20, 0x20, 0x55, 0x03, 0x04, 0x24, 0x7e, 0xff, 0xc8, 0x03, 0x82, 0x5e, 0x83, 0x04, 0x22, 0x25, //   U..$~....^.."%
+	0x00, 0x3f, 0x82, 0xbf, 0x7d, 0x4e, 0x03, 0x22, 0x11, 0x05, 0x06, 0x42, 0x16, 0x08, 0x24, 0x27, // .?..}N."...B..$'
+	0x33, 0x15, 0x23, 0x11, 0x82, 0x03, 0x5f, 0x52, 0x0d, 0x6d, 0x65, 0x09, 0x69, 0x76, 0x0e, 0x29, // 3.#..._R.me.iv.)
+	0x01, 0xa5, 0x09, 0x16, 0x0c, 0x01, 0xb2, 0xfe, 0x4e, 0x0c, 0x6c, 0xfc, 0x05, 0x25, 0xe9, 0x99, // ........N.l..%..
+	0x5c, 0x5c, 0x99, 0x0d, 0x42, 0xc3, 0x07, 0x22, 0x0d, 0x01, 0x9e, 0x42, 0xae, 0x03, 0x20, 0x01, // ....B.."...B.. .
+	0x82, 0x09, 0x83, 0x1f, 0x83, 0x00, 0x21, 0x15, 0x0d, 0x42, 0xce, 0x03, 0x39, 0x4c, 0x0b, 0x0d, // ......!..B..9L..
+	0x02, 0x54, 0xfc, 0x61, 0x53, 0x03, 0x05, 0x07, 0x08, 0x14, 0x0e, 0x03, 0x21, 0x0d, 0x18, 0x0b, // .T.aS.......!...
+	0x6b, 0x7c, 0xfd, 0x1b, 0x7c, 0x09, 0x08, 0x82, 0x2a, 0x21, 0x03, 0x5f, 0x83, 0x40, 0x27, 0x0a, // k|..|...*!._.@'.
+	0xfd, 0xe4, 0x0a, 0x16, 0x0d, 0x0d, 0x15, 0x59, 0x6d, 0x05, 0x83, 0x36, 0x48, 0x81, 0x04, 0x82, // .......Ym..6H...
+	0xb2, 0x25, 0x01, 0x03, 0xff, 0xc6, 0x02, 0xfd, 0x82, 0xc3, 0x20, 0x32, 0x52, 0xbf, 0x07, 0x20, // .%........ 2R.. 
+	0x17, 0x52, 0xc0, 0x0b, 0x20, 0x3d, 0x71, 0x66, 0x04, 0x21, 0x01, 0x37, 0x47, 0x51, 0x11, 0x30, // .R.. =qf.!.7GQ.0
+	0x0f, 0x01, 0x02, 0x6a, 0x14, 0x24, 0x10, 0x13, 0x1b, 0x13, 0x09, 0x01, 0x25, 0x26, 0x24, 0x59, // ...j.$......%&$Y
+	0x35, 0x54, 0x6e, 0x03, 0x33, 0x25, 0x01, 0x09, 0x12, 0x1b, 0x12, 0x11, 0x25, 0x14, 0x1d, 0x1d, // 5Tn.3%......%...
+	0x1c, 0x1c, 0x1d, 0x1b, 0x44, 0x28, 0x28, 0x45, 0x1c, 0x83, 0x00, 0x2d, 0x1f, 0x02, 0x5b, 0x14, // ....D((E...-..[.
+	0x39, 0x24, 0x29, 0x5a, 0x63, 0x6b, 0x39, 0x03, 0x1f, 0x35, 0x74, 0x41, 0x05, 0x32, 0x35, 0x1f, // 9$)Zck9..5tA.25.
+	0x03, 0x39, 0x6b, 0x63, 0x5a, 0x29, 0x24, 0x39, 0x15, 0x18, 0x1c, 0x44, 0x27, 0x28, 0x43, 0x1b, // .9kcZ)$9...D'(C.
+	0x1c, 0x82, 0x35, 0x26, 0x1b, 0x43, 0x28, 0x27, 0x44, 0x1c, 0x19, 0x6a, 0xbf, 0x06, 0x25, 0x00, // ..5&.C('D..j..%.
+	0x55, 0x03, 0xfa, 0x03, 0x2b, 0x45, 0x33, 0x04, 0x20, 0x60, 0x41, 0x5f, 0x04, 0x83, 0x7e, 0x20, // U...+E3. `A_..~ 
+	0x35, 0x82, 0x7f, 0x20, 0x07, 0x51, 0xa3, 0x0c, 0x47, 0xc1, 0x03, 0x46, 0x4c, 0x03, 0x20, 0x15, // 5.. .Q..G..FL. .
+	0x85, 0x20, 0x20, 0x15, 0x8e, 0x20, 0x22, 0x2f, 0x01, 0x37, 0x41, 0x69, 0x05, 0x2a, 0x17, 0x27, // .  .. "/.7Ai.*.'
+	0x11, 0x37, 0x13, 0x21, 0x13, 0x17, 0x03, 0x27, 0x37, 0x6a, 0xdf, 0x05, 0x87, 0x16, 0x86, 0x0e, // .7.!...'7j......
+	0x3b, 0x02, 0x9a, 0x12, 0x2c, 0x19, 0x1a, 0x2d, 0x13, 0x11, 0x12, 0x02, 0x04, 0x10, 0x0d, 0x13, // ;...,..-........
+	0x2d, 0x1a, 0x19, 0x2c, 0x12, 0x0d, 0x12, 0x04, 0x02, 0x12, 0x13, 0xfd, 0xf5, 0x7d, 0xfa, 0x03, // -..,.........}..
+	0x08, 0x38, 0x1a, 0x19, 0x2d, 0x13, 0x13, 0x12, 0x02, 0x03, 0x12, 0x0e, 0x12, 0x2d, 0x1a, 0x1a, // .8..-........-..
+	0x2b, 0x12, 0x0f, 0x13, 0x02, 0x01, 0x7c, 0x23, 0x3c, 0x1a, 0x18, 0x19, 0x01, 0x5c, 0xdd, 0x77, // +.....|#<......w
+	0x01, 0x35, 0x72, 0xf9, 0x11, 0x51, 0x03, 0x19, 0x18, 0x19, 0x3c, 0x24, 0x23, 0x3b, 0x19, 0x19, // .5r..Q....<$#;..
+	0x1a, 0x04, 0x98, 0x02, 0x19, 0x18, 0x1a, 0x3c, 0x23, 0x01, 0x2a, 0x7e, 0x91, 0x03, 0x27, 0x01, // .......<#.*~..'.
+	0x13, 0x2d, 0x19, 0x1e, 0x11, 0x1d, 0x0e, 0x51, 0x48, 0x03, 0x28, 0x0e, 0x20, 0x12, 0x01, 0x19, // .-.....QH.(. ...
+	0x19, 0x2c, 0x13, 0x58, 0x82, 0x50, 0x20, 0x01, 0x7e, 0x57, 0x03, 0x7e, 0x51, 0x03, 0x22, 0x17, // .,.X.P .~W.~Q.".
+	0x13, 0x22, 0x84, 0x1c, 0x3c, 0x10, 0x23, 0x13, 0x14, 0xa9, 0x18, 0x19, 0x19, 0x3c, 0x23, 0x19, // ."..<.#......<#.
+	0x02, 0x01, 0x3b, 0x18, 0x01, 0x1d, 0xfe, 0xf2, 0x27, 0xfe, 0xb3, 0x02, 0x27, 0x22, 0x3d, 0x19, // ..;.....'...'"=.
+	0x19, 0x18, 0x82, 0x17, 0x24, 0x3d, 0x22, 0x22, 0x04, 0x1e, 0x84, 0x0c, 0x56, 0x9b, 0x0b, 0x29, // ....$=""....V..)
+	0x18, 0x00, 0x41, 0x00, 0x5a, 0x00, 0x5f, 0x00, 0x00, 0x25, 0x6b, 0xbd, 0x08, 0x42, 0x5e, 0x0e, // ..A.Z._..%k..B^.
+	0x20, 0x17, 0x44, 0x53, 0x13, 0x6b, 0xda, 0x07, 0x20, 0x27, 0x6c, 0xc0, 0x17, 0x27, 0x27, 0x11, //  .DS.k.. 'l..''.
+	0x23, 0x11, 0x33, 0x03, 0x0d, 0x37, 0x82, 0x00, 0x25, 0x38, 0x86, 0x4f, 0x4f, 0x86, 0x38, 0x89, // #.3..7..%8.OO.8.
+	0x09, 0x22, 0x58, 0x25, 0x51, 0x6b, 0x7c, 0x07, 0x71, 0x1b, 0x04, 0x18, 0x46, 0x98, 0x07, 0x23, // ."X%Qk|.q...F..#
+	0x35, 0x61, 0x59, 0x51, 0x6c, 0xbb, 0x08, 0x28, 0x9b, 0x2a, 0x65, 0x3b, 0x3b, 0x65, 0x29, 0x2a, // 5aYQl..(.*e;;e)*
+	0x29, 0x82, 0x02, 0x83, 0x09, 0x82, 0x08, 0x25, 0x29, 0x29, 0x8b, 0x7e, 0x7e, 0xb3, 0x8f, 0x4d, // )......%)).~~..M
+	0x83, 0x09, 0x20, 0x58, 0x71, 0x51, 0x08, 0x9a, 0x59, 0x20, 0x9b, 0x83, 0x41, 0x8f, 0x55, 0x24, // .. XqQ..Y ..A.U$
+	0x2c, 0x01, 0x3c, 0xfe, 0xc4, 0x49, 0x5b, 0x03, 0x2a, 0x09, 0x00, 0x07, 0x03, 0xe7, 0x03, 0x7d, // ,.<..I[.*......}
+	0x00, 0x1d, 0x00, 0x5e, 0x5b, 0x13, 0x05, 0x20, 0x26, 0x41, 0x05, 0x03, 0x44, 0x32, 0x04, 0x83, // ...^[.. &A..D2..
+	0x03, 0x60, 0xe4, 0x04, 0x57, 0xa3, 0x03, 0x24, 0x2f, 0x02, 0x01, 0x16, 0x06, 0x18, 0x45, 0xc0, // .`..W..$/.....E.
+	0x04, 0x21, 0x02, 0x2f, 0x60, 0xd8, 0x03, 0x23, 0x0f, 0x01, 0x06, 0x22, 0x82, 0x08, 0x44, 0xe9, // .!./`..#..."..D.
+	0x03, 0x44, 0x85, 0x04, 0x20, 0x27, 0x4d, 0xbc, 0x06, 0x18, 0x47, 0x0d, 0x08, 0x20, 0x37, 0x71, // .D.. 'M...G.. 7q
+	0x10, 0x05, 0x44, 0x7e, 0x06, 0x47, 0x8a, 0x03, 0x08, 0xa6, 0x5b, 0x18, 0x30, 0x19, 0x10, 0x1c, // ..D~.G....[.0...
 	0x0b, 0x08, 0x05, 0x03, 0x05, 0x1b, 0x17, 0x0b, 0x15, 0x2c, 0x19, 0x04, 0x0f, 0x18, 0x09, 0x07, // .........,......
 	0x06, 0x01, 0x06, 0x15, 0x10, 0x0b, 0x04, 0x02, 0x18, 0x01, 0x05, 0x06, 0x7e, 0x13, 0x13, 0x1c, // ............~...
 	0x0d, 0x0c, 0x14, 0x43, 0x14, 0x04, 0x06, 0x1b, 0x13, 0x26, 0x12, 0x7f, 0x78, 0x13, 0x19, 0x06, // ...C.....&..x...
@@ -1197,1694 +729,998 @@ static const uint8_t s_iconsKenneyTtf[46184] =
 	0x06, 0x17, 0x2d, 0x15, 0x0c, 0x02, 0x01, 0xc7, 0x0e, 0x18, 0x0b, 0x80, 0x12, 0x25, 0x13, 0x1c, // ..-..........%..
 	0x08, 0x06, 0x14, 0x46, 0x12, 0x0c, 0x0d, 0x1c, 0x14, 0x14, 0x7f, 0x7d, 0x1e, 0x41, 0x23, 0x02, // ...F.......}.A#.
 	0x40, 0x65, 0x26, 0x2b, 0x20, 0x0b, 0x09, 0x2f, 0x27, 0x0c, 0x2b, 0x61, 0x36, 0x02, 0x15, 0x26, // @e&+ ../'.+a6..&
-	0x11, 0x28, 0x43, 0x1b, 0x1c, 0x20, 0x03, 0x03, 0x05, 0x19, 0x13, 0x01, 0x58, 0x0b, 0x09, 0x02, // .(C.. ......X...
-	0x03, 0x0e, 0x0d, 0x0c, 0x0a, 0x16, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x03, 0xfa, // ................
-	0x03, 0x7a, 0x00, 0x04, 0x00, 0x09, 0x00, 0x3e, 0x00, 0x00, 0x13, 0x23, 0x15, 0x33, 0x35, 0x21, // .z.....>...#.35!
-	0x23, 0x15, 0x33, 0x35, 0x37, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x33, 0x32, // #.357......+..32
-	0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x21, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, // ......!5467>.;.5
-	0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, // #"&'..5.467>.;.5
-	0x21, 0x15, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0xc4, 0x3f, 0x3f, 0x02, 0xb7, 0x3f, 0x3f, // !.32......??..??
-	0x7f, 0x13, 0x13, 0x13, 0x2c, 0x1a, 0xfd, 0xbe, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0xfd, 0x0a, 0x08, // ....,...........
-	0x09, 0x0a, 0x17, 0x0d, 0xbe, 0xfd, 0x1b, 0x2d, 0x12, 0x12, 0x13, 0x09, 0x09, 0x09, 0x17, 0x0e, // .......-........
-	0x7e, 0x02, 0x78, 0x7e, 0x0d, 0x16, 0x0a, 0x09, 0x0a, 0x02, 0x7e, 0xfd, 0xfd, 0xfd, 0xfd, 0x3f, // ~.x~......~....?
-	0xfe, 0xc4, 0x1b, 0x2d, 0x12, 0x12, 0x13, 0x7e, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0x3f, 0x3d, 0x0e, // ...-...~.....?=.
-	0x17, 0x09, 0x0a, 0x09, 0x7e, 0x13, 0x12, 0x13, 0x2d, 0x1a, 0x01, 0x3a, 0x0e, 0x17, 0x09, 0x0a, // ....~...-..:....
-	0x09, 0x7e, 0x7e, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0x00, 0x01, 0x00, 0x07, 0x00, 0x23, 0x03, 0xf9, // .~~..........#..
-	0x03, 0x5d, 0x00, 0x1c, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x16, 0x06, 0x07, 0x01, 0x07, 0x23, // .].............#
-	0x2e, 0x01, 0x27, 0x01, 0x2e, 0x01, 0x37, 0x34, 0x36, 0x3f, 0x01, 0x3e, 0x01, 0x33, 0x21, 0x32, // ..'...746?.>.3!2
-	0x16, 0x1f, 0x01, 0x03, 0xe6, 0x09, 0x0a, 0x01, 0x07, 0x07, 0xfe, 0x43, 0x1d, 0x23, 0x09, 0x0f, // ...........C.#..
-	0x05, 0xfe, 0x44, 0x09, 0x07, 0x01, 0x09, 0x09, 0xb2, 0x09, 0x15, 0x0c, 0x02, 0x08, 0x0c, 0x15, // ..D.............
-	0x08, 0xc0, 0x02, 0x9c, 0x08, 0x15, 0x0d, 0x0b, 0x15, 0x0a, 0xfd, 0xef, 0x14, 0x03, 0x0a, 0x07, // ................
-	0x02, 0x11, 0x0a, 0x15, 0x0b, 0x0c, 0x14, 0x08, 0xb0, 0x0a, 0x09, 0x09, 0x08, 0xb0, 0x00, 0x00, // ................
-	0x00, 0x02, 0x00, 0x9b, 0xff, 0xc6, 0x03, 0x65, 0x03, 0xba, 0x00, 0x18, 0x00, 0x3b, 0x00, 0x00, // .......e.....;..
-	0x01, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, // ."..........3267
-	0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x05, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, // >.54&'..#.......
-	0x11, 0x0f, 0x01, 0x2f, 0x01, 0x0f, 0x01, 0x2f, 0x01, 0x11, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, // .../.../....'..5
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x02, 0x00, 0x26, 0x40, // 467>.32.......&@
-	0x1a, 0x19, 0x1a, 0x1a, 0x19, 0x1a, 0x40, 0x26, 0x25, 0x40, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, 0x1a, // ......@&%@......
-	0x40, 0x25, 0x01, 0x65, 0x34, 0x34, 0x18, 0x34, 0x1c, 0x08, 0x13, 0x13, 0x67, 0x67, 0x13, 0x13, // @%.e44.4....gg..
-	0x08, 0x1d, 0x36, 0x18, 0x33, 0x32, 0x32, 0x33, 0x34, 0x80, 0x4c, 0x4a, 0x7f, 0x34, 0x34, 0x34, // ..6.32234.LJ.444
-	0x03, 0x07, 0x1a, 0x1a, 0x1a, 0x40, 0x25, 0x24, 0x3f, 0x1a, 0x1b, 0x1b, 0x1b, 0x1b, 0x1a, 0x3f, // .....@%$?......?
-	0x24, 0x25, 0x40, 0x1a, 0x1a, 0x1a, 0xb1, 0x4a, 0x7e, 0x34, 0x19, 0x26, 0x0d, 0xfe, 0xd3, 0x13, // $%@....J~4.&....
-	0x08, 0x06, 0x67, 0x67, 0x06, 0x08, 0x13, 0x01, 0x2b, 0x0f, 0x26, 0x19, 0x34, 0x7e, 0x4a, 0x4a, // ..gg....+.&.4~JJ
-	0x7f, 0x34, 0x33, 0x34, 0x34, 0x33, 0x34, 0x7f, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x39, // .434434.J......9
-	0xff, 0xc6, 0x03, 0xc8, 0x03, 0xba, 0x00, 0x2e, 0x00, 0x47, 0x00, 0x00, 0x01, 0x14, 0x06, 0x07, // .........G......
-	0x17, 0x13, 0x17, 0x0f, 0x01, 0x27, 0x0f, 0x02, 0x27, 0x03, 0x27, 0x07, 0x27, 0x07, 0x03, 0x07, // .....'..'.'.'...
-	0x2f, 0x02, 0x07, 0x2f, 0x01, 0x26, 0x36, 0x37, 0x13, 0x37, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, // /../.&67.7..5467
-	0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x07, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, // >.32......4&'..#
-	0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, // "..........3267>
-	0x01, 0x35, 0x03, 0x6e, 0x23, 0x23, 0x02, 0x99, 0x05, 0x10, 0x13, 0x8f, 0x26, 0x0f, 0x14, 0x11, // .5.n##......&...
-	0x99, 0x01, 0x20, 0x22, 0x03, 0x99, 0x11, 0x14, 0x0f, 0x26, 0x8e, 0x14, 0x0f, 0x01, 0x02, 0x03, // .. ".....&......
-	0x9a, 0x03, 0x23, 0x22, 0x34, 0x33, 0x36, 0x82, 0x4e, 0x4c, 0x81, 0x35, 0x35, 0x35, 0xb6, 0x1b, // ..#"436.NL.555..
-	0x1a, 0x1b, 0x40, 0x26, 0x27, 0x41, 0x1b, 0x1a, 0x1a, 0x1a, 0x1a, 0x1b, 0x41, 0x27, 0x26, 0x40, // ..@&'A......A'&@
-	0x1b, 0x1a, 0x1b, 0x02, 0x4f, 0x3d, 0x6c, 0x2f, 0x02, 0xfe, 0xf5, 0x13, 0x11, 0x05, 0x26, 0x8e, // ....O=l/......&.
-	0x10, 0x03, 0x0c, 0x01, 0x0c, 0x04, 0x01, 0x01, 0x04, 0xfe, 0xf4, 0x0c, 0x03, 0x10, 0x8e, 0x26, // ...............&
-	0x05, 0x11, 0x05, 0x0a, 0x04, 0x01, 0x0c, 0x03, 0x2e, 0x6b, 0x3d, 0x4c, 0x81, 0x35, 0x34, 0x35, // .........k=L.545
-	0x35, 0x34, 0x35, 0x81, 0x4c, 0x02, 0x26, 0x41, 0x1a, 0x1b, 0x1a, 0x1a, 0x1b, 0x1a, 0x41, 0x26, // 545.L.&A......A&
-	0x25, 0x40, 0x1a, 0x1c, 0x1b, 0x1b, 0x1c, 0x1a, 0x40, 0x25, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, // %@......@%......
-	0x00, 0x6f, 0x03, 0xfa, 0x03, 0x11, 0x00, 0x04, 0x00, 0x09, 0x00, 0x12, 0x00, 0x17, 0x00, 0x00, // .o..............
-	0x13, 0x33, 0x35, 0x23, 0x15, 0x01, 0x23, 0x15, 0x33, 0x35, 0x27, 0x21, 0x11, 0x21, 0x11, 0x21, // .35#..#.35'!.!.!
-	0x11, 0x21, 0x35, 0x01, 0x15, 0x33, 0x35, 0x23, 0x77, 0x70, 0x70, 0x01, 0xc1, 0x70, 0x70, 0xe1, // .!5..35#wpp..pp.
-	0x01, 0x52, 0x01, 0x51, 0xfc, 0x0c, 0x01, 0x51, 0x01, 0xc2, 0x70, 0x70, 0x01, 0x50, 0x70, 0x70, // .R.Q...Q..pp.Ppp
-	0x01, 0x51, 0x71, 0x71, 0x70, 0xfe, 0xaf, 0xfe, 0xaf, 0x01, 0xc1, 0xe1, 0xfe, 0x3f, 0x71, 0x71, // .Qqqp........?qq
-	0x00, 0x04, 0x00, 0x06, 0x00, 0x20, 0x03, 0xfa, 0x03, 0x60, 0x00, 0x06, 0x00, 0x23, 0x00, 0x47, // ..... ...`...#.G
-	0x00, 0x74, 0x00, 0x00, 0x01, 0x15, 0x33, 0x15, 0x33, 0x35, 0x23, 0x03, 0x34, 0x26, 0x27, 0x2e, // .t....3.35#.4&'.
-	0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x17, 0x3e, 0x01, 0x33, 0x1f, 0x01, 0x0f, 0x02, // .#"......>.3....
-	0x15, 0x33, 0x35, 0x23, 0x3f, 0x02, 0x05, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x37, 0x35, 0x23, // .35#?..4&'..'75#
-	0x15, 0x33, 0x07, 0x15, 0x37, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x0f, 0x01, 0x22, 0x26, 0x27, // .3..72......."&'
-	0x07, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x03, 0x1e, 0x01, 0x15, 0x11, 0x33, // ...3267>.5.....3
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, // 2...........#!"&
-	0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x11, 0x34, 0x36, 0x37, // '..5.467>.;..467
-	0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x01, 0xc5, 0x2b, 0x2e, 0x59, 0x9b, 0x0b, 0x0a, 0x0a, // >.3!2....+.Y....
-	0x17, 0x0d, 0x0d, 0x16, 0x08, 0x09, 0x10, 0x08, 0x25, 0x09, 0x12, 0x09, 0x12, 0x07, 0x09, 0x19, // ........%.......
-	0x3b, 0x90, 0x52, 0x25, 0x1e, 0x09, 0x02, 0x3b, 0x07, 0x07, 0x06, 0x14, 0x0c, 0x2b, 0x80, 0x42, // ;.R%...;.....+.B
-	0x29, 0x1d, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x09, 0x17, 0x0c, 0x1a, 0x0e, 0x14, 0x12, 0x23, 0x11, // ).............#.
-	0x11, 0x1c, 0x0c, 0x0b, 0x0b, 0xa7, 0x09, 0x09, 0xee, 0x0c, 0x15, 0x09, 0x09, 0x09, 0x09, 0x09, // ................
-	0x09, 0x15, 0x0c, 0xfc, 0x84, 0x0d, 0x15, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x15, 0x0d, 0xd0, // ................
-	0x08, 0x08, 0x09, 0x16, 0x0d, 0x01, 0x47, 0x0c, 0x14, 0x09, 0x02, 0xcc, 0x28, 0xa9, 0xd1, 0xfe, // ......G.....(...
-	0x5c, 0x0f, 0x18, 0x09, 0x07, 0x08, 0x06, 0x06, 0x05, 0x11, 0x0b, 0x16, 0x0e, 0x0e, 0x06, 0x12, // ................
-	0x16, 0x1c, 0x3d, 0x22, 0x29, 0x25, 0x26, 0x1d, 0x4d, 0x0b, 0x14, 0x08, 0x08, 0x0a, 0x02, 0x30, // ..=")%&.M......0
-	0x21, 0x28, 0x2f, 0x20, 0x04, 0x03, 0x04, 0x04, 0x0a, 0x07, 0x13, 0x06, 0x0a, 0x0b, 0x26, 0x0b, // !(/ ..........&.
-	0x0c, 0x09, 0x08, 0x09, 0x1a, 0x10, 0x02, 0x74, 0x09, 0x15, 0x0c, 0xfe, 0xb9, 0x09, 0x09, 0x09, // .......t........
-	0x15, 0x0c, 0xfe, 0xb9, 0x0d, 0x15, 0x09, 0x08, 0x08, 0x08, 0x08, 0x09, 0x15, 0x0d, 0x01, 0x46, // ...............F
-	0x0c, 0x16, 0x09, 0x09, 0x09, 0x01, 0x45, 0x0d, 0x16, 0x09, 0x08, 0x09, 0x09, 0x08, 0x00, 0x00, // ......E.........
-	0x00, 0x02, 0x00, 0x17, 0xff, 0xc6, 0x03, 0xe9, 0x03, 0xba, 0x00, 0x14, 0x00, 0x35, 0x00, 0x00, // .............5..
-	0x13, 0x32, 0x16, 0x1f, 0x01, 0x11, 0x0f, 0x01, 0x23, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, // .2......#'..5.46
-	0x37, 0x3e, 0x01, 0x3b, 0x01, 0x17, 0x1e, 0x03, 0x17, 0x32, 0x16, 0x1f, 0x01, 0x15, 0x07, 0x0e, // 7>.;.....2......
-	0x03, 0x27, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x36, // .'"&'..5.467>.76
-	0x16, 0x17, 0xaf, 0x06, 0x0a, 0x05, 0x09, 0x09, 0x15, 0x7b, 0x14, 0x05, 0x04, 0x04, 0x05, 0x04, // .........{......
-	0x0a, 0x06, 0x7b, 0x86, 0x51, 0xa3, 0xa6, 0xaa, 0x56, 0x06, 0x09, 0x04, 0x07, 0x06, 0x48, 0xa0, // ..{.Q...V.....H.
-	0xb0, 0xbf, 0x68, 0x06, 0x0a, 0x04, 0x04, 0x04, 0x03, 0x04, 0x04, 0x09, 0x06, 0x05, 0x0a, 0x04, // ..h.............
-	0x03, 0xba, 0x05, 0x04, 0x15, 0xfc, 0x48, 0x15, 0x09, 0x09, 0x05, 0x0a, 0x06, 0x03, 0xb8, 0x06, // ......H.........
-	0x0a, 0x05, 0x04, 0x05, 0x2a, 0x35, 0x55, 0x3e, 0x27, 0x08, 0x06, 0x04, 0x13, 0x12, 0x13, 0x5a, // ....*5U>'......Z
-	0x81, 0x51, 0x1f, 0x09, 0x05, 0x03, 0x05, 0x0a, 0x06, 0x02, 0x47, 0x05, 0x09, 0x05, 0x04, 0x05, // .Q........G.....
-	0x01, 0x01, 0x03, 0x04, 0x00, 0x05, 0x00, 0x06, 0xff, 0xd8, 0x03, 0xfa, 0x03, 0xa8, 0x00, 0x04, // ................
-	0x00, 0x09, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x22, 0x00, 0x00, 0x13, 0x37, 0x01, 0x07, 0x01, 0x3f, // ......."...7...?
-	0x01, 0x17, 0x07, 0x27, 0x13, 0x01, 0x37, 0x01, 0x07, 0x01, 0x1f, 0x01, 0x07, 0x17, 0x01, 0x23, // ...'..7........#
-	0x07, 0x27, 0x01, 0x27, 0x07, 0x27, 0x01, 0x37, 0x0f, 0x01, 0x27, 0x37, 0x17, 0x7d, 0x57, 0x01, // .'.'.'.7..'7.}W.
-	0x56, 0x56, 0xfe, 0xa9, 0x79, 0x55, 0xab, 0x55, 0xab, 0x67, 0xfe, 0xa9, 0x55, 0x01, 0x57, 0x55, // VV..yU.U.g..U.WU
-	0x01, 0xf0, 0xab, 0x02, 0x57, 0x55, 0xfe, 0xfe, 0xa9, 0x45, 0x7d, 0x01, 0x9b, 0x62, 0xac, 0x54, // ....WU...E}..b.T
-	0x01, 0x01, 0x88, 0xde, 0x57, 0xab, 0x57, 0xab, 0x02, 0x5d, 0x57, 0xfe, 0xa3, 0x57, 0x01, 0x5d, // ....W.W..]W..W.]
-	0x7b, 0x56, 0xae, 0x57, 0xaf, 0xfd, 0xae, 0x01, 0x5d, 0x57, 0xfe, 0xa3, 0x57, 0x02, 0xaa, 0xaf, // {V.W....]W..W...
-	0xb0, 0x56, 0x57, 0xfe, 0xfa, 0x46, 0x7f, 0x01, 0xa3, 0x63, 0xae, 0x58, 0x01, 0x05, 0x24, 0x36, // .VW..F...c.X..$6
-	0x56, 0xae, 0x56, 0xae, 0x00, 0x06, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x04, // V.V.............
-	0x00, 0x2d, 0x00, 0x32, 0x00, 0x41, 0x00, 0x46, 0x00, 0x4b, 0x00, 0x00, 0x13, 0x17, 0x37, 0x27, // .-.2.A.F.K....7'
-	0x07, 0x07, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, // ..4>.7>.32......
-	0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x25, 0x17, // ......#"..'..5%.
-	0x37, 0x27, 0x07, 0x25, 0x0f, 0x01, 0x17, 0x37, 0x17, 0x07, 0x17, 0x37, 0x33, 0x37, 0x27, 0x37, // 7'.%...7...737'7
-	0x2f, 0x01, 0x27, 0x07, 0x17, 0x37, 0x27, 0x0f, 0x01, 0x17, 0x37, 0x27, 0xd4, 0xbd, 0x2f, 0xbd, // /.'..7'...7'../.
-	0x2f, 0xce, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x34, 0x61, 0x59, 0x52, 0x24, // /..$8$%RZa54aYR$
-	0x26, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x26, 0x24, 0x52, 0x59, 0x61, 0x34, 0x35, 0x61, 0x5a, // &8%..%8&$RYa45aZ
-	0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x01, 0x10, 0xbd, 0x31, 0xbf, 0x2f, 0x01, 0x8e, 0x4b, 0x8e, // R%$8$....1./..K.
-	0x2f, 0x5e, 0x36, 0xe4, 0x46, 0x27, 0x5e, 0x8e, 0x2f, 0x30, 0x01, 0x5f, 0xd9, 0x30, 0x5f, 0x2f, // /^6.F'^./0._.0_/
-	0x5e, 0x43, 0x2f, 0x5f, 0x2f, 0x5f, 0x01, 0xd8, 0xc1, 0x31, 0xc0, 0x30, 0x18, 0x34, 0x62, 0x59, // ^C/_/_...1.0.4bY
-	0x52, 0x26, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x26, 0x52, 0x59, 0x62, 0x34, 0x35, // R&$8$..$8$&RYb45
-	0x61, 0x59, 0x52, 0x25, 0x25, 0x37, 0x25, 0x13, 0x13, 0x25, 0x37, 0x25, 0x25, 0x52, 0x59, 0x61, // aYR%%7%..%7%%RYa
-	0x35, 0x5d, 0xc2, 0x30, 0xc1, 0x2f, 0x73, 0x13, 0x90, 0x32, 0x62, 0x38, 0xe8, 0x46, 0x27, 0x91, // 5].0./s..2b8.F'.
-	0x2f, 0x30, 0x62, 0x60, 0x44, 0x30, 0x61, 0x30, 0x61, 0x44, 0x30, 0x60, 0x2f, 0x61, 0x00, 0x00, // /0b`D0a0aD0`/a..
-	0x00, 0x01, 0x00, 0x06, 0x00, 0x05, 0x03, 0xfa, 0x03, 0x7b, 0x00, 0x25, 0x00, 0x00, 0x25, 0x01, // .........{.%..%.
-	0x23, 0x3e, 0x01, 0x35, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x07, 0x0e, 0x01, 0x0f, // #>.5..'..'......
-	0x01, 0x31, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x14, // .1'..'&.........
-	0x16, 0x17, 0x23, 0x01, 0x02, 0x00, 0x01, 0xbf, 0x02, 0x1f, 0x1e, 0x02, 0x2c, 0x2b, 0x0e, 0x1e, // ..#.........,+..
-	0x11, 0x20, 0x49, 0x29, 0x3c, 0x66, 0x2a, 0x06, 0x06, 0x2a, 0x66, 0x3c, 0x29, 0x49, 0x20, 0x11, // . I)<f*..*f<)I .
-	0x1e, 0x0e, 0x2b, 0x2c, 0x02, 0x1e, 0x1f, 0x02, 0x01, 0xbf, 0x05, 0x01, 0xb1, 0x26, 0x5a, 0x33, // ..+,.........&Z3
-	0x3a, 0x62, 0x28, 0x0d, 0x17, 0x08, 0x12, 0x11, 0x01, 0x01, 0x2b, 0x2a, 0x06, 0x06, 0x2a, 0x2b, // :b(.......+*..*+
-	0x01, 0x01, 0x11, 0x12, 0x08, 0x17, 0x0d, 0x28, 0x62, 0x3a, 0x33, 0x5a, 0x26, 0xfe, 0x4f, 0x00, // .......(b:3Z&.O.
-	0x00, 0x01, 0x00, 0x06, 0x00, 0x05, 0x02, 0x00, 0x03, 0x7b, 0x00, 0x13, 0x00, 0x00, 0x01, 0x31, // .........{.....1
-	0x27, 0x2e, 0x01, 0x27, 0x26, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x14, 0x16, 0x17, // '..'&...........
-	0x23, 0x01, 0x02, 0x00, 0x06, 0x2a, 0x66, 0x3c, 0x29, 0x49, 0x21, 0x10, 0x1e, 0x0e, 0x2b, 0x2c, // #....*f<)I!...+,
-	0x02, 0x1e, 0x1f, 0x02, 0x01, 0xbf, 0x03, 0x1f, 0x06, 0x2a, 0x2b, 0x01, 0x01, 0x11, 0x12, 0x09, // .........*+.....
-	0x16, 0x0d, 0x28, 0x62, 0x3a, 0x33, 0x5a, 0x26, 0xfe, 0x4f, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, // ..(b:3Z&.O......
-	0x00, 0x05, 0x03, 0xfa, 0x03, 0x7b, 0x00, 0x03, 0x00, 0x29, 0x00, 0x3b, 0x00, 0x00, 0x25, 0x39, // .....{...).;..%9
-	0x02, 0x09, 0x02, 0x33, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x17, // ...3..7>.7>.7>..
-	0x1e, 0x01, 0x1f, 0x01, 0x31, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, // ....17>.76......
-	0x01, 0x17, 0x16, 0x06, 0x07, 0x33, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x0f, // .....3'..'..#"..
-	0x02, 0x11, 0x01, 0x3e, 0x01, 0x3d, 0x01, 0x02, 0x00, 0x01, 0xbf, 0xfe, 0x41, 0xfe, 0x41, 0x02, // ...>.=......A.A.
-	0x1f, 0x1f, 0x01, 0x02, 0x2c, 0x2b, 0x0e, 0x1e, 0x11, 0x20, 0x49, 0x29, 0x3c, 0x66, 0x2a, 0x06, // ....,+... I)<f*.
-	0x06, 0x2a, 0x66, 0x3c, 0x29, 0x49, 0x20, 0x11, 0x1e, 0x0e, 0x2b, 0x2c, 0x02, 0x01, 0x1f, 0x1f, // .*f<)I ...+,....
-	0x02, 0x72, 0x01, 0x13, 0x13, 0x14, 0x30, 0x1c, 0x1a, 0x2d, 0x13, 0x06, 0x66, 0x01, 0x30, 0x0f, // .r....0..-..f.0.
-	0x0e, 0x05, 0x01, 0xb1, 0xfe, 0x4f, 0x01, 0xb1, 0x26, 0x5a, 0x33, 0x3a, 0x62, 0x28, 0x0d, 0x17, // .....O..&Z3:b(..
-	0x08, 0x12, 0x11, 0x01, 0x01, 0x2b, 0x2a, 0x06, 0x06, 0x2a, 0x2b, 0x01, 0x01, 0x11, 0x12, 0x08, // .....+*..*+.....
-	0x17, 0x0d, 0x28, 0x62, 0x3a, 0x33, 0x5a, 0x26, 0x9e, 0x1a, 0x2c, 0x12, 0x14, 0x13, 0x10, 0x11, // ..(b:3Z&..,.....
-	0x06, 0x58, 0xfe, 0x77, 0x01, 0x32, 0x12, 0x2a, 0x18, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, // .X.w.2.*........
-	0x00, 0x05, 0x03, 0xfa, 0x03, 0x7b, 0x00, 0x25, 0x00, 0x46, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x27, // .....{.%.F.....'
-	0x2e, 0x01, 0x27, 0x2e, 0x01, 0x07, 0x0e, 0x01, 0x0f, 0x01, 0x31, 0x27, 0x2e, 0x01, 0x27, 0x26, // ..'.......1'..'&
-	0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x14, 0x16, 0x17, 0x23, 0x09, 0x01, 0x23, 0x3e, // ...........#..#>
-	0x01, 0x35, 0x07, 0x14, 0x06, 0x07, 0x09, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, // .5........=.467>
-	0x01, 0x33, 0x32, 0x16, 0x1f, 0x02, 0x3f, 0x01, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, // .32...?.>.32....
-	0x17, 0x15, 0x03, 0xfa, 0x02, 0x2c, 0x2b, 0x0e, 0x1e, 0x11, 0x20, 0x49, 0x29, 0x3c, 0x66, 0x2a, // .....,+... I)<f*
-	0x06, 0x06, 0x2a, 0x66, 0x3c, 0x29, 0x49, 0x20, 0x11, 0x1e, 0x0e, 0x2b, 0x2c, 0x02, 0x1e, 0x1f, // ..*f<)I ...+,...
-	0x02, 0x01, 0xbf, 0x01, 0xbf, 0x02, 0x1f, 0x1e, 0xad, 0x0e, 0x0f, 0xfe, 0xd0, 0xfe, 0xd0, 0x0f, // ................
-	0x0e, 0x14, 0x13, 0x14, 0x30, 0x1c, 0x1a, 0x2d, 0x13, 0x06, 0x66, 0x66, 0x06, 0x13, 0x2d, 0x1a, // ....0..-..ff..-.
-	0x1c, 0x30, 0x14, 0x13, 0x13, 0x01, 0x02, 0x69, 0x3a, 0x62, 0x28, 0x0d, 0x16, 0x09, 0x12, 0x11, // .0.....i:b(.....
-	0x01, 0x01, 0x2b, 0x2a, 0x06, 0x06, 0x2a, 0x2b, 0x01, 0x01, 0x11, 0x12, 0x09, 0x16, 0x0d, 0x28, // ..+*..*+.......(
-	0x62, 0x3a, 0x33, 0x5a, 0x26, 0xfe, 0x4f, 0x01, 0xb1, 0x26, 0x5a, 0x33, 0x19, 0x17, 0x2a, 0x12, // b:3Z&.O..&Z3..*.
-	0xfe, 0xce, 0x01, 0x32, 0x12, 0x2a, 0x17, 0x04, 0x1a, 0x2c, 0x12, 0x13, 0x14, 0x10, 0x11, 0x06, // ...2.*...,......
-	0x59, 0x59, 0x06, 0x10, 0x11, 0x14, 0x13, 0x12, 0x2c, 0x1b, 0x03, 0x00, 0x00, 0x01, 0x00, 0x06, // YY......,.......
-	0xff, 0xe6, 0x03, 0xfa, 0x03, 0x9a, 0x00, 0x0a, 0x00, 0x00, 0x17, 0x0b, 0x01, 0x25, 0x37, 0x17, // .............%7.
-	0x05, 0x0b, 0x01, 0x25, 0x05, 0xc7, 0x0e, 0xb3, 0x01, 0x30, 0xcc, 0xc8, 0x01, 0x30, 0xb3, 0x11, // ...%.....0...0..
-	0xfe, 0xcc, 0xfe, 0xc5, 0x1a, 0x01, 0x3f, 0x01, 0x0b, 0x70, 0xfa, 0xfa, 0x70, 0xfe, 0xf5, 0xfe, // ......?..p..p...
-	0xc1, 0x54, 0x54, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xe7, 0x02, 0x00, 0x03, 0x99, 0x00, 0x05, // .TT.............
-	0x00, 0x00, 0x01, 0x05, 0x1b, 0x01, 0x25, 0x11, 0x01, 0x35, 0xfe, 0xd1, 0xb2, 0x0f, 0x01, 0x39, // ......%..5.....9
-	0x02, 0xa0, 0x70, 0xfe, 0xf6, 0xfe, 0xc1, 0x54, 0x03, 0x5e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, // ..p....T.^......
-	0xff, 0xe6, 0x03, 0xfa, 0x03, 0x9a, 0x00, 0x0a, 0x00, 0x10, 0x00, 0x00, 0x17, 0x0b, 0x01, 0x25, // ...............%
-	0x37, 0x17, 0x05, 0x0b, 0x01, 0x25, 0x05, 0x25, 0x17, 0x3f, 0x01, 0x2f, 0x01, 0xc7, 0x0e, 0xb3, // 7....%.%.?./....
-	0x01, 0x30, 0xcc, 0xc8, 0x01, 0x30, 0xb3, 0x11, 0xfe, 0xcc, 0xfe, 0xc5, 0x01, 0x3d, 0xb0, 0x0a, // .0...0.......=..
-	0x66, 0xad, 0x73, 0x1a, 0x01, 0x3f, 0x01, 0x0b, 0x70, 0xfa, 0xfa, 0x70, 0xfe, 0xf5, 0xfe, 0xc1, // f.s..?..p..p....
-	0x54, 0x54, 0xfb, 0x30, 0xb6, 0x98, 0x40, 0x8e, 0x00, 0x02, 0x00, 0x06, 0xff, 0xe6, 0x03, 0xfa, // TT.0..@.........
-	0x03, 0x9a, 0x00, 0x0a, 0x00, 0x15, 0x00, 0x00, 0x17, 0x0b, 0x01, 0x25, 0x37, 0x17, 0x05, 0x0b, // ...........%7...
-	0x01, 0x25, 0x05, 0x3f, 0x01, 0x17, 0x3f, 0x01, 0x2f, 0x01, 0x0f, 0x01, 0x1f, 0x01, 0xc7, 0x0e, // .%.?..?./.......
-	0xb3, 0x01, 0x30, 0xcc, 0xc8, 0x01, 0x30, 0xb3, 0x11, 0xfe, 0xcc, 0xfe, 0xc5, 0x8a, 0xb3, 0xb0, // ..0...0.........
-	0x0a, 0x66, 0xad, 0x73, 0x74, 0xad, 0x66, 0x08, 0x1a, 0x01, 0x3f, 0x01, 0x0b, 0x70, 0xfa, 0xfa, // .f.st.f...?..p..
-	0x70, 0xfe, 0xf5, 0xfe, 0xc1, 0x54, 0x54, 0xcb, 0x30, 0x30, 0xb6, 0x98, 0x40, 0x8e, 0x8e, 0x40, // p....TT.00..@..@
-	0x98, 0xb6, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1b, // ................
-	0x00, 0x27, 0x00, 0x33, 0x00, 0x5c, 0x00, 0x00, 0x01, 0x27, 0x23, 0x11, 0x33, 0x32, 0x36, 0x37, // .'.3.....'#.3267
-	0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x3f, 0x01, 0x3e, 0x01, 0x35, 0x34, 0x26, // >.54&'..'?.>.54&
-	0x27, 0x2e, 0x01, 0x27, 0x07, 0x33, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x23, 0x35, // '..'.3........#5
-	0x35, 0x33, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x23, 0x35, 0x13, 0x32, 0x1e, 0x02, // 53........#5.2..
-	0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, // ..........#"..'.
-	0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x02, 0x58, 0x4d, 0xa9, 0xbf, 0x2d, 0x3f, // .54>.7>.3.XM..-?
-	0x13, 0x0f, 0x0f, 0x0c, 0x0c, 0x0d, 0x20, 0x14, 0x10, 0x10, 0x10, 0x11, 0x0f, 0x0f, 0x08, 0x18, // ...... .........
-	0x10, 0x96, 0x3b, 0x45, 0x0c, 0x0c, 0x0b, 0x0b, 0x3e, 0x44, 0x30, 0x3d, 0x09, 0x09, 0x0a, 0x09, // ..;E....>D0=....
-	0x3c, 0x30, 0x3e, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, // <0>5aYQ%%8%..%8%
-	0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, // %QYa55aZR%$8$..$
-	0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x02, 0x84, 0x09, 0xfe, 0x66, 0x13, 0x14, 0x10, 0x26, // 8$%RZa5....f...&
-	0x16, 0x13, 0x20, 0x0e, 0x0c, 0x11, 0x04, 0x06, 0x0b, 0x0c, 0x24, 0x17, 0x14, 0x24, 0x11, 0x09, // .. .......$..$..
-	0x0d, 0x05, 0xe5, 0x0a, 0x04, 0x12, 0x0e, 0x0e, 0x14, 0x05, 0x0a, 0x5f, 0xa1, 0x08, 0x05, 0x13, // ..........._....
-	0x0e, 0x0d, 0x11, 0x05, 0x08, 0x59, 0x01, 0x7a, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, // .....Y.z.$8$%RZa
-	0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, // 55aYQ%%8%..%8%%Q
-	0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x00, 0x01, 0x00, 0x19, // Ya55aZR%$8$.....
-	0xff, 0xc7, 0x03, 0x88, 0x03, 0xba, 0x00, 0x38, 0x00, 0x00, 0x01, 0x11, 0x0e, 0x01, 0x07, 0x23, // .......8.......#
-	0x0e, 0x01, 0x07, 0x23, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, // ...#.&'..7>.7>.7
-	0x33, 0x35, 0x21, 0x11, 0x16, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x07, 0x23, 0x06, 0x26, 0x27, 0x2e, // 35!........#.&'.
-	0x01, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x3e, 0x01, 0x37, 0x33, 0x17, 0x11, 0x26, 0x36, 0x17, 0x21, // .7>.?.>.73..&6.!
-	0x32, 0x16, 0x15, 0x03, 0x88, 0x05, 0x20, 0x1c, 0x03, 0x1e, 0x45, 0x28, 0x02, 0x29, 0x46, 0x1b, // 2..... ...E(.)F.
-	0x1b, 0x17, 0x04, 0x04, 0x21, 0x1c, 0x1c, 0x3c, 0x21, 0x2c, 0xfe, 0xba, 0x01, 0x21, 0x23, 0x02, // ....!..<!,...!#.
-	0x1d, 0x44, 0x26, 0x02, 0x2a, 0x46, 0x1b, 0x1b, 0x17, 0x05, 0x03, 0x20, 0x1c, 0x04, 0x1b, 0x3a, // .D&.*F..... ...:
-	0x20, 0x02, 0x49, 0x01, 0x28, 0x29, 0x01, 0xba, 0x31, 0x31, 0x03, 0x5b, 0xfe, 0x08, 0x2d, 0x4a, //  .I.()..11.[..-J
-	0x1c, 0x21, 0x24, 0x03, 0x04, 0x19, 0x1e, 0x1a, 0x46, 0x2c, 0x27, 0x45, 0x1d, 0x1c, 0x20, 0x05, // .!$.....F,'E.. .
-	0xa3, 0xfd, 0xd6, 0x1f, 0x3e, 0x1f, 0x05, 0x1d, 0x20, 0x05, 0x04, 0x18, 0x1c, 0x1b, 0x44, 0x2a, // ....>... .....D*
-	0x29, 0x47, 0x1e, 0x01, 0x1b, 0x20, 0x07, 0x04, 0x02, 0x0b, 0x32, 0x31, 0x01, 0x30, 0x2f, 0x00, // )G... ....21.0/.
-	0x00, 0x04, 0x00, 0x19, 0xff, 0xc7, 0x03, 0xe9, 0x03, 0xba, 0x00, 0x07, 0x00, 0x22, 0x00, 0x3d, // .............".=
-	0x00, 0x4d, 0x00, 0x00, 0x01, 0x17, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x37, 0x05, 0x37, 0x3e, 0x01, // .M.....&'..7.7>.
-	0x37, 0x33, 0x17, 0x35, 0x17, 0x11, 0x16, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x07, 0x23, 0x06, 0x26, // 73.5.........#.&
-	0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x13, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x01, 0x1e, // '..7>.7.>.32....
-	0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x01, 0x2e, 0x01, 0x35, 0x34, // .......#"&'...54
-	0x36, 0x37, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x15, 0x11, 0x07, 0x27, 0x37, 0x33, 0x35, // 677>.3!2....'735
-	0x23, 0x27, 0x01, 0xff, 0xb2, 0x28, 0x42, 0x1a, 0x19, 0x17, 0x02, 0xfe, 0x59, 0x04, 0x1b, 0x3a, // #'...(B.....Y..:
-	0x20, 0x02, 0x49, 0x83, 0x01, 0x21, 0x23, 0x02, 0x1d, 0x44, 0x26, 0x02, 0x2a, 0x46, 0x1a, 0x1c, //  .I..!#..D&.*F..
-	0x17, 0x05, 0x03, 0x20, 0x1c, 0x31, 0x0a, 0x18, 0x0e, 0x0e, 0x16, 0x09, 0x02, 0xef, 0x0a, 0x0a, // ... .1..........
-	0x0a, 0x0a, 0x09, 0x17, 0x0e, 0x0d, 0x18, 0x0a, 0xfd, 0x11, 0x09, 0x09, 0x09, 0x09, 0x9a, 0x07, // ................
-	0x25, 0x1d, 0x01, 0xba, 0x31, 0x31, 0x09, 0xde, 0x18, 0x2c, 0xee, 0xd4, 0x01, 0x38, 0xb2, 0x01, // %...11...,...8..
-	0x1a, 0x1c, 0x17, 0x3f, 0x27, 0x2a, 0x01, 0x1b, 0x20, 0x07, 0x04, 0xce, 0x82, 0xfe, 0xf1, 0x1f, // ...?'*.. .......
-	0x3e, 0x1f, 0x05, 0x1d, 0x20, 0x05, 0x04, 0x18, 0x1c, 0x1b, 0x44, 0x2a, 0x29, 0x47, 0x1e, 0x02, // >... .....D*)G..
-	0x58, 0x0a, 0x0a, 0x0a, 0x0a, 0xfd, 0x12, 0x09, 0x17, 0x0e, 0x0e, 0x17, 0x0a, 0x09, 0x09, 0x09, // X...............
-	0x09, 0x02, 0xee, 0x0a, 0x18, 0x0e, 0x0e, 0x16, 0x09, 0x23, 0x19, 0x18, 0x30, 0x2f, 0xfe, 0x08, // .........#..0/..
-	0x36, 0xde, 0x06, 0xa3, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // 6...............
-	0x03, 0xba, 0x00, 0x14, 0x00, 0x2b, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, // .....+...2......
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x23, 0x35, 0x33, 0x01, 0x33, 0x13, 0x37, 0x1f, // .....+..#53.3.7.
-	0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x02, 0x27, 0x3f, 0x01, 0x3e, 0x01, 0x35, 0x34, 0x26, // ........'?.>.54&
-	0x2f, 0x02, 0x02, 0x40, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0x09, 0x0a, 0x09, 0x16, 0x0d, 0x3f, 0xfe, // /..@..........?.
-	0x84, 0x7f, 0x7f, 0x01, 0x7c, 0x3f, 0xd7, 0x49, 0x30, 0x01, 0x34, 0x35, 0x35, 0x34, 0x03, 0x2e, // ....|?.I0.4554..
-	0x49, 0x1d, 0x01, 0x23, 0x23, 0x23, 0x23, 0x01, 0x1d, 0x03, 0xba, 0x0a, 0x09, 0x0a, 0x16, 0x0d, // I..####.........
-	0xfc, 0x8c, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x01, 0x7c, 0xfc, 0x01, 0x7c, 0xfe, 0xc2, 0x68, 0x29, // ........|..|..h)
-	0x01, 0x35, 0x7f, 0x4b, 0x4b, 0x7f, 0x34, 0x03, 0x28, 0x68, 0x18, 0x02, 0x23, 0x53, 0x31, 0x30, // .5.KK.4.(h..#S10
-	0x53, 0x23, 0x03, 0x18, 0x00, 0x04, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x0a, // S#..............
-	0x00, 0x1d, 0x00, 0x2c, 0x00, 0x47, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, // ...,.G...2......
-	0x01, 0x37, 0x33, 0x13, 0x37, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x27, 0x3e, 0x01, // .73.7........'>.
-	0x35, 0x34, 0x26, 0x2f, 0x02, 0x25, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x01, // 54&/.%.......+..
-	0x23, 0x35, 0x33, 0x37, 0x37, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, // #5377.........#"
-	0x26, 0x27, 0x01, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x02, // &'...5467>.32...
-	0x40, 0x0d, 0x16, 0x09, 0x0a, 0x09, 0xfe, 0xfe, 0x84, 0x3f, 0xd7, 0x49, 0x30, 0x01, 0x34, 0x35, // @........?.I0.45
-	0x1d, 0x1c, 0x5e, 0x0c, 0x0c, 0x23, 0x23, 0x01, 0x1d, 0xfd, 0xb2, 0x01, 0xb6, 0x09, 0x0a, 0x09, // ..^..##.........
-	0x16, 0x0d, 0x3f, 0xfe, 0x84, 0x7f, 0x7f, 0x44, 0x44, 0x02, 0xd8, 0x09, 0x0a, 0x09, 0x0a, 0x09, // ..?....DD.......
-	0x16, 0x0d, 0x0e, 0x17, 0x09, 0xfd, 0x28, 0x09, 0x08, 0x08, 0x09, 0x09, 0x17, 0x0e, 0x0d, 0x16, // ......(.........
-	0x09, 0x03, 0xba, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfe, 0xbb, 0x01, 0x01, 0x84, 0xfe, 0xc2, 0x68, // ...............h
-	0x29, 0x01, 0x35, 0x7f, 0x4b, 0x38, 0x63, 0x2c, 0x5d, 0x19, 0x35, 0x1c, 0x30, 0x53, 0x23, 0x03, // ).5.K8c,].5.0S#.
-	0x18, 0x06, 0xfe, 0x4b, 0xc7, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x01, 0x7c, 0xfc, 0x44, 0xcb, 0xfd, // ...K.......|.D..
-	0x29, 0x09, 0x16, 0x0d, 0x0e, 0x17, 0x09, 0x09, 0x09, 0x09, 0x09, 0x02, 0xd6, 0x0a, 0x17, 0x0d, // )...............
-	0x0e, 0x16, 0x09, 0x09, 0x0a, 0x0a, 0x09, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x02, 0x80, // ................
-	0x03, 0xba, 0x00, 0x14, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, // .......2........
-	0x07, 0x0e, 0x01, 0x2b, 0x01, 0x01, 0x23, 0x35, 0x33, 0x01, 0x33, 0x02, 0x40, 0x0d, 0x16, 0x0a, // ...+..#53.3.@...
-	0x09, 0x0a, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0x3f, 0xfe, 0x84, 0x7f, 0x7f, 0x01, 0x7c, 0x3f, 0x03, // .......?.....|?.
-	0xba, 0x09, 0x0a, 0x09, 0x17, 0x0c, 0xfc, 0x8a, 0x0d, 0x17, 0x0a, 0x08, 0x09, 0x01, 0x7b, 0xfe, // ..............{.
-	0x01, 0x7b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x9e, 0xff, 0xc6, 0x03, 0x62, 0x03, 0xba, 0x00, 0x04, // .{.........b....
-	0x00, 0x3c, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, 0x11, 0x05, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, // .<...!.!.......+
-	0x01, 0x07, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, // .............#"&
-	0x27, 0x2e, 0x01, 0x27, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x27, 0x23, 0x22, 0x26, 0x27, 0x2e, // '..'467>.7'#"&'.
-	0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, // .5.467>.3!2.....
-	0x11, 0x01, 0x68, 0x01, 0x30, 0xfe, 0xd0, 0x01, 0x95, 0x08, 0x07, 0x08, 0x12, 0x0a, 0x3c, 0x07, // ..h.0.........<.
-	0x20, 0x39, 0x1a, 0x34, 0x34, 0x34, 0x34, 0x33, 0x7d, 0x4a, 0x49, 0x7d, 0x34, 0x33, 0x34, 0x01, //  9.44443}JI}434.
-	0x34, 0x34, 0x1a, 0x39, 0x20, 0x07, 0x3c, 0x0b, 0x12, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x12, // 44.9 .<.........
-	0x0b, 0x01, 0x94, 0x0a, 0x12, 0x08, 0x07, 0x08, 0x02, 0x25, 0x01, 0x2f, 0xfe, 0xd1, 0x32, 0x0b, // .........%./..2.
-	0x13, 0x07, 0x07, 0x07, 0x06, 0x0e, 0x26, 0x18, 0x32, 0x79, 0x48, 0x26, 0x40, 0x1a, 0x1a, 0x1b, // ......&.2yH&@...
-	0x1b, 0x1a, 0x1a, 0x40, 0x26, 0x48, 0x79, 0x32, 0x19, 0x25, 0x0e, 0x06, 0x07, 0x07, 0x08, 0x12, // ...@&Hy2.%......
-	0x0b, 0x01, 0x93, 0x0b, 0x12, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x12, 0x0a, 0xfe, 0x6c, 0x00, // ..............l.
-	0x00, 0x04, 0x00, 0x85, 0xff, 0xc6, 0x03, 0x7b, 0x03, 0xba, 0x00, 0x04, 0x00, 0x09, 0x00, 0x26, // .......{.......&
-	0x00, 0x41, 0x00, 0x00, 0x13, 0x11, 0x21, 0x11, 0x21, 0x01, 0x15, 0x33, 0x35, 0x23, 0x25, 0x21, // .A....!.!..35#%!
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, // 2...........#!"&
-	0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x11, 0x21, 0x32, 0x16, 0x17, // '..=.467>.3.!2..
-	0x1e, 0x01, 0x15, 0x11, 0x0f, 0x01, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x2f, 0x02, 0x11, 0x34, // ........#!"&/..4
-	0x36, 0x37, 0x3e, 0x01, 0x33, 0xea, 0x02, 0x2c, 0xfd, 0xd4, 0x01, 0xae, 0x65, 0x65, 0xfe, 0x1f, // 67>.3..,....ee..
-	0x02, 0x92, 0x0a, 0x11, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x11, 0x0a, 0xfd, 0x6e, 0x0a, 0x13, // .............n..
-	0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x13, 0x0a, 0x02, 0x92, 0x0a, 0x11, 0x08, 0x08, 0x07, 0x05, // ................
-	0x0a, 0x08, 0x11, 0x0a, 0xfd, 0x6e, 0x0a, 0x13, 0x07, 0x09, 0x05, 0x07, 0x07, 0x07, 0x13, 0x0a, // .....n..........
-	0x03, 0x54, 0xfe, 0x6c, 0x01, 0x94, 0xfd, 0x3d, 0x65, 0x65, 0x65, 0x08, 0x07, 0x08, 0x12, 0x0a, // .T.l...=eee.....
-	0xca, 0x0b, 0x12, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x12, 0x0b, 0xc9, 0x0b, 0x12, 0x08, 0x07, // ................
-	0x08, 0x02, 0xc4, 0x08, 0x08, 0x07, 0x12, 0x0a, 0xfd, 0xd4, 0x18, 0x0d, 0x07, 0x07, 0x07, 0x07, // ................
-	0x0d, 0x18, 0x02, 0x2b, 0x0b, 0x12, 0x07, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x6e, // ...+...........n
-	0xff, 0xc6, 0x03, 0x92, 0x03, 0xba, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x01, 0x21, 0x11, 0x21, // .........$...!.!
-	0x11, 0x37, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x15, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, // .7..........#!"&
-	0x2f, 0x01, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x35, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, // /...5.4675>.3!2.
-	0x17, 0x02, 0xdf, 0xfe, 0x42, 0x01, 0xbe, 0x98, 0x0d, 0x0e, 0x0e, 0x0d, 0x0e, 0x1f, 0x12, 0xfd, // ....B...........
-	0x90, 0x13, 0x1f, 0x0d, 0x01, 0x0d, 0x0d, 0x0d, 0x0d, 0x0d, 0x20, 0x13, 0x02, 0x70, 0x12, 0x1f, // .......... ..p..
-	0x0e, 0x03, 0x07, 0xfd, 0xad, 0x02, 0x53, 0x98, 0x0e, 0x1f, 0x12, 0xfc, 0xc0, 0x13, 0x20, 0x0d, // ......S....... .
-	0x02, 0x0c, 0x0c, 0x0c, 0x0c, 0x02, 0x0d, 0x20, 0x13, 0x03, 0x3f, 0x12, 0x20, 0x0c, 0x02, 0x0d, // ....... ..?. ...
-	0x0e, 0x0e, 0x0d, 0x00, 0x00, 0x02, 0x00, 0xaa, 0xff, 0xc6, 0x03, 0x56, 0x03, 0xba, 0x00, 0x04, // ...........V....
-	0x00, 0x24, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21, 0x27, 0x35, 0x3e, 0x01, 0x33, 0x21, 0x32, // .$....!.!'5>.3!2
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x15, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, // ............#!"&
-	0x2f, 0x01, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x01, 0x5c, 0x01, 0x48, 0xfe, 0xb8, 0x99, // /...5.467...H...
-	0x0e, 0x20, 0x12, 0x01, 0xfa, 0x12, 0x1f, 0x0d, 0x0e, 0x0d, 0x0d, 0x0e, 0x0d, 0x1f, 0x12, 0xfe, // . ..............
-	0x06, 0x12, 0x20, 0x0c, 0x02, 0x0c, 0x0d, 0x0d, 0x0c, 0x03, 0x07, 0xfd, 0xad, 0x02, 0x53, 0x96, // .. ...........S.
-	0x02, 0x0d, 0x0e, 0x0e, 0x0d, 0x0e, 0x1f, 0x12, 0xfc, 0xc0, 0x13, 0x20, 0x0d, 0x02, 0x0c, 0x0c, // ........... ....
-	0x0c, 0x0c, 0x02, 0x0d, 0x20, 0x13, 0x03, 0x3f, 0x12, 0x20, 0x0c, 0x00, 0x00, 0x02, 0x00, 0x06, // .... ..?. ......
-	0x00, 0xc3, 0x03, 0xfa, 0x02, 0xbd, 0x00, 0x04, 0x00, 0x21, 0x00, 0x00, 0x13, 0x21, 0x11, 0x21, // .........!...!.!
-	0x11, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, // ...........#!"&'
-	0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x6c, 0x03, // ..5.467>.3!2..l.
-	0x28, 0xfc, 0xd8, 0x03, 0x7e, 0x08, 0x08, 0x08, 0x08, 0x07, 0x12, 0x0a, 0xfc, 0x72, 0x0b, 0x12, // (...~........r..
-	0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x12, 0x0b, 0x03, 0x8e, 0x0a, 0x12, 0x07, 0x01, 0x28, 0x01, // ..............(.
-	0x30, 0xfe, 0xd0, 0x01, 0x86, 0x08, 0x12, 0x0a, 0xfe, 0x6c, 0x0b, 0x12, 0x08, 0x07, 0x07, 0x07, // 0........l......
-	0x07, 0x08, 0x12, 0x0b, 0x01, 0x93, 0x0b, 0x12, 0x08, 0x07, 0x08, 0x08, 0x07, 0x00, 0x00, 0x00, // ................
-	0x00, 0x03, 0x00, 0x0d, 0xff, 0xc6, 0x03, 0xf3, 0x03, 0xba, 0x00, 0x04, 0x00, 0x1f, 0x00, 0x53, // ...............S
-	0x00, 0x00, 0x25, 0x03, 0x05, 0x13, 0x25, 0x03, 0x36, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x13, 0x16, // ..%...%.6.......
-	0x06, 0x07, 0x0e, 0x01, 0x07, 0x05, 0x27, 0x2e, 0x01, 0x27, 0x03, 0x26, 0x36, 0x37, 0x3e, 0x01, // ......'..'.&67>.
-	0x37, 0x25, 0x27, 0x16, 0x06, 0x0f, 0x02, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x23, 0x07, 0x17, // 7%'.....&'..'#..
-	0x1e, 0x01, 0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x27, 0x23, 0x2e, 0x01, 0x27, 0x17, 0x2e, 0x01, // ......+.'#..'...
-	0x37, 0x35, 0x37, 0x3e, 0x01, 0x37, 0x33, 0x32, 0x16, 0x1f, 0x02, 0x3e, 0x01, 0x17, 0x1e, 0x01, // 757>.732...>....
-	0x17, 0x1e, 0x01, 0x17, 0x03, 0x8c, 0x48, 0xfd, 0x30, 0x48, 0x02, 0xd0, 0x33, 0x09, 0x12, 0x08, // ......H.0H..3...
-	0x09, 0x0b, 0x02, 0x61, 0x02, 0x03, 0x05, 0x05, 0x0e, 0x09, 0xfc, 0xd6, 0x24, 0x08, 0x0b, 0x02, // ...a........$...
-	0x61, 0x02, 0x02, 0x05, 0x05, 0x0f, 0x09, 0x03, 0x2a, 0x2a, 0x01, 0x04, 0x05, 0x48, 0x15, 0x07, // a.......**...H..
-	0x0e, 0x07, 0x16, 0x31, 0x1a, 0x01, 0x77, 0x1a, 0x07, 0x01, 0x06, 0x01, 0x07, 0x0f, 0x09, 0x02, // ...1..w.........
-	0xf7, 0x02, 0x09, 0x0c, 0x04, 0x03, 0x06, 0x02, 0x03, 0x59, 0x01, 0x0f, 0x0e, 0x02, 0x0a, 0x0f, // .........Y......
-	0x05, 0x02, 0x16, 0x3e, 0x84, 0x46, 0x2f, 0x55, 0x26, 0x09, 0x09, 0x01, 0xee, 0x01, 0x0f, 0xc3, // ...>.F/U&.......
-	0xfe, 0xf3, 0xc1, 0x01, 0x75, 0x02, 0x02, 0x06, 0x04, 0x0e, 0x0a, 0xfe, 0x98, 0x09, 0x12, 0x09, // ....u...........
-	0x08, 0x0a, 0x03, 0xda, 0x05, 0x05, 0x0f, 0x09, 0x01, 0x67, 0x0a, 0x12, 0x08, 0x09, 0x0b, 0x02, // .........g......
-	0xda, 0xcf, 0x05, 0x0e, 0x07, 0x78, 0x11, 0x01, 0x03, 0x05, 0x0f, 0x15, 0x05, 0x07, 0x24, 0x09, // .....x........$.
-	0x14, 0x0b, 0x02, 0x07, 0x07, 0x20, 0x01, 0x0a, 0x07, 0x02, 0x06, 0x0e, 0x08, 0x02, 0xf7, 0x0b, // ..... ..........
-	0x0c, 0x02, 0x09, 0x09, 0x03, 0x32, 0x1c, 0x0e, 0x0d, 0x08, 0x24, 0x1b, 0x04, 0x0c, 0x07, 0x00, // .....2....$.....
-	0x00, 0x03, 0x00, 0x0c, 0xff, 0xc6, 0x03, 0xf4, 0x03, 0xba, 0x00, 0x32, 0x00, 0x4d, 0x00, 0x52, // ...........2.M.R
-	0x00, 0x00, 0x01, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x15, 0x16, 0x06, 0x07, // ...7>.;.........
-	0x37, 0x07, 0x23, 0x07, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x26, 0x36, 0x3f, 0x01, 0x27, 0x0e, 0x01, // 7.#.#"&/.&6?.'..
-	0x07, 0x0e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, // ...'../...7>.7>.
-	0x37, 0x36, 0x16, 0x17, 0x37, 0x01, 0x3e, 0x01, 0x17, 0x05, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x07, // 76..7.>.........
-	0x03, 0x0e, 0x01, 0x0f, 0x01, 0x25, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x13, 0x3e, 0x01, 0x37, // .....%..'..7.>.7
-	0x17, 0x03, 0x05, 0x13, 0x25, 0x02, 0xab, 0x01, 0x05, 0x0f, 0x0a, 0x02, 0x0f, 0x0f, 0x01, 0x59, // ....%..........Y
-	0x02, 0x02, 0x05, 0x02, 0x18, 0x03, 0xf7, 0x03, 0x08, 0x10, 0x06, 0x01, 0x06, 0x01, 0x07, 0x1a, // ................
-	0x78, 0x1b, 0x30, 0x16, 0x07, 0x0e, 0x07, 0x07, 0x0b, 0x03, 0x49, 0x05, 0x04, 0x01, 0x01, 0x09, // x.0.......I.....
-	0x09, 0x26, 0x56, 0x2e, 0x46, 0x85, 0x3e, 0x17, 0xfd, 0xd7, 0x0a, 0x12, 0x0a, 0x03, 0x2b, 0x09, // .&V.F.>.......+.
-	0x0e, 0x05, 0x05, 0x02, 0x02, 0x61, 0x03, 0x0b, 0x08, 0x23, 0xfc, 0xd3, 0x09, 0x0f, 0x05, 0x04, // .....a...#......
-	0x02, 0x02, 0x61, 0x03, 0x0a, 0x08, 0x39, 0x48, 0x02, 0xd3, 0x47, 0xfd, 0x2e, 0x03, 0xa5, 0x03, // ..a...9H..G.....
-	0x09, 0x09, 0x02, 0x0c, 0x0b, 0xf7, 0x03, 0x07, 0x0e, 0x07, 0x03, 0x13, 0x20, 0x07, 0x07, 0x03, // ............ ...
-	0x0a, 0x14, 0x09, 0x25, 0x07, 0x06, 0x14, 0x0f, 0x05, 0x04, 0x02, 0x02, 0x08, 0x06, 0x78, 0x08, // ...%..........x.
-	0x0d, 0x06, 0x07, 0x0b, 0x04, 0x1c, 0x23, 0x09, 0x0d, 0x0f, 0x1c, 0x33, 0xfe, 0xb7, 0x06, 0x03, // ......#....3....
-	0x03, 0xd9, 0x03, 0x0b, 0x08, 0x08, 0x12, 0x09, 0xfe, 0x96, 0x09, 0x0e, 0x05, 0x04, 0xd8, 0x03, // ................
-	0x0b, 0x09, 0x08, 0x12, 0x0a, 0x01, 0x67, 0x0a, 0x0e, 0x04, 0x60, 0xfe, 0xf1, 0xc1, 0x01, 0x0f, // ......g...`.....
-	0xc1, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x00, 0xc3, 0x03, 0xfa, 0x02, 0xbd, 0x00, 0x1c, // ................
-	0x00, 0x29, 0x00, 0x42, 0x00, 0x5b, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, // .).B.[...2......
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, // .....#!"&'..5.46
-	0x37, 0x3e, 0x01, 0x33, 0x21, 0x05, 0x23, 0x15, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, // 7>.3!.#.#.3.3535
-	0x23, 0x35, 0x05, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, // #5.>.54&'..#"...
-	0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x23, 0x3e, 0x01, 0x35, 0x34, // .......3267#>.54
-	0x26, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, // &'..#"..........
-	0x33, 0x32, 0x36, 0x37, 0x03, 0xc7, 0x0a, 0x12, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x12, 0x0a, // 3267............
-	0xfc, 0x72, 0x0b, 0x12, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x12, 0x0b, 0x03, 0x8e, 0xfd, 0x55, // .r.............U
-	0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x02, 0x83, 0x07, 0x08, 0x08, 0x07, 0x08, 0x12, 0x0a, 0x0b, // eeeedd..........
-	0x12, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x0b, 0x0a, 0x12, 0x08, 0xb1, 0x07, 0x08, 0x08, // ................
-	0x07, 0x08, 0x12, 0x0a, 0x0b, 0x12, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x12, 0x0b, 0x0a, 0x12, // ................
-	0x08, 0x02, 0xbd, 0x08, 0x07, 0x08, 0x12, 0x0a, 0xfe, 0x6c, 0x0b, 0x12, 0x08, 0x07, 0x07, 0x07, // .........l......
-	0x07, 0x08, 0x12, 0x0b, 0x01, 0x93, 0x0b, 0x12, 0x08, 0x07, 0x08, 0x65, 0x64, 0x65, 0x65, 0x65, // ...........edeee
-	0x65, 0x64, 0xbb, 0x07, 0x11, 0x0b, 0x0a, 0x12, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x12, 0x0a, // ed..............
-	0x0b, 0x11, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x11, 0x0b, 0x0a, 0x12, 0x07, 0x08, 0x08, 0x08, // ................
-	0x08, 0x07, 0x12, 0x0a, 0x0b, 0x11, 0x07, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x04, 0x00, 0x06, // ................
-	0x00, 0x6b, 0x03, 0xfa, 0x03, 0x15, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x51, 0x00, 0x6a, 0x00, 0x00, // .k.....+.8.Q.j..
-	0x01, 0x37, 0x35, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x21, 0x32, 0x16, 0x17, 0x1e, // .7532......!2...
-	0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, // ........#!"&'..5
-	0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x35, 0x34, 0x36, 0x37, 0x03, 0x23, 0x15, 0x23, // .467>.3!5467.#.#
-	0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x23, 0x35, 0x05, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, // .3.3535#5.".....
-	0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, // .....3267>.54&'.
-	0x01, 0x23, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, // .#.........3267>
-	0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x01, 0xdb, 0x0c, 0x19, 0x0a, // .54&'..#".......
-	0x12, 0x07, 0x08, 0x08, 0x01, 0x94, 0x0a, 0x12, 0x07, 0x08, 0x08, 0x08, 0x08, 0x07, 0x12, 0x0a, // ................
-	0xfc, 0x72, 0x0b, 0x12, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x12, 0x0b, 0x01, 0x94, 0x07, 0x07, // .r..............
-	0xbf, 0x65, 0x65, 0x65, 0x65, 0x64, 0x64, 0x02, 0x5f, 0x0b, 0x12, 0x07, 0x07, 0x07, 0x07, 0x07, // .eeeedd._.......
-	0x07, 0x12, 0x0b, 0x0a, 0x12, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x12, 0x0a, 0xd5, 0x07, 0x07, // ................
-	0x07, 0x07, 0x07, 0x12, 0x0b, 0x0a, 0x12, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x12, 0x0a, 0x0b, // ................
-	0x12, 0x07, 0x03, 0x06, 0x09, 0x06, 0x07, 0x08, 0x07, 0x12, 0x0a, 0x7f, 0x07, 0x08, 0x07, 0x12, // ................
-	0x0a, 0xfe, 0x6b, 0x0a, 0x13, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x13, 0x0a, 0x01, 0x94, 0x0a, // ..k.............
-	0x13, 0x07, 0x08, 0x07, 0x7d, 0x0b, 0x13, 0x07, 0xfe, 0xf9, 0x64, 0x65, 0x65, 0x65, 0x65, 0x64, // ....}.....deeeed
-	0x65, 0x08, 0x07, 0x08, 0x11, 0x0a, 0x0b, 0x12, 0x07, 0x07, 0x08, 0x08, 0x07, 0x07, 0x12, 0x0b, // e...............
-	0x0a, 0x11, 0x08, 0x07, 0x08, 0x0f, 0x08, 0x11, 0x0a, 0x0b, 0x12, 0x07, 0x07, 0x08, 0x08, 0x07, // ................
-	0x07, 0x12, 0x0b, 0x0a, 0x11, 0x08, 0x08, 0x07, 0x07, 0x08, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0c, // ................
-	0xff, 0xc6, 0x03, 0xf4, 0x03, 0xba, 0x00, 0x14, 0x00, 0x29, 0x00, 0x36, 0x00, 0x69, 0x00, 0x84, // .........).6.i..
-	0x00, 0x00, 0x25, 0x3e, 0x01, 0x37, 0x36, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x07, 0x0e, 0x01, 0x07, // ..%>.76&'..'....
-	0x06, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x37, 0x37, 0x2e, 0x01, 0x27, 0x07, 0x0e, 0x01, 0x07, 0x06, // ......77..'.....
-	0x16, 0x17, 0x1e, 0x01, 0x17, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x26, 0x27, 0x25, 0x27, 0x07, 0x17, // .....7>.76&'%'..
-	0x07, 0x17, 0x37, 0x17, 0x37, 0x27, 0x37, 0x27, 0x07, 0x01, 0x33, 0x1e, 0x01, 0x1f, 0x01, 0x15, // ..7.7'7'..3.....
-	0x16, 0x06, 0x07, 0x37, 0x07, 0x23, 0x07, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x26, 0x36, 0x3f, 0x01, // ...7.#.#"&/.&6?.
-	0x27, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x2e, 0x01, 0x37, 0x3e, 0x01, // '.....'../...7>.
-	0x37, 0x3e, 0x01, 0x37, 0x36, 0x16, 0x17, 0x3f, 0x01, 0x3e, 0x01, 0x33, 0x01, 0x1e, 0x01, 0x07, // 7>.76..?.>.3....
-	0x03, 0x0e, 0x01, 0x0f, 0x01, 0x25, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x13, 0x3e, 0x01, 0x37, // .....%..'..7.>.7
-	0x3e, 0x01, 0x17, 0x05, 0x1e, 0x01, 0x17, 0x02, 0xcc, 0x09, 0x0a, 0x02, 0x03, 0x03, 0x04, 0x05, // >...............
-	0x0e, 0x09, 0x24, 0x09, 0x0a, 0x01, 0x03, 0x01, 0x05, 0x05, 0x0e, 0x09, 0x24, 0xae, 0x04, 0x0e, // ..$.........$...
-	0x0a, 0x24, 0x08, 0x0a, 0x02, 0x03, 0x02, 0x05, 0x04, 0x0e, 0x0a, 0x24, 0x09, 0x0a, 0x02, 0x03, // .$.........$....
-	0x02, 0x06, 0xfd, 0x6e, 0x5a, 0x1a, 0x5a, 0x16, 0x59, 0x18, 0x59, 0x18, 0x58, 0x18, 0x5b, 0x17, // ...nZ.Z.Y.Y.X.[.
-	0x01, 0xe2, 0x02, 0x0e, 0x10, 0x01, 0x58, 0x03, 0x02, 0x05, 0x02, 0x18, 0x03, 0xf7, 0x03, 0x08, // ......X.........
-	0x10, 0x06, 0x01, 0x06, 0x01, 0x07, 0x1a, 0x78, 0x1b, 0x30, 0x16, 0x07, 0x0e, 0x07, 0x07, 0x0b, // .......x.0......
-	0x03, 0x49, 0x05, 0x04, 0x01, 0x01, 0x09, 0x09, 0x26, 0x56, 0x2e, 0x46, 0x85, 0x3e, 0x17, 0x01, // .I......&V.F.>..
-	0x05, 0x0f, 0x0a, 0x01, 0x25, 0x05, 0x02, 0x02, 0x61, 0x03, 0x0b, 0x08, 0x23, 0xfc, 0xd3, 0x09, // ....%...a...#...
-	0x0f, 0x05, 0x04, 0x02, 0x02, 0x61, 0x03, 0x0a, 0x08, 0x0a, 0x12, 0x0a, 0x03, 0x2b, 0x09, 0x0e, // .....a.......+..
-	0x05, 0xbc, 0x04, 0x0e, 0x0a, 0x08, 0x12, 0x09, 0x08, 0x0b, 0x03, 0x04, 0x05, 0x0f, 0x09, 0x0a, // ................
-	0x11, 0x08, 0x09, 0x0b, 0x02, 0x05, 0x16, 0x07, 0x0b, 0x03, 0x05, 0x05, 0x0e, 0x09, 0x0a, 0x11, // ................
-	0x08, 0x09, 0x0b, 0x03, 0x06, 0x04, 0x0e, 0x0a, 0x08, 0x12, 0x0a, 0xbe, 0x1a, 0x5a, 0x1a, 0x5a, // .............Z.Z
-	0x17, 0x5a, 0x19, 0x5a, 0x18, 0x5b, 0x17, 0x5a, 0x02, 0x2a, 0x02, 0x0c, 0x0b, 0xf7, 0x03, 0x07, // .Z.Z.[.Z.*......
-	0x0e, 0x07, 0x03, 0x13, 0x20, 0x07, 0x07, 0x03, 0x0a, 0x14, 0x09, 0x25, 0x07, 0x06, 0x14, 0x0f, // .... ......%....
-	0x05, 0x04, 0x02, 0x02, 0x08, 0x06, 0x78, 0x08, 0x0d, 0x06, 0x07, 0x0b, 0x04, 0x1c, 0x23, 0x09, // ......x.......#.
-	0x0d, 0x0f, 0x1c, 0x33, 0x03, 0x09, 0x09, 0xfd, 0xb9, 0x08, 0x12, 0x09, 0xfe, 0x96, 0x09, 0x0e, // ...3............
-	0x05, 0x04, 0xd8, 0x03, 0x0b, 0x09, 0x08, 0x12, 0x0a, 0x01, 0x67, 0x0a, 0x0e, 0x04, 0x06, 0x03, // ..........g.....
-	0x03, 0xd9, 0x03, 0x0b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x0d, 0xff, 0xc6, 0x03, 0xf3, // ................
-	0x03, 0xba, 0x00, 0x14, 0x00, 0x29, 0x00, 0x36, 0x00, 0x51, 0x00, 0x85, 0x00, 0x00, 0x01, 0x2e, // .....).6.Q......
-	0x01, 0x2f, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x3e, 0x01, 0x37, // ./...........>.7
-	0x3e, 0x01, 0x27, 0x07, 0x3e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, // >.'.>.'../......
-	0x17, 0x1e, 0x01, 0x1f, 0x01, 0x3e, 0x01, 0x37, 0x05, 0x07, 0x27, 0x07, 0x17, 0x07, 0x17, 0x37, // .....>.7..'....7
-	0x17, 0x37, 0x27, 0x37, 0x27, 0x01, 0x1e, 0x01, 0x17, 0x13, 0x16, 0x06, 0x07, 0x0e, 0x01, 0x07, // .7'7'...........
-	0x05, 0x27, 0x2e, 0x01, 0x27, 0x03, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x25, 0x36, 0x16, 0x17, // .'..'.&67>.7%6..
-	0x27, 0x16, 0x06, 0x0f, 0x02, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x23, 0x07, 0x17, 0x1e, 0x01, // '.....&'..'#....
-	0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x27, 0x23, 0x2e, 0x01, 0x27, 0x17, 0x2e, 0x01, 0x37, 0x35, // ....+.'#..'...75
-	0x37, 0x3e, 0x01, 0x37, 0x33, 0x32, 0x16, 0x1f, 0x02, 0x3e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x1e, // 7>.732...>......
-	0x01, 0x17, 0x03, 0x7e, 0x02, 0x0b, 0x09, 0x23, 0x09, 0x0f, 0x05, 0x04, 0x02, 0x02, 0x03, 0x0b, // ...~...#........
-	0x07, 0x25, 0x09, 0x0e, 0x05, 0x05, 0x02, 0x03, 0xa2, 0x05, 0x03, 0x03, 0x02, 0x0b, 0x09, 0x23, // .%.............#
-	0x09, 0x0f, 0x05, 0x04, 0x02, 0x02, 0x03, 0x0b, 0x07, 0x24, 0x0a, 0x0e, 0x04, 0xfe, 0xa6, 0x58, // .........$.....X
-	0x19, 0x5a, 0x19, 0x5b, 0x17, 0x5b, 0x19, 0x59, 0x18, 0x59, 0x18, 0x01, 0xfa, 0x09, 0x0b, 0x02, // .Z.[.[.Y.Y......
-	0x61, 0x02, 0x03, 0x05, 0x05, 0x0e, 0x09, 0xfc, 0xd6, 0x24, 0x08, 0x0b, 0x02, 0x61, 0x02, 0x02, // a........$...a..
-	0x05, 0x05, 0x0f, 0x09, 0x03, 0x2a, 0x09, 0x12, 0x08, 0x4d, 0x01, 0x04, 0x05, 0x48, 0x15, 0x07, // .....*...M...H..
-	0x0e, 0x07, 0x16, 0x31, 0x1a, 0x01, 0x77, 0x1a, 0x07, 0x01, 0x06, 0x01, 0x07, 0x0f, 0x09, 0x02, // ...1..w.........
-	0xf7, 0x02, 0x09, 0x0c, 0x04, 0x03, 0x06, 0x02, 0x03, 0x59, 0x01, 0x0f, 0x0e, 0x02, 0x0a, 0x0f, // .........Y......
-	0x05, 0x02, 0x16, 0x3e, 0x84, 0x46, 0x2f, 0x55, 0x26, 0x09, 0x09, 0x01, 0x01, 0x7c, 0x09, 0x0e, // ...>.F/U&....|..
-	0x05, 0x04, 0x02, 0x0b, 0x08, 0x09, 0x11, 0x09, 0x0a, 0x0e, 0x04, 0x06, 0x03, 0x0b, 0x09, 0x08, // ................
-	0x12, 0x09, 0x4e, 0x08, 0x11, 0x0a, 0x09, 0x0e, 0x05, 0x05, 0x02, 0x0b, 0x08, 0x09, 0x11, 0x09, // ..N.............
-	0x0a, 0x0e, 0x04, 0x06, 0x03, 0x0b, 0x08, 0x0a, 0x17, 0x59, 0x18, 0x5a, 0x17, 0x5a, 0x17, 0x59, // .........Y.Z.Z.Y
-	0x18, 0x5a, 0x17, 0x5a, 0x01, 0x39, 0x04, 0x0e, 0x0a, 0xfe, 0x98, 0x09, 0x12, 0x09, 0x08, 0x0a, // .Z.Z.9..........
-	0x03, 0xda, 0x05, 0x05, 0x0f, 0x09, 0x01, 0x67, 0x0a, 0x12, 0x08, 0x09, 0x0b, 0x02, 0xda, 0x02, // .......g........
-	0x02, 0x06, 0xd5, 0x05, 0x0e, 0x07, 0x78, 0x11, 0x01, 0x03, 0x05, 0x0f, 0x15, 0x05, 0x07, 0x24, // ......x........$
-	0x09, 0x14, 0x0b, 0x02, 0x07, 0x07, 0x20, 0x01, 0x0a, 0x07, 0x02, 0x06, 0x0e, 0x08, 0x02, 0xf7, // ...... .........
-	0x0b, 0x0c, 0x02, 0x09, 0x09, 0x03, 0x32, 0x1c, 0x0e, 0x0d, 0x08, 0x24, 0x1b, 0x04, 0x0c, 0x07, // ......2....$....
-	0x00, 0x05, 0x00, 0x08, 0xff, 0xed, 0x03, 0xfa, 0x03, 0x93, 0x00, 0x0c, 0x00, 0x2e, 0x00, 0x47, // ...............G
-	0x00, 0x5a, 0x00, 0x6d, 0x00, 0x00, 0x01, 0x07, 0x27, 0x07, 0x17, 0x07, 0x17, 0x37, 0x17, 0x37, // .Z.m....'....7.7
-	0x27, 0x37, 0x27, 0x01, 0x1e, 0x01, 0x17, 0x13, 0x0f, 0x01, 0x05, 0x27, 0x2e, 0x01, 0x27, 0x03, // '7'........'..'.
-	0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x25, 0x27, 0x26, 0x36, 0x3f, 0x01, 0x27, 0x37, 0x17, 0x1e, // &67>.7%'&6?.'7..
-	0x01, 0x1f, 0x01, 0x25, 0x17, 0x13, 0x11, 0x0f, 0x01, 0x23, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x23, // ...%.....#'..5.#
-	0x2f, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x1f, 0x01, 0x01, 0x1e, // /.5467>.;.2.....
-	0x01, 0x1f, 0x01, 0x3f, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, // ...?...'........
-	0x17, 0x07, 0x3e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x1e, // ..>.'../........
-	0x01, 0x1f, 0x01, 0x37, 0x01, 0x50, 0x4e, 0x14, 0x50, 0x14, 0x4f, 0x15, 0x50, 0x15, 0x50, 0x16, // ...7.PN.P.O.P.P.
-	0x4f, 0x16, 0x01, 0xc0, 0x07, 0x0a, 0x02, 0x56, 0x04, 0x19, 0xfd, 0x33, 0x1e, 0x08, 0x09, 0x02, // O......V...3....
-	0x56, 0x02, 0x02, 0x03, 0x05, 0x0d, 0x08, 0x01, 0x3e, 0x1a, 0x03, 0x02, 0x05, 0x06, 0x01, 0x14, // V.......>.......
-	0x1f, 0x07, 0x0a, 0x02, 0x1b, 0x01, 0x3e, 0x1f, 0xea, 0x08, 0x12, 0x32, 0x12, 0x04, 0x04, 0x32, // ......>....2...2
-	0x12, 0x07, 0x03, 0x04, 0x04, 0x09, 0x05, 0x7e, 0x05, 0x09, 0x04, 0x08, 0xfe, 0xc9, 0x02, 0x09, // .......~........
-	0x08, 0x1f, 0x19, 0x04, 0x02, 0x09, 0x08, 0x08, 0x10, 0x07, 0x09, 0x0d, 0x04, 0x03, 0x02, 0x02, // ................
-	0x41, 0x05, 0x02, 0x02, 0x02, 0x0a, 0x08, 0x20, 0x08, 0x0c, 0x04, 0x03, 0x02, 0x02, 0x01, 0x0a, // A...... ........
-	0x08, 0x1e, 0x19, 0x02, 0x51, 0x16, 0x4f, 0x15, 0x4e, 0x15, 0x4f, 0x16, 0x50, 0x14, 0x50, 0x15, // ....Q.O.N.O.P.P.
-	0x4f, 0x01, 0x12, 0x04, 0x0c, 0x08, 0xfe, 0xc4, 0x20, 0x13, 0xbd, 0x04, 0x03, 0x0c, 0x09, 0x01, // O....... .......
-	0x3a, 0x09, 0x11, 0x07, 0x07, 0x0a, 0x02, 0x55, 0x62, 0x09, 0x0f, 0x07, 0x0a, 0x05, 0x05, 0x05, // :......Ub.......
-	0x04, 0x0d, 0x08, 0x63, 0x55, 0x04, 0xfe, 0x05, 0xfe, 0x9e, 0x11, 0x08, 0x08, 0x03, 0x09, 0x05, // ...cU...........
-	0x01, 0x16, 0x08, 0x12, 0x32, 0x05, 0x09, 0x04, 0x04, 0x03, 0x03, 0x04, 0x12, 0x01, 0x1f, 0x08, // ....2...........
-	0x0c, 0x04, 0x04, 0x12, 0x20, 0x08, 0x0c, 0x04, 0x05, 0x03, 0x02, 0x03, 0x0a, 0x07, 0x08, 0x10, // .... ...........
-	0x08, 0x2f, 0x08, 0x10, 0x08, 0x08, 0x0c, 0x04, 0x05, 0x02, 0x0a, 0x08, 0x07, 0x0f, 0x09, 0x08, // ./..............
-	0x0c, 0x05, 0x04, 0x13, 0x00, 0x05, 0x00, 0x08, 0xff, 0xe1, 0x03, 0xfa, 0x03, 0x9f, 0x00, 0x34, // ...............4
-	0x00, 0x47, 0x00, 0x5e, 0x00, 0x80, 0x00, 0x8d, 0x00, 0x00, 0x01, 0x3e, 0x01, 0x3b, 0x01, 0x32, // .G.^.......>.;.2
-	0x16, 0x1f, 0x01, 0x15, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x15, // .......+..32....
-	0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, // ...+."&'..=.467>
-	0x01, 0x3b, 0x01, 0x35, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x27, // .;.5#"&'..=.467'
-	0x37, 0x3e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x1e, 0x01, // 7>.'../.........
-	0x1f, 0x01, 0x37, 0x2e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, // ..7.............
-	0x3e, 0x01, 0x37, 0x3e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x25, 0x37, 0x17, 0x1e, 0x01, 0x1f, 0x01, // >.7>.'..'%7.....
-	0x25, 0x17, 0x1e, 0x01, 0x17, 0x13, 0x0f, 0x01, 0x05, 0x27, 0x2e, 0x01, 0x27, 0x03, 0x26, 0x36, // %........'..'.&6
-	0x37, 0x3e, 0x01, 0x37, 0x25, 0x27, 0x26, 0x36, 0x3f, 0x01, 0x27, 0x03, 0x27, 0x07, 0x17, 0x07, // 7>.7%'&6?.'.'...
-	0x17, 0x37, 0x17, 0x37, 0x27, 0x37, 0x27, 0x07, 0x02, 0xfe, 0x04, 0x09, 0x05, 0xd0, 0x05, 0x09, // .7.7'7'.........
-	0x04, 0x08, 0x08, 0x04, 0x09, 0x05, 0x82, 0x82, 0x05, 0x09, 0x04, 0x08, 0x08, 0x04, 0x09, 0x05, // ................
-	0xd0, 0x05, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x05, 0x82, 0x82, 0x05, 0x09, 0x04, // ................
-	0x04, 0x04, 0x04, 0x04, 0x85, 0x1a, 0x04, 0x03, 0x02, 0x02, 0x0b, 0x08, 0x21, 0x08, 0x0c, 0x04, // ............!...
-	0x04, 0x02, 0x02, 0x02, 0x0a, 0x07, 0x20, 0x9a, 0x09, 0x10, 0x08, 0x09, 0x0d, 0x04, 0x03, 0x02, // ...... .........
-	0x02, 0x02, 0x09, 0x08, 0x21, 0x07, 0x0d, 0x05, 0x04, 0x02, 0x02, 0x02, 0x09, 0x08, 0xfe, 0x47, // ....!..........G
-	0x15, 0x20, 0x07, 0x0a, 0x03, 0x1b, 0x01, 0x47, 0x1f, 0x07, 0x0a, 0x02, 0x58, 0x04, 0x1a, 0xfd, // . .....G....X...
-	0x21, 0x1f, 0x07, 0x0a, 0x02, 0x58, 0x02, 0x02, 0x04, 0x04, 0x0d, 0x09, 0x01, 0x46, 0x1b, 0x03, // !....X.......F..
-	0x02, 0x05, 0x06, 0x01, 0x52, 0x14, 0x52, 0x15, 0x52, 0x16, 0x52, 0x16, 0x51, 0x16, 0x51, 0x16, // ....R.R.R.R.Q.Q.
-	0x51, 0x01, 0x78, 0x04, 0x04, 0x04, 0x04, 0x12, 0xcf, 0x13, 0x03, 0x04, 0x34, 0x04, 0x04, 0x12, // Q.x.........4...
-	0x34, 0x12, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x05, 0xcf, 0x06, 0x09, 0x03, 0x04, 0x04, 0x34, // 4..............4
-	0x04, 0x04, 0x04, 0x09, 0x05, 0x34, 0x05, 0x09, 0x04, 0xd1, 0x13, 0x08, 0x10, 0x09, 0x08, 0x0c, // .....4..........
-	0x04, 0x05, 0x02, 0x0a, 0x08, 0x07, 0x10, 0x08, 0x09, 0x0d, 0x04, 0x04, 0x72, 0x05, 0x03, 0x02, // ............r...
-	0x02, 0x0b, 0x07, 0x08, 0x10, 0x09, 0x08, 0x0d, 0x03, 0x04, 0x02, 0x09, 0x07, 0x08, 0x10, 0x08, // ................
-	0x09, 0x0c, 0x04, 0xdf, 0x05, 0x05, 0x05, 0x0d, 0x08, 0x65, 0x57, 0x04, 0x04, 0x0d, 0x08, 0xfe, // .........eW.....
-	0xbc, 0x20, 0x14, 0xc2, 0x04, 0x03, 0x0d, 0x08, 0x01, 0x43, 0x09, 0x11, 0x08, 0x07, 0x0a, 0x02, // . .......C......
-	0x57, 0x65, 0x08, 0x10, 0x07, 0x0b, 0x05, 0xfe, 0xa4, 0x51, 0x15, 0x50, 0x16, 0x51, 0x16, 0x51, // We.......Q.P.Q.Q
-	0x14, 0x52, 0x16, 0x50, 0x16, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0xff, 0xe1, 0x03, 0xfa, // .R.P............
-	0x03, 0x9f, 0x00, 0x30, 0x00, 0x43, 0x00, 0x58, 0x00, 0x65, 0x00, 0x89, 0x00, 0x00, 0x01, 0x17, // ...0.C.X.e......
-	0x11, 0x0f, 0x01, 0x23, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, // ...#'..=.467>.;.
-	0x35, 0x23, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x23, // 5#'..=.467>.;.5#
-	0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x01, // '..=.467>.;.2...
-	0x1e, 0x01, 0x1f, 0x01, 0x3f, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, // ....?...'.......
-	0x01, 0x17, 0x07, 0x2e, 0x01, 0x2f, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x1e, 0x01, 0x1f, // ...../..........
-	0x01, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x27, 0x05, 0x17, 0x37, 0x17, 0x37, 0x27, 0x37, 0x27, 0x07, // .>.7>.'..7.7'7'.
-	0x27, 0x07, 0x17, 0x07, 0x27, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x25, 0x27, 0x26, 0x36, 0x3f, // '...'&67>.7%'&6?
-	0x01, 0x27, 0x37, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x25, 0x17, 0x1e, 0x01, 0x17, 0x13, 0x07, 0x0e, // .'7.....%.......
-	0x01, 0x07, 0x05, 0x27, 0x2e, 0x01, 0x27, 0x03, 0x03, 0xf2, 0x08, 0x08, 0x12, 0xd0, 0x12, 0x04, // ...'..'.........
-	0x04, 0x04, 0x04, 0x04, 0x09, 0x05, 0x82, 0x82, 0x12, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x05, // ................
-	0x82, 0x82, 0x12, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x05, 0xd0, 0x05, 0x09, 0x04, 0xfe, 0xe3, // ................
-	0x02, 0x09, 0x08, 0x20, 0x1a, 0x04, 0x02, 0x09, 0x08, 0x09, 0x10, 0x08, 0x09, 0x0d, 0x03, 0x04, // ... ............
-	0x02, 0x02, 0x3d, 0x02, 0x0b, 0x08, 0x20, 0x09, 0x0c, 0x04, 0x04, 0x02, 0x02, 0x02, 0x0a, 0x08, // ..=... .........
-	0x1f, 0x08, 0x0d, 0x04, 0x05, 0x03, 0x02, 0xfd, 0xcd, 0x16, 0x52, 0x16, 0x51, 0x16, 0x51, 0x16, // ..........R.Q.Q.
-	0x51, 0x14, 0x52, 0x15, 0x52, 0x5d, 0x02, 0x02, 0x04, 0x04, 0x0d, 0x09, 0x01, 0x46, 0x1b, 0x03, // Q.R.R].......F..
-	0x02, 0x05, 0x06, 0x01, 0x15, 0x20, 0x07, 0x0a, 0x03, 0x1b, 0x01, 0x47, 0x1f, 0x07, 0x0a, 0x02, // ..... .....G....
-	0x58, 0x04, 0x05, 0x0d, 0x08, 0xfd, 0x21, 0x1f, 0x07, 0x0a, 0x02, 0x58, 0x01, 0x78, 0x12, 0xfe, // X.....!....X.x..
-	0x95, 0x12, 0x08, 0x08, 0x04, 0x09, 0x05, 0x34, 0x05, 0x09, 0x04, 0x04, 0x04, 0x34, 0x07, 0x04, // .......4.....4..
-	0x09, 0x05, 0x34, 0x06, 0x09, 0x03, 0x04, 0x04, 0x34, 0x08, 0x04, 0x09, 0x05, 0x34, 0x05, 0x09, // ..4.....4....4..
-	0x04, 0x04, 0x04, 0x04, 0x04, 0x01, 0x14, 0x08, 0x0d, 0x03, 0x04, 0x12, 0x20, 0x09, 0x0c, 0x04, // ............ ...
-	0x05, 0x03, 0x02, 0x02, 0x0b, 0x07, 0x08, 0x10, 0x09, 0x0f, 0x08, 0x0c, 0x04, 0x05, 0x02, 0x0a, // ................
-	0x08, 0x07, 0x10, 0x08, 0x09, 0x0d, 0x04, 0x04, 0x02, 0x0a, 0x07, 0x08, 0x10, 0x09, 0x69, 0x51, // ..............iQ
-	0x16, 0x51, 0x14, 0x52, 0x16, 0x50, 0x16, 0x51, 0x15, 0x50, 0x16, 0x66, 0x09, 0x11, 0x08, 0x07, // .Q.R.P.Q.P.f....
-	0x0a, 0x02, 0x57, 0x65, 0x09, 0x0f, 0x07, 0x0b, 0x05, 0x05, 0x05, 0x05, 0x0d, 0x08, 0x65, 0x57, // ..We..........eW
-	0x04, 0x04, 0x0d, 0x08, 0xfe, 0xbc, 0x20, 0x08, 0x09, 0x03, 0xc2, 0x04, 0x03, 0x0d, 0x08, 0x01, // ...... .........
-	0x43, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0xff, 0xe1, 0x03, 0xfa, 0x03, 0x9f, 0x00, 0x12, // C...............
-	0x00, 0x34, 0x00, 0x63, 0x00, 0x76, 0x00, 0x83, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x1f, 0x01, 0x37, // .4.c.v.........7
-	0x3e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x13, 0x1e, 0x01, // >.'../..........
-	0x17, 0x13, 0x0f, 0x01, 0x05, 0x27, 0x2e, 0x01, 0x27, 0x03, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, // .....'..'.&67>.7
-	0x25, 0x27, 0x26, 0x36, 0x3f, 0x01, 0x27, 0x37, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x25, 0x17, 0x13, // %'&6?.'7.....%..
-	0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, // ..+."&'..=.#"&'.
-	0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x1f, 0x01, 0x15, 0x33, // .=.467>.;.2....3
-	0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x1f, 0x01, 0x11, 0x07, 0x01, 0x17, // 5467>.;.2.......
-	0x3f, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x17, 0x1e, 0x01, // ?...'...........
-	0x17, 0x05, 0x07, 0x27, 0x07, 0x17, 0x07, 0x17, 0x37, 0x17, 0x37, 0x27, 0x37, 0x27, 0x02, 0x46, // ...'....7.7'7'.F
-	0x02, 0x0a, 0x07, 0x20, 0x1a, 0x04, 0x03, 0x02, 0x02, 0x0b, 0x08, 0x21, 0x08, 0x0c, 0x04, 0x04, // ... .......!....
-	0x02, 0x02, 0xde, 0x07, 0x0a, 0x02, 0x58, 0x04, 0x1a, 0xfd, 0x21, 0x1f, 0x07, 0x0a, 0x02, 0x58, // ......X...!....X
-	0x02, 0x02, 0x04, 0x04, 0x0d, 0x09, 0x01, 0x46, 0x1b, 0x03, 0x02, 0x05, 0x06, 0x01, 0x15, 0x20, // .......F....... 
-	0x07, 0x0a, 0x03, 0x1b, 0x01, 0x47, 0x1f, 0xce, 0x04, 0x09, 0x05, 0x34, 0x05, 0x09, 0x04, 0x04, // .....G.....4....
-	0x04, 0x82, 0x05, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, 0x05, 0x34, 0x05, 0x09, 0x04, // ............4...
-	0x08, 0x34, 0x04, 0x04, 0x04, 0x09, 0x05, 0x34, 0x05, 0x09, 0x04, 0x08, 0x08, 0xfe, 0xf6, 0x20, // .4.....4....... 
-	0x1a, 0x04, 0x02, 0x09, 0x08, 0x09, 0x10, 0x08, 0x09, 0x0d, 0x03, 0x04, 0x02, 0x02, 0x02, 0x09, // ................
-	0x08, 0xfe, 0x71, 0x51, 0x14, 0x52, 0x15, 0x52, 0x16, 0x52, 0x16, 0x51, 0x16, 0x51, 0x16, 0x02, // ..qQ.R.R.R.Q.Q..
-	0x67, 0x09, 0x0d, 0x04, 0x04, 0x13, 0x08, 0x10, 0x09, 0x08, 0x0c, 0x04, 0x05, 0x01, 0x0b, 0x08, // g...............
-	0x07, 0x10, 0x08, 0x01, 0x07, 0x04, 0x0c, 0x09, 0xfe, 0xbc, 0x20, 0x14, 0xc2, 0x04, 0x04, 0x0c, // .......... .....
-	0x08, 0x01, 0x43, 0x09, 0x11, 0x08, 0x07, 0x0a, 0x02, 0x57, 0x65, 0x09, 0x0f, 0x07, 0x0b, 0x05, // ..C......We.....
-	0x05, 0x05, 0x05, 0x0d, 0x08, 0x65, 0x57, 0x04, 0xfc, 0x7b, 0x04, 0x04, 0x04, 0x04, 0x04, 0x09, // .....eW..{......
-	0x05, 0x82, 0x03, 0x04, 0x04, 0x09, 0x05, 0xd0, 0x05, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x12, // ................
-	0x82, 0x82, 0x05, 0x09, 0x04, 0x04, 0x04, 0x04, 0x04, 0x12, 0xfe, 0x95, 0x12, 0x02, 0x8b, 0x04, // ................
-	0x12, 0x20, 0x09, 0x0c, 0x04, 0x05, 0x03, 0x02, 0x02, 0x0b, 0x07, 0x08, 0x10, 0x09, 0x08, 0x0d, // . ..............
-	0x03, 0x20, 0x16, 0x51, 0x15, 0x50, 0x16, 0x51, 0x16, 0x51, 0x14, 0x52, 0x16, 0x50, 0x00, 0x00, // . .Q.P.Q.Q.R.P..
-	0x00, 0x01, 0x00, 0x4e, 0xff, 0xc6, 0x03, 0xb2, 0x03, 0xba, 0x00, 0x32, 0x00, 0x00, 0x17, 0x35, // ...N.......2...5
-	0x34, 0x36, 0x37, 0x35, 0x3e, 0x01, 0x33, 0x21, 0x11, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, // 4675>.3!...'..54
-	0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, // 67>.32..........
-	0x07, 0x11, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x0f, 0x01, 0x21, 0x27, 0x2e, 0x01, // ..!2........!'..
-	0x35, 0x4e, 0x0c, 0x0d, 0x0d, 0x1f, 0x12, 0x01, 0x03, 0x12, 0x22, 0x10, 0x1f, 0x1f, 0x1f, 0x1f, // 5N........".....
-	0x20, 0x4e, 0x2d, 0x2c, 0x4d, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0f, 0x22, 0x12, 0x01, 0x06, 0x12, //  N-,M     ."....
-	0x1e, 0x0d, 0x0d, 0x0d, 0x09, 0x14, 0xfc, 0xd6, 0x14, 0x05, 0x04, 0x1d, 0xc5, 0x12, 0x1e, 0x0d, // ................
-	0x01, 0x0d, 0x0d, 0x01, 0x19, 0x08, 0x17, 0x0f, 0x20, 0x4d, 0x2d, 0x2c, 0x4d, 0x20, 0x20, 0x20, // ........ M-,M   
-	0x20, 0x20, 0x20, 0x4d, 0x2c, 0x2d, 0x4d, 0x20, 0x0f, 0x17, 0x08, 0xfe, 0xe7, 0x0d, 0x0d, 0x0d, //    M,-M ........
-	0x1e, 0x11, 0xc7, 0x14, 0x09, 0x09, 0x04, 0x0a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x25, 0x23, 0x15, 0x33, // .........3..%#.3
-	0x35, 0x03, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x15, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, // 5......#.!2.....
-	0x11, 0x21, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x35, 0x22, 0x26, 0x27, 0x2e, 0x01, // .!.467>.3!5"&'..
-	0x3d, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, // =.467>.;.2......
-	0x03, 0x7b, 0x7e, 0x7e, 0x7e, 0x13, 0x13, 0x12, 0x2d, 0x1a, 0x01, 0x3c, 0x0d, 0x16, 0x0a, 0x09, // .{~~~...-..<....
-	0x0a, 0xfc, 0x0c, 0x09, 0x09, 0x09, 0x17, 0x0e, 0x01, 0x3c, 0x1b, 0x2d, 0x12, 0x13, 0x12, 0x12, // .........<.-....
-	0x13, 0x13, 0x2d, 0x1a, 0xfc, 0x1a, 0x2d, 0x12, 0x13, 0x13, 0xc3, 0x7e, 0x7e, 0x01, 0xfa, 0x1b, // ..-...-....~~...
-	0x2d, 0x12, 0x12, 0x13, 0xfc, 0x0a, 0x09, 0x0a, 0x16, 0x0d, 0xfe, 0xc4, 0x01, 0x3b, 0x0d, 0x17, // -............;..
-	0x0a, 0x09, 0x0a, 0xfc, 0x13, 0x12, 0x13, 0x2d, 0x1a, 0x7e, 0x1a, 0x2d, 0x12, 0x13, 0x13, 0x13, // .......-.~.-....
-	0x13, 0x13, 0x2d, 0x19, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4e, 0xff, 0xc6, 0x03, 0xb2, // ..-.~......N....
-	0x03, 0xaa, 0x00, 0x30, 0x00, 0x00, 0x01, 0x07, 0x13, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, // ...0.....32.....
-	0x01, 0x0f, 0x01, 0x21, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x35, 0x3e, 0x01, 0x33, // ...!'..=.4675>.3
-	0x21, 0x03, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x16, // !...'..'&67>.76.
-	0x17, 0x1e, 0x01, 0x17, 0x16, 0x06, 0x07, 0x02, 0x48, 0x34, 0x51, 0xf6, 0x12, 0x1e, 0x0d, 0x0d, // ........H4Q.....
-	0x0d, 0x09, 0x14, 0xfc, 0xd6, 0x14, 0x05, 0x04, 0x0c, 0x0d, 0x0d, 0x1f, 0x12, 0x01, 0x0d, 0x46, // ...............F
-	0x13, 0x27, 0x14, 0x26, 0x32, 0x0c, 0x0b, 0x0a, 0x16, 0x18, 0x43, 0x2b, 0x2c, 0x51, 0x27, 0x27, // .'.&2.....C+,Q''
-	0x32, 0x0c, 0x0c, 0x0b, 0x17, 0x02, 0x6d, 0x3e, 0xfe, 0xd1, 0x0d, 0x0d, 0x0d, 0x1e, 0x11, 0xc7, // 2.....m>........
-	0x14, 0x09, 0x09, 0x04, 0x0b, 0x05, 0xc5, 0x12, 0x1f, 0x0c, 0x01, 0x0d, 0x0d, 0x01, 0x02, 0x03, // ................
-	0x0d, 0x0b, 0x17, 0x42, 0x2b, 0x2b, 0x52, 0x28, 0x26, 0x32, 0x0c, 0x0b, 0x0a, 0x15, 0x18, 0x41, // ...B++R(&2.....A
-	0x2b, 0x2b, 0x53, 0x27, 0x00, 0x01, 0x00, 0x4e, 0xff, 0xc6, 0x03, 0xb2, 0x03, 0xaa, 0x00, 0x34, // ++S'...N.......4
-	0x00, 0x00, 0x01, 0x3e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, // ...>............
-	0x01, 0x07, 0x03, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x21, // ...!2.........#!
-	0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0x35, 0x3e, 0x01, 0x3b, 0x01, 0x13, 0x2e, 0x01, // '..=.4675>.;....
-	0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x02, 0x01, 0x28, 0x53, 0x2c, 0x2b, 0x42, 0x16, 0x18, // '..7>.7..(S,+B..
-	0x0b, 0x0b, 0x0c, 0x33, 0x28, 0x12, 0x26, 0x13, 0x44, 0x01, 0x0e, 0x12, 0x1e, 0x0d, 0x0d, 0x0d, // ...3(.&.D.......
-	0x09, 0x04, 0x0a, 0x06, 0xfc, 0xd6, 0x14, 0x05, 0x04, 0x0c, 0x0c, 0x0e, 0x1f, 0x12, 0xf3, 0x51, // ...............Q
-	0x10, 0x1c, 0x0b, 0x15, 0x0a, 0x0c, 0x0c, 0x31, 0x25, 0x03, 0x96, 0x15, 0x0a, 0x0b, 0x0c, 0x32, // .......1%......2
-	0x26, 0x28, 0x52, 0x2b, 0x2b, 0x42, 0x17, 0x0a, 0x0e, 0x03, 0xfe, 0xfe, 0x0d, 0x0d, 0x0d, 0x1e, // &(R++B..........
-	0x11, 0xc7, 0x14, 0x04, 0x05, 0x09, 0x04, 0x0b, 0x05, 0xc5, 0x12, 0x1f, 0x0c, 0x01, 0x0d, 0x0d, // ................
-	0x01, 0x2f, 0x0c, 0x1f, 0x13, 0x27, 0x52, 0x2c, 0x2b, 0x41, 0x18, 0x00, 0x00, 0x03, 0x00, 0x69, // ./...'R,+A.....i
-	0xff, 0xc6, 0x03, 0x97, 0x03, 0xba, 0x00, 0x14, 0x00, 0x32, 0x00, 0x4d, 0x00, 0x00, 0x13, 0x33, // .........2.M...3
-	0x15, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x37, 0x16, 0x36, 0x37, 0x07, 0x3e, 0x01, 0x3d, 0x01, 0x33, // ......7.67.>.=.3
-	0x11, 0x21, 0x11, 0x03, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x23, // .!..>.3!2......#
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, // .....+."&'..5.46
-	0x37, 0x05, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x14, 0x06, 0x07, 0x0e, // 7.>.32..........
-	0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x34, 0x36, 0x37, 0xc0, 0x90, 0x01, 0x18, // .#"&'..=.467....
-	0x17, 0x1a, 0x3f, 0x26, 0x25, 0x40, 0x1a, 0x03, 0x19, 0x19, 0x93, 0xfd, 0x80, 0x47, 0x09, 0x15, // ..?&%@.......G..
-	0x0c, 0x02, 0xba, 0x0b, 0x15, 0x08, 0x09, 0x09, 0x02, 0x3b, 0x3c, 0x3b, 0x8f, 0x54, 0x01, 0x55, // .........;<;.T.U
-	0x90, 0x3b, 0x3b, 0x3b, 0x08, 0x08, 0x01, 0x47, 0x0d, 0x1f, 0x13, 0x12, 0x1e, 0x0d, 0x0d, 0x0d, // .;;;...G........
-	0x0d, 0x0d, 0x0d, 0x1e, 0x12, 0x13, 0x1f, 0x0d, 0x0c, 0x0d, 0x0d, 0x0c, 0x02, 0x44, 0x6d, 0x24, // .............Dm$
-	0x3f, 0x1a, 0x1e, 0x1d, 0x01, 0x01, 0x1e, 0x1f, 0x05, 0x1b, 0x40, 0x25, 0x6d, 0x01, 0x1e, 0xfe, // ?.........@%m...
-	0xe2, 0x01, 0x64, 0x09, 0x09, 0x09, 0x09, 0x09, 0x14, 0x0c, 0xfd, 0xdd, 0x55, 0x8f, 0x3a, 0x3c, // ..d.........U.:<
-	0x3c, 0x3c, 0x3c, 0x3a, 0x90, 0x54, 0x02, 0x22, 0x0c, 0x15, 0x09, 0xb5, 0x0d, 0x0e, 0x0e, 0x0d, // <<<:.T."........
-	0x0e, 0x22, 0x13, 0xd9, 0x13, 0x22, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x22, 0x13, 0xd9, 0x13, // ."..."......"...
-	0x22, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x69, 0xff, 0xc6, 0x03, 0x97, 0x03, 0xba, 0x00, 0x1c, // "......i........
-	0x00, 0x3a, 0x00, 0x45, 0x00, 0x51, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, // .:.E.Q.....#"...
-	0x01, 0x0f, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x3d, // .........3267>.=
-	0x01, 0x27, 0x2e, 0x01, 0x27, 0x25, 0x11, 0x23, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, // .'..'%.#.....+."
-	0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, // &'..5.467>.3!2..
-	0x1e, 0x01, 0x15, 0x01, 0x35, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x11, 0x33, 0x01, 0x21, // ....5>.7>.3!.3.!
-	0x32, 0x16, 0x17, 0x27, 0x1e, 0x01, 0x1d, 0x01, 0x33, 0x11, 0x02, 0x3c, 0x0d, 0x1e, 0x12, 0x13, // 2..'....3..<....
-	0x1f, 0x0d, 0x08, 0x0a, 0x02, 0x05, 0x0d, 0x0c, 0x0d, 0x1f, 0x12, 0x13, 0x1e, 0x0d, 0x0d, 0x0d, // ................
-	0x03, 0x04, 0x0b, 0x08, 0x01, 0x5b, 0x02, 0x3b, 0x3c, 0x3b, 0x8f, 0x54, 0x01, 0x55, 0x90, 0x3b, // .....[.;<;.T.U.;
-	0x3b, 0x3b, 0x08, 0x08, 0x09, 0x15, 0x0c, 0x02, 0xba, 0x0b, 0x15, 0x08, 0x09, 0x09, 0xfd, 0xb9, // ;;..............
-	0x01, 0x18, 0x17, 0x19, 0x3b, 0x23, 0xfe, 0xc9, 0x90, 0x01, 0xf0, 0xfe, 0xc6, 0x23, 0x3d, 0x18, // ....;#.......#=.
-	0x03, 0x19, 0x19, 0x93, 0x02, 0xf1, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x13, 0x0b, 0x1a, 0xd9, 0x13, // ................
-	0x22, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x22, 0x13, 0xd9, 0x1a, 0x0b, 0x13, 0x09, 0x8e, 0xfd, // "......"........
-	0xdd, 0x55, 0x8f, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3a, 0x90, 0x54, 0x02, 0x22, 0x0c, 0x15, 0x09, // .U.:<<<<:.T."...
-	0x09, 0x09, 0x09, 0x09, 0x09, 0x14, 0x0c, 0xfe, 0xc5, 0x6c, 0x23, 0x3d, 0x1a, 0x1b, 0x1d, 0xfe, // .........l#=....
-	0xe2, 0x01, 0x1e, 0x1d, 0x1d, 0x05, 0x1a, 0x3f, 0x24, 0x6c, 0x01, 0x1e, 0x00, 0x03, 0x00, 0x69, // .......?$l.....i
-	0xff, 0xc6, 0x03, 0x97, 0x03, 0xba, 0x00, 0x1a, 0x00, 0x26, 0x00, 0x44, 0x00, 0x00, 0x01, 0x0e, // .........&.D....
-	0x01, 0x0f, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x3d, // .........3267>.=
-	0x01, 0x2f, 0x01, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x37, 0x1e, 0x01, 0x1d, 0x01, 0x33, 0x11, // ./...#"..7....3.
-	0x21, 0x32, 0x16, 0x17, 0x27, 0x25, 0x1e, 0x01, 0x15, 0x11, 0x23, 0x14, 0x06, 0x07, 0x0e, 0x01, // !2..'%....#.....
-	0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, // +."&'..5.467>.3!
-	0x32, 0x16, 0x17, 0x01, 0xc0, 0x08, 0x0a, 0x02, 0x05, 0x0d, 0x0c, 0x0d, 0x1f, 0x12, 0x13, 0x1e, // 2...............
-	0x0d, 0x0d, 0x0d, 0x03, 0x18, 0x0c, 0x1e, 0x13, 0x12, 0x1f, 0x0d, 0xbb, 0x19, 0x19, 0x93, 0xfe, // ................
-	0xc6, 0x23, 0x3d, 0x18, 0x03, 0x01, 0x0a, 0x09, 0x09, 0x02, 0x3b, 0x3c, 0x3b, 0x8f, 0x54, 0x01, // .#=.......;<;.T.
-	0x55, 0x90, 0x3b, 0x3b, 0x3b, 0x08, 0x08, 0x09, 0x15, 0x0c, 0x02, 0xba, 0x0b, 0x15, 0x08, 0x02, // U.;;;...........
-	0xf1, 0x09, 0x13, 0x0b, 0x1a, 0xd9, 0x13, 0x22, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x22, 0x13, // ......."......".
-	0xd9, 0x1a, 0x27, 0x0e, 0x0e, 0x0e, 0x0e, 0x3c, 0x1a, 0x3f, 0x24, 0x6c, 0x01, 0x1e, 0x1d, 0x1d, // ..'....<.?$l....
-	0x05, 0x7b, 0x09, 0x14, 0x0c, 0xfd, 0xdd, 0x55, 0x8f, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3a, 0x90, // .{.....U.:<<<<:.
-	0x54, 0x02, 0x22, 0x0c, 0x15, 0x09, 0x09, 0x09, 0x09, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x69, // T."............i
-	0xff, 0xc6, 0x03, 0x97, 0x03, 0xba, 0x00, 0x0a, 0x00, 0x28, 0x00, 0x43, 0x00, 0x00, 0x13, 0x33, // .........(.C...3
-	0x35, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x11, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x23, 0x14, // 5>.7>.3!......#.
-	0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, // ....+."&'..5.467
-	0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x05, 0x07, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, // >.3!2..........3
-	0x32, 0x36, 0x37, 0x3e, 0x01, 0x3d, 0x01, 0x2f, 0x01, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, // 267>.=./...#"...
-	0x01, 0x07, 0xc0, 0x90, 0x01, 0x18, 0x17, 0x19, 0x3b, 0x23, 0xfe, 0xc9, 0x02, 0xc5, 0x09, 0x09, // ........;#......
-	0x02, 0x3b, 0x3c, 0x3b, 0x8f, 0x54, 0x01, 0x55, 0x90, 0x3b, 0x3b, 0x3b, 0x08, 0x08, 0x09, 0x15, // .;<;.T.U.;;;....
-	0x0c, 0x02, 0xba, 0x0b, 0x15, 0x08, 0xfe, 0x27, 0x05, 0x0d, 0x0c, 0x0d, 0x1f, 0x12, 0x13, 0x1e, // .......'........
-	0x0d, 0x0d, 0x0d, 0x03, 0x18, 0x0c, 0x1e, 0x13, 0x12, 0x1f, 0x0d, 0x08, 0x0a, 0x02, 0x02, 0x44, // ...............D
-	0x6c, 0x23, 0x3d, 0x1a, 0x1b, 0x1d, 0xfe, 0xe2, 0x01, 0x64, 0x09, 0x14, 0x0c, 0xfd, 0xdd, 0x55, // l#=......d.....U
-	0x8f, 0x3a, 0x3c, 0x3c, 0x3c, 0x3c, 0x3a, 0x90, 0x54, 0x02, 0x22, 0x0c, 0x15, 0x09, 0x09, 0x09, // .:<<<<:.T.".....
-	0x09, 0x09, 0xde, 0x1a, 0xd9, 0x13, 0x22, 0x0e, 0x0e, 0x0f, 0x0f, 0x0e, 0x0e, 0x22, 0x13, 0xd9, // ......"......"..
-	0x1a, 0x27, 0x0e, 0x0e, 0x0e, 0x0e, 0x09, 0x13, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, // .'..............
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x1e, 0x03, 0x15, // .......(./......
-	0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, // ......#"..'..54>
-	0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x05, 0x15, 0x33, 0x11, 0x33, 0x11, 0x23, // .7>.32.....3.3.#
-	0x03, 0x65, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, // .e%8%..%8%%QYa55
-	0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, // aZR%$8$..$8$%RZa
-	0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0xfe, 0x3c, 0x4a, 0x54, 0x9e, 0x03, 0x27, 0x25, 0x52, 0x5a, // 55aYQ%.<JT..'%RZ
-	0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, // a55aYQ%%8%..%8%%
-	0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x37, 0x25, 0x13, 0x13, 0x25, 0x37, // QYa55aZR%$7%..%7
-	0x24, 0x9a, 0x4d, 0xfe, 0xb3, 0x01, 0x9a, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // $.M.............
-	0x03, 0xba, 0x00, 0x28, 0x00, 0x4d, 0x00, 0x00, 0x01, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, // ...(.M.........#
-	0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, // "..'..54>.7>.32.
-	0x02, 0x17, 0x1e, 0x03, 0x15, 0x25, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x17, 0x3e, 0x01, 0x33, // .....%"......>.3
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x02, 0x15, 0x21, 0x35, 0x23, 0x3f, 0x01, // 2..........!5#?.
-	0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x03, 0xfa, 0x13, 0x25, 0x38, 0x25, 0x25, // >.54&'..#...%8%%
-	0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, // QYa55aZR%$8$..$8
-	0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0xfe, // $%RZa55aYQ%%8%..
-	0x09, 0x1c, 0x30, 0x13, 0x12, 0x22, 0x10, 0x4f, 0x13, 0x26, 0x15, 0x0c, 0x13, 0x07, 0x08, 0x08, // ..0..".O.&......
-	0x09, 0x09, 0x37, 0x80, 0x01, 0x32, 0xac, 0x4f, 0x41, 0x08, 0x08, 0x16, 0x15, 0x15, 0x31, 0x1c, // ..7..2.OA.....1.
-	0x01, 0xc0, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, // ..5aYQ%%8%..%8%%
-	0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, // QYa55aZR%$8$..$8
-	0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0xdd, 0x0c, 0x0b, 0x0d, 0x24, 0x18, 0x2e, 0x1e, 0x1e, 0x08, // $%RZa5....$.....
-	0x08, 0x07, 0x11, 0x0b, 0x0b, 0x17, 0x0b, 0x3e, 0x83, 0x47, 0x57, 0x50, 0x4e, 0x10, 0x20, 0x10, // .......>.GWPN. .
-	0x1f, 0x31, 0x11, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // .1..............
-	0x03, 0xba, 0x00, 0x27, 0x00, 0x50, 0x00, 0x00, 0x01, 0x35, 0x21, 0x15, 0x33, 0x07, 0x15, 0x37, // ...'.P...5!.3..7
-	0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x07, // 2..........#"&'.
-	0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x37, // ..3267>.54&'..'7
-	0x37, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, // 7.........#"..'.
-	0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x02, 0x89, 0xfe, // .54>.7>.32......
-	0xf2, 0x8b, 0x55, 0x3a, 0x14, 0x1f, 0x0b, 0x0a, 0x0b, 0x09, 0x09, 0x0a, 0x19, 0x0f, 0x18, 0x37, // ..U:...........7
-	0x20, 0x29, 0x26, 0x4a, 0x24, 0x25, 0x3c, 0x18, 0x17, 0x18, 0x0f, 0x0f, 0x0d, 0x29, 0x1b, 0x5a, //  )&J$%<......).Z
-	0xdc, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, // .%8%..%8%%QYa55a
-	0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, // ZR%$8$..$8$%RZa5
-	0x35, 0x61, 0x59, 0x51, 0x25, 0x02, 0x3e, 0x40, 0x4e, 0x5b, 0x44, 0x0c, 0x08, 0x08, 0x07, 0x13, // 5aYQ%.>@N[D.....
-	0x0d, 0x0d, 0x13, 0x08, 0x06, 0x06, 0x14, 0x13, 0x47, 0x17, 0x18, 0x12, 0x12, 0x12, 0x32, 0x20, // ........G.....2 
-	0x15, 0x26, 0x11, 0x10, 0x15, 0x04, 0x5e, 0xe9, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, // .&....^.%RZa55aY
-	0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, // Q%%8%..%8%%QYa55
-	0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x00, 0x03, 0x00, 0x06, // aZR%$8$..$8$....
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x28, 0x00, 0x31, 0x00, 0x35, 0x00, 0x00, 0x01, 0x1e, // .......(.1.5....
-	0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, // ........#"..'..5
-	0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x05, 0x23, 0x03, 0x33, 0x37, // 4>.7>.32....#.37
-	0x33, 0x17, 0x33, 0x03, 0x07, 0x17, 0x23, 0x37, 0x03, 0x65, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, // 3.3...#7.e%8%..%
-	0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, // 8%%QYa55aZR%$8$.
-	0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0xfe, 0xc7, // .$8$%RZa55aYQ%..
-	0x58, 0xb1, 0x62, 0x26, 0xaa, 0x28, 0x60, 0xb1, 0x2a, 0x32, 0x68, 0x36, 0x03, 0x27, 0x25, 0x52, // X.b&.(`.*2h6.'%R
-	0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, // Za55aYQ%%8%..%8%
-	0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, // %QYa55aZR%$8$..$
-	0x38, 0x24, 0x9a, 0xfe, 0x66, 0x58, 0x58, 0x01, 0x9a, 0x79, 0x78, 0x78, 0x00, 0x02, 0x00, 0x06, // 8$..fXX..yxx....
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x0c, 0x00, 0x35, 0x00, 0x00, 0x01, 0x23, 0x07, 0x27, // .........5...#.'
-	0x23, 0x17, 0x07, 0x33, 0x37, 0x17, 0x33, 0x27, 0x37, 0x37, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, // #..37.3'77......
-	0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, // ...#"..'..54>.7>
-	0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x02, 0xc2, 0x71, 0x51, 0x52, 0x72, 0x86, 0x8f, 0x71, 0x5c, // .32.....qQRr..q.
-	0x5a, 0x73, 0x8e, 0x83, 0xa3, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, // Zs...%8%..%8%%QY
-	0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x25, // a55aZR%$8$..$8$%
-	0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x02, 0x8d, 0x79, 0x79, 0xc8, 0xd2, 0x87, // RZa55aYQ%..yy...
-	0x87, 0xd3, 0xc7, 0x9a, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, // ....%RZa55aYQ%%8
-	0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, // %..%8%%QYa55aZR%
-	0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // $8$..$8$........
-	0x03, 0xba, 0x00, 0x09, 0x00, 0x32, 0x00, 0x00, 0x01, 0x23, 0x07, 0x27, 0x23, 0x17, 0x15, 0x33, // .....2...#.'#..3
-	0x35, 0x37, 0x03, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, // 57.2............
-	0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x02, // #"..'..54>.7>.3.
-	0xbe, 0x64, 0x5a, 0x5a, 0x64, 0x90, 0x5c, 0x90, 0xbe, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, // .dZZd....5aYQ%%8
-	0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, // %..%8%%QYa55aZR%
-	0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x02, 0x7e, 0x98, // $8$..$8$%RZa5.~.
-	0x98, 0xf8, 0xa3, 0xa3, 0xf8, 0x01, 0x3c, 0x13, 0x24, 0x38, 0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, // ......<.$8$%RZa5
-	0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, // 5aYQ%%8%..%8%%QY
-	0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x00, 0x00, 0x02, 0x00, 0x06, // a55aZR%$8$......
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x28, 0x00, 0x65, 0x00, 0x00, 0x01, 0x2e, 0x03, 0x23, // .......(.e.....#
-	0x22, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x33, 0x32, 0x3e, // "............32>
-	0x02, 0x37, 0x3e, 0x03, 0x35, 0x34, 0x2e, 0x02, 0x27, 0x03, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, // .7>.54..'.......
-	0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x2f, 0x01, // ...#"&/....#"&/.
-	0x2e, 0x01, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x3f, 0x01, 0x3e, // ..546?.'..546?.>
-	0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x1e, 0x01, // .32...7>.32.....
-	0x15, 0x14, 0x06, 0x0f, 0x01, 0x17, 0x03, 0x67, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, // .......g%RZa55aY
-	0x52, 0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, 0x59, 0x61, 0x35, 0x35, // R$%8%..%8%$RYa55
-	0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, 0x13, 0x24, 0x37, 0x25, 0x3c, 0x02, 0x02, 0x02, // aZR%%7$..$7%<...
-	0x02, 0x18, 0x03, 0x06, 0x03, 0x03, 0x06, 0x03, 0xfb, 0xfe, 0x02, 0x06, 0x04, 0x03, 0x06, 0x02, // ................
-	0x18, 0x02, 0x03, 0x03, 0x02, 0xfe, 0xfb, 0x03, 0x02, 0x02, 0x03, 0x17, 0x03, 0x06, 0x03, 0x04, // ................
-	0x06, 0x02, 0xfc, 0xfd, 0x02, 0x06, 0x04, 0x03, 0x06, 0x02, 0x18, 0x02, 0x03, 0x03, 0x02, 0xfe, // ................
-	0xfc, 0x03, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, 0x59, 0x61, 0x35, // ..%%8%..%8%$RYa5
-	0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, // 5aZR%%7$..$7%%RZ
-	0x61, 0x35, 0x35, 0x61, 0x59, 0x52, 0x24, 0xfd, 0x9d, 0x02, 0x06, 0x04, 0x03, 0x06, 0x02, 0x18, // a55aYR$.........
-	0x02, 0x03, 0x03, 0x02, 0xfe, 0xfc, 0x02, 0x02, 0x02, 0x02, 0x18, 0x03, 0x06, 0x03, 0x04, 0x05, // ................
-	0x03, 0xfb, 0xfe, 0x02, 0x06, 0x04, 0x03, 0x06, 0x02, 0x18, 0x02, 0x03, 0x03, 0x02, 0xfe, 0xfb, // ................
-	0x03, 0x02, 0x02, 0x03, 0x17, 0x03, 0x06, 0x03, 0x04, 0x06, 0x02, 0xfb, 0xfe, 0x00, 0x00, 0x00, // ................
-	0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1c, 0x00, 0x21, 0x00, 0x4a, // .............!.J
-	0x00, 0x00, 0x01, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x21, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, // ...4&'..#!".....
-	0x11, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x21, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x11, 0x05, // ......3!267>.5..
-	0x21, 0x11, 0x21, 0x11, 0x05, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, // !.!........#"..'
-	0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, // ..54>.7>.32.....
-	0x15, 0x03, 0x30, 0x06, 0x06, 0x06, 0x0e, 0x09, 0xfd, 0xf2, 0x09, 0x0f, 0x06, 0x05, 0x06, 0x06, // ..0.............
-	0x05, 0x06, 0x0f, 0x09, 0x02, 0x0e, 0x09, 0x0e, 0x06, 0x06, 0x06, 0xfd, 0xe3, 0x01, 0xda, 0xfe, // ................
-	0x26, 0x02, 0xe7, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, // &...$7%%RZa55aYR
-	0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, 0x59, 0x61, 0x35, 0x35, 0x61, // $%8%..%8%$RYa55a
-	0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, 0x02, 0xc7, 0x09, 0x0e, 0x06, 0x06, 0x06, 0x06, 0x06, // ZR%%7$..........
-	0x06, 0x0f, 0x09, 0xfd, 0xf3, 0x09, 0x0f, 0x06, 0x05, 0x06, 0x06, 0x05, 0x06, 0x0f, 0x09, 0x02, // ................
-	0x0e, 0x1a, 0xfe, 0x26, 0x01, 0xda, 0xed, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, // ...&...5aZR%%7$.
-	0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, 0x24, 0x25, 0x38, // .$7%%RZa55aYR$%8
-	0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, 0x59, 0x61, 0x35, 0x00, 0x00, 0x03, 0x00, 0x06, // %..%8%$RYa5.....
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x1a, 0x00, 0x43, 0x00, 0x5e, 0x00, 0x00, 0x01, 0x14, // .........C.^....
-	0x06, 0x0f, 0x01, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, // .....#"&'..5467>
-	0x01, 0x33, 0x32, 0x16, 0x1f, 0x01, 0x1e, 0x01, 0x15, 0x33, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, // .32......3......
-	0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, // #"..'..54>.7>.32
-	0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x23, 0x34, 0x26, 0x2f, 0x01, 0x2e, 0x01, 0x23, 0x22, 0x06, // ......#4&/...#".
-	0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x3f, 0x01, 0x3e, 0x01, // .........326?.>.
-	0x35, 0x03, 0x50, 0x1c, 0x1c, 0x2a, 0x31, 0x77, 0x46, 0x46, 0x77, 0x31, 0x31, 0x31, 0x31, 0x31, // 5.P..*1wFFw11111
-	0x31, 0x77, 0x46, 0x46, 0x77, 0x31, 0x2a, 0x1c, 0x1c, 0xaa, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, // 1wFFw1*....$7%%R
-	0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, 0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, // Za55aYR$%8%..%8%
-	0x24, 0x52, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, 0x6a, 0x21, // $RYa55aZR%%7$.j!
-	0x22, 0x32, 0x3a, 0x8e, 0x53, 0x53, 0x8e, 0x3a, 0x3b, 0x3a, 0x3a, 0x3b, 0x3a, 0x8e, 0x53, 0x53, // "2:.SS.:;::;:.SS
-	0x8e, 0x3a, 0x32, 0x22, 0x21, 0x01, 0xc0, 0x35, 0x5e, 0x29, 0x32, 0x31, 0x31, 0x31, 0x31, 0x31, // .:2"!..5^)211111
-	0x77, 0x46, 0x46, 0x77, 0x31, 0x31, 0x31, 0x31, 0x31, 0x32, 0x29, 0x5e, 0x35, 0x35, 0x61, 0x5a, // wFFw111112)^55aZ
-	0x52, 0x25, 0x25, 0x37, 0x24, 0x13, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, // R%%7$..$7%%RZa55
-	0x61, 0x59, 0x52, 0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, 0x59, 0x61, // aYR$%8%..%8%$RYa
-	0x35, 0x3f, 0x70, 0x30, 0x3c, 0x3b, 0x3a, 0x3a, 0x3b, 0x3a, 0x8e, 0x53, 0x53, 0x8e, 0x3a, 0x3b, // 5?p0<;::;:.SS.:;
-	0x3a, 0x3a, 0x3b, 0x3c, 0x30, 0x70, 0x3f, 0x00, 0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ::;<0p?.........
-	0x03, 0xba, 0x00, 0x03, 0x00, 0x2c, 0x00, 0x51, 0x00, 0x00, 0x01, 0x13, 0x21, 0x13, 0x01, 0x14, // .....,.Q....!...
-	0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, // .....#"..'..54>.
-	0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x07, 0x36, 0x26, 0x27, 0x01, // 7>.32.......6&'.
-	0x2e, 0x01, 0x27, 0x23, 0x26, 0x22, 0x07, 0x23, 0x0e, 0x01, 0x07, 0x15, 0x01, 0x23, 0x0e, 0x01, // ..'#&".#.....#..
-	0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x33, 0x21, 0x32, 0x36, 0x37, 0x23, 0x3e, 0x01, 0x37, 0x35, // ......3!267#>.75
-	0x02, 0x00, 0xf1, 0xfe, 0x1e, 0xf1, 0x01, 0xfa, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, 0x61, // .........$7%%RZa
-	0x35, 0x35, 0x61, 0x59, 0x52, 0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, // 55aYR$%8%..%8%$R
-	0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, 0x37, 0x24, 0x13, 0xb8, 0x01, 0x04, 0x04, // Ya55aZR%%7$.....
-	0xfe, 0xf3, 0x04, 0x0d, 0x08, 0x01, 0x0a, 0x13, 0x09, 0x01, 0x09, 0x0d, 0x05, 0xfe, 0xf4, 0x01, // ................
-	0x05, 0x03, 0x01, 0x02, 0x08, 0x07, 0x07, 0x13, 0x0b, 0x02, 0x19, 0x0b, 0x12, 0x08, 0x01, 0x07, // ................
-	0x09, 0x01, 0x02, 0xc0, 0xfe, 0x40, 0x01, 0xc0, 0xff, 0x00, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x25, // .....@....5aZR%%
-	0x37, 0x24, 0x13, 0x13, 0x24, 0x37, 0x25, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x52, // 7$..$7%%RZa55aYR
-	0x24, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x24, 0x52, 0x59, 0x61, 0x35, 0xd9, 0x0b, // $%8%..%8%$RYa5..
-	0x13, 0x09, 0x01, 0xe3, 0x09, 0x0d, 0x03, 0x05, 0x05, 0x03, 0x0d, 0x08, 0x01, 0xfe, 0x1d, 0x0a, // ................
-	0x14, 0x0a, 0x0a, 0x12, 0x07, 0x09, 0x09, 0x09, 0x08, 0x07, 0x12, 0x0b, 0x01, 0x00, 0x00, 0x00, // ................
-	0x00, 0x01, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, 0x00, 0x00, 0x13, 0x34, // ...............4
-	0x36, 0x33, 0x21, 0x11, 0x21, 0x11, 0x06, 0x43, 0x42, 0x03, 0x6f, 0xfc, 0x0c, 0x02, 0x7a, 0x43, // 63!.!..CB.o...zC
-	0x42, 0xfd, 0x82, 0x01, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, // B...............
-	0x02, 0xff, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x00, 0x01, 0x35, 0x23, 0x11, 0x33, 0x35, 0x23, 0x01, // .........5#.35#.
-	0x34, 0x36, 0x33, 0x21, 0x11, 0x21, 0x11, 0x01, 0xf1, 0x40, 0xbb, 0x7b, 0xfe, 0x15, 0x43, 0x42, // 463!.!...@.{..CB
-	0x03, 0x6f, 0xfc, 0x0c, 0x01, 0x74, 0xea, 0xfe, 0xdc, 0x3a, 0x01, 0x06, 0x43, 0x42, 0xfd, 0x82, // .o...t...:..CB..
-	0x01, 0xf9, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x06, // ................
-	0x00, 0x0e, 0x00, 0x15, 0x00, 0x00, 0x01, 0x23, 0x15, 0x33, 0x15, 0x33, 0x11, 0x01, 0x11, 0x34, // .......#.3.3...4
-	0x36, 0x33, 0x21, 0x11, 0x21, 0x01, 0x11, 0x33, 0x35, 0x23, 0x35, 0x23, 0x02, 0xa1, 0x68, 0x31, // 63!.!..35#5#..h1
-	0x37, 0xfd, 0x65, 0x43, 0x42, 0x03, 0x6f, 0xfc, 0x0c, 0x01, 0x76, 0xa7, 0x6e, 0x39, 0x02, 0x44, // 7.eCB.o...v.n9.D
-	0x34, 0xd6, 0x01, 0x0a, 0xfe, 0x3d, 0x01, 0xf9, 0x43, 0x42, 0xfd, 0x82, 0x01, 0xc3, 0xfe, 0xf6, // 4....=..CB......
-	0x35, 0xd5, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, // 5...............
-	0x00, 0x0e, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x34, 0x36, 0x33, 0x21, 0x05, 0x23, // ...-....!.463!.#
-	0x11, 0x33, 0x35, 0x23, 0x35, 0x37, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x17, 0x3e, 0x01, 0x33, // .35#57"......>.3
-	0x32, 0x16, 0x1f, 0x01, 0x0f, 0x02, 0x15, 0x33, 0x35, 0x23, 0x3f, 0x02, 0x34, 0x26, 0x27, 0x2e, // 2......35#?.4&'.
-	0x01, 0x23, 0x03, 0xfa, 0xfc, 0x0c, 0x43, 0x42, 0x03, 0x6f, 0xfd, 0x85, 0x38, 0xa4, 0x6c, 0xe3, // .#....CB.o..8.l.
-	0x10, 0x1b, 0x0b, 0x0a, 0x13, 0x0a, 0x2e, 0x0a, 0x17, 0x0c, 0x06, 0x0b, 0x04, 0x08, 0x09, 0x20, // ............... 
-	0x4b, 0xb3, 0x64, 0x2d, 0x25, 0x0a, 0x0c, 0x0c, 0x0d, 0x1d, 0x10, 0x02, 0xff, 0xfd, 0x82, 0x01, // K.d-%...........
-	0xf9, 0x43, 0x42, 0xc1, 0xfe, 0xfc, 0x34, 0xd0, 0x06, 0x08, 0x07, 0x07, 0x16, 0x0e, 0x1b, 0x12, // .CB...4.........
-	0x11, 0x04, 0x05, 0x15, 0x1c, 0x25, 0x4d, 0x2c, 0x34, 0x31, 0x2e, 0x27, 0x12, 0x1e, 0x0a, 0x0b, // .....%M,41.'....
-	0x0b, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, // ................
-	0x00, 0x0e, 0x00, 0x2a, 0x00, 0x36, 0x00, 0x42, 0x00, 0x00, 0x37, 0x11, 0x34, 0x36, 0x33, 0x21, // ...*.6.B..7.463!
-	0x11, 0x21, 0x01, 0x11, 0x33, 0x35, 0x23, 0x35, 0x23, 0x05, 0x27, 0x23, 0x11, 0x33, 0x32, 0x36, // .!..35#5#.'#.326
-	0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x3f, 0x01, 0x3e, 0x01, 0x35, 0x34, // 7>.54&'..'?.>.54
-	0x26, 0x27, 0x2e, 0x01, 0x27, 0x07, 0x33, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x23, // &'..'.3........#
-	0x35, 0x35, 0x33, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x23, 0x35, 0x06, 0x43, 0x42, // 553........#5.CB
-	0x03, 0x6f, 0xfc, 0x0c, 0x01, 0x2e, 0xa6, 0x6d, 0x39, 0x01, 0x5c, 0x32, 0x6e, 0x7c, 0x1d, 0x29, // .o.....m9..2n|.)
-	0x0c, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x15, 0x0d, 0x0a, 0x0b, 0x0a, 0x0b, 0x0a, 0x09, 0x05, 0x10, // ................
-	0x0a, 0x61, 0x26, 0x2d, 0x07, 0x08, 0x07, 0x07, 0x28, 0x2c, 0x1f, 0x27, 0x06, 0x06, 0x06, 0x07, // .a&-....(,.'....
-	0x26, 0x1f, 0x81, 0x01, 0xf9, 0x43, 0x42, 0xfd, 0x82, 0x01, 0xc3, 0xfe, 0xf6, 0x35, 0xd5, 0x06, // &....CB......5..
-	0x06, 0xfe, 0xf6, 0x0c, 0x0d, 0x0a, 0x19, 0x0e, 0x0d, 0x15, 0x08, 0x09, 0x0a, 0x03, 0x04, 0x07, // ................
-	0x08, 0x17, 0x0f, 0x0d, 0x17, 0x0b, 0x06, 0x08, 0x04, 0x95, 0x06, 0x02, 0x0c, 0x09, 0x0a, 0x0c, // ................
-	0x04, 0x06, 0x3d, 0x69, 0x06, 0x03, 0x0c, 0x09, 0x08, 0x0c, 0x03, 0x05, 0x3a, 0x00, 0x00, 0x00, // ..=i........:...
-	0x00, 0x03, 0x00, 0xe6, 0xff, 0xc6, 0x03, 0x1a, 0x03, 0xba, 0x00, 0x1c, 0x00, 0x23, 0x00, 0x2c, // .............#.,
-	0x00, 0x00, 0x17, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, // ....467>.3!2....
-	0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x13, // .......#!"&'..5.
-	0x35, 0x23, 0x15, 0x33, 0x35, 0x23, 0x37, 0x15, 0x33, 0x35, 0x33, 0x35, 0x23, 0x15, 0x33, 0xe6, // 5#.35#7.3535#.3.
-	0x07, 0x07, 0x07, 0x10, 0x0a, 0x01, 0xd6, 0x0a, 0x11, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x11, // ................
-	0x0a, 0xfe, 0x2b, 0x0a, 0x11, 0x07, 0x07, 0x07, 0xc0, 0x29, 0x74, 0x4b, 0x80, 0x29, 0x34, 0x92, // ..+......)tK.)4.
-	0x35, 0x0b, 0x03, 0x96, 0x09, 0x10, 0x07, 0x08, 0x07, 0x07, 0x08, 0x07, 0x10, 0x09, 0xfc, 0x6a, // 5..............j
-	0x0a, 0x11, 0x07, 0x06, 0x07, 0x07, 0x06, 0x07, 0x11, 0x0a, 0x01, 0x91, 0x9a, 0xc0, 0x26, 0x74, // ..............&t
-	0x9a, 0x9a, 0x26, 0x26, 0x00, 0x04, 0x00, 0xe6, 0xff, 0xc6, 0x03, 0x1a, 0x03, 0xba, 0x00, 0x1c, // ..&&............
-	0x00, 0x2e, 0x00, 0x37, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x23, 0x21, 0x22, 0x06, 0x07, // ...7.?.....#!"..
-	0x0e, 0x01, 0x15, 0x11, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x21, 0x32, 0x36, 0x37, 0x3e, 0x01, // .........3!267>.
-	0x35, 0x11, 0x34, 0x26, 0x27, 0x01, 0x27, 0x23, 0x15, 0x23, 0x35, 0x33, 0x32, 0x16, 0x17, 0x1e, // 5.4&'.'#.#532...
-	0x01, 0x15, 0x14, 0x06, 0x07, 0x17, 0x23, 0x37, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x15, // ......#7#.#5#53.
-	0x07, 0x17, 0x0f, 0x01, 0x23, 0x35, 0x33, 0x17, 0x03, 0x0d, 0x07, 0x11, 0x0a, 0xfe, 0x2a, 0x0a, // ....#53.......*.
-	0x10, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x11, 0x0a, 0x01, 0xd5, 0x0a, 0x11, 0x07, 0x07, 0x06, // ................
-	0x06, 0x07, 0xfe, 0xc9, 0x29, 0x1c, 0x29, 0x45, 0x15, 0x1f, 0x09, 0x09, 0x09, 0x11, 0x12, 0x2e, // ....).)E........
-	0x31, 0xc2, 0x33, 0x29, 0x35, 0x91, 0xcd, 0x08, 0x08, 0x1c, 0x1e, 0x1e, 0x1c, 0x03, 0xab, 0x08, // 1.3)5...........
-	0x07, 0x07, 0x08, 0x07, 0x10, 0x09, 0xfc, 0x6a, 0x0a, 0x11, 0x07, 0x06, 0x07, 0x07, 0x06, 0x07, // .......j........
-	0x11, 0x0a, 0x03, 0x96, 0x09, 0x10, 0x07, 0xfd, 0xb6, 0x3d, 0x3d, 0xc0, 0x08, 0x08, 0x08, 0x18, // .........==.....
-	0x10, 0x17, 0x1e, 0x08, 0x43, 0x98, 0x9a, 0x9a, 0x26, 0x26, 0x04, 0x14, 0x19, 0x06, 0x39, 0x06, // ....C...&&....9.
-	0x00, 0x06, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, 0x00, 0x23, 0x00, 0x2f, // .............#./
-	0x00, 0x3b, 0x00, 0x49, 0x00, 0x5b, 0x00, 0x00, 0x13, 0x21, 0x32, 0x16, 0x15, 0x11, 0x21, 0x11, // .;.I.[...!2...!.
-	0x05, 0x27, 0x23, 0x11, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, // .'#.3267>.54&'..
-	0x27, 0x3f, 0x01, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x07, 0x33, 0x17, 0x1e, // '?.>.54&'..'.3..
-	0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x23, 0x35, 0x35, 0x33, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, // ......#553......
-	0x0f, 0x01, 0x23, 0x35, 0x07, 0x14, 0x06, 0x0f, 0x01, 0x23, 0x35, 0x33, 0x32, 0x16, 0x17, 0x1e, // ..#5.....#532...
-	0x01, 0x15, 0x27, 0x23, 0x11, 0x33, 0x35, 0x33, 0x17, 0x33, 0x27, 0x3e, 0x01, 0x35, 0x34, 0x26, // ..'#.353.3'>.54&
-	0x27, 0x2e, 0x01, 0x23, 0x06, 0x03, 0x6f, 0x42, 0x43, 0xfc, 0x0c, 0x02, 0xb9, 0x32, 0x6d, 0x7b, // '..#..oBC....2m{
-	0x1e, 0x29, 0x0b, 0x0a, 0x0a, 0x08, 0x08, 0x08, 0x15, 0x0d, 0x0b, 0x0a, 0x0b, 0x0a, 0x09, 0x0a, // .)..............
-	0x05, 0x10, 0x0a, 0x61, 0x26, 0x2d, 0x08, 0x07, 0x07, 0x07, 0x28, 0x2c, 0x1f, 0x28, 0x05, 0x06, // ...a&-....(,.(..
-	0x06, 0x06, 0x27, 0x1f, 0xa0, 0x04, 0x05, 0x26, 0x2a, 0x2a, 0x0e, 0x13, 0x05, 0x05, 0x04, 0x32, // ..'....&**.....2
-	0x60, 0x39, 0x27, 0x36, 0x47, 0x40, 0x18, 0x18, 0x0d, 0x0c, 0x0d, 0x2a, 0x1d, 0x02, 0xff, 0x42, // `9'6G@.....*...B
-	0x43, 0xfe, 0x07, 0x02, 0x7e, 0xc1, 0x06, 0xfe, 0xf6, 0x0c, 0x0d, 0x0a, 0x19, 0x0e, 0x0d, 0x15, // C...~...........
-	0x08, 0x09, 0x0a, 0x03, 0x04, 0x07, 0x08, 0x17, 0x0f, 0x0d, 0x17, 0x0b, 0x06, 0x08, 0x04, 0x95, // ................
-	0x06, 0x02, 0x0c, 0x09, 0x0a, 0x0c, 0x04, 0x06, 0x3d, 0x69, 0x06, 0x03, 0x0c, 0x09, 0x08, 0x0c, // ........=i......
-	0x03, 0x05, 0x3a, 0x27, 0x0b, 0x10, 0x05, 0x0a, 0x4f, 0x04, 0x04, 0x04, 0x0f, 0x0a, 0x59, 0xfe, // ..:'....O.....Y.
-	0xf6, 0x53, 0x53, 0x5e, 0x09, 0x2a, 0x20, 0x17, 0x21, 0x0a, 0x0b, 0x0c, 0x00, 0x04, 0x00, 0x06, // .SS^.* .!.......
-	0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x0b, 0x00, 0x1d, 0x00, 0x3e, 0x00, 0x46, 0x00, 0x00, // ...........>.F..
-	0x01, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x23, 0x35, 0x33, 0x27, 0x23, 0x11, 0x33, // .........#53'#.3
-	0x35, 0x33, 0x17, 0x33, 0x27, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x25, 0x22, // 53.3'>.54&'..#%"
-	0x06, 0x07, 0x0e, 0x01, 0x07, 0x17, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x0f, // ......>.32......
-	0x02, 0x15, 0x33, 0x35, 0x23, 0x3f, 0x02, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x25, 0x21, 0x32, // ..35#?.4&'..#%!2
-	0x16, 0x15, 0x11, 0x21, 0x11, 0x01, 0x78, 0x2a, 0x05, 0x05, 0x05, 0x05, 0x2a, 0x2a, 0x2a, 0x02, // ...!..x*....***.
-	0x64, 0x3c, 0x28, 0x3a, 0x49, 0x42, 0x19, 0x19, 0x0e, 0x0e, 0x0c, 0x2c, 0x1f, 0x01, 0x03, 0x12, // d<(:IB.....,....
-	0x1c, 0x0b, 0x0b, 0x14, 0x0a, 0x30, 0x0a, 0x18, 0x0d, 0x07, 0x0b, 0x04, 0x04, 0x05, 0x0b, 0x21, // .....0.........!
-	0x4e, 0xbb, 0x69, 0x30, 0x28, 0x09, 0x0d, 0x0d, 0x0d, 0x1d, 0x11, 0xfd, 0x8d, 0x03, 0x6f, 0x42, // N.i0(.........oB
-	0x43, 0xfc, 0x0c, 0x02, 0x0c, 0x08, 0x04, 0x0e, 0x0a, 0x0b, 0x10, 0x05, 0x09, 0x4d, 0x32, 0xfe, // C............M2.
-	0xfc, 0x52, 0x52, 0x5d, 0x09, 0x29, 0x1f, 0x17, 0x20, 0x0a, 0x0b, 0x0a, 0x06, 0x08, 0x07, 0x07, // .RR].).. .......
-	0x16, 0x0e, 0x1b, 0x12, 0x12, 0x05, 0x05, 0x04, 0x0a, 0x07, 0x1c, 0x25, 0x4d, 0x2c, 0x34, 0x31, // ...........%M,41
-	0x2e, 0x27, 0x12, 0x1e, 0x0a, 0x0b, 0x0b, 0xbb, 0x42, 0x43, 0xfe, 0x07, 0x02, 0x7e, 0x00, 0x00, // .'......BC...~..
-	0x00, 0x04, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, 0x00, 0x15, 0x00, 0x27, // ...............'
-	0x00, 0x2e, 0x00, 0x00, 0x13, 0x21, 0x32, 0x16, 0x15, 0x11, 0x21, 0x11, 0x01, 0x14, 0x06, 0x0f, // .....!2...!.....
-	0x01, 0x23, 0x35, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x27, 0x23, 0x11, 0x33, 0x35, 0x33, // .#532.....'#.353
-	0x17, 0x33, 0x27, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x33, 0x23, 0x15, 0x33, // .3'>.54&'..#3#.3
-	0x15, 0x33, 0x11, 0x06, 0x03, 0x6f, 0x42, 0x43, 0xfc, 0x0c, 0x01, 0xd3, 0x04, 0x05, 0x26, 0x2a, // .3...oBC......&*
-	0x2a, 0x0d, 0x14, 0x05, 0x05, 0x04, 0x32, 0x60, 0x39, 0x27, 0x36, 0x47, 0x40, 0x18, 0x18, 0x0d, // *.....2`9'6G@...
-	0x0c, 0x0d, 0x2a, 0x1d, 0xfa, 0x66, 0x2f, 0x37, 0x02, 0xff, 0x42, 0x43, 0xfe, 0x07, 0x02, 0x7e, // ..*..f/7..BC...~
-	0xfe, 0xec, 0x0b, 0x10, 0x05, 0x0a, 0x4f, 0x04, 0x04, 0x04, 0x0f, 0x0a, 0x59, 0xfe, 0xf6, 0x53, // ......O.....Y..S
-	0x53, 0x5e, 0x09, 0x2a, 0x20, 0x17, 0x21, 0x0a, 0x0b, 0x0c, 0x34, 0xd6, 0x01, 0x0a, 0x00, 0x00, // S^.* .!...4.....
-	0x00, 0x03, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, 0x00, 0x17, 0x00, 0x29, // ...............)
-	0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21, 0x32, 0x16, 0x15, 0x05, 0x33, 0x32, 0x16, 0x17, 0x1e, // ....!.!2...32...
-	0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x35, 0x37, 0x23, 0x11, 0x33, 0x35, 0x33, // .......+.57#.353
-	0x17, 0x33, 0x27, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x03, 0xfa, 0xfc, 0x0c, // .3'>.54&'..#....
-	0x03, 0x6f, 0x42, 0x43, 0xfd, 0xdb, 0x2e, 0x0e, 0x15, 0x06, 0x05, 0x06, 0x06, 0x05, 0x05, 0x16, // .oBC............
-	0x10, 0x2c, 0x2a, 0x68, 0x3e, 0x2a, 0x3c, 0x4b, 0x45, 0x1b, 0x1a, 0x0e, 0x0e, 0x0e, 0x2d, 0x20, // .,*h>*<KE.....- 
-	0x02, 0x7a, 0xfe, 0x07, 0x02, 0x7e, 0x42, 0x43, 0x55, 0x05, 0x04, 0x04, 0x10, 0x0c, 0x0c, 0x11, // .z...~BCU.......
-	0x06, 0x05, 0x05, 0x56, 0x39, 0xfe, 0xdc, 0x5d, 0x5d, 0x67, 0x0b, 0x2d, 0x23, 0x1a, 0x25, 0x0b, // ...V9..]]g.-#.%.
-	0x0c, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, // ................
-	0x00, 0x00, 0x01, 0x11, 0x21, 0x11, 0x21, 0x32, 0x16, 0x15, 0x03, 0xfa, 0xfc, 0x0c, 0x03, 0x6f, // ....!.!2.......o
-	0x42, 0x43, 0x02, 0x7a, 0xfe, 0x07, 0x02, 0x7e, 0x42, 0x43, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, // BC.z...~BC......
-	0x00, 0xa6, 0x03, 0xfa, 0x02, 0xda, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x21, 0x32, 0x16, 0x17, 0x1e, // ...........!2...
-	0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, // ........#!"&'..5
-	0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x35, 0x03, 0x96, 0x09, 0x10, 0x07, 0x08, 0x07, 0x07, // .467>.35........
-	0x08, 0x07, 0x10, 0x09, 0xfc, 0x6a, 0x0a, 0x11, 0x07, 0x06, 0x07, 0x07, 0x06, 0x07, 0x11, 0x0a, // .....j..........
-	0x02, 0xda, 0x07, 0x07, 0x07, 0x10, 0x0a, 0xfe, 0x2a, 0x0a, 0x11, 0x07, 0x07, 0x06, 0x06, 0x07, // ........*.......
-	0x07, 0x11, 0x0a, 0x01, 0xd5, 0x0a, 0x11, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x06, // ................
-	0x00, 0xa6, 0x03, 0xfa, 0x02, 0xda, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x29, 0x00, 0x31, 0x00, 0x43, // .........%.).1.C
-	0x00, 0x4c, 0x00, 0x7c, 0x00, 0x85, 0x00, 0x00, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, // .L.|...........#
-	0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, // !"&'..5.467>.3!2
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x05, 0x23, 0x07, 0x33, 0x37, 0x33, 0x17, 0x33, 0x27, 0x07, 0x17, // ......#.373.3'..
-	0x23, 0x37, 0x37, 0x1f, 0x01, 0x0f, 0x01, 0x23, 0x35, 0x33, 0x17, 0x34, 0x26, 0x27, 0x2e, 0x01, // #77....#53.4&'..
-	0x2b, 0x01, 0x15, 0x33, 0x35, 0x33, 0x17, 0x33, 0x27, 0x3e, 0x01, 0x35, 0x37, 0x15, 0x33, 0x35, // +..353.3'>.57.35
-	0x33, 0x35, 0x23, 0x15, 0x33, 0x25, 0x27, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, // 35#.3%'"........
-	0x1e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x01, 0x0f, 0x01, 0x22, 0x26, 0x27, 0x07, 0x1e, 0x01, 0x33, // ........."&'...3
-	0x32, 0x36, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x2f, 0x02, 0x3f, 0x01, 0x32, // 267>.54&'../.?.2
-	0x16, 0x17, 0x37, 0x27, 0x17, 0x35, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x03, 0xfa, 0x07, // ..7'.5#.3.353...
-	0x08, 0x07, 0x10, 0x09, 0xfc, 0x6a, 0x0a, 0x11, 0x07, 0x06, 0x07, 0x07, 0x06, 0x07, 0x11, 0x0a, // .....j..........
-	0x03, 0x96, 0x09, 0x10, 0x07, 0x08, 0x07, 0xfd, 0xff, 0x1c, 0x3a, 0x20, 0x0c, 0x37, 0x0c, 0x1f, // ..........: .7..
-	0x38, 0x0e, 0x10, 0x21, 0x11, 0x88, 0x14, 0x06, 0x06, 0x14, 0x15, 0x15, 0x37, 0x06, 0x06, 0x07, // 8..!........7...
-	0x16, 0x0f, 0x31, 0x1d, 0x14, 0x1d, 0x24, 0x21, 0x0c, 0x0c, 0x39, 0x1d, 0x26, 0x69, 0x26, 0xfe, // ..1...$!..9.&i&.
-	0x2d, 0x1a, 0x0a, 0x11, 0x06, 0x06, 0x07, 0x06, 0x05, 0x05, 0x10, 0x0b, 0x07, 0x0a, 0x03, 0x04, // -...............
-	0x04, 0x0d, 0x09, 0x13, 0x0a, 0x11, 0x0c, 0x1c, 0x0f, 0x0a, 0x11, 0x07, 0x07, 0x07, 0x05, 0x06, // ................
-	0x05, 0x0f, 0x09, 0x18, 0x05, 0x04, 0x0c, 0x09, 0x12, 0x08, 0x10, 0x18, 0x90, 0x69, 0x26, 0x1d, // .............i&.
-	0x26, 0x02, 0xab, 0xfe, 0x2a, 0x0a, 0x11, 0x07, 0x07, 0x06, 0x06, 0x07, 0x07, 0x11, 0x0a, 0x01, // &...*...........
-	0xd5, 0x0a, 0x11, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x10, 0x0a, 0xa7, 0x89, 0x1d, 0x1d, 0x89, // ................
-	0x29, 0x28, 0x28, 0x0e, 0x05, 0x0e, 0x11, 0x05, 0x29, 0x13, 0x0c, 0x11, 0x05, 0x06, 0x06, 0x89, // )((.....).......
-	0x2b, 0x2b, 0x30, 0x05, 0x16, 0x10, 0x13, 0x6e, 0x6e, 0x1b, 0x1b, 0x1a, 0x04, 0x06, 0x05, 0x05, // ++0....nn.......
-	0x10, 0x0a, 0x09, 0x0e, 0x05, 0x05, 0x07, 0x02, 0x02, 0x04, 0x02, 0x0a, 0x09, 0x03, 0x09, 0x09, // ................
-	0x17, 0x0b, 0x0c, 0x06, 0x05, 0x05, 0x0f, 0x09, 0x0a, 0x0e, 0x05, 0x04, 0x08, 0x03, 0x08, 0x0a, // ................
-	0x0a, 0x03, 0x07, 0x08, 0x18, 0x0e, 0x1a, 0x1b, 0x1b, 0x6e, 0x6e, 0x00, 0x00, 0x07, 0x00, 0x06, // .........nn.....
-	0x00, 0xa6, 0x03, 0xfa, 0x02, 0xda, 0x00, 0x1c, 0x00, 0x25, 0x00, 0x32, 0x00, 0x39, 0x00, 0x46, // .........%.2.9.F
-	0x00, 0x6d, 0x00, 0x9b, 0x00, 0x00, 0x13, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, // .m.....!2.......
-	0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, // ....#!"&'..5.467
-	0x3e, 0x01, 0x33, 0x05, 0x23, 0x15, 0x33, 0x15, 0x33, 0x35, 0x33, 0x35, 0x05, 0x35, 0x23, 0x15, // >.3.#.3.3535.5#.
-	0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x17, 0x35, 0x23, 0x15, 0x33, 0x35, 0x23, // 35#535#53.5#.35#
-	0x37, 0x35, 0x23, 0x15, 0x33, 0x35, 0x23, 0x35, 0x33, 0x35, 0x23, 0x35, 0x33, 0x37, 0x32, 0x16, // 75#.35#535#5372.
-	0x17, 0x37, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, // .7..#"..........
-	0x33, 0x32, 0x36, 0x37, 0x27, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, // 3267'..#"&'..546
-	0x37, 0x3e, 0x01, 0x33, 0x05, 0x37, 0x2f, 0x01, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, // 7>.3.7/.".......
-	0x17, 0x1e, 0x01, 0x1f, 0x02, 0x0f, 0x01, 0x22, 0x26, 0x27, 0x07, 0x1e, 0x01, 0x33, 0x32, 0x36, // ......."&'...326
-	0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x2f, 0x02, 0x3f, 0x01, 0x1e, 0x01, 0x17, // 7>.54&'../.?....
-	0x35, 0x03, 0x96, 0x09, 0x10, 0x07, 0x08, 0x07, 0x07, 0x08, 0x07, 0x10, 0x09, 0xfc, 0x6a, 0x0a, // 5.............j.
-	0x11, 0x07, 0x06, 0x07, 0x07, 0x06, 0x07, 0x11, 0x0a, 0x03, 0x20, 0x67, 0x25, 0x1e, 0x24, 0xfe, // .......... g%.$.
-	0x1c, 0x5d, 0x5f, 0x42, 0x3a, 0x3a, 0x40, 0x3a, 0x1d, 0x53, 0x36, 0xaa, 0x5d, 0x5f, 0x42, 0x3a, // .]_B::@:.S6.]_B:
-	0x3a, 0x40, 0x5a, 0x0a, 0x11, 0x07, 0x13, 0x0b, 0x1b, 0x10, 0x0f, 0x18, 0x09, 0x0a, 0x0a, 0x0a, // :@Z.............
-	0x0a, 0x09, 0x18, 0x0f, 0x0f, 0x1b, 0x0b, 0x13, 0x06, 0x12, 0x0b, 0x08, 0x0d, 0x06, 0x06, 0x05, // ................
-	0x06, 0x06, 0x06, 0x0e, 0x08, 0xfe, 0x3b, 0x0f, 0x17, 0x1a, 0x0a, 0x11, 0x07, 0x06, 0x07, 0x06, // ......;.........
-	0x05, 0x05, 0x11, 0x0b, 0x14, 0x05, 0x05, 0x0d, 0x09, 0x13, 0x0b, 0x11, 0x0c, 0x1c, 0x10, 0x0b, // ................
-	0x11, 0x06, 0x07, 0x06, 0x05, 0x04, 0x06, 0x0e, 0x0a, 0x17, 0x06, 0x05, 0x0b, 0x09, 0x12, 0x08, // ................
-	0x02, 0xda, 0x07, 0x07, 0x07, 0x10, 0x0a, 0xfe, 0x2a, 0x0a, 0x11, 0x07, 0x07, 0x06, 0x06, 0x07, // ........*.......
-	0x07, 0x11, 0x0a, 0x01, 0xd5, 0x0a, 0x11, 0x07, 0x07, 0x07, 0xd6, 0x1b, 0x6e, 0x6e, 0x1b, 0x1b, // ............nn..
-	0x1b, 0x89, 0x1b, 0x1c, 0x1b, 0x1c, 0x53, 0x6e, 0x89, 0x1b, 0x53, 0x1b, 0x89, 0x1b, 0x1c, 0x1b, // ......Sn..S.....
-	0x1c, 0x01, 0x09, 0x0a, 0x16, 0x0d, 0x0d, 0x0a, 0x0a, 0x0b, 0x1a, 0x0f, 0x0f, 0x1a, 0x0a, 0x09, // ................
-	0x0a, 0x0d, 0x0d, 0x14, 0x08, 0x09, 0x05, 0x05, 0x06, 0x10, 0x0a, 0x09, 0x0f, 0x05, 0x07, 0x06, // ................
-	0x0d, 0x18, 0x0e, 0x03, 0x05, 0x05, 0x05, 0x10, 0x0a, 0x09, 0x0e, 0x05, 0x05, 0x07, 0x02, 0x08, // ................
-	0x0a, 0x09, 0x04, 0x0a, 0x09, 0x17, 0x0b, 0x0c, 0x06, 0x05, 0x05, 0x0f, 0x09, 0x0a, 0x0e, 0x05, // ................
-	0x04, 0x08, 0x03, 0x08, 0x0a, 0x0a, 0x03, 0x01, 0x07, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x3c, 0x00, 0x00, 0x01, 0x11, 0x14, 0x06, 0x07, 0x0e, // .......<........
-	0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, // .+.......#!"&'..
-	0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, // =.#"&'..5.467>.;
-	0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, // .5467>.3!2......
-	0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x03, 0xfa, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x09, // 32..............
-	0x08, 0x09, 0x13, 0x0b, 0xfe, 0xae, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xe0, 0x0c, 0x15, 0x08, 0x08, // ................
-	0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0xe0, 0x08, 0x08, 0x08, 0x15, 0x0b, 0x01, 0x52, 0x0b, 0x13, // .............R..
-	0x09, 0x08, 0x09, 0xdf, 0x0c, 0x14, 0x09, 0x08, 0x09, 0x02, 0x69, 0xfe, 0xae, 0x0b, 0x13, 0x09, // ..........i.....
-	0x08, 0x09, 0xe0, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0xe0, 0x09, 0x08, // ................
-	0x09, 0x13, 0x0b, 0x01, 0x52, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xdf, 0x0c, 0x14, 0x09, 0x08, 0x09, // ....R...........
-	0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x08, 0x08, 0x08, 0x15, 0x0b, 0x00, 0x00, 0x05, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x0d, 0x00, 0x19, 0x00, 0x23, 0x00, 0x60, 0x00, 0x6c, // ...........#.`.l
-	0x00, 0x00, 0x25, 0x15, 0x17, 0x37, 0x35, 0x2f, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, // ..%..75/.#".....
-	0x03, 0x27, 0x2e, 0x01, 0x2b, 0x01, 0x07, 0x17, 0x33, 0x3f, 0x01, 0x35, 0x37, 0x17, 0x33, 0x3f, // .'..+...3?.57.3?
-	0x01, 0x35, 0x27, 0x07, 0x15, 0x17, 0x05, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, // .5'.............
-	0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, // +.......#!"&'..=
-	0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, // .#"&'..5.467>.;.
-	0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x33, // 5467>.3!2......3
-	0x32, 0x16, 0x17, 0x07, 0x15, 0x1f, 0x01, 0x33, 0x37, 0x27, 0x23, 0x22, 0x06, 0x0f, 0x01, 0x01, // 2......37'#"....
-	0x90, 0x70, 0x70, 0x04, 0x0a, 0xc4, 0x03, 0x05, 0x02, 0x02, 0x02, 0xa9, 0x04, 0x02, 0x05, 0x03, // .pp.............
-	0x0e, 0x70, 0x70, 0x0e, 0x0a, 0x04, 0xad, 0x0a, 0xc4, 0x0a, 0x04, 0x70, 0x70, 0x04, 0x02, 0x55, // .pp........pp..U
-	0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x09, 0x08, 0x09, 0x13, 0x0b, 0xfe, 0xae, 0x0b, // ................
-	0x15, 0x08, 0x08, 0x08, 0xe0, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0xe0, // ................
-	0x08, 0x08, 0x08, 0x15, 0x0b, 0x01, 0x52, 0x0b, 0x13, 0x09, 0x08, 0x09, 0xdf, 0x0c, 0x14, 0x09, // ......R.........
-	0xd0, 0x04, 0x0a, 0x0e, 0x70, 0x70, 0x0e, 0x03, 0x05, 0x02, 0x04, 0x99, 0x0e, 0x70, 0x70, 0x0e, // ....pp.......pp.
-	0x0a, 0x04, 0x02, 0x02, 0x02, 0x05, 0x03, 0x01, 0x89, 0x0a, 0x02, 0x02, 0x70, 0x70, 0x04, 0x0a, // ............pp..
-	0xc4, 0xbb, 0x04, 0x04, 0x0a, 0x0e, 0x70, 0x70, 0x0e, 0x0a, 0x4c, 0x08, 0x15, 0x0b, 0xfe, 0xae, // ......pp..L.....
-	0x0b, 0x13, 0x09, 0x08, 0x09, 0xe0, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, // ................
-	0xe0, 0x09, 0x08, 0x09, 0x13, 0x0b, 0x01, 0x52, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xdf, 0x0c, 0x14, // .......R........
-	0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x08, 0x08, 0x6f, 0xc4, 0x0a, 0x04, 0x70, // ...........o...p
-	0x70, 0x02, 0x02, 0x0a, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x09, // p...............
-	0x00, 0x46, 0x00, 0x00, 0x01, 0x37, 0x35, 0x27, 0x07, 0x15, 0x1f, 0x01, 0x33, 0x37, 0x25, 0x3e, // .F...75'....37%>
-	0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, // .3!2......32....
-	0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, // .......+.......#
-	0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, // !"&'..=.#"&'..5.
-	0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, 0x02, 0x6c, 0x04, 0x70, 0x70, // 467>.;.5467.l.pp
-	0x04, 0x0a, 0xc4, 0x0a, 0xfe, 0xc3, 0x08, 0x15, 0x0b, 0x01, 0x52, 0x0b, 0x13, 0x09, 0x08, 0x09, // ..........R.....
-	0xdf, 0x0c, 0x14, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x09, 0x08, 0x09, 0x13, // ................
-	0x0b, 0xfe, 0xae, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xe0, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, // ................
-	0x08, 0x15, 0x0c, 0xe0, 0x08, 0x08, 0x02, 0xdd, 0x0a, 0x0e, 0x70, 0x70, 0x0e, 0x0a, 0x04, 0x04, // ..........pp....
-	0xcc, 0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x08, 0x08, 0x08, 0x15, 0x0b, 0xfe, 0xae, // ................
-	0x0b, 0x13, 0x09, 0x08, 0x09, 0xe0, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, // ................
-	0xe0, 0x09, 0x08, 0x09, 0x13, 0x0b, 0x01, 0x52, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xdf, 0x0c, 0x14, // .......R........
-	0x09, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x09, // ................
-	0x00, 0x46, 0x00, 0x00, 0x01, 0x15, 0x1f, 0x01, 0x33, 0x37, 0x27, 0x23, 0x0f, 0x01, 0x37, 0x11, // .F......37'#..7.
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, // .....+.......#!"
-	0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, // &'..=.#"&'..5.46
-	0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, // 7>.;.5467>.3!2..
-	0x1e, 0x01, 0x1d, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x03, 0x19, 0x04, 0x0a, 0x0e, // ....32..........
-	0x70, 0x70, 0x0e, 0x0a, 0x04, 0xe1, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x08, 0x08, 0x08, 0x14, // pp..............
-	0x0c, 0xfe, 0xae, 0x0b, 0x13, 0x09, 0x08, 0x09, 0xe0, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, // ................
-	0x08, 0x15, 0x0c, 0xe0, 0x09, 0x08, 0x09, 0x13, 0x0b, 0x01, 0x52, 0x0b, 0x15, 0x08, 0x08, 0x08, // ..........R.....
-	0xdf, 0x0c, 0x14, 0x09, 0x08, 0x09, 0x02, 0x22, 0xc4, 0x0a, 0x04, 0x70, 0x70, 0x04, 0x0a, 0x47, // ......."...pp..G
-	0xfe, 0xae, 0x0b, 0x13, 0x09, 0x08, 0x09, 0xdf, 0x0c, 0x14, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, // ................
-	0x13, 0x0c, 0xe0, 0x09, 0x08, 0x09, 0x13, 0x0b, 0x01, 0x52, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xe0, // .........R......
-	0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0xe0, 0x08, 0x08, 0x08, 0x15, 0x0b, // ................
-	0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x0d, 0x00, 0x4a, 0x00, 0x00, // .............J..
-	0x25, 0x17, 0x37, 0x35, 0x2f, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x1d, 0x01, 0x01, 0x32, // %.75/.#".......2
-	0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, // ...........+....
-	0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, // ...#!"&'..=.#"&'
-	0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, // ..5.467>.;.5467>
-	0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x1d, 0x01, 0x33, 0x01, 0x90, 0x70, 0x70, 0x04, // .3!2......3..pp.
-	0x0a, 0xc4, 0x03, 0x05, 0x02, 0x02, 0x02, 0x02, 0x31, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, // ........1.......
-	0x08, 0x15, 0x0c, 0xe0, 0x08, 0x08, 0x08, 0x14, 0x0c, 0xfe, 0xae, 0x0b, 0x13, 0x09, 0x08, 0x09, // ................
-	0xdf, 0x0c, 0x14, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x09, 0x08, 0x09, 0x13, // ................
-	0x0b, 0x01, 0x52, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xe0, 0x8b, 0x70, 0x70, 0x0e, 0x0a, 0x04, 0x02, // ..R.......pp....
-	0x02, 0x02, 0x05, 0x03, 0x0e, 0x02, 0x16, 0x09, 0x08, 0x09, 0x13, 0x0b, 0xfe, 0xae, 0x0b, 0x15, // ................
-	0x08, 0x08, 0x08, 0xdf, 0x0c, 0x14, 0x09, 0x08, 0x09, 0x09, 0x08, 0x09, 0x13, 0x0c, 0xe0, 0x08, // ................
-	0x08, 0x08, 0x15, 0x0b, 0x01, 0x52, 0x0b, 0x13, 0x09, 0x08, 0x09, 0xe0, 0x0c, 0x15, 0x08, 0x08, // .....R..........
-	0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0xe0, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ................
-	0x03, 0xba, 0x00, 0x3c, 0x00, 0x46, 0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, // ...<.F...2......
-	0x14, 0x06, 0x07, 0x0e, 0x01, 0x2b, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, // .....+.......#!"
-	0x26, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, // &'..=.#"&'..5.46
-	0x37, 0x3e, 0x01, 0x3b, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, // 7>.;.5467>.3!2..
-	0x1e, 0x01, 0x1d, 0x01, 0x33, 0x05, 0x27, 0x23, 0x07, 0x17, 0x33, 0x3f, 0x01, 0x35, 0x27, 0x03, // ....3.'#..3?.5'.
-	0xc1, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0xe0, 0x09, 0x08, 0x09, 0x13, // ................
-	0x0b, 0xfe, 0xae, 0x0b, 0x15, 0x08, 0x08, 0x08, 0xe0, 0x0c, 0x13, 0x09, 0x08, 0x09, 0x09, 0x08, // ................
-	0x09, 0x14, 0x0c, 0xdf, 0x08, 0x08, 0x08, 0x15, 0x0b, 0x01, 0x52, 0x0b, 0x13, 0x09, 0x08, 0x09, // ..........R.....
-	0xe0, 0xfd, 0x22, 0x0a, 0x0e, 0x70, 0x70, 0x0e, 0x0a, 0x04, 0x04, 0x02, 0xa1, 0x08, 0x08, 0x08, // .."..pp.........
-	0x15, 0x0b, 0xfe, 0xae, 0x0b, 0x13, 0x09, 0x08, 0x09, 0xe0, 0x0c, 0x13, 0x09, 0x08, 0x09, 0x09, // ................
-	0x08, 0x09, 0x14, 0x0c, 0xdf, 0x09, 0x08, 0x09, 0x13, 0x0b, 0x01, 0x52, 0x0b, 0x15, 0x08, 0x08, // ...........R....
-	0x08, 0xe0, 0x0c, 0x15, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x15, 0x0c, 0xe0, 0x75, 0x04, 0x70, // .............u.p
-	0x70, 0x04, 0x0a, 0xc4, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x09, 0x03, 0xfa, // p...............
-	0x03, 0x77, 0x00, 0x1c, 0x00, 0x39, 0x00, 0x00, 0x25, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, // .w...9..%..#!"&'
-	0x2e, 0x01, 0x35, 0x11, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x21, 0x32, 0x36, 0x37, 0x3e, 0x01, // ..5......3!267>.
-	0x35, 0x11, 0x14, 0x06, 0x07, 0x13, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, // 5...........#!"&
-	0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, // '..5.467>.3!2...
-	0x01, 0x15, 0x03, 0xea, 0x08, 0x13, 0x0b, 0xfc, 0x78, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x08, 0x07, // ........x.......
-	0x08, 0x13, 0x0c, 0x03, 0x88, 0x0b, 0x13, 0x08, 0x08, 0x08, 0x08, 0x08, 0x10, 0x08, 0x08, 0x08, // ................
-	0x13, 0x0b, 0xfc, 0x78, 0x0c, 0x13, 0x08, 0x07, 0x08, 0x08, 0x07, 0x08, 0x13, 0x0c, 0x03, 0x88, // ...x............
-	0x0b, 0x13, 0x08, 0x08, 0x08, 0x18, 0x08, 0x07, 0x07, 0x08, 0x08, 0x13, 0x0b, 0x01, 0x52, 0x07, // ..............R.
-	0x10, 0x07, 0x08, 0x07, 0x07, 0x08, 0x07, 0x10, 0x07, 0xfe, 0xae, 0x0b, 0x13, 0x08, 0x03, 0x2a, // ...............*
-	0xfe, 0xa5, 0x0b, 0x13, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x13, 0x0b, 0x01, 0x5a, 0x0b, 0x13, // .............Z..
-	0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x13, 0x0a, 0x00, 0x02, 0x00, 0x07, 0x00, 0x56, 0x03, 0xf9, // .............V..
-	0x03, 0x2a, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x01, 0x13, 0x21, 0x13, 0x21, 0x13, 0x16, 0x06, // .*... ....!.!...
-	0x07, 0x0e, 0x01, 0x07, 0x21, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x13, 0x06, 0x16, 0x17, 0x1e, // ....!..'..7.....
-	0x01, 0x17, 0x21, 0x3f, 0x01, 0x3e, 0x01, 0x27, 0x13, 0x03, 0x93, 0x37, 0xfc, 0x6f, 0x36, 0x03, // ..!?.>.'...7.o6.
-	0x24, 0x66, 0x02, 0x05, 0x07, 0x07, 0x11, 0x0a, 0xfc, 0x66, 0x0b, 0x12, 0x06, 0x06, 0x05, 0x02, // $f.......f......
-	0x2c, 0x01, 0x05, 0x05, 0x05, 0x12, 0x0c, 0x03, 0x42, 0x23, 0x02, 0x04, 0x04, 0x01, 0x2c, 0x03, // ,.......B#....,.
-	0x2a, 0xfe, 0x8b, 0x01, 0x75, 0xfd, 0x5f, 0x0a, 0x12, 0x08, 0x06, 0x08, 0x01, 0x01, 0x08, 0x06, // *...u._.........
-	0x08, 0x12, 0x0a, 0x01, 0x11, 0x05, 0x0b, 0x05, 0x05, 0x09, 0x04, 0x12, 0x03, 0x06, 0x0b, 0x06, // ................
-	0xfe, 0xea, 0x00, 0x00, 0x00, 0x02, 0x00, 0x71, 0x00, 0x09, 0x03, 0x8f, 0x03, 0x77, 0x00, 0x1c, // .......q.....w..
-	0x00, 0x39, 0x00, 0x00, 0x37, 0x11, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x21, 0x32, 0x36, 0x37, // .9..7......3!267
-	0x3e, 0x01, 0x35, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, 0x2e, 0x01, // >.5......#!"&'..
-	0x35, 0x01, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x21, 0x22, 0x26, 0x27, // 5..........#!"&'
-	0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x71, 0x07, // ..5.467>.3!2..q.
-	0x08, 0x08, 0x13, 0x0b, 0x02, 0xb4, 0x0a, 0x13, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x13, 0x0a, // ................
-	0xfd, 0x4c, 0x0b, 0x13, 0x08, 0x08, 0x07, 0x03, 0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x13, 0x0a, // .L..............
-	0xfd, 0x4c, 0x0b, 0x13, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x13, 0x0b, 0x02, 0xb4, 0x0a, 0x13, // .L..............
-	0x08, 0x3e, 0x01, 0x56, 0x09, 0x11, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x11, 0x09, 0xfe, 0xaa, // .>.V............
-	0x0b, 0x13, 0x08, 0x08, 0x07, 0x07, 0x08, 0x08, 0x13, 0x0b, 0x03, 0x29, 0x08, 0x13, 0x0a, 0xfe, // ...........)....
-	0xa5, 0x0b, 0x13, 0x08, 0x07, 0x07, 0x07, 0x07, 0x08, 0x13, 0x0b, 0x01, 0x59, 0x0c, 0x13, 0x08, // ............Y...
-	0x08, 0x08, 0x08, 0x08, 0x00, 0x02, 0x00, 0x8b, 0x00, 0x56, 0x03, 0x75, 0x03, 0x2a, 0x00, 0x04, // .........V.u.*..
-	0x00, 0x20, 0x00, 0x00, 0x01, 0x13, 0x21, 0x13, 0x21, 0x13, 0x37, 0x3e, 0x01, 0x35, 0x13, 0x16, // . ....!.!.7>.5..
-	0x06, 0x07, 0x0e, 0x01, 0x07, 0x21, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x13, 0x14, 0x16, 0x17, // .....!..'..7....
-	0x1e, 0x01, 0x17, 0x21, 0x37, 0x03, 0x0f, 0x37, 0xfd, 0x77, 0x36, 0x02, 0x1c, 0x31, 0x02, 0x04, // ...!7..7.w6..1..
-	0x03, 0x2c, 0x01, 0x05, 0x06, 0x07, 0x11, 0x0a, 0xfd, 0x6e, 0x0b, 0x11, 0x07, 0x06, 0x04, 0x01, // .,.......n......
-	0x2c, 0x04, 0x05, 0x05, 0x12, 0x0c, 0x02, 0x3a, 0x23, 0x03, 0x2a, 0xfe, 0x8b, 0x01, 0x75, 0xfe, // ,......:#.*...u.
-	0x5b, 0x03, 0x06, 0x0b, 0x06, 0xfe, 0xeb, 0x0b, 0x12, 0x07, 0x07, 0x08, 0x01, 0x01, 0x08, 0x07, // [...............
-	0x07, 0x12, 0x0b, 0x01, 0x10, 0x05, 0x0b, 0x05, 0x05, 0x09, 0x04, 0x12, 0x00, 0x02, 0x00, 0x06, // ................
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x28, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, // .......(./...2..
-	0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, // ..........#"..'.
-	0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x03, 0x23, 0x11, 0x21, 0x35, 0x23, 0x11, // .54>.7>.3.#.!5#.
-	0x02, 0x00, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, // ..5aYQ%%8%..%8%%
-	0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, // QYa55aZR%$8$..$8
-	0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x1e, 0x60, 0x01, 0x1c, 0xbc, 0x03, 0xba, 0x13, 0x24, 0x38, // $%RZa5.`......$8
-	0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0x25, 0x38, 0x25, 0x13, 0x13, // $%RZa55aYQ%%8%..
-	0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, // %8%%QYa55aZR%$8$
-	0x13, 0xfe, 0xc4, 0xfe, 0x65, 0x52, 0x01, 0x49, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc7, 0x03, 0xfa, // ....eR.I........
-	0x03, 0xb9, 0x00, 0x06, 0x00, 0x35, 0x00, 0x00, 0x01, 0x11, 0x33, 0x35, 0x23, 0x35, 0x23, 0x05, // .....5....35#5#.
-	0x16, 0x06, 0x07, 0x33, 0x0e, 0x01, 0x07, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, // ...3..........+.
-	0x22, 0x26, 0x2f, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x26, 0x36, // "&/...=...'..7&6
-	0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x01, 0x07, 0x01, 0xbd, 0xa6, 0x6c, 0x3a, // 7>.32.........l:
-	0x02, 0x3d, 0x02, 0x50, 0x51, 0x01, 0x22, 0x4c, 0x29, 0x10, 0x11, 0x02, 0x11, 0x27, 0x16, 0xa8, // .=.PQ."L)....'..
-	0x17, 0x28, 0x10, 0x03, 0x0f, 0x10, 0x29, 0x4c, 0x22, 0x50, 0x4f, 0x01, 0x01, 0x4f, 0x50, 0x24, // .(....)L"PO..OP$
-	0x50, 0x57, 0x5e, 0x33, 0x33, 0x5e, 0x57, 0x4f, 0x24, 0x51, 0x4f, 0x01, 0x02, 0xe8, 0xff, 0x00, // PW^33^WO$QO.....
-	0x33, 0xcd, 0x80, 0x49, 0x7b, 0x32, 0x16, 0x21, 0x0b, 0xf9, 0x17, 0x29, 0x11, 0x01, 0x0f, 0x0f, // 3..I{2.!...)....
-	0x0f, 0x0f, 0x04, 0x10, 0x27, 0x17, 0xf9, 0x0b, 0x21, 0x16, 0x32, 0x7b, 0x49, 0x4a, 0x7b, 0x32, // ....'...!.2{IJ{2
-	0x16, 0x22, 0x17, 0x0b, 0x0b, 0x17, 0x22, 0x16, 0x32, 0x7b, 0x4a, 0x00, 0x00, 0x03, 0x00, 0x06, // ."....".2{J.....
-	0xff, 0xc7, 0x03, 0xfa, 0x03, 0xb9, 0x00, 0x2e, 0x00, 0x3e, 0x00, 0x50, 0x00, 0x00, 0x01, 0x16, // .........>.P....
-	0x06, 0x07, 0x33, 0x0e, 0x01, 0x07, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x22, // ..3..........+."
-	0x26, 0x2f, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x26, 0x36, 0x37, // &/...=...'..7&67
-	0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x01, 0x07, 0x25, 0x1e, 0x01, 0x15, 0x14, 0x06, // >.32......%.....
-	0x07, 0x0e, 0x01, 0x2b, 0x01, 0x35, 0x33, 0x32, 0x16, 0x17, 0x17, 0x34, 0x26, 0x27, 0x2e, 0x01, // ...+.532...4&'..
-	0x2b, 0x01, 0x11, 0x33, 0x35, 0x33, 0x17, 0x33, 0x27, 0x3e, 0x01, 0x35, 0x03, 0xfa, 0x02, 0x50, // +..353.3'>.5...P
+	0x11, 0x43, 0x59, 0x03, 0x2e, 0x20, 0x03, 0x03, 0x05, 0x19, 0x13, 0x01, 0x58, 0x0b, 0x09, 0x02, // .CY.. ......X...
+	0x03, 0x0e, 0x0d, 0x0c, 0x47, 0xe5, 0x04, 0x43, 0x5f, 0x03, 0x24, 0x06, 0x03, 0xfa, 0x03, 0x7a, // ....G..C_.$....z
+	0x18, 0x42, 0xf3, 0x04, 0x28, 0x3e, 0x00, 0x00, 0x13, 0x23, 0x15, 0x33, 0x35, 0x21, 0x83, 0x04, // .B..(>...#.35!..
+	0x20, 0x37, 0x4b, 0x7e, 0x08, 0x63, 0x47, 0x11, 0x52, 0x52, 0x0f, 0x20, 0x21, 0x53, 0x29, 0x07, //  7K~.cG.RR. !S).
+	0x2e, 0xc4, 0x3f, 0x3f, 0x02, 0xb7, 0x3f, 0x3f, 0x7f, 0x13, 0x13, 0x13, 0x2c, 0x1a, 0xfd, 0xbe, // ..??..??....,...
+	0x48, 0x7e, 0x04, 0x21, 0xfd, 0x0a, 0x6a, 0x9b, 0x05, 0x25, 0xfd, 0x1b, 0x2d, 0x12, 0x12, 0x13, // H~.!..j..%..-...
+	0x5e, 0x1c, 0x05, 0x21, 0x02, 0x78, 0x5e, 0x36, 0x05, 0x22, 0x02, 0x7e, 0xfd, 0x82, 0x00, 0x22, // ^..!.x^6.".~..."
+	0x3f, 0xfe, 0xc4, 0x84, 0x1b, 0x20, 0x7e, 0x5e, 0x06, 0x04, 0x21, 0x3f, 0x3d, 0x5e, 0xae, 0x05, // ?.... ~^..!?=^..
+	0x4b, 0xeb, 0x04, 0x21, 0x01, 0x3a, 0x85, 0x0c, 0x85, 0x1a, 0x7e, 0xcb, 0x04, 0x24, 0x23, 0x03, // K..!.:....~..$#.
+	0xf9, 0x03, 0x5d, 0x47, 0x87, 0x07, 0x7e, 0xbf, 0x05, 0x4b, 0xc4, 0x05, 0x7d, 0x63, 0x06, 0x6d, // ..]G..~..K..}c.m
+	0xda, 0x05, 0x35, 0x03, 0xe6, 0x09, 0x0a, 0x01, 0x07, 0x07, 0xfe, 0x43, 0x1d, 0x23, 0x09, 0x0f, // ..5........C.#..
+	0x05, 0xfe, 0x44, 0x09, 0x07, 0x01, 0x09, 0x09, 0xb2, 0x63, 0xc5, 0x03, 0x08, 0x20, 0x08, 0x0c, // ..D......c... ..
+	0x15, 0x08, 0xc0, 0x02, 0x9c, 0x08, 0x15, 0x0d, 0x0b, 0x15, 0x0a, 0xfd, 0xef, 0x14, 0x03, 0x0a, // ................
+	0x07, 0x02, 0x11, 0x0a, 0x15, 0x0b, 0x0c, 0x14, 0x08, 0xb0, 0x0a, 0x09, 0x09, 0x08, 0xb0, 0x53, // ...............S
+	0x5f, 0x04, 0x24, 0x9b, 0xff, 0xc6, 0x03, 0x65, 0x43, 0x53, 0x04, 0x20, 0x3b, 0x59, 0xeb, 0x04, // _.$....eCS. ;Y..
+	0x20, 0x07, 0x18, 0x48, 0x14, 0x15, 0x55, 0xeb, 0x05, 0x18, 0x40, 0xe1, 0x06, 0x24, 0x2f, 0x01, //  ..H..U...@..$/.
+	0x11, 0x2e, 0x01, 0x43, 0x3f, 0x0f, 0x26, 0x02, 0x00, 0x26, 0x40, 0x1a, 0x19, 0x1a, 0x82, 0x02, // ...C?.&..&@.....
+	0x24, 0x40, 0x26, 0x25, 0x40, 0x1a, 0x84, 0x00, 0x08, 0x21, 0x40, 0x25, 0x01, 0x65, 0x34, 0x34, // $@&%@....!@%.e44
+	0x18, 0x34, 0x1c, 0x08, 0x13, 0x13, 0x67, 0x67, 0x13, 0x13, 0x08, 0x1d, 0x36, 0x18, 0x33, 0x32, // .4....gg....6.32
+	0x32, 0x33, 0x34, 0x80, 0x4c, 0x4a, 0x7f, 0x34, 0x34, 0x34, 0x03, 0x07, 0x84, 0x24, 0x23, 0x24, // 234.LJ.444...$#$
+	0x3f, 0x1a, 0x1b, 0x82, 0x00, 0x22, 0x1a, 0x3f, 0x24, 0x84, 0x38, 0x38, 0xb1, 0x4a, 0x7e, 0x34, // ?....".?$.88.J~4
+	0x19, 0x26, 0x0d, 0xfe, 0xd3, 0x13, 0x08, 0x06, 0x67, 0x67, 0x06, 0x08, 0x13, 0x01, 0x2b, 0x0f, // .&......gg....+.
+	0x26, 0x19, 0x34, 0x7e, 0x4a, 0x82, 0x33, 0x21, 0x33, 0x34, 0x82, 0x02, 0x21, 0x7f, 0x4a, 0x55, // &.4~J.3!34..!.JU
+	0x7b, 0x05, 0x20, 0x39, 0x82, 0xbb, 0x20, 0xc8, 0x49, 0x3f, 0x04, 0x20, 0x47, 0x4f, 0x99, 0x05, // {. 9.. .I?. GO..
+	0x38, 0x17, 0x13, 0x17, 0x0f, 0x01, 0x27, 0x0f, 0x02, 0x27, 0x03, 0x27, 0x07, 0x27, 0x07, 0x03, // 8.....'..'.'.'..
+	0x07, 0x2f, 0x02, 0x07, 0x2f, 0x01, 0x26, 0x36, 0x37, 0x13, 0x58, 0x02, 0x0f, 0x20, 0x07, 0x44, // ./../.&67.X.. .D
+	0x35, 0x14, 0x82, 0xee, 0x08, 0x34, 0x03, 0x6e, 0x23, 0x23, 0x02, 0x99, 0x05, 0x10, 0x13, 0x8f, // 5....4.n##......
+	0x26, 0x0f, 0x14, 0x11, 0x99, 0x01, 0x20, 0x22, 0x03, 0x99, 0x11, 0x14, 0x0f, 0x26, 0x8e, 0x14, // &..... ".....&..
+	0x0f, 0x01, 0x02, 0x03, 0x9a, 0x03, 0x23, 0x22, 0x34, 0x33, 0x36, 0x82, 0x4e, 0x4c, 0x81, 0x35, // ......#"436.NL.5
+	0x35, 0x35, 0xb6, 0x1b, 0x1a, 0x1b, 0x40, 0x26, 0x27, 0x41, 0x1b, 0x83, 0xea, 0x24, 0x1b, 0x41, // 55....@&'A...$.A
+	0x27, 0x26, 0x40, 0x82, 0x10, 0x08, 0x27, 0x02, 0x4f, 0x3d, 0x6c, 0x2f, 0x02, 0xfe, 0xf5, 0x13, // '&@...'.O=l/....
+	0x11, 0x05, 0x26, 0x8e, 0x10, 0x03, 0x0c, 0x01, 0x0c, 0x04, 0x01, 0x01, 0x04, 0xfe, 0xf4, 0x0c, // ..&.............
+	0x03, 0x10, 0x8e, 0x26, 0x05, 0x11, 0x05, 0x0a, 0x04, 0x01, 0x0c, 0x03, 0x2e, 0x6b, 0x3d, 0x82, // ...&.........k=.
+	0x41, 0x21, 0x34, 0x35, 0x82, 0x02, 0x25, 0x81, 0x4c, 0x02, 0x26, 0x41, 0x1a, 0x82, 0x42, 0x22, // A!45..%.L.&A..B"
+	0x1b, 0x1a, 0x41, 0x41, 0x37, 0x03, 0x26, 0x1c, 0x1b, 0x1b, 0x1c, 0x1a, 0x40, 0x25, 0x5b, 0x8b, // ..AA7.&.....@%[.
+	0x05, 0x25, 0x00, 0x6f, 0x03, 0xfa, 0x03, 0x11, 0x42, 0xb3, 0x04, 0x22, 0x12, 0x00, 0x17, 0x18, // .%.o....B.."....
+	0x45, 0x9d, 0x06, 0x77, 0xee, 0x03, 0x21, 0x35, 0x27, 0x4c, 0xad, 0x03, 0x54, 0x51, 0x03, 0x20, // E..w..!5'L..TQ. 
+	0x01, 0x82, 0x0c, 0x32, 0x23, 0x77, 0x70, 0x70, 0x01, 0xc1, 0x70, 0x70, 0xe1, 0x01, 0x52, 0x01, // ...2#wpp..pp..R.
+	0x51, 0xfc, 0x0c, 0x01, 0x51, 0x01, 0xc2, 0x82, 0x10, 0x20, 0x50, 0x82, 0x03, 0x2e, 0x51, 0x71, // Q...Q.... P...Qq
+	0x71, 0x70, 0xfe, 0xaf, 0xfe, 0xaf, 0x01, 0xc1, 0xe1, 0xfe, 0x3f, 0x71, 0x71, 0x84, 0x53, 0x52, // qp........?qq.SR
+	0xa3, 0x05, 0x26, 0x06, 0x00, 0x23, 0x00, 0x47, 0x00, 0x74, 0x4f, 0xcd, 0x03, 0x4e, 0x84, 0x03, // ..&..#.G.tO..N..
+	0x21, 0x23, 0x03, 0x41, 0x11, 0x0a, 0x28, 0x07, 0x17, 0x3e, 0x01, 0x33, 0x1f, 0x01, 0x0f, 0x02, // !#.A..(..>.3....
+	0x83, 0x18, 0x22, 0x3f, 0x02, 0x05, 0x18, 0x4b, 0xdf, 0x05, 0x20, 0x37, 0x5a, 0x86, 0x03, 0x21, // .."?...K.. 7Z..!
+	0x07, 0x15, 0x73, 0x0f, 0x06, 0x6f, 0xcc, 0x04, 0x20, 0x07, 0x41, 0x37, 0x09, 0x53, 0x46, 0x07, // ..s..o.. .A7.SF.
+	0x61, 0x58, 0x18, 0x4a, 0x3b, 0x0a, 0x25, 0x01, 0xc5, 0x2b, 0x2e, 0x59, 0x9b, 0x4a, 0x3d, 0x03, // aX.J;.%..+.Y.J=.
+	0x08, 0x2d, 0x0d, 0x0d, 0x16, 0x08, 0x09, 0x10, 0x08, 0x25, 0x09, 0x12, 0x09, 0x12, 0x07, 0x09, // .-.......%......
+	0x19, 0x3b, 0x90, 0x52, 0x25, 0x1e, 0x09, 0x02, 0x3b, 0x07, 0x07, 0x06, 0x14, 0x0c, 0x2b, 0x80, // .;.R%...;.....+.
+	0x42, 0x29, 0x1d, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x09, 0x17, 0x0c, 0x1a, 0x0e, 0x14, 0x12, 0x23, // B).............#
+	0x75, 0xf8, 0x03, 0x25, 0x0b, 0x0b, 0xa7, 0x09, 0x09, 0xee, 0x7a, 0xc3, 0x04, 0x48, 0x15, 0x03, // u..%......z..H..
+	0x22, 0x0c, 0xfc, 0x84, 0x53, 0x46, 0x09, 0x21, 0xd0, 0x08, 0x53, 0x1c, 0x03, 0x2b, 0x01, 0x47, // "...SF.!..S..+.G
+	0x0c, 0x14, 0x09, 0x02, 0xcc, 0x28, 0xa9, 0xd1, 0xfe, 0x5c, 0x44, 0xa4, 0x03, 0x33, 0x08, 0x06, // .....(....D..3..
+	0x06, 0x05, 0x11, 0x0b, 0x16, 0x0e, 0x0e, 0x06, 0x12, 0x16, 0x1c, 0x3d, 0x22, 0x29, 0x25, 0x26, // ...........=")%&
+	0x1d, 0x4d, 0x62, 0xfc, 0x03, 0x33, 0x0a, 0x02, 0x30, 0x21, 0x28, 0x2f, 0x20, 0x04, 0x03, 0x04, // .Mb..3..0!(/ ...
+	0x04, 0x0a, 0x07, 0x13, 0x06, 0x0a, 0x0b, 0x26, 0x0b, 0x0c, 0x82, 0x46, 0x23, 0x1a, 0x10, 0x02, // .......&...F#...
+	0x74, 0x7a, 0xc0, 0x03, 0x20, 0xb9, 0x84, 0x5e, 0x22, 0xfe, 0xb9, 0x0d, 0x18, 0x46, 0x09, 0x07, // tz.. ..^"....F..
+	0x22, 0x0d, 0x01, 0x46, 0x48, 0x8c, 0x04, 0x21, 0x01, 0x45, 0x54, 0x78, 0x04, 0x48, 0x52, 0x03, // "..FH..!.ETx.HR.
+	0x2b, 0x00, 0x02, 0x00, 0x17, 0xff, 0xc6, 0x03, 0xe9, 0x03, 0xba, 0x00, 0x14, 0x4f, 0x8f, 0x03, // +............O..
+	0x20, 0x13, 0x70, 0xe7, 0x06, 0x18, 0x49, 0x6e, 0x0c, 0x48, 0x67, 0x03, 0x55, 0xda, 0x04, 0x23, //  .p...In.Hg.U..#
+	0x07, 0x0e, 0x03, 0x27, 0x41, 0x13, 0x0b, 0x49, 0xd0, 0x03, 0x23, 0xaf, 0x06, 0x0a, 0x05, 0x82, // ...'A..I..#.....
+	0x67, 0x3d, 0x7b, 0x14, 0x05, 0x04, 0x04, 0x05, 0x04, 0x0a, 0x06, 0x7b, 0x86, 0x51, 0xa3, 0xa6, // g={........{.Q..
+	0xaa, 0x56, 0x06, 0x09, 0x04, 0x07, 0x06, 0x48, 0xa0, 0xb0, 0xbf, 0x68, 0x06, 0x0a, 0x04, 0x04, // .V.....H...h....
+	0x83, 0xa2, 0x2b, 0x09, 0x06, 0x05, 0x0a, 0x04, 0x03, 0xba, 0x05, 0x04, 0x15, 0xfc, 0x48, 0x82, // ..+...........H.
+	0xfc, 0x24, 0x05, 0x0a, 0x06, 0x03, 0xb8, 0x7c, 0xa9, 0x04, 0x31, 0x2a, 0x35, 0x55, 0x3e, 0x27, // .$.....|..1*5U>'
+	0x08, 0x06, 0x04, 0x13, 0x12, 0x13, 0x5a, 0x81, 0x51, 0x1f, 0x09, 0x05, 0x03, 0x82, 0x1b, 0x22, // ......Z.Q......"
+	0x02, 0x47, 0x05, 0x7c, 0xdb, 0x03, 0x2d, 0x01, 0x01, 0x03, 0x04, 0x00, 0x05, 0x00, 0x06, 0xff, // .G.|..-.........
+	0xd8, 0x03, 0xfa, 0x03, 0xa8, 0x18, 0x47, 0xef, 0x06, 0x22, 0x1d, 0x00, 0x22, 0x57, 0xf9, 0x04, // ......G..".."W..
+	0x28, 0x07, 0x01, 0x3f, 0x01, 0x17, 0x07, 0x27, 0x13, 0x01, 0x83, 0x0a, 0x29, 0x1f, 0x01, 0x07, // (..?...'....)...
+	0x17, 0x01, 0x23, 0x07, 0x27, 0x01, 0x27, 0x82, 0x03, 0x08, 0x40, 0x37, 0x0f, 0x01, 0x27, 0x37, // ..#.'.'...@7..'7
+	0x17, 0x7d, 0x57, 0x01, 0x56, 0x56, 0xfe, 0xa9, 0x79, 0x55, 0xab, 0x55, 0xab, 0x67, 0xfe, 0xa9, // .}W.VV..yU.U.g..
+	0x55, 0x01, 0x57, 0x55, 0x01, 0xf0, 0xab, 0x02, 0x57, 0x55, 0xfe, 0xfe, 0xa9, 0x45, 0x7d, 0x01, // U.WU....WU...E}.
+	0x9b, 0x62, 0xac, 0x54, 0x01, 0x01, 0x88, 0xde, 0x57, 0xab, 0x57, 0xab, 0x02, 0x5d, 0x57, 0xfe, // .b.T....W.W..]W.
+	0xa3, 0x57, 0x01, 0x5d, 0x7b, 0x56, 0xae, 0x57, 0xaf, 0xfd, 0xae, 0x01, 0x84, 0x0e, 0x36, 0x02, // .W.]{V.W......6.
+	0xaa, 0xaf, 0xb0, 0x56, 0x57, 0xfe, 0xfa, 0x46, 0x7f, 0x01, 0xa3, 0x63, 0xae, 0x58, 0x01, 0x05, // ...VW..F...c.X..
+	0x24, 0x36, 0x56, 0xae, 0x56, 0xae, 0x6e, 0xb7, 0x0a, 0x28, 0x04, 0x00, 0x2d, 0x00, 0x32, 0x00, // $6V.V.n..(..-.2.
+	0x41, 0x00, 0x46, 0x7f, 0x03, 0x03, 0x25, 0x13, 0x17, 0x37, 0x27, 0x07, 0x07, 0x47, 0xad, 0x11, // A.F...%..7'..G..
+	0x47, 0xc9, 0x09, 0x20, 0x25, 0x83, 0x21, 0x2d, 0x25, 0x0f, 0x01, 0x17, 0x37, 0x17, 0x07, 0x17, // G.. %.!-%...7...
+	0x37, 0x33, 0x37, 0x27, 0x37, 0x2f, 0x82, 0xae, 0x82, 0x14, 0x83, 0x12, 0x26, 0x27, 0xd4, 0xbd, // 737'7/......&'..
+	0x2f, 0xbd, 0x2f, 0xce, 0x18, 0x4e, 0x31, 0x0c, 0x21, 0x24, 0x26, 0x47, 0x62, 0x05, 0x21, 0x26, // /./..N1.!$&Gb.!&
+	0x24, 0x78, 0x7b, 0x09, 0x08, 0x2e, 0x38, 0x24, 0x13, 0x01, 0x10, 0xbd, 0x31, 0xbf, 0x2f, 0x01, // $x{...8$....1./.
+	0x8e, 0x4b, 0x8e, 0x2f, 0x5e, 0x36, 0xe4, 0x46, 0x27, 0x5e, 0x8e, 0x2f, 0x30, 0x01, 0x5f, 0xd9, // .K./^6.F'^./0._.
+	0x30, 0x5f, 0x2f, 0x5e, 0x43, 0x2f, 0x5f, 0x2f, 0x5f, 0x01, 0xd8, 0xc1, 0x31, 0xc0, 0x30, 0x18, // 0_/^C/_/_...1.0.
+	0x34, 0x62, 0x59, 0x52, 0x26, 0x47, 0x92, 0x07, 0x24, 0x26, 0x52, 0x59, 0x62, 0x34, 0x18, 0x4a, // 4bYR&G..$&RYb4.J
+	0xd2, 0x08, 0x4c, 0x6a, 0x04, 0x73, 0x8d, 0x03, 0x3c, 0x5d, 0xc2, 0x30, 0xc1, 0x2f, 0x73, 0x13, // ..Lj.s..<].0./s.
+	0x90, 0x32, 0x62, 0x38, 0xe8, 0x46, 0x27, 0x91, 0x2f, 0x30, 0x62, 0x60, 0x44, 0x30, 0x61, 0x30, // .2b8.F'./0b`D0a0
+	0x61, 0x44, 0x30, 0x60, 0x2f, 0x61, 0x4e, 0x5b, 0x06, 0x20, 0x05, 0x82, 0xeb, 0x20, 0x7b, 0x63, // aD0`/aN[. ... {c
+	0xdf, 0x03, 0x25, 0x25, 0x01, 0x23, 0x3e, 0x01, 0x35, 0x62, 0xba, 0x07, 0x20, 0x07, 0x4c, 0x89, // ..%%.#>.5b.. .L.
+	0x03, 0x21, 0x31, 0x27, 0x47, 0xb5, 0x07, 0x83, 0x02, 0x08, 0x3b, 0x14, 0x16, 0x17, 0x23, 0x01, // .!1'G.....;...#.
+	0x02, 0x00, 0x01, 0xbf, 0x02, 0x1f, 0x1e, 0x02, 0x2c, 0x2b, 0x0e, 0x1e, 0x11, 0x20, 0x49, 0x29, // ........,+... I)
+	0x3c, 0x66, 0x2a, 0x06, 0x06, 0x2a, 0x66, 0x3c, 0x29, 0x49, 0x20, 0x11, 0x1e, 0x0e, 0x2b, 0x2c, // <f*..*f<)I ...+,
+	0x02, 0x1e, 0x1f, 0x02, 0x01, 0xbf, 0x05, 0x01, 0xb1, 0x26, 0x5a, 0x33, 0x3a, 0x62, 0x28, 0x0d, // .........&Z3:b(.
+	0x17, 0x08, 0x12, 0x11, 0x01, 0x01, 0x2b, 0x83, 0x24, 0x4f, 0xda, 0x03, 0x2b, 0x12, 0x08, 0x17, // ......+.$O..+...
+	0x0d, 0x28, 0x62, 0x3a, 0x33, 0x5a, 0x26, 0xfe, 0x4f, 0x86, 0x7f, 0x21, 0x02, 0x00, 0x82, 0x7f, // .(b:3Z&.O..!....
+	0x20, 0x13, 0x82, 0x0c, 0x94, 0x6d, 0x85, 0x5b, 0x21, 0x21, 0x10, 0x89, 0x5b, 0x21, 0x03, 0x1f, //  ....m.[!!..[!..
+	0x86, 0x4a, 0x21, 0x09, 0x16, 0x8a, 0x4a, 0x47, 0x43, 0x04, 0x85, 0xcb, 0x22, 0x03, 0x00, 0x29, // .J!...JGC..."..)
+	0x46, 0x2d, 0x03, 0x25, 0x25, 0x39, 0x02, 0x09, 0x02, 0x33, 0x48, 0x33, 0x08, 0x48, 0x2d, 0x06, // F-.%%9...3H3.H-.
+	0x20, 0x31, 0x42, 0xd9, 0x06, 0x64, 0x28, 0x05, 0x24, 0x16, 0x06, 0x07, 0x33, 0x27, 0x63, 0xaa, //  1B..d(.$...3'c.
+	0x07, 0x22, 0x0f, 0x02, 0x11, 0x77, 0x55, 0x04, 0x83, 0xe2, 0x27, 0xfe, 0x41, 0xfe, 0x41, 0x02, // ."...wU...'.A.A.
+	0x1f, 0x1f, 0x01, 0x99, 0xe7, 0x26, 0x01, 0x1f, 0x1f, 0x02, 0x72, 0x01, 0x13, 0x7b, 0x1b, 0x03, // .....&....r..{..
+	0x28, 0x1a, 0x2d, 0x13, 0x06, 0x66, 0x01, 0x30, 0x0f, 0x0e, 0x82, 0xf6, 0x21, 0xfe, 0x4f, 0xa1, // (.-..f.0....!.O.
+	0xfa, 0x31, 0x9e, 0x1a, 0x2c, 0x12, 0x14, 0x13, 0x10, 0x11, 0x06, 0x58, 0xfe, 0x77, 0x01, 0x32, // .1..,......X.w.2
+	0x12, 0x2a, 0x18, 0x03, 0x5e, 0x2f, 0x06, 0x41, 0x8b, 0x07, 0x21, 0x46, 0x00, 0x64, 0x43, 0x09, // .*..^/.A..!F.dC.
+	0x41, 0x88, 0x16, 0x20, 0x09, 0x41, 0xad, 0x04, 0x25, 0x07, 0x14, 0x06, 0x07, 0x09, 0x01, 0x58, // A.. .A..%......X
+	0x97, 0x09, 0x23, 0x32, 0x16, 0x1f, 0x02, 0x5d, 0x0c, 0x09, 0x23, 0x17, 0x15, 0x03, 0xfa, 0x41, // ..#2...]..#....A
+	0xa8, 0x1e, 0x41, 0xcc, 0x04, 0x29, 0xad, 0x0e, 0x0f, 0xfe, 0xd0, 0xfe, 0xd0, 0x0f, 0x0e, 0x14, // ..A..)..........
+	0x88, 0xcd, 0x2c, 0x66, 0x06, 0x13, 0x2d, 0x1a, 0x1c, 0x30, 0x14, 0x13, 0x13, 0x01, 0x02, 0x69, // ..,f..-..0.....i
+	0x83, 0xcc, 0x21, 0x16, 0x09, 0x8d, 0xcc, 0x41, 0x7c, 0x0a, 0x84, 0xf0, 0x25, 0x19, 0x17, 0x2a, // ..!....A|...%..*
+	0x12, 0xfe, 0xce, 0x83, 0xcd, 0x21, 0x17, 0x04, 0x82, 0xde, 0x21, 0x13, 0x14, 0x82, 0xde, 0x2a, // .....!....!....*
+	0x59, 0x59, 0x06, 0x10, 0x11, 0x14, 0x13, 0x12, 0x2c, 0x1b, 0x03, 0x4f, 0x5b, 0x05, 0x20, 0xe6, // YY......,..O[. .
+	0x82, 0xdf, 0x2b, 0x9a, 0x00, 0x0a, 0x00, 0x00, 0x17, 0x0b, 0x01, 0x25, 0x37, 0x17, 0x05, 0x82, // ..+........%7...
+	0x05, 0x3e, 0x05, 0xc7, 0x0e, 0xb3, 0x01, 0x30, 0xcc, 0xc8, 0x01, 0x30, 0xb3, 0x11, 0xfe, 0xcc, // .>.....0...0....
+	0xfe, 0xc5, 0x1a, 0x01, 0x3f, 0x01, 0x0b, 0x70, 0xfa, 0xfa, 0x70, 0xfe, 0xf5, 0xfe, 0xc1, 0x54, // ....?..p..p....T
+	0x54, 0x85, 0x37, 0x26, 0xe7, 0x02, 0x00, 0x03, 0x99, 0x00, 0x05, 0x82, 0x0c, 0x31, 0x05, 0x1b, // T.7&.........1..
+	0x01, 0x25, 0x11, 0x01, 0x35, 0xfe, 0xd1, 0xb2, 0x0f, 0x01, 0x39, 0x02, 0xa0, 0x70, 0xfe, 0xf6, // .%..5.....9..p..
+	0x82, 0x25, 0x21, 0x03, 0x5e, 0x5b, 0x8b, 0x06, 0x87, 0x5f, 0x20, 0x10, 0x8c, 0x61, 0x25, 0x25, // .%!.^[..._ ..a%%
+	0x17, 0x3f, 0x01, 0x2f, 0x01, 0x8e, 0x67, 0x26, 0x01, 0x3d, 0xb0, 0x0a, 0x66, 0xad, 0x73, 0x8e, // .?./..g&.=..f.s.
+	0x6e, 0x25, 0xfb, 0x30, 0xb6, 0x98, 0x40, 0x8e, 0x8c, 0x4b, 0x20, 0x15, 0x8c, 0x4b, 0x21, 0x3f, // n%.0..@..K ..K!?
+	0x01, 0x84, 0x4c, 0x22, 0x0f, 0x01, 0x1f, 0x8f, 0x50, 0x21, 0x8a, 0xb3, 0x84, 0x50, 0x23, 0x74, // ..L"....P!...P#t
+	0xad, 0x66, 0x08, 0x8e, 0x54, 0x21, 0xcb, 0x30, 0x84, 0x55, 0x23, 0x8e, 0x40, 0x98, 0xb6, 0x62, // .f..T!.0.U#.@..b
+	0xc3, 0x0c, 0x24, 0x1b, 0x00, 0x27, 0x00, 0x33, 0x7c, 0x19, 0x04, 0x22, 0x27, 0x23, 0x11, 0x48, // ..$..'.3|.."'#.H
+	0xcf, 0x0b, 0x22, 0x27, 0x3f, 0x01, 0x88, 0x0a, 0x21, 0x07, 0x33, 0x4d, 0xe4, 0x07, 0x22, 0x23, // .."'?...!.3M.."#
+	0x35, 0x35, 0x8a, 0x0b, 0x20, 0x13, 0x78, 0x0c, 0x18, 0x08, 0x25, 0x3e, 0x03, 0x33, 0x02, 0x58, // 55.. .x...%>.3.X
+	0x4d, 0xa9, 0xbf, 0x2d, 0x3f, 0x13, 0x0f, 0x0f, 0x0c, 0x0c, 0x0d, 0x20, 0x14, 0x10, 0x10, 0x10, // M..-?...... ....
+	0x11, 0x0f, 0x0f, 0x08, 0x18, 0x10, 0x96, 0x3b, 0x45, 0x0c, 0x0c, 0x0b, 0x0b, 0x3e, 0x44, 0x30, // .......;E....>D0
+	0x3d, 0x4e, 0x7d, 0x03, 0x22, 0x3c, 0x30, 0x3e, 0x4c, 0x20, 0x0c, 0x4b, 0xea, 0x16, 0x08, 0x30, // =N}."<0>L .K...0
+	0x02, 0x84, 0x09, 0xfe, 0x66, 0x13, 0x14, 0x10, 0x26, 0x16, 0x13, 0x20, 0x0e, 0x0c, 0x11, 0x04, // ....f...&.. ....
+	0x06, 0x0b, 0x0c, 0x24, 0x17, 0x14, 0x24, 0x11, 0x09, 0x0d, 0x05, 0xe5, 0x0a, 0x04, 0x12, 0x0e, // ...$..$.........
+	0x0e, 0x14, 0x05, 0x0a, 0x5f, 0xa1, 0x08, 0x05, 0x13, 0x0e, 0x0d, 0x11, 0x05, 0x08, 0x59, 0x01, // ...._.........Y.
+	0x7a, 0x4c, 0x7e, 0x15, 0x8d, 0x5d, 0x29, 0x00, 0x01, 0x00, 0x19, 0xff, 0xc7, 0x03, 0x88, 0x03, // zL~..]).........
+	0xba, 0x50, 0x6f, 0x04, 0x24, 0x11, 0x0e, 0x01, 0x07, 0x23, 0x83, 0x03, 0x4f, 0xb2, 0x04, 0x43, // .Po.$....#..O..C
+	0xb2, 0x06, 0x24, 0x33, 0x35, 0x21, 0x11, 0x16, 0x5a, 0x34, 0x05, 0x88, 0x17, 0x7a, 0xbf, 0x04, // ..$35!..Z4...z..
+	0x08, 0x2b, 0x33, 0x17, 0x11, 0x26, 0x36, 0x17, 0x21, 0x32, 0x16, 0x15, 0x03, 0x88, 0x05, 0x20, // .+3..&6.!2..... 
+	0x1c, 0x03, 0x1e, 0x45, 0x28, 0x02, 0x29, 0x46, 0x1b, 0x1b, 0x17, 0x04, 0x04, 0x21, 0x1c, 0x1c, // ...E(.)F.....!..
+	0x3c, 0x21, 0x2c, 0xfe, 0xba, 0x01, 0x21, 0x23, 0x02, 0x1d, 0x44, 0x26, 0x02, 0x2a, 0x83, 0x16, // <!,...!#..D&.*..
+	0x08, 0x45, 0x05, 0x03, 0x20, 0x1c, 0x04, 0x1b, 0x3a, 0x20, 0x02, 0x49, 0x01, 0x28, 0x29, 0x01, // .E.. ...: .I.().
+	0xba, 0x31, 0x31, 0x03, 0x5b, 0xfe, 0x08, 0x2d, 0x4a, 0x1c, 0x21, 0x24, 0x03, 0x04, 0x19, 0x1e, // .11.[..-J.!$....
+	0x1a, 0x46, 0x2c, 0x27, 0x45, 0x1d, 0x1c, 0x20, 0x05, 0xa3, 0xfd, 0xd6, 0x1f, 0x3e, 0x1f, 0x05, // .F,'E.. .....>..
+	0x1d, 0x20, 0x05, 0x04, 0x18, 0x1c, 0x1b, 0x44, 0x2a, 0x29, 0x47, 0x1e, 0x01, 0x1b, 0x20, 0x07, // . .....D*)G... .
+	0x04, 0x02, 0x0b, 0x32, 0x31, 0x01, 0x30, 0x2f, 0x41, 0xbb, 0x03, 0x83, 0xb3, 0x47, 0x4f, 0x03, // ...21.0/A....GO.
+	0x24, 0x07, 0x00, 0x22, 0x00, 0x3d, 0x6c, 0xc5, 0x04, 0x20, 0x17, 0x85, 0x99, 0x20, 0x05, 0x84, // $..".=l.. ... ..
+	0xb0, 0x22, 0x17, 0x35, 0x17, 0x90, 0xb1, 0x21, 0x37, 0x13, 0x56, 0xed, 0x0c, 0x4d, 0xdd, 0x05, // .".5...!7.V..M..
+	0x5d, 0x58, 0x06, 0x48, 0x72, 0x06, 0x23, 0x15, 0x11, 0x07, 0x27, 0x82, 0xed, 0x2c, 0x23, 0x27, // ]X.Hr.#...'..,#'
+	0x01, 0xff, 0xb2, 0x28, 0x42, 0x1a, 0x19, 0x17, 0x02, 0xfe, 0x59, 0x85, 0xaf, 0x20, 0x83, 0x89, // ...(B.....Y.. ..
+	0xc7, 0x21, 0x1a, 0x1c, 0x84, 0xc7, 0x28, 0x31, 0x0a, 0x18, 0x0e, 0x0e, 0x16, 0x09, 0x02, 0xef, // .!....(1........
+	0x7f, 0xbd, 0x03, 0x27, 0x09, 0x17, 0x0e, 0x0d, 0x18, 0x0a, 0xfd, 0x11, 0x48, 0x6c, 0x03, 0x23, // ...'........Hl.#
+	0x9a, 0x07, 0x25, 0x1d, 0x83, 0xdb, 0x29, 0x09, 0xde, 0x18, 0x2c, 0xee, 0xd4, 0x01, 0x38, 0xb2, // ..%...)...,...8.
+	0x01, 0x82, 0x31, 0x22, 0x3f, 0x27, 0x2a, 0x84, 0xc2, 0x23, 0xce, 0x82, 0xfe, 0xf1, 0x8f, 0xdb, // ..1"?'*..#......
+	0x21, 0x02, 0x58, 0x83, 0x42, 0x21, 0xfd, 0x12, 0x82, 0x44, 0x21, 0x0e, 0x17, 0x5e, 0x78, 0x04, // !.X.B!...D!..^x.
+	0x21, 0x02, 0xee, 0x85, 0x5c, 0x2b, 0x23, 0x19, 0x18, 0x30, 0x2f, 0xfe, 0x08, 0x36, 0xde, 0x06, // !....+#..0/..6..
+	0xa3, 0xd5, 0x71, 0x8f, 0x08, 0x42, 0xb3, 0x04, 0x20, 0x14, 0x79, 0x2f, 0x06, 0x56, 0x26, 0x0b, // ..q..B.. .y/.V&.
+	0x27, 0x01, 0x23, 0x35, 0x33, 0x01, 0x33, 0x13, 0x37, 0x62, 0xdf, 0x07, 0x20, 0x02, 0x42, 0xbf, // '.#53.3.7b.. .B.
+	0x07, 0x23, 0x2f, 0x02, 0x02, 0x40, 0x71, 0x75, 0x09, 0x2b, 0x3f, 0xfe, 0x84, 0x7f, 0x7f, 0x01, // .#/..@qu.+?.....
+	0x7c, 0x3f, 0xd7, 0x49, 0x30, 0x01, 0x4a, 0x5b, 0x03, 0x25, 0x03, 0x2e, 0x49, 0x1d, 0x01, 0x23, // |?.I0.J[.%..I..#
+	0x82, 0x00, 0x21, 0x01, 0x1d, 0x56, 0x37, 0x04, 0x54, 0x09, 0x08, 0x3c, 0x01, 0x7c, 0xfc, 0x01, // ..!..V7.T..<.|..
+	0x7c, 0xfe, 0xc2, 0x68, 0x29, 0x01, 0x35, 0x7f, 0x4b, 0x4b, 0x7f, 0x34, 0x03, 0x28, 0x68, 0x18, // |..h).5.KK.4.(h.
+	0x02, 0x23, 0x53, 0x31, 0x30, 0x53, 0x23, 0x03, 0x18, 0x18, 0x50, 0xa3, 0x0c, 0x20, 0x1d, 0x18, // .#S10S#...P.. ..
+	0x44, 0xe7, 0x04, 0x88, 0x8f, 0x21, 0x01, 0x37, 0x89, 0x85, 0x20, 0x07, 0x61, 0xf0, 0x05, 0x22, // D....!.7.. .a.."
+	0x2f, 0x02, 0x25, 0x5e, 0x3b, 0x08, 0x83, 0xa7, 0x21, 0x37, 0x37, 0x41, 0x86, 0x13, 0x41, 0xa0, // /.%^;...!77A..A.
+	0x05, 0x86, 0xac, 0x22, 0xfe, 0xfe, 0x84, 0x86, 0xa3, 0x24, 0x1d, 0x1c, 0x5e, 0x0c, 0x0c, 0x83, // ...".....$..^...
+	0x9f, 0x23, 0xfd, 0xb2, 0x01, 0xb6, 0x89, 0xc3, 0x23, 0x44, 0x44, 0x02, 0xd8, 0x82, 0x0d, 0x83, // .#......#DD.....
+	0x0f, 0x82, 0xaf, 0x21, 0xfd, 0x28, 0x54, 0xd8, 0x06, 0x52, 0x00, 0x03, 0x85, 0xc7, 0x24, 0xfe, // ...!.(T..R....$.
+	0xbb, 0x01, 0x01, 0x84, 0x87, 0xc0, 0x26, 0x38, 0x63, 0x2c, 0x5d, 0x19, 0x35, 0x1c, 0x84, 0xbc, // ......&8c,].5...
+	0x23, 0x06, 0xfe, 0x4b, 0xc7, 0x87, 0xe2, 0x23, 0x44, 0xcb, 0xfd, 0x29, 0x85, 0x41, 0x41, 0x79, // #..K...#D..).AAy
+	0x04, 0x26, 0xd6, 0x0a, 0x17, 0x0d, 0x0e, 0x16, 0x09, 0x54, 0xe9, 0x05, 0x54, 0x87, 0x04, 0x21, // .&.......T..T..!
+	0x02, 0x80, 0x41, 0x6f, 0x04, 0x41, 0x6d, 0x15, 0x20, 0x02, 0x57, 0x58, 0x08, 0x41, 0x58, 0x09, // ..Ao.Am. .WX.AX.
+	0x20, 0x03, 0x78, 0x30, 0x03, 0x23, 0x17, 0x0c, 0xfc, 0x8a, 0x5a, 0xd5, 0x04, 0x24, 0x01, 0x7b, //  .x0.#....Z..$.{
+	0xfe, 0x01, 0x7b, 0x41, 0xbb, 0x04, 0x24, 0x9e, 0xff, 0xc6, 0x03, 0x62, 0x48, 0xcf, 0x04, 0x21, // ..{A..$....bH..!
+	0x3c, 0x00, 0x60, 0xa3, 0x04, 0x20, 0x11, 0x4d, 0x2f, 0x05, 0x21, 0x2b, 0x01, 0x64, 0x58, 0x0c, // <.`.. .M/.!+.dX.
+	0x64, 0x92, 0x0b, 0x21, 0x27, 0x23, 0x55, 0x51, 0x10, 0x41, 0x60, 0x04, 0x31, 0x68, 0x01, 0x30, // d..!'#UQ.A`.1h.0
+	0xfe, 0xd0, 0x01, 0x95, 0x08, 0x07, 0x08, 0x12, 0x0a, 0x3c, 0x07, 0x20, 0x39, 0x1a, 0x34, 0x82, // .........<. 9.4.
+	0x00, 0x31, 0x33, 0x7d, 0x4a, 0x49, 0x7d, 0x34, 0x33, 0x34, 0x01, 0x34, 0x34, 0x1a, 0x39, 0x20, // .13}JI}434.44.9 
+	0x07, 0x3c, 0x0b, 0x12, 0x66, 0x3d, 0x05, 0x23, 0x12, 0x0b, 0x01, 0x94, 0x6f, 0x8f, 0x04, 0x28, // .<..f=.#....o..(
+	0x02, 0x25, 0x01, 0x2f, 0xfe, 0xd1, 0x32, 0x0b, 0x13, 0x82, 0x15, 0x37, 0x06, 0x0e, 0x26, 0x18, // .%./..2....7..&.
+	0x32, 0x79, 0x48, 0x26, 0x40, 0x1a, 0x1a, 0x1b, 0x1b, 0x1a, 0x1a, 0x40, 0x26, 0x48, 0x79, 0x32, // 2yH&@......@&Hy2
+	0x19, 0x25, 0x0e, 0x06, 0x85, 0x2f, 0x23, 0x93, 0x0b, 0x12, 0x07, 0x4a, 0xce, 0x03, 0x24, 0x07, // .%.../#....J..$.
+	0x12, 0x0a, 0xfe, 0x6c, 0x43, 0x6f, 0x03, 0x20, 0x85, 0x82, 0xbb, 0x20, 0x7b, 0x84, 0xbb, 0x22, // ...lCo. ... {.."
+	0x09, 0x00, 0x26, 0x7d, 0xfb, 0x03, 0x20, 0x13, 0x4c, 0x56, 0x03, 0x4c, 0x55, 0x04, 0x20, 0x25, // ..&}.. .LV.LU. %
+	0x6e, 0x83, 0x11, 0x47, 0x08, 0x09, 0x18, 0x4a, 0xe4, 0x06, 0x21, 0x15, 0x11, 0x65, 0x6d, 0x04, // n..G...J..!..em.
+	0x82, 0x1b, 0x21, 0x2f, 0x02, 0x86, 0xcb, 0x2e, 0xea, 0x02, 0x2c, 0xfd, 0xd4, 0x01, 0xae, 0x65, // ..!/......,....e
+	0x65, 0xfe, 0x1f, 0x02, 0x92, 0x0a, 0x11, 0x75, 0xef, 0x04, 0x25, 0x08, 0x11, 0x0a, 0xfd, 0x6e, // e......u..%....n
+	0x0a, 0x83, 0x9e, 0x82, 0x00, 0x21, 0x13, 0x0a, 0x86, 0x17, 0x21, 0x05, 0x0a, 0x87, 0x17, 0x21, // .....!....!....!
+	0x09, 0x05, 0x84, 0x17, 0x2a, 0x03, 0x54, 0xfe, 0x6c, 0x01, 0x94, 0xfd, 0x3d, 0x65, 0x65, 0x65, // ....*.T.l...=eee
+	0x41, 0x01, 0x04, 0x20, 0xca, 0x89, 0xe9, 0x20, 0xc9, 0x83, 0x0a, 0x22, 0x08, 0x02, 0xc4, 0x84, // A.. ... ..."....
+	0xba, 0x23, 0xfd, 0xd4, 0x18, 0x0d, 0x83, 0x17, 0x23, 0x0d, 0x18, 0x02, 0x2b, 0x84, 0xd0, 0x43, // .#......#...+..C
+	0x43, 0x05, 0x20, 0x6e, 0x82, 0xcb, 0x20, 0x92, 0x69, 0xa7, 0x06, 0x41, 0x87, 0x05, 0x20, 0x37, // C. n.. .i..A.. 7
+	0x41, 0xd7, 0x06, 0x20, 0x15, 0x86, 0xa3, 0x20, 0x01, 0x41, 0x72, 0x06, 0x20, 0x35, 0x41, 0x73, // A.. ... .Ar. 5As
+	0x06, 0x2f, 0x02, 0xdf, 0xfe, 0x42, 0x01, 0xbe, 0x98, 0x0d, 0x0e, 0x0e, 0x0d, 0x0e, 0x1f, 0x12, // ./...B..........
+	0xfd, 0x90, 0x18, 0x48, 0x09, 0x04, 0x18, 0x44, 0x95, 0x04, 0x2c, 0x13, 0x02, 0x70, 0x12, 0x1f, // ...H...D..,..p..
+	0x0e, 0x03, 0x07, 0xfd, 0xad, 0x02, 0x53, 0x98, 0x82, 0x1b, 0x26, 0xfc, 0xc0, 0x13, 0x20, 0x0d, // ......S...&... .
+	0x02, 0x0c, 0x82, 0x00, 0x20, 0x02, 0x82, 0x1c, 0x23, 0x03, 0x3f, 0x12, 0x20, 0x82, 0x08, 0x82, // .... ...#.?. ...
+	0x36, 0x83, 0x77, 0x20, 0xaa, 0x82, 0x77, 0x20, 0x56, 0x88, 0x77, 0x41, 0x3f, 0x03, 0x21, 0x27, // 6.w ..w V.wA?.!'
+	0x35, 0x41, 0xd4, 0x0a, 0x92, 0x7f, 0x26, 0x01, 0x5c, 0x01, 0x48, 0xfe, 0xb8, 0x99, 0x53, 0x1b, // 5A....&...H...S.
+	0x03, 0x25, 0xfa, 0x12, 0x1f, 0x0d, 0x0e, 0x0d, 0x82, 0x02, 0x23, 0x1f, 0x12, 0xfe, 0x06, 0x83, // .%........#.....
+	0x55, 0x23, 0x0c, 0x0d, 0x0d, 0x0c, 0x85, 0x77, 0x21, 0x96, 0x02, 0x86, 0x98, 0x92, 0x7c, 0x48, // U#.....w!.....|H
+	0xcf, 0x05, 0x24, 0xc3, 0x03, 0xfa, 0x02, 0xbd, 0x18, 0x41, 0x3b, 0x05, 0x20, 0x13, 0x5a, 0xbf, // ..$......A;. .Z.
+	0x04, 0x57, 0xb2, 0x1b, 0x26, 0x6c, 0x03, 0x28, 0xfc, 0xd8, 0x03, 0x7e, 0x41, 0xfe, 0x06, 0x21, // .W..&l.(...~A..!
+	0xfc, 0x72, 0x41, 0x5c, 0x09, 0x26, 0x03, 0x8e, 0x0a, 0x12, 0x07, 0x01, 0x28, 0x42, 0x7b, 0x04, // .rA..&......(B{.
+	0x21, 0x86, 0x08, 0x42, 0x1a, 0x03, 0x42, 0x62, 0x0a, 0x20, 0x93, 0x41, 0x79, 0x04, 0x21, 0x08, // !..B..Bb. .Ay.!.
+	0x07, 0x54, 0xa7, 0x05, 0x20, 0x0d, 0x82, 0xeb, 0x20, 0xf3, 0x84, 0xeb, 0x2a, 0x1f, 0x00, 0x53, // .T.. ... ...*..S
+	0x00, 0x00, 0x25, 0x03, 0x05, 0x13, 0x25, 0x03, 0x49, 0xee, 0x05, 0x56, 0xd2, 0x06, 0x21, 0x05, // ..%...%.I..V..!.
+	0x27, 0x18, 0x51, 0xfb, 0x08, 0x26, 0x37, 0x25, 0x27, 0x16, 0x06, 0x0f, 0x02, 0x72, 0x7d, 0x05, // '.Q..&7%'....r}.
+	0x21, 0x23, 0x07, 0x82, 0x24, 0x18, 0x46, 0x8a, 0x05, 0x20, 0x27, 0x73, 0x71, 0x07, 0x20, 0x35, // !#..$.F.. 'sq. 5
+	0x45, 0xd4, 0x04, 0x49, 0x54, 0x03, 0x20, 0x3e, 0x6e, 0x57, 0x06, 0x3a, 0x17, 0x03, 0x8c, 0x48, // E..IT. >nW.:...H
+	0xfd, 0x30, 0x48, 0x02, 0xd0, 0x33, 0x09, 0x12, 0x08, 0x09, 0x0b, 0x02, 0x61, 0x02, 0x03, 0x05, // .0H..3......a...
+	0x05, 0x0e, 0x09, 0xfc, 0xd6, 0x24, 0x08, 0x83, 0x0c, 0x08, 0x51, 0x02, 0x05, 0x05, 0x0f, 0x09, // .....$....Q.....
+	0x03, 0x2a, 0x2a, 0x01, 0x04, 0x05, 0x48, 0x15, 0x07, 0x0e, 0x07, 0x16, 0x31, 0x1a, 0x01, 0x77, // .**...H.....1..w
+	0x1a, 0x07, 0x01, 0x06, 0x01, 0x07, 0x0f, 0x09, 0x02, 0xf7, 0x02, 0x09, 0x0c, 0x04, 0x03, 0x06, // ................
+	0x02, 0x03, 0x59, 0x01, 0x0f, 0x0e, 0x02, 0x0a, 0x0f, 0x05, 0x02, 0x16, 0x3e, 0x84, 0x46, 0x2f, // ..Y.........>.F/
+	0x55, 0x26, 0x09, 0x09, 0x01, 0xee, 0x01, 0x0f, 0xc3, 0xfe, 0xf3, 0xc1, 0x01, 0x75, 0x02, 0x02, // U&...........u..
+	0x06, 0x04, 0x0e, 0x0a, 0xfe, 0x98, 0x09, 0x12, 0x09, 0x08, 0x0a, 0x03, 0xda, 0x83, 0x50, 0x22, // ..............P"
+	0x01, 0x67, 0x0a, 0x84, 0x6c, 0x08, 0x2e, 0xda, 0xcf, 0x05, 0x0e, 0x07, 0x78, 0x11, 0x01, 0x03, // .g..l.......x...
+	0x05, 0x0f, 0x15, 0x05, 0x07, 0x24, 0x09, 0x14, 0x0b, 0x02, 0x07, 0x07, 0x20, 0x01, 0x0a, 0x07, // .....$...... ...
+	0x02, 0x06, 0x0e, 0x08, 0x02, 0xf7, 0x0b, 0x0c, 0x02, 0x09, 0x09, 0x03, 0x32, 0x1c, 0x0e, 0x0d, // ............2...
+	0x08, 0x24, 0x1b, 0x04, 0x0c, 0x07, 0x41, 0x0f, 0x03, 0x24, 0x0c, 0xff, 0xc6, 0x03, 0xf4, 0x56, // .$....A..$.....V
+	0x53, 0x04, 0x24, 0x4d, 0x00, 0x52, 0x00, 0x00, 0x18, 0x4d, 0x10, 0x05, 0x4b, 0x07, 0x03, 0x51, // S.$M.R...M..K..Q
+	0xb2, 0x03, 0x23, 0x37, 0x07, 0x23, 0x07, 0x6b, 0x0b, 0x04, 0x24, 0x26, 0x36, 0x3f, 0x01, 0x27, // ..#7.#.k..$&6?.'
+	0x4a, 0x5b, 0x04, 0x53, 0x6b, 0x06, 0x20, 0x37, 0x57, 0xd2, 0x08, 0x63, 0xfb, 0x03, 0x20, 0x17, // J[.Sk. 7W..c.. .
+	0x67, 0x8e, 0x05, 0x21, 0x07, 0x03, 0x4a, 0x8a, 0x03, 0x20, 0x25, 0x73, 0xa9, 0x05, 0x60, 0xe1, // g..!..J.. %s..`.
+	0x03, 0x20, 0x17, 0x41, 0x5d, 0x03, 0x2a, 0x02, 0xab, 0x01, 0x05, 0x0f, 0x0a, 0x02, 0x0f, 0x0f, // . .A].*.........
+	0x01, 0x59, 0x82, 0xfe, 0x27, 0x02, 0x18, 0x03, 0xf7, 0x03, 0x08, 0x10, 0x06, 0x83, 0xf1, 0x24, // .Y..'..........$
+	0x1a, 0x78, 0x1b, 0x30, 0x16, 0x18, 0x58, 0x13, 0x05, 0x34, 0x49, 0x05, 0x04, 0x01, 0x01, 0x09, // .x.0..X..4I.....
+	0x09, 0x26, 0x56, 0x2e, 0x46, 0x85, 0x3e, 0x17, 0xfd, 0xd7, 0x0a, 0x12, 0x0a, 0x03, 0x2b, 0x4f, // .&V.F.>.......+O
+	0x3c, 0x03, 0x2c, 0x02, 0x02, 0x61, 0x03, 0x0b, 0x08, 0x23, 0xfc, 0xd3, 0x09, 0x0f, 0x05, 0x04, // <.,..a...#......
+	0x83, 0x0c, 0x32, 0x0a, 0x08, 0x39, 0x48, 0x02, 0xd3, 0x47, 0xfd, 0x2e, 0x03, 0xa5, 0x03, 0x09, // ..2..9H..G......
+	0x09, 0x02, 0x0c, 0x0b, 0xf7, 0x03, 0x82, 0x42, 0x2c, 0x03, 0x13, 0x20, 0x07, 0x07, 0x03, 0x0a, // .......B,.. ....
+	0x14, 0x09, 0x25, 0x07, 0x06, 0x14, 0x84, 0x29, 0x35, 0x08, 0x06, 0x78, 0x08, 0x0d, 0x06, 0x07, // ..%....)5..x....
+	0x0b, 0x04, 0x1c, 0x23, 0x09, 0x0d, 0x0f, 0x1c, 0x33, 0xfe, 0xb7, 0x06, 0x03, 0x03, 0xd9, 0x82, // ...#....3.......
+	0x4b, 0x24, 0x08, 0x12, 0x09, 0xfe, 0x96, 0x82, 0x5a, 0x34, 0x04, 0xd8, 0x03, 0x0b, 0x09, 0x08, // K$......Z4......
+	0x12, 0x0a, 0x01, 0x67, 0x0a, 0x0e, 0x04, 0x60, 0xfe, 0xf1, 0xc1, 0x01, 0x0f, 0xc1, 0x00, 0x50, // ...g...`.......P
+	0xb7, 0x06, 0x42, 0x97, 0x05, 0x26, 0x1c, 0x00, 0x29, 0x00, 0x42, 0x00, 0x5b, 0x45, 0x61, 0x0e, // ..B..&..).B.[Ea.
+	0x42, 0x99, 0x0f, 0x22, 0x05, 0x23, 0x15, 0x6a, 0xdf, 0x06, 0x23, 0x35, 0x23, 0x35, 0x05, 0x55, // B..".#.j..#5#5.U
+	0xd1, 0x17, 0x20, 0x23, 0x97, 0x18, 0x22, 0x03, 0xc7, 0x0a, 0x44, 0xd2, 0x08, 0x42, 0xd3, 0x0d, // .. #.."...D..B..
+	0x22, 0xfd, 0x55, 0x65, 0x82, 0x00, 0x23, 0x64, 0x64, 0x02, 0x83, 0x5b, 0x97, 0x04, 0x23, 0x12, // ".Ue..#dd..[..#.
+	0x0a, 0x0b, 0x12, 0x44, 0x80, 0x05, 0x25, 0x12, 0x0b, 0x0a, 0x12, 0x08, 0xb1, 0x93, 0x14, 0x21, // ...D..%........!
+	0x02, 0xbd, 0x84, 0x13, 0x42, 0xff, 0x12, 0x21, 0x65, 0x64, 0x84, 0x4c, 0x23, 0xbb, 0x07, 0x11, // ....B..!ed.L#...
+	0x0b, 0x89, 0x6f, 0x21, 0x0b, 0x11, 0x85, 0x09, 0x92, 0x13, 0x41, 0x07, 0x05, 0x2c, 0x6b, 0x03, // ..o!......A..,k.
+	0xfa, 0x03, 0x15, 0x00, 0x2b, 0x00, 0x38, 0x00, 0x51, 0x00, 0x6a, 0x42, 0x1d, 0x03, 0x20, 0x35, // ....+.8.Q.jB.. 5
+	0x54, 0x64, 0x08, 0x41, 0x12, 0x1b, 0x47, 0x32, 0x03, 0x20, 0x03, 0x41, 0x16, 0x0c, 0x53, 0x98, // Td.A..G2. .A..S.
+	0x17, 0x95, 0x15, 0x5f, 0x5e, 0x03, 0x22, 0xdb, 0x0c, 0x19, 0x84, 0x94, 0x46, 0x22, 0x03, 0x41, // ..._^.".....F".A
+	0x1f, 0x13, 0x24, 0x01, 0x94, 0x07, 0x07, 0xbf, 0x41, 0x20, 0x06, 0x20, 0x5f, 0x41, 0x04, 0x0c, // ..$.....A . _A..
+	0x41, 0x18, 0x06, 0x20, 0xd5, 0x90, 0x11, 0x82, 0x25, 0x24, 0x03, 0x06, 0x09, 0x06, 0x07, 0x83, // A.. ....%$......
+	0x4a, 0x20, 0x7f, 0x84, 0x05, 0x21, 0xfe, 0x6b, 0x45, 0xd4, 0x09, 0x82, 0x68, 0x20, 0x13, 0x82, // J ...!.kE...h ..
+	0x14, 0x25, 0x7d, 0x0b, 0x13, 0x07, 0xfe, 0xf9, 0x41, 0x2d, 0x05, 0x45, 0xc5, 0x03, 0x20, 0x11, // .%}.....A-.E.. .
+	0x41, 0x61, 0x04, 0x46, 0x05, 0x03, 0x82, 0x4a, 0x75, 0xe4, 0x03, 0x20, 0x0f, 0x8f, 0x12, 0x46, // Aa.F...Ju.. ...F
+	0x20, 0x03, 0x23, 0x00, 0x00, 0x00, 0x05, 0x43, 0x4b, 0x08, 0x26, 0x14, 0x00, 0x29, 0x00, 0x36, //  .#....CK.&..).6
+	0x00, 0x69, 0x6a, 0xd3, 0x03, 0x20, 0x25, 0x43, 0x24, 0x03, 0x4b, 0xa7, 0x05, 0x5b, 0x2a, 0x03, // .ij.. %C$.K..[*.
+	0x44, 0x67, 0x04, 0x21, 0x37, 0x37, 0x8d, 0x0e, 0x85, 0x22, 0x21, 0x25, 0x27, 0x18, 0x54, 0xba, // Dg.!77..."!%'.T.
+	0x04, 0x25, 0x17, 0x37, 0x27, 0x37, 0x27, 0x07, 0x18, 0x52, 0x78, 0x05, 0x43, 0x82, 0x27, 0x4d, // .%.7'7'..Rx.C.'M
+	0xd0, 0x04, 0x20, 0x01, 0x43, 0x7f, 0x12, 0x43, 0x99, 0x06, 0x30, 0x02, 0xcc, 0x09, 0x0a, 0x02, // .. .C..C..0.....
+	0x03, 0x03, 0x04, 0x05, 0x0e, 0x09, 0x24, 0x09, 0x0a, 0x01, 0x03, 0x01, 0x44, 0x91, 0x03, 0x26, // ......$.....D..&
+	0x24, 0xae, 0x04, 0x0e, 0x0a, 0x24, 0x08, 0x82, 0x18, 0x21, 0x02, 0x05, 0x83, 0x09, 0x83, 0x22, // $....$...!....."
+	0x37, 0x02, 0x06, 0xfd, 0x6e, 0x5a, 0x1a, 0x5a, 0x16, 0x59, 0x18, 0x59, 0x18, 0x58, 0x18, 0x5b, // 7...nZ.Z.Y.Y.X.[
+	0x17, 0x01, 0xe2, 0x02, 0x0e, 0x10, 0x01, 0x58, 0x03, 0x43, 0xb6, 0x26, 0x43, 0xe7, 0x03, 0x21, // .......X.C.&C..!
+	0x01, 0x25, 0x43, 0xb2, 0x13, 0x43, 0xce, 0x07, 0x20, 0xbc, 0x82, 0x69, 0x24, 0x08, 0x12, 0x09, // .%C..C.. ..i$...
+	0x08, 0x0b, 0x82, 0x8c, 0x23, 0x0f, 0x09, 0x0a, 0x11, 0x44, 0xb4, 0x03, 0x21, 0x05, 0x16, 0x82, // ....#....D..!...
+	0x48, 0x83, 0x91, 0x84, 0x0e, 0x20, 0x03, 0x44, 0xdc, 0x03, 0x24, 0x08, 0x12, 0x0a, 0xbe, 0x1a, // H.... .D..$.....
+	0x82, 0x88, 0x23, 0x17, 0x5a, 0x19, 0x5a, 0x82, 0x86, 0x22, 0x5a, 0x02, 0x2a, 0x43, 0xe7, 0x29, // ..#.Z.Z.."Z.*C.)
+	0x24, 0x03, 0x09, 0x09, 0xfd, 0xb9, 0x43, 0xe3, 0x14, 0x43, 0xff, 0x06, 0x43, 0xe3, 0x03, 0x20, // $.....C..C..C.. 
+	0x05, 0x46, 0x07, 0x08, 0x41, 0xab, 0x05, 0x22, 0x51, 0x00, 0x85, 0x61, 0xdd, 0x06, 0x41, 0x61, // .F..A.."Q..a..Aa
+	0x04, 0x50, 0x08, 0x04, 0x79, 0x60, 0x05, 0x78, 0x67, 0x05, 0x8e, 0x17, 0x21, 0x05, 0x07, 0x41, // .P..y`.xg...!..A
+	0xac, 0x0a, 0x20, 0x01, 0x46, 0x3a, 0x16, 0x22, 0x36, 0x16, 0x17, 0x46, 0x3d, 0x32, 0x24, 0x7e, // .. .F:."6..F=2$~
+	0x02, 0x0b, 0x09, 0x23, 0x41, 0x38, 0x05, 0x23, 0x03, 0x0b, 0x07, 0x25, 0x45, 0x02, 0x04, 0x24, // ...#A8.#...%E..$
+	0x03, 0xa2, 0x05, 0x03, 0x03, 0x8c, 0x17, 0x20, 0x24, 0x82, 0xce, 0x29, 0xfe, 0xa6, 0x58, 0x19, // ....... $..)..X.
+	0x5a, 0x19, 0x5b, 0x17, 0x5b, 0x19, 0x41, 0xae, 0x03, 0x21, 0x01, 0xfa, 0x46, 0x6c, 0x18, 0x23, // Z.[.[.A..!..Fl.#
+	0x09, 0x12, 0x08, 0x4d, 0x46, 0x6f, 0x31, 0x21, 0x01, 0x7c, 0x41, 0x3f, 0x03, 0x25, 0x02, 0x0b, // ...MFo1!.|A?.%..
+	0x08, 0x09, 0x11, 0x09, 0x41, 0x3c, 0x04, 0x41, 0x48, 0x03, 0x24, 0x09, 0x4e, 0x08, 0x11, 0x0a, // ....A<.AH.$.N...
+	0x84, 0x93, 0x8a, 0x17, 0x27, 0x08, 0x0a, 0x17, 0x59, 0x18, 0x5a, 0x17, 0x5a, 0x85, 0x05, 0x21, // ....'...Y.Z.Z..!
+	0x01, 0x39, 0x46, 0x9d, 0x18, 0x23, 0x02, 0x02, 0x06, 0xd5, 0x46, 0xa0, 0x2d, 0x2a, 0x05, 0x00, // .9F..#....F.-*..
+	0x08, 0xff, 0xed, 0x03, 0xfa, 0x03, 0x93, 0x00, 0x0c, 0x57, 0x25, 0x04, 0x25, 0x5a, 0x00, 0x6d, // .........W%.%Z.m
+	0x00, 0x00, 0x01, 0x41, 0x7d, 0x10, 0x21, 0x0f, 0x01, 0x47, 0xb4, 0x0d, 0x43, 0x2b, 0x04, 0x20, // ...A}.!..G..C+. 
+	0x37, 0x41, 0xad, 0x04, 0x22, 0x25, 0x17, 0x13, 0x54, 0xd0, 0x08, 0x6b, 0x65, 0x03, 0x60, 0x83, // 7A.."%..T..ke.`.
+	0x08, 0x20, 0x1f, 0x7e, 0x18, 0x03, 0x20, 0x1f, 0x6e, 0x2e, 0x04, 0x51, 0x44, 0x05, 0x41, 0xdf, // . .~.. .n..QD.A.
+	0x03, 0x41, 0xed, 0x11, 0x08, 0x2d, 0x37, 0x01, 0x50, 0x4e, 0x14, 0x50, 0x14, 0x4f, 0x15, 0x50, // .A...-7.PN.P.O.P
+	0x15, 0x50, 0x16, 0x4f, 0x16, 0x01, 0xc0, 0x07, 0x0a, 0x02, 0x56, 0x04, 0x19, 0xfd, 0x33, 0x1e, // .P.O......V...3.
+	0x08, 0x09, 0x02, 0x56, 0x02, 0x02, 0x03, 0x05, 0x0d, 0x08, 0x01, 0x3e, 0x1a, 0x03, 0x02, 0x05, // ...V.......>....
+	0x06, 0x01, 0x14, 0x1f, 0x82, 0x1c, 0x2d, 0x1b, 0x01, 0x3e, 0x1f, 0xea, 0x08, 0x12, 0x32, 0x12, // ......-..>....2.
+	0x04, 0x04, 0x32, 0x12, 0x07, 0x54, 0xf9, 0x03, 0x2d, 0x05, 0x7e, 0x05, 0x09, 0x04, 0x08, 0xfe, // ..2..T..-.~.....
+	0xc9, 0x02, 0x09, 0x08, 0x1f, 0x19, 0x04, 0x82, 0x05, 0x32, 0x08, 0x10, 0x07, 0x09, 0x0d, 0x04, // .........2......
+	0x03, 0x02, 0x02, 0x41, 0x05, 0x02, 0x02, 0x02, 0x0a, 0x08, 0x20, 0x08, 0x0c, 0x83, 0x0d, 0x08, // ...A...... .....
+	0x25, 0x01, 0x0a, 0x08, 0x1e, 0x19, 0x02, 0x51, 0x16, 0x4f, 0x15, 0x4e, 0x15, 0x4f, 0x16, 0x50, // %......Q.O.N.O.P
+	0x14, 0x50, 0x15, 0x4f, 0x01, 0x12, 0x04, 0x0c, 0x08, 0xfe, 0xc4, 0x20, 0x13, 0xbd, 0x04, 0x03, // .P.O....... ....
+	0x0c, 0x09, 0x01, 0x3a, 0x09, 0x11, 0x07, 0x82, 0x62, 0x25, 0x55, 0x62, 0x09, 0x0f, 0x07, 0x0a, // ...:....b%Ub....
+	0x6b, 0xf1, 0x03, 0x30, 0x0d, 0x08, 0x63, 0x55, 0x04, 0xfe, 0x05, 0xfe, 0x9e, 0x11, 0x08, 0x08, // k..0..cU........
+	0x03, 0x09, 0x05, 0x01, 0x16, 0x82, 0x78, 0x82, 0x6c, 0x5f, 0x50, 0x03, 0x22, 0x12, 0x01, 0x1f, // ......x.l_P."...
+	0x82, 0x56, 0x21, 0x04, 0x12, 0x83, 0x5c, 0x29, 0x05, 0x03, 0x02, 0x03, 0x0a, 0x07, 0x08, 0x10, // .V!....)........
+	0x08, 0x2f, 0x82, 0x03, 0x83, 0x0f, 0x82, 0x74, 0x27, 0x07, 0x0f, 0x09, 0x08, 0x0c, 0x05, 0x04, // ./.....t'.......
+	0x13, 0x41, 0x63, 0x04, 0x2e, 0xe1, 0x03, 0xfa, 0x03, 0x9f, 0x00, 0x34, 0x00, 0x47, 0x00, 0x5e, // .Ac........4.G.^
+	0x00, 0x80, 0x00, 0x8d, 0x5d, 0xbf, 0x04, 0x6b, 0xd0, 0x06, 0x5a, 0x5b, 0x08, 0x87, 0x0b, 0x4b, // ....]..k..Z[...K
+	0x46, 0x0b, 0x18, 0x51, 0xe2, 0x0d, 0x21, 0x27, 0x37, 0x41, 0x3e, 0x11, 0x41, 0x5a, 0x08, 0x43, // F..Q..!'7A>.AZ.C
+	0x52, 0x09, 0x23, 0x2e, 0x01, 0x27, 0x25, 0x41, 0x9c, 0x07, 0x41, 0xbd, 0x18, 0x20, 0x03, 0x45, // R.#..'%A..A.. .E
+	0x0e, 0x0b, 0x25, 0x02, 0xfe, 0x04, 0x09, 0x05, 0xd0, 0x41, 0x45, 0x03, 0x20, 0x08, 0x82, 0x08, // ..%......AE. ...
+	0x21, 0x82, 0x82, 0x87, 0x09, 0x83, 0x12, 0x84, 0x00, 0x86, 0x14, 0x83, 0x00, 0x21, 0x85, 0x1a, // !............!..
+	0x41, 0x4b, 0x03, 0x22, 0x0b, 0x08, 0x21, 0x83, 0xfd, 0x41, 0x5e, 0x03, 0x25, 0x07, 0x20, 0x9a, // AK."..!..A^.%. .
+	0x09, 0x10, 0x08, 0x41, 0x70, 0x05, 0x25, 0x02, 0x09, 0x08, 0x21, 0x07, 0x0d, 0x43, 0x44, 0x03, // ...Ap.%...!..CD.
+	0x82, 0x09, 0x29, 0xfe, 0x47, 0x15, 0x20, 0x07, 0x0a, 0x03, 0x1b, 0x01, 0x47, 0x41, 0xb7, 0x03, // ..).G. .....GA..
+	0x24, 0x58, 0x04, 0x1a, 0xfd, 0x21, 0x84, 0x08, 0x28, 0x02, 0x02, 0x04, 0x04, 0x0d, 0x09, 0x01, // $X...!..(.......
+	0x46, 0x1b, 0x41, 0xd4, 0x04, 0x28, 0x52, 0x14, 0x52, 0x15, 0x52, 0x16, 0x52, 0x16, 0x51, 0x83, // F.A..(R.R.R.R.Q.
+	0x01, 0x21, 0x01, 0x78, 0x83, 0x62, 0x25, 0x12, 0xcf, 0x13, 0x03, 0x04, 0x34, 0x82, 0x07, 0x21, // .!.x.b%.....4..!
+	0x34, 0x12, 0x86, 0x7d, 0x24, 0xcf, 0x06, 0x09, 0x03, 0x04, 0x83, 0x12, 0x82, 0x0b, 0x20, 0x34, // 4..}$......... 4
+	0x82, 0x88, 0x24, 0xd1, 0x13, 0x08, 0x10, 0x09, 0x41, 0x68, 0x07, 0x84, 0x7c, 0x22, 0x04, 0x72, // ..$.....Ah..|".r
+	0x05, 0x83, 0x96, 0x20, 0x07, 0x83, 0x17, 0x24, 0x0d, 0x03, 0x04, 0x02, 0x09, 0x41, 0x8e, 0x03, // ... ...$.....A..
+	0x2a, 0x09, 0x0c, 0x04, 0xdf, 0x05, 0x05, 0x05, 0x0d, 0x08, 0x65, 0x57, 0x82, 0x72, 0x2b, 0x08, // *.........eW.r+.
+	0xfe, 0xbc, 0x20, 0x14, 0xc2, 0x04, 0x03, 0x0d, 0x08, 0x01, 0x43, 0x7c, 0x4e, 0x03, 0x25, 0x0a, // .. .......C|N.%.
+	0x02, 0x57, 0x65, 0x08, 0x10, 0x6e, 0x90, 0x03, 0x23, 0xa4, 0x51, 0x15, 0x50, 0x83, 0x7e, 0x24, // .We..n..#.Q.P.~$
+	0x14, 0x52, 0x16, 0x50, 0x16, 0x44, 0xbf, 0x05, 0x41, 0xb3, 0x07, 0x29, 0x30, 0x00, 0x43, 0x00, // .R.P.D..A..)0.C.
+	0x58, 0x00, 0x65, 0x00, 0x89, 0x00, 0x18, 0x61, 0x29, 0x09, 0x41, 0x9c, 0x0a, 0x99, 0x0d, 0x50, // X.e....a).A....P
+	0x70, 0x05, 0x43, 0x00, 0x10, 0x45, 0x03, 0x13, 0x20, 0x05, 0x41, 0x87, 0x07, 0x41, 0x93, 0x03, // p.C..E.. .A..A..
+	0x20, 0x27, 0x43, 0x64, 0x14, 0x41, 0xc7, 0x03, 0x45, 0x01, 0x09, 0x25, 0x03, 0xf2, 0x08, 0x08, //  'Cd.A..E..%....
+	0x12, 0xd0, 0x41, 0x1c, 0x07, 0x21, 0x82, 0x82, 0x91, 0x09, 0x41, 0xb9, 0x03, 0x26, 0xfe, 0xe3, // ..A..!....A..&..
+	0x02, 0x09, 0x08, 0x20, 0x1a, 0x43, 0x11, 0x03, 0x41, 0xa0, 0x04, 0x29, 0x03, 0x04, 0x02, 0x02, // ... .C..A..)....
+	0x3d, 0x02, 0x0b, 0x08, 0x20, 0x09, 0x41, 0xb9, 0x06, 0x23, 0x08, 0x1f, 0x08, 0x0d, 0x42, 0xbb, // =... .A..#....B.
+	0x03, 0x21, 0xfd, 0xcd, 0x41, 0x7f, 0x07, 0x41, 0x8b, 0x03, 0x20, 0x5d, 0x41, 0x9f, 0x0d, 0x41, // .!..A..A.. ]A..A
+	0xc3, 0x0d, 0x22, 0x05, 0x0d, 0x08, 0x41, 0xc5, 0x06, 0x25, 0x01, 0x78, 0x12, 0xfe, 0x95, 0x12, // .."...A..%.x....
+	0x42, 0x26, 0x04, 0x41, 0x91, 0x03, 0x23, 0x04, 0x04, 0x34, 0x07, 0x83, 0x0a, 0x41, 0xa8, 0x05, // B&.A..#..4...A..
+	0x89, 0x15, 0x23, 0x04, 0x04, 0x01, 0x14, 0x41, 0x90, 0x03, 0x20, 0x12, 0x83, 0x75, 0x41, 0xa2, // ..#....A.. ..uA.
+	0x08, 0x20, 0x0f, 0x41, 0xbb, 0x0d, 0x20, 0x02, 0x43, 0x3c, 0x03, 0x21, 0x09, 0x69, 0x41, 0x81, // . .A.. .C<.!.iA.
+	0x07, 0x41, 0x8d, 0x03, 0x20, 0x66, 0x41, 0xa1, 0x07, 0x21, 0x09, 0x0f, 0x6f, 0x3f, 0x05, 0x41, // .A.. fA..!..o?.A
+	0xc4, 0x0a, 0x22, 0x08, 0x09, 0x03, 0x41, 0xc6, 0x06, 0x41, 0xab, 0x0d, 0x28, 0x12, 0x00, 0x34, // .."...A..A..(..4
+	0x00, 0x63, 0x00, 0x76, 0x00, 0x83, 0x5d, 0x13, 0x04, 0x21, 0x1f, 0x01, 0x43, 0x2e, 0x0d, 0x20, // .c.v..]..!..C.. 
+	0x13, 0x44, 0xc9, 0x21, 0x7d, 0xf2, 0x12, 0x44, 0xcf, 0x0a, 0x21, 0x15, 0x33, 0x44, 0xdd, 0x0b, // .D.!}..D..!.3D..
+	0x21, 0x11, 0x07, 0x54, 0x89, 0x03, 0x41, 0xdb, 0x0b, 0x82, 0x5f, 0x46, 0xb8, 0x0c, 0x21, 0x02, // !..T..A..._F..!.
+	0x46, 0x43, 0x1c, 0x03, 0x43, 0x2e, 0x0d, 0x20, 0xde, 0x43, 0x09, 0x1a, 0x41, 0x69, 0x08, 0x20, // FC..C.. .C..Ai. 
+	0xce, 0x41, 0x3d, 0x08, 0x20, 0x82, 0x43, 0x80, 0x09, 0x83, 0x10, 0x20, 0x08, 0x43, 0x01, 0x09, // .A=. .C.... .C..
+	0x23, 0x08, 0x08, 0xfe, 0xf6, 0x41, 0xdb, 0x0e, 0x43, 0x72, 0x03, 0x21, 0x71, 0x51, 0x43, 0x4e, // #....A..Cr.!qQCN
+	0x0a, 0x21, 0x02, 0x67, 0x41, 0x5c, 0x03, 0x43, 0x2a, 0x07, 0x21, 0x01, 0x0b, 0x41, 0x6e, 0x03, // .!.gA..C*.!..An.
+	0x24, 0x01, 0x07, 0x04, 0x0c, 0x09, 0x43, 0x08, 0x05, 0x21, 0x04, 0x0c, 0x43, 0x08, 0x0a, 0x41, // $.....C..!..C..A
+	0x66, 0x0c, 0x21, 0xfc, 0x7b, 0x42, 0x50, 0x07, 0x21, 0x03, 0x04, 0x44, 0x06, 0x0a, 0x20, 0x12, // f.!.{BP.!..D.. .
+	0x44, 0x04, 0x08, 0x41, 0xfa, 0x03, 0x21, 0x02, 0x8b, 0x41, 0xd4, 0x0e, 0x24, 0x08, 0x0d, 0x03, // D..A..!..A..$...
+	0x20, 0x16, 0x43, 0x49, 0x0a, 0x58, 0xdf, 0x04, 0x24, 0x4e, 0xff, 0xc6, 0x03, 0xb2, 0x63, 0x53, //  .CI.X..$N....cS
+	0x05, 0x21, 0x17, 0x35, 0x4f, 0x59, 0x07, 0x5e, 0x1e, 0x12, 0x5e, 0x40, 0x06, 0x50, 0x52, 0x07, // .!.5OY.^..^@.PR.
+	0x18, 0x4c, 0x87, 0x06, 0x2b, 0x4e, 0x0c, 0x0d, 0x0d, 0x1f, 0x12, 0x01, 0x03, 0x12, 0x22, 0x10, // .L..+N........".
+	0x1f, 0x82, 0x00, 0x25, 0x20, 0x4e, 0x2d, 0x2c, 0x4d, 0x20, 0x83, 0x00, 0x32, 0x0f, 0x22, 0x12, // ...% N-,M ..2.".
+	0x01, 0x06, 0x12, 0x1e, 0x0d, 0x0d, 0x0d, 0x09, 0x14, 0xfc, 0xd6, 0x14, 0x05, 0x04, 0x1d, 0xc5, // ................
+	0x82, 0x0d, 0x29, 0x01, 0x0d, 0x0d, 0x01, 0x19, 0x08, 0x17, 0x0f, 0x20, 0x4d, 0x87, 0x27, 0x2a, // ..)........ M.'*
+	0x20, 0x4d, 0x2c, 0x2d, 0x4d, 0x20, 0x0f, 0x17, 0x08, 0xfe, 0xe7, 0x82, 0x2b, 0x28, 0x1e, 0x11, //  M,-M ......+(..
+	0xc7, 0x14, 0x09, 0x09, 0x04, 0x0a, 0x06, 0x53, 0x53, 0x0d, 0x25, 0x04, 0x00, 0x33, 0x00, 0x00, // .......SS.%..3..
+	0x25, 0x5d, 0x36, 0x03, 0x7f, 0xff, 0x05, 0x21, 0x23, 0x15, 0x4b, 0x7d, 0x07, 0x20, 0x21, 0x4b, // %]6....!#.K}. !K
+	0x71, 0x08, 0x42, 0x0e, 0x0f, 0x84, 0xa5, 0x29, 0x03, 0x7b, 0x7e, 0x7e, 0x7e, 0x13, 0x13, 0x12, // q.B....).{~~~...
+	0x2d, 0x1a, 0x18, 0x5b, 0x98, 0x06, 0x21, 0xfc, 0x0c, 0x67, 0x45, 0x05, 0x22, 0x3c, 0x1b, 0x2d, // -..[..!..gE."<.-
+	0x18, 0x61, 0x22, 0x04, 0x23, 0x13, 0x2d, 0x1a, 0xfc, 0x6b, 0x9b, 0x04, 0x24, 0xc3, 0x7e, 0x7e, // .a".#.-..k..$.~~
+	0x01, 0xfa, 0x5f, 0xdc, 0x04, 0x20, 0xfc, 0x52, 0xa1, 0x05, 0x20, 0xc4, 0x18, 0x5b, 0xa3, 0x06, // .._.. .R.. ..[..
+	0x20, 0xfc, 0x5f, 0xde, 0x04, 0x20, 0x7e, 0x84, 0x24, 0x82, 0x00, 0x23, 0x2d, 0x19, 0x7e, 0x00, //  ._.. ~.$..#-.~.
+	0x41, 0x37, 0x0a, 0x22, 0xaa, 0x00, 0x30, 0x47, 0x8f, 0x03, 0x21, 0x13, 0x33, 0x41, 0x16, 0x0c, // A7."..0G..!.3A..
+	0x18, 0x58, 0x00, 0x07, 0x22, 0x33, 0x21, 0x03, 0x58, 0xa4, 0x05, 0x20, 0x26, 0x5c, 0x2e, 0x07, // .X.."3!.X.. &...
+	0x59, 0x51, 0x05, 0x24, 0x02, 0x48, 0x34, 0x51, 0xf6, 0x41, 0x1c, 0x0b, 0x41, 0x45, 0x05, 0x3b, // YQ.$.H4Q.A..AE.;
+	0x0d, 0x46, 0x13, 0x27, 0x14, 0x26, 0x32, 0x0c, 0x0b, 0x0a, 0x16, 0x18, 0x43, 0x2b, 0x2c, 0x51, // .F.'.&2.....C+,Q
+	0x27, 0x27, 0x32, 0x0c, 0x0c, 0x0b, 0x17, 0x02, 0x6d, 0x3e, 0xfe, 0xd1, 0x41, 0x1c, 0x09, 0x25, // ''2.....m>..A..%
+	0x0b, 0x05, 0xc5, 0x12, 0x1f, 0x0c, 0x41, 0x49, 0x03, 0x29, 0x02, 0x03, 0x0d, 0x0b, 0x17, 0x42, // ......AI.).....B
+	0x2b, 0x2b, 0x52, 0x28, 0x84, 0x34, 0x26, 0x15, 0x18, 0x41, 0x2b, 0x2b, 0x53, 0x27, 0x8a, 0x9b, // ++R(.4&..A++S'..
+	0x20, 0x34, 0x46, 0xc7, 0x04, 0x49, 0x59, 0x05, 0x59, 0x19, 0x06, 0x20, 0x03, 0x18, 0x49, 0xd5, //  4F..IY.Y.. ..I.
+	0x08, 0x4c, 0xb5, 0x03, 0x8a, 0xab, 0x23, 0x3b, 0x01, 0x13, 0x2e, 0x18, 0x42, 0x61, 0x07, 0x33, // .L....#;....Ba.3
+	0x02, 0x01, 0x28, 0x53, 0x2c, 0x2b, 0x42, 0x16, 0x18, 0x0b, 0x0b, 0x0c, 0x33, 0x28, 0x12, 0x26, // ..(S,+B.....3(.&
+	0x13, 0x44, 0x01, 0x0e, 0x85, 0xae, 0x22, 0x04, 0x0a, 0x06, 0x85, 0xb0, 0x08, 0x21, 0x0c, 0x0e, // .D...."......!..
+	0x1f, 0x12, 0xf3, 0x51, 0x10, 0x1c, 0x0b, 0x15, 0x0a, 0x0c, 0x0c, 0x31, 0x25, 0x03, 0x96, 0x15, // ...Q.......1%...
+	0x0a, 0x0b, 0x0c, 0x32, 0x26, 0x28, 0x52, 0x2b, 0x2b, 0x42, 0x17, 0x0a, 0x0e, 0x03, 0xfe, 0xfe, // ...2&(R++B......
+	0x86, 0xb1, 0x21, 0x04, 0x05, 0x8b, 0xb2, 0x29, 0x2f, 0x0c, 0x1f, 0x13, 0x27, 0x52, 0x2c, 0x2b, // ..!....)/...'R,+
+	0x41, 0x18, 0x4f, 0x7b, 0x03, 0x20, 0x69, 0x82, 0xa7, 0x20, 0x97, 0x4a, 0x83, 0x04, 0x4f, 0x7d, // A.O{. i.. .J..O}
+	0x03, 0x23, 0x00, 0x13, 0x33, 0x15, 0x84, 0xaa, 0x24, 0x37, 0x16, 0x36, 0x37, 0x07, 0x5a, 0x67, // .#..3...$7.67.Zg
+	0x03, 0x24, 0x33, 0x11, 0x21, 0x11, 0x03, 0x51, 0x88, 0x0a, 0x20, 0x23, 0x6a, 0x6c, 0x10, 0x20, // .$3.!..Q.. #jl. 
+	0x05, 0x42, 0x9f, 0x07, 0x52, 0xe4, 0x07, 0x42, 0x06, 0x09, 0x26, 0xc0, 0x90, 0x01, 0x18, 0x17, // .B..R..B..&.....
+	0x1a, 0x3f, 0x5f, 0x93, 0x03, 0x26, 0x03, 0x19, 0x19, 0x93, 0xfd, 0x80, 0x47, 0x61, 0x54, 0x03, // .?_..&......GaT.
+	0x20, 0xba, 0x18, 0x45, 0x3a, 0x04, 0x32, 0x02, 0x3b, 0x3c, 0x3b, 0x8f, 0x54, 0x01, 0x55, 0x90, //  ..E:.2.;<;.T.U.
+	0x3b, 0x3b, 0x3b, 0x08, 0x08, 0x01, 0x47, 0x0d, 0x1f, 0x13, 0x84, 0xdf, 0x83, 0xb3, 0x23, 0x12, // ;;;...G.......#.
+	0x13, 0x1f, 0x0d, 0x51, 0xc2, 0x03, 0x36, 0x02, 0x44, 0x6d, 0x24, 0x3f, 0x1a, 0x1e, 0x1d, 0x01, // ...Q..6.Dm$?....
+	0x01, 0x1e, 0x1f, 0x05, 0x1b, 0x40, 0x25, 0x6d, 0x01, 0x1e, 0xfe, 0xe2, 0x01, 0x64, 0x54, 0x8c, // .....@%m.....dT.
+	0x04, 0x27, 0x14, 0x0c, 0xfd, 0xdd, 0x55, 0x8f, 0x3a, 0x3c, 0x82, 0x00, 0x28, 0x3a, 0x90, 0x54, // .'....U.:<..(:.T
+	0x02, 0x22, 0x0c, 0x15, 0x09, 0xb5, 0x51, 0xea, 0x04, 0x23, 0x22, 0x13, 0xd9, 0x13, 0x18, 0x62, // ."....Q..#"....b
+	0xb0, 0x05, 0x86, 0x0a, 0x4f, 0x4f, 0x04, 0x87, 0xe7, 0x26, 0x1c, 0x00, 0x3a, 0x00, 0x45, 0x00, // ....OO...&..:.E.
+	0x51, 0x4b, 0x69, 0x04, 0x4f, 0x06, 0x05, 0x20, 0x0f, 0x4d, 0xfd, 0x0c, 0x20, 0x3d, 0x48, 0x1b, // QKi.O.. .M.. =H.
+	0x05, 0x92, 0xe7, 0x41, 0x04, 0x09, 0x20, 0x01, 0x18, 0x5c, 0x38, 0x07, 0x21, 0x11, 0x33, 0x4e, // ...A.. ...8.!.3N
+	0x83, 0x04, 0x20, 0x27, 0x7a, 0xc4, 0x04, 0x22, 0x11, 0x02, 0x3c, 0x85, 0xb9, 0x23, 0x08, 0x0a, // .. 'z.."..<..#..
+	0x02, 0x05, 0x82, 0xbe, 0x22, 0x1f, 0x12, 0x13, 0x83, 0xcf, 0x25, 0x03, 0x04, 0x0b, 0x08, 0x01, // ....".....%.....
+	0x5b, 0x8d, 0xed, 0x41, 0x05, 0x09, 0x31, 0xfd, 0xb9, 0x01, 0x18, 0x17, 0x19, 0x3b, 0x23, 0xfe, // [..A..1......;#.
+	0xc9, 0x90, 0x01, 0xf0, 0xfe, 0xc6, 0x23, 0x3d, 0x18, 0x41, 0x28, 0x03, 0x22, 0x02, 0xf1, 0x0e, // ......#=.A(."...
+	0x82, 0x00, 0x23, 0x09, 0x13, 0x0b, 0x1a, 0x8b, 0xca, 0x24, 0x1a, 0x0b, 0x13, 0x09, 0x8e, 0x90, // ..#......$......
+	0xf4, 0x41, 0x0c, 0x06, 0x34, 0xfe, 0xc5, 0x6c, 0x23, 0x3d, 0x1a, 0x1b, 0x1d, 0xfe, 0xe2, 0x01, // .A..4..l#=......
+	0x1e, 0x1d, 0x1d, 0x05, 0x1a, 0x3f, 0x24, 0x6c, 0x01, 0x1e, 0x41, 0xdf, 0x0a, 0x24, 0x1a, 0x00, // .....?$l..A..$..
+	0x26, 0x00, 0x44, 0x69, 0xbb, 0x06, 0x8d, 0xef, 0x20, 0x2f, 0x41, 0x09, 0x06, 0x20, 0x37, 0x85, // &.Di.... /A.. 7.
+	0xc5, 0x84, 0xd0, 0x20, 0x25, 0x41, 0xea, 0x15, 0x60, 0x7b, 0x07, 0x20, 0xc0, 0x8e, 0xe2, 0x27, // ... %A..`{. ...'
+	0x18, 0x0c, 0x1e, 0x13, 0x12, 0x1f, 0x0d, 0xbb, 0x82, 0xba, 0x85, 0xc3, 0x21, 0x01, 0x0a, 0x41, // ............!..A
+	0xe0, 0x0f, 0x87, 0xf2, 0x21, 0x02, 0xf1, 0x90, 0xd6, 0x20, 0x27, 0x83, 0xec, 0x20, 0x3c, 0x85, // ....!.... '.. <.
+	0xb1, 0x82, 0xba, 0x20, 0x7b, 0x41, 0xda, 0x13, 0x83, 0x00, 0x20, 0x00, 0x42, 0xaf, 0x0b, 0x24, // ... {A.... .B..$
+	0x0a, 0x00, 0x28, 0x00, 0x43, 0x61, 0xcd, 0x04, 0x41, 0x8b, 0x07, 0x20, 0x01, 0x9c, 0xb3, 0x21, // ..(.Ca..A.. ...!
+	0x05, 0x07, 0x95, 0xf5, 0x22, 0x0e, 0x01, 0x07, 0x42, 0xa5, 0x04, 0x41, 0x83, 0x04, 0x21, 0x02, // ...."...B..A..!.
+	0xc5, 0x97, 0xb6, 0x21, 0xfe, 0x27, 0x92, 0xef, 0x24, 0x08, 0x0a, 0x02, 0x02, 0x44, 0x41, 0x76, // ...!.'..$....DAv
+	0x08, 0x20, 0x64, 0x97, 0xb7, 0x20, 0xde, 0x92, 0xee, 0x22, 0x09, 0x13, 0x0b, 0x45, 0x5f, 0x0d, // . d.. ..."...E_.
+	0x22, 0x28, 0x00, 0x2f, 0x47, 0x91, 0x03, 0x5b, 0x2b, 0x16, 0x5b, 0x47, 0x03, 0x28, 0x05, 0x15, // "(./G..[+.[G.(..
+	0x33, 0x11, 0x33, 0x11, 0x23, 0x03, 0x65, 0x66, 0xf4, 0x23, 0x26, 0xfe, 0x3c, 0x4a, 0x54, 0x9e, // 3.3.#.ef.#&.<JT.
+	0x03, 0x27, 0x5a, 0xe0, 0x1c, 0x18, 0x58, 0x42, 0x06, 0x25, 0x9a, 0x4d, 0xfe, 0xb3, 0x01, 0x9a, // .'Z...XB.%.M....
+	0x8d, 0x8b, 0x5a, 0x33, 0x03, 0x98, 0x88, 0x82, 0xa4, 0x20, 0x25, 0x62, 0xe3, 0x09, 0x69, 0xe0, // ..Z3..... %b..i.
+	0x08, 0x24, 0x02, 0x15, 0x21, 0x35, 0x23, 0x5c, 0x14, 0x09, 0x22, 0x23, 0x03, 0xfa, 0x9f, 0xa4, // .$..!5#..."#....
+	0x83, 0x93, 0x2e, 0xfe, 0x09, 0x1c, 0x30, 0x13, 0x12, 0x22, 0x10, 0x4f, 0x13, 0x26, 0x15, 0x0c, // ......0..".O.&..
+	0x13, 0x07, 0x58, 0xa5, 0x03, 0x2f, 0x37, 0x80, 0x01, 0x32, 0xac, 0x4f, 0x41, 0x08, 0x08, 0x16, // ..X../7..2.OA...
+	0x15, 0x15, 0x31, 0x1c, 0x01, 0xc0, 0x5b, 0xfe, 0x23, 0x28, 0xdd, 0x0c, 0x0b, 0x0d, 0x24, 0x18, // ..1...[.#(....$.
+	0x2e, 0x1e, 0x1e, 0x52, 0x49, 0x04, 0x2e, 0x0b, 0x17, 0x0b, 0x3e, 0x83, 0x47, 0x57, 0x50, 0x4e, // ...RI.....>.GWPN
+	0x10, 0x20, 0x10, 0x1f, 0x31, 0x11, 0x18, 0x67, 0x5e, 0x04, 0x8a, 0xdf, 0x22, 0x27, 0x00, 0x50, // . ..1..g^..."'.P
+	0x82, 0xdf, 0x66, 0x89, 0x03, 0x63, 0x8a, 0x08, 0x44, 0xb9, 0x08, 0x20, 0x07, 0x52, 0x06, 0x0d, // ..f..c..D.. .R..
+	0x22, 0x27, 0x37, 0x37, 0x41, 0x93, 0x1b, 0x08, 0x23, 0x02, 0x89, 0xfe, 0xf2, 0x8b, 0x55, 0x3a, // "'77A...#.....U:
+	0x14, 0x1f, 0x0b, 0x0a, 0x0b, 0x09, 0x09, 0x0a, 0x19, 0x0f, 0x18, 0x37, 0x20, 0x29, 0x26, 0x4a, // ...........7 )&J
+	0x24, 0x25, 0x3c, 0x18, 0x17, 0x18, 0x0f, 0x0f, 0x0d, 0x29, 0x1b, 0x5a, 0xdc, 0x41, 0xae, 0x23, // $%<......).Z.A.#
+	0x26, 0x02, 0x3e, 0x40, 0x4e, 0x5b, 0x44, 0x0c, 0x82, 0xbc, 0x38, 0x13, 0x0d, 0x0d, 0x13, 0x08, // &.>@N[D...8.....
+	0x06, 0x06, 0x14, 0x13, 0x47, 0x17, 0x18, 0x12, 0x12, 0x12, 0x32, 0x20, 0x15, 0x26, 0x11, 0x10, // ....G.....2 .&..
+	0x15, 0x04, 0x5e, 0xe9, 0x5c, 0xab, 0x1f, 0x83, 0x50, 0x18, 0x41, 0x67, 0x0a, 0x22, 0x28, 0x00, // ..^.....P.Ag."(.
+	0x31, 0x18, 0x43, 0xe5, 0x04, 0x42, 0x51, 0x1c, 0x2b, 0x23, 0x03, 0x33, 0x37, 0x33, 0x17, 0x33, // 1.C..BQ.+#.373.3
+	0x03, 0x07, 0x17, 0x23, 0x37, 0x42, 0x57, 0x26, 0x2c, 0xc7, 0x58, 0xb1, 0x62, 0x26, 0xaa, 0x28, // ...#7BW&,.X.b&.(
+	0x60, 0xb1, 0x2a, 0x32, 0x68, 0x36, 0x42, 0x60, 0x1e, 0x86, 0x3d, 0x29, 0x9a, 0xfe, 0x66, 0x58, // `.*2h6B`..=)..fX
+	0x58, 0x01, 0x9a, 0x79, 0x78, 0x78, 0x41, 0x83, 0x0a, 0x20, 0x0c, 0x84, 0x9d, 0x29, 0x23, 0x07, // X..yxxA.. ...)#.
+	0x27, 0x23, 0x17, 0x07, 0x33, 0x37, 0x17, 0x33, 0x41, 0x68, 0x1f, 0x2d, 0xc2, 0x71, 0x51, 0x52, // '#..37.3Ah.-.qQR
+	0x72, 0x86, 0x8f, 0x71, 0x5c, 0x5a, 0x73, 0x8e, 0x83, 0xa3, 0x41, 0x53, 0x24, 0x29, 0x8d, 0x79, // r..q.Zs...AS$).y
+	0x79, 0xc8, 0xd2, 0x87, 0x87, 0xd3, 0xc7, 0x9a, 0x41, 0x3b, 0x24, 0x89, 0x9b, 0x20, 0x09, 0x6c, // y.......A;$.. .l
+	0xdd, 0x04, 0x84, 0x9b, 0x68, 0xdc, 0x03, 0x20, 0x03, 0x5e, 0xc5, 0x1c, 0x28, 0xbe, 0x64, 0x5a, // ....h.. .^..(.dZ
+	0x5a, 0x64, 0x90, 0x5c, 0x90, 0xbe, 0x5e, 0xa5, 0x24, 0x28, 0x7e, 0x98, 0x98, 0xf8, 0xa3, 0xa3, // Zd....^.$(~.....
+	0xf8, 0x01, 0x3c, 0x5e, 0x7e, 0x24, 0x43, 0x93, 0x0c, 0x21, 0x65, 0x00, 0x18, 0x58, 0x53, 0x1e, // ..<^~$C..!e..XS.
+	0x20, 0x1e, 0x7f, 0xb8, 0x0a, 0x18, 0x67, 0x1b, 0x14, 0x18, 0x67, 0x57, 0x1a, 0x18, 0x58, 0x77, //  .....g...gW..Xw
+	0x25, 0x21, 0x3c, 0x02, 0x82, 0x00, 0x23, 0x18, 0x03, 0x06, 0x03, 0x82, 0x02, 0x23, 0xfb, 0xfe, // %!<...#......#..
+	0x02, 0x06, 0x51, 0xb7, 0x03, 0x2b, 0x18, 0x02, 0x03, 0x03, 0x02, 0xfe, 0xfb, 0x03, 0x02, 0x02, // ..Q..+..........
+	0x03, 0x17, 0x82, 0x16, 0x24, 0x04, 0x06, 0x02, 0xfc, 0xfd, 0x8b, 0x19, 0x20, 0xfc, 0x18, 0x58, // ....$....... ..X
+	0x97, 0x26, 0x20, 0x9d, 0x8c, 0x34, 0x87, 0x68, 0x21, 0x04, 0x05, 0x9a, 0x68, 0x21, 0xfb, 0xfe, // .& ..4.h!...h!..
+	0x6d, 0xf7, 0x06, 0x71, 0x6f, 0x08, 0x20, 0x21, 0x18, 0x46, 0x35, 0x04, 0x44, 0x7f, 0x05, 0x20, // m..qo. !.F5.D.. 
+	0x21, 0x55, 0xef, 0x05, 0x76, 0xd9, 0x05, 0x21, 0x33, 0x21, 0x18, 0x5c, 0xce, 0x06, 0x20, 0x05, // !U..v..!3!.... .
+	0x5c, 0x5a, 0x05, 0x44, 0xdb, 0x1a, 0x21, 0x03, 0x30, 0x18, 0x5d, 0x45, 0x04, 0x26, 0xfd, 0xf2, // .Z.D..!.0.]E.&..
+	0x09, 0x0f, 0x06, 0x05, 0x06, 0x82, 0x02, 0x25, 0x0f, 0x09, 0x02, 0x0e, 0x09, 0x0e, 0x82, 0x14, // .......%........
+	0x27, 0xfd, 0xe3, 0x01, 0xda, 0xfe, 0x26, 0x02, 0xe7, 0x18, 0x58, 0x8e, 0x15, 0x8d, 0xdd, 0x22, // '.....&...X...."
+	0x02, 0xc7, 0x09, 0x18, 0x5d, 0xde, 0x06, 0x23, 0x0f, 0x09, 0xfd, 0xf3, 0x8b, 0x4a, 0x25, 0x1a, // ....]..#.....J%.
+	0xfe, 0x26, 0x01, 0xda, 0xed, 0x18, 0x58, 0xdb, 0x1e, 0x84, 0x4c, 0x8b, 0xdb, 0x22, 0x1a, 0x00, // .&....X...L.."..
+	0x43, 0x6c, 0xa1, 0x04, 0x18, 0x6b, 0xdf, 0x0e, 0x41, 0xc7, 0x0a, 0x20, 0x33, 0x9b, 0xd4, 0x22, // Cl...k..A.. 3.."
+	0x23, 0x34, 0x26, 0x46, 0xf1, 0x09, 0x18, 0x70, 0x94, 0x09, 0x45, 0xad, 0x03, 0x26, 0x03, 0x50, // #4&F...p..E..&.P
+	0x1c, 0x1c, 0x2a, 0x31, 0x77, 0x18, 0x59, 0x28, 0x04, 0x83, 0x00, 0x84, 0x09, 0x23, 0x2a, 0x1c, // ..*1w.Y(.....#*.
+	0x1c, 0xaa, 0xa3, 0xe6, 0x2b, 0x6a, 0x21, 0x22, 0x32, 0x3a, 0x8e, 0x53, 0x53, 0x8e, 0x3a, 0x3b, // ....+j!"2:.SS.:;
+	0x3a, 0x82, 0x02, 0x84, 0x09, 0x28, 0x32, 0x22, 0x21, 0x01, 0xc0, 0x35, 0x5e, 0x29, 0x32, 0x89, // :....(2"!..5^)2.
+	0x4e, 0x83, 0x00, 0x23, 0x32, 0x29, 0x5e, 0x35, 0xa3, 0xf5, 0x23, 0x3f, 0x70, 0x30, 0x3c, 0x89, // N..#2)^5..#?p0<.
+	0x4c, 0x83, 0x09, 0x23, 0x3c, 0x30, 0x70, 0x3f, 0x41, 0x0b, 0x0b, 0x22, 0x03, 0x00, 0x2c, 0x49, // L..#<0p?A.."..,I
+	0xc1, 0x04, 0x22, 0x13, 0x21, 0x13, 0x46, 0xa5, 0x1c, 0x21, 0x07, 0x36, 0x5f, 0x3c, 0x04, 0x23, // ..".!.F..!.6_<.#
+	0x27, 0x23, 0x26, 0x22, 0x61, 0xb7, 0x04, 0x22, 0x15, 0x01, 0x23, 0x4e, 0x82, 0x05, 0x42, 0x0f, // '#&"a.."..#N..B.
+	0x06, 0x2c, 0x23, 0x3e, 0x01, 0x37, 0x35, 0x02, 0x00, 0xf1, 0xfe, 0x1e, 0xf1, 0x01, 0xfa, 0xa3, // .,#>.75.........
+	0xed, 0x08, 0x2d, 0xb8, 0x01, 0x04, 0x04, 0xfe, 0xf3, 0x04, 0x0d, 0x08, 0x01, 0x0a, 0x13, 0x09, // ..-.............
+	0x01, 0x09, 0x0d, 0x05, 0xfe, 0xf4, 0x01, 0x05, 0x03, 0x01, 0x02, 0x08, 0x07, 0x07, 0x13, 0x0b, // ................
+	0x02, 0x19, 0x0b, 0x12, 0x08, 0x01, 0x07, 0x09, 0x01, 0x02, 0xc0, 0xfe, 0x40, 0x01, 0xc0, 0xff, // ............@...
+	0x00, 0xa3, 0xec, 0x21, 0xd9, 0x0b, 0x82, 0x48, 0x25, 0xe3, 0x09, 0x0d, 0x03, 0x05, 0x05, 0x4f, // ...!...H%......O
+	0xac, 0x03, 0x29, 0xfe, 0x1d, 0x0a, 0x14, 0x0a, 0x0a, 0x12, 0x07, 0x09, 0x09, 0x73, 0x24, 0x04, // ..)..........s$.
+	0x18, 0x76, 0xab, 0x07, 0x27, 0x00, 0x81, 0x03, 0xfa, 0x02, 0xff, 0x00, 0x07, 0x18, 0x5a, 0x91, // .v..'.........Z.
+	0x04, 0x20, 0x33, 0x42, 0xc1, 0x03, 0x2e, 0x06, 0x43, 0x42, 0x03, 0x6f, 0xfc, 0x0c, 0x02, 0x7a, // . 3B....CB.o...z
+	0x43, 0x42, 0xfd, 0x82, 0x01, 0xf9, 0x46, 0xdf, 0x06, 0x86, 0x27, 0x22, 0x06, 0x00, 0x0e, 0x46, // CB....F...'"...F
+	0xdf, 0x03, 0x25, 0x23, 0x11, 0x33, 0x35, 0x23, 0x01, 0x86, 0x30, 0x26, 0x01, 0xf1, 0x40, 0xbb, // ..%#.35#..0&..@.
+	0x7b, 0xfe, 0x15, 0x85, 0x36, 0x27, 0x01, 0x74, 0xea, 0xfe, 0xdc, 0x3a, 0x01, 0x06, 0x88, 0x3c, // {...6'.t...:...<
+	0x20, 0x03, 0x8c, 0x3b, 0x20, 0x15, 0x44, 0xfd, 0x03, 0x59, 0x37, 0x03, 0x20, 0x11, 0x6a, 0x71, //  ..; .D..Y7. .jq
+	0x03, 0x83, 0x3e, 0x20, 0x01, 0x83, 0x4a, 0x28, 0x35, 0x23, 0x02, 0xa1, 0x68, 0x31, 0x37, 0xfd, // ..> ..J(5#..h17.
+	0x65, 0x86, 0x44, 0x2d, 0x76, 0xa7, 0x6e, 0x39, 0x02, 0x44, 0x34, 0xd6, 0x01, 0x0a, 0xfe, 0x3d, // e.D-v.n9.D4....=
+	0x01, 0xf9, 0x84, 0x4b, 0x24, 0xc3, 0xfe, 0xf6, 0x35, 0xd5, 0x8c, 0x4f, 0x20, 0x07, 0x82, 0x4f, // ...K$...5..O ..O
+	0x20, 0x2d, 0x5d, 0xd1, 0x05, 0x83, 0x4a, 0x20, 0x05, 0x84, 0x94, 0x21, 0x35, 0x37, 0x48, 0x3f, //  -]...J ...!57H?
+	0x0b, 0x6b, 0x25, 0x09, 0x48, 0x38, 0x07, 0x21, 0xfc, 0x0c, 0x83, 0x62, 0x08, 0x22, 0xfd, 0x85, // .k%.H8.!...b."..
+	0x38, 0xa4, 0x6c, 0xe3, 0x10, 0x1b, 0x0b, 0x0a, 0x13, 0x0a, 0x2e, 0x0a, 0x17, 0x0c, 0x06, 0x0b, // 8.l.............
+	0x04, 0x08, 0x09, 0x20, 0x4b, 0xb3, 0x64, 0x2d, 0x25, 0x0a, 0x0c, 0x0c, 0x0d, 0x1d, 0x10, 0x02, // ... K.d-%.......
+	0xff, 0x83, 0xbe, 0x3e, 0x43, 0x42, 0xc1, 0xfe, 0xfc, 0x34, 0xd0, 0x06, 0x08, 0x07, 0x07, 0x16, // ...>CB...4......
+	0x0e, 0x1b, 0x12, 0x11, 0x04, 0x05, 0x15, 0x1c, 0x25, 0x4d, 0x2c, 0x34, 0x31, 0x2e, 0x27, 0x12, // ........%M,41.'.
+	0x1e, 0x0a, 0x0b, 0x49, 0x67, 0x04, 0x20, 0x05, 0x8c, 0x8f, 0x27, 0x2a, 0x00, 0x36, 0x00, 0x42, // ...Ig. ...'*.6.B
+	0x00, 0x00, 0x37, 0x8d, 0xdc, 0x20, 0x05, 0x64, 0xe0, 0x32, 0x41, 0x86, 0x06, 0x35, 0x01, 0x2e, // ..7.. .d.2A..5..
+	0xa6, 0x6d, 0x39, 0x01, 0x5c, 0x32, 0x6e, 0x7c, 0x1d, 0x29, 0x0c, 0x0a, 0x0a, 0x08, 0x08, 0x08, // .m9..2n|.)......
+	0x15, 0x0d, 0x0a, 0x0b, 0x82, 0x01, 0x27, 0x09, 0x05, 0x10, 0x0a, 0x61, 0x26, 0x2d, 0x07, 0x82, // ......'....a&-..
+	0x9b, 0x2a, 0x28, 0x2c, 0x1f, 0x27, 0x06, 0x06, 0x06, 0x07, 0x26, 0x1f, 0x81, 0x41, 0x2c, 0x0b, // .*(,.'....&..A,.
+	0x3b, 0x06, 0x06, 0xfe, 0xf6, 0x0c, 0x0d, 0x0a, 0x19, 0x0e, 0x0d, 0x15, 0x08, 0x09, 0x0a, 0x03, // ;...............
+	0x04, 0x07, 0x08, 0x17, 0x0f, 0x0d, 0x17, 0x0b, 0x06, 0x08, 0x04, 0x95, 0x06, 0x77, 0xa4, 0x03, // .............w..
+	0x2d, 0x0c, 0x04, 0x06, 0x3d, 0x69, 0x06, 0x03, 0x0c, 0x09, 0x08, 0x0c, 0x03, 0x05, 0x3a, 0x44, // -...=i........:D
+	0xef, 0x05, 0x24, 0xe6, 0xff, 0xc6, 0x03, 0x1a, 0x44, 0xef, 0x04, 0x25, 0x23, 0x00, 0x2c, 0x00, // ..$.....D..%#.,.
+	0x00, 0x17, 0x61, 0x00, 0x0e, 0x5b, 0x0e, 0x0c, 0x18, 0x72, 0x82, 0x04, 0x22, 0x35, 0x23, 0x37, // ..a..[...r.."5#7
+	0x5b, 0x04, 0x05, 0x2d, 0x15, 0x33, 0xe6, 0x07, 0x07, 0x07, 0x10, 0x0a, 0x01, 0xd6, 0x0a, 0x11, // [..-.3..........
+	0x07, 0x07, 0x82, 0x8d, 0x24, 0x07, 0x11, 0x0a, 0xfe, 0x2b, 0x83, 0x0b, 0x2e, 0x07, 0xc0, 0x29, // ....$....+.....)
+	0x74, 0x4b, 0x80, 0x29, 0x34, 0x92, 0x35, 0x0b, 0x03, 0x96, 0x09, 0x10, 0x83, 0xb1, 0x25, 0x08, // tK.)4.5.......%.
+	0x07, 0x10, 0x09, 0xfc, 0x6a, 0x82, 0x1c, 0x82, 0x26, 0x20, 0x06, 0x7a, 0x0f, 0x03, 0x2a, 0x91, // ....j...& .z..*.
+	0x9a, 0xc0, 0x26, 0x74, 0x9a, 0x9a, 0x26, 0x26, 0x00, 0x04, 0x8a, 0x83, 0x22, 0x2e, 0x00, 0x37, // ..&t..&&...."..7
+	0x74, 0xcd, 0x04, 0x45, 0x72, 0x18, 0x24, 0x34, 0x26, 0x27, 0x01, 0x27, 0x7c, 0x65, 0x03, 0x18, // t..Er.$4&'.'|e..
+	0x45, 0x0c, 0x0a, 0x21, 0x23, 0x37, 0x7c, 0x76, 0x04, 0x24, 0x35, 0x33, 0x15, 0x07, 0x17, 0x41, // E..!#7|v.$53...A
+	0x48, 0x03, 0x23, 0x33, 0x17, 0x03, 0x0d, 0x83, 0x8b, 0x22, 0x2a, 0x0a, 0x10, 0x5b, 0x0b, 0x05, // H.#3....."*..[..
+	0x82, 0x6e, 0x20, 0xd5, 0x86, 0xa3, 0x3c, 0xfe, 0xc9, 0x29, 0x1c, 0x29, 0x45, 0x15, 0x1f, 0x09, // .n ...<..).)E...
+	0x09, 0x09, 0x11, 0x12, 0x2e, 0x31, 0xc2, 0x33, 0x29, 0x35, 0x91, 0xcd, 0x08, 0x08, 0x1c, 0x1e, // .....1.3)5......
+	0x1e, 0x1c, 0x03, 0xab, 0x92, 0xa7, 0x84, 0xbf, 0x2e, 0xfd, 0xb6, 0x3d, 0x3d, 0xc0, 0x08, 0x08, // ...........==...
+	0x08, 0x18, 0x10, 0x17, 0x1e, 0x08, 0x43, 0x98, 0x83, 0xb5, 0x25, 0x04, 0x14, 0x19, 0x06, 0x39, // ......C...%....9
+	0x06, 0x6b, 0x3b, 0x03, 0x42, 0x0b, 0x08, 0x26, 0x23, 0x00, 0x2f, 0x00, 0x3b, 0x00, 0x49, 0x5d, // .k;.B..&#./.;.I]
+	0x5f, 0x03, 0x20, 0x13, 0x64, 0xe2, 0x04, 0x21, 0x21, 0x11, 0x42, 0x06, 0x33, 0x18, 0x71, 0x75, // _. .d..!!.B.3.qu
+	0x04, 0x88, 0xdf, 0x83, 0x40, 0x24, 0x35, 0x33, 0x17, 0x33, 0x27, 0x4b, 0x0a, 0x08, 0x2e, 0x06, // ....@$53.3'K....
+	0x03, 0x6f, 0x42, 0x43, 0xfc, 0x0c, 0x02, 0xb9, 0x32, 0x6d, 0x7b, 0x1e, 0x29, 0x0b, 0x42, 0x21, // .oBC....2m{.).B!
+	0x06, 0x42, 0x20, 0x04, 0x20, 0x0a, 0x42, 0x21, 0x05, 0x5c, 0x51, 0x03, 0x08, 0x2b, 0x28, 0x2c, // .B . .B!..Q..+(,
+	0x1f, 0x28, 0x05, 0x06, 0x06, 0x06, 0x27, 0x1f, 0xa0, 0x04, 0x05, 0x26, 0x2a, 0x2a, 0x0e, 0x13, // .(....'....&**..
+	0x05, 0x05, 0x04, 0x32, 0x60, 0x39, 0x27, 0x36, 0x47, 0x40, 0x18, 0x18, 0x0d, 0x0c, 0x0d, 0x2a, // ...2`9'6G@.....*
+	0x1d, 0x02, 0xff, 0x42, 0x43, 0xfe, 0x07, 0x02, 0x7e, 0xc1, 0x42, 0x35, 0x2c, 0x38, 0x27, 0x0b, // ...BC...~.B5,8'.
+	0x10, 0x05, 0x0a, 0x4f, 0x04, 0x04, 0x04, 0x0f, 0x0a, 0x59, 0xfe, 0xf6, 0x53, 0x53, 0x5e, 0x09, // ...O.....Y..SS^.
+	0x2a, 0x20, 0x17, 0x21, 0x0a, 0x0b, 0x0c, 0x5d, 0x5f, 0x04, 0x41, 0x0b, 0x05, 0x24, 0x0b, 0x00, // * .!...]_.A..$..
+	0x1d, 0x00, 0x3e, 0x69, 0xd3, 0x04, 0x89, 0xd6, 0x20, 0x33, 0x91, 0xc9, 0x4b, 0xf8, 0x10, 0x43, // ..>i.... 3..K..C
+	0xba, 0x0d, 0x20, 0x25, 0x41, 0x44, 0x06, 0x22, 0x01, 0x78, 0x2a, 0x53, 0x28, 0x03, 0x08, 0x30, // .. %AD.".x*S(..0
+	0x2a, 0x2a, 0x2a, 0x02, 0x64, 0x3c, 0x28, 0x3a, 0x49, 0x42, 0x19, 0x19, 0x0e, 0x0e, 0x0c, 0x2c, // ***.d<(:IB.....,
+	0x1f, 0x01, 0x03, 0x12, 0x1c, 0x0b, 0x0b, 0x14, 0x0a, 0x30, 0x0a, 0x18, 0x0d, 0x07, 0x0b, 0x04, // .........0......
+	0x04, 0x05, 0x0b, 0x21, 0x4e, 0xbb, 0x69, 0x30, 0x28, 0x09, 0x0d, 0x0d, 0x0d, 0x1d, 0x11, 0xfd, // ...!N.i0(.......
+	0x8d, 0x41, 0x27, 0x06, 0x24, 0x0c, 0x08, 0x04, 0x0e, 0x0a, 0x82, 0xb4, 0x2f, 0x09, 0x4d, 0x32, // .A'.$......./.M2
+	0xfe, 0xfc, 0x52, 0x52, 0x5d, 0x09, 0x29, 0x1f, 0x17, 0x20, 0x0a, 0x0b, 0x0a, 0x43, 0xe3, 0x07, // ..RR].).. ...C..
+	0x25, 0x12, 0x05, 0x05, 0x04, 0x0a, 0x07, 0x43, 0xe5, 0x0c, 0x20, 0xbb, 0x41, 0x18, 0x05, 0x5f, // %......C.. .A.._
+	0x3b, 0x06, 0x41, 0xdf, 0x07, 0x22, 0x15, 0x00, 0x27, 0x7a, 0x19, 0x03, 0x41, 0xdb, 0x07, 0x20, // ;.A.."..'z..A.. 
+	0x01, 0x41, 0xa7, 0x1e, 0x20, 0x33, 0x44, 0xf5, 0x05, 0x41, 0xae, 0x06, 0x21, 0x01, 0xd3, 0x41, // .A.. 3D..A..!..A
+	0x86, 0x04, 0x21, 0x0d, 0x14, 0x41, 0x86, 0x10, 0x23, 0xfa, 0x66, 0x2f, 0x37, 0x41, 0x8a, 0x07, // ..!..A..#.f/7A..
+	0x21, 0xfe, 0xec, 0x41, 0x5d, 0x17, 0x45, 0x19, 0x03, 0x45, 0x0b, 0x0e, 0x22, 0x17, 0x00, 0x29, // !..A].E..E.."..)
+	0x62, 0xdd, 0x06, 0x82, 0x90, 0x20, 0x05, 0x53, 0xd6, 0x0b, 0x23, 0x2b, 0x01, 0x35, 0x37, 0x90, // b.... .S..#+.57.
+	0x8f, 0x45, 0x09, 0x03, 0x83, 0x8b, 0x24, 0xfd, 0xdb, 0x2e, 0x0e, 0x15, 0x48, 0x41, 0x04, 0x33, // .E....$.....HA.3
+	0x05, 0x16, 0x10, 0x2c, 0x2a, 0x68, 0x3e, 0x2a, 0x3c, 0x4b, 0x45, 0x1b, 0x1a, 0x0e, 0x0e, 0x0e, // ...,*h>*<KE.....
+	0x2d, 0x20, 0x02, 0x7a, 0x83, 0x85, 0x29, 0x42, 0x43, 0x55, 0x05, 0x04, 0x04, 0x10, 0x0c, 0x0c, // - .z..)BCU......
+	0x11, 0x82, 0x23, 0x2e, 0x56, 0x39, 0xfe, 0xdc, 0x5d, 0x5d, 0x67, 0x0b, 0x2d, 0x23, 0x1a, 0x25, // ..#.V9..]]g.-#.%
+	0x0b, 0x0c, 0x0c, 0x46, 0x43, 0x0f, 0x87, 0x7f, 0x87, 0x5d, 0x87, 0x41, 0x86, 0x27, 0x20, 0xa6, // ...FC....].A.' .
+	0x82, 0x27, 0x20, 0xda, 0x73, 0x33, 0x03, 0x20, 0x13, 0x5f, 0x5f, 0x1b, 0x20, 0x35, 0x44, 0x25, // .' .s3. .__. 5D%
+	0x17, 0x21, 0x02, 0xda, 0x44, 0x61, 0x04, 0x21, 0xfe, 0x2a, 0x44, 0x61, 0x09, 0x43, 0xc9, 0x05, // .!..Da.!.*Da.C..
+	0x62, 0xfc, 0x03, 0x20, 0x08, 0x8a, 0x5f, 0x2a, 0x25, 0x00, 0x29, 0x00, 0x31, 0x00, 0x43, 0x00, // b.. .._*%.).1.C.
+	0x4c, 0x00, 0x7c, 0x5c, 0xf9, 0x04, 0x18, 0x77, 0x12, 0x1b, 0x22, 0x05, 0x23, 0x07, 0x4c, 0xa9, // L.|....w..".#.L.
+	0x04, 0x20, 0x27, 0x44, 0x39, 0x03, 0x20, 0x37, 0x75, 0x7d, 0x03, 0x44, 0x32, 0x03, 0x18, 0x40, // . 'D9. 7u}.D2..@
+	0x34, 0x06, 0x20, 0x15, 0x41, 0x35, 0x08, 0x44, 0xe5, 0x08, 0x20, 0x25, 0x18, 0x62, 0xa2, 0x0b, // 4. .A5.D.. %.b..
+	0x56, 0xb9, 0x04, 0x71, 0x6b, 0x0e, 0x84, 0x3a, 0x22, 0x2f, 0x02, 0x3f, 0x18, 0x60, 0x05, 0x04, // V..qk..:"/.?.`..
+	0x21, 0x27, 0x17, 0x18, 0x4c, 0x1d, 0x07, 0x21, 0x03, 0xfa, 0x44, 0x4d, 0x15, 0x37, 0x08, 0x07, // !'..L..!..DM.7..
+	0xfd, 0xff, 0x1c, 0x3a, 0x20, 0x0c, 0x37, 0x0c, 0x1f, 0x38, 0x0e, 0x10, 0x21, 0x11, 0x88, 0x14, // ...: .7..8..!...
+	0x06, 0x06, 0x14, 0x15, 0x15, 0x37, 0x82, 0xdf, 0x33, 0x16, 0x0f, 0x31, 0x1d, 0x14, 0x1d, 0x24, // .....7..3..1...$
+	0x21, 0x0c, 0x0c, 0x39, 0x1d, 0x26, 0x69, 0x26, 0xfe, 0x2d, 0x1a, 0x0a, 0x11, 0x82, 0x16, 0x27, // !..9.&i&.-.....'
+	0x06, 0x05, 0x05, 0x10, 0x0b, 0x07, 0x0a, 0x03, 0x56, 0xbc, 0x03, 0x25, 0x13, 0x0a, 0x11, 0x0c, // ........V..%....
+	0x1c, 0x0f, 0x41, 0x03, 0x04, 0x34, 0x05, 0x06, 0x05, 0x0f, 0x09, 0x18, 0x05, 0x04, 0x0c, 0x09, // ..A..4..........
+	0x12, 0x08, 0x10, 0x18, 0x90, 0x69, 0x26, 0x1d, 0x26, 0x02, 0xab, 0x41, 0x2b, 0x12, 0x41, 0x43, // .....i&.&..A+.AC
+	0x04, 0x08, 0x21, 0xa7, 0x89, 0x1d, 0x1d, 0x89, 0x29, 0x28, 0x28, 0x0e, 0x05, 0x0e, 0x11, 0x05, // ..!.....)((.....
+	0x29, 0x13, 0x0c, 0x11, 0x05, 0x06, 0x06, 0x89, 0x2b, 0x2b, 0x30, 0x05, 0x16, 0x10, 0x13, 0x6e, // ).......++0....n
+	0x6e, 0x1b, 0x1b, 0x1a, 0x04, 0x83, 0x65, 0x5d, 0x0b, 0x04, 0x2c, 0x07, 0x02, 0x02, 0x04, 0x02, // n.....e]..,.....
+	0x0a, 0x09, 0x03, 0x09, 0x09, 0x17, 0x0b, 0x0c, 0x82, 0x15, 0x37, 0x0f, 0x09, 0x0a, 0x0e, 0x05, // ..........7.....
+	0x04, 0x08, 0x03, 0x08, 0x0a, 0x0a, 0x03, 0x07, 0x08, 0x18, 0x0e, 0x1a, 0x1b, 0x1b, 0x6e, 0x6e, // ..............nn
+	0x00, 0x00, 0x07, 0x41, 0x7f, 0x0c, 0x28, 0x32, 0x00, 0x39, 0x00, 0x46, 0x00, 0x6d, 0x00, 0x9b, // ...A..(2.9.F.m..
+	0x41, 0xeb, 0x1e, 0x20, 0x05, 0x61, 0x44, 0x07, 0x20, 0x05, 0x46, 0x4c, 0x05, 0x61, 0x4e, 0x04, // A.. .aD. .FL.aN.
+	0x21, 0x33, 0x17, 0x46, 0x59, 0x06, 0x8b, 0x13, 0x4f, 0x4d, 0x03, 0x20, 0x37, 0x62, 0x5f, 0x11, // !3.FY...OM. 7b_.
+	0x78, 0x2d, 0x0f, 0x22, 0x05, 0x37, 0x2f, 0x75, 0x26, 0x0b, 0x21, 0x1f, 0x02, 0x41, 0x9d, 0x17, // x-.".7/u&.!..A..
+	0x22, 0x1e, 0x01, 0x17, 0x42, 0x68, 0x18, 0x32, 0x03, 0x20, 0x67, 0x25, 0x1e, 0x24, 0xfe, 0x1c, // "...Bh.2. g%.$..
+	0x5d, 0x5f, 0x42, 0x3a, 0x3a, 0x40, 0x3a, 0x1d, 0x53, 0x36, 0xaa, 0x85, 0x0a, 0x20, 0x5a, 0x82, // ]_B::@:.S6... Z.
+	0x23, 0x26, 0x13, 0x0b, 0x1b, 0x10, 0x0f, 0x18, 0x09, 0x6a, 0x7e, 0x04, 0x2a, 0x18, 0x0f, 0x0f, // #&.......j~.*...
+	0x1b, 0x0b, 0x13, 0x06, 0x12, 0x0b, 0x08, 0x0d, 0x4b, 0x83, 0x03, 0x28, 0x06, 0x06, 0x0e, 0x08, // ........K..(....
+	0xfe, 0x3b, 0x0f, 0x17, 0x1a, 0x84, 0x4a, 0x31, 0x06, 0x05, 0x05, 0x11, 0x0b, 0x14, 0x05, 0x05, // .;....J1........
+	0x0d, 0x09, 0x13, 0x0b, 0x11, 0x0c, 0x1c, 0x10, 0x0b, 0x11, 0x83, 0x13, 0x2a, 0x04, 0x06, 0x0e, // ............*...
+	0x0a, 0x17, 0x06, 0x05, 0x0b, 0x09, 0x12, 0x08, 0x42, 0xcf, 0x19, 0x21, 0xd6, 0x1b, 0x41, 0x84, // ........B..!..A.
+	0x03, 0x2a, 0x1b, 0x89, 0x1b, 0x1c, 0x1b, 0x1c, 0x53, 0x6e, 0x89, 0x1b, 0x53, 0x85, 0x0a, 0x20, // .*......Sn..S.. 
+	0x01, 0x56, 0xbb, 0x03, 0x3e, 0x0d, 0x0a, 0x0a, 0x0b, 0x1a, 0x0f, 0x0f, 0x1a, 0x0a, 0x09, 0x0a, // .V..>...........
+	0x0d, 0x0d, 0x14, 0x08, 0x09, 0x05, 0x05, 0x06, 0x10, 0x0a, 0x09, 0x0f, 0x05, 0x07, 0x06, 0x0d, // ................
+	0x18, 0x0e, 0x03, 0x05, 0x41, 0xb6, 0x09, 0x24, 0x08, 0x0a, 0x09, 0x04, 0x0a, 0x41, 0xb4, 0x12, // ....A..$.....A..
+	0x18, 0x56, 0x1e, 0x04, 0x18, 0x73, 0x23, 0x0d, 0x20, 0x01, 0x18, 0x4a, 0x5b, 0x0d, 0x68, 0x4c, // .V...s#. ..J[.hL
+	0x08, 0x18, 0x49, 0xb4, 0x14, 0x18, 0x4f, 0x5c, 0x09, 0x41, 0xd8, 0x05, 0x21, 0x03, 0xfa, 0x18, // ..I...O..A..!...
+	0x5e, 0x6b, 0x04, 0x20, 0xe0, 0x83, 0x05, 0x28, 0x0b, 0xfe, 0xae, 0x0b, 0x15, 0x08, 0x08, 0x08, // ^k. ...(........
+	0xe0, 0x18, 0x5e, 0x77, 0x09, 0x20, 0xe0, 0x83, 0x05, 0x24, 0x0b, 0x01, 0x52, 0x0b, 0x13, 0x82, // ..^w. ...$..R...
+	0x20, 0x20, 0xdf, 0x7d, 0x76, 0x03, 0x22, 0x09, 0x02, 0x69, 0x82, 0x26, 0x83, 0x0e, 0x8b, 0x26, //   .}v."..i.&...&
+	0x84, 0x3e, 0x82, 0x26, 0x83, 0x11, 0x85, 0x26, 0x85, 0x56, 0x84, 0x3e, 0x49, 0x67, 0x04, 0x86, // .>.&...&.V.>Ig..
+	0xaf, 0x30, 0x0d, 0x00, 0x19, 0x00, 0x23, 0x00, 0x60, 0x00, 0x6c, 0x00, 0x00, 0x25, 0x15, 0x17, // .0....#.`.l..%..
+	0x37, 0x35, 0x2f, 0x42, 0x14, 0x07, 0x20, 0x03, 0x43, 0xb3, 0x04, 0x27, 0x07, 0x17, 0x33, 0x3f, // 75/B.. .C..'..3?
+	0x01, 0x35, 0x37, 0x17, 0x18, 0x55, 0x2e, 0x06, 0x62, 0x22, 0x03, 0x20, 0x15, 0xb8, 0xde, 0x24, // .57..U..b". ...$
+	0x07, 0x15, 0x1f, 0x01, 0x33, 0x6a, 0x0e, 0x03, 0x2a, 0x06, 0x0f, 0x01, 0x01, 0x90, 0x70, 0x70, // ....3j..*.....pp
+	0x04, 0x0a, 0xc4, 0x03, 0x5e, 0xd5, 0x03, 0x2f, 0xa9, 0x04, 0x02, 0x05, 0x03, 0x0e, 0x70, 0x70, // ....^../......pp
+	0x0e, 0x0a, 0x04, 0xad, 0x0a, 0xc4, 0x0a, 0x04, 0x82, 0x19, 0x21, 0x02, 0x55, 0x87, 0xb1, 0x41, // ..........!.U..A
+	0x08, 0x27, 0x22, 0xd0, 0x04, 0x0a, 0x83, 0x42, 0x82, 0x50, 0x21, 0x04, 0x99, 0x85, 0x4b, 0x82, // .'"....B.P!...K.
+	0x59, 0x26, 0x05, 0x03, 0x01, 0x89, 0x0a, 0x02, 0x02, 0x84, 0x6a, 0x21, 0xbb, 0x04, 0x85, 0x21, // Y&........j!...!
+	0x21, 0x0a, 0x4c, 0x82, 0x38, 0x41, 0x32, 0x2c, 0x20, 0x6f, 0x84, 0x93, 0x22, 0x02, 0x02, 0x0a, // !.L.8A2, o.."...
+	0x50, 0x7b, 0x0c, 0x47, 0x83, 0x03, 0x20, 0x37, 0x41, 0x14, 0x03, 0x83, 0xd4, 0x20, 0x25, 0x41, // P{.G.. 7A.... %A
+	0xc9, 0x11, 0x41, 0x26, 0x29, 0x21, 0x02, 0x6c, 0x83, 0xf2, 0x82, 0xf9, 0x21, 0xfe, 0xc3, 0x41, // ..A&)!.l....!..A
+	0xdc, 0x0f, 0x41, 0x03, 0x1f, 0x21, 0x02, 0xdd, 0x85, 0xd3, 0x22, 0x04, 0x04, 0xcc, 0x41, 0xe2, // ..A..!...."...A.
+	0x0c, 0xa2, 0xdf, 0x53, 0x6b, 0x0d, 0x85, 0xcf, 0x41, 0xa0, 0x06, 0x22, 0x0f, 0x01, 0x37, 0x42, // ...Sk...A.."..7B
+	0xc3, 0x3c, 0x20, 0x19, 0x41, 0x69, 0x06, 0x21, 0x04, 0xe1, 0x88, 0x92, 0x21, 0x14, 0x0c, 0x41, // .< .Ai.!....!..A
+	0x72, 0x24, 0x21, 0x02, 0x22, 0x41, 0xff, 0x05, 0x21, 0x0a, 0x47, 0x86, 0x2e, 0x41, 0x06, 0x10, // r$!."A..!.G..A..
+	0x86, 0x2e, 0x42, 0x0a, 0x10, 0x8a, 0xcb, 0x20, 0x0d, 0x50, 0x5d, 0x03, 0x20, 0x25, 0x42, 0xcc, // ..B.... .P]. %B.
+	0x0a, 0x22, 0x1d, 0x01, 0x01, 0x41, 0x93, 0x2f, 0x8b, 0xd5, 0x42, 0xab, 0x0b, 0x21, 0x02, 0x31, // ."...A./..B..!.1
+	0x8d, 0x78, 0x88, 0xd7, 0x98, 0xa8, 0x20, 0x8b, 0x42, 0x8c, 0x09, 0x22, 0x0e, 0x02, 0x16, 0x41, // .x.... .B.."...A
+	0xca, 0x0b, 0x43, 0x98, 0x10, 0x41, 0xfa, 0x06, 0x8b, 0xdb, 0x41, 0xa3, 0x0b, 0x20, 0x3c, 0x41, // ..C..A....A.. <A
+	0xa3, 0x04, 0xbb, 0xc9, 0x20, 0x05, 0x64, 0x5b, 0x03, 0x43, 0xcb, 0x04, 0x21, 0x03, 0xc1, 0x41, // .... .d[.C..!..A
+	0x87, 0x0f, 0x42, 0x5f, 0x08, 0x18, 0x63, 0x15, 0x06, 0x22, 0x14, 0x0c, 0xdf, 0x8c, 0x94, 0x21, // ..B_..c..".....!
+	0xfd, 0x22, 0x42, 0x6a, 0x07, 0x21, 0x02, 0xa1, 0x42, 0x63, 0x0d, 0x89, 0x30, 0x41, 0xa1, 0x17, // ."Bj.!..Bc..0A..
+	0x20, 0x75, 0x42, 0xe0, 0x06, 0x4e, 0xff, 0x07, 0x20, 0x09, 0x82, 0xcf, 0x20, 0x77, 0x18, 0x45, //  uB..N.. ... w.E
+	0x33, 0x05, 0x18, 0x49, 0xe9, 0x09, 0x20, 0x35, 0x4c, 0x8f, 0x0e, 0x82, 0xd9, 0x20, 0x13, 0x48, // 3..I.. 5L.... .H
+	0x6c, 0x1b, 0x26, 0x03, 0xea, 0x08, 0x13, 0x0b, 0xfc, 0x78, 0x18, 0x44, 0x8b, 0x0a, 0x20, 0x88, // l.&......x.D.. .
+	0x18, 0x5b, 0xda, 0x06, 0x20, 0x10, 0x82, 0x03, 0x94, 0x1a, 0x20, 0x18, 0x6d, 0xa0, 0x04, 0x83, // .[.. ..... .m...
+	0xa2, 0x20, 0x07, 0x46, 0xab, 0x07, 0x20, 0x07, 0x83, 0xc6, 0x25, 0x08, 0x03, 0x2a, 0xfe, 0xa5, // . .F.. ...%..*..
+	0x0b, 0x18, 0x5c, 0xb9, 0x07, 0x22, 0x0b, 0x01, 0x5a, 0x18, 0x5c, 0x23, 0x07, 0x20, 0x13, 0x43, // ....."..Z..#. .C
+	0xf3, 0x03, 0x2a, 0x07, 0x00, 0x56, 0x03, 0xf9, 0x03, 0x2a, 0x00, 0x04, 0x00, 0x20, 0x50, 0xcd, // ..*..V...*... P.
+	0x05, 0x20, 0x21, 0x65, 0xc3, 0x06, 0x20, 0x21, 0x67, 0x3e, 0x06, 0x67, 0x9c, 0x05, 0x20, 0x21, // . !e.. !g>.g.. !
+	0x4c, 0x81, 0x03, 0x2b, 0x27, 0x13, 0x03, 0x93, 0x37, 0xfc, 0x6f, 0x36, 0x03, 0x24, 0x66, 0x02, // L..+'...7.o6.$f.
+	0x18, 0x5d, 0xef, 0x04, 0x36, 0xfc, 0x66, 0x0b, 0x12, 0x06, 0x06, 0x05, 0x02, 0x2c, 0x01, 0x05, // .]..6.f......,..
+	0x05, 0x05, 0x12, 0x0c, 0x03, 0x42, 0x23, 0x02, 0x04, 0x04, 0x01, 0x2c, 0x82, 0x70, 0x2b, 0x8b, // .....B#....,.p+.
+	0x01, 0x75, 0xfd, 0x5f, 0x0a, 0x12, 0x08, 0x06, 0x08, 0x01, 0x01, 0x82, 0x04, 0x30, 0x12, 0x0a, // .u._.........0..
+	0x01, 0x11, 0x05, 0x0b, 0x05, 0x05, 0x09, 0x04, 0x12, 0x03, 0x06, 0x0b, 0x06, 0xfe, 0xea, 0x41, // ...............A
+	0x2b, 0x04, 0x24, 0x71, 0x00, 0x09, 0x03, 0x8f, 0x41, 0x2b, 0x07, 0x20, 0x37, 0x41, 0x21, 0x11, // +.$q....A+. 7A!.
+	0x41, 0x1c, 0x09, 0x6d, 0x0f, 0x1c, 0x20, 0x71, 0x84, 0xf6, 0x21, 0x02, 0xb4, 0x18, 0x5d, 0x2c, // A..m.. q..!...],
+	0x0a, 0x20, 0x4c, 0x83, 0xe3, 0x22, 0x07, 0x03, 0x0e, 0x8d, 0x0f, 0x89, 0x27, 0x23, 0x3e, 0x01, // . L.."......'#>.
+	0x56, 0x09, 0x6e, 0xd1, 0x07, 0x22, 0x09, 0xfe, 0xaa, 0x89, 0x1d, 0x21, 0x03, 0x29, 0x82, 0x2e, // V.n..".....!.)..
+	0x41, 0x2e, 0x0c, 0x20, 0x59, 0x18, 0x45, 0xe6, 0x04, 0x18, 0x47, 0x0f, 0x04, 0x24, 0x8b, 0x00, // A.. Y.E...G..$..
+	0x56, 0x03, 0x75, 0x41, 0x2b, 0x0d, 0x83, 0xaa, 0x41, 0x30, 0x0e, 0x49, 0xef, 0x05, 0x30, 0x21, // V.uA+...A0.I..0!
+	0x37, 0x03, 0x0f, 0x37, 0xfd, 0x77, 0x36, 0x02, 0x1c, 0x31, 0x02, 0x04, 0x03, 0x2c, 0x01, 0x05, // 7..7.w6..1...,..
+	0x48, 0x2e, 0x03, 0x29, 0xfd, 0x6e, 0x0b, 0x11, 0x07, 0x06, 0x04, 0x01, 0x2c, 0x04, 0x41, 0x2e, // H..).n......,.A.
+	0x03, 0x22, 0x02, 0x3a, 0x23, 0x41, 0x29, 0x05, 0x21, 0xfe, 0x5b, 0x41, 0x14, 0x04, 0x20, 0xeb, // .".:#A).!.[A.. .
+	0x69, 0x4d, 0x04, 0x21, 0x01, 0x01, 0x69, 0x4f, 0x04, 0x21, 0x01, 0x10, 0x41, 0x2f, 0x06, 0x59, // iM.!..iO.!..A/.Y
+	0x9f, 0x10, 0x56, 0x09, 0x1b, 0x18, 0x7e, 0xa0, 0x04, 0x23, 0x23, 0x11, 0x02, 0x00, 0x56, 0x08, // ..V...~..##...V.
+	0x23, 0x24, 0x1e, 0x60, 0x01, 0x1c, 0xbc, 0x18, 0x71, 0xd5, 0x05, 0x56, 0x05, 0x1f, 0x26, 0xfe, // #$.`....q..V..&.
+	0xc4, 0xfe, 0x65, 0x52, 0x01, 0x49, 0x84, 0x8b, 0x20, 0xc7, 0x82, 0x8b, 0x22, 0xb9, 0x00, 0x06, // ..eR.I.. ..."...
+	0x57, 0x3b, 0x04, 0x50, 0xb5, 0x06, 0x78, 0x1d, 0x03, 0x52, 0xdb, 0x03, 0x54, 0x18, 0x05, 0x5a, // W;.P..x..R..T..Z
+	0xf9, 0x03, 0x53, 0xe8, 0x03, 0x18, 0x6f, 0x76, 0x04, 0x22, 0x2e, 0x01, 0x37, 0x5e, 0xf5, 0x03, // ..S...ov."..7^..
+	0x53, 0x0f, 0x06, 0x08, 0x43, 0x01, 0x07, 0x01, 0xbd, 0xa6, 0x6c, 0x3a, 0x02, 0x3d, 0x02, 0x50, // S...C.....l:.=.P
 	0x51, 0x01, 0x22, 0x4c, 0x29, 0x10, 0x11, 0x02, 0x11, 0x27, 0x16, 0xa8, 0x17, 0x28, 0x10, 0x03, // Q."L)....'...(..
 	0x0f, 0x10, 0x29, 0x4c, 0x22, 0x50, 0x4f, 0x01, 0x01, 0x4f, 0x50, 0x24, 0x50, 0x57, 0x5e, 0x33, // ..)L"PO..OP$PW^3
-	0x33, 0x5e, 0x57, 0x4f, 0x24, 0x51, 0x4f, 0x01, 0xfe, 0x28, 0x05, 0x05, 0x05, 0x05, 0x06, 0x14, // 3^WO$QO..(......
-	0x0e, 0x2a, 0x2a, 0x0e, 0x14, 0x06, 0x45, 0x0d, 0x0d, 0x0c, 0x2b, 0x1e, 0x61, 0x39, 0x28, 0x38, // .**...E...+.a9(8
-	0x46, 0x41, 0x19, 0x19, 0x02, 0x68, 0x49, 0x7b, 0x32, 0x16, 0x21, 0x0b, 0xf9, 0x17, 0x29, 0x11, // FA...hI{2.!...).
-	0x01, 0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x10, 0x27, 0x17, 0xf9, 0x0b, 0x21, 0x16, 0x32, 0x7b, 0x49, // .......'...!.2{I
-	0x4a, 0x7b, 0x32, 0x16, 0x22, 0x17, 0x0b, 0x0b, 0x17, 0x22, 0x16, 0x32, 0x7b, 0x4a, 0x46, 0x03, // J{2."....".2{JF.
-	0x0f, 0x0a, 0x0a, 0x0f, 0x05, 0x04, 0x05, 0x4b, 0x04, 0x04, 0x1c, 0x16, 0x21, 0x0a, 0x0a, 0x0b, // .......K....!...
-	0xff, 0x00, 0x52, 0x52, 0x5b, 0x09, 0x28, 0x1e, 0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ..RR[.(.........
-	0x03, 0xba, 0x00, 0x11, 0x00, 0x3a, 0x00, 0x48, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x2b, 0x01, 0x11, // .....:.H.....+..
-	0x33, 0x35, 0x33, 0x17, 0x33, 0x27, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x37, 0x1e, 0x03, 0x15, // 353.3'>.54&'7...
-	0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, // ......#"..'..54>
-	0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x35, 0x33, // .7>.32......+.53
-	0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x02, 0x96, 0x16, 0x49, 0x32, 0xa3, 0x60, 0x43, 0x60, // ..........I2.`C`
-	0x78, 0x6d, 0x28, 0x29, 0x16, 0x15, 0xcf, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, // xm()...%8%..%8%%
-	0x51, 0x59, 0x61, 0x35, 0x35, 0x61, 0x5a, 0x52, 0x25, 0x24, 0x38, 0x24, 0x13, 0x13, 0x24, 0x38, // QYa55aZR%$8$..$8
-	0x24, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, 0x25, 0xfe, 0xe8, 0x09, 0x23, 0x19, // $%RZa55aYQ%...#.
-	0x46, 0x47, 0x43, 0x09, 0x0a, 0x09, 0x09, 0x02, 0x5e, 0x10, 0x10, 0xfe, 0x65, 0x84, 0x84, 0x93, // FGC.....^...e...
-	0x0f, 0x3f, 0x30, 0x24, 0x35, 0x11, 0xc9, 0x25, 0x52, 0x5a, 0x61, 0x35, 0x35, 0x61, 0x59, 0x51, // .?0$5..%RZa55aYQ
-	0x25, 0x25, 0x38, 0x25, 0x13, 0x13, 0x25, 0x38, 0x25, 0x25, 0x51, 0x59, 0x61, 0x35, 0x35, 0x61, // %%8%..%8%%QYa55a
-	0x5a, 0x52, 0x25, 0x24, 0x37, 0x25, 0x13, 0x13, 0x25, 0x37, 0x24, 0xfe, 0x9e, 0x08, 0x08, 0x7b, // ZR%$7%..%7$....{
-	0x0c, 0x07, 0x18, 0x11, 0x10, 0x17, 0x08, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc7, 0x03, 0xfa, // ................
-	0x03, 0xb9, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x01, 0x07, 0x16, 0x06, // .......2........
-	0x07, 0x33, 0x0e, 0x01, 0x07, 0x15, 0x14, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x2b, 0x01, 0x22, 0x26, // .3..........+."&
-	0x2f, 0x01, 0x2e, 0x01, 0x3d, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x37, 0x26, 0x36, 0x37, 0x3e, // /...=...'..7&67>
-	0x03, 0x33, 0x02, 0x00, 0x33, 0x5e, 0x57, 0x4f, 0x24, 0x51, 0x4f, 0x01, 0x02, 0x50, 0x51, 0x01, // .3..3^WO$QO..PQ.
-	0x22, 0x4c, 0x29, 0x10, 0x11, 0x02, 0x11, 0x27, 0x16, 0xa8, 0x17, 0x28, 0x10, 0x03, 0x0f, 0x10, // "L)....'...(....
-	0x29, 0x4c, 0x22, 0x50, 0x4f, 0x01, 0x01, 0x4f, 0x50, 0x24, 0x50, 0x57, 0x5e, 0x33, 0x03, 0xb9, // )L"PO..OP$PW^3..
-	0x0b, 0x17, 0x22, 0x16, 0x32, 0x7b, 0x4a, 0x49, 0x7b, 0x32, 0x16, 0x21, 0x0b, 0xf9, 0x17, 0x29, // ..".2{JI{2.!...)
-	0x11, 0x01, 0x0f, 0x0f, 0x0f, 0x0f, 0x04, 0x10, 0x27, 0x17, 0xf9, 0x0b, 0x21, 0x16, 0x32, 0x7b, // ........'...!.2{
-	0x49, 0x4a, 0x7b, 0x32, 0x16, 0x22, 0x17, 0x0b, 0x00, 0x01, 0x00, 0x52, 0xff, 0xc9, 0x03, 0xc8, // IJ{2.".....R....
-	0x03, 0xb9, 0x00, 0x2e, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x07, 0x17, 0x1e, 0x01, 0x0f, 0x01, 0x0e, // ................
-	0x01, 0x0f, 0x01, 0x0e, 0x01, 0x2f, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x0e, 0x01, 0x27, 0x2e, 0x01, // ...../.../...'..
-	0x27, 0x26, 0x36, 0x37, 0x3e, 0x03, 0x37, 0x3e, 0x03, 0x17, 0x1e, 0x01, 0x17, 0x16, 0x06, 0x07, // '&67>.7>........
-	0x37, 0x03, 0xa2, 0x13, 0x30, 0x1e, 0x7b, 0x0b, 0x07, 0x06, 0x03, 0x07, 0x19, 0x13, 0x8f, 0x14, // 7...0.{.........
-	0x28, 0x16, 0x04, 0x15, 0x21, 0x0b, 0x7b, 0x28, 0x51, 0x27, 0x5d, 0x80, 0x22, 0x26, 0x07, 0x2b, // (...!.{(Q']."&.+
-	0x14, 0x33, 0x3f, 0x4a, 0x2b, 0x2c, 0x56, 0x55, 0x54, 0x29, 0x5e, 0x80, 0x23, 0x26, 0x07, 0x2d, // .3?J+,VUT)^.#&.-
-	0x02, 0x02, 0x17, 0x24, 0x41, 0x1d, 0xd5, 0x14, 0x2a, 0x17, 0x03, 0x15, 0x1f, 0x0a, 0x53, 0x0c, // ...$A...*.....S.
-	0x07, 0x05, 0x03, 0x06, 0x1a, 0x13, 0xd5, 0x0c, 0x0a, 0x02, 0x04, 0x42, 0x3f, 0x3e, 0x90, 0x51, // ...........B?>.Q
-	0x25, 0x44, 0x3e, 0x38, 0x1a, 0x18, 0x25, 0x17, 0x0a, 0x02, 0x02, 0x42, 0x3f, 0x3d, 0x91, 0x53, // %D>8..%....B?=.S
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x38, 0xff, 0xc9, 0x03, 0xae, 0x03, 0xb9, 0x00, 0x2e, // .......8........
-	0x00, 0x00, 0x01, 0x1e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x17, 0x06, 0x26, 0x27, 0x07, 0x0e, 0x01, // ...........&'...
-	0x07, 0x23, 0x06, 0x26, 0x2f, 0x01, 0x2e, 0x01, 0x2f, 0x01, 0x26, 0x36, 0x3f, 0x01, 0x2e, 0x01, // .#.&/.../.&6?...
-	0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x17, 0x03, 0xa1, // '..7>.76........
-	0x2c, 0x07, 0x26, 0x21, 0x81, 0x5e, 0x01, 0x27, 0x51, 0x28, 0x7b, 0x0c, 0x22, 0x16, 0x03, 0x16, // ,.&!.^.'Q({."...
-	0x29, 0x12, 0x90, 0x13, 0x1a, 0x06, 0x01, 0x05, 0x06, 0x0b, 0x7b, 0x1e, 0x30, 0x13, 0x2b, 0x06, // ).........{.0.+.
-	0x25, 0x22, 0x80, 0x5d, 0x2a, 0x54, 0x55, 0x56, 0x2b, 0x2c, 0x4b, 0x3f, 0x32, 0x14, 0x02, 0x64, // %".]*TUV+,K?2..d
-	0x52, 0x91, 0x3e, 0x3f, 0x41, 0x03, 0x01, 0x02, 0x0a, 0x0b, 0xd5, 0x14, 0x1a, 0x06, 0x04, 0x06, // R.>?A...........
-	0x0a, 0x53, 0x0c, 0x20, 0x14, 0x05, 0x16, 0x28, 0x14, 0xd4, 0x1e, 0x41, 0x23, 0x52, 0x90, 0x3e, // .S. ...(...A#R.>
-	0x3f, 0x42, 0x03, 0x02, 0x0a, 0x18, 0x25, 0x19, 0x19, 0x37, 0x3e, 0x44, 0x25, 0x00, 0x00, 0x00, // ?B....%..7>D%...
-	0x00, 0x01, 0x00, 0x07, 0x00, 0x0b, 0x02, 0x2e, 0x02, 0x4a, 0x00, 0x1c, 0x00, 0x00, 0x13, 0x14, // .........J......
-	0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x35, 0x33, 0x15, 0x27, 0x22, 0x26, 0x27, 0x2e, // ........53.'"&'.
-	0x01, 0x27, 0x2e, 0x03, 0x35, 0x23, 0x37, 0x17, 0x23, 0xa7, 0x33, 0x32, 0x18, 0x35, 0x1d, 0x16, // .'..5#7.#.32.5..
-	0x2e, 0x19, 0x5b, 0x2e, 0x24, 0x45, 0x21, 0x30, 0x55, 0x26, 0x20, 0x2f, 0x20, 0x10, 0x45, 0x72, // ..[.$E!0U& / .Er
-	0x72, 0x44, 0x01, 0xc1, 0x48, 0x7a, 0x33, 0x18, 0x25, 0x0d, 0x09, 0x0c, 0x03, 0x45, 0xa4, 0x02, // rD..Hz3.%....E..
-	0x0a, 0x0a, 0x0f, 0x35, 0x26, 0x20, 0x47, 0x4d, 0x55, 0x2d, 0x89, 0x89, 0x00, 0x01, 0x01, 0xcf, // ...5& GMU-......
-	0x00, 0x0b, 0x03, 0xf6, 0x02, 0x49, 0x00, 0x1d, 0x00, 0x00, 0x25, 0x35, 0x33, 0x15, 0x3e, 0x01, // .....I....%53.>.
-	0x37, 0x3e, 0x01, 0x35, 0x23, 0x37, 0x17, 0x23, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, // 7>.5#7.#......#"
-	0x26, 0x27, 0x2e, 0x01, 0x35, 0x01, 0xcf, 0x5b, 0x3a, 0x64, 0x2a, 0x32, 0x32, 0x44, 0x72, 0x72, // &'..5..[:d*22Drr
-	0x45, 0x0f, 0x20, 0x2f, 0x20, 0x20, 0x47, 0x4d, 0x55, 0x2d, 0x0a, 0x10, 0x06, 0x07, 0x07, 0x39, // E. /  GMU-.....9
-	0x75, 0x45, 0x07, 0x31, 0x2a, 0x33, 0x7a, 0x48, 0x89, 0x89, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, // uE.1*3zH...TNF  
-	0x2f, 0x20, 0x10, 0x07, 0x06, 0x07, 0x10, 0x0a, 0x00, 0x01, 0x01, 0x79, 0x00, 0x0b, 0x03, 0xb6, // / .........y....
-	0x03, 0xba, 0x00, 0x2d, 0x00, 0x00, 0x01, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, // ...-............
-	0x03, 0x23, 0x07, 0x35, 0x33, 0x15, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x2f, 0x01, // .#.53.>.7>.54&/.
-	0x33, 0x2e, 0x01, 0x23, 0x15, 0x27, 0x37, 0x15, 0x32, 0x1e, 0x02, 0x17, 0x15, 0x33, 0x03, 0x32, // 3..#.'7.2....3.2
-	0x05, 0x20, 0x30, 0x1f, 0x10, 0x10, 0x1f, 0x30, 0x20, 0x1f, 0x47, 0x4e, 0x54, 0x2e, 0x2d, 0x5b, // . 0....0 .GNT.-[
-	0x39, 0x64, 0x2a, 0x33, 0x32, 0x32, 0x33, 0x05, 0x01, 0x32, 0x79, 0x46, 0x88, 0x88, 0x2c, 0x53, // 9d*3223..2yF..,S
-	0x4b, 0x46, 0x20, 0x01, 0x02, 0xfc, 0x06, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x2e, 0x54, 0x4d, 0x47, // KF .... FMT..TMG
-	0x20, 0x20, 0x2f, 0x20, 0x0f, 0x02, 0xa8, 0x49, 0x07, 0x31, 0x2a, 0x33, 0x7a, 0x48, 0x48, 0x7a, //   / ...I.1*3zHHz
-	0x32, 0x06, 0x30, 0x2f, 0x44, 0x72, 0x72, 0x44, 0x0f, 0x1f, 0x2d, 0x1e, 0x01, 0x00, 0x00, 0x00, // 2.0/DrrD..-.....
-	0x00, 0x01, 0x00, 0x4c, 0x00, 0x0b, 0x02, 0x89, 0x03, 0xba, 0x00, 0x28, 0x00, 0x00, 0x01, 0x35, // ...L.......(...5
-	0x17, 0x07, 0x35, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x35, // ..5"...........5
-	0x33, 0x15, 0x27, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, // 3.'"..'..54>.7>.
-	0x33, 0x02, 0x00, 0x89, 0x89, 0x48, 0x7a, 0x32, 0x32, 0x33, 0x33, 0x32, 0x2a, 0x63, 0x3a, 0x5b, // 3....Hz22332*c:[
-	0x2e, 0x2d, 0x55, 0x4d, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, // .-UMF  / .. /  F
-	0x4d, 0x55, 0x2d, 0x03, 0x76, 0x44, 0x72, 0x72, 0x44, 0x32, 0x33, 0x32, 0x7a, 0x48, 0x48, 0x7a, // MU-.vDrrD232zHHz
-	0x33, 0x2a, 0x31, 0x07, 0x49, 0xa8, 0x02, 0x0f, 0x20, 0x2f, 0x20, 0x20, 0x47, 0x4d, 0x54, 0x2e, // 3*1.I... /  GMT.
-	0x2e, 0x54, 0x4d, 0x46, 0x20, 0x20, 0x30, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x49, // .TMF  0 .......I
-	0xff, 0xc9, 0x02, 0x87, 0x01, 0xf0, 0x00, 0x1d, 0x00, 0x00, 0x13, 0x15, 0x23, 0x1e, 0x01, 0x17, // ............#...
-	0x1e, 0x01, 0x33, 0x35, 0x17, 0x07, 0x35, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x36, // ..35..5"..'..546
-	0x37, 0x3e, 0x01, 0x3b, 0x01, 0xec, 0x44, 0x06, 0x31, 0x2b, 0x32, 0x7a, 0x48, 0x89, 0x89, 0x2e, // 7>.;..D.1+2zH...
-	0x54, 0x4d, 0x46, 0x20, 0x20, 0x30, 0x20, 0x10, 0x07, 0x07, 0x06, 0x10, 0x0a, 0x75, 0x01, 0xf0, // TMF  0 ......u..
-	0x5b, 0x3a, 0x64, 0x2a, 0x32, 0x32, 0x44, 0x72, 0x72, 0x45, 0x0f, 0x20, 0x2f, 0x20, 0x20, 0x47, // [:d*22DrrE. /  G
-	0x4d, 0x55, 0x2d, 0x0a, 0x10, 0x06, 0x07, 0x07, 0x00, 0x01, 0x00, 0x4c, 0x01, 0x39, 0x03, 0xfa, // MU-........L.9..
-	0x03, 0x76, 0x00, 0x2c, 0x00, 0x00, 0x13, 0x23, 0x37, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x01, 0x37, // .v.,...#74>.7>.7
-	0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x33, 0x07, 0x27, 0x33, 0x34, 0x26, // >.32......3.'34&
-	0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x33, 0x15, 0xf3, // '..#"........3..
-	0xa7, 0x01, 0x10, 0x20, 0x30, 0x1f, 0x26, 0x56, 0x2f, 0x21, 0x45, 0x24, 0x2e, 0x54, 0x4e, 0x47, // ... 0.&V/!E$.TNG
-	0x1f, 0x20, 0x30, 0x1f, 0x10, 0x44, 0x72, 0x72, 0x45, 0x32, 0x33, 0x32, 0x7b, 0x48, 0x25, 0x45, // . 0..DrrE232{H%E
-	0x1f, 0x1e, 0x35, 0x17, 0x2b, 0x31, 0x07, 0x48, 0x01, 0x94, 0x2e, 0x2d, 0x55, 0x4d, 0x46, 0x20, // ..5.+1.H...-UMF 
-	0x26, 0x35, 0x10, 0x0a, 0x0a, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4d, 0x55, 0x2d, 0x89, 0x89, // &5.... /  FMU-..
-	0x48, 0x7a, 0x32, 0x32, 0x33, 0x0e, 0x0d, 0x0d, 0x25, 0x18, 0x2a, 0x63, 0x3a, 0x5b, 0x00, 0x00, // Hz223...%.*c:[..
-	0x00, 0x01, 0x00, 0x4c, 0x00, 0x0b, 0x03, 0xfa, 0x02, 0x49, 0x00, 0x28, 0x00, 0x00, 0x13, 0x27, // ...L.....I.(...'
-	0x33, 0x15, 0x23, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x3f, // 3.#......3267>.?
-	0x01, 0x23, 0x37, 0x17, 0x23, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, // .#7.#......#"..'
-	0x2e, 0x01, 0x2f, 0x01, 0x4d, 0x01, 0xa7, 0x48, 0x04, 0x08, 0x30, 0x26, 0x33, 0x7a, 0x47, 0x48, // ../.M..H..0&3zGH
-	0x7b, 0x32, 0x27, 0x2f, 0x09, 0x06, 0x45, 0x72, 0x72, 0x44, 0x05, 0x09, 0x3d, 0x34, 0x1f, 0x47, // {2'/..ErrD..=4.G
-	0x4e, 0x54, 0x2e, 0x2d, 0x54, 0x4e, 0x46, 0x20, 0x33, 0x3e, 0x0a, 0x04, 0x01, 0xc0, 0x2e, 0x5c, // NT.-TNF 3>......
-	0x15, 0x33, 0x59, 0x26, 0x32, 0x33, 0x33, 0x32, 0x26, 0x59, 0x33, 0x43, 0x89, 0x89, 0x43, 0x46, // .3Y&2332&Y3C..CF
-	0x79, 0x34, 0x20, 0x2f, 0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x34, 0x79, 0x46, 0x43, 0x00, 0x00, // y4 / .. / 4yFC..
-	0x00, 0x01, 0x00, 0x4c, 0x01, 0x94, 0x02, 0x8a, 0x03, 0xbb, 0x00, 0x1d, 0x00, 0x00, 0x01, 0x07, // ...L............
-	0x35, 0x22, 0x06, 0x0f, 0x01, 0x0e, 0x01, 0x07, 0x33, 0x15, 0x23, 0x37, 0x34, 0x36, 0x37, 0x3e, // 5"......3.#7467>
-	0x01, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x3e, 0x01, 0x3f, 0x01, 0x35, 0x17, 0x02, 0x8a, 0x89, 0x45, // .7>.?.>.?.5....E
-	0x77, 0x31, 0x07, 0x2a, 0x31, 0x07, 0x45, 0xa4, 0x01, 0x27, 0x27, 0x0b, 0x18, 0x0e, 0x18, 0x34, // w1.*1.E..''....4
-	0x1c, 0x02, 0x22, 0x48, 0x27, 0x3a, 0x89, 0x03, 0x49, 0x72, 0x44, 0x2f, 0x2f, 0x07, 0x2a, 0x63, // .."H':..IrD//.*c
-	0x3a, 0x5b, 0x2e, 0x47, 0x7d, 0x36, 0x10, 0x1d, 0x0e, 0x18, 0x27, 0x0f, 0x01, 0x12, 0x16, 0x05, // :[.G}6....'.....
-	0x03, 0x45, 0x72, 0x00, 0x00, 0x01, 0x01, 0x77, 0xff, 0xc9, 0x03, 0xb5, 0x01, 0xf0, 0x00, 0x1d, // .Er....w........
-	0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x15, 0x27, 0x37, // ............#.'7
-	0x15, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x23, 0x35, 0x33, 0x32, 0x16, 0x17, 0x03, 0xa8, 0x06, // .267>.7#532.....
-	0x07, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x47, 0x4d, 0x54, 0x2e, 0x89, 0x89, 0x48, 0x7a, 0x33, 0x2a, // .. /  GMT...Hz3*
-	0x31, 0x07, 0x49, 0x79, 0x0a, 0x10, 0x07, 0x01, 0xe2, 0x06, 0x10, 0x0a, 0x2d, 0x55, 0x4d, 0x47, // 1.Iy........-UMG
-	0x20, 0x1f, 0x30, 0x20, 0x0f, 0x45, 0x72, 0x72, 0x44, 0x32, 0x32, 0x2a, 0x64, 0x3a, 0x5b, 0x07, //  .0 .ErrD22*d:[.
-	0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0b, 0x03, 0xb6, 0x02, 0x49, 0x00, 0x2a, // .............I.*
-	0x00, 0x00, 0x25, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x23, 0x35, 0x33, 0x0f, 0x01, 0x0e, // ..%267>.?.#53...
-	0x01, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x01, 0x2f, 0x01, 0x23, 0x37, 0x17, // ....#"..'../.#7.
-	0x23, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x33, 0x02, 0x00, 0x48, 0x7b, 0x32, 0x26, // #........3..H{2&
-	0x30, 0x09, 0x03, 0x49, 0xa8, 0x01, 0x05, 0x09, 0x3d, 0x34, 0x20, 0x46, 0x4e, 0x54, 0x2e, 0x2d, // 0..I....=4 FNT.-
-	0x55, 0x4d, 0x46, 0x20, 0x34, 0x3d, 0x0a, 0x04, 0x45, 0x72, 0x72, 0x44, 0x03, 0x03, 0x09, 0x30, // UMF 4=..ErrD...0
-	0x26, 0x32, 0x7a, 0x48, 0x67, 0x32, 0x32, 0x26, 0x59, 0x33, 0x15, 0x5b, 0x2d, 0x43, 0x46, 0x79, // &2zHg22&Y3.[-CFy
-	0x34, 0x20, 0x2f, 0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x34, 0x79, 0x46, 0x43, 0x89, 0x89, 0x12, // 4 / .. / 4yFC...
-	0x21, 0x10, 0x33, 0x59, 0x26, 0x32, 0x32, 0x00, 0x00, 0x01, 0x00, 0x07, 0x01, 0x39, 0x03, 0xb6, // !.3Y&22......9..
-	0x03, 0x76, 0x00, 0x28, 0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x23, // .v.(...#53..'..#
-	0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x33, 0x07, 0x27, 0x33, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, // ".....3.'34>.7>.
-	0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x17, 0x03, 0xb6, 0xa8, 0x49, 0x06, 0x32, 0x2a, // 32..........I.2*
-	0x32, 0x7b, 0x48, 0x48, 0x7a, 0x32, 0x32, 0x33, 0x44, 0x72, 0x72, 0x45, 0x10, 0x20, 0x2f, 0x20, // 2{HHz223DrrE. / 
-	0x20, 0x46, 0x4d, 0x55, 0x2d, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x01, 0x01, //  FMU-.TNF  / ...
-	0x94, 0x5b, 0x3a, 0x63, 0x2a, 0x32, 0x33, 0x33, 0x32, 0x32, 0x7a, 0x48, 0x89, 0x89, 0x2d, 0x55, // .[:c*23322zH..-U
-	0x4d, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4d, 0x55, 0x2d, // MF  / .. /  FMU-
-	0x2e, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x76, 0x01, 0x94, 0x03, 0xb5, 0x03, 0xbb, 0x00, 0x18, // .......v........
-	0x00, 0x00, 0x01, 0x23, 0x35, 0x33, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x23, 0x15, 0x27, 0x37, 0x15, // ...#53..'..#.'7.
-	0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x17, 0x03, 0xb5, 0xa8, 0x49, 0x07, 0x31, 0x2a, 0x33, // 2..........I.1*3
-	0x7a, 0x48, 0x89, 0x89, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x01, 0x01, 0x94, // zH...TNF  / ....
-	0x5b, 0x3a, 0x63, 0x2a, 0x32, 0x33, 0x44, 0x72, 0x72, 0x45, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, // [:c*23DrrE. /  F
-	0x4d, 0x55, 0x2d, 0x2e, 0x00, 0x01, 0x01, 0x76, 0xff, 0xc9, 0x03, 0xb4, 0x03, 0x78, 0x00, 0x2b, // MU-....v.....x.+
-	0x00, 0x00, 0x01, 0x15, 0x23, 0x35, 0x17, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, // ....#5.2........
-	0x02, 0x0f, 0x01, 0x23, 0x0e, 0x03, 0x23, 0x15, 0x27, 0x37, 0x15, 0x32, 0x36, 0x3f, 0x01, 0x3e, // ...#..#.'7.26?.>
-	0x01, 0x35, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x02, 0x2d, 0x5c, 0x2e, 0x2e, 0x54, 0x4e, 0x46, // .54&'..'.-...TNF
-	0x20, 0x20, 0x2f, 0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x06, 0x01, 0x1f, 0x46, 0x4c, 0x52, 0x2c, //   / .. / ...FLR,
-	0x89, 0x89, 0x46, 0x77, 0x32, 0x06, 0x32, 0x32, 0x32, 0x32, 0x2a, 0x64, 0x39, 0x03, 0x18, 0x48, // ..Fw2.2222*d9..H
-	0xa8, 0x01, 0x10, 0x20, 0x30, 0x20, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x2d, 0x55, 0x4d, 0x47, 0x20, // ... 0  FMT.-UMG 
-	0x06, 0x1e, 0x2d, 0x1e, 0x0f, 0x45, 0x72, 0x72, 0x44, 0x2f, 0x2f, 0x06, 0x33, 0x7a, 0x48, 0x48, // ..-..ErrD//.3zHH
-	0x7a, 0x32, 0x2b, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4c, 0xff, 0xc9, 0x02, 0x89, // z2+1.......L....
-	0x03, 0x78, 0x00, 0x28, 0x00, 0x00, 0x01, 0x37, 0x15, 0x23, 0x35, 0x0e, 0x01, 0x07, 0x0e, 0x01, // .x.(...7.#5.....
-	0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, 0x35, 0x17, 0x07, 0x35, 0x22, 0x2e, 0x02, 0x27, 0x2e, // ......35..5"..'.
-	0x03, 0x35, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x02, 0x00, 0x2e, 0x5b, 0x3a, 0x63, 0x2a, // .54>.7>.3...[:c*
-	0x32, 0x33, 0x33, 0x32, 0x32, 0x7a, 0x48, 0x89, 0x89, 0x2d, 0x55, 0x4d, 0x46, 0x20, 0x20, 0x2f, // 23322zH..-UMF  /
-	0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4d, 0x55, 0x2d, 0x03, 0x77, 0x01, 0xa8, 0x48, //  .. /  FMU-.w..H
-	0x06, 0x31, 0x2b, 0x32, 0x7a, 0x48, 0x48, 0x7a, 0x33, 0x32, 0x32, 0x44, 0x72, 0x72, 0x45, 0x0f, // .1+2zHHz322DrrE.
-	0x20, 0x30, 0x1f, 0x20, 0x47, 0x4d, 0x55, 0x2d, 0x2e, 0x54, 0x4d, 0x46, 0x20, 0x20, 0x30, 0x20, //  0. GMU-.TMF  0 
-	0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x01, 0x39, 0x02, 0x2e, 0x03, 0x77, 0x00, 0x1c, // .........9...w..
-	0x00, 0x00, 0x01, 0x35, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x15, 0x33, 0x07, 0x27, // ...5.........3.'
-	0x33, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x37, 0x15, 0x23, 0x01, 0xd3, // 34>.7>.7>.37.#..
-	0x19, 0x2e, 0x16, 0x1d, 0x35, 0x18, 0x32, 0x33, 0x44, 0x72, 0x72, 0x45, 0x10, 0x20, 0x2f, 0x20, // ....5.23DrrE. / 
-	0x26, 0x55, 0x30, 0x21, 0x45, 0x24, 0x2e, 0x5b, 0x02, 0xd0, 0x48, 0x03, 0x0c, 0x09, 0x0d, 0x25, // &U0!E$.[..H....%
-	0x18, 0x32, 0x7a, 0x48, 0x89, 0x89, 0x2d, 0x55, 0x4d, 0x46, 0x20, 0x26, 0x35, 0x10, 0x0a, 0x0a, // .2zH..-UMF &5...
-	0x01, 0xa7, 0x00, 0x00, 0x00, 0x01, 0x01, 0xd2, 0x01, 0x39, 0x03, 0xf8, 0x03, 0x76, 0x00, 0x1d, // .........9...v..
-	0x00, 0x00, 0x01, 0x2e, 0x01, 0x27, 0x15, 0x23, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, // .....'.#5467>.32
-	0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x33, 0x07, 0x27, 0x33, 0x34, 0x26, 0x27, 0x02, 0xf4, 0x2a, // ......3.'34&'..*
-	0x64, 0x39, 0x5b, 0x06, 0x07, 0x06, 0x10, 0x0a, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, // d9[......TNF  / 
-	0x10, 0x44, 0x72, 0x72, 0x44, 0x32, 0x32, 0x02, 0xb6, 0x2a, 0x31, 0x07, 0x48, 0x79, 0x09, 0x10, // .DrrD22..*1.Hy..
-	0x07, 0x06, 0x07, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4d, 0x55, 0x2d, 0x89, 0x89, 0x48, 0x7a, // .... /  FMU-..Hz
-	0x32, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0b, 0x03, 0x12, 0x02, 0xd3, 0x00, 0x31, // 2..............1
-	0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x33, // ...2...........3
-	0x15, 0x27, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x23, 0x37, 0x17, 0x23, 0x14, 0x16, 0x17, // .'"..'..5#7.#...
-	0x1e, 0x01, 0x17, 0x35, 0x33, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, // ...53..'..5467>.
-	0x33, 0x02, 0x00, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x5e, 0x37, 0x28, 0x2e, 0x2d, // 3..9a((((('^7(.-
-	0x55, 0x4d, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x45, 0x72, 0x72, 0x44, 0x33, 0x32, 0x2a, 0x63, // UMF  / .ErrD32*c
-	0x3a, 0x28, 0x38, 0x5e, 0x27, 0x27, 0x28, 0x28, 0x27, 0x28, 0x61, 0x39, 0x02, 0xd3, 0x28, 0x28, // :(8^''(('(a9..((
-	0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x26, 0x28, 0x02, 0xa4, 0x02, 0x0f, 0x20, 0x2f, 0x20, 0x20, // (a99a(&(.... /  
-	0x47, 0x4d, 0x55, 0x2d, 0x89, 0x89, 0x48, 0x7a, 0x33, 0x2a, 0x31, 0x07, 0x46, 0x01, 0x28, 0x26, // GMU-..Hz3*1.F.(&
-	0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x00, 0x01, 0x00, 0xeb, 0x00, 0x0b, 0x03, 0xf6, // (a99a(((........
-	0x02, 0xd1, 0x00, 0x36, 0x00, 0x00, 0x13, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, // ...6...467>.32..
-	0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x33, 0x15, 0x3e, 0x01, 0x37, 0x3e, 0x01, // .........3.>.7>.
-	0x35, 0x23, 0x37, 0x17, 0x23, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x26, 0x27, 0x2e, // 5#7.#......#"&'.
-	0x01, 0x3d, 0x01, 0x33, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0xeb, 0x28, 0x28, 0x28, 0x61, 0x39, // .=.3..'..5.(((a9
-	0x39, 0x61, 0x28, 0x28, 0x27, 0x27, 0x28, 0x27, 0x5e, 0x37, 0x27, 0x3a, 0x64, 0x2a, 0x32, 0x32, // 9a((''('^7':d*22
-	0x44, 0x72, 0x72, 0x45, 0x0f, 0x20, 0x2f, 0x20, 0x20, 0x47, 0x4d, 0x55, 0x2d, 0x0a, 0x10, 0x06, // DrrE. /  GMU-...
-	0x07, 0x07, 0x28, 0x37, 0x5e, 0x27, 0x28, 0x28, 0x01, 0xc0, 0x39, 0x61, 0x28, 0x28, 0x27, 0x27, // ..(7^'((..9a((''
-	0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x27, 0x28, 0x01, 0x45, 0x07, 0x31, 0x2a, 0x33, 0x7a, // ((a99a('(.E.1*3z
-	0x48, 0x89, 0x89, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x07, 0x06, 0x07, 0x10, // H...TNF  / .....
-	0x0a, 0x75, 0x01, 0x28, 0x27, 0x28, 0x61, 0x39, 0x00, 0x01, 0x00, 0xf0, 0x00, 0x0b, 0x03, 0xb6, // .u.('(a9........
-	0x03, 0xba, 0x00, 0x44, 0x00, 0x00, 0x01, 0x15, 0x33, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, // ...D....3.......
-	0x07, 0x0e, 0x03, 0x23, 0x07, 0x35, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, // ...#.5..'..5467>
-	0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x15, 0x3e, // .32............>
-	0x01, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x2f, 0x01, 0x33, 0x2e, 0x01, 0x23, 0x15, 0x27, 0x37, // .7>.54&/.3..#.'7
-	0x15, 0x32, 0x1e, 0x02, 0x17, 0x03, 0x31, 0x01, 0x05, 0x20, 0x30, 0x1f, 0x10, 0x10, 0x1f, 0x30, // .2....1.. 0....0
-	0x20, 0x1f, 0x47, 0x4e, 0x54, 0x2e, 0x2d, 0x2a, 0x4b, 0x1f, 0x28, 0x28, 0x28, 0x28, 0x27, 0x61, //  .GNT.-*K.(((('a
-	0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x4a, 0x2a, 0x39, 0x64, 0x2a, 0x33, 0x32, // 99a((((( J*9d*32
-	0x32, 0x33, 0x05, 0x01, 0x32, 0x79, 0x46, 0x88, 0x88, 0x2d, 0x52, 0x4b, 0x46, 0x20, 0x02, 0xfd, // 23..2yF..-RKF ..
-	0x01, 0x06, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x2e, 0x54, 0x4d, 0x47, 0x20, 0x20, 0x2f, 0x20, 0x0f, // .. FMT..TMG  / .
-	0x02, 0xa8, 0x06, 0x26, 0x20, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, // ...& (a99a((((((
-	0x61, 0x39, 0x39, 0x61, 0x28, 0x20, 0x26, 0x06, 0x49, 0x07, 0x31, 0x2a, 0x33, 0x7a, 0x48, 0x48, // a99a( &.I.1*3zHH
-	0x7a, 0x32, 0x06, 0x30, 0x2f, 0x44, 0x72, 0x72, 0x44, 0x0f, 0x1f, 0x2d, 0x1e, 0x00, 0x00, 0x00, // z2.0/DrrD..-....
-	0x00, 0x01, 0x00, 0x4c, 0x00, 0x0b, 0x03, 0x12, 0x03, 0xba, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x34, // ...L.......?...4
-	0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x35, 0x17, 0x07, 0x35, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x15, // >.7>.35..5".....
-	0x14, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x35, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, // ......5..'..5467
-	0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x15, // >.32............
-	0x27, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x4c, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4d, // '"..'..5L. /  FM
-	0x55, 0x2d, 0x89, 0x89, 0x48, 0x7a, 0x32, 0x32, 0x33, 0x33, 0x32, 0x2a, 0x63, 0x3a, 0x2b, 0x4a, // U-..Hz22332*c:+J
-	0x20, 0x27, 0x28, 0x28, 0x27, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, //  '(('(a99a((((( 
-	0x4a, 0x2a, 0x2e, 0x2d, 0x55, 0x4d, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x01, 0xc1, 0x2e, 0x54, // J*.-UMF  / ....T
-	0x4d, 0x46, 0x20, 0x20, 0x30, 0x20, 0x10, 0x44, 0x72, 0x72, 0x44, 0x32, 0x33, 0x32, 0x7a, 0x48, // MF  0 .DrrD232zH
-	0x48, 0x7a, 0x33, 0x2a, 0x31, 0x07, 0x49, 0x06, 0x26, 0x20, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, // Hz3*1.I.& (a99a(
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x20, 0x26, 0x06, 0xa8, 0x02, 0x0f, // (((((a99a( &....
-	0x20, 0x2f, 0x20, 0x20, 0x47, 0x4d, 0x54, 0x2e, 0x00, 0x01, 0x00, 0x49, 0xff, 0xc9, 0x03, 0x10, //  /  GMT....I....
-	0x02, 0xd4, 0x00, 0x36, 0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, // ...6...........#
-	0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x15, 0x23, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x33, 0x35, 0x17, // "&'..'.#.....35.
-	0x07, 0x35, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3b, 0x01, // .5"..'..5467>.;.
-	0x15, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x02, 0xc0, 0x28, 0x28, 0x28, 0x28, // .>.7>.32....((((
-	0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x27, 0x27, 0x02, 0x44, 0x06, 0x31, 0x2b, 0x32, 0x7a, 0x48, // (a99a(''.D.1+2zH
-	0x89, 0x89, 0x2e, 0x54, 0x4d, 0x46, 0x20, 0x20, 0x30, 0x20, 0x10, 0x07, 0x07, 0x06, 0x10, 0x0a, // ...TMF  0 ......
-	0x75, 0x02, 0x27, 0x27, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x02, 0x84, 0x28, 0x61, 0x39, 0x39, // u.''(a99a(..(a99
-	0x61, 0x28, 0x27, 0x28, 0x28, 0x27, 0x27, 0x5e, 0x37, 0x27, 0x3a, 0x64, 0x2a, 0x32, 0x32, 0x44, // a('((''^7':d*22D
-	0x72, 0x72, 0x45, 0x0f, 0x20, 0x2f, 0x20, 0x20, 0x47, 0x4d, 0x55, 0x2d, 0x0a, 0x10, 0x06, 0x07, // rrE. /  GMU-....
-	0x07, 0x28, 0x37, 0x5e, 0x27, 0x28, 0x28, 0x28, 0x28, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4c, // .(7^'((((......L
-	0x00, 0xb0, 0x03, 0xfa, 0x03, 0x77, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x3e, 0x03, 0x33, 0x32, 0x1e, // .....w.?...>.32.
-	0x02, 0x17, 0x1e, 0x03, 0x15, 0x33, 0x07, 0x27, 0x33, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x23, 0x22, // .....3.'34&'..#"
-	0x06, 0x07, 0x0e, 0x01, 0x07, 0x33, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, // .....3>.7>.32...
-	0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x23, 0x37, // .......#"&'..'#7
-	0x34, 0x3e, 0x02, 0x37, 0xcc, 0x20, 0x46, 0x4e, 0x54, 0x2d, 0x2e, 0x54, 0x4e, 0x47, 0x1f, 0x20, // 4>.7. FNT-.TNG. 
-	0x30, 0x1f, 0x10, 0x44, 0x72, 0x72, 0x45, 0x32, 0x33, 0x32, 0x7b, 0x48, 0x47, 0x7a, 0x32, 0x2b, // 0..DrrE232{HGz2+
-	0x31, 0x07, 0x48, 0x07, 0x26, 0x20, 0x28, 0x60, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, // 1.H.& (`99a(((((
-	0x28, 0x61, 0x39, 0x39, 0x60, 0x28, 0x20, 0x26, 0x07, 0xa7, 0x01, 0x10, 0x20, 0x30, 0x1f, 0x02, // (a99`( &.... 0..
-	0xf7, 0x20, 0x30, 0x20, 0x10, 0x10, 0x20, 0x30, 0x20, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x89, 0x89, // . 0 .. 0  FMT...
-	0x48, 0x7a, 0x32, 0x33, 0x32, 0x32, 0x33, 0x2a, 0x63, 0x39, 0x2a, 0x4a, 0x20, 0x28, 0x28, 0x28, // Hz23223*c9*J (((
-	0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x4a, 0x2a, 0x2e, 0x2e, // ((a99a((((( J*..
-	0x54, 0x4d, 0x46, 0x20, 0x00, 0x01, 0x00, 0x4c, 0x00, 0x0b, 0x03, 0xfa, 0x02, 0xd1, 0x00, 0x3f, // TMF ...L.......?
-	0x00, 0x00, 0x01, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, // ...2..........#"
-	0x26, 0x27, 0x2e, 0x01, 0x27, 0x23, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x33, 0x32, 0x36, 0x37, 0x3e, // &'..'#.....3267>
-	0x01, 0x35, 0x23, 0x37, 0x17, 0x23, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, 0x2e, 0x02, // .5#7.#......#"..
-	0x27, 0x2e, 0x03, 0x35, 0x27, 0x33, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x33, 0x02, 0x01, 0x39, 0x61, // '..5'3>.7>.3..9a
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x27, 0x20, 0x27, 0x06, 0x48, 0x07, // ((((((a99a' '.H.
-	0x31, 0x2a, 0x33, 0x7a, 0x47, 0x48, 0x7b, 0x32, 0x33, 0x32, 0x45, 0x72, 0x72, 0x44, 0x10, 0x1f, // 1*3zGH{232ErrD..
-	0x30, 0x20, 0x1f, 0x47, 0x4e, 0x54, 0x2e, 0x2d, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, // 0 .GNT.-TNF  / .
-	0x01, 0xa7, 0x06, 0x27, 0x1f, 0x28, 0x61, 0x39, 0x02, 0xd1, 0x27, 0x28, 0x28, 0x61, 0x39, 0x39, // ...'.(a9..'((a99
-	0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x4a, 0x2a, 0x39, 0x64, 0x2a, 0x32, 0x32, 0x32, 0x32, // a((((( J*9d*2222
-	0x33, 0x7a, 0x48, 0x89, 0x89, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x10, 0x20, // 3zH...TNF  / .. 
-	0x2f, 0x20, 0x20, 0x46, 0x4e, 0x54, 0x2e, 0x2e, 0x2a, 0x4a, 0x20, 0x28, 0x27, 0x00, 0x00, 0x00, // /  FNT..*J ('...
-	0x00, 0x01, 0x00, 0x4c, 0x00, 0xb0, 0x03, 0x13, 0x03, 0xbb, 0x00, 0x30, 0x00, 0x00, 0x01, 0x37, // ...L.......0...7
-	0x35, 0x17, 0x07, 0x35, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x33, 0x15, 0x3e, 0x01, 0x37, 0x3e, // 5..5".....3.>.7>
-	0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, // .32..........#"&
-	0x27, 0x2e, 0x01, 0x27, 0x15, 0x23, 0x37, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x01, 0x37, 0x01, 0xc7, // '..'.#74>.7>.7..
-	0x3a, 0x89, 0x89, 0x47, 0x7a, 0x33, 0x2a, 0x31, 0x07, 0x45, 0x01, 0x28, 0x27, 0x27, 0x61, 0x39, // :..Gz3*1.E.(''a9
-	0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x27, 0x27, 0x28, 0x01, // 9a((((((a99a''(.
-	0xa4, 0x01, 0x10, 0x20, 0x30, 0x1f, 0x35, 0x7e, 0x48, 0x03, 0x73, 0x04, 0x44, 0x72, 0x72, 0x44, // ... 0.5~H.s.DrrD
-	0x32, 0x33, 0x2a, 0x63, 0x39, 0x28, 0x37, 0x5e, 0x27, 0x28, 0x27, 0x27, 0x28, 0x28, 0x61, 0x39, // 23*c9(7^'(''((a9
-	0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x27, 0x5e, 0x37, 0x28, 0x2e, 0x2e, 0x54, 0x4d, 0x46, // 9a((((('^7(..TMF
-	0x20, 0x35, 0x3f, 0x08, 0x00, 0x01, 0x00, 0xf0, 0xff, 0xc9, 0x03, 0xb6, 0x02, 0xd4, 0x00, 0x34, //  5?............4
-	0x00, 0x00, 0x01, 0x1e, 0x01, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x15, 0x27, 0x37, // ............#.'7
-	0x15, 0x32, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x23, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, // .267>.7#.....#"&
-	0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x17, // '..5467>.32.....
-	0x33, 0x32, 0x16, 0x17, 0x03, 0xa9, 0x07, 0x06, 0x10, 0x1f, 0x30, 0x20, 0x1f, 0x47, 0x4e, 0x54, // 32........0 .GNT
-	0x2e, 0x88, 0x88, 0x48, 0x7b, 0x32, 0x2b, 0x31, 0x06, 0x48, 0x07, 0x26, 0x20, 0x28, 0x61, 0x39, // ...H{2+1.H.& (a9
-	0x39, 0x61, 0x27, 0x28, 0x28, 0x28, 0x28, 0x27, 0x61, 0x39, 0x39, 0x61, 0x28, 0x20, 0x26, 0x07, // 9a'(((('a99a( &.
-	0x78, 0x0a, 0x11, 0x06, 0x01, 0xe2, 0x06, 0x10, 0x0a, 0x2d, 0x55, 0x4d, 0x47, 0x20, 0x1f, 0x30, // x........-UMG .0
-	0x20, 0x0f, 0x45, 0x72, 0x72, 0x44, 0x32, 0x32, 0x2a, 0x64, 0x3a, 0x2b, 0x4a, 0x20, 0x27, 0x28, //  .ErrD22*d:+J '(
-	0x28, 0x27, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x4a, 0x2a, 0x07, // ('(a99a((((( J*.
-	0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x0b, 0x03, 0xb6, 0x02, 0xd1, 0x00, 0x3f, // ...............?
-	0x00, 0x00, 0x01, 0x1e, 0x01, 0x17, 0x33, 0x07, 0x14, 0x0e, 0x02, 0x07, 0x0e, 0x03, 0x23, 0x22, // ......3.......#"
-	0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x23, 0x37, 0x17, 0x23, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x33, // ..'..5#7.#.....3
-	0x32, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x23, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, // 267>.7#.....#"&'
-	0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x02, 0xc2, 0x20, 0x26, // ..5467>.32.... &
-	0x06, 0xa8, 0x01, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4e, 0x54, 0x2e, 0x2d, 0x55, 0x4d, 0x46, // .... /  FNT.-UMF
-	0x20, 0x20, 0x30, 0x1f, 0x10, 0x45, 0x72, 0x72, 0x44, 0x33, 0x32, 0x32, 0x7a, 0x48, 0x48, 0x7a, //   0..ErrD322zHHz
-	0x33, 0x2a, 0x31, 0x07, 0x49, 0x06, 0x26, 0x20, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x27, 0x28, // 3*1.I.& (a99a('(
-	0x28, 0x27, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x02, 0x82, 0x20, 0x4a, 0x2a, 0x2e, 0x2e, 0x54, // ('(a99a(.. J*..T
-	0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4e, 0x54, 0x2e, // NF  / .. /  FNT.
-	0x89, 0x89, 0x48, 0x7a, 0x33, 0x32, 0x32, 0x32, 0x32, 0x2a, 0x64, 0x39, 0x2a, 0x4a, 0x20, 0x28, // ..Hz32222*d9*J (
-	0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x27, 0x27, 0x28, 0x00, 0x00, 0x00, // ((((a99a((''(...
-	0x00, 0x01, 0x00, 0x07, 0x00, 0xb0, 0x03, 0xb6, 0x03, 0x77, 0x00, 0x3f, 0x00, 0x00, 0x13, 0x34, // .........w.?...4
-	0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x17, 0x23, 0x0e, // >.7>.32.......#.
-	0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, // ....#"&'..5467>.
-	0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x33, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x23, 0x22, 0x06, // 32.....3..'..#".
-	0x07, 0x0e, 0x01, 0x15, 0x33, 0x07, 0x27, 0x33, 0x4c, 0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4d, // ....3.'3L. /  FM
-	0x55, 0x2d, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x01, 0xa8, 0x06, 0x26, 0x20, // U-.TNF  / ....& 
-	0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x27, 0x28, 0x28, 0x27, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, // (a99a('(('(a99a(
-	0x20, 0x26, 0x06, 0x49, 0x07, 0x31, 0x2a, 0x32, 0x7b, 0x48, 0x48, 0x7a, 0x32, 0x32, 0x33, 0x44, //  &.I.1*2{HHz223D
-	0x72, 0x72, 0x45, 0x01, 0xc2, 0x2e, 0x54, 0x4d, 0x46, 0x20, 0x20, 0x30, 0x20, 0x10, 0x10, 0x20, // rrE...TMF  0 .. 
-	0x30, 0x20, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x2e, 0x2a, 0x4a, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, // 0  FMT..*J (((((
-	0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x4a, 0x2a, 0x39, 0x63, 0x2a, 0x33, // a99a((((( J*9c*3
-	0x32, 0x32, 0x33, 0x32, 0x7a, 0x48, 0x89, 0x89, 0x00, 0x01, 0x00, 0xee, 0x00, 0xb0, 0x03, 0xb5, // 2232zH..........
-	0x03, 0xbb, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x15, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x17, // .../....2.......
-	0x23, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, // #.....#"&'..5467
-	0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x33, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x23, // >.32.....3..'..#
-	0x15, 0x27, 0x37, 0x01, 0xff, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x01, 0xa8, // .'7...TNF  / ...
-	0x06, 0x26, 0x20, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x27, 0x27, 0x28, 0x28, 0x61, 0x39, // .& (a99a((''((a9
-	0x39, 0x61, 0x28, 0x20, 0x26, 0x06, 0x49, 0x07, 0x31, 0x2a, 0x33, 0x7a, 0x48, 0x89, 0x89, 0x03, // 9a( &.I.1*3zH...
-	0xbb, 0x44, 0x10, 0x20, 0x30, 0x20, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x2e, 0x2a, 0x4a, 0x20, 0x28, // .D. 0  FMT..*J (
-	0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x28, 0x28, 0x28, 0x20, 0x4a, 0x2a, // ((((a99a((((( J*
-	0x39, 0x63, 0x2a, 0x33, 0x32, 0x44, 0x72, 0x72, 0x00, 0x01, 0x00, 0xee, 0xff, 0xc9, 0x03, 0xb4, // 9c*32Drr........
-	0x03, 0x78, 0x00, 0x42, 0x00, 0x00, 0x01, 0x15, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, // .x.B............
-	0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, // ...#"&'..5467>.7
-	0x35, 0x17, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x14, 0x0e, 0x02, 0x0f, 0x01, 0x23, 0x0e, // 5.2...........#.
-	0x03, 0x23, 0x15, 0x27, 0x37, 0x15, 0x32, 0x36, 0x3f, 0x01, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, // .#.'7.26?.>.54&'
-	0x2e, 0x01, 0x27, 0x02, 0x2d, 0x2a, 0x4a, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, // ..'.-*J (((((a99
-	0x61, 0x28, 0x28, 0x27, 0x27, 0x28, 0x20, 0x4a, 0x2a, 0x2e, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, // a((''( J*..TNF  
-	0x2f, 0x20, 0x10, 0x10, 0x20, 0x2f, 0x20, 0x06, 0x01, 0x1f, 0x46, 0x4c, 0x52, 0x2c, 0x89, 0x89, // / .. / ...FLR,..
-	0x46, 0x77, 0x32, 0x06, 0x32, 0x32, 0x32, 0x32, 0x2a, 0x64, 0x39, 0x03, 0x18, 0x48, 0x06, 0x26, // Fw2.2222*d9..H.&
-	0x20, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x27, 0x28, 0x28, 0x27, 0x28, 0x61, 0x39, 0x39, 0x61, //  (a99a('(('(a99a
-	0x28, 0x20, 0x26, 0x06, 0xa8, 0x01, 0x10, 0x20, 0x30, 0x20, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x2d, // ( &.... 0  FMT.-
-	0x55, 0x4d, 0x47, 0x20, 0x06, 0x1e, 0x2d, 0x1e, 0x0f, 0x45, 0x72, 0x72, 0x44, 0x2f, 0x2f, 0x06, // UMG ..-..ErrD//.
-	0x33, 0x7a, 0x48, 0x48, 0x7a, 0x32, 0x2b, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x4c, // 3zHHz2+1.......L
-	0xff, 0xc9, 0x03, 0x12, 0x03, 0x78, 0x00, 0x3f, 0x00, 0x00, 0x01, 0x37, 0x15, 0x1e, 0x01, 0x17, // .....x.?...7....
-	0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, // ........#"&'..54
-	0x36, 0x37, 0x3e, 0x01, 0x37, 0x35, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, // 67>.75..........
-	0x01, 0x33, 0x35, 0x17, 0x07, 0x35, 0x22, 0x2e, 0x02, 0x27, 0x2e, 0x03, 0x35, 0x34, 0x3e, 0x02, // .35..5"..'..54>.
-	0x37, 0x3e, 0x03, 0x33, 0x02, 0x00, 0x2e, 0x2a, 0x4a, 0x20, 0x28, 0x28, 0x28, 0x28, 0x28, 0x61, // 7>.3...*J (((((a
-	0x39, 0x39, 0x61, 0x28, 0x27, 0x28, 0x28, 0x27, 0x20, 0x4a, 0x2b, 0x3a, 0x63, 0x2a, 0x32, 0x33, // 99a('((' J+:c*23
-	0x33, 0x32, 0x32, 0x7a, 0x48, 0x89, 0x89, 0x2d, 0x55, 0x4d, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, // 322zH..-UMF  / .
-	0x10, 0x20, 0x2f, 0x20, 0x20, 0x46, 0x4d, 0x55, 0x2d, 0x03, 0x77, 0x01, 0xa8, 0x06, 0x26, 0x20, // . /  FMU-.w...& 
-	0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x27, 0x28, 0x28, 0x27, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, // (a99a('(('(a99a(
-	0x20, 0x26, 0x06, 0x48, 0x06, 0x31, 0x2b, 0x32, 0x7a, 0x48, 0x48, 0x7a, 0x33, 0x32, 0x32, 0x44, //  &.H.1+2zHHz322D
-	0x72, 0x72, 0x45, 0x0f, 0x20, 0x30, 0x1f, 0x20, 0x47, 0x4d, 0x55, 0x2d, 0x2e, 0x54, 0x4d, 0x46, // rrE. 0. GMU-.TMF
-	0x20, 0x20, 0x30, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0xb0, 0x03, 0x12, //   0 ............
-	0x03, 0x78, 0x00, 0x2f, 0x00, 0x00, 0x01, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, // .x./........#"&'
-	0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x35, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x15, // ..5467>.75......
-	0x33, 0x07, 0x27, 0x33, 0x34, 0x3e, 0x02, 0x37, 0x3e, 0x03, 0x33, 0x37, 0x15, 0x1e, 0x01, 0x17, // 3.'34>.7>.37....
-	0x1e, 0x01, 0x15, 0x03, 0x12, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x27, 0x28, 0x28, // .....(((a99a('((
-	0x27, 0x20, 0x4a, 0x2b, 0x3a, 0x63, 0x2a, 0x32, 0x33, 0x44, 0x72, 0x72, 0x45, 0x10, 0x20, 0x2f, // ' J+:c*23DrrE. /
-	0x20, 0x20, 0x46, 0x4d, 0x55, 0x2d, 0x2e, 0x2a, 0x4a, 0x20, 0x28, 0x28, 0x01, 0xc2, 0x39, 0x61, //   FMU-.*J ((..9a
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x20, 0x26, 0x06, 0x48, 0x06, // ((((((a99a( &.H.
-	0x31, 0x2b, 0x32, 0x7a, 0x48, 0x89, 0x89, 0x2e, 0x54, 0x4d, 0x46, 0x20, 0x20, 0x30, 0x20, 0x10, // 1+2zH...TMF  0 .
-	0x01, 0xa8, 0x06, 0x26, 0x20, 0x28, 0x61, 0x39, 0x00, 0x01, 0x00, 0xee, 0x00, 0xb0, 0x03, 0xf8, // ...& (a9........
-	0x03, 0x77, 0x00, 0x34, 0x00, 0x00, 0x01, 0x15, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, // .w.4............
-	0x07, 0x0e, 0x01, 0x23, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, // ...#"&'..5467>.7
-	0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x1e, 0x03, 0x15, 0x33, 0x07, // 5467>.32......3.
-	0x27, 0x33, 0x34, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x02, 0x2d, 0x2a, 0x4a, 0x20, 0x28, 0x28, 0x28, // '34&'..'.-*J (((
-	0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x28, 0x27, 0x27, 0x28, 0x20, 0x4a, 0x2a, 0x07, 0x07, // ((a99a((''( J*..
-	0x06, 0x10, 0x0a, 0x2e, 0x54, 0x4e, 0x46, 0x20, 0x20, 0x2f, 0x20, 0x10, 0x44, 0x72, 0x72, 0x44, // ....TNF  / .DrrD
-	0x32, 0x32, 0x2a, 0x64, 0x39, 0x03, 0x18, 0x48, 0x06, 0x26, 0x20, 0x28, 0x61, 0x39, 0x39, 0x61, // 22*d9..H.& (a99a
-	0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x61, 0x39, 0x39, 0x61, 0x28, 0x20, 0x26, 0x06, 0x79, 0x0a, // ((((((a99a( &.y.
-	0x10, 0x06, 0x07, 0x07, 0x10, 0x20, 0x30, 0x20, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x89, 0x89, 0x48, // ..... 0  FMT...H
-	0x7a, 0x32, 0x2b, 0x31, 0x06, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // z2+1............
-	0x03, 0xba, 0x00, 0x6f, 0x00, 0x94, 0x00, 0x00, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, // ...o.......'..'.
-	0x01, 0x23, 0x22, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, // .#".............
-	0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x35, 0x07, 0x22, 0x26, 0x27, 0x2e, 0x01, 0x2f, 0x03, // .......5."&'../.
-	0x34, 0x36, 0x33, 0x32, 0x16, 0x1f, 0x08, 0x37, 0x3e, 0x01, 0x37, 0x2e, 0x01, 0x27, 0x2e, 0x01, // 4632...7>.7..'..
-	0x35, 0x34, 0x36, 0x37, 0x27, 0x34, 0x36, 0x37, 0x17, 0x1e, 0x01, 0x17, 0x37, 0x17, 0x37, 0x3e, // 5467'467....7.7>
-	0x01, 0x33, 0x1e, 0x01, 0x15, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x1e, // .3..............
-	0x01, 0x1d, 0x01, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x35, 0x34, 0x26, 0x27, 0x03, // ...>.7>.7>.54&'.
-	0x1e, 0x01, 0x17, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, // ..............#"
-	0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, // &'..'..5467>.7>.
-	0x33, 0x32, 0x16, 0x17, 0x03, 0x84, 0x10, 0x2d, 0x1d, 0x1c, 0x45, 0x27, 0x27, 0x51, 0x2a, 0x2a, // 32.....-..E''Q**
-	0x51, 0x27, 0x27, 0x45, 0x1c, 0x1d, 0x2d, 0x10, 0x10, 0x11, 0x12, 0x13, 0x12, 0x35, 0x21, 0x22, // Q''E..-......5!"
-	0x4d, 0x2b, 0x2e, 0x23, 0x33, 0x0f, 0x04, 0x0c, 0x08, 0x0d, 0x13, 0x08, 0x09, 0x09, 0x11, 0x1e, // M+.#3...........
-	0x0c, 0x06, 0x06, 0x05, 0x07, 0x07, 0x08, 0x09, 0x25, 0x36, 0x06, 0x14, 0x0e, 0x38, 0x51, 0x1a, // ........%6...8Q.
-	0x1a, 0x19, 0x18, 0x17, 0x08, 0x08, 0x09, 0x41, 0x0f, 0x21, 0x14, 0x6f, 0x65, 0x45, 0x0f, 0x1f, // .......A.!.oeE..
-	0x11, 0x09, 0x09, 0x0a, 0x18, 0x19, 0x1a, 0x1a, 0x1a, 0x51, 0x37, 0x17, 0x16, 0x2b, 0x4d, 0x22, // .........Q7..+M"
-	0x21, 0x35, 0x12, 0x13, 0x12, 0x11, 0x10, 0x87, 0x3a, 0x5d, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, // !5......:]""""""
-	0x5b, 0x3b, 0x3a, 0x80, 0x44, 0x44, 0x7f, 0x3a, 0x3b, 0x5c, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, // [;:.DD.:;.""""""
-	0x5c, 0x3b, 0x39, 0x7e, 0x46, 0x44, 0x7f, 0x3a, 0x02, 0x63, 0x27, 0x44, 0x1c, 0x1d, 0x2d, 0x10, // .;9~FD.:.c'D..-.
-	0x10, 0x11, 0x11, 0x10, 0x10, 0x2d, 0x1d, 0x1c, 0x44, 0x27, 0x27, 0x52, 0x2a, 0x2e, 0x55, 0x29, // .....-..D''R*.U)
-	0x29, 0x48, 0x1e, 0x1e, 0x2b, 0x0d, 0x6f, 0x05, 0x21, 0x21, 0x0c, 0x15, 0x09, 0x0c, 0x11, 0x0a, // )H..+.o.!!......
-	0x04, 0x04, 0x11, 0x11, 0x06, 0x09, 0x07, 0x08, 0x07, 0x06, 0x07, 0x09, 0x09, 0x13, 0x1e, 0x0a, // ................
-	0x05, 0x1c, 0x16, 0x17, 0x49, 0x33, 0x28, 0x41, 0x19, 0x37, 0x14, 0x24, 0x11, 0x0c, 0x06, 0x15, // ....I3(A.7.$....
-	0x0f, 0x0d, 0x0b, 0x28, 0x06, 0x06, 0x11, 0x24, 0x14, 0x35, 0x1b, 0x42, 0x27, 0x32, 0x4a, 0x17, // ...(...$.5.B'2J.
-	0x17, 0x1d, 0x05, 0x0f, 0x2b, 0x1c, 0x94, 0x0d, 0x2b, 0x1e, 0x1e, 0x48, 0x29, 0x29, 0x56, 0x2d, // ....+...+..H))V-
-	0x2a, 0x52, 0x27, 0x01, 0x13, 0x22, 0x5b, 0x3b, 0x39, 0x7f, 0x46, 0x44, 0x7f, 0x3a, 0x3b, 0x5c, // *R'.."[;9.FD.:;.
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x5c, 0x3b, 0x39, 0x7e, 0x46, 0x44, 0x7f, 0x3a, 0x3a, 0x5d, // """""".;9~FD.::]
-	0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc7, 0x03, 0xfa, // """""...........
-	0x03, 0xba, 0x00, 0x57, 0x00, 0x00, 0x01, 0x22, 0x0e, 0x02, 0x15, 0x14, 0x1e, 0x02, 0x17, 0x16, // ...W..."........
-	0x36, 0x35, 0x34, 0x26, 0x35, 0x06, 0x26, 0x31, 0x2e, 0x01, 0x31, 0x26, 0x36, 0x31, 0x1e, 0x01, // 654&5.&1..1&61..
-	0x31, 0x16, 0x36, 0x37, 0x3e, 0x01, 0x37, 0x2e, 0x03, 0x35, 0x34, 0x36, 0x37, 0x2e, 0x01, 0x37, // 1.67>.7..5467..7
-	0x30, 0x16, 0x17, 0x3e, 0x01, 0x33, 0x32, 0x16, 0x17, 0x3e, 0x01, 0x31, 0x16, 0x06, 0x07, 0x1e, // 0..>.32..>.1....
-	0x01, 0x15, 0x14, 0x0e, 0x02, 0x07, 0x1e, 0x01, 0x15, 0x14, 0x06, 0x15, 0x14, 0x16, 0x37, 0x3e, // ..............7>
-	0x03, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x02, 0x00, 0x69, 0xb8, 0x89, 0x50, 0x34, 0x5c, 0x7f, 0x4b, // .54..#..i..P4..K
-	0x13, 0x10, 0x01, 0x69, 0x41, 0x11, 0x27, 0x23, 0x26, 0x26, 0x27, 0x22, 0x5c, 0x16, 0x03, 0x12, // ...iA.'#&&'"....
-	0x0b, 0x2a, 0x53, 0x41, 0x29, 0x1c, 0x18, 0x03, 0x0c, 0x14, 0x43, 0x48, 0x1f, 0x40, 0x20, 0x20, // .*SA).....CH.@  
-	0x40, 0x1f, 0x48, 0x42, 0x15, 0x0c, 0x04, 0x19, 0x1b, 0x28, 0x41, 0x53, 0x2a, 0x0d, 0x15, 0x01, // @.HB.....(AS*...
-	0x10, 0x13, 0x4b, 0x7f, 0x5c, 0x34, 0x50, 0x89, 0xb8, 0x69, 0x03, 0xba, 0x52, 0x8d, 0xbc, 0x6c, // ..K..4P..i..R..l
-	0x56, 0x9c, 0x80, 0x60, 0x1a, 0x03, 0x12, 0x0a, 0x09, 0x2f, 0x20, 0x17, 0x5d, 0x2d, 0x1f, 0x18, // V..`...../ .]-..
-	0x07, 0x03, 0x32, 0x3c, 0x07, 0x0a, 0x19, 0x22, 0x0a, 0x05, 0x19, 0x39, 0x5f, 0x4a, 0x2b, 0x45, // ..2<..."...9_J+E
-	0x1b, 0x0a, 0x4a, 0x36, 0x03, 0x32, 0x08, 0x09, 0x09, 0x09, 0x33, 0x03, 0x36, 0x4a, 0x0a, 0x1b, // ..J6.2....3.6J..
-	0x45, 0x2b, 0x4a, 0x5f, 0x39, 0x19, 0x04, 0x0d, 0x2f, 0x24, 0x34, 0x4e, 0x0d, 0x0a, 0x12, 0x03, // E+J_9.../$4N....
-	0x1a, 0x60, 0x81, 0x9b, 0x56, 0x6c, 0xbc, 0x8d, 0x52, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, // .`..Vl..R.......
-	0x00, 0x18, 0x03, 0xfa, 0x03, 0x68, 0x00, 0x58, 0x00, 0x00, 0x01, 0x34, 0x36, 0x37, 0x3e, 0x01, // .....h.X...467>.
-	0x33, 0x32, 0x16, 0x1f, 0x01, 0x3f, 0x01, 0x1f, 0x01, 0x0f, 0x01, 0x33, 0x1f, 0x01, 0x07, 0x0e, // 32...?.....3....
-	0x01, 0x07, 0x15, 0x14, 0x06, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x0e, 0x01, 0x23, 0x22, // ..............#"
-	0x26, 0x27, 0x33, 0x2e, 0x01, 0x2f, 0x01, 0x35, 0x3f, 0x01, 0x17, 0x32, 0x36, 0x37, 0x07, 0x37, // &'3../.5?..267.7
-	0x27, 0x2e, 0x01, 0x27, 0x26, 0x36, 0x3f, 0x01, 0x27, 0x2e, 0x01, 0x3d, 0x01, 0x3f, 0x01, 0x33, // '..'&6?.'..=.?.3
-	0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x3f, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x27, 0x1e, // ..5467>.?.....'.
-	0x01, 0x17, 0x35, 0x01, 0xd2, 0x21, 0x22, 0x20, 0x50, 0x30, 0x18, 0x2f, 0x16, 0x3b, 0x61, 0x14, // ..5..!" P0./.;a.
-	0x12, 0x0c, 0x01, 0x10, 0x11, 0x11, 0x09, 0x05, 0x14, 0x2e, 0x1a, 0x12, 0x13, 0x14, 0x39, 0x24, // ..............9$
-	0x28, 0x5b, 0x33, 0x3a, 0x7f, 0x44, 0x2b, 0x53, 0x2a, 0x02, 0x28, 0x4b, 0x23, 0x0e, 0x0e, 0x16, // ([3:.D+S*.(K#...
-	0x2c, 0x1e, 0x3c, 0x1e, 0x02, 0x23, 0x2f, 0x1d, 0x27, 0x0b, 0x02, 0x01, 0x02, 0x07, 0x19, 0x1a, // ,.<..#/.'.......
-	0x1a, 0x08, 0x13, 0x01, 0x0d, 0x0e, 0x0f, 0x10, 0x02, 0x08, 0x05, 0x16, 0x12, 0x23, 0x53, 0x30, // .............#S0
-	0x02, 0x29, 0x55, 0x2d, 0x02, 0x81, 0x30, 0x51, 0x22, 0x22, 0x22, 0x0a, 0x0a, 0x27, 0x27, 0x05, // .)U-..0Q"""..''.
-	0x09, 0x11, 0x14, 0x22, 0x0a, 0x14, 0x15, 0x1d, 0x32, 0x15, 0x08, 0x35, 0x68, 0x34, 0x35, 0x5f, // ..."....2..5h45_
-	0x2a, 0x2d, 0x46, 0x1a, 0x1b, 0x1b, 0x0d, 0x0c, 0x0c, 0x22, 0x16, 0x11, 0x16, 0x11, 0x07, 0x02, // *-F......"......
-	0x0a, 0x0b, 0x02, 0x0f, 0x1d, 0x16, 0x39, 0x23, 0x06, 0x0b, 0x05, 0x0a, 0x1b, 0x20, 0x4a, 0x2a, // ......9#..... J*
-	0x01, 0x15, 0x0c, 0x19, 0x35, 0x1c, 0x1f, 0x3a, 0x1b, 0x05, 0x07, 0x03, 0x02, 0x0c, 0x2b, 0x44, // ....5..:......+D
-	0x1b, 0x02, 0x15, 0x1b, 0x06, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, // ................
-	0x03, 0xba, 0x00, 0x3e, 0x00, 0x00, 0x01, 0x0e, 0x01, 0x0f, 0x01, 0x15, 0x23, 0x15, 0x33, 0x17, // ...>........#.3.
-	0x11, 0x21, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x11, 0x34, 0x36, 0x37, // .!'..'..'..5.467
-	0x3e, 0x01, 0x33, 0x21, 0x32, 0x16, 0x17, 0x1e, 0x01, 0x15, 0x11, 0x14, 0x06, 0x07, 0x0e, 0x01, // >.3!2...........
-	0x2b, 0x01, 0x37, 0x35, 0x3f, 0x02, 0x23, 0x35, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x17, 0x33, 0x35, // +.75?.#5>.7>..35
-	0x23, 0x0e, 0x01, 0x07, 0x02, 0x82, 0x09, 0x0e, 0x05, 0x0e, 0x52, 0x2a, 0x28, 0xfe, 0x57, 0x40, // #.........R*(.W@
-	0x0f, 0x1b, 0x0c, 0x0c, 0x12, 0x07, 0x07, 0x07, 0x1a, 0x19, 0x18, 0x3b, 0x23, 0x02, 0xb0, 0x21, // ...........;#..!
-	0x38, 0x16, 0x16, 0x16, 0x16, 0x16, 0x17, 0x37, 0x21, 0x60, 0x02, 0x37, 0x38, 0x10, 0x7f, 0x01, // 8......7!`.78...
-	0x08, 0x06, 0x06, 0x0c, 0x07, 0x57, 0x86, 0x27, 0x3c, 0x15, 0x02, 0xce, 0x0a, 0x16, 0x0c, 0x33, // .....W.'<......3
-	0x85, 0x8a, 0x02, 0xfe, 0x68, 0x0e, 0x07, 0x12, 0x0c, 0x0c, 0x1b, 0x0f, 0x10, 0x20, 0x10, 0x02, // ....h........ ..
-	0xb0, 0x20, 0x38, 0x17, 0x16, 0x16, 0x16, 0x16, 0x16, 0x38, 0x21, 0xfd, 0x50, 0x22, 0x3b, 0x19, // . 8......8!.P";.
+	0x33, 0x5e, 0x57, 0x4f, 0x24, 0x51, 0x4f, 0x01, 0x02, 0xe8, 0xff, 0x00, 0x33, 0xcd, 0x80, 0x49, // 3^WO$QO.....3..I
+	0x7b, 0x32, 0x16, 0x21, 0x0b, 0xf9, 0x17, 0x29, 0x11, 0x18, 0x77, 0x11, 0x04, 0x2b, 0x04, 0x10, // {2.!...)..w..+..
+	0x27, 0x17, 0xf9, 0x0b, 0x21, 0x16, 0x32, 0x7b, 0x49, 0x4a, 0x82, 0x19, 0x25, 0x22, 0x17, 0x0b, // '...!.2{IJ..%"..
+	0x0b, 0x17, 0x22, 0x82, 0x0d, 0x20, 0x4a, 0x53, 0xa3, 0x05, 0x85, 0xa3, 0x22, 0x2e, 0x00, 0x3e, // ..".. JS...."..>
+	0x59, 0x65, 0x04, 0xaa, 0x9e, 0x20, 0x25, 0x4d, 0x0b, 0x0a, 0x45, 0xf1, 0x03, 0x4b, 0xdf, 0x07, // Ye... %M..E..K..
+	0x4d, 0x15, 0x09, 0x21, 0x03, 0xfa, 0xa9, 0xbb, 0x21, 0xfe, 0x28, 0x4e, 0x81, 0x03, 0x37, 0x06, // M..!....!.(N..7.
+	0x14, 0x0e, 0x2a, 0x2a, 0x0e, 0x14, 0x06, 0x45, 0x0d, 0x0d, 0x0c, 0x2b, 0x1e, 0x61, 0x39, 0x28, // ..**...E...+.a9(
+	0x38, 0x46, 0x41, 0x19, 0x19, 0x02, 0x68, 0xa7, 0xd2, 0x39, 0x46, 0x03, 0x0f, 0x0a, 0x0a, 0x0f, // 8FA...h..9F.....
+	0x05, 0x04, 0x05, 0x4b, 0x04, 0x04, 0x1c, 0x16, 0x21, 0x0a, 0x0a, 0x0b, 0xff, 0x00, 0x52, 0x52, // ...K....!.....RR
+	0x5b, 0x09, 0x28, 0x1e, 0x54, 0x8f, 0x0a, 0x22, 0x11, 0x00, 0x3a, 0x18, 0x80, 0x07, 0x04, 0x8d, // [.(.T.."..:.....
+	0xac, 0x82, 0xbd, 0x58, 0xd2, 0x1c, 0x41, 0x0e, 0x04, 0x50, 0x45, 0x07, 0x30, 0x07, 0x02, 0x96, // ...X..A..PE.0...
+	0x16, 0x49, 0x32, 0xa3, 0x60, 0x43, 0x60, 0x78, 0x6d, 0x28, 0x29, 0x16, 0x15, 0xcf, 0x59, 0x8c, // .I2.`C`xm()...Y.
+	0x24, 0x26, 0xe8, 0x09, 0x23, 0x19, 0x46, 0x47, 0x43, 0x74, 0xbc, 0x03, 0x2f, 0x02, 0x5e, 0x10, // $&..#.FGCt../.^.
+	0x10, 0xfe, 0x65, 0x84, 0x84, 0x93, 0x0f, 0x3f, 0x30, 0x24, 0x35, 0x11, 0xc9, 0x5b, 0xf9, 0x23, // ..e....?0$5..[.#
+	0x2a, 0xfe, 0x9e, 0x08, 0x08, 0x7b, 0x0c, 0x07, 0x18, 0x11, 0x10, 0x17, 0x18, 0x49, 0x4b, 0x04, // *....{.......IK.
+	0x41, 0xbb, 0x09, 0x42, 0xe9, 0x06, 0x21, 0x01, 0x07, 0x41, 0xbe, 0x23, 0x21, 0x02, 0x00, 0x42, // A..B..!..A.#!..B
+	0x2f, 0x08, 0x41, 0x9d, 0x20, 0x21, 0x03, 0xb9, 0x41, 0x58, 0x06, 0x41, 0x80, 0x20, 0x82, 0x8f, // /.A. !..AX.A. ..
+	0x24, 0x52, 0xff, 0xc9, 0x03, 0xc8, 0x86, 0x8f, 0x50, 0x74, 0x03, 0x6a, 0xbc, 0x05, 0x83, 0x03, // $R......Pt.j....
+	0x20, 0x2f, 0x6b, 0x27, 0x06, 0x20, 0x27, 0x61, 0xd8, 0x06, 0x20, 0x03, 0x82, 0x02, 0x20, 0x17, //  /k'. 'a.. ... .
+	0x61, 0xd8, 0x05, 0x08, 0x60, 0x37, 0x03, 0xa2, 0x13, 0x30, 0x1e, 0x7b, 0x0b, 0x07, 0x06, 0x03, // a...`7...0.{....
+	0x07, 0x19, 0x13, 0x8f, 0x14, 0x28, 0x16, 0x04, 0x15, 0x21, 0x0b, 0x7b, 0x28, 0x51, 0x27, 0x5d, // .....(...!.{(Q']
+	0x80, 0x22, 0x26, 0x07, 0x2b, 0x14, 0x33, 0x3f, 0x4a, 0x2b, 0x2c, 0x56, 0x55, 0x54, 0x29, 0x5e, // ."&.+.3?J+,VUT)^
+	0x80, 0x23, 0x26, 0x07, 0x2d, 0x02, 0x02, 0x17, 0x24, 0x41, 0x1d, 0xd5, 0x14, 0x2a, 0x17, 0x03, // .#&.-...$A...*..
+	0x15, 0x1f, 0x0a, 0x53, 0x0c, 0x07, 0x05, 0x03, 0x06, 0x1a, 0x13, 0xd5, 0x0c, 0x0a, 0x02, 0x04, // ...S............
+	0x42, 0x3f, 0x3e, 0x90, 0x51, 0x25, 0x44, 0x3e, 0x38, 0x1a, 0x18, 0x25, 0x17, 0x0a, 0x02, 0x02, // B?>.Q%D>8..%....
+	0x42, 0x3f, 0x3d, 0x91, 0x53, 0x02, 0x55, 0x93, 0x05, 0x20, 0x38, 0x82, 0x9b, 0x20, 0xae, 0x86, // B?=.S.U.. 8.. ..
+	0x9b, 0x61, 0xd9, 0x05, 0x77, 0x63, 0x03, 0x20, 0x07, 0x77, 0x53, 0x05, 0x85, 0x9e, 0x65, 0x37, // .a..wc. .wS...e7
+	0x03, 0x61, 0xcf, 0x08, 0x20, 0x36, 0x44, 0x39, 0x04, 0x08, 0x42, 0x17, 0x03, 0xa1, 0x2c, 0x07, // .a.. 6D9..B...,.
+	0x26, 0x21, 0x81, 0x5e, 0x01, 0x27, 0x51, 0x28, 0x7b, 0x0c, 0x22, 0x16, 0x03, 0x16, 0x29, 0x12, // &!.^.'Q({."...).
+	0x90, 0x13, 0x1a, 0x06, 0x01, 0x05, 0x06, 0x0b, 0x7b, 0x1e, 0x30, 0x13, 0x2b, 0x06, 0x25, 0x22, // ........{.0.+.%"
+	0x80, 0x5d, 0x2a, 0x54, 0x55, 0x56, 0x2b, 0x2c, 0x4b, 0x3f, 0x32, 0x14, 0x02, 0x64, 0x52, 0x91, // .]*TUV+,K?2..dR.
+	0x3e, 0x3f, 0x41, 0x03, 0x01, 0x02, 0x0a, 0x0b, 0xd5, 0x14, 0x1a, 0x06, 0x04, 0x06, 0x82, 0xa2, // >?A.............
+	0x39, 0x20, 0x14, 0x05, 0x16, 0x28, 0x14, 0xd4, 0x1e, 0x41, 0x23, 0x52, 0x90, 0x3e, 0x3f, 0x42, // 9 ...(...A#R.>?B
+	0x03, 0x02, 0x0a, 0x18, 0x25, 0x19, 0x19, 0x37, 0x3e, 0x44, 0x25, 0x85, 0x9b, 0x26, 0x07, 0x00, // ....%..7>D%..&..
+	0x0b, 0x02, 0x2e, 0x02, 0x4a, 0x4f, 0xc3, 0x04, 0x4f, 0x01, 0x07, 0x23, 0x17, 0x35, 0x33, 0x15, // ....JO..O..#.53.
+	0x7f, 0x39, 0x05, 0x42, 0x86, 0x03, 0x08, 0x45, 0x23, 0x37, 0x17, 0x23, 0xa7, 0x33, 0x32, 0x18, // .9.B...E#7.#.32.
+	0x35, 0x1d, 0x16, 0x2e, 0x19, 0x5b, 0x2e, 0x24, 0x45, 0x21, 0x30, 0x55, 0x26, 0x20, 0x2f, 0x20, // 5....[.$E!0U& / 
+	0x10, 0x45, 0x72, 0x72, 0x44, 0x01, 0xc1, 0x48, 0x7a, 0x33, 0x18, 0x25, 0x0d, 0x09, 0x0c, 0x03, // .ErrD..Hz3.%....
+	0x45, 0xa4, 0x02, 0x0a, 0x0a, 0x0f, 0x35, 0x26, 0x20, 0x47, 0x4d, 0x55, 0x2d, 0x89, 0x89, 0x00, // E.....5& GMU-...
+	0x01, 0x01, 0xcf, 0x00, 0x0b, 0x03, 0xf6, 0x02, 0x49, 0x00, 0x1d, 0x00, 0x00, 0x25, 0x82, 0x52, // ........I....%.R
+	0x5f, 0x7c, 0x04, 0x84, 0x4e, 0x42, 0xe7, 0x07, 0x46, 0x33, 0x05, 0x2b, 0xcf, 0x5b, 0x3a, 0x64, // _|..NB..F3.+.[:d
+	0x2a, 0x32, 0x32, 0x44, 0x72, 0x72, 0x45, 0x0f, 0x82, 0x57, 0x84, 0x3f, 0x34, 0x0a, 0x10, 0x06, // *22DrrE..W.?4...
+	0x07, 0x07, 0x39, 0x75, 0x45, 0x07, 0x31, 0x2a, 0x33, 0x7a, 0x48, 0x89, 0x89, 0x2e, 0x54, 0x4e, // ..9uE.1*3zH...TN
+	0x46, 0x20, 0x83, 0x74, 0x24, 0x07, 0x06, 0x07, 0x10, 0x0a, 0x82, 0x5b, 0x20, 0x79, 0x82, 0x5b, // F .t$......[ y.[
+	0x22, 0xb6, 0x03, 0xba, 0x56, 0x2f, 0x04, 0x45, 0x66, 0x0a, 0x20, 0x07, 0x88, 0x67, 0x58, 0xc4, // "...V/.Ef. ..gX.
+	0x03, 0x27, 0x33, 0x2e, 0x01, 0x23, 0x15, 0x27, 0x37, 0x15, 0x42, 0xa0, 0x03, 0x08, 0x33, 0x15, // .'3..#.'7.B...3.
+	0x33, 0x03, 0x32, 0x05, 0x20, 0x30, 0x1f, 0x10, 0x10, 0x1f, 0x30, 0x20, 0x1f, 0x47, 0x4e, 0x54, // 3.2. 0....0 .GNT
+	0x2e, 0x2d, 0x5b, 0x39, 0x64, 0x2a, 0x33, 0x32, 0x32, 0x33, 0x05, 0x01, 0x32, 0x79, 0x46, 0x88, // .-[9d*3223..2yF.
+	0x88, 0x2c, 0x53, 0x4b, 0x46, 0x20, 0x01, 0x02, 0xfc, 0x06, 0x20, 0x46, 0x4d, 0x54, 0x2e, 0x2e, // .,SKF .... FMT..
+	0x54, 0x4d, 0x47, 0x83, 0x71, 0x23, 0x0f, 0x02, 0xa8, 0x49, 0x85, 0x85, 0x25, 0x48, 0x7a, 0x32, // TMG.q#...I..%Hz2
+	0x06, 0x30, 0x2f, 0x82, 0xa6, 0x24, 0x44, 0x0f, 0x1f, 0x2d, 0x1e, 0x57, 0x6f, 0x06, 0x24, 0x4c, // .0/..$D..-.Wo.$L
+	0x00, 0x0b, 0x02, 0x89, 0x45, 0xf3, 0x04, 0x24, 0x00, 0x01, 0x35, 0x17, 0x07, 0x18, 0x8b, 0xe6, // ....E..$..5.....
+	0x0b, 0x41, 0x46, 0x05, 0x5c, 0x01, 0x0d, 0x22, 0x00, 0x89, 0x89, 0x82, 0x46, 0x2b, 0x32, 0x33, // .AF...."....F+23
+	0x33, 0x32, 0x2a, 0x63, 0x3a, 0x5b, 0x2e, 0x2d, 0x55, 0x4d, 0x85, 0xd6, 0x20, 0x10, 0x83, 0xf8, // 32*c:[.-UM.. ...
+	0x20, 0x46, 0x82, 0xf8, 0x21, 0x03, 0x76, 0x83, 0x60, 0x22, 0x32, 0x33, 0x32, 0x83, 0x6f, 0x26, //  F..!.v.`"232.o&
+	0x33, 0x2a, 0x31, 0x07, 0x49, 0xa8, 0x02, 0x41, 0x15, 0x06, 0x84, 0x93, 0x82, 0x2e, 0x21, 0x30, // 3*1.I..A......!0
+	0x20, 0x18, 0x8f, 0x5d, 0x04, 0x28, 0x01, 0x00, 0x49, 0xff, 0xc9, 0x02, 0x87, 0x01, 0xf0, 0x41, //  ..].(..I......A
+	0x5f, 0x03, 0x22, 0x13, 0x15, 0x23, 0x58, 0xab, 0x05, 0x84, 0x83, 0x86, 0x73, 0x49, 0x7f, 0x05, // _."..#X.....sI..
+	0x25, 0xec, 0x44, 0x06, 0x31, 0x2b, 0x32, 0x41, 0x44, 0x05, 0x86, 0x3e, 0x27, 0x07, 0x07, 0x06, // %.D.1+2AD..>'...
+	0x10, 0x0a, 0x75, 0x01, 0xf0, 0x41, 0x78, 0x17, 0x83, 0xd7, 0x25, 0x01, 0x39, 0x03, 0xfa, 0x03, // ..u..Ax...%.9...
+	0x76, 0x56, 0x33, 0x03, 0x22, 0x13, 0x23, 0x37, 0x18, 0x5c, 0x6b, 0x06, 0x53, 0xc9, 0x03, 0x46, // vV3.".#7..k.S..F
+	0xd5, 0x05, 0x23, 0x33, 0x07, 0x27, 0x33, 0x18, 0x42, 0xc1, 0x0b, 0x82, 0x02, 0x33, 0x33, 0x15, // ..#3.'3.B....33.
+	0xf3, 0xa7, 0x01, 0x10, 0x20, 0x30, 0x1f, 0x26, 0x56, 0x2f, 0x21, 0x45, 0x24, 0x2e, 0x54, 0x4e, // .... 0.&V/!E$.TN
+	0x47, 0x1f, 0x41, 0x6f, 0x03, 0x83, 0x5e, 0x82, 0xcf, 0x2d, 0x7b, 0x48, 0x25, 0x45, 0x1f, 0x1e, // G.Ao..^..-{H%E..
+	0x35, 0x17, 0x2b, 0x31, 0x07, 0x48, 0x01, 0x94, 0x85, 0xf9, 0x24, 0x26, 0x35, 0x10, 0x0a, 0x0a, // 5.+1.H....$&5...
+	0x88, 0xfa, 0x41, 0x1a, 0x06, 0x24, 0x0e, 0x0d, 0x0d, 0x25, 0x18, 0x41, 0x1d, 0x03, 0x41, 0x5f, // ..A..$...%.A..A_
+	0x07, 0x23, 0x03, 0xfa, 0x02, 0x49, 0x41, 0x5f, 0x03, 0x24, 0x13, 0x27, 0x33, 0x15, 0x23, 0x59, // .#...IA_.$.'3.#Y
+	0x92, 0x06, 0x48, 0x7c, 0x04, 0x21, 0x3f, 0x01, 0x42, 0x4c, 0x03, 0x84, 0x7e, 0x45, 0x34, 0x06, // ..H|.!?.BL..~E4.
+	0x34, 0x01, 0x2f, 0x01, 0x4d, 0x01, 0xa7, 0x48, 0x04, 0x08, 0x30, 0x26, 0x33, 0x7a, 0x47, 0x48, // 4./.M..H..0&3zGH
+	0x7b, 0x32, 0x27, 0x2f, 0x09, 0x06, 0x42, 0xa7, 0x03, 0x23, 0x05, 0x09, 0x3d, 0x34, 0x41, 0xf4, // {2'/..B..#..=4A.
+	0x05, 0x42, 0x48, 0x03, 0x2b, 0x33, 0x3e, 0x0a, 0x04, 0x01, 0xc0, 0x2e, 0x5c, 0x15, 0x33, 0x59, // .BH.+3>.......3Y
+	0x26, 0x41, 0x8b, 0x03, 0x29, 0x26, 0x59, 0x33, 0x43, 0x89, 0x89, 0x43, 0x46, 0x79, 0x34, 0x41, // &A..)&Y3C..CFy4A
+	0x8b, 0x07, 0x22, 0x34, 0x79, 0x46, 0x52, 0xe3, 0x05, 0x26, 0x4c, 0x01, 0x94, 0x02, 0x8a, 0x03, // .."4yFR..&L.....
+	0xbb, 0x41, 0x63, 0x03, 0x20, 0x01, 0x41, 0xdd, 0x03, 0x7b, 0x0a, 0x04, 0x22, 0x33, 0x15, 0x23, // .Ac. .A..{.."3.#
+	0x18, 0x5c, 0xd1, 0x05, 0x84, 0x84, 0x18, 0x5f, 0x9d, 0x04, 0x08, 0x22, 0x17, 0x02, 0x8a, 0x89, // ......._..."....
+	0x45, 0x77, 0x31, 0x07, 0x2a, 0x31, 0x07, 0x45, 0xa4, 0x01, 0x27, 0x27, 0x0b, 0x18, 0x0e, 0x18, // Ew1.*1.E..''....
+	0x34, 0x1c, 0x02, 0x22, 0x48, 0x27, 0x3a, 0x89, 0x03, 0x49, 0x72, 0x44, 0x2f, 0x2f, 0x07, 0x41, // 4.."H':..IrD//.A
+	0xf1, 0x04, 0x2f, 0x47, 0x7d, 0x36, 0x10, 0x1d, 0x0e, 0x18, 0x27, 0x0f, 0x01, 0x12, 0x16, 0x05, // ../G}6....'.....
+	0x03, 0x45, 0x72, 0x82, 0x56, 0x25, 0x01, 0x77, 0xff, 0xc9, 0x03, 0xb5, 0x41, 0xc7, 0x05, 0x5d, // .Er.V%.w....A..]
+	0x64, 0x04, 0x42, 0xca, 0x05, 0x42, 0xb8, 0x04, 0x84, 0x64, 0x54, 0x85, 0x05, 0x24, 0x03, 0xa8, // d.B..B...dT..$..
+	0x06, 0x07, 0x10, 0x42, 0x09, 0x07, 0x41, 0x2b, 0x03, 0x42, 0x1d, 0x04, 0x31, 0x79, 0x0a, 0x10, // ...B..A+.B..1y..
+	0x07, 0x01, 0xe2, 0x06, 0x10, 0x0a, 0x2d, 0x55, 0x4d, 0x47, 0x20, 0x1f, 0x30, 0x20, 0x0f, 0x83, // ......-UMG .0 ..
+	0xee, 0x25, 0x32, 0x32, 0x2a, 0x64, 0x3a, 0x5b, 0x50, 0x16, 0x04, 0x43, 0xe3, 0x05, 0x28, 0x03, // .%22*d:[P..C..(.
+	0xb6, 0x02, 0x49, 0x00, 0x2a, 0x00, 0x00, 0x25, 0x41, 0x38, 0x07, 0x21, 0x35, 0x33, 0x84, 0xc9, // ..I.*..%A8.!53..
+	0x41, 0x38, 0x0a, 0x43, 0x98, 0x04, 0x44, 0x01, 0x06, 0x2c, 0x33, 0x02, 0x00, 0x48, 0x7b, 0x32, // A8.C..D..,3..H{2
+	0x26, 0x30, 0x09, 0x03, 0x49, 0xa8, 0x01, 0x41, 0x3b, 0x03, 0x21, 0x20, 0x46, 0x41, 0x3b, 0x03, // &0..I..A;.! FA;.
+	0x41, 0xb3, 0x03, 0x23, 0x34, 0x3d, 0x0a, 0x04, 0x83, 0x62, 0x29, 0x03, 0x03, 0x09, 0x30, 0x26, // A..#4=...b)...0&
+	0x32, 0x7a, 0x48, 0x67, 0x32, 0x41, 0x3e, 0x03, 0x22, 0x15, 0x5b, 0x2d, 0x41, 0x3e, 0x0f, 0x24, // 2zHg2A>.".[-A>.$
+	0x89, 0x89, 0x12, 0x21, 0x10, 0x41, 0x60, 0x03, 0x5f, 0x20, 0x03, 0x27, 0x00, 0x07, 0x01, 0x39, // ...!.A`._ .'...9
+	0x03, 0xb6, 0x03, 0x76, 0x43, 0x27, 0x04, 0x82, 0x7c, 0x20, 0x2e, 0x18, 0x64, 0x4d, 0x09, 0x42, // ...vC'..| ..dM.B
+	0x4b, 0x05, 0x5b, 0x8c, 0x0c, 0x29, 0x17, 0x03, 0xb6, 0xa8, 0x49, 0x06, 0x32, 0x2a, 0x32, 0x7b, // K.[..)....I.2*2{
+	0x43, 0x74, 0x03, 0x21, 0x32, 0x33, 0x42, 0x42, 0x03, 0x42, 0x26, 0x08, 0x44, 0x0a, 0x08, 0x26, // Ct.!23BB.B&.D..&
+	0x01, 0x01, 0x94, 0x5b, 0x3a, 0x63, 0x2a, 0x41, 0xc0, 0x03, 0x42, 0xde, 0x04, 0x43, 0x4c, 0x11, // ...[:c*A..B..CL.
+	0x20, 0x2e, 0x84, 0xff, 0x29, 0x01, 0x76, 0x01, 0x94, 0x03, 0xb5, 0x03, 0xbb, 0x00, 0x18, 0x8b, //  ...).v.........
+	0x7b, 0x44, 0x17, 0x07, 0x84, 0x6e, 0x20, 0xb5, 0x43, 0xe3, 0x07, 0x44, 0x69, 0x0a, 0x88, 0x5e, // {D...n .C..Di..^
+	0x8d, 0x7d, 0x83, 0x4f, 0x25, 0xff, 0xc9, 0x03, 0xb4, 0x03, 0x78, 0x7c, 0x39, 0x04, 0x23, 0x15, // .}.O%.....x|9.#.
+	0x23, 0x35, 0x17, 0x49, 0xe9, 0x09, 0x22, 0x0f, 0x01, 0x23, 0x41, 0xb9, 0x08, 0x58, 0x0b, 0x0a, // #5.I.."..#A..X..
+	0x23, 0x02, 0x2d, 0x5c, 0x2e, 0x88, 0x57, 0x83, 0x4a, 0x2d, 0x06, 0x01, 0x1f, 0x46, 0x4c, 0x52, // #.-...W.J-...FLR
+	0x2c, 0x89, 0x89, 0x46, 0x77, 0x32, 0x06, 0x32, 0x82, 0x00, 0x26, 0x2a, 0x64, 0x39, 0x03, 0x18, // ,..Fw2.2..&*d9..
+	0x48, 0xa8, 0x43, 0x3f, 0x03, 0x83, 0x67, 0x41, 0x6b, 0x04, 0x25, 0x47, 0x20, 0x06, 0x1e, 0x2d, // H.C?..gAk.%G ..-
+	0x1e, 0x41, 0xcf, 0x04, 0x22, 0x2f, 0x2f, 0x06, 0x44, 0x80, 0x05, 0x22, 0x2b, 0x31, 0x06, 0x44, // .A.."//.D.."+1.D
+	0x77, 0x06, 0x23, 0xff, 0xc9, 0x02, 0x89, 0x82, 0x83, 0x41, 0x4f, 0x03, 0x20, 0x37, 0x82, 0x84, // w.#......AO. 7..
+	0x21, 0x0e, 0x01, 0x53, 0x45, 0x09, 0x44, 0x03, 0x0b, 0x44, 0x77, 0x07, 0x20, 0x2e, 0x41, 0x2a, // !..SE.D..Dw. .A*
+	0x1e, 0x24, 0x03, 0x77, 0x01, 0xa8, 0x48, 0x44, 0x28, 0x05, 0x22, 0x48, 0x7a, 0x33, 0x44, 0x14, // .$.w..HD(."Hz3D.
+	0x07, 0x21, 0x30, 0x1f, 0x44, 0x14, 0x04, 0x44, 0x77, 0x0e, 0x24, 0x07, 0x01, 0x39, 0x02, 0x2e, // .!0.D..Dw.$..9..
+	0x4c, 0x0f, 0x04, 0x21, 0x00, 0x01, 0x85, 0x78, 0x41, 0xc6, 0x0c, 0x44, 0x27, 0x04, 0x82, 0x93, // L..!...xA..D'...
+	0x27, 0x01, 0xd3, 0x19, 0x2e, 0x16, 0x1d, 0x35, 0x18, 0x41, 0x41, 0x09, 0x22, 0x26, 0x55, 0x30, // '......5.AA."&U0
+	0x44, 0x19, 0x03, 0x29, 0x5b, 0x02, 0xd0, 0x48, 0x03, 0x0c, 0x09, 0x0d, 0x25, 0x18, 0x89, 0x8c, // D..)[..H....%...
+	0x44, 0x0a, 0x04, 0x21, 0x01, 0xa7, 0x41, 0xaf, 0x04, 0x26, 0xd2, 0x01, 0x39, 0x03, 0xf8, 0x03, // D..!..A..&..9...
+	0x76, 0x43, 0x0f, 0x04, 0x22, 0x2e, 0x01, 0x27, 0x82, 0xdd, 0x5e, 0xbc, 0x06, 0x44, 0x7b, 0x0c, // vC.."..'..^..D{.
+	0x26, 0x02, 0xf4, 0x2a, 0x64, 0x39, 0x5b, 0x06, 0x44, 0xca, 0x03, 0x41, 0x5b, 0x08, 0x45, 0x3b, // &..*d9[.D..A[.E;
+	0x04, 0x28, 0x32, 0x02, 0xb6, 0x2a, 0x31, 0x07, 0x48, 0x79, 0x09, 0x46, 0x2c, 0x04, 0x44, 0x5d, // .(2..*1.Hy.F,.D]
+	0x0c, 0x43, 0x0f, 0x09, 0x25, 0x12, 0x02, 0xd3, 0x00, 0x31, 0x00, 0x18, 0x89, 0x8f, 0x0c, 0x20, // .C..%....1..... 
+	0x07, 0x45, 0xae, 0x09, 0x43, 0x0b, 0x09, 0x42, 0x2e, 0x06, 0x18, 0x64, 0x3a, 0x07, 0x23, 0x00, // .E..C..B...d:.#.
+	0x39, 0x61, 0x28, 0x83, 0x00, 0x23, 0x27, 0x5e, 0x37, 0x28, 0x45, 0xbd, 0x09, 0x41, 0xa2, 0x03, // 9a(..#'^7(E..A..
+	0x45, 0xd1, 0x04, 0x24, 0x28, 0x38, 0x5e, 0x27, 0x27, 0x82, 0x1d, 0x24, 0x28, 0x61, 0x39, 0x02, // E..$(8^''..$(a9.
+	0xd3, 0x82, 0x26, 0x21, 0x61, 0x39, 0x82, 0x2f, 0x23, 0x26, 0x28, 0x02, 0xa4, 0x45, 0xc3, 0x07, // ..&!a9./#&(..E..
+	0x85, 0x87, 0x43, 0xb9, 0x03, 0x21, 0x46, 0x01, 0x82, 0x18, 0x84, 0x1f, 0x21, 0x28, 0x28, 0x82, // ..C..!F.....!((.
+	0x93, 0x20, 0xeb, 0x47, 0x2b, 0x04, 0x20, 0xd1, 0x18, 0x69, 0xd9, 0x04, 0x6b, 0xc7, 0x11, 0x47, // . .G+. ..i..k..G
+	0x3c, 0x17, 0x21, 0x3d, 0x01, 0x86, 0x9e, 0x20, 0xeb, 0x87, 0x6c, 0x20, 0x28, 0x82, 0x7f, 0x82, // <.!=... ..l (...
+	0x9c, 0x20, 0x27, 0x45, 0xd9, 0x16, 0x22, 0x28, 0x37, 0x5e, 0x82, 0x9f, 0x21, 0x01, 0xc0, 0x86, // . 'E.."(7^..!...
+	0x29, 0x85, 0x33, 0x22, 0x27, 0x28, 0x01, 0x47, 0x68, 0x16, 0x21, 0x75, 0x01, 0x84, 0xcb, 0x82, // ).3"'(.Gh.!u....
+	0x9f, 0x20, 0xf0, 0x47, 0x6f, 0x06, 0x68, 0x17, 0x03, 0x21, 0x15, 0x33, 0x47, 0x71, 0x0c, 0x6c, // . .Go.h..!.3Gq.l
+	0x7c, 0x17, 0x47, 0x88, 0x16, 0x22, 0x03, 0x31, 0x01, 0x47, 0x87, 0x0e, 0x22, 0x2a, 0x4b, 0x1f, // |.G..".1.G.."*K.
+	0x41, 0x53, 0x04, 0x41, 0x0d, 0x06, 0x24, 0x28, 0x28, 0x20, 0x4a, 0x2a, 0x47, 0x9a, 0x0d, 0x27, // AS.A..$(( J*G..'
+	0x2d, 0x52, 0x4b, 0x46, 0x20, 0x02, 0xfd, 0x01, 0x47, 0x9a, 0x10, 0x22, 0x06, 0x26, 0x20, 0x41, // -RKF ...G..".& A
+	0x44, 0x07, 0x41, 0x01, 0x07, 0x22, 0x20, 0x26, 0x06, 0x47, 0xb0, 0x14, 0x47, 0xaf, 0x08, 0x21, // D.A.." &.G..G..!
+	0x03, 0x12, 0x82, 0xc7, 0x20, 0x3f, 0x41, 0x67, 0x03, 0x43, 0x1c, 0x05, 0x47, 0xb6, 0x10, 0x98, // .... ?Ag.C..G...
+	0xd0, 0x42, 0x1e, 0x07, 0x20, 0x4c, 0x46, 0xb3, 0x0f, 0x41, 0xfc, 0x04, 0x22, 0x2b, 0x4a, 0x20, // .B.. LF..A.."+J 
+	0x41, 0xfb, 0x06, 0x89, 0xc6, 0x42, 0x23, 0x09, 0x21, 0x01, 0xc1, 0x43, 0x45, 0x08, 0x47, 0xe1, // A....B#.!..CE.G.
+	0x0f, 0x95, 0xc4, 0x47, 0xf7, 0x0a, 0x47, 0xeb, 0x05, 0x23, 0x03, 0x10, 0x02, 0xd4, 0x18, 0x5e, // ...G..G..#.....^
+	0xe5, 0x07, 0x7e, 0xe1, 0x0b, 0x47, 0xfa, 0x19, 0x41, 0x81, 0x05, 0x18, 0x40, 0x0a, 0x04, 0x20, // ..~..G..A...@.. 
+	0xc0, 0x89, 0x5b, 0x22, 0x27, 0x27, 0x02, 0x48, 0x12, 0x17, 0x21, 0x02, 0x27, 0x86, 0xbe, 0x21, // ..["''.H..!.'..!
+	0x02, 0x84, 0x42, 0x1a, 0x07, 0x82, 0x2e, 0x42, 0x4e, 0x1f, 0x21, 0x28, 0x28, 0x41, 0x5b, 0x07, // ..B....BN.!((A[.
+	0x20, 0xb0, 0x51, 0x53, 0x04, 0x41, 0x5b, 0x03, 0x45, 0xcc, 0x09, 0x48, 0x2a, 0x0f, 0x20, 0x33, //  .QS.A[.E..H*. 3
+	0x88, 0x94, 0x8e, 0xc7, 0x48, 0x66, 0x05, 0x20, 0xcc, 0x46, 0x6a, 0x03, 0x20, 0x2d, 0x48, 0x3d, // ....Hf. .Fj. -H=
+	0x11, 0x20, 0x47, 0x44, 0xfc, 0x03, 0x26, 0x07, 0x48, 0x07, 0x26, 0x20, 0x28, 0x60, 0x41, 0x2b, // . GD..&.H.& (`A+
+	0x0b, 0x24, 0x60, 0x28, 0x20, 0x26, 0x07, 0x48, 0x78, 0x05, 0x21, 0x02, 0xf7, 0x83, 0xc9, 0x45, // .$`( &.Hx.!....E
+	0x42, 0x08, 0x41, 0x9b, 0x04, 0x42, 0x44, 0x03, 0x25, 0x2a, 0x63, 0x39, 0x2a, 0x4a, 0x20, 0x41, // B.A..BD.%*c9*J A
+	0x00, 0x09, 0x41, 0x9b, 0x07, 0x84, 0xfc, 0x48, 0x63, 0x08, 0x20, 0xd1, 0x5e, 0x99, 0x04, 0x92, // ..A....Hc. .^...
+	0x96, 0x48, 0x71, 0x0a, 0x43, 0x80, 0x0c, 0x41, 0x6a, 0x05, 0x20, 0x27, 0x86, 0xcf, 0x21, 0x02, // .Hq.C..Aj. '..!.
+	0x01, 0x41, 0xc0, 0x0b, 0x24, 0x27, 0x20, 0x27, 0x06, 0x48, 0x42, 0x85, 0x04, 0x48, 0x85, 0x03, // .A..$' '.HB..H..
+	0x21, 0x33, 0x32, 0x44, 0x21, 0x03, 0x42, 0xf0, 0x09, 0x46, 0x62, 0x08, 0x23, 0xa7, 0x06, 0x27, // !32D!.B..Fb.#..'
+	0x1f, 0x44, 0x2b, 0x03, 0x21, 0xd1, 0x27, 0x8d, 0x9a, 0x20, 0x39, 0x41, 0x6e, 0x03, 0x82, 0xb9, // .D+.!.'.. 9An...
+	0x43, 0x91, 0x0c, 0x42, 0x74, 0x05, 0x82, 0x3f, 0x20, 0x2e, 0x83, 0xcd, 0x20, 0x27, 0x41, 0x73, // C..Bt..? ... 'As
+	0x09, 0x22, 0x13, 0x03, 0xbb, 0x6e, 0xd7, 0x04, 0x20, 0x37, 0x42, 0xc9, 0x08, 0x44, 0x30, 0x07, // ."...n.. 7B..D0.
+	0x41, 0x65, 0x12, 0x20, 0x15, 0x49, 0xcd, 0x08, 0x25, 0x01, 0xc7, 0x3a, 0x89, 0x89, 0x47, 0x42, // Ae. .I..%..:..GB
+	0x82, 0x04, 0x24, 0x45, 0x01, 0x28, 0x27, 0x27, 0x42, 0x82, 0x0d, 0x24, 0x27, 0x27, 0x28, 0x01, // ..$E.(''B..$''(.
+	0xa4, 0x41, 0x56, 0x04, 0x25, 0x35, 0x7e, 0x48, 0x03, 0x73, 0x04, 0x42, 0xb4, 0x05, 0x22, 0x2a, // .AV.%5~H.s.B.."*
+	0x63, 0x39, 0x41, 0xf3, 0x04, 0x20, 0x27, 0x8b, 0xb0, 0x45, 0x0c, 0x04, 0x41, 0x4c, 0x04, 0x22, // c9A.. '..E..AL."
+	0x35, 0x3f, 0x08, 0x44, 0x2b, 0x03, 0x25, 0xff, 0xc9, 0x03, 0xb6, 0x02, 0xd4, 0x6e, 0xcf, 0x04, // 5?.D+.%......n..
+	0x48, 0xcf, 0x14, 0x20, 0x0e, 0x18, 0x53, 0x40, 0x09, 0x43, 0x66, 0x0b, 0x20, 0x17, 0x48, 0xe6, // H.. ..S@.Cf. .H.
+	0x04, 0x22, 0xa9, 0x07, 0x06, 0x41, 0x29, 0x08, 0x23, 0x88, 0x88, 0x48, 0x7b, 0x46, 0xf3, 0x03, // ."...A).#..H{F..
+	0x41, 0xf6, 0x04, 0x84, 0x95, 0x44, 0x28, 0x09, 0x26, 0x20, 0x26, 0x07, 0x78, 0x0a, 0x11, 0x06, // A....D(.& &.x...
+	0x48, 0xfc, 0x16, 0x43, 0x8c, 0x13, 0x49, 0x0f, 0x0d, 0x41, 0xef, 0x05, 0x83, 0x75, 0x20, 0x07, // H..C..I..A...u .
+	0x41, 0xd1, 0x0d, 0x45, 0xfc, 0x08, 0x20, 0x33, 0x9b, 0xae, 0x21, 0x02, 0xc2, 0x43, 0xa3, 0x03, // A..E.. 3..!..C..
+	0x20, 0x01, 0x41, 0x94, 0x08, 0x43, 0xe8, 0x05, 0x21, 0x30, 0x1f, 0x46, 0x0c, 0x06, 0x43, 0xdd, //  .A..C..!0.F..C.
+	0x12, 0x89, 0x8f, 0x21, 0x02, 0x82, 0x42, 0x7e, 0x05, 0x41, 0xd8, 0x0f, 0x46, 0x1b, 0x04, 0x48, // ...!..B~.A..F..H
+	0x0e, 0x06, 0x42, 0xb1, 0x0d, 0x21, 0x27, 0x27, 0x43, 0x63, 0x06, 0x24, 0x07, 0x00, 0xb0, 0x03, // ..B..!''Cc.$....
+	0xb6, 0x43, 0x63, 0x06, 0x49, 0x34, 0x0e, 0x41, 0x56, 0x19, 0x49, 0x6d, 0x0f, 0x20, 0x4c, 0x49, // .Cc.I4.AV.Im. LI
+	0x4c, 0x12, 0x20, 0xa8, 0x92, 0xa7, 0x45, 0x4a, 0x06, 0x49, 0x86, 0x0b, 0x21, 0x01, 0xc2, 0x44, // L. ...EJ.I..!..D
+	0x32, 0x08, 0x43, 0x68, 0x08, 0x20, 0x2e, 0x43, 0x5d, 0x13, 0x21, 0x39, 0x63, 0x45, 0xc0, 0x04, // 2.Ch. .C].!9cE..
+	0x44, 0x65, 0x04, 0x82, 0xb7, 0x20, 0xee, 0x82, 0xb7, 0x49, 0x83, 0x03, 0x53, 0x19, 0x03, 0x20, // De... ...I..S.. 
+	0x15, 0xa7, 0xb1, 0x24, 0x15, 0x27, 0x37, 0x01, 0xff, 0x93, 0xa2, 0x42, 0x7f, 0x09, 0x45, 0xed, // ...$.'7....B..E.
+	0x09, 0x24, 0x89, 0x89, 0x03, 0xbb, 0x44, 0xa2, 0x93, 0x82, 0xc5, 0x83, 0x8f, 0x49, 0xc3, 0x06, // .$....D......I..
+	0x20, 0x42, 0x83, 0x8f, 0x18, 0x44, 0x35, 0x10, 0x18, 0x67, 0xc2, 0x06, 0x49, 0xda, 0x24, 0x41, //  B...D5..g..I.$A
+	0xa8, 0x10, 0x41, 0xdb, 0x10, 0x49, 0xed, 0x16, 0x41, 0x70, 0x15, 0x4a, 0x03, 0x2d, 0x21, 0x03, // ..A..I..Ap.J.-!.
+	0x12, 0x82, 0xc3, 0x42, 0xc7, 0x03, 0x20, 0x37, 0x99, 0xc4, 0x4a, 0x1a, 0x20, 0x8c, 0xc1, 0x83, // ...B.. 7..J. ...
+	0x8c, 0x22, 0x20, 0x4a, 0x2b, 0x4a, 0x2d, 0x21, 0x95, 0xbe, 0x4a, 0x43, 0x28, 0x21, 0x00, 0xb0, // ." J+J-!..JC(!..
+	0x84, 0xbb, 0x42, 0x0f, 0x03, 0x98, 0xb3, 0x4c, 0x19, 0x0a, 0x87, 0xdf, 0x21, 0x03, 0x12, 0x93, // ..B....L....!...
+	0xa8, 0x4b, 0xa2, 0x0d, 0x84, 0xcf, 0x21, 0x01, 0xc2, 0x47, 0x50, 0x0f, 0x20, 0x48, 0x46, 0xf4, // .K....!..GP. HF.
+	0x10, 0x87, 0xc4, 0x42, 0x9f, 0x06, 0x22, 0xf8, 0x03, 0x77, 0x44, 0xb3, 0x04, 0x41, 0x4a, 0x19, // ...B.."..wD..AJ.
+	0x4a, 0x87, 0x13, 0x42, 0x04, 0x18, 0x20, 0x07, 0x4a, 0x9a, 0x12, 0x41, 0xf9, 0x0e, 0x8c, 0x9f, // J..B.. .J..A....
+	0x20, 0x79, 0x47, 0x52, 0x04, 0x46, 0xbe, 0x0d, 0x41, 0xeb, 0x06, 0x56, 0x5b, 0x09, 0x23, 0x6f, //  yGR.F..A..V[.#o
+	0x00, 0x94, 0x00, 0x18, 0x71, 0x8f, 0x18, 0x51, 0xbe, 0x07, 0x18, 0x81, 0xe6, 0x05, 0x23, 0x2f, // ....q..Q......#/
+	0x03, 0x34, 0x36, 0x67, 0x32, 0x03, 0x20, 0x08, 0x83, 0xba, 0x48, 0xd3, 0x08, 0x20, 0x27, 0x82, // .46g2. ...H.. '.
+	0x03, 0x83, 0x24, 0x20, 0x37, 0x18, 0x94, 0x76, 0x04, 0x82, 0xe6, 0x20, 0x07, 0x48, 0xdf, 0x08, // ..$ 7..v... .H..
+	0x59, 0x9e, 0x03, 0x7f, 0xa4, 0x05, 0x42, 0xde, 0x05, 0x20, 0x03, 0x41, 0x07, 0x0a, 0x46, 0x40, // Y.....B.. .A..F@
+	0x09, 0x41, 0x0d, 0x08, 0x43, 0xad, 0x05, 0x08, 0x5d, 0x03, 0x84, 0x10, 0x2d, 0x1d, 0x1c, 0x45, // .A..C...]...-..E
+	0x27, 0x27, 0x51, 0x2a, 0x2a, 0x51, 0x27, 0x27, 0x45, 0x1c, 0x1d, 0x2d, 0x10, 0x10, 0x11, 0x12, // ''Q**Q''E..-....
+	0x13, 0x12, 0x35, 0x21, 0x22, 0x4d, 0x2b, 0x2e, 0x23, 0x33, 0x0f, 0x04, 0x0c, 0x08, 0x0d, 0x13, // ..5!"M+.#3......
+	0x08, 0x09, 0x09, 0x11, 0x1e, 0x0c, 0x06, 0x06, 0x05, 0x07, 0x07, 0x08, 0x09, 0x25, 0x36, 0x06, // .............%6.
+	0x14, 0x0e, 0x38, 0x51, 0x1a, 0x1a, 0x19, 0x18, 0x17, 0x08, 0x08, 0x09, 0x41, 0x0f, 0x21, 0x14, // ..8Q........A.!.
+	0x6f, 0x65, 0x45, 0x0f, 0x1f, 0x11, 0x09, 0x09, 0x0a, 0x18, 0x19, 0x1a, 0x1a, 0x1a, 0x51, 0x37, // oeE...........Q7
+	0x17, 0x16, 0x2b, 0x4d, 0x22, 0x21, 0x35, 0x82, 0x47, 0x24, 0x11, 0x10, 0x87, 0x3a, 0x5d, 0x18, // ..+M"!5.G$...:].
+	0x6c, 0x89, 0x04, 0x2a, 0x22, 0x5b, 0x3b, 0x3a, 0x80, 0x44, 0x44, 0x7f, 0x3a, 0x3b, 0x5c, 0x85, // l..*"[;:.DD.:;..
+	0x0f, 0x24, 0x5c, 0x3b, 0x39, 0x7e, 0x46, 0x82, 0x0f, 0x23, 0x02, 0x63, 0x27, 0x44, 0x85, 0x77, // .$.;9~F..#.c'D.w
+	0x21, 0x11, 0x10, 0x83, 0x8d, 0x08, 0x5c, 0x44, 0x27, 0x27, 0x52, 0x2a, 0x2e, 0x55, 0x29, 0x29, // !......D''R*.U))
+	0x48, 0x1e, 0x1e, 0x2b, 0x0d, 0x6f, 0x05, 0x21, 0x21, 0x0c, 0x15, 0x09, 0x0c, 0x11, 0x0a, 0x04, // H..+.o.!!.......
+	0x04, 0x11, 0x11, 0x06, 0x09, 0x07, 0x08, 0x07, 0x06, 0x07, 0x09, 0x09, 0x13, 0x1e, 0x0a, 0x05, // ................
+	0x1c, 0x16, 0x17, 0x49, 0x33, 0x28, 0x41, 0x19, 0x37, 0x14, 0x24, 0x11, 0x0c, 0x06, 0x15, 0x0f, // ...I3(A.7.$.....
+	0x0d, 0x0b, 0x28, 0x06, 0x06, 0x11, 0x24, 0x14, 0x35, 0x1b, 0x42, 0x27, 0x32, 0x4a, 0x17, 0x17, // ..(...$.5.B'2J..
+	0x1d, 0x05, 0x0f, 0x2b, 0x1c, 0x94, 0x0d, 0x2b, 0x1e, 0x1e, 0x48, 0x29, 0x29, 0x56, 0x2d, 0x2a, // ...+...+..H))V-*
+	0x52, 0x27, 0x01, 0x13, 0x82, 0x85, 0x22, 0x39, 0x7f, 0x46, 0x92, 0x85, 0x86, 0xa5, 0x42, 0xdf, // R'...."9.F....B.
+	0x05, 0x55, 0x1f, 0x05, 0x23, 0xba, 0x00, 0x57, 0x00, 0x18, 0x8a, 0x3b, 0x04, 0x6d, 0x83, 0x04, // .U..#..W...;.m..
+	0x31, 0x16, 0x36, 0x35, 0x34, 0x26, 0x35, 0x06, 0x26, 0x31, 0x2e, 0x01, 0x31, 0x26, 0x36, 0x31, // 1.654&5.&1..1&61
+	0x1e, 0x01, 0x31, 0x18, 0x79, 0x17, 0x05, 0x49, 0xb0, 0x05, 0x24, 0x2e, 0x01, 0x37, 0x30, 0x16, // ..1.y..I..$..70.
+	0x65, 0x2c, 0x06, 0x20, 0x3e, 0x82, 0x1a, 0x21, 0x06, 0x07, 0x47, 0x3b, 0x06, 0x41, 0x82, 0x04, // e,. >..!..G;.A..
+	0x22, 0x15, 0x14, 0x16, 0x6d, 0xbc, 0x06, 0x08, 0x93, 0x23, 0x02, 0x00, 0x69, 0xb8, 0x89, 0x50, // "...m....#..i..P
+	0x34, 0x5c, 0x7f, 0x4b, 0x13, 0x10, 0x01, 0x69, 0x41, 0x11, 0x27, 0x23, 0x26, 0x26, 0x27, 0x22, // 4..K...iA.'#&&'"
+	0x5c, 0x16, 0x03, 0x12, 0x0b, 0x2a, 0x53, 0x41, 0x29, 0x1c, 0x18, 0x03, 0x0c, 0x14, 0x43, 0x48, // .....*SA).....CH
+	0x1f, 0x40, 0x20, 0x20, 0x40, 0x1f, 0x48, 0x42, 0x15, 0x0c, 0x04, 0x19, 0x1b, 0x28, 0x41, 0x53, // .@  @.HB.....(AS
+	0x2a, 0x0d, 0x15, 0x01, 0x10, 0x13, 0x4b, 0x7f, 0x5c, 0x34, 0x50, 0x89, 0xb8, 0x69, 0x03, 0xba, // *.....K..4P..i..
+	0x52, 0x8d, 0xbc, 0x6c, 0x56, 0x9c, 0x80, 0x60, 0x1a, 0x03, 0x12, 0x0a, 0x09, 0x2f, 0x20, 0x17, // R..lV..`...../ .
+	0x5d, 0x2d, 0x1f, 0x18, 0x07, 0x03, 0x32, 0x3c, 0x07, 0x0a, 0x19, 0x22, 0x0a, 0x05, 0x19, 0x39, // ]-....2<..."...9
+	0x5f, 0x4a, 0x2b, 0x45, 0x1b, 0x0a, 0x4a, 0x36, 0x03, 0x32, 0x08, 0x09, 0x09, 0x09, 0x33, 0x03, // _J+E..J6.2....3.
+	0x36, 0x4a, 0x0a, 0x1b, 0x45, 0x2b, 0x4a, 0x5f, 0x39, 0x19, 0x04, 0x0d, 0x2f, 0x24, 0x34, 0x4e, // 6J..E+J_9.../$4N
+	0x0d, 0x0a, 0x12, 0x03, 0x1a, 0x60, 0x81, 0x9b, 0x56, 0x6c, 0xbc, 0x8d, 0x52, 0x86, 0xf3, 0x21, // .....`..Vl..R..!
+	0x00, 0x18, 0x82, 0xf3, 0x20, 0x68, 0x18, 0x72, 0xad, 0x04, 0x6c, 0x6e, 0x09, 0x20, 0x3f, 0x63, // .... h.r..ln. ?c
+	0x51, 0x04, 0x21, 0x33, 0x1f, 0x42, 0xa6, 0x04, 0x42, 0x4c, 0x08, 0x42, 0x4f, 0x06, 0x20, 0x33, // Q.!3.B..BL.BO. 3
+	0x50, 0x79, 0x03, 0x28, 0x35, 0x3f, 0x01, 0x17, 0x32, 0x36, 0x37, 0x07, 0x37, 0x55, 0xa2, 0x05, // Py.(5?..267.7U..
+	0x6e, 0x80, 0x04, 0x20, 0x3d, 0x82, 0x37, 0x20, 0x33, 0x42, 0x6a, 0x07, 0x20, 0x3f, 0x42, 0xd6, // n.. =.7 3Bj. ?B.
+	0x04, 0x20, 0x27, 0x42, 0xda, 0x03, 0x08, 0xa2, 0x01, 0xd2, 0x21, 0x22, 0x20, 0x50, 0x30, 0x18, // . 'B......!" P0.
+	0x2f, 0x16, 0x3b, 0x61, 0x14, 0x12, 0x0c, 0x01, 0x10, 0x11, 0x11, 0x09, 0x05, 0x14, 0x2e, 0x1a, // /.;a............
+	0x12, 0x13, 0x14, 0x39, 0x24, 0x28, 0x5b, 0x33, 0x3a, 0x7f, 0x44, 0x2b, 0x53, 0x2a, 0x02, 0x28, // ...9$([3:.D+S*.(
+	0x4b, 0x23, 0x0e, 0x0e, 0x16, 0x2c, 0x1e, 0x3c, 0x1e, 0x02, 0x23, 0x2f, 0x1d, 0x27, 0x0b, 0x02, // K#...,.<..#/.'..
+	0x01, 0x02, 0x07, 0x19, 0x1a, 0x1a, 0x08, 0x13, 0x01, 0x0d, 0x0e, 0x0f, 0x10, 0x02, 0x08, 0x05, // ................
+	0x16, 0x12, 0x23, 0x53, 0x30, 0x02, 0x29, 0x55, 0x2d, 0x02, 0x81, 0x30, 0x51, 0x22, 0x22, 0x22, // ..#S0.)U-..0Q"""
+	0x0a, 0x0a, 0x27, 0x27, 0x05, 0x09, 0x11, 0x14, 0x22, 0x0a, 0x14, 0x15, 0x1d, 0x32, 0x15, 0x08, // ..''...."....2..
+	0x35, 0x68, 0x34, 0x35, 0x5f, 0x2a, 0x2d, 0x46, 0x1a, 0x1b, 0x1b, 0x0d, 0x0c, 0x0c, 0x22, 0x16, // 5h45_*-F......".
+	0x11, 0x16, 0x11, 0x07, 0x02, 0x0a, 0x0b, 0x02, 0x0f, 0x1d, 0x16, 0x39, 0x23, 0x06, 0x0b, 0x05, // ...........9#...
+	0x0a, 0x1b, 0x20, 0x4a, 0x2a, 0x01, 0x15, 0x0c, 0x19, 0x35, 0x1c, 0x1f, 0x3a, 0x1b, 0x05, 0x07, // .. J*....5..:...
+	0x03, 0x02, 0x0c, 0x2b, 0x44, 0x1b, 0x02, 0x15, 0x1b, 0x06, 0x08, 0x61, 0x8b, 0x0c, 0x21, 0x3e, // ...+D......a..!>
+	0x00, 0x75, 0x47, 0x06, 0x23, 0x23, 0x15, 0x33, 0x17, 0x18, 0x67, 0x35, 0x05, 0x43, 0x43, 0x05, // .uG.##.3..g5.CC.
+	0x69, 0x88, 0x13, 0x26, 0x2b, 0x01, 0x37, 0x35, 0x3f, 0x02, 0x23, 0x74, 0xa6, 0x05, 0x22, 0x17, // i..&+.75?.#t..".
+	0x33, 0x35, 0x47, 0x1f, 0x03, 0x3d, 0x02, 0x82, 0x09, 0x0e, 0x05, 0x0e, 0x52, 0x2a, 0x28, 0xfe, // 35G..=......R*(.
+	0x57, 0x40, 0x0f, 0x1b, 0x0c, 0x0c, 0x12, 0x07, 0x07, 0x07, 0x1a, 0x19, 0x18, 0x3b, 0x23, 0x02, // W@...........;#.
+	0xb0, 0x21, 0x38, 0x16, 0x83, 0x00, 0x08, 0x2d, 0x17, 0x37, 0x21, 0x60, 0x02, 0x37, 0x38, 0x10, // .!8....-.7!`.78.
+	0x7f, 0x01, 0x08, 0x06, 0x06, 0x0c, 0x07, 0x57, 0x86, 0x27, 0x3c, 0x15, 0x02, 0xce, 0x0a, 0x16, // .......W.'<.....
+	0x0c, 0x33, 0x85, 0x8a, 0x02, 0xfe, 0x68, 0x0e, 0x07, 0x12, 0x0c, 0x0c, 0x1b, 0x0f, 0x10, 0x20, // .3....h........ 
+	0x10, 0x02, 0xb0, 0x20, 0x38, 0x17, 0x84, 0x32, 0x38, 0x38, 0x21, 0xfd, 0x50, 0x22, 0x3b, 0x19, // ... 8..288!.P";.
 	0x19, 0x1a, 0xce, 0xca, 0x02, 0x03, 0x89, 0x5e, 0x07, 0x0b, 0x04, 0x05, 0x04, 0x01, 0x8e, 0x01, // .......^........
-	0x14, 0x13, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x82, 0x03, 0xfa, 0x03, 0x07, 0x00, 0x0c, // ................
-	0x00, 0x3b, 0x00, 0x00, 0x01, 0x15, 0x23, 0x15, 0x23, 0x35, 0x23, 0x35, 0x33, 0x35, 0x33, 0x15, // .;....#.#5#5353.
-	0x33, 0x05, 0x15, 0x17, 0x0e, 0x01, 0x07, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, // 3.......&'..7>.7
-	0x3e, 0x01, 0x17, 0x1e, 0x01, 0x17, 0x37, 0x2e, 0x01, 0x07, 0x26, 0x06, 0x07, 0x0e, 0x01, 0x07, // >.....7...&.....
-	0x06, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x27, 0x21, // ........7>.7>.'!
-	0x03, 0xfa, 0x6e, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0xfd, 0x4f, 0xba, 0x09, 0x41, 0x38, 0x35, 0x5b, // ..nmmmmn.O..A85[
-	0x25, 0x26, 0x25, 0x01, 0x01, 0x29, 0x28, 0x1a, 0x3f, 0x25, 0x22, 0x3f, 0x1c, 0x52, 0x34, 0x6c, // %&%..)(.?%"?.R4l
-	0x38, 0x3e, 0x6f, 0x31, 0x31, 0x32, 0x01, 0x03, 0x1a, 0x1d, 0x1d, 0x4d, 0x30, 0x31, 0x64, 0x34, // 8>o112.....M01d4
-	0x36, 0x53, 0x1e, 0x22, 0x1c, 0x05, 0xfe, 0xcb, 0x01, 0xf6, 0x6d, 0x6d, 0x6d, 0x6d, 0x6e, 0x6e, // 6S."......mmmmnn
-	0x07, 0x70, 0x01, 0x33, 0x42, 0x10, 0x0f, 0x15, 0x23, 0x1e, 0x52, 0x36, 0x34, 0x51, 0x1c, 0x15, // .p.3B...#.R64Q..
-	0x13, 0x03, 0x02, 0x15, 0x15, 0x55, 0x2c, 0x28, 0x04, 0x03, 0x2d, 0x30, 0x2e, 0x6e, 0x40, 0x33, // .....U,(..-0.n@3
-	0x62, 0x2e, 0x2d, 0x40, 0x12, 0x13, 0x06, 0x0c, 0x0f, 0x38, 0x2a, 0x2f, 0x7f, 0x4e, 0x00, 0x00, // b.-@.....8*/.N..
-	0x00, 0x03, 0x00, 0x06, 0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x69, 0x00, 0x7e, 0x00, 0x93, // ...........i.~..
-	0x00, 0x00, 0x01, 0x14, 0x06, 0x07, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, // .......&'..'..'.
-	0x01, 0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, // .'..7>.76&'..'..
-	0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x26, 0x06, 0x07, 0x06, 0x16, 0x07, // '..'..'..'&.....
-	0x0e, 0x01, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x16, 0x15, 0x14, 0x06, 0x23, 0x2e, 0x01, 0x27, 0x26, // ...........#..'&
-	0x36, 0x27, 0x26, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, // 6'&.............
-	0x17, 0x16, 0x06, 0x17, 0x1e, 0x01, 0x07, 0x06, 0x16, 0x17, 0x1e, 0x01, 0x07, 0x2e, 0x03, 0x35, // ...............5
-	0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x15, 0x33, 0x16, 0x0e, 0x02, 0x07, 0x22, 0x2e, 0x02, // 4>.32...3...."..
-	0x35, 0x34, 0x3e, 0x02, 0x33, 0x32, 0x1e, 0x02, 0x17, 0x27, 0x2e, 0x03, 0x23, 0x22, 0x0e, 0x02, // 54>.32...'..#"..
-	0x15, 0x14, 0x1e, 0x02, 0x33, 0x3e, 0x03, 0x27, 0x03, 0xb3, 0x16, 0x0c, 0x0d, 0x17, 0x03, 0x02, // ....3>.'........
-	0x0a, 0x05, 0x06, 0x0d, 0x0c, 0x0c, 0x0c, 0x09, 0x06, 0x03, 0x03, 0x05, 0x11, 0x02, 0x03, 0x3c, // ...............<
-	0x04, 0x09, 0x2e, 0x02, 0x03, 0x09, 0x0e, 0x0f, 0x51, 0x0b, 0x0b, 0x0f, 0x03, 0x08, 0x25, 0x09, // ........Q.....%.
-	0x03, 0x08, 0x03, 0x06, 0x04, 0x01, 0x01, 0x09, 0x07, 0x07, 0x07, 0x08, 0x08, 0x01, 0x10, 0x08, // ................
-	0x09, 0x05, 0x03, 0x03, 0x01, 0x03, 0x02, 0x0b, 0x03, 0x02, 0x0a, 0x0d, 0x02, 0x03, 0x09, 0x04, // ................
+	0x14, 0x13, 0x44, 0x6b, 0x04, 0x22, 0x07, 0x00, 0x82, 0x82, 0xbb, 0x22, 0x07, 0x00, 0x0c, 0x18, // ..Dk."....."....
+	0x58, 0xa3, 0x04, 0x20, 0x15, 0x69, 0x7d, 0x06, 0x26, 0x35, 0x33, 0x15, 0x33, 0x05, 0x15, 0x17, // X.. .i}.&53.3...
+	0x82, 0x92, 0x18, 0x4e, 0xd2, 0x0a, 0x44, 0x49, 0x04, 0x22, 0x2e, 0x01, 0x07, 0x18, 0x51, 0xca, // ...N..DI."....Q.
+	0x05, 0x5c, 0x83, 0x05, 0x20, 0x1e, 0x86, 0x1b, 0x25, 0x27, 0x21, 0x03, 0xfa, 0x6e, 0x6d, 0x82, // .... ...%'!..nm.
+	0x00, 0x08, 0x32, 0x6e, 0xfd, 0x4f, 0xba, 0x09, 0x41, 0x38, 0x35, 0x5b, 0x25, 0x26, 0x25, 0x01, // ..2n.O..A85[%&%.
+	0x01, 0x29, 0x28, 0x1a, 0x3f, 0x25, 0x22, 0x3f, 0x1c, 0x52, 0x34, 0x6c, 0x38, 0x3e, 0x6f, 0x31, // .)(.?%"?.R4l8>o1
+	0x31, 0x32, 0x01, 0x03, 0x1a, 0x1d, 0x1d, 0x4d, 0x30, 0x31, 0x64, 0x34, 0x36, 0x53, 0x1e, 0x22, // 12.....M01d46S."
+	0x1c, 0x05, 0xfe, 0xcb, 0x01, 0xf6, 0x84, 0x36, 0x08, 0x2f, 0x6e, 0x07, 0x70, 0x01, 0x33, 0x42, // .......6./n.p.3B
+	0x10, 0x0f, 0x15, 0x23, 0x1e, 0x52, 0x36, 0x34, 0x51, 0x1c, 0x15, 0x13, 0x03, 0x02, 0x15, 0x15, // ...#.R64Q.......
+	0x55, 0x2c, 0x28, 0x04, 0x03, 0x2d, 0x30, 0x2e, 0x6e, 0x40, 0x33, 0x62, 0x2e, 0x2d, 0x40, 0x12, // U,(..-0.n@3b.-@.
+	0x13, 0x06, 0x0c, 0x0f, 0x38, 0x2a, 0x2f, 0x7f, 0x4e, 0x00, 0x6d, 0xf7, 0x0b, 0x24, 0x69, 0x00, // ....8*/.N.m..$i.
+	0x7e, 0x00, 0x93, 0x46, 0x5b, 0x05, 0x18, 0x7b, 0x8c, 0x07, 0x20, 0x27, 0x57, 0x60, 0x09, 0x8c, // ~..F[..{.. 'W`..
+	0x11, 0x42, 0x75, 0x04, 0x82, 0x26, 0x20, 0x16, 0x42, 0x99, 0x06, 0x25, 0x06, 0x16, 0x15, 0x14, // .Bu..& .B..%....
+	0x06, 0x23, 0x42, 0x8a, 0x04, 0x18, 0x52, 0xa2, 0x05, 0x45, 0x59, 0x09, 0x21, 0x16, 0x06, 0x58, // .#B...R..EY.!..X
+	0xe8, 0x03, 0x84, 0xe6, 0x20, 0x07, 0x47, 0x42, 0x05, 0x46, 0x0c, 0x03, 0x28, 0x15, 0x33, 0x16, // .... .GB.F..(.3.
+	0x0e, 0x02, 0x07, 0x22, 0x2e, 0x02, 0x87, 0x10, 0x21, 0x17, 0x27, 0x71, 0x7c, 0x05, 0x43, 0xf5, // ..."....!.'q|.C.
+	0x03, 0x08, 0x33, 0x33, 0x3e, 0x03, 0x27, 0x03, 0xb3, 0x16, 0x0c, 0x0d, 0x17, 0x03, 0x02, 0x0a, // ..33>.'.........
+	0x05, 0x06, 0x0d, 0x0c, 0x0c, 0x0c, 0x09, 0x06, 0x03, 0x03, 0x05, 0x11, 0x02, 0x03, 0x3c, 0x04, // ..............<.
+	0x09, 0x2e, 0x02, 0x03, 0x09, 0x0e, 0x0f, 0x51, 0x0b, 0x0b, 0x0f, 0x03, 0x08, 0x25, 0x09, 0x03, // .......Q.....%..
+	0x08, 0x03, 0x06, 0x04, 0x01, 0x01, 0x09, 0x5c, 0xd2, 0x03, 0x2b, 0x08, 0x01, 0x10, 0x08, 0x09, // ..........+.....
+	0x05, 0x03, 0x03, 0x01, 0x03, 0x02, 0x0b, 0x82, 0x39, 0x20, 0x0d, 0x82, 0x28, 0x08, 0x6e, 0x04, // ........9 ..(.n.
 	0x08, 0x0b, 0x03, 0x04, 0x0c, 0x03, 0x02, 0x0c, 0x05, 0x05, 0x07, 0x0c, 0x0f, 0x0e, 0x02, 0x4d, // ...............M
 	0x84, 0x61, 0x37, 0x44, 0x76, 0x9f, 0x5a, 0x5a, 0x9f, 0x76, 0x44, 0x47, 0x01, 0x50, 0x8c, 0xc0, // .a7Dv.ZZ.vDG.P..
 	0x6f, 0x6e, 0xb5, 0x81, 0x46, 0x50, 0x8a, 0xb8, 0x68, 0x69, 0xb7, 0x88, 0x50, 0x02, 0x19, 0x01, // on..FP..hi..P...
 	0x4c, 0x82, 0xaf, 0x63, 0x63, 0xaf, 0x83, 0x4c, 0x43, 0x7a, 0xac, 0x69, 0x6a, 0xb6, 0x85, 0x4c, // L..cc..LCz.ij..L
 	0x01, 0x01, 0xbc, 0x2e, 0x6c, 0x18, 0x18, 0x01, 0x04, 0x04, 0x0e, 0x04, 0x05, 0x09, 0x02, 0x03, // ....l...........
 	0x04, 0x09, 0x06, 0x0a, 0x03, 0x05, 0x06, 0x04, 0x04, 0x49, 0x04, 0x09, 0x27, 0x06, 0x09, 0x28, // .........I..'..(
-	0x16, 0x17, 0x22, 0x0f, 0x0e, 0x1d, 0x08, 0x0e, 0x2e, 0x01, 0x01, 0x02, 0x01, 0x04, 0x06, 0x05, // ..".............
-	0x04, 0x06, 0x06, 0x06, 0x0a, 0x0f, 0x0f, 0x17, 0x0e, 0x0f, 0x1a, 0x01, 0x09, 0x04, 0x05, 0x0d, // ................
-	0x02, 0x01, 0x0b, 0x06, 0x03, 0x14, 0x0b, 0x07, 0x12, 0x04, 0x03, 0x0b, 0x04, 0x09, 0x15, 0x0d, // ................
-	0x0c, 0x55, 0x18, 0x12, 0x25, 0x30, 0x2f, 0x55, 0x19, 0x1e, 0x25, 0x02, 0x0d, 0x4e, 0x73, 0x91, // .U..%0/U..%..Ns.
-	0x51, 0x5b, 0xa0, 0x77, 0x45, 0x45, 0x77, 0xa0, 0x5b, 0x69, 0xb6, 0x88, 0x4e, 0x01, 0x52, 0x8b, // Q[.wEEw.[i..N.R.
-	0xb6, 0x63, 0x64, 0xb8, 0x8d, 0x55, 0x51, 0x8a, 0xb9, 0x6a, 0x01, 0x64, 0xb0, 0x84, 0x4c, 0x50, // .cd..UQ..j.d..LP
-	0x87, 0xaf, 0x5e, 0x5f, 0xad, 0x84, 0x4e, 0x01, 0x4a, 0x81, 0xae, 0x64, 0x00, 0x02, 0x00, 0x06, // ..^_..N.J..d....
-	0xff, 0xc6, 0x03, 0xfa, 0x03, 0xba, 0x00, 0x14, 0x00, 0x7e, 0x00, 0x00, 0x01, 0x22, 0x0e, 0x02, // .........~..."..
-	0x15, 0x14, 0x1e, 0x02, 0x33, 0x32, 0x3e, 0x02, 0x35, 0x34, 0x2e, 0x02, 0x23, 0x15, 0x32, 0x1e, // ....32>.54..#.2.
-	0x02, 0x15, 0x14, 0x06, 0x07, 0x06, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, // ......&'..'..'..
-	0x27, 0x2e, 0x01, 0x37, 0x3e, 0x01, 0x37, 0x36, 0x26, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, // '..7>.76&'..'..'
-	0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x27, 0x22, 0x06, 0x07, 0x06, 0x16, 0x07, 0x0e, // ..'..'..'"......
-	0x01, 0x07, 0x0e, 0x01, 0x07, 0x06, 0x14, 0x17, 0x14, 0x06, 0x23, 0x2e, 0x01, 0x27, 0x26, 0x36, // ..........#..'&6
-	0x27, 0x26, 0x06, 0x07, 0x0e, 0x01, 0x15, 0x14, 0x16, 0x17, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x17, // '&..............
-	0x16, 0x06, 0x17, 0x1e, 0x01, 0x07, 0x06, 0x16, 0x17, 0x1e, 0x01, 0x07, 0x2e, 0x03, 0x35, 0x34, // ..............54
-	0x3e, 0x02, 0x33, 0x02, 0x00, 0x68, 0xb9, 0x89, 0x50, 0x50, 0x89, 0xb9, 0x68, 0x68, 0xb8, 0x8a, // >.3..h..PP..hh..
-	0x50, 0x50, 0x8a, 0xb8, 0x68, 0x5f, 0xa8, 0x7e, 0x48, 0x17, 0x0d, 0x0d, 0x19, 0x03, 0x02, 0x0b, // PP..h_.~H.......
-	0x05, 0x06, 0x0f, 0x0d, 0x0c, 0x0d, 0x09, 0x06, 0x04, 0x03, 0x05, 0x13, 0x02, 0x03, 0x3f, 0x05, // ..............?.
-	0x09, 0x31, 0x03, 0x03, 0x09, 0x0f, 0x10, 0x56, 0x0b, 0x0c, 0x10, 0x04, 0x08, 0x27, 0x0a, 0x03, // .1.....V.....'..
-	0x08, 0x03, 0x07, 0x04, 0x01, 0x01, 0x09, 0x07, 0x08, 0x08, 0x08, 0x08, 0x01, 0x11, 0x09, 0x09, // ................
-	0x06, 0x03, 0x03, 0x01, 0x03, 0x02, 0x0c, 0x03, 0x03, 0x0a, 0x0e, 0x02, 0x03, 0x09, 0x04, 0x09, // ................
-	0x0c, 0x04, 0x03, 0x0c, 0x03, 0x02, 0x0d, 0x05, 0x06, 0x08, 0x0d, 0x0f, 0x10, 0x02, 0x52, 0x8c, // ..............R.
-	0x68, 0x3a, 0x48, 0x7e, 0xa8, 0x60, 0x03, 0xba, 0x50, 0x8a, 0xb8, 0x68, 0x68, 0xb9, 0x89, 0x50, // h:H~.`..P..hh..P
-	0x50, 0x89, 0xb9, 0x68, 0x68, 0xb9, 0x89, 0x50, 0x2c, 0x48, 0x7e, 0xa8, 0x5f, 0x31, 0x72, 0x1a, // P..hh..P,H~._1r.
-	0x19, 0x01, 0x04, 0x04, 0x10, 0x04, 0x05, 0x0a, 0x02, 0x03, 0x04, 0x09, 0x07, 0x0b, 0x03, 0x05, // ................
-	0x06, 0x04, 0x04, 0x4d, 0x05, 0x09, 0x29, 0x07, 0x09, 0x2b, 0x17, 0x17, 0x24, 0x10, 0x0f, 0x1f, // ...M..)..+..$...
-	0x08, 0x0f, 0x30, 0x02, 0x02, 0x01, 0x04, 0x07, 0x04, 0x05, 0x06, 0x06, 0x07, 0x0a, 0x10, 0x10, // ..0.............
-	0x18, 0x0f, 0x10, 0x1b, 0x01, 0x09, 0x05, 0x05, 0x0e, 0x01, 0x02, 0x0c, 0x06, 0x04, 0x15, 0x0b, // ................
-	0x07, 0x14, 0x03, 0x04, 0x0b, 0x05, 0x09, 0x16, 0x0e, 0x0d, 0x59, 0x19, 0x13, 0x27, 0x32, 0x32, // ..........Y..'22
-	0x5a, 0x1a, 0x20, 0x27, 0x02, 0x0e, 0x52, 0x79, 0x99, 0x56, 0x5f, 0xa8, 0x7e, 0x48, 0x00, 0x00, // Z. '..Ry.V_.~H..
-	0x00, 0x02, 0x00, 0x06, 0x00, 0x50, 0x03, 0xfa, 0x03, 0x30, 0x00, 0x3a, 0x00, 0x3e, 0x00, 0x00, // .....P...0.:.>..
-	0x01, 0x2f, 0x01, 0x2e, 0x01, 0x27, 0x2e, 0x01, 0x2f, 0x04, 0x23, 0x0f, 0x03, 0x0e, 0x01, 0x07, // ./...'../.#.....
-	0x0e, 0x01, 0x0f, 0x03, 0x15, 0x1f, 0x03, 0x1e, 0x01, 0x17, 0x1e, 0x01, 0x1f, 0x04, 0x33, 0x3f, // ..............3?
-	0x03, 0x3e, 0x01, 0x37, 0x3e, 0x01, 0x3f, 0x04, 0x35, 0x27, 0x01, 0x11, 0x0d, 0x01, 0x03, 0xf3, // .>.7>.?.5'......
-	0x04, 0x09, 0x06, 0x10, 0x09, 0x0c, 0x1d, 0x11, 0x19, 0x12, 0xe6, 0x59, 0x23, 0x7c, 0xe6, 0x12, // ...........Y#|..
-	0x1a, 0x10, 0x1d, 0x0c, 0x0a, 0x10, 0x06, 0x09, 0x05, 0x05, 0x05, 0x05, 0x03, 0x06, 0x06, 0x10, // ................
-	0x0a, 0x0b, 0x1f, 0x13, 0x1c, 0x15, 0xcb, 0x8e, 0x23, 0x59, 0xe6, 0x12, 0x19, 0x11, 0x1d, 0x0c, // ........#Y......
-	0x09, 0x10, 0x06, 0x07, 0x02, 0x04, 0x07, 0x07, 0xfd, 0xa5, 0x01, 0x10, 0xfe, 0xf0, 0x02, 0x5c, // ................
-	0x35, 0x29, 0x15, 0x20, 0x0a, 0x0e, 0x12, 0x05, 0x06, 0x01, 0x09, 0x02, 0x02, 0x09, 0x01, 0x06, // 5). ............
-	0x05, 0x12, 0x0e, 0x0a, 0x20, 0x15, 0x29, 0x35, 0x74, 0x50, 0x74, 0x35, 0x0c, 0x1b, 0x17, 0x20, // .... .)5tPt5... 
-	0x0a, 0x0d, 0x12, 0x06, 0x04, 0x03, 0x08, 0x03, 0x02, 0x09, 0x03, 0x04, 0x06, 0x12, 0x0d, 0x0a, // ................
-	0x20, 0x17, 0x1b, 0x0c, 0x35, 0x74, 0x50, 0x74, 0xfe, 0xdc, 0x01, 0x26, 0x93, 0x93, 0x00, 0x00, //  ...5tPt...&....
-	0x00, 0x03, 0x00, 0x06, 0xff, 0xf6, 0x03, 0xfa, 0x03, 0x8a, 0x00, 0x0f, 0x00, 0x1f, 0x00, 0x24, // ...............$
-	0x00, 0x00, 0x01, 0x17, 0x01, 0x27, 0x2e, 0x01, 0x35, 0x34, 0x36, 0x37, 0x3e, 0x01, 0x33, 0x32, // .....'..5467>.32
-	0x16, 0x17, 0x05, 0x2e, 0x01, 0x23, 0x22, 0x06, 0x0f, 0x01, 0x01, 0x37, 0x3e, 0x01, 0x35, 0x34, // .....#"....7>.54
-	0x26, 0x27, 0x09, 0x04, 0x01, 0xcd, 0x33, 0xfe, 0x5d, 0x29, 0x17, 0x17, 0x2c, 0x2b, 0x2c, 0x69, // &'....3.])..,+,i
-	0x3d, 0x2c, 0x4f, 0x23, 0x01, 0xd6, 0x2c, 0x68, 0x3d, 0x2c, 0x4f, 0x23, 0x34, 0x01, 0xa3, 0x2a, // =,O#..,h=,O#4..*
-	0x16, 0x17, 0x2c, 0x2b, 0xfc, 0xed, 0x01, 0x70, 0x01, 0x72, 0xfe, 0x8e, 0xfe, 0x90, 0x03, 0x5d, // ..,+...p.r.....]
-	0x29, 0xfe, 0x61, 0x33, 0x23, 0x4e, 0x2b, 0x3e, 0x68, 0x2a, 0x2b, 0x2b, 0x16, 0x17, 0x29, 0x2b, // ).a3#N+>h*++..)+
-	0x2b, 0x16, 0x17, 0x29, 0xfe, 0x61, 0x35, 0x21, 0x4e, 0x2b, 0x3e, 0x68, 0x2a, 0xfe, 0x30, 0xfe, // +..).a5!N+>h*.0.
-	0x92, 0x01, 0x6e, 0x01, 0x6d, 0xfe, 0x93, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ..n.m...........
-	0x19, 0xfa, 0x6c, 0x40, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // ..l@_.<.........
-	0xd2, 0x7e, 0x21, 0x7c, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x7e, 0x21, 0x7c, 0x00, 0x00, 0xff, 0xc3, // .~!|.....~!|....
-	0x03, 0xfd, 0x03, 0xbd, 0x00, 0x00, 0x00, 0x08, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x01, 0x00, 0x00, 0x03, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x03, 0xfd, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x00, 0x00, 0xe8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x08, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x35, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x22, // .......5......."
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x06, // ......."........
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0xf4, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0xc4, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x01, 0x79, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x07, // .......y........
-	0x04, 0x00, 0x00, 0x12, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x4a, 0x04, 0x00, 0x00, 0x06, // ...........J....
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0xa5, // ................
-	0x04, 0x00, 0x00, 0xb3, 0x04, 0x00, 0x00, 0x36, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x56, // .......6.......V
-	0x04, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ...V............
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x56, // ...........V...V
-	0x04, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ...F............
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x60, // ...............`
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // .......`........
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0xc4, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0xc4, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x06, // ...l.......F....
-	0x04, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x46, 0x04, 0x00, 0x00, 0x06, // ...F.......F....
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x88, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x7e, // ...............~
-	0x04, 0x00, 0x01, 0x03, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x09, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x39, // ...............9
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x17, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x19, 0x04, 0x00, 0x00, 0x19, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x9e, // ................
-	0x04, 0x00, 0x00, 0x85, 0x04, 0x00, 0x00, 0x6e, 0x04, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0x06, // .......n........
-	0x04, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, // ................
-	0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x08, 0x04, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x06, // ...........N....
-	0x04, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x4e, 0x04, 0x00, 0x00, 0x69, 0x04, 0x00, 0x00, 0x69, // ...N...N...i...i
-	0x04, 0x00, 0x00, 0x69, 0x04, 0x00, 0x00, 0x69, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ...i...i........
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0xe6, 0x04, 0x00, 0x00, 0xe6, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x71, // ...............q
-	0x04, 0x00, 0x00, 0x8b, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x52, 0x04, 0x00, 0x00, 0x38, // ...........R...8
-	0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x01, 0xcf, 0x04, 0x00, 0x01, 0x79, 0x04, 0x00, 0x00, 0x4c, // ...........y...L
-	0x04, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, // ...I...L...L...L
-	0x04, 0x00, 0x01, 0x77, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x01, 0x76, // ...w...........v
-	0x04, 0x00, 0x01, 0x76, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x01, 0xd2, // ...v...L........
-	0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0xeb, 0x04, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0x4c, // ...............L
-	0x04, 0x00, 0x00, 0x49, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4c, // ...I...L...L...L
-	0x04, 0x00, 0x00, 0xf0, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0xee, // ................
-	0x04, 0x00, 0x00, 0xee, 0x04, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0xee, // .......L........
-	0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0x06, // ................
-	0x04, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x4a, // ...............J
-	0x00, 0xa4, 0x01, 0x2c, 0x02, 0x2e, 0x02, 0xba, 0x02, 0xfc, 0x03, 0x3e, 0x03, 0xa8, 0x03, 0xde, // ...,.......>....
-	0x04, 0x68, 0x04, 0xe0, 0x05, 0x3e, 0x05, 0xaa, 0x05, 0xe6, 0x06, 0x42, 0x06, 0xe0, 0x07, 0x3a, // .h...>.....B...:
-	0x07, 0xd0, 0x08, 0x00, 0x08, 0x6e, 0x08, 0xdc, 0x09, 0x82, 0x0a, 0x06, 0x0a, 0xc4, 0x0b, 0x18, // .....n..........
-	0x0b, 0xa2, 0x0c, 0x2c, 0x0c, 0x6e, 0x0c, 0x84, 0x0c, 0xbc, 0x0d, 0x48, 0x0d, 0xa8, 0x0e, 0x2a, // ...,.n.....H...*
-	0x0e, 0x70, 0x0e, 0xbc, 0x10, 0x22, 0x11, 0x14, 0x11, 0x92, 0x12, 0x10, 0x12, 0x40, 0x12, 0x96, // .p...".......@..
-	0x13, 0x16, 0x13, 0x62, 0x13, 0xb4, 0x14, 0x2c, 0x14, 0xa6, 0x15, 0x04, 0x15, 0x62, 0x15, 0xb2, // ...b...,.....b..
-	0x16, 0x04, 0x16, 0x42, 0x16, 0x98, 0x16, 0xea, 0x17, 0x58, 0x17, 0xd6, 0x18, 0x4c, 0x18, 0xc8, // ...B.....X...L..
-	0x19, 0x0e, 0x19, 0x5a, 0x19, 0xa2, 0x1a, 0x22, 0x1a, 0xe4, 0x1b, 0x3c, 0x1b, 0x94, 0x1b, 0xec, // ...Z..."...<....
-	0x1c, 0x42, 0x1c, 0x7a, 0x1c, 0xb2, 0x1c, 0xea, 0x1d, 0x22, 0x1d, 0x5e, 0x1d, 0x9a, 0x1d, 0xd6, // .B.z.....".^....
-	0x1e, 0x14, 0x1e, 0x36, 0x1e, 0x58, 0x1e, 0x7a, 0x1e, 0x9c, 0x1e, 0xbc, 0x1e, 0xdc, 0x1e, 0xfc, // ...6.X.z........
-	0x1f, 0x1c, 0x1f, 0x74, 0x1f, 0xc0, 0x1f, 0xe8, 0x20, 0x32, 0x20, 0x6e, 0x20, 0xc6, 0x21, 0x02, // ...t.... 2 n .!.
-	0x21, 0x4c, 0x21, 0x7c, 0x21, 0xb6, 0x21, 0xfa, 0x22, 0x58, 0x22, 0xba, 0x23, 0x08, 0x23, 0x9a, // !L!|!.!."X".#.#.
-	0x24, 0x22, 0x24, 0xb8, 0x25, 0x10, 0x25, 0x44, 0x25, 0xa2, 0x26, 0x12, 0x26, 0x3c, 0x26, 0xe4, // $"$.%.%D%.&.&<&.
-	0x27, 0x36, 0x27, 0x7e, 0x27, 0xf4, 0x28, 0x34, 0x28, 0x5a, 0x28, 0xba, 0x29, 0x2a, 0x29, 0x46, // '6'~'.(4(Z(.)*)F
-	0x29, 0x5a, 0x29, 0x80, 0x29, 0xae, 0x2a, 0x32, 0x2a, 0x8c, 0x2b, 0x08, 0x2b, 0x4e, 0x2b, 0xc0, // )Z).).*2*.+.+N+.
-	0x2b, 0xe6, 0x2c, 0x44, 0x2c, 0xaa, 0x2c, 0xe6, 0x2d, 0x22, 0x2d, 0x5c, 0x2d, 0xe4, 0x2e, 0x6e, // +.,D,.,.-"-.-..n
-	0x2e, 0xf2, 0x2f, 0x8a, 0x30, 0x60, 0x31, 0x34, 0x31, 0xe6, 0x32, 0xc0, 0x33, 0x96, 0x34, 0x64, // ../.0`141.2.3.4d
-	0x34, 0xb2, 0x35, 0x00, 0x35, 0x4e, 0x35, 0xa2, 0x36, 0x16, 0x36, 0x92, 0x36, 0xfa, 0x37, 0x62, // 4.5.5N5.6.6.6.7b
-	0x37, 0xa8, 0x38, 0x18, 0x38, 0x8a, 0x38, 0xda, 0x39, 0x28, 0x39, 0x72, 0x3a, 0x04, 0x3a, 0x72, // 7.8.8.8.9(9r:.:r
-	0x3a, 0xf8, 0x3b, 0x74, 0x3b, 0x88, 0x3b, 0xa6, 0x3b, 0xce, 0x3c, 0x16, 0x3c, 0x7c, 0x3c, 0xbe, // :.;t;.;.;.<.<|<.
-	0x3d, 0x1c, 0x3d, 0xa2, 0x3e, 0x0c, 0x3e, 0x54, 0x3e, 0x96, 0x3e, 0xaa, 0x3e, 0xda, 0x3f, 0x9a, // =.=.>.>T>.>.>.?.
-	0x40, 0x72, 0x40, 0xca, 0x41, 0x66, 0x41, 0xce, 0x42, 0x34, 0x42, 0xa0, 0x43, 0x08, 0x43, 0x60, // @r@.AfA.B4B.C.C`
-	0x43, 0x9e, 0x43, 0xf6, 0x44, 0x32, 0x44, 0x78, 0x44, 0xca, 0x45, 0x40, 0x45, 0xa8, 0x45, 0xf0, // C.C.D2DxD.E@E.E.
-	0x46, 0x3e, 0x46, 0x8c, 0x46, 0xba, 0x46, 0xe8, 0x47, 0x2c, 0x47, 0x6a, 0x47, 0x98, 0x47, 0xdc, // F>F.F.F.G,GjG.G.
-	0x48, 0x1c, 0x48, 0x4e, 0x48, 0x7e, 0x48, 0xc0, 0x48, 0xfe, 0x49, 0x26, 0x49, 0x68, 0x49, 0xa6, // H.HNH~H.H.I&IhI.
-	0x49, 0xd6, 0x4a, 0x06, 0x4a, 0x50, 0x4a, 0xa0, 0x4b, 0x04, 0x4b, 0x60, 0x4b, 0xb2, 0x4c, 0x0e, // I.J.JPJ.K.K`K.L.
-	0x4c, 0x6c, 0x4c, 0xb6, 0x4d, 0x06, 0x4d, 0x64, 0x4d, 0xc0, 0x4e, 0x08, 0x4e, 0x6a, 0x4e, 0xc8, // LlL.M.MdM.N.NjN.
-	0x4f, 0x10, 0x4f, 0x60, 0x50, 0x38, 0x50, 0xb2, 0x51, 0x38, 0x51, 0x96, 0x51, 0xf4, 0x52, 0xca, // O.O`P8P.Q8Q.Q.R.
-	0x53, 0x84, 0x53, 0xe4, 0x54, 0x28, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x05, // S.S.T(..........
-	0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x3e, 0x00, 0x01, // .............>..
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xba, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x07, // ................
-	0x02, 0xbe, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x10, 0x02, 0x5e, 0x00, 0x01, // .............^..
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x10, 0x02, 0xd3, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x05, 0x00, 0x0b, 0x02, 0x3d, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x10, // .....=..........
-	0x02, 0x8e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x18, 0x01, 0x02, 0x00, 0x01, // ................
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x1a, 0x03, 0x03, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x0b, 0x00, 0x2e, 0x00, 0x30, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x14, // .....0..........
-	0x01, 0x4a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x0b, 0x01, 0x86, 0x00, 0x01, // .J..............
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x32, 0x01, 0xa7, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, // .......2........
-	0x00, 0x00, 0x00, 0x30, 0x00, 0xd2, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x01, 0x00, 0x20, // ...0........... 
-	0x00, 0x10, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x02, 0x00, 0x0e, 0x02, 0xc5, 0x00, 0x03, // ................
-	0x00, 0x01, 0x04, 0x09, 0x00, 0x03, 0x00, 0x20, 0x02, 0x6e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, // ....... .n......
-	0x00, 0x04, 0x00, 0x20, 0x02, 0xe3, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x05, 0x00, 0x16, // ... ............
-	0x02, 0x48, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x06, 0x00, 0x20, 0x02, 0x9e, 0x00, 0x03, // .H......... ....
-	0x00, 0x01, 0x04, 0x09, 0x00, 0x09, 0x00, 0x30, 0x01, 0x1a, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, // .......0........
-	0x00, 0x0a, 0x00, 0x34, 0x03, 0x1d, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0b, 0x00, 0x5c, // ...4............
-	0x00, 0x5e, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, 0x00, 0x0c, 0x00, 0x28, 0x01, 0x5e, 0x00, 0x03, // .^.........(.^..
-	0x00, 0x01, 0x04, 0x09, 0x00, 0x0d, 0x00, 0x16, 0x01, 0x91, 0x00, 0x03, 0x00, 0x01, 0x04, 0x09, // ................
-	0x00, 0x0e, 0x00, 0x64, 0x01, 0xd9, 0x4b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2d, 0x49, 0x63, 0x6f, // ...d..Kenney-Ico
-	0x6e, 0x2d, 0x46, 0x6f, 0x6e, 0x74, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, // n-Font.K.e.n.n.e
-	0x00, 0x79, 0x00, 0x2d, 0x00, 0x49, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2d, 0x00, 0x46, // .y.-.I.c.o.n.-.F
-	0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x67, 0x69, // .o.n.thttps://gi
-	0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x53, 0x61, 0x6d, 0x42, 0x72, 0x69, 0x73, // thub.com/SamBris
-	0x68, 0x65, 0x73, 0x2f, 0x6b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2d, 0x69, 0x63, 0x6f, 0x6e, 0x2d, // hes/kenney-icon-
-	0x66, 0x6f, 0x6e, 0x74, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, // font.h.t.t.p.s.:
-	0x00, 0x2f, 0x00, 0x2f, 0x00, 0x67, 0x00, 0x69, 0x00, 0x74, 0x00, 0x68, 0x00, 0x75, 0x00, 0x62, // ././.g.i.t.h.u.b
-	0x00, 0x2e, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x2f, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6d, // ...c.o.m./.S.a.m
-	0x00, 0x42, 0x00, 0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x68, 0x00, 0x65, 0x00, 0x73, 0x00, 0x2f, // .B.r.i.s.h.e.s./
-	0x00, 0x6b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x79, 0x00, 0x2d, 0x00, 0x69, // .k.e.n.n.e.y.-.i
-	0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2d, 0x00, 0x66, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, // .c.o.n.-.f.o.n.t
-	0x4b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2e, 0x6e, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x53, 0x61, // Kenney.nl and Sa
-	0x6d, 0x42, 0x72, 0x69, 0x73, 0x68, 0x65, 0x73, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6e, // mBrishes.K.e.n.n
-	0x00, 0x65, 0x00, 0x79, 0x00, 0x2e, 0x00, 0x6e, 0x00, 0x6c, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, // .e.y...n.l. .a.n
-	0x00, 0x64, 0x00, 0x20, 0x00, 0x53, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x42, 0x00, 0x72, 0x00, 0x69, // .d. .S.a.m.B.r.i
-	0x00, 0x73, 0x00, 0x68, 0x00, 0x65, 0x00, 0x73, 0x4b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2e, 0x6e, // .s.h.e.sKenney.n
-	0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x53, 0x61, 0x6d, 0x42, 0x72, 0x69, 0x73, 0x68, 0x65, 0x73, // l and SamBrishes
-	0x00, 0x4b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x79, 0x00, 0x2e, 0x00, 0x6e, // .K.e.n.n.e.y...n
-	0x00, 0x6c, 0x00, 0x20, 0x00, 0x61, 0x00, 0x6e, 0x00, 0x64, 0x00, 0x20, 0x00, 0x53, 0x00, 0x61, // .l. .a.n.d. .S.a
-	0x00, 0x6d, 0x00, 0x42, 0x00, 0x72, 0x00, 0x69, 0x00, 0x73, 0x00, 0x68, 0x00, 0x65, 0x00, 0x73, // .m.B.r.i.s.h.e.s
-	0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x6b, 0x65, 0x6e, 0x6e, 0x65, // http://www.kenne
-	0x79, 0x2e, 0x6e, 0x6c, 0x00, 0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x3a, 0x00, 0x2f, // y.nl.h.t.t.p.:./
-	0x00, 0x2f, 0x00, 0x77, 0x00, 0x77, 0x00, 0x77, 0x00, 0x2e, 0x00, 0x6b, 0x00, 0x65, 0x00, 0x6e, // ./.w.w.w...k.e.n
-	0x00, 0x6e, 0x00, 0x65, 0x00, 0x79, 0x00, 0x2e, 0x00, 0x6e, 0x00, 0x6c, 0x43, 0x43, 0x30, 0x20, // .n.e.y...n.lCC0 
-	0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x43, 0x00, 0x43, 0x00, 0x30, 0x00, 0x20, 0x00, // License.C.C.0. .
-	0x4c, 0x00, 0x69, 0x00, 0x63, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x65, 0x68, 0x74, 0x74, // L.i.c.e.n.s.ehtt
-	0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x63, 0x6f, 0x6d, // ps://creativecom
-	0x6d, 0x6f, 0x6e, 0x73, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x64, // mons.org/publicd
-	0x6f, 0x6d, 0x61, 0x69, 0x6e, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x00, // omain/zero/1.0/.
-	0x68, 0x00, 0x74, 0x00, 0x74, 0x00, 0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x00, 0x2f, 0x00, // h.t.t.p.s.:././.
-	0x63, 0x00, 0x72, 0x00, 0x65, 0x00, 0x61, 0x00, 0x74, 0x00, 0x69, 0x00, 0x76, 0x00, 0x65, 0x00, // c.r.e.a.t.i.v.e.
-	0x63, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x6d, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x2e, 0x00, // c.o.m.m.o.n.s...
-	0x6f, 0x00, 0x72, 0x00, 0x67, 0x00, 0x2f, 0x00, 0x70, 0x00, 0x75, 0x00, 0x62, 0x00, 0x6c, 0x00, // o.r.g./.p.u.b.l.
-	0x69, 0x00, 0x63, 0x00, 0x64, 0x00, 0x6f, 0x00, 0x6d, 0x00, 0x61, 0x00, 0x69, 0x00, 0x6e, 0x00, // i.c.d.o.m.a.i.n.
-	0x2f, 0x00, 0x7a, 0x00, 0x65, 0x00, 0x72, 0x00, 0x6f, 0x00, 0x2f, 0x00, 0x31, 0x00, 0x2e, 0x00, // /.z.e.r.o./.1...
-	0x30, 0x00, 0x2f, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x00, 0x56, // 0./Version 1.0.V
-	0x00, 0x65, 0x00, 0x72, 0x00, 0x73, 0x00, 0x69, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x20, 0x00, 0x31, // .e.r.s.i.o.n. .1
-	0x00, 0x2e, 0x00, 0x30, 0x4b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2d, 0x49, 0x63, 0x6f, 0x6e, 0x2d, // ...0Kenney-Icon-
-	0x46, 0x6f, 0x6e, 0x74, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x79, // Font.K.e.n.n.e.y
-	0x00, 0x2d, 0x00, 0x49, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x6f, // .-.I.c.o.n.-.F.o
-	0x00, 0x6e, 0x00, 0x74, 0x4b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2d, 0x49, 0x63, 0x6f, 0x6e, 0x2d, // .n.tKenney-Icon-
-	0x46, 0x6f, 0x6e, 0x74, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x79, // Font.K.e.n.n.e.y
-	0x00, 0x2d, 0x00, 0x49, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2d, 0x00, 0x46, 0x00, 0x6f, // .-.I.c.o.n.-.F.o
-	0x00, 0x6e, 0x00, 0x74, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x00, 0x52, 0x00, 0x65, 0x00, // .n.tRegular.R.e.
-	0x67, 0x00, 0x75, 0x00, 0x6c, 0x00, 0x61, 0x00, 0x72, 0x4b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2d, // g.u.l.a.rKenney-
-	0x49, 0x63, 0x6f, 0x6e, 0x2d, 0x46, 0x6f, 0x6e, 0x74, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x6e, 0x00, // Icon-Font.K.e.n.
-	0x6e, 0x00, 0x65, 0x00, 0x79, 0x00, 0x2d, 0x00, 0x49, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x6e, 0x00, // n.e.y.-.I.c.o.n.
-	0x2d, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x46, 0x6f, 0x6e, 0x74, 0x20, 0x67, 0x65, // -.F.o.n.tFont ge
-	0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x49, 0x63, 0x6f, 0x4d, 0x6f, // nerated by IcoMo
-	0x6f, 0x6e, 0x2e, 0x00, 0x46, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x20, 0x00, 0x67, 0x00, // on..F.o.n.t. .g.
-	0x65, 0x00, 0x6e, 0x00, 0x65, 0x00, 0x72, 0x00, 0x61, 0x00, 0x74, 0x00, 0x65, 0x00, 0x64, 0x00, // e.n.e.r.a.t.e.d.
-	0x20, 0x00, 0x62, 0x00, 0x79, 0x00, 0x20, 0x00, 0x49, 0x00, 0x63, 0x00, 0x6f, 0x00, 0x4d, 0x00, //  .b.y. .I.c.o.M.
-	0x6f, 0x00, 0x6f, 0x00, 0x6e, 0x00, 0x2e, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // o.o.n...........
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,                                                 // ........
+	0x16, 0x17, 0x22, 0x0f, 0x0e, 0x1d, 0x08, 0x0e, 0x2e, 0x01, 0x01, 0x02, 0x01, 0x04, 0x64, 0xda, // .."...........d.
+	0x03, 0x08, 0x59, 0x06, 0x06, 0x0a, 0x0f, 0x0f, 0x17, 0x0e, 0x0f, 0x1a, 0x01, 0x09, 0x04, 0x05, // ..Y.............
+	0x0d, 0x02, 0x01, 0x0b, 0x06, 0x03, 0x14, 0x0b, 0x07, 0x12, 0x04, 0x03, 0x0b, 0x04, 0x09, 0x15, // ................
+	0x0d, 0x0c, 0x55, 0x18, 0x12, 0x25, 0x30, 0x2f, 0x55, 0x19, 0x1e, 0x25, 0x02, 0x0d, 0x4e, 0x73, // ..U..%0/U..%..Ns
+	0x91, 0x51, 0x5b, 0xa0, 0x77, 0x45, 0x45, 0x77, 0xa0, 0x5b, 0x69, 0xb6, 0x88, 0x4e, 0x01, 0x52, // .Q[.wEEw.[i..N.R
+	0x8b, 0xb6, 0x63, 0x64, 0xb8, 0x8d, 0x55, 0x51, 0x8a, 0xb9, 0x6a, 0x01, 0x64, 0xb0, 0x84, 0x4c, // ..cd..UQ..j.d..L
+	0x50, 0x87, 0xaf, 0x5e, 0x5f, 0xad, 0x84, 0x4e, 0x01, 0x4a, 0x81, 0xae, 0x64, 0x18, 0x4f, 0x83, // P..^_..N.J..d.O.
+	0x0c, 0x20, 0x7e, 0x45, 0x25, 0x09, 0x72, 0xa6, 0x03, 0x44, 0xe6, 0x04, 0x4a, 0x25, 0x03, 0x20, // . ~E%.r..D..J%. 
+	0x15, 0x41, 0xbe, 0x26, 0x20, 0x22, 0x41, 0xbe, 0x0b, 0x21, 0x14, 0x17, 0x41, 0xbe, 0x2a, 0x2d, // .A.& "A..!..A.*-
+	0x02, 0x00, 0x68, 0xb9, 0x89, 0x50, 0x50, 0x89, 0xb9, 0x68, 0x68, 0xb8, 0x8a, 0x50, 0x41, 0x3b, // ..h..PP..hh..PA;
+	0x03, 0x08, 0x2d, 0x5f, 0xa8, 0x7e, 0x48, 0x17, 0x0d, 0x0d, 0x19, 0x03, 0x02, 0x0b, 0x05, 0x06, // ..-_.~H.........
+	0x0f, 0x0d, 0x0c, 0x0d, 0x09, 0x06, 0x04, 0x03, 0x05, 0x13, 0x02, 0x03, 0x3f, 0x05, 0x09, 0x31, // ............?..1
+	0x03, 0x03, 0x09, 0x0f, 0x10, 0x56, 0x0b, 0x0c, 0x10, 0x04, 0x08, 0x27, 0x0a, 0x03, 0x08, 0x03, // .....V.....'....
+	0x07, 0x41, 0xae, 0x04, 0x5e, 0x77, 0x03, 0x22, 0x01, 0x11, 0x09, 0x41, 0xd7, 0x03, 0x27, 0x01, // .A..^w."...A..'.
+	0x03, 0x02, 0x0c, 0x03, 0x03, 0x0a, 0x0e, 0x41, 0xae, 0x03, 0x38, 0x09, 0x0c, 0x04, 0x03, 0x0c, // .......A..8.....
+	0x03, 0x02, 0x0d, 0x05, 0x06, 0x08, 0x0d, 0x0f, 0x10, 0x02, 0x52, 0x8c, 0x68, 0x3a, 0x48, 0x7e, // ..........R.h:H~
+	0xa8, 0x60, 0x03, 0xba, 0x83, 0x66, 0x88, 0x76, 0x82, 0x07, 0x20, 0x2c, 0x82, 0x16, 0x2b, 0x5f, // .`...f.v.. ,..+_
+	0x31, 0x72, 0x1a, 0x19, 0x01, 0x04, 0x04, 0x10, 0x04, 0x05, 0x0a, 0x41, 0x99, 0x03, 0x21, 0x07, // 1r.........A..!.
+	0x0b, 0x41, 0x99, 0x04, 0x08, 0x46, 0x4d, 0x05, 0x09, 0x29, 0x07, 0x09, 0x2b, 0x17, 0x17, 0x24, // .A...FM..)..+..$
+	0x10, 0x0f, 0x1f, 0x08, 0x0f, 0x30, 0x02, 0x02, 0x01, 0x04, 0x07, 0x04, 0x05, 0x06, 0x06, 0x07, // .....0..........
+	0x0a, 0x10, 0x10, 0x18, 0x0f, 0x10, 0x1b, 0x01, 0x09, 0x05, 0x05, 0x0e, 0x01, 0x02, 0x0c, 0x06, // ................
+	0x04, 0x15, 0x0b, 0x07, 0x14, 0x03, 0x04, 0x0b, 0x05, 0x09, 0x16, 0x0e, 0x0d, 0x59, 0x19, 0x13, // .............Y..
+	0x27, 0x32, 0x32, 0x5a, 0x1a, 0x20, 0x27, 0x02, 0x0e, 0x52, 0x79, 0x99, 0x56, 0x83, 0xd4, 0x60, // '22Z. '..Ry.V..`
+	0xf7, 0x06, 0x26, 0x50, 0x03, 0xfa, 0x03, 0x30, 0x00, 0x3a, 0x44, 0x99, 0x04, 0x18, 0x5e, 0x86, // ..&P...0.:D...^.
+	0x04, 0x26, 0x2e, 0x01, 0x2f, 0x04, 0x23, 0x0f, 0x03, 0x41, 0x3d, 0x04, 0x23, 0x0f, 0x03, 0x15, // .&../.#..A=.#...
+	0x1f, 0x47, 0xf6, 0x05, 0x24, 0x1f, 0x04, 0x33, 0x3f, 0x03, 0x56, 0xe1, 0x05, 0x3f, 0x04, 0x35, // .G..$..3?.V..?.5
+	0x27, 0x01, 0x11, 0x0d, 0x01, 0x03, 0xf3, 0x04, 0x09, 0x06, 0x10, 0x09, 0x0c, 0x1d, 0x11, 0x19, // '...............
+	0x12, 0xe6, 0x59, 0x23, 0x7c, 0xe6, 0x12, 0x1a, 0x10, 0x1d, 0x0c, 0x0a, 0x10, 0x06, 0x82, 0x81, // ..Y#|...........
+	0x08, 0x59, 0x05, 0x05, 0x03, 0x06, 0x06, 0x10, 0x0a, 0x0b, 0x1f, 0x13, 0x1c, 0x15, 0xcb, 0x8e, // .Y..............
+	0x23, 0x59, 0xe6, 0x12, 0x19, 0x11, 0x1d, 0x0c, 0x09, 0x10, 0x06, 0x07, 0x02, 0x04, 0x07, 0x07, // #Y..............
+	0xfd, 0xa5, 0x01, 0x10, 0xfe, 0xf0, 0x02, 0x5c, 0x35, 0x29, 0x15, 0x20, 0x0a, 0x0e, 0x12, 0x05, // ........5). ....
+	0x06, 0x01, 0x09, 0x02, 0x02, 0x09, 0x01, 0x06, 0x05, 0x12, 0x0e, 0x0a, 0x20, 0x15, 0x29, 0x35, // ............ .)5
+	0x74, 0x50, 0x74, 0x35, 0x0c, 0x1b, 0x17, 0x20, 0x0a, 0x0d, 0x12, 0x06, 0x04, 0x03, 0x08, 0x03, // tPt5... ........
+	0x02, 0x09, 0x03, 0x04, 0x06, 0x12, 0x0d, 0x0a, 0x20, 0x17, 0x1b, 0x0c, 0x83, 0x1c, 0x25, 0xfe, // ........ .....%.
+	0xdc, 0x01, 0x26, 0x93, 0x93, 0x43, 0xdf, 0x06, 0x20, 0xf6, 0x82, 0xbf, 0x24, 0x8a, 0x00, 0x0f, // ..&..C.. ...$...
+	0x00, 0x1f, 0x18, 0x4d, 0xfd, 0x04, 0x20, 0x17, 0x51, 0xab, 0x0d, 0x20, 0x05, 0x18, 0x56, 0xf8, // ...M.. .Q.. ..V.
+	0x05, 0x20, 0x01, 0x48, 0xc2, 0x07, 0x35, 0x09, 0x04, 0x01, 0xcd, 0x33, 0xfe, 0x5d, 0x29, 0x17, // . .H..5....3.]).
+	0x17, 0x2c, 0x2b, 0x2c, 0x69, 0x3d, 0x2c, 0x4f, 0x23, 0x01, 0xd6, 0x2c, 0x68, 0x83, 0x07, 0x24, // .,+,i=,O#..,h..$
+	0x34, 0x01, 0xa3, 0x2a, 0x16, 0x82, 0x15, 0x3a, 0xfc, 0xed, 0x01, 0x70, 0x01, 0x72, 0xfe, 0x8e, // 4..*...:...p.r..
+	0xfe, 0x90, 0x03, 0x5d, 0x29, 0xfe, 0x61, 0x33, 0x23, 0x4e, 0x2b, 0x3e, 0x68, 0x2a, 0x2b, 0x2b, // ...]).a3#N+>h*++
+	0x16, 0x17, 0x29, 0x84, 0x04, 0x23, 0xfe, 0x61, 0x35, 0x21, 0x84, 0x12, 0x28, 0xfe, 0x30, 0xfe, // ..)..#.a5!..(.0.
+	0x92, 0x01, 0x6e, 0x01, 0x6d, 0xfe, 0x44, 0x56, 0x03, 0x45, 0xe3, 0x04, 0x2b, 0x00, 0x19, 0xfa, // ..n.m.DV.E..+...
+	0x6c, 0x40, 0x5f, 0x0f, 0x3c, 0xf5, 0x00, 0x0b, 0x04, 0x47, 0x01, 0x03, 0x24, 0x00, 0xd2, 0x7e, // l@_.<....G..$..~
+	0x21, 0x7c, 0x89, 0x07, 0x18, 0x99, 0xfd, 0x06, 0x6a, 0xc9, 0x03, 0x5c, 0x08, 0x04, 0x85, 0x33, // !|......j......3
+	0x18, 0xa9, 0x03, 0x04, 0x20, 0x00, 0x85, 0x2f, 0x22, 0x03, 0xfd, 0x00, 0x18, 0xa8, 0xad, 0x0b, // .... ../".......
+	0x83, 0x00, 0x21, 0xe8, 0x04, 0x8a, 0x0c, 0x83, 0x36, 0x82, 0x0f, 0x20, 0x06, 0x86, 0x03, 0x20, // ..!.....6.. ... 
+	0x08, 0x8a, 0x0b, 0x8b, 0x03, 0x20, 0x35, 0x86, 0x07, 0x20, 0x22, 0x8a, 0x07, 0x20, 0x07, 0x8e, // ..... 5.. ".. ..
+	0x23, 0x20, 0x03, 0x8a, 0x0b, 0x20, 0xf4, 0x86, 0x07, 0x20, 0xc4, 0x85, 0x07, 0x21, 0x01, 0x79, // # ... ... ...!.y
+	0x86, 0x0f, 0x83, 0x33, 0x20, 0x12, 0x96, 0x63, 0x20, 0x4a, 0x96, 0x17, 0x8b, 0x03, 0x20, 0xa5, // ...3 ..c J.... .
+	0x82, 0x03, 0x20, 0xb3, 0x82, 0x03, 0x20, 0x36, 0x86, 0x0f, 0x20, 0x56, 0x86, 0x03, 0x20, 0x06, // .. ... 6.. V.. .
+	0xa2, 0x03, 0x87, 0x2b, 0x20, 0x46, 0x9a, 0x23, 0x20, 0x60, 0x8e, 0x07, 0x93, 0x03, 0x20, 0xc4, // ...+ F.# `.... .
+	0x8e, 0x07, 0x8f, 0x03, 0x20, 0x6c, 0x86, 0x07, 0x20, 0x46, 0x96, 0x07, 0x83, 0x03, 0x21, 0x88, // .... l.. F....!.
+	0x04, 0x41, 0x6b, 0x05, 0x23, 0x7e, 0x04, 0x00, 0x01, 0x41, 0x37, 0x0b, 0x20, 0x09, 0x86, 0x07, // .Ak.#~...A7. ...
+	0x41, 0x27, 0x03, 0x20, 0x9b, 0x82, 0x03, 0x20, 0x39, 0x8a, 0x1b, 0x21, 0x17, 0x04, 0xa5, 0xe7, // A'. ... 9..!....
+	0x87, 0x03, 0x20, 0x19, 0x86, 0x03, 0x8b, 0x13, 0x20, 0x9e, 0x82, 0x03, 0x20, 0x85, 0x82, 0x03, // .. ..... ... ...
+	0x20, 0x6e, 0x82, 0x03, 0x20, 0xaa, 0x86, 0x13, 0x20, 0x0d, 0x82, 0x03, 0x20, 0x0c, 0x8a, 0x23, //  n.. ... ... ..#
+	0x20, 0x0c, 0x86, 0x13, 0x20, 0x08, 0x8e, 0x03, 0x20, 0x4e, 0x86, 0x1f, 0x20, 0x4e, 0x86, 0x03, //  ... ... N.. N..
+	0x20, 0x69, 0x8e, 0x03, 0x20, 0x06, 0xba, 0x03, 0x20, 0xe6, 0x86, 0x03, 0xbb, 0x43, 0x41, 0x33, //  i.. ... ....CA3
+	0x03, 0x20, 0x71, 0x82, 0x03, 0x20, 0x8b, 0x96, 0x1f, 0x20, 0x52, 0x82, 0x03, 0x20, 0x38, 0x85, // . q.. ... R.. 8.
+	0x27, 0x21, 0x01, 0xcf, 0x42, 0x93, 0x06, 0x20, 0x4c, 0x82, 0x03, 0x20, 0x49, 0x86, 0x07, 0x86, // '!..B.. L.. I...
+	0x03, 0x21, 0x01, 0x77, 0x86, 0x4b, 0x83, 0x27, 0x20, 0x76, 0x85, 0x03, 0x84, 0x1b, 0x83, 0x0f, // .!.w.K.' v......
+	0x20, 0xd2, 0x86, 0x1b, 0x20, 0xeb, 0x82, 0x03, 0x20, 0xf0, 0x95, 0x3f, 0x84, 0x17, 0x86, 0x3f, //  ... ... ..?...?
+	0x21, 0x00, 0xee, 0x86, 0x03, 0x20, 0x4c, 0x8a, 0x0f, 0x93, 0xb7, 0x8c, 0x13, 0x43, 0x98, 0x04, // !.... L......C..
+	0x09, 0xcc, 0x0a, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x4a, 0x00, 0xa4, 0x01, 0x2c, 0x02, 0x2e, 0x02, // ........J...,...
+	0xba, 0x02, 0xfc, 0x03, 0x3e, 0x03, 0xa8, 0x03, 0xde, 0x04, 0x68, 0x04, 0xe0, 0x05, 0x3e, 0x05, // ....>.....h...>.
+	0xaa, 0x05, 0xe6, 0x06, 0x42, 0x06, 0xe0, 0x07, 0x3a, 0x07, 0xd0, 0x08, 0x00, 0x08, 0x6e, 0x08, // ....B...:.....n.
+	0xdc, 0x09, 0x82, 0x0a, 0x06, 0x0a, 0xc4, 0x0b, 0x18, 0x0b, 0xa2, 0x0c, 0x2c, 0x0c, 0x6e, 0x0c, // ............,.n.
+	0x84, 0x0c, 0xbc, 0x0d, 0x48, 0x0d, 0xa8, 0x0e, 0x2a, 0x0e, 0x70, 0x0e, 0xbc, 0x10, 0x22, 0x11, // ....H...*.p...".
+	0x14, 0x11, 0x92, 0x12, 0x10, 0x12, 0x40, 0x12, 0x96, 0x13, 0x16, 0x13, 0x62, 0x13, 0xb4, 0x14, // ......@.....b...
+	0x2c, 0x14, 0xa6, 0x15, 0x04, 0x15, 0x62, 0x15, 0xb2, 0x16, 0x04, 0x16, 0x42, 0x16, 0x98, 0x16, // ,.....b.....B...
+	0xea, 0x17, 0x58, 0x17, 0xd6, 0x18, 0x4c, 0x18, 0xc8, 0x19, 0x0e, 0x19, 0x5a, 0x19, 0xa2, 0x1a, // ..X...L.....Z...
+	0x22, 0x1a, 0xe4, 0x1b, 0x3c, 0x1b, 0x94, 0x1b, 0xec, 0x1c, 0x42, 0x1c, 0x7a, 0x1c, 0xb2, 0x1c, // "...<.....B.z...
+	0xea, 0x1d, 0x22, 0x1d, 0x5e, 0x1d, 0x9a, 0x1d, 0xd6, 0x1e, 0x14, 0x1e, 0x36, 0x1e, 0x58, 0x1e, // ..".^.......6.X.
+	0x7a, 0x1e, 0x9c, 0x1e, 0xbc, 0x1e, 0xdc, 0x1e, 0xfc, 0x1f, 0x1c, 0x1f, 0x74, 0x1f, 0xc0, 0x1f, // z...........t...
+	0xe8, 0x20, 0x32, 0x20, 0x6e, 0x20, 0xc6, 0x21, 0x02, 0x21, 0x4c, 0x21, 0x7c, 0x21, 0xb6, 0x21, // . 2 n .!.!L!|!.!
+	0xfa, 0x22, 0x58, 0x22, 0xba, 0x23, 0x08, 0x23, 0x9a, 0x24, 0x22, 0x24, 0xb8, 0x25, 0x10, 0x25, // ."X".#.#.$"$.%.%
+	0x44, 0x25, 0xa2, 0x26, 0x12, 0x26, 0x3c, 0x26, 0xe4, 0x27, 0x36, 0x27, 0x7e, 0x27, 0xf4, 0x28, // D%.&.&<&.'6'~'.(
+	0x34, 0x28, 0x5a, 0x28, 0xba, 0x29, 0x2a, 0x29, 0x46, 0x29, 0x5a, 0x29, 0x80, 0x29, 0xae, 0x2a, // 4(Z(.)*)F)Z).).*
+	0x32, 0x2a, 0x8c, 0x2b, 0x08, 0x2b, 0x4e, 0x2b, 0xc0, 0x2b, 0xe6, 0x2c, 0x44, 0x2c, 0xaa, 0x2c, // 2*.+.+N+.+.,D,.,
+	0xe6, 0x2d, 0x22, 0x2d, 0x5c, 0x2d, 0xe4, 0x2e, 0x6e, 0x2e, 0xf2, 0x2f, 0x8a, 0x30, 0x60, 0x31, // .-"-.-..n../.0`1
+	0x34, 0x31, 0xe6, 0x32, 0xc0, 0x33, 0x96, 0x34, 0x64, 0x34, 0xb2, 0x35, 0x00, 0x35, 0x4e, 0x35, // 41.2.3.4d4.5.5N5
+	0xa2, 0x36, 0x16, 0x36, 0x92, 0x36, 0xfa, 0x37, 0x62, 0x37, 0xa8, 0x38, 0x18, 0x38, 0x8a, 0x38, // .6.6.6.7b7.8.8.8
+	0xda, 0x39, 0x28, 0x39, 0x72, 0x3a, 0x04, 0x3a, 0x72, 0x3a, 0xf8, 0x3b, 0x74, 0x3b, 0x88, 0x3b, // .9(9r:.:r:.;t;.;
+	0xa6, 0x3b, 0xce, 0x3c, 0x16, 0x3c, 0x7c, 0x3c, 0xbe, 0x3d, 0x1c, 0x3d, 0xa2, 0x3e, 0x0c, 0x3e, // .;.<.<|<.=.=.>.>
+	0x54, 0x3e, 0x96, 0x3e, 0xaa, 0x3e, 0xda, 0x3f, 0x9a, 0x40, 0x72, 0x40, 0xca, 0x41, 0x66, 0x41, // T>.>.>.?.@r@.AfA
+	0xce, 0x42, 0x34, 0x42, 0xa0, 0x43, 0x08, 0x43, 0x60, 0x43, 0x9e, 0x43, 0xf6, 0x44, 0x32, 0x44, // .B4B.C.C`C.C.D2D
+	0x78, 0x44, 0xca, 0x45, 0x40, 0x45, 0xa8, 0x45, 0xf0, 0x46, 0x3e, 0x46, 0x8c, 0x46, 0xba, 0x46, // xD.E@E.E.F>F.F.F
+	0xe8, 0x47, 0x2c, 0x47, 0x6a, 0x47, 0x98, 0x47, 0xdc, 0x48, 0x1c, 0x48, 0x4e, 0x48, 0x7e, 0x48, // .G,GjG.G.H.HNH~H
+	0xc0, 0x48, 0xfe, 0x49, 0x26, 0x49, 0x68, 0x49, 0xa6, 0x49, 0xd6, 0x4a, 0x06, 0x4a, 0x50, 0x4a, // .H.I&IhI.I.J.JPJ
+	0xa0, 0x4b, 0x04, 0x4b, 0x60, 0x4b, 0xb2, 0x4c, 0x0e, 0x4c, 0x6c, 0x4c, 0xb6, 0x4d, 0x06, 0x4d, // .K.K`K.L.LlL.M.M
+	0x64, 0x4d, 0xc0, 0x4e, 0x08, 0x4e, 0x6a, 0x4e, 0xc8, 0x4f, 0x10, 0x4f, 0x60, 0x50, 0x38, 0x50, // dM.N.NjN.O.O`P8P
+	0xb2, 0x51, 0x38, 0x51, 0x96, 0x51, 0xf4, 0x52, 0xca, 0x53, 0x84, 0x53, 0xe4, 0x54, 0x28, 0x45, // .Q8Q.Q.R.S.S.T(E
+	0x97, 0x05, 0x25, 0x00, 0xe8, 0x01, 0x05, 0x00, 0x09, 0x45, 0x76, 0x08, 0x8f, 0x00, 0x22, 0x1a, // ..%......Ev...".
+	0x01, 0x3e, 0x45, 0xab, 0x08, 0x22, 0x18, 0x00, 0xba, 0x86, 0x0b, 0x22, 0x01, 0x00, 0x10, 0x86, // .>E.."....."....
+	0x3d, 0x4b, 0x37, 0x04, 0x21, 0x02, 0xbe, 0x86, 0x0b, 0x24, 0x03, 0x00, 0x10, 0x02, 0x5e, 0x86, // =K7.!....$....^.
+	0x0b, 0x20, 0x04, 0x82, 0x0b, 0x20, 0xd3, 0x86, 0x0b, 0x24, 0x05, 0x00, 0x0b, 0x02, 0x3d, 0x86, // . ... ...$....=.
+	0x0b, 0x20, 0x06, 0x82, 0x17, 0x20, 0x8e, 0x86, 0x0b, 0x24, 0x09, 0x00, 0x18, 0x01, 0x02, 0x86, // . ... ...$......
+	0x0b, 0x23, 0x0a, 0x00, 0x1a, 0x03, 0x18, 0xae, 0xc5, 0x07, 0x24, 0x0b, 0x00, 0x2e, 0x00, 0x30, // .#........$....0
+	0x86, 0x0b, 0x24, 0x0c, 0x00, 0x14, 0x01, 0x4a, 0x86, 0x0b, 0x24, 0x0d, 0x00, 0x0b, 0x01, 0x86, // ..$....J..$.....
+	0x86, 0x0b, 0x25, 0x0e, 0x00, 0x32, 0x01, 0xa7, 0x00, 0x82, 0x31, 0x20, 0x04, 0x83, 0xbd, 0x22, // ..%..2....1 ..."
+	0x30, 0x00, 0xd2, 0x86, 0x0b, 0x22, 0x01, 0x00, 0x20, 0x82, 0x9d, 0x85, 0x0b, 0x24, 0x02, 0x00, // 0....".. ....$..
+	0x0e, 0x02, 0xc5, 0x86, 0x0b, 0x24, 0x03, 0x00, 0x20, 0x02, 0x6e, 0x86, 0x0b, 0x20, 0x04, 0x82, // .....$.. .n.. ..
+	0x0b, 0x20, 0xe3, 0x86, 0x0b, 0x24, 0x05, 0x00, 0x16, 0x02, 0x48, 0x86, 0x0b, 0x20, 0x06, 0x82, // . ...$....H.. ..
+	0x17, 0x20, 0x9e, 0x86, 0x0b, 0x24, 0x09, 0x00, 0x30, 0x01, 0x1a, 0x86, 0x0b, 0x24, 0x0a, 0x00, // . ...$..0....$..
+	0x34, 0x03, 0x1d, 0x86, 0x0b, 0x24, 0x0b, 0x00, 0x5c, 0x00, 0x5e, 0x86, 0x0b, 0x23, 0x0c, 0x00, // 4....$....^..#..
+	0x28, 0x01, 0x87, 0x0b, 0x24, 0x0d, 0x00, 0x16, 0x01, 0x91, 0x86, 0x0b, 0x3a, 0x0e, 0x00, 0x64, // (...$.......:..d
+	0x01, 0xd9, 0x4b, 0x65, 0x6e, 0x6e, 0x65, 0x79, 0x2d, 0x49, 0x63, 0x6f, 0x6e, 0x2d, 0x46, 0x6f, // ..Kenney-Icon-Fo
+	0x6e, 0x74, 0x00, 0x4b, 0x00, 0x65, 0x00, 0x6e, 0x82, 0x01, 0x2a, 0x65, 0x00, 0x79, 0x00, 0x2d, // nt.K.e.n..*e.y.-
+	0x00, 0x49, 0x00, 0x63, 0x00, 0x6f, 0x82, 0x0d, 0x22, 0x2d, 0x00, 0x46, 0x84, 0x07, 0x3f, 0x74, // .I.c.o.."-.F..?t
+	0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2e, 0x63, // https://github.c
+	0x6f, 0x6d, 0x2f, 0x53, 0x61, 0x6d, 0x42, 0x72, 0x69, 0x73, 0x68, 0x65, 0x73, 0x2f, 0x6b, 0x85, // om/SamBrishes/k.
+	0x4d, 0x20, 0x69, 0x83, 0x4d, 0x20, 0x66, 0x83, 0x4d, 0x22, 0x68, 0x00, 0x74, 0x82, 0x01, 0x26, // M i.M f.M"h.t..&
+	0x70, 0x00, 0x73, 0x00, 0x3a, 0x00, 0x2f, 0x82, 0x01, 0x22, 0x67, 0x00, 0x69, 0x82, 0x0f, 0x26, // p.s.:./.."g.i..&
+	0x68, 0x00, 0x75, 0x00, 0x62, 0x00, 0x2e, 0x84, 0x5b, 0x20, 0x6d, 0x82, 0x15, 0x22, 0x53, 0x00, // h.u.b...[ m.."S.
+	0x61, 0x82, 0x07, 0x22, 0x42, 0x00, 0x72, 0x82, 0x1d, 0x20, 0x73, 0x82, 0x1d, 0x20, 0x65, 0x82, // a.."B.r.. s.. e.
+	0x05, 0x22, 0x2f, 0x00, 0x6b, 0x8c, 0x89, 0x20, 0x69, 0x88, 0x89, 0x20, 0x66, 0x85, 0x89, 0x85, // ."/.k.. i.. f...
+	0xb9, 0x27, 0x2e, 0x6e, 0x6c, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x89, 0x84, 0x8c, 0xc1, 0x20, 0x2e, // .'.nl and .... .
+	0x82, 0x07, 0x22, 0x6c, 0x00, 0x20, 0x82, 0x5f, 0x22, 0x6e, 0x00, 0x64, 0x82, 0x07, 0x92, 0x69, // .."l. ._"n.d...i
+	0xc7, 0x47, 0x41, 0x19, 0x03, 0x27, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x6b, 0x87, 0x52, // .GA..'://www.k.R
+	0x88, 0xff, 0x85, 0xfd, 0x20, 0x77, 0x84, 0x01, 0x20, 0x2e, 0x8c, 0xd9, 0x84, 0x59, 0x2c, 0x43, // .... w.. ....Y,C
+	0x43, 0x30, 0x20, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73, 0x65, 0x00, 0x43, 0x82, 0x01, 0x20, 0x30, // C0 License.C.. 0
+	0x82, 0x62, 0x20, 0x4c, 0x84, 0xf2, 0x83, 0x28, 0x22, 0x73, 0x00, 0x65, 0x41, 0x76, 0x07, 0x08, // .b L...("s.eAv..
+	0x29, 0x63, 0x72, 0x65, 0x61, 0x74, 0x69, 0x76, 0x65, 0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x73, // )creativecommons
+	0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x70, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x64, 0x6f, 0x6d, 0x61, 0x69, // .org/publicdomai
+	0x6e, 0x2f, 0x7a, 0x65, 0x72, 0x6f, 0x2f, 0x31, 0x2e, 0x30, 0x2f, 0x41, 0x7a, 0x10, 0x20, 0x63, // n/zero/1.0/Az. c
+	0x82, 0xac, 0x20, 0x65, 0x82, 0xb6, 0x20, 0x74, 0x82, 0x57, 0x20, 0x76, 0x82, 0x09, 0x41, 0x7c, // .. e.. t.W v..A|
+	0x05, 0x20, 0x6d, 0x41, 0x4c, 0x04, 0x20, 0x73, 0x82, 0x86, 0x20, 0x6f, 0x82, 0x1f, 0x20, 0x67, // . mAL. s.. o.. g
+	0x82, 0x27, 0x20, 0x70, 0x41, 0x9c, 0x04, 0x20, 0x6c, 0x84, 0x7d, 0x20, 0x64, 0x84, 0x23, 0x20, // .' pA.. l.} d.# 
+	0x61, 0x82, 0x0b, 0x20, 0x6e, 0x82, 0x19, 0x20, 0x7a, 0x82, 0x35, 0x20, 0x72, 0x82, 0x11, 0x22, // a.. n.. z.5 r.."
+	0x2f, 0x00, 0x31, 0x42, 0xfa, 0x04, 0x28, 0x2f, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, // /.1B..(/Version 
+	0x82, 0x6f, 0x21, 0x00, 0x56, 0x84, 0x1c, 0x20, 0x73, 0x82, 0x2a, 0x83, 0x50, 0x20, 0x20, 0x85, // .o!.V.. s.*.P  .
+	0x22, 0x42, 0x5d, 0x2f, 0xaf, 0x2f, 0x28, 0x52, 0x65, 0x67, 0x75, 0x6c, 0x61, 0x72, 0x00, 0x52, // "B]/./(Regular.R
+	0x82, 0x20, 0x20, 0x67, 0x82, 0xb7, 0x20, 0x6c, 0x82, 0xab, 0x20, 0x72, 0xaf, 0x44, 0x83, 0x23, // .  g.. l.. r.D.#
+	0x2d, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x20, 0x62, 0x79, 0x20, 0x82, // - generated by .
+	0x3a, 0x24, 0x4d, 0x6f, 0x6f, 0x6e, 0x2e, 0x87, 0x21, 0x82, 0xce, 0x20, 0x67, 0x84, 0x43, 0x83, // :$Moon..!.. g.C.
+	0xe2, 0x41, 0x41, 0x03, 0x20, 0x65, 0x42, 0x04, 0x04, 0x20, 0x62, 0x82, 0x4f, 0x20, 0x20, 0x86, // .AA. eB.. b.O  .
+	0x4f, 0x20, 0x4d, 0x82, 0x03, 0x83, 0x2b, 0x20, 0x2e, 0x18, 0xb3, 0x25, 0x05, 0x9a, 0x00, 0x05, // O M...+ ...%....
+	0xfa, 0xdd, 0x11, 0x0a, 0x4b,                                                                   // ....K
 };
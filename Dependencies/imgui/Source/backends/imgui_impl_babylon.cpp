@@ -1,9 +1,11 @@
 #include "backends/imgui_impl_babylon.h"
+#include "misc/profiler/imgui_profiler.h"
 #include <bgfx/bgfx.h>
 #include <bgfx/embedded_shader.h>
 #include <bx/bx.h>
 #include <bx/math.h>
 #include <bx/allocator.h>
+#include <vector>
 
 #include <Babylon/Graphics/DeviceContext.h>
 
@@ -14,11 +16,35 @@
 #define IMGUI_FLAGS_NONE UINT8_C(0x00)
 #define IMGUI_FLAGS_ALPHA_BLEND UINT8_C(0x01)
 
+#ifdef IMGUI_BABYLON_COMPACT_VERTICES
+// Compact vertices store position and uv as 16-bit normalized integers (12 bytes instead of the 20 bytes of ImDrawVert).
+// Positions are relative to ImDrawData::DisplayPos in 1/IMGUI_BABYLON_COMPACT_POS_SUBPIXELS pixel units, giving a
+// +/-(32767/IMGUI_BABYLON_COMPACT_POS_SUBPIXELS) pixels range (4095 with the default of 8); the scale is folded into the projection so the regular shaders are used.
+// Frames with a vertex outside of that range or with an uv outside of [-1,1] (e.g. wrapping user textures) are uploaded as 20 bytes ImDrawVert instead.
+#ifndef IMGUI_BABYLON_COMPACT_POS_SUBPIXELS
+#define IMGUI_BABYLON_COMPACT_POS_SUBPIXELS 8
+#endif
+
+struct ImDrawVertCompact
+{
+    int16_t pos[2];
+    int16_t uv[2];
+    ImU32 col;
+};
+#endif
+
 bx::AllocatorI *m_allocator;
 bgfx::VertexLayout m_layout;
+#ifdef IMGUI_BABYLON_COMPACT_VERTICES
+bgfx::VertexLayout m_layoutCompact;
+#endif
 bgfx::ProgramHandle m_program;
 bgfx::ProgramHandle m_imageProgram;
+bgfx::ProgramHandle m_fontProgram;
+bgfx::ProgramHandle m_fontSdfProgram;
 bgfx::TextureHandle m_texture;
+bool m_textureSingleChannel;
+bool m_textureSdf;
 bgfx::UniformHandle s_tex;
 bgfx::UniformHandle u_imageLodEnabled;
 ImFont *m_font[IMGUI_FONT_COUNT];
@@ -28,7 +54,10 @@ bgfx::ViewId m_viewId;
 #include "shaders/fs_ocornut_imgui.bin.h"
 #include "shaders/vs_imgui_image.bin.h"
 #include "shaders/fs_imgui_image.bin.h"
+#include "shaders/fs_imgui_font.bin.h"
+#include "shaders/fs_imgui_font_sdf.bin.h"
 
+// Embedded fonts are stb_compress'ed: they are only decompressed when the atlas is built, not when it is restored from the cache.
 #include "assets/roboto_regular.ttf.h"
 #include "assets/robotomono_regular.ttf.h"
 #include "assets/icons_kenney.ttf.h"
@@ -40,6 +69,8 @@ static const bgfx::EmbeddedShader s_embeddedShaders[] =
         BGFX_EMBEDDED_SHADER(fs_ocornut_imgui),
         BGFX_EMBEDDED_SHADER(vs_imgui_image),
         BGFX_EMBEDDED_SHADER(fs_imgui_image),
+        BGFX_EMBEDDED_SHADER(fs_imgui_font),
+        BGFX_EMBEDDED_SHADER(fs_imgui_font_sdf),
         BGFX_EMBEDDED_SHADER_END()};
 
 struct FontRangeMerge
@@ -56,19 +87,54 @@ struct FontRangeMerge
 
 static FontRangeMerge s_fontRangeMerge[] =
     {
-        {s_iconsKenneyTtf, sizeof(s_iconsKenneyTtf), {ICON_MIN_KI, ICON_MAX_KI, 0}},
-        {s_iconsFontAwesomeTtf, sizeof(s_iconsFontAwesomeTtf), {ICON_MIN_FA, ICON_MAX_FA, 0}},
+        {s_iconsKenneyTtfCompressed, sizeof(s_iconsKenneyTtfCompressed), {ICON_MIN_KI, ICON_MAX_KI, 0}},
+        {s_iconsFontAwesomeTtfCompressed, sizeof(s_iconsFontAwesomeTtfCompressed), {ICON_MIN_FA, ICON_MAX_FA, 0}},
 };
 
 inline bool checkAvailTransientBuffers(uint32_t _numVertices, const bgfx::VertexLayout &_layout, uint32_t _numIndices)
 {
-    return _numVertices == bgfx::getAvailTransientVertexBuffer(_numVertices, _layout) && (0 == _numIndices || _numIndices == bgfx::getAvailTransientIndexBuffer(_numIndices));
+    return _numVertices == bgfx::getAvailTransientVertexBuffer(_numVertices, _layout) && (0 == _numIndices || _numIndices == bgfx::getAvailTransientIndexBuffer(_numIndices, sizeof(ImDrawIdx) == 4));
+}
+
+#ifdef IMGUI_BABYLON_COMPACT_VERTICES
+inline int16_t toSnorm16(float _value)
+{
+    const float value = bx::clamp(_value, -32767.0f, 32767.0f);
+    return int16_t(value < 0.0f ? value - 0.5f : value + 0.5f);
+}
+
+// Converts in a single pass and returns false at the first vertex out of the compact range, leaving _dst partially written.
+static bool compactVertices(ImDrawVertCompact *_dst, const ImDrawVert *_src, uint32_t _num, const ImVec2 &_origin)
+{
+    const float posScale = float(IMGUI_BABYLON_COMPACT_POS_SUBPIXELS);
+    for (uint32_t ii = 0; ii < _num; ++ii)
+    {
+        const ImDrawVert &src = _src[ii];
+        const float x = (src.pos.x - _origin.x) * posScale;
+        const float y = (src.pos.y - _origin.y) * posScale;
+        if (bx::abs(x) > 32767.0f || bx::abs(y) > 32767.0f || bx::abs(src.uv.x) > 1.0f || bx::abs(src.uv.y) > 1.0f)
+        {
+            return false;
+        }
+
+        ImDrawVertCompact &dst = _dst[ii];
+        dst.pos[0] = toSnorm16(x);
+        dst.pos[1] = toSnorm16(y);
+        dst.uv[0] = toSnorm16(src.uv.x * 32767.0f);
+        dst.uv[1] = toSnorm16(src.uv.y * 32767.0f);
+        dst.col = src.col;
+    }
+    return true;
 }
 
+// Transient vertex buffers of the draw lists converted ahead of submission, reused across frames.
+static std::vector<bgfx::TransientVertexBuffer> s_compactVertexBuffers;
+#endif
+
 static bx::DefaultAllocator allocator;
 static Babylon::Graphics::DeviceContext *s_context = nullptr;
 
-bool ImGui_ImplBabylon_Init(uint32_t display_width, uint32_t display_height, float fontSize)
+bool ImGui_ImplBabylon_Init(uint32_t display_width, uint32_t display_height, float fontSize, const char* fontCacheFilename)
 {
     float _fontSize = fontSize;
 
@@ -91,7 +157,20 @@ bool ImGui_ImplBabylon_Init(uint32_t display_width, uint32_t display_height, flo
     u_imageLodEnabled = bgfx::createUniform("u_imageLodEnabled", bgfx::UniformType::Vec4);
     m_imageProgram = bgfx::createProgram(
         bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_imgui_image"), bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_imgui_image"), true);
+    m_fontProgram = bgfx::createProgram(
+        bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_ocornut_imgui"), bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_imgui_font"), true);
+    m_fontSdfProgram = bgfx::createProgram(
+        bgfx::createEmbeddedShader(s_embeddedShaders, type, "vs_ocornut_imgui"), bgfx::createEmbeddedShader(s_embeddedShaders, type, "fs_imgui_font_sdf"), true);
 
+#ifdef IMGUI_BABYLON_COMPACT_VERTICES
+    m_layoutCompact
+        .begin()
+        .add(bgfx::Attrib::Position, 2, bgfx::AttribType::Int16, true)
+        .add(bgfx::Attrib::TexCoord0, 2, bgfx::AttribType::Int16, true)
+        .add(bgfx::Attrib::Color0, 4, bgfx::AttribType::Uint8, true)
+        .end();
+    IM_ASSERT(m_layoutCompact.getStride() == sizeof(ImDrawVertCompact));
+#endif
     m_layout
         .begin()
         .add(bgfx::Attrib::Position, 2, bgfx::AttribType::Float)
@@ -104,15 +183,26 @@ bool ImGui_ImplBabylon_Init(uint32_t display_width, uint32_t display_height, flo
     uint8_t *data;
     int32_t width;
     int32_t height;
+    const bool singleChannelTextures = 0 != (bgfx::getCaps()->formats[bgfx::TextureFormat::R8] & BGFX_CAPS_FORMAT_TEXTURE_2D);
     {
+        // bgfx takes non power-of-two textures: don't round the atlas height up, it would waste up to half of the texture memory.
+        io.Fonts->Flags |= ImFontAtlasFlags_NoPowerOfTwoHeight;
+
+        // Distance fields are thresholded by fs_imgui_font_sdf, which reads a R8 texture: build a regular atlas when there is none.
+        if (!singleChannelTextures)
+        {
+            io.Fonts->Flags &= ~ImFontAtlasFlags_SignedDistanceField;
+        }
+
         ImFontConfig config;
         config.FontDataOwnedByAtlas = false;
+        config.DeferDecompression = true; // Embedded data: only decompressed when the atlas isn't restored from the build cache
         config.MergeMode = false;
         //			config.MergeGlyphCenterV = true;
 
         const ImWchar *ranges = io.Fonts->GetGlyphRangesCyrillic();
-        m_font[IMGUI_FONT_REGULAR] = io.Fonts->AddFontFromMemoryTTF((void *)s_robotoRegularTtf, sizeof(s_robotoRegularTtf), _fontSize, &config, ranges);
-        m_font[IMGUI_FONT_MONO] = io.Fonts->AddFontFromMemoryTTF((void *)s_robotoMonoRegularTtf, sizeof(s_robotoMonoRegularTtf), _fontSize - 3.0f, &config, ranges);
+        m_font[IMGUI_FONT_REGULAR] = io.Fonts->AddFontFromMemoryCompressedTTF(s_robotoRegularTtfCompressed, sizeof(s_robotoRegularTtfCompressed), _fontSize, &config, ranges);
+        m_font[IMGUI_FONT_MONO] = io.Fonts->AddFontFromMemoryCompressedTTF(s_robotoMonoRegularTtfCompressed, sizeof(s_robotoMonoRegularTtfCompressed), _fontSize - 3.0f, &config, ranges);
 
         config.MergeMode = true;
         config.DstFont = m_font[IMGUI_FONT_REGULAR];
@@ -121,14 +211,64 @@ bool ImGui_ImplBabylon_Init(uint32_t display_width, uint32_t display_height, flo
         {
             const FontRangeMerge &frm = s_fontRangeMerge[ii];
 
-            io.Fonts->AddFontFromMemoryTTF((void *)frm.data, (int)frm.size, _fontSize - 3.0f, &config, frm.ranges);
+            io.Fonts->AddFontFromMemoryCompressedTTF(frm.data, (int)frm.size, _fontSize - 3.0f, &config, frm.ranges);
+        }
+    }
+
+    // Rasterizing the embedded fonts dominates startup: reuse the atlas saved by a previous run when its inputs have not changed.
+    if (fontCacheFilename == nullptr || !io.Fonts->LoadBuildCacheFromDisk(fontCacheFilename))
+    {
+        io.Fonts->Build();
+        if (fontCacheFilename != nullptr)
+        {
+            io.Fonts->SaveBuildCacheToDisk(fontCacheFilename);
         }
     }
 
-    io.Fonts->GetTexDataAsRGBA32(&data, &width, &height);
+    // Alpha only atlases are uploaded as R8, a quarter of the memory of BGRA8, and drawn with fs_imgui_font which reads the coverage
+    // from the red channel. Colored atlases (FreeType LoadColor) and renderers without R8 textures keep the BGRA8 upload.
+    const bgfx::Memory *mem;
+    m_textureSingleChannel = !io.Fonts->TexPixelsUseColors && singleChannelTextures;
+    m_textureSdf = m_textureSingleChannel && 0 != (io.Fonts->Flags & ImFontAtlasFlags_SignedDistanceField);
+    const bgfx::TextureFormat::Enum format = m_textureSingleChannel ? bgfx::TextureFormat::R8 : bgfx::TextureFormat::BGRA8;
+    if (io.Fonts->TexPixelsUseColors)
+    {
+        io.Fonts->GetTexDataAsRGBA32(&data, &width, &height);
+        mem = bgfx::copy(data, width * height * 4);
+    }
+    else if (m_textureSingleChannel)
+    {
+        io.Fonts->GetTexDataAsAlpha8(&data, &width, &height);
+        mem = bgfx::copy(data, width * height);
+    }
+    else
+    {
+        // Expanded straight into bgfx owned memory: GetTexDataAsRGBA32() would fill an intermediate copy that bgfx::copy() duplicates once more.
+        io.Fonts->GetTexDataAsAlpha8(&data, &width, &height);
+        mem = bgfx::alloc(width * height * 4);
+        uint32_t *dst = (uint32_t *)mem->data;
+        for (int32_t ii = 0, num = width * height; ii < num; ++ii)
+        {
+            dst[ii] = IM_COL32(255, 255, 255, data[ii]);
+        }
+    }
+
+    if (io.Fonts->DynamicGlyphs == nullptr)
+    {
+        m_texture = bgfx::createTexture2D(
+            (uint16_t)width, (uint16_t)height, false, 1, format, 0, mem);
 
-    m_texture = bgfx::createTexture2D(
-        (uint16_t)width, (uint16_t)height, false, 1, bgfx::TextureFormat::BGRA8, 0, bgfx::copy(data, width * height * 4));
+        // Glyph data stays in io.Fonts, only the pixels are released: the texture is the only consumer.
+        io.Fonts->ClearTexData();
+    }
+    else
+    {
+        // Glyphs rasterized on first use are written to the atlas pixels and uploaded by RenderDrawData(): the pixels are kept
+        // and the texture is created without initial data, as textures created with data are immutable.
+        m_texture = bgfx::createTexture2D(
+            (uint16_t)width, (uint16_t)height, false, 1, format, 0, NULL);
+        bgfx::updateTexture2D(m_texture, 0, 0, 0, 0, (uint16_t)width, (uint16_t)height, mem);
+    }
 
     return true;
 }
@@ -147,9 +287,44 @@ void ImGui_ImplBabylon_RenderDrawData(ImDrawData *_drawData)
     if (s_context == nullptr)
         return;
 
+    // Upload the part of the atlas written by glyphs rasterized on first use during this frame.
+    const bgfx::Memory *atlasMem = nullptr;
+    int atlasX, atlasY, atlasW, atlasH;
+    ImFontAtlas *atlas = ImGui::GetIO().Fonts;
+    if (atlas->GetTexDataDirtyRect(&atlasX, &atlasY, &atlasW, &atlasH))
+    {
+        atlasMem = bgfx::alloc(atlasW * atlasH * (m_textureSingleChannel ? 1 : 4));
+        uint32_t *dst = (uint32_t *)atlasMem->data;
+        for (int y = 0; y < atlasH; ++y)
+        {
+            const int src = atlasX + (atlasY + y) * atlas->TexWidth;
+            if (m_textureSingleChannel)
+            {
+                memcpy(atlasMem->data + y * atlasW, atlas->TexPixelsAlpha8 + src, atlasW);
+                continue;
+            }
+            if (atlas->TexPixelsRGBA32 != nullptr)
+            {
+                memcpy(dst + y * atlasW, atlas->TexPixelsRGBA32 + src, atlasW * 4);
+                continue;
+            }
+            for (int x = 0; x < atlasW; ++x)
+            {
+                dst[x + y * atlasW] = IM_COL32(255, 255, 255, atlas->TexPixelsAlpha8[src + x]);
+            }
+        }
+    }
+
     arcana::make_task(s_context->AfterRenderScheduler(), arcana::cancellation_source::none(),
-                      [_drawData{*_drawData}]()
+                      [_drawData{*_drawData}, atlasMem, atlasX, atlasY, atlasW, atlasH]()
                       {
+                          IMGUI_PROFILE_ZONE("ImGui_ImplBabylon render task");
+
+                          if (atlasMem != nullptr)
+                          {
+                              bgfx::updateTexture2D(m_texture, 0, 0, (uint16_t)atlasX, (uint16_t)atlasY, (uint16_t)atlasW, (uint16_t)atlasH, atlasMem);
+                          }
+
                           // Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
                           int fb_width = (int)(_drawData.DisplaySize.x * _drawData.FramebufferScale.x);
                           int fb_height = (int)(_drawData.DisplaySize.y * _drawData.FramebufferScale.y);
@@ -160,6 +335,31 @@ void ImGui_ImplBabylon_RenderDrawData(ImDrawData *_drawData)
                           bgfx::setViewName(m_viewId, "ImGui");
                           bgfx::setViewMode(m_viewId, bgfx::ViewMode::Sequential);
 
+#ifdef IMGUI_BABYLON_COMPACT_VERTICES
+                          // The projection depends on the layout, so the whole frame is converted before anything is submitted. A vertex out of
+                          // range stops the conversion and the frame is copied as ImDrawVert; the compact buffers already allocated are dropped.
+                          bool compact = true;
+                          int32_t numCompact = 0;
+                          s_compactVertexBuffers.resize(_drawData.CmdListsCount);
+                          for (; numCompact < _drawData.CmdListsCount; ++numCompact)
+                          {
+                              const ImDrawList *drawList = _drawData.CmdLists[numCompact];
+                              uint32_t numVertices = (uint32_t)drawList->VtxBuffer.size();
+                              if (!checkAvailTransientBuffers(numVertices, m_layoutCompact, 0))
+                              {
+                                  break;
+                              }
+
+                              bgfx::TransientVertexBuffer &tvb = s_compactVertexBuffers[numCompact];
+                              bgfx::allocTransientVertexBuffer(&tvb, numVertices, m_layoutCompact);
+                              if (!compactVertices((ImDrawVertCompact *)tvb.data, drawList->VtxBuffer.begin(), numVertices, _drawData.DisplayPos))
+                              {
+                                  compact = false;
+                                  break;
+                              }
+                          }
+#endif
+
                           const bgfx::Caps *caps = bgfx::getCaps();
                           {
                               float ortho[16];
@@ -168,7 +368,18 @@ void ImGui_ImplBabylon_RenderDrawData(ImDrawData *_drawData)
                               float width = _drawData.DisplaySize.x;
                               float height = _drawData.DisplaySize.y;
 
-                              bx::mtxOrtho(ortho, x, x + width, y + height, y, 0.0f, 1000.0f, 0.0f, caps->homogeneousDepth);
+#ifdef IMGUI_BABYLON_COMPACT_VERTICES
+                              if (compact)
+                              {
+                                  // Compact positions are already relative to DisplayPos and arrive in the shader as snorm: map [0,1] back to pixels here.
+                                  const float posScale = float(IMGUI_BABYLON_COMPACT_POS_SUBPIXELS) / 32767.0f;
+                                  bx::mtxOrtho(ortho, 0.0f, width * posScale, height * posScale, 0.0f, 0.0f, 1000.0f, 0.0f, caps->homogeneousDepth);
+                              }
+                              else
+#endif
+                              {
+                                  bx::mtxOrtho(ortho, x, x + width, y + height, y, 0.0f, 1000.0f, 0.0f, caps->homogeneousDepth);
+                              }
                               bgfx::setViewTransform(m_viewId, NULL, ortho);
                               bgfx::setViewRect(m_viewId, 0, 0, uint16_t(width), uint16_t(height));
                           }
@@ -186,17 +397,32 @@ void ImGui_ImplBabylon_RenderDrawData(ImDrawData *_drawData)
                               uint32_t numVertices = (uint32_t)drawList->VtxBuffer.size();
                               uint32_t numIndices = (uint32_t)drawList->IdxBuffer.size();
 
-                              if (!checkAvailTransientBuffers(numVertices, m_layout, numIndices))
+#ifdef IMGUI_BABYLON_COMPACT_VERTICES
+                              if (compact)
                               {
-                                  // not enough space in transient buffer just quit drawing the rest...
-                                  break;
+                                  if (ii >= numCompact || !checkAvailTransientBuffers(0, m_layoutCompact, numIndices))
+                                  {
+                                      // not enough space in transient buffer just quit drawing the rest...
+                                      break;
+                                  }
+
+                                  tvb = s_compactVertexBuffers[ii];
                               }
+                              else
+#endif
+                              {
+                                  if (!checkAvailTransientBuffers(numVertices, m_layout, numIndices))
+                                  {
+                                      // not enough space in transient buffer just quit drawing the rest...
+                                      break;
+                                  }
 
-                              bgfx::allocTransientVertexBuffer(&tvb, numVertices, m_layout);
-                              bgfx::allocTransientIndexBuffer(&tib, numIndices, sizeof(ImDrawIdx) == 4);
+                                  bgfx::allocTransientVertexBuffer(&tvb, numVertices, m_layout);
+                                  ImDrawVert *verts = (ImDrawVert *)tvb.data;
+                                  bx::memCopy(verts, drawList->VtxBuffer.begin(), numVertices * sizeof(ImDrawVert));
+                              }
 
-                              ImDrawVert *verts = (ImDrawVert *)tvb.data;
-                              bx::memCopy(verts, drawList->VtxBuffer.begin(), numVertices * sizeof(ImDrawVert));
+                              bgfx::allocTransientIndexBuffer(&tib, numIndices, sizeof(ImDrawIdx) == 4);
 
                               ImDrawIdx *indices = (ImDrawIdx *)tib.data;
                               bx::memCopy(indices, drawList->IdxBuffer.begin(), numIndices * sizeof(ImDrawIdx));
@@ -243,6 +469,10 @@ void ImGui_ImplBabylon_RenderDrawData(ImDrawData *_drawData)
                                       else
                                       {
                                           state |= BGFX_STATE_BLEND_FUNC(BGFX_STATE_BLEND_SRC_ALPHA, BGFX_STATE_BLEND_INV_SRC_ALPHA);
+                                          if (m_textureSingleChannel)
+                                          {
+                                              program = m_textureSdf ? m_fontSdfProgram : m_fontProgram;
+                                          }
                                       }
 
                                       ImVec4 clipRect = cmd->ClipRect;
@@ -273,6 +503,9 @@ void ImGui_ImplBabylon_Shutdown()
     bgfx::destroy(m_texture);
     bgfx::destroy(u_imageLodEnabled);
     bgfx::destroy(m_imageProgram);
+    bgfx::destroy(m_fontProgram);
+    bgfx::destroy(m_fontSdfProgram);
     bgfx::destroy(m_program);
+    ImGui::GetIO().Fonts->Clear();
     m_allocator = NULL;
 }
\ No newline at end of file
@@ -837,6 +837,14 @@ CODE
 // System includes
 #include <ctype.h>      // toupper
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#include <atomic>       // std::atomic (allocation and storage lookup counters)
+#include <chrono>       // std::chrono::steady_clock (frame stats timings)
+#ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+#include <condition_variable> // std::condition_variable
+#include <mutex>        // std::mutex
+#include <system_error> // std::system_error
+#include <thread>       // std::thread
+#endif
 #if defined(_MSC_VER) && _MSC_VER <= 1500 // MSVC 2008 or earlier
 #include <stddef.h>     // intptr_t
 #else
@@ -949,6 +957,11 @@ static void*            WindowSettingsHandler_ReadOpen(ImGuiContext*, ImGuiSetti
 static void             WindowSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*, void* entry, const char* line);
 static void             WindowSettingsHandler_ApplyAll(ImGuiContext*, ImGuiSettingsHandler*);
 static void             WindowSettingsHandler_WriteAll(ImGuiContext*, ImGuiSettingsHandler*, ImGuiTextBuffer* buf);
+#ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+static bool             IniSaveThreadSubmit(ImGuiContext* ctx, const char* ini_filename);
+static void             IniSaveThreadWaitIdle(ImGuiContext* ctx);
+static void             IniSaveThreadDestroy(ImGuiContext* ctx);
+#endif
 
 // Platform Dependents default implementation for IO functions
 static const char*      GetClipboardTextFn_DefaultImpl(void* user_data);
@@ -1169,6 +1182,7 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryDrawListPoolSize = 4 * 1024 * 1024;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1617,28 +1631,92 @@ const ImWchar* ImStrbolW(const ImWchar* buf_mid_line, const ImWchar* buf_begin)
     return buf_mid_line;
 }
 
-const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define IMGUI_ENABLE_SSE2_STRSTR
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>     // _BitScanForward
+#endif
+static inline int ImCountTrailingZeros(unsigned int v)
 {
-    if (!needle_end)
-        needle_end = needle + strlen(needle);
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward(&index, v);
+    return (int)index;
+#else
+    return __builtin_ctz(v);
+#endif
+}
+#endif
 
-    const char un0 = (char)toupper(*needle);
-    while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
-    {
-        if (toupper(*haystack) == un0)
-        {
-            const char* b = needle + 1;
-            for (const char* a = haystack + 1; b < needle_end; a++, b++)
-                if (toupper(*a) != toupper(*b))
-                    break;
-            if (b == needle_end)
-                return haystack;
+// Find a non-empty needle in [haystack, haystack_end), comparing ASCII letters case-insensitively when 'fold_case' is set.
+// Letters are folded by setting their 0x20 bit: 'A' | 0x20 == 'a'. Only the letters of the needle are folded, so other characters still compare exactly.
+// The SSE2 path tests 16 positions at a time against the first and last characters of the needle, and only compares the rest at positions where both match.
+static const char* ImStrstrRange(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end, bool fold_case)
+{
+    const size_t needle_len = (size_t)(needle_end - needle);
+    IM_ASSERT(needle_len > 0);
+    if ((size_t)(haystack_end - haystack) < needle_len)
+        return NULL;
+    const char* last = haystack_end - needle_len; // Last position where the needle fits
+    const char first_c = fold_case ? ImToLowerA(needle[0]) : needle[0];
+    const char last_c = fold_case ? ImToLowerA(needle_end[-1]) : needle_end[-1];
+    const char first_or = (fold_case && first_c >= 'a' && first_c <= 'z') ? 0x20 : 0;
+    const char last_or = (fold_case && last_c >= 'a' && last_c <= 'z') ? 0x20 : 0;
+    const char* p = haystack;
+#ifdef IMGUI_ENABLE_SSE2_STRSTR
+    const __m128i first_v = _mm_set1_epi8(first_c);
+    const __m128i last_v = _mm_set1_epi8(last_c);
+    const __m128i first_or_v = _mm_set1_epi8(first_or);
+    const __m128i last_or_v = _mm_set1_epi8(last_or);
+    for (; last - p >= 15; p += 16)
+    {
+        const __m128i block_first = _mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)p), first_or_v);
+        const __m128i block_last = _mm_or_si128(_mm_loadu_si128((const __m128i*)(const void*)(p + needle_len - 1)), last_or_v);
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first_v), _mm_cmpeq_epi8(block_last, last_v)));
+        for (; mask != 0; mask &= mask - 1)
+        {
+            const char* candidate = p + ImCountTrailingZeros(mask);
+            size_t n = 1;
+            if (fold_case)
+                while (n + 1 < needle_len && ImToLowerA(candidate[n]) == ImToLowerA(needle[n]))
+                    n++;
+            else
+                while (n + 1 < needle_len && candidate[n] == needle[n])
+                    n++;
+            if (n + 1 >= needle_len)
+                return candidate;
         }
-        haystack++;
+    }
+#endif
+    for (; p <= last; p++)
+    {
+        if ((char)(p[0] | first_or) != first_c || (char)(p[needle_len - 1] | last_or) != last_c)
+            continue;
+        size_t n = 1;
+        if (fold_case)
+            while (n + 1 < needle_len && ImToLowerA(p[n]) == ImToLowerA(needle[n]))
+                n++;
+        else
+            while (n + 1 < needle_len && p[n] == needle[n])
+                n++;
+        if (n + 1 >= needle_len)
+            return p;
     }
     return NULL;
 }
 
+// Case-insensitive search (ASCII letters only). An empty needle is never found.
+const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
+{
+    if (!needle_end)
+        needle_end = needle + strlen(needle);
+    if (needle == needle_end)
+        return NULL;
+    if (!haystack_end)
+        haystack_end = haystack + strlen(haystack);
+    return ImStrstrRange(haystack, haystack_end, needle, needle_end, true);
+}
+
 // Trim str by offsetting contents when there's leading data + writing a \0 at the trailing position. We use this in situation where the cost is negligible.
 void ImStrTrimBlanks(char* buf)
 {
@@ -1740,8 +1818,11 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
+// We use the CRC32C (Castagnoli) polynomial, which SSE 4.2 computes in hardware: IDs are the same with and without IMGUI_ENABLE_SSE4_2_CRC.
+#ifndef IMGUI_ENABLE_SSE4_2_CRC
 static const ImU32 GCrc32LookupTable[256] =
 {
+#ifdef IMGUI_USE_LEGACY_CRC32
     0x00000000,0x77073096,0xEE0E612C,0x990951BA,0x076DC419,0x706AF48F,0xE963A535,0x9E6495A3,0x0EDB8832,0x79DCB8A4,0xE0D5E91E,0x97D2D988,0x09B64C2B,0x7EB17CBD,0xE7B82D07,0x90BF1D91,
     0x1DB71064,0x6AB020F2,0xF3B97148,0x84BE41DE,0x1ADAD47D,0x6DDDE4EB,0xF4D4B551,0x83D385C7,0x136C9856,0x646BA8C0,0xFD62F97A,0x8A65C9EC,0x14015C4F,0x63066CD9,0xFA0F3D63,0x8D080DF5,
     0x3B6E20C8,0x4C69105E,0xD56041E4,0xA2677172,0x3C03E4D1,0x4B04D447,0xD20D85FD,0xA50AB56B,0x35B5A8FA,0x42B2986C,0xDBBBC9D6,0xACBCF940,0x32D86CE3,0x45DF5C75,0xDCD60DCF,0xABD13D59,
@@ -1758,53 +1839,76 @@ static const ImU32 GCrc32LookupTable[256] =
     0x86D3D2D4,0xF1D4E242,0x68DDB3F8,0x1FDA836E,0x81BE16CD,0xF6B9265B,0x6FB077E1,0x18B74777,0x88085AE6,0xFF0F6A70,0x66063BCA,0x11010B5C,0x8F659EFF,0xF862AE69,0x616BFFD3,0x166CCF45,
     0xA00AE278,0xD70DD2EE,0x4E048354,0x3903B3C2,0xA7672661,0xD06016F7,0x4969474D,0x3E6E77DB,0xAED16A4A,0xD9D65ADC,0x40DF0B66,0x37D83BF0,0xA9BCAE53,0xDEBB9EC5,0x47B2CF7F,0x30B5FFE9,
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
+#else
+    0x00000000,0xF26B8303,0xE13B70F7,0x1350F3F4,0xC79A971F,0x35F1141C,0x26A1E7E8,0xD4CA64EB,0x8AD958CF,0x78B2DBCC,0x6BE22838,0x9989AB3B,0x4D43CFD0,0xBF284CD3,0xAC78BF27,0x5E133C24,
+    0x105EC76F,0xE235446C,0xF165B798,0x030E349B,0xD7C45070,0x25AFD373,0x36FF2087,0xC494A384,0x9A879FA0,0x68EC1CA3,0x7BBCEF57,0x89D76C54,0x5D1D08BF,0xAF768BBC,0xBC267848,0x4E4DFB4B,
+    0x20BD8EDE,0xD2D60DDD,0xC186FE29,0x33ED7D2A,0xE72719C1,0x154C9AC2,0x061C6936,0xF477EA35,0xAA64D611,0x580F5512,0x4B5FA6E6,0xB93425E5,0x6DFE410E,0x9F95C20D,0x8CC531F9,0x7EAEB2FA,
+    0x30E349B1,0xC288CAB2,0xD1D83946,0x23B3BA45,0xF779DEAE,0x05125DAD,0x1642AE59,0xE4292D5A,0xBA3A117E,0x4851927D,0x5B016189,0xA96AE28A,0x7DA08661,0x8FCB0562,0x9C9BF696,0x6EF07595,
+    0x417B1DBC,0xB3109EBF,0xA0406D4B,0x522BEE48,0x86E18AA3,0x748A09A0,0x67DAFA54,0x95B17957,0xCBA24573,0x39C9C670,0x2A993584,0xD8F2B687,0x0C38D26C,0xFE53516F,0xED03A29B,0x1F682198,
+    0x5125DAD3,0xA34E59D0,0xB01EAA24,0x42752927,0x96BF4DCC,0x64D4CECF,0x77843D3B,0x85EFBE38,0xDBFC821C,0x2997011F,0x3AC7F2EB,0xC8AC71E8,0x1C661503,0xEE0D9600,0xFD5D65F4,0x0F36E6F7,
+    0x61C69362,0x93AD1061,0x80FDE395,0x72966096,0xA65C047D,0x5437877E,0x4767748A,0xB50CF789,0xEB1FCBAD,0x197448AE,0x0A24BB5A,0xF84F3859,0x2C855CB2,0xDEEEDFB1,0xCDBE2C45,0x3FD5AF46,
+    0x7198540D,0x83F3D70E,0x90A324FA,0x62C8A7F9,0xB602C312,0x44694011,0x5739B3E5,0xA55230E6,0xFB410CC2,0x092A8FC1,0x1A7A7C35,0xE811FF36,0x3CDB9BDD,0xCEB018DE,0xDDE0EB2A,0x2F8B6829,
+    0x82F63B78,0x709DB87B,0x63CD4B8F,0x91A6C88C,0x456CAC67,0xB7072F64,0xA457DC90,0x563C5F93,0x082F63B7,0xFA44E0B4,0xE9141340,0x1B7F9043,0xCFB5F4A8,0x3DDE77AB,0x2E8E845F,0xDCE5075C,
+    0x92A8FC17,0x60C37F14,0x73938CE0,0x81F80FE3,0x55326B08,0xA759E80B,0xB4091BFF,0x466298FC,0x1871A4D8,0xEA1A27DB,0xF94AD42F,0x0B21572C,0xDFEB33C7,0x2D80B0C4,0x3ED04330,0xCCBBC033,
+    0xA24BB5A6,0x502036A5,0x4370C551,0xB11B4652,0x65D122B9,0x97BAA1BA,0x84EA524E,0x7681D14D,0x2892ED69,0xDAF96E6A,0xC9A99D9E,0x3BC21E9D,0xEF087A76,0x1D63F975,0x0E330A81,0xFC588982,
+    0xB21572C9,0x407EF1CA,0x532E023E,0xA145813D,0x758FE5D6,0x87E466D5,0x94B49521,0x66DF1622,0x38CC2A06,0xCAA7A905,0xD9F75AF1,0x2B9CD9F2,0xFF56BD19,0x0D3D3E1A,0x1E6DCDEE,0xEC064EED,
+    0xC38D26C4,0x31E6A5C7,0x22B65633,0xD0DDD530,0x0417B1DB,0xF67C32D8,0xE52CC12C,0x1747422F,0x49547E0B,0xBB3FFD08,0xA86F0EFC,0x5A048DFF,0x8ECEE914,0x7CA56A17,0x6FF599E3,0x9D9E1AE0,
+    0xD3D3E1AB,0x21B862A8,0x32E8915C,0xC083125F,0x144976B4,0xE622F5B7,0xF5720643,0x07198540,0x590AB964,0xAB613A67,0xB831C993,0x4A5A4A90,0x9E902E7B,0x6CFBAD78,0x7FAB5E8C,0x8DC0DD8F,
+    0xE330A81A,0x115B2B19,0x020BD8ED,0xF0605BEE,0x24AA3F05,0xD6C1BC06,0xC5914FF2,0x37FACCF1,0x69E9F0D5,0x9B8273D6,0x88D28022,0x7AB90321,0xAE7367CA,0x5C18E4C9,0x4F48173D,0xBD23943E,
+    0xF36E6F75,0x0105EC76,0x12551F82,0xE03E9C81,0x34F4F86A,0xC69F7B69,0xD5CF889D,0x27A40B9E,0x79B737BA,0x8BDCB4B9,0x988C474D,0x6AE7C44E,0xBE2DA0A5,0x4C4623A6,0x5F16D052,0xAD7D5351,
+#endif
 };
+#endif
 
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
 ImGuiID ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_ENABLE_SSE4_2_CRC
+#if defined(__x86_64__) || defined(_M_X64)
+    if (data_size >= 8)
+    {
+        ImU64 crc64 = crc;
+        for (; data_size >= 8; data += 8, data_size -= 8)
+        {
+            ImU64 v;
+            memcpy(&v, data, 8);
+            crc64 = _mm_crc32_u64(crc64, v);
+        }
+        crc = (ImU32)crc64;
+    }
+#endif
+    for (; data_size >= 4; data += 4, data_size -= 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, 4);
+        crc = _mm_crc32_u32(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+#else
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data_size-- != 0)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+#endif
     return ~crc;
 }
 
 // Zero-terminated string hash, with support for ### to reset back to seed value
 // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
 // Because this syntax is rarely used we are optimizing for the common case.
-// - If we reach ### in the string we discard the hash so far and reset to the seed.
-// - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// - Hashing from the last ### is the same as discarding the hash so far and resetting to the seed every time we reach ###.
+// - memchr() skips to the next '#' and is vectorized by the C library, so the common case only costs a scan before ImHashData().
 ImGuiID ImHashStr(const char* data_p, size_t data_size, ImU32 seed)
 {
-    seed = ~seed;
-    ImU32 crc = seed;
-    const unsigned char* data = (const unsigned char*)data_p;
-    const ImU32* crc32_lut = GCrc32LookupTable;
-    if (data_size != 0)
-    {
-        while (data_size-- != 0)
-        {
-            unsigned char c = *data++;
-            if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
-                crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
-        }
-    }
-    else
-    {
-        while (unsigned char c = *data++)
-        {
-            if (c == '#' && data[0] == '#' && data[1] == '#')
-                crc = seed;
-            crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ c];
-        }
-    }
-    return ~crc;
+    const char* data = data_p;
+    const char* data_end = data_p + (data_size != 0 ? data_size : strlen(data_p));
+    for (const char* p = data_p; (p = (const char*)memchr(p, '#', (size_t)(data_end - p))) != NULL && data_end - p >= 3; p++)
+        if (p[1] == '#' && p[2] == '#')
+            data = p;
+    return ImHashData(data, (size_t)(data_end - data), seed);
 }
 
 //-----------------------------------------------------------------------------
@@ -1821,11 +1925,15 @@ ImFileHandle ImFileOpen(const char* filename, const char* mode)
     // Previously we used ImTextCountCharsFromUtf8/ImTextStrFromUtf8 here but we now need to support ImWchar16 and ImWchar32!
     const int filename_wsize = ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
     const int mode_wsize = ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, NULL, 0);
-    ImVector<ImWchar> buf;
-    buf.resize(filename_wsize + mode_wsize);
-    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, (wchar_t*)&buf[0], filename_wsize);
-    ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, (wchar_t*)&buf[filename_wsize], mode_wsize);
-    return ::_wfopen((const wchar_t*)&buf[0], (const wchar_t*)&buf[filename_wsize]);
+    // Use the allocator directly rather than ImVector<>/MemAlloc(): this is called from the .ini save thread.
+    wchar_t* buf = (wchar_t*)(*GImAllocatorAllocFunc)((size_t)(filename_wsize + mode_wsize) * sizeof(wchar_t), GImAllocatorUserData);
+    if (buf == NULL)
+        return NULL;
+    ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, buf, filename_wsize);
+    ::MultiByteToWideChar(CP_UTF8, 0, mode, -1, buf + filename_wsize, mode_wsize);
+    ImFileHandle f = ::_wfopen(buf, buf + filename_wsize);
+    (*GImAllocatorFreeFunc)(buf, GImAllocatorUserData);
+    return f;
 #else
     return fopen(filename, mode);
 #endif
@@ -2150,27 +2258,85 @@ void ImGui::ColorConvertHSVtoRGB(float h, float s, float v, float& out_r, float&
 // Helper: Key->value storage
 //-----------------------------------------------------------------------------
 
-// std::lower_bound but without the bullshit
-static ImGuiStorage::ImGuiStoragePair* LowerBound(ImVector<ImGuiStorage::ImGuiStoragePair>& data, ImGuiID key)
+// Keys are IDs, but may also be small user integers: mix their bits before masking
+static inline ImU32 ImGuiStorageHashKey(ImGuiID key)
 {
-    ImGuiStorage::ImGuiStoragePair* first = data.Data;
-    ImGuiStorage::ImGuiStoragePair* last = data.Data + data.Size;
-    size_t count = (size_t)(last - first);
-    while (count > 0)
+    ImU32 h = key * 0x9E3779B1u;
+    return h ^ (h >> 16);
+}
+
+// Rebuild the hash table from Data[], with index_size slots (power of two)
+static void ImGuiStorageBuildIndex(ImGuiStorage* storage, int index_size)
+{
+    IM_ASSERT(ImIsPowerOfTwo(index_size) && index_size > storage->Data.Size);
+    storage->Index.resize(index_size);
+    memset(storage->Index.Data, 0xFF, (size_t)storage->Index.size_in_bytes());
+    const ImU32 mask = (ImU32)index_size - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
     {
-        size_t count2 = count >> 1;
-        ImGuiStorage::ImGuiStoragePair* mid = first + count2;
-        if (mid->key < key)
-        {
-            first = ++mid;
-            count -= count2 + 1;
-        }
-        else
+        const ImGuiID key = storage->Data[n].key;
+        ImU32 slot_n = ImGuiStorageHashKey(key) & mask;
+        while (storage->Index[slot_n].index >= 0 && storage->Index[slot_n].key != key)
+            slot_n = (slot_n + 1) & mask;
+        if (storage->Index[slot_n].index < 0) // Keep the first pair if Data[] was filled with duplicate keys
         {
-            count = count2;
+            storage->Index[slot_n].key = key;
+            storage->Index[slot_n].index = n;
         }
     }
-    return first;
+    storage->IndexedCount = storage->Data.Size;
+}
+
+// Return the index of the pair in Data[], -1 if missing
+// Reported by ImGuiFrameStats::StorageLookups. ImGuiStorage doesn't know its context, so this is shared by all contexts.
+static std::atomic<ImU32> GImGuiStorageLookupCount(0);
+
+static int ImGuiStorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    GImGuiStorageLookupCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Data[] was modified directly: search linearly until the next insertion rebuilds the index
+    if (storage->IndexedCount != storage->Data.Size)
+    {
+        for (int n = 0; n < storage->Data.Size; n++)
+            if (storage->Data[n].key == key)
+                return n;
+        return -1;
+    }
+    if (storage->Index.Size == 0)
+        return -1;
+    const ImU32 mask = (ImU32)storage->Index.Size - 1;
+    for (ImU32 slot_n = ImGuiStorageHashKey(key) & mask; ; slot_n = (slot_n + 1) & mask)
+    {
+        const ImGuiStorage::ImGuiStorageSlot& slot = storage->Index.Data[slot_n];
+        if (slot.index < 0 || slot.key == key)
+            return slot.index;
+    }
+}
+
+// Return the pair, inserting 'default_pair' if missing
+static ImGuiStorage::ImGuiStoragePair* ImGuiStorageGetOrAdd(ImGuiStorage* storage, const ImGuiStorage::ImGuiStoragePair& default_pair)
+{
+    GImGuiStorageLookupCount.fetch_add(1, std::memory_order_relaxed);
+
+    // Keep the table at most half full
+    if (storage->IndexedCount != storage->Data.Size || (storage->Data.Size + 1) * 2 > storage->Index.Size)
+        ImGuiStorageBuildIndex(storage, ImMax(storage->Index.Size, ImUpperPowerOfTwo(ImMax((storage->Data.Size + 1) * 2, 16))));
+
+    const ImGuiID key = default_pair.key;
+    const ImU32 mask = (ImU32)storage->Index.Size - 1;
+    ImU32 slot_n = ImGuiStorageHashKey(key) & mask;
+    while (storage->Index.Data[slot_n].index >= 0)
+    {
+        if (storage->Index.Data[slot_n].key == key)
+            return &storage->Data[storage->Index.Data[slot_n].index];
+        slot_n = (slot_n + 1) & mask;
+    }
+    storage->Index.Data[slot_n].key = key;
+    storage->Index.Data[slot_n].index = storage->Data.Size;
+    storage->Data.push_back(default_pair);
+    storage->IndexedCount = storage->Data.Size;
+    return &storage->Data.back();
 }
 
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
@@ -2187,14 +2353,13 @@ void ImGuiStorage::BuildSortByKey()
         }
     };
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), StaticFunc::PairComparerByID);
+    ImGuiStorageBuildIndex(this, ImUpperPowerOfTwo(ImMax((Data.Size + 1) * 2, 16)));
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    const int n = ImGuiStorageFind(this, key);
+    return (n >= 0) ? Data[n].val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -2204,27 +2369,20 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    const int n = ImGuiStorageFind(this, key);
+    return (n >= 0) ? Data[n].val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStoragePair* it = LowerBound(const_cast<ImVector<ImGuiStoragePair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    const int n = ImGuiStorageFind(this, key);
+    return (n >= 0) ? Data[n].val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_i;
+    return &ImGuiStorageGetOrAdd(this, ImGuiStoragePair(key, default_val))->val_i;
 }
 
 bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
@@ -2234,30 +2392,17 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_f;
+    return &ImGuiStorageGetOrAdd(this, ImGuiStoragePair(key, default_val))->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, ImGuiStoragePair(key, default_val));
-    return &it->val_p;
+    return &ImGuiStorageGetOrAdd(this, ImGuiStoragePair(key, default_val))->val_p;
 }
 
-// FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_i = val;
+    ImGuiStorageGetOrAdd(this, ImGuiStoragePair(key, val))->val_i = val;
 }
 
 void ImGuiStorage::SetBool(ImGuiID key, bool val)
@@ -2267,24 +2412,12 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_f = val;
+    ImGuiStorageGetOrAdd(this, ImGuiStoragePair(key, val))->val_f = val;
 }
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStoragePair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-    {
-        Data.insert(it, ImGuiStoragePair(key, val));
-        return;
-    }
-    it->val_p = val;
+    ImGuiStorageGetOrAdd(this, ImGuiStoragePair(key, val))->val_p = val;
 }
 
 void ImGuiStorage::SetAllInt(int v)
@@ -2392,6 +2525,74 @@ bool ImGuiTextFilter::PassFilter(const char* text, const char* text_end) const
     return false;
 }
 
+// Same result as calling PassFilter() on every item, but each term is searched once through the whole index.
+// Like PassFilter(), the first term found in an item decides whether it passes.
+void ImGuiTextFilter::Filter(const ImGuiTextFilterIndex& index, ImVector<int>* out_items) const
+{
+    const int items_count = index.Offsets.Size;
+    if (Filters.empty())
+    {
+        out_items->reserve(out_items->Size + items_count);
+        for (int item_n = 0; item_n < items_count; item_n++)
+            out_items->push_back(item_n);
+        return;
+    }
+    if (items_count == 0)
+        return;
+
+    // 0: no term found yet, 1: grep term found first, 2: subtract term found first
+    ImVector<ImU8> items_state;
+    items_state.resize(items_count, 0);
+
+    const char* buf_begin = index.Buf.Data;
+    const char* buf_end = buf_begin + index.Buf.Size;
+    char term[IM_ARRAYSIZE(InputBuf)];
+    for (int i = 0; i != Filters.Size; i++)
+    {
+        const ImGuiTextRange& f = Filters[i];
+        if (f.empty())
+            continue;
+        const bool subtract = (f.b[0] == '-');
+        const char* term_src = subtract ? f.b + 1 : f.b;
+        const int term_len = (int)(f.e - term_src);
+        if (term_len == 0)
+            continue;
+        for (int n = 0; n < term_len; n++)
+            term[n] = ImToLowerA(term_src[n]);
+
+        int item_n = 0;
+        for (const char* p = buf_begin; (p = ImStrstrRange(p, buf_end, term, term + term_len, false)) != NULL; )
+        {
+            // Find the item containing the match: matches are in increasing order, so this walks the offsets at most once per term
+            const int offset = (int)(p - buf_begin);
+            while (item_n + 1 < items_count && index.Offsets.Data[item_n + 1] <= offset)
+                item_n++;
+            if (items_state.Data[item_n] == 0)
+                items_state.Data[item_n] = subtract ? 2 : 1;
+            if (++item_n == items_count)
+                break;
+            p = buf_begin + index.Offsets.Data[item_n];
+        }
+    }
+
+    for (int item_n = 0; item_n < items_count; item_n++)
+        if (items_state.Data[item_n] == 1 || (items_state.Data[item_n] == 0 && CountGrep == 0))
+            out_items->push_back(item_n);
+}
+
+void ImGuiTextFilterIndex::append(const char* text, const char* text_end)
+{
+    if (!text_end)
+        text_end = text + strlen(text);
+    const int len = (int)(text_end - text);
+    Offsets.push_back(Buf.Size);
+    Buf.resize(Buf.Size + len + 1);
+    char* dst = Buf.Data + Offsets.back();
+    for (int n = 0; n < len; n++)
+        dst[n] = ImToLowerA(text[n]);
+    dst[len] = 0;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImGuiTextBuffer
 //-----------------------------------------------------------------------------
@@ -3060,12 +3261,88 @@ void ImGui::RenderTextWrapped(ImVec2 pos, const char* text, const char* text_end
 
     if (text != text_end)
     {
+        if (const ImGuiTextLayout* layout = (wrap_width > 0.0f) ? FindOrCreateTextLayout(text, text_end, wrap_width) : NULL)
+        {
+            RenderTextLayout(pos, text, text_end, layout);
+            return;
+        }
         window->DrawList->AddText(g.Font, g.FontSize, pos, GetColorU32(ImGuiCol_Text), text, text_end, wrap_width);
         if (g.LogEnabled)
             LogRenderedText(&pos, text, text_end);
     }
 }
 
+// Same output as RenderTextWrapped(), but only the visible lines are submitted, each one as an unwrapped text.
+void ImGui::RenderTextLayout(ImVec2 pos, const char* text, const char* text_end, const ImGuiTextLayout* layout)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+
+    const ImU32 col = GetColorU32(ImGuiCol_Text);
+    const ImVec4& clip_rect = window->DrawList->_CmdHeader.ClipRect;
+    const float line_height = g.FontSize;
+    float y = IM_FLOOR(pos.y);
+    for (int line_n = 0; line_n < layout->Lines.Size && y <= clip_rect.w; line_n += 2, y += line_height)
+        if (y + line_height >= clip_rect.y)
+            window->DrawList->AddText(g.Font, g.FontSize, ImVec2(pos.x, y), col, text + layout->Lines[line_n], text + layout->Lines[line_n + 1]);
+    if (g.LogEnabled)
+        LogRenderedText(&pos, text, text_end);
+}
+
+// Return the line breaks and size of a long wrapped text from the current window cache, computing them if needed.
+// Layouts not used during the previous frame are recycled, so a window only keeps those of the texts it keeps displaying.
+const ImGuiTextLayout* ImGui::FindOrCreateTextLayout(const char* text, const char* text_end, float wrap_width)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    const int TEXT_LAYOUT_CACHE_MIN_LEN = 256;
+    const int TEXT_LAYOUT_CACHE_MAX_COUNT = 32;
+    const int text_len = (int)(text_end - text);
+    if (text_len < TEXT_LAYOUT_CACHE_MIN_LEN)
+        return NULL;
+
+    // Lines are submitted one by one and RenderText() snaps each of them to a whole pixel:
+    // this only matches the output of a single wrapped RenderText() call when the line height is a whole number of pixels.
+    ImFont* font = g.Font;
+    const float font_size = g.FontSize;
+    if (font_size != IM_FLOOR(font_size))
+        return NULL;
+    const int generation = font->ContainerAtlas ? font->ContainerAtlas->LookupGeneration : 0;
+    ImGuiID key = ImHashData(&font, sizeof(font), 0);
+    key = ImHashData(&font_size, sizeof(font_size), key);
+    key = ImHashData(&wrap_width, sizeof(wrap_width), key);
+    key = ImHashData(text, (size_t)text_len, key); // Not ImHashStr(): "###" would make texts differing before it share a key
+
+    ImGuiTextLayout* layout = NULL;
+    for (int n = 0; n < window->TextLayouts.Size; n++)
+    {
+        ImGuiTextLayout* candidate = &window->TextLayouts[n];
+        if (candidate->Key == key && candidate->TextLen == text_len && candidate->Generation == generation)
+        {
+            candidate->LastFrameUsed = g.FrameCount;
+            return candidate;
+        }
+        if (layout == NULL && candidate->LastFrameUsed < g.FrameCount - 1)
+            layout = candidate;
+    }
+    if (layout == NULL)
+    {
+        if (window->TextLayouts.Size >= TEXT_LAYOUT_CACHE_MAX_COUNT)
+            return NULL;
+        window->TextLayouts.push_back(ImGuiTextLayout());
+        layout = &window->TextLayouts.back();
+    }
+
+    layout->Size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_end, NULL);
+    layout->Size.x = IM_FLOOR(layout->Size.x + 0.99999f); // Same rounding as CalcTextSize()
+    font->CalcWordWrapLinesA(font_size / font->FontSize, text, text_end, wrap_width, &layout->Lines);
+    layout->Key = key;
+    layout->TextLen = text_len;
+    layout->Generation = font->ContainerAtlas ? font->ContainerAtlas->LookupGeneration : 0; // Measuring may have loaded dynamic glyphs
+    layout->LastFrameUsed = g.FrameCount;
+    return layout;
+}
+
 // Default clip_rect uses (pos_min,pos_max)
 // Handle clipping on CPU immediately (vs typically let the GPU clip the triangles that are overlapping the clipping rectangle edges)
 void ImGui::RenderTextClippedEx(ImDrawList* draw_list, const ImVec2& pos_min, const ImVec2& pos_max, const char* text, const char* text_display_end, const ImVec2* text_size_if_known, const ImVec2& align, const ImRect* clip_rect)
@@ -3301,6 +3578,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name) : DrawListInst
     SettingsOffset = -1;
     DrawList = &DrawListInst;
     DrawList->_Data = &context->DrawListSharedData;
+    DrawList->_BufferPool = &context->DrawListBufferPool;
     DrawList->_OwnerName = Name;
 }
 
@@ -3309,13 +3587,49 @@ ImGuiWindow::~ImGuiWindow()
     IM_ASSERT(DrawList == &DrawListInst);
     IM_DELETE(Name);
     ColumnsStorage.clear_destruct();
+    TextLayouts.clear_destruct();
 }
 
+// Without the CRC32C instructions, labels cost more to hash than to compare: reuse the ID of the label submitted at the same
+// position in the previous frame when both the label and the seed match. Windows submitting the same items every frame only hash new labels.
 ImGuiID ImGuiWindow::GetID(const char* str, const char* str_end)
 {
     ImGuiID seed = IDStack.back();
-    ImGuiID id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
     ImGuiContext& g = *GImGui;
+    ImGuiID id;
+#ifndef IMGUI_ENABLE_SSE4_2_CRC
+    const size_t len = str_end ? (size_t)(str_end - str) : strlen(str);
+    if (len > 0 && len <= IM_ID_MEMO_KEY_SIZE && IDMemoIdx < IM_ID_MEMO_MAX_ENTRIES)
+    {
+        if (IDMemoIdx >= IDMemo.Size)
+        {
+            IDMemoIdx = IDMemo.Size;
+            IDMemo.push_back(ImGuiIDMemoEntry());
+        }
+        ImGuiIDMemoEntry& entry = IDMemo.Data[IDMemoIdx++];
+        if (entry.Seed == seed && entry.Len == len && memcmp(entry.Key, str, len) == 0)
+        {
+            id = entry.ID;
+        }
+        else
+        {
+            id = ImHashStr(str, len, seed);
+            entry.Seed = seed;
+            entry.ID = id;
+            entry.Len = (ImU8)len;
+            memcpy(entry.Key, str, len);
+            g.FrameStats[g.FrameStatsIdx].IdHashes++;
+        }
+    }
+    else
+    {
+        id = ImHashStr(str, len, seed);
+        g.FrameStats[g.FrameStatsIdx].IdHashes++;
+    }
+#else
+    id = ImHashStr(str, str_end ? (str_end - str) : 0, seed);
+    g.FrameStats[g.FrameStatsIdx].IdHashes++;
+#endif
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(id, ImGuiDataType_String, str, str_end);
     return id;
@@ -3326,6 +3640,7 @@ ImGuiID ImGuiWindow::GetID(const void* ptr)
     ImGuiID seed = IDStack.back();
     ImGuiID id = ImHashData(&ptr, sizeof(void*), seed);
     ImGuiContext& g = *GImGui;
+    g.FrameStats[g.FrameStatsIdx].IdHashes++;
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(id, ImGuiDataType_Pointer, ptr, NULL);
     return id;
@@ -3336,6 +3651,7 @@ ImGuiID ImGuiWindow::GetID(int n)
     ImGuiID seed = IDStack.back();
     ImGuiID id = ImHashData(&n, sizeof(n), seed);
     ImGuiContext& g = *GImGui;
+    g.FrameStats[g.FrameStatsIdx].IdHashes++;
     if (g.DebugHookIdInfo == id)
         ImGui::DebugHookIdInfo(id, ImGuiDataType_S32, (void*)(intptr_t)n, NULL);
     return id;
@@ -3364,6 +3680,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     ImGuiContext& g = *GImGui;
     g.ItemFlagsStack.clear();
     g.GroupStack.clear();
+    g.DrawListBufferPool.Clear();
     TableGcCompactSettings();
 }
 
@@ -3371,25 +3688,34 @@ void ImGui::GcCompactTransientMiscBuffers()
 // Not freed:
 // - ImGuiWindow, ImGuiWindowSettings, Name, StateStorage, ColumnsStorage (may hold useful data)
 // This should have no noticeable visual effect. When the window reappear however, expect new allocation/buffer growth/copy cost.
+// Draw list buffers are handed to g.DrawListBufferPool, so other windows can grow into them.
 void ImGui::GcCompactTransientWindowBuffers(ImGuiWindow* window)
 {
+    ImGuiContext& g = *GImGui;
     window->MemoryCompacted = true;
     window->MemoryDrawListIdxCapacity = window->DrawList->IdxBuffer.Capacity;
     window->MemoryDrawListVtxCapacity = window->DrawList->VtxBuffer.Capacity;
     window->IDStack.clear();
+    window->IDMemo.clear();
+    window->IDMemoIdx = 0;
+    g.DrawListBufferPool.Release(window->DrawList->CmdBuffer);
+    g.DrawListBufferPool.Release(window->DrawList->IdxBuffer);
+    g.DrawListBufferPool.Release(window->DrawList->VtxBuffer);
     window->DrawList->_ClearFreeMemory();
     window->DC.ChildWindows.clear();
     window->DC.ItemWidthStack.clear();
     window->DC.TextWrapPosStack.clear();
+    window->TextLayouts.clear_destruct();
 }
 
 void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
 {
+    ImGuiContext& g = *GImGui;
     // We stored capacity of the ImDrawList buffer to reduce growth-caused allocation/copy when awakening.
     // The other buffers tends to amortize much faster.
     window->MemoryCompacted = false;
-    window->DrawList->IdxBuffer.reserve(window->MemoryDrawListIdxCapacity);
-    window->DrawList->VtxBuffer.reserve(window->MemoryDrawListVtxCapacity);
+    g.DrawListBufferPool.Reserve(window->DrawList->IdxBuffer, window->MemoryDrawListIdxCapacity);
+    g.DrawListBufferPool.Reserve(window->DrawList->VtxBuffer, window->MemoryDrawListVtxCapacity);
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
@@ -3660,11 +3986,28 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+// Atomic: MemAlloc()/MemFree() are also called by the font atlas build threads and the .ini save thread.
+// Published to io.MetricsActiveAllocations, io.MetricsFrameAllocations and the frame stats by NewFrame() and Render().
+struct ImGuiMemCounters
+{
+    std::atomic<int>    ActiveAllocations;
+    std::atomic<ImU32>  Allocs;
+    std::atomic<ImU32>  Frees;
+    std::atomic<ImU64>  AllocBytes;
+
+    ImGuiMemCounters() : ActiveAllocations(0), Allocs(0), Frees(0), AllocBytes(0) {}
+};
+
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
-        ctx->IO.MetricsActiveAllocations++;
+        if (ImGuiMemCounters* counters = ctx->MemCounters)
+        {
+            counters->ActiveAllocations.fetch_add(1, std::memory_order_relaxed);
+            counters->Allocs.fetch_add(1, std::memory_order_relaxed);
+            counters->AllocBytes.fetch_add(size, std::memory_order_relaxed);
+        }
     return (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 }
 
@@ -3673,10 +4016,83 @@ void ImGui::MemFree(void* ptr)
 {
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
+            if (ImGuiMemCounters* counters = ctx->MemCounters)
+            {
+                counters->ActiveAllocations.fetch_sub(1, std::memory_order_relaxed);
+                counters->Frees.fetch_add(1, std::memory_order_relaxed);
+            }
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+// Scratch memory from the current context, valid until the next NewFrame(). Don't call MemFree() on it.
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameArena.Alloc(size);
+}
+
+static const size_t FRAME_ARENA_MIN_CHUNK_SIZE = 16 * 1024;
+
+void ImFrameArena::AddChunk(size_t min_sz)
+{
+    // Double the size on every new chunk to reach the frame's working set in a few steps
+    const size_t chunk_sz = ImMax(ImMax(min_sz, FRAME_ARENA_MIN_CHUNK_SIZE), TotalSize);
+    char* chunk = (char*)IM_ALLOC(chunk_sz);
+    Chunks.push_back(chunk);
+    Ptr = chunk;
+    PtrEnd = chunk + chunk_sz;
+    TotalSize += chunk_sz;
+}
+
+void ImFrameArena::Reset()
+{
+    const size_t used_sz = UsedSize;
+    LastUsedSize = UsedSize;
+    LastAllocCount = AllocCount;
+    UsedSize = 0;
+    AllocCount = 0;
+    if (Chunks.Size == 0)
+        return;
+    if (Chunks.Size > 1)
+    {
+        // Replace all chunks with a single one which can hold everything that was allocated
+        const size_t total_sz = TotalSize;
+        Clear();
+        AddChunk(total_sz);
+        return;
+    }
+
+    // Shrink after some frames using much less than the chunk, keeping room for twice the peak usage of those frames
+    if (used_sz < TotalSize / 4 && TotalSize > FRAME_ARENA_MIN_CHUNK_SIZE)
+    {
+        UnderusedPeakSize = ImMax(UnderusedPeakSize, used_sz);
+        if (++UnderusedFrames >= IM_FRAME_ARENA_SHRINK_FRAMES)
+        {
+            const size_t new_sz = UnderusedPeakSize * 2;
+            Clear();
+            AddChunk(new_sz);
+            return;
+        }
+    }
+    else
+    {
+        UnderusedPeakSize = 0;
+        UnderusedFrames = 0;
+    }
+    Ptr = Chunks[0];
+}
+
+void ImFrameArena::Clear()
+{
+    for (int n = 0; n < Chunks.Size; n++)
+        IM_FREE(Chunks[n]);
+    Chunks.clear();
+    Ptr = PtrEnd = NULL;
+    TotalSize = 0;
+    UnderusedPeakSize = 0;
+    UnderusedFrames = 0;
+}
+
 const char* ImGui::GetClipboardText()
 {
     ImGuiContext& g = *GImGui;
@@ -4327,10 +4743,17 @@ ImGuiModFlags ImGui::GetMergedModFlags()
     return key_mods;
 }
 
+// Timestamp for ImGuiFrameStats durations
+static double GetFrameStatsTimeMs()
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
 void ImGui::NewFrame()
 {
     IM_ASSERT(GImGui != NULL && "No current context. Did you call ImGui::CreateContext() and ImGui::SetCurrentContext() ?");
     ImGuiContext& g = *GImGui;
+    const double stats_time_start = g.IO.ConfigDebugFrameStats ? GetFrameStatsTimeMs() : 0.0;
 
     // Remove pending delete hooks before frame start.
     // This deferred removal avoid issues of removal while iterating the hook vector
@@ -4353,6 +4776,13 @@ void ImGui::NewFrame()
     g.WindowsActiveCount = 0;
     g.MenusIdSubmittedThisFrame.resize(0);
 
+    // Rewind frame scratch memory, then publish the allocation count of the frame which just ended (including Reset())
+    g.FrameArena.Reset();
+    const ImU32 mem_allocs = g.MemCounters->Allocs.load(std::memory_order_relaxed);
+    g.IO.MetricsFrameAllocations = (int)(mem_allocs - g.FrameMemAllocsBase);
+    g.IO.MetricsActiveAllocations = g.MemCounters->ActiveAllocations.load(std::memory_order_relaxed);
+    g.FrameMemAllocsBase = mem_allocs;
+
     // Calculate frame-rate for the user, as a purely luxurious feature
     g.FramerateSecPerFrameAccum += g.IO.DeltaTime - g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx];
     g.FramerateSecPerFrame[g.FramerateSecPerFrameIdx] = g.IO.DeltaTime;
@@ -4364,6 +4794,7 @@ void ImGui::NewFrame()
 
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
+    ImFontAtlasDynamicGlyphsNewFrame(g.IO.Fonts);
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     ImRect virtual_space(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
@@ -4375,12 +4806,18 @@ void ImGui::NewFrame()
     g.DrawListSharedData.InitialFlags = ImDrawListFlags_None;
     if (g.Style.AntiAliasedLines)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLines;
-    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines))
+    if (g.Style.AntiAliasedLinesUseTex && !(g.Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField)))
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedLinesUseTex;
     if (g.Style.AntiAliasedFill)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    const size_t draw_list_pool_budget = (size_t)ImMax(g.IO.ConfigMemoryDrawListPoolSize, 0);
+    if (g.DrawListBufferPool.Budget != draw_list_pool_budget)
+    {
+        g.DrawListBufferPool.Budget = draw_list_pool_budget;
+        g.DrawListBufferPool.Trim(draw_list_pool_budget);
+    }
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     for (int n = 0; n < g.Viewports.Size; n++)
@@ -4555,6 +4992,9 @@ void ImGui::NewFrame()
     Begin("Debug##Default");
     IM_ASSERT(g.CurrentWindow->IsFallbackWindow == true);
 
+    if (g.IO.ConfigDebugFrameStats)
+        g.FrameStats[g.FrameStatsIdx].NewFrameMs = (float)(GetFrameStatsTimeMs() - stats_time_start);
+
     CallContextHooks(&g, ImGuiContextHookType_NewFramePost);
 }
 
@@ -4563,6 +5003,9 @@ void ImGui::Initialize()
     ImGuiContext& g = *GImGui;
     IM_ASSERT(!g.Initialized && !g.SettingsLoaded);
 
+    // Not counting itself: allocated with the allocator directly
+    g.MemCounters = IM_PLACEMENT_NEW((*GImAllocatorAllocFunc)(sizeof(ImGuiMemCounters), GImAllocatorUserData)) ImGuiMemCounters();
+
     // Add .ini handle for ImGuiWindow type
     {
         ImGuiSettingsHandler ini_handler;
@@ -4609,6 +5052,9 @@ void ImGui::Shutdown()
     // Save settings (unless we haven't attempted to load them: CreateContext/DestroyContext without a call to NewFrame shouldn't save an empty file)
     if (g.SettingsLoaded && g.IO.IniFilename != NULL)
         SaveIniSettingsToDisk(g.IO.IniFilename);
+#ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+    IniSaveThreadDestroy(&g);
+#endif
 
     CallContextHooks(&g, ImGuiContextHookType_Shutdown);
 
@@ -4644,8 +5090,12 @@ void ImGui::Shutdown()
     g.ClipboardHandlerData.clear();
     g.MenusIdSubmittedThisFrame.clear();
     g.InputTextState.ClearFreeMemory();
+    g.FrameArena.Clear();
+    g.DrawListBufferPool.Clear();
 
     g.SettingsWindows.clear();
+    g.SettingsWindowsIniText.clear();
+    g.SettingsTablesIniText.clear();
     g.SettingsHandlers.clear();
 
     if (g.LogFile)
@@ -4659,6 +5109,10 @@ void ImGui::Shutdown()
     g.LogBuffer.clear();
     g.DebugLogBuf.clear();
 
+    g.MemCounters->~ImGuiMemCounters();
+    (*GImAllocatorFreeFunc)(g.MemCounters, GImAllocatorUserData);
+    g.MemCounters = NULL;
+
     g.Initialized = false;
 }
 
@@ -4900,6 +5354,7 @@ void ImGui::EndFrame()
     if (g.FrameCountEnded == g.FrameCount)
         return;
     IM_ASSERT(g.WithinFrameScope && "Forgot to call ImGui::NewFrame()?");
+    const double stats_time_start = g.IO.ConfigDebugFrameStats ? GetFrameStatsTimeMs() : 0.0;
 
     CallContextHooks(&g, ImGuiContextHookType_EndFramePre);
 
@@ -4966,6 +5421,9 @@ void ImGui::EndFrame()
     g.IO.MouseWheel = g.IO.MouseWheelH = 0.0f;
     g.IO.InputQueueCharacters.resize(0);
 
+    if (g.IO.ConfigDebugFrameStats)
+        g.FrameStats[g.FrameStatsIdx].EndFrameMs = (float)(GetFrameStatsTimeMs() - stats_time_start);
+
     CallContextHooks(&g, ImGuiContextHookType_EndFramePost);
 }
 
@@ -4979,6 +5437,7 @@ void ImGui::Render()
 
     if (g.FrameCountEnded != g.FrameCount)
         EndFrame();
+    const double stats_time_start = g.IO.ConfigDebugFrameStats ? GetFrameStatsTimeMs() : 0.0;
     const bool first_render_of_frame = (g.FrameCountRendered != g.FrameCount);
     g.FrameCountRendered = g.FrameCount;
     g.IO.MetricsRenderWindows = 0;
@@ -5013,12 +5472,23 @@ void ImGui::Render()
         if (windows_to_render_top_most[n] && IsWindowActiveAndVisible(windows_to_render_top_most[n])) // NavWindowingTarget is always temporarily displayed as the top-most window
             AddRootWindowToDrawData(windows_to_render_top_most[n]);
 
+    // Measure the draw buffer pool usage from the draw lists themselves
+    size_t draw_list_pool_used = 0;
+    for (int n = 0; n != g.Windows.Size; n++)
+    {
+        const ImDrawList* draw_list = g.Windows[n]->DrawList;
+        if (draw_list->_BufferPool == &g.DrawListBufferPool)
+            draw_list_pool_used += (size_t)draw_list->CmdBuffer.Capacity * sizeof(ImDrawCmd) + (size_t)draw_list->IdxBuffer.Capacity * sizeof(ImDrawIdx) + (size_t)draw_list->VtxBuffer.Capacity * sizeof(ImDrawVert);
+    }
+    g.DrawListBufferPool.UsedSize = draw_list_pool_used;
+    g.DrawListBufferPool.UsedSizeHighWater = ImMax(g.DrawListBufferPool.UsedSizeHighWater, draw_list_pool_used);
+
     // Draw software mouse cursor if requested by io.MouseDrawCursor flag
     if (g.IO.MouseDrawCursor && first_render_of_frame && g.MouseCursor != ImGuiMouseCursor_None)
         RenderMouseCursor(g.IO.MousePos, g.Style.MouseCursorScale, g.MouseCursor, IM_COL32_WHITE, IM_COL32_BLACK, IM_COL32(0, 0, 0, 48));
 
     // Setup ImDrawData structures for end-user
-    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = 0;
+    g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = g.IO.MetricsRenderCulledPrimitives = 0;
     for (int n = 0; n < g.Viewports.Size; n++)
     {
         ImGuiViewportP* viewport = g.Viewports[n];
@@ -5032,11 +5502,104 @@ void ImGui::Render()
         ImDrawData* draw_data = &viewport->DrawDataP;
         g.IO.MetricsRenderVertices += draw_data->TotalVtxCount;
         g.IO.MetricsRenderIndices += draw_data->TotalIdxCount;
+        for (int draw_list_n = 0; draw_list_n < draw_data->CmdListsCount; draw_list_n++)
+            g.IO.MetricsRenderCulledPrimitives += draw_data->CmdLists[draw_list_n]->_CulledPrimCount;
+    }
+
+    // Publish frame stats
+    if (first_render_of_frame)
+    {
+        ImGuiFrameStats& stats = g.FrameStats[g.FrameStatsIdx];
+        stats.FrameCount = g.FrameCount;
+        stats.DeltaTime = g.IO.DeltaTime;
+        const ImU32 storage_lookups = GImGuiStorageLookupCount.load(std::memory_order_relaxed);
+        const ImU32 mem_allocs = g.MemCounters->Allocs.load(std::memory_order_relaxed);
+        const ImU32 mem_frees = g.MemCounters->Frees.load(std::memory_order_relaxed);
+        const ImU64 mem_alloc_bytes = g.MemCounters->AllocBytes.load(std::memory_order_relaxed);
+        stats.Allocs = (int)(mem_allocs - g.FrameStatsAllocsBase);
+        stats.Frees = (int)(mem_frees - g.FrameStatsFreesBase);
+        stats.AllocBytes = mem_alloc_bytes - g.FrameStatsAllocBytesBase;
+        stats.StorageLookups = (int)(storage_lookups - g.FrameStatsStorageLookupsBase);
+        stats.Vertices = g.IO.MetricsRenderVertices;
+        stats.Indices = g.IO.MetricsRenderIndices;
+        for (int n = 0; n < g.Viewports.Size; n++)
+        {
+            ImDrawData* draw_data = &g.Viewports[n]->DrawDataP;
+            stats.DrawLists += draw_data->CmdListsCount;
+            for (int draw_list_n = 0; draw_list_n < draw_data->CmdListsCount; draw_list_n++)
+                stats.DrawCmds += draw_data->CmdLists[draw_list_n]->CmdBuffer.Size;
+        }
+        if (g.IO.ConfigDebugFrameStats)
+        {
+            for (int n = 0; n < g.Windows.Size; n++)
+            {
+                ImGuiWindow* window = g.Windows[n];
+                if (!IsWindowActiveAndVisible(window))
+                    continue;
+                ImGuiFrameStatsWindow window_stats;
+                window_stats.Name = window->Name;
+                window_stats.DrawCmds = window->DrawList->CmdBuffer.Size;
+                window_stats.Vertices = window->DrawList->VtxBuffer.Size;
+                window_stats.Indices = window->DrawList->IdxBuffer.Size;
+                stats.Windows.push_back(window_stats);
+            }
+            stats.RenderMs = (float)(GetFrameStatsTimeMs() - stats_time_start);
+        }
+        g.FrameStatsIdx ^= 1;
+        g.FrameStats[g.FrameStatsIdx].Clear();
+        g.FrameStatsStorageLookupsBase = storage_lookups;
+        g.FrameStatsAllocsBase = mem_allocs;
+        g.FrameStatsFreesBase = mem_frees;
+        g.FrameStatsAllocBytesBase = mem_alloc_bytes;
+        g.IO.MetricsActiveAllocations = g.MemCounters->ActiveAllocations.load(std::memory_order_relaxed);
     }
 
     CallContextHooks(&g, ImGuiContextHookType_RenderPost);
 }
 
+const ImGuiFrameStats& ImGui::GetFrameStats()
+{
+    ImGuiContext& g = *GImGui;
+    return g.FrameStats[g.FrameStatsIdx ^ 1];
+}
+
+void ImGuiFrameStats::AppendCsvHeader(ImGuiTextBuffer* buf)
+{
+    buf->append("frame,delta_time_ms,allocs,frees,alloc_bytes,id_hashes,storage_lookups,draw_lists,draw_cmds,vertices,indices,new_frame_ms,end_frame_ms,render_ms\n");
+}
+
+void ImGuiFrameStats::AppendCsv(ImGuiTextBuffer* buf) const
+{
+    buf->appendf("%d,%.3f,%d,%d,%llu,%d,%d,%d,%d,%d,%d,%.3f,%.3f,%.3f\n",
+        FrameCount, DeltaTime * 1000.0f, Allocs, Frees, (unsigned long long)AllocBytes, IdHashes, StorageLookups,
+        DrawLists, DrawCmds, Vertices, Indices, NewFrameMs, EndFrameMs, RenderMs);
+}
+
+void ImGuiFrameStats::AppendJson(ImGuiTextBuffer* buf) const
+{
+    buf->appendf("{\"frame\":%d,\"delta_time_ms\":%.3f,\"allocs\":%d,\"frees\":%d,\"alloc_bytes\":%llu,\"id_hashes\":%d,\"storage_lookups\":%d,"
+        "\"draw_lists\":%d,\"draw_cmds\":%d,\"vertices\":%d,\"indices\":%d,\"new_frame_ms\":%.3f,\"end_frame_ms\":%.3f,\"render_ms\":%.3f,\"windows\":[",
+        FrameCount, DeltaTime * 1000.0f, Allocs, Frees, (unsigned long long)AllocBytes, IdHashes, StorageLookups,
+        DrawLists, DrawCmds, Vertices, Indices, NewFrameMs, EndFrameMs, RenderMs);
+    for (int n = 0; n < Windows.Size; n++)
+    {
+        const ImGuiFrameStatsWindow& window_stats = Windows[n];
+        buf->append(n > 0 ? ",{\"name\":\"" : "{\"name\":\"");
+        for (const char* p = window_stats.Name; *p; p++)
+        {
+            // Escape quotes, backslashes and control characters. UTF-8 sequences are valid JSON as is.
+            if (*p == '"' || *p == '\\')
+                buf->appendf("\\%c", *p);
+            else if ((unsigned char)*p < 0x20)
+                buf->appendf("\\u%04x", (unsigned int)(unsigned char)*p);
+            else
+                buf->append(p, p + 1);
+        }
+        buf->appendf("\",\"draw_cmds\":%d,\"vertices\":%d,\"indices\":%d}", window_stats.DrawCmds, window_stats.Vertices, window_stats.Indices);
+    }
+    buf->append("]}\n");
+}
+
 // Calculate text size. Text can be multi-line. Optionally ignore text after a ## marker.
 // CalcTextSize("") should return ImVec2(0.0f, g.FontSize)
 ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_text_after_double_hash, float wrap_width)
@@ -5047,12 +5610,29 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     if (hide_text_after_double_hash)
         text_display_end = FindRenderedTextEnd(text, text_end);      // Hide anything after a '##' string
     else
-        text_display_end = text_end;
+        text_display_end = text_end ? text_end : text + strlen(text);
 
     ImFont* font = g.Font;
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
+
+    // Wrapped text costs a word wrapping pass per line: reuse the size measured by a previous call
+    ImGuiTextSizeCacheEntry* cache_entry = NULL;
+    ImGuiID cache_key = 0;
+    const int text_len = (int)(text_display_end - text);
+    const int generation = font->ContainerAtlas ? font->ContainerAtlas->LookupGeneration : 0;
+    if (wrap_width > 0.0f)
+    {
+        cache_key = ImHashData(&font, sizeof(font), 0);
+        cache_key = ImHashData(&font_size, sizeof(font_size), cache_key);
+        cache_key = ImHashData(&wrap_width, sizeof(wrap_width), cache_key);
+        cache_key = ImHashData(text, (size_t)text_len, cache_key); // Not ImHashStr(): "###" would make texts differing before it share a key
+        cache_entry = &g.TextSizeCache[cache_key % IM_ARRAYSIZE(g.TextSizeCache)];
+        if (cache_entry->Key == cache_key && cache_entry->TextLen == text_len && cache_entry->Generation == generation)
+            return cache_entry->Size;
+    }
+
     ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
@@ -5062,6 +5642,13 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     // - https://embarkstudios.github.io/rust-gpu/api/src/libm/math/ceilf.rs.html
     text_size.x = IM_FLOOR(text_size.x + 0.99999f);
 
+    if (cache_entry != NULL)
+    {
+        cache_entry->Key = cache_key;
+        cache_entry->TextLen = text_len;
+        cache_entry->Generation = (font->ContainerAtlas ? font->ContainerAtlas->LookupGeneration : 0); // Measuring may have loaded dynamic glyphs
+        cache_entry->Size = text_size;
+    }
     return text_size;
 }
 
@@ -6132,6 +6719,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->Flags = (ImGuiWindowFlags)flags;
         window->LastFrameActive = current_frame;
         window->LastTimeActive = (float)g.Time;
+        window->IDMemoIdx = 0;
         window->BeginOrderWithinParent = 0;
         window->BeginOrderWithinContext = (short)(g.WindowsActiveCount++);
     }
@@ -11708,6 +12296,7 @@ void ImGui::LogButtons()
 // - SaveIniSettingsToDisk()
 // - SaveIniSettingsToMemory()
 // - WindowSettingsHandler_***() [Internal]
+// - IniSaveThread***() [Internal]
 //-----------------------------------------------------------------------------
 
 // Called by NewFrame()
@@ -11730,9 +12319,21 @@ void ImGui::UpdateSettings()
         if (g.SettingsDirtyTimer <= 0.0f)
         {
             if (g.IO.IniFilename != NULL)
+            {
+#ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+                if (!IniSaveThreadSubmit(&g, g.IO.IniFilename))
+                {
+                    g.SettingsDirtyTimer = FLT_MIN; // Previous write still in progress: retry next frame
+                    return;
+                }
+#else
                 SaveIniSettingsToDisk(g.IO.IniFilename);
+#endif
+            }
             else
+            {
                 g.IO.WantSaveIniSettings = true;  // Let user know they can call SaveIniSettingsToMemory(). user will need to clear io.WantSaveIniSettings themselves.
+            }
             g.SettingsDirtyTimer = 0.0f;
         }
     }
@@ -11826,6 +12427,9 @@ void ImGui::ClearIniSettings()
 
 void ImGui::LoadIniSettingsFromDisk(const char* ini_filename)
 {
+#ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+    IniSaveThreadWaitIdle(GImGui); // Don't read a file a timed save is still writing
+#endif
     size_t file_data_size = 0;
     char* file_data = (char*)ImFileLoadToMemory(ini_filename, "rb", &file_data_size);
     if (!file_data)
@@ -11912,6 +12516,9 @@ void ImGui::SaveIniSettingsToDisk(const char* ini_filename)
     g.SettingsDirtyTimer = 0.0f;
     if (!ini_filename)
         return;
+#ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+    IniSaveThreadWaitIdle(&g); // Don't race with a timed save still writing the file
+#endif
 
     size_t ini_data_size = 0;
     const char* ini_data = SaveIniSettingsToMemory(&ini_data_size);
@@ -11998,25 +12605,153 @@ static void WindowSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandl
             window->SettingsOffset = g.SettingsWindows.offset_from_ptr(settings);
         }
         IM_ASSERT(settings->ID == window->ID);
-        settings->Pos = ImVec2ih(window->Pos);
-        settings->Size = ImVec2ih(window->SizeFull);
-
+        const ImVec2ih pos(window->Pos), size(window->SizeFull);
+        if (settings->Pos.x != pos.x || settings->Pos.y != pos.y || settings->Size.x != size.x || settings->Size.y != size.y || settings->Collapsed != window->Collapsed)
+            settings->WantSave = true;
+        settings->Pos = pos;
+        settings->Size = size;
         settings->Collapsed = window->Collapsed;
     }
 
     // Write to text buffer
+    // Entries which didn't change since the last call copy their text from g.SettingsWindowsIniText instead of formatting it again.
     buf->reserve(buf->size() + g.SettingsWindows.size() * 6); // ballpark reserve
+    const int section_start = buf->size();
     for (ImGuiWindowSettings* settings = g.SettingsWindows.begin(); settings != NULL; settings = g.SettingsWindows.next_chunk(settings))
     {
-        const char* settings_name = settings->GetName();
-        buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
-        buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
-        buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
-        buf->appendf("Collapsed=%d\n", settings->Collapsed);
-        buf->append("\n");
+        const int entry_start = buf->size();
+        if (!settings->WantSave && settings->IniTextSize > 0)
+        {
+            const char* text = g.SettingsWindowsIniText.begin() + settings->IniTextOffset;
+            buf->append(text, text + settings->IniTextSize);
+        }
+        else
+        {
+            const char* settings_name = settings->GetName();
+            buf->appendf("[%s][%s]\n", handler->TypeName, settings_name);
+            buf->appendf("Pos=%d,%d\n", settings->Pos.x, settings->Pos.y);
+            buf->appendf("Size=%d,%d\n", settings->Size.x, settings->Size.y);
+            buf->appendf("Collapsed=%d\n", settings->Collapsed);
+            buf->append("\n");
+            settings->WantSave = false;
+        }
+        settings->IniTextOffset = entry_start - section_start;
+        settings->IniTextSize = buf->size() - entry_start;
     }
+    g.SettingsWindowsIniText.Buf.resize(0);
+    g.SettingsWindowsIniText.append(buf->begin() + section_start, buf->end());
 }
 
+#ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+
+// Background thread writing the .ini file for the timed saves of UpdateSettings(), so NewFrame() doesn't wait on the disk.
+// The data is serialized on the main thread, the thread opens, writes and closes the file (opening with truncation alone can take tens of ms).
+// Explicit calls to SaveIniSettingsToDisk() wait for the thread then write synchronously.
+struct ImGuiIniSaveThread
+{
+    std::thread             Thread;
+    std::mutex              Mutex;
+    std::condition_variable Cond;
+    ImVector<char>          Filename;       // Only accessed by the thread while Pending
+    ImVector<char>          Data;           // "
+    bool                    Pending;        // Set while a write is pending or in progress
+    bool                    Quit;
+
+    ImGuiIniSaveThread()    { Pending = Quit = false; }
+};
+
+// Must not use ImGui::MemAlloc(), which updates context counters without synchronization
+static void IniSaveThreadMain(ImGuiIniSaveThread* st)
+{
+    std::unique_lock<std::mutex> lock(st->Mutex);
+    while (true)
+    {
+        while (!st->Pending && !st->Quit)
+            st->Cond.wait(lock);
+        if (!st->Pending)
+            return;
+        lock.unlock();
+        if (ImFileHandle f = ImFileOpen(st->Filename.Data, "wt"))
+        {
+            ImFileWrite(st->Data.Data, sizeof(char), (ImU64)st->Data.Size, f);
+            ImFileClose(f);
+        }
+        lock.lock();
+        st->Pending = false;
+        st->Cond.notify_all();
+    }
+}
+
+// Return false if the previous write is still in progress
+static bool IniSaveThreadSubmit(ImGuiContext* ctx, const char* ini_filename)
+{
+    ImGuiContext& g = *ctx;
+    if (g.SettingsSaveThread == NULL)
+    {
+        ImGuiIniSaveThread* st = IM_NEW(ImGuiIniSaveThread)();
+        try
+        {
+            st->Thread = std::thread(IniSaveThreadMain, st);
+        }
+        catch (const std::system_error&)
+        {
+            // Can't start a thread: write synchronously, and try again on the next save
+            IM_DELETE(st);
+            ImGui::SaveIniSettingsToDisk(ini_filename);
+            return true;
+        }
+        g.SettingsSaveThread = st;
+    }
+    ImGuiIniSaveThread* st = g.SettingsSaveThread;
+    {
+        std::lock_guard<std::mutex> lock(st->Mutex);
+        if (st->Pending)
+            return false;
+    }
+
+    // The thread is idle and only waits for Pending to be set: Filename and Data can be filled without holding the lock
+    size_t ini_data_size = 0;
+    const char* ini_data = ImGui::SaveIniSettingsToMemory(&ini_data_size);
+    const int filename_size = (int)strlen(ini_filename) + 1;
+    st->Filename.resize(filename_size);
+    memcpy(st->Filename.Data, ini_filename, (size_t)filename_size);
+    st->Data.resize((int)ini_data_size);
+    if (ini_data_size > 0)
+        memcpy(st->Data.Data, ini_data, ini_data_size);
+
+    std::lock_guard<std::mutex> lock(st->Mutex);
+    st->Pending = true;
+    st->Cond.notify_all();
+    return true;
+}
+
+static void IniSaveThreadWaitIdle(ImGuiContext* ctx)
+{
+    ImGuiIniSaveThread* st = ctx->SettingsSaveThread;
+    if (st == NULL)
+        return;
+    std::unique_lock<std::mutex> lock(st->Mutex);
+    while (st->Pending)
+        st->Cond.wait(lock);
+}
+
+static void IniSaveThreadDestroy(ImGuiContext* ctx)
+{
+    ImGuiIniSaveThread* st = ctx->SettingsSaveThread;
+    if (st == NULL)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(st->Mutex);
+        st->Quit = true;
+        st->Cond.notify_all();
+    }
+    st->Thread.join(); // Finishes any pending write first
+    IM_DELETE(st);
+    ctx->SettingsSaveThread = NULL;
+}
+
+#endif // #ifndef IMGUI_DISABLE_INI_SAVE_THREAD
+
 
 //-----------------------------------------------------------------------------
 // [SECTION] VIEWPORTS, PLATFORM WINDOWS
@@ -12379,6 +13114,10 @@ void ImGui::ShowFontAtlas(ImFontAtlas* atlas)
         DebugNodeFont(font);
         PopID();
     }
+    Text("Last build: parse %.2f ms, pack %.2f ms, raster %.2f ms, finish %.2f ms", atlas->BuildTimeParse, atlas->BuildTimePack, atlas->BuildTimeRaster, atlas->BuildTimeFinish);
+    const int tex_pixels = atlas->TexWidth * atlas->TexHeight;
+    const int tex_bytes = (atlas->TexPixelsAlpha8 ? tex_pixels : 0) + (atlas->TexPixelsRGBA32 ? tex_pixels * 4 : 0);
+    Text("Occupancy %.1f%% (%d packed pixels), texture memory %d KB", tex_pixels > 0 ? atlas->BuildPackedSurface * 100.0f / tex_pixels : 0.0f, atlas->BuildPackedSurface, tex_bytes / 1024);
     if (TreeNode("Atlas texture", "Atlas texture (%dx%d pixels)", atlas->TexWidth, atlas->TexHeight))
     {
         ImVec4 tint_col = ImVec4(1.0f, 1.0f, 1.0f, 1.0f);
@@ -12408,7 +13147,20 @@ void ImGui::ShowMetricsWindow(bool* p_open)
     Text("Dear ImGui %s", GetVersion());
     Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
+    Text("%d primitives culled by clip rectangle", io.MetricsRenderCulledPrimitives);
     Text("%d visible windows, %d active allocations", io.MetricsRenderWindows, io.MetricsActiveAllocations);
+    Text("%d allocations last frame, frame scratch: %d bytes in %d allocs (%d KB reserved)", io.MetricsFrameAllocations, (int)g.FrameArena.LastUsedSize, g.FrameArena.LastAllocCount, (int)(g.FrameArena.TotalSize / 1024));
+    {
+        const ImDrawListBufferPool& pool = g.DrawListBufferPool;
+        Text("Draw buffer pool: %d KB free / %d KB budget (high-water %d KB), %d KB used (high-water %d KB)", (int)(pool.FreeSize / 1024), (int)(pool.Budget / 1024), (int)(pool.FreeSizeHighWater / 1024), (int)(pool.UsedSize / 1024), (int)(pool.UsedSizeHighWater / 1024));
+        Text("Draw buffer pool: %d blocks allocated, %d reused, %d freed over budget", pool.BlocksAllocated, pool.BlocksReused, pool.BlocksFreed);
+    }
+    {
+        const ImGuiFrameStats& stats = GetFrameStats();
+        Text("Last frame: %d allocs (%d KB), %d frees, %d ID hashes, %d storage lookups", stats.Allocs, (int)(stats.AllocBytes / 1024), stats.Frees, stats.IdHashes, stats.StorageLookups);
+        if (io.ConfigDebugFrameStats)
+            Text("Last frame: NewFrame %.3f ms, EndFrame %.3f ms, Render %.3f ms", stats.NewFrameMs, stats.EndFrameMs, stats.RenderMs);
+    }
     //SameLine(); if (SmallButton("GC")) { g.GcCompactAll = true; }
 
     Separator();
@@ -12834,7 +13586,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, const ImDrawList* draw_list,
     int cmd_count = draw_list->CmdBuffer.Size;
     if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
-    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
+    bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds, %d culled", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count, draw_list->_CulledPrimCount);
     if (draw_list == GetWindowDrawList())
     {
         SameLine();
@@ -13055,7 +13807,7 @@ void ImGui::DebugNodeFontGlyph(ImFont*, const ImFontGlyph* glyph)
 // [DEBUG] Display contents of ImGuiStorage
 void ImGui::DebugNodeStorage(ImGuiStorage* storage, const char* label)
 {
-    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes()))
+    if (!TreeNode(label, "%s: %d entries, %d bytes", label, storage->Data.Size, storage->Data.size_in_bytes() + storage->Index.size_in_bytes()))
         return;
     for (int n = 0; n < storage->Data.Size; n++)
     {
@@ -39,6 +39,12 @@ Index of this file:
 #endif
 
 #include <stdio.h>      // vsnprintf, sscanf, printf
+#include <chrono>       // std::chrono::steady_clock (font atlas build timings)
+#if defined(IMGUI_ENABLE_STB_TRUETYPE) && !defined(IMGUI_DISABLE_FONT_ATLAS_BUILD_THREADS)
+#include <atomic>       // std::atomic
+#include <system_error> // std::system_error
+#include <thread>       // std::thread
+#endif
 #if !defined(alloca)
 #if defined(__GLIBC__) || defined(__sun) || defined(__APPLE__) || defined(__NEWLIB__)
 #include <alloca.h>     // alloca (glibc uses <alloca.h>. Note that Cygwin may have _WIN32 defined, so the order matters here)
@@ -144,8 +150,23 @@ namespace IMGUI_STB_NAMESPACE
 #ifdef  IMGUI_ENABLE_STB_TRUETYPE
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION           // in case the user already have an implementation in another compilation unit
-#define STBTT_malloc(x,u)   ((void)(u), IM_ALLOC(x))
-#define STBTT_free(x,u)     ((void)(u), IM_FREE(x))
+// stb_truetype only makes temporary allocations, and may run on the font atlas build worker threads:
+// call the allocator directly rather than IM_ALLOC()/IM_FREE(), which read GImGui, set by the thread owning the context.
+static void* ImStbTrueTypeAlloc(size_t size)
+{
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    return alloc_func(size, user_data);
+}
+static void ImStbTrueTypeFree(void* ptr)
+{
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    if (ptr)
+        free_func(ptr, user_data);
+}
+#define STBTT_malloc(x,u)   ((void)(u), ImStbTrueTypeAlloc(x))
+#define STBTT_free(x,u)     ((void)(u), ImStbTrueTypeFree(x))
 #define STBTT_assert(x)     do { IM_ASSERT(x); } while(0)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
@@ -398,6 +419,104 @@ void ImDrawListSharedData::SetCircleTessellationMaxError(float max_error)
     ArcFastRadiusCutoff = IM_DRAWLIST_CIRCLE_AUTO_SEGMENT_CALC_R(IM_DRAWLIST_ARCFAST_SAMPLE_MAX, CircleSegmentMaxError);
 }
 
+void ImDrawListBufferPool::ReserveBuffer(int type, size_t elem_size, void** p_data, int size, int* p_capacity, int new_capacity)
+{
+    IM_ASSERT(new_capacity > *p_capacity);
+    void* new_data = NULL;
+    if (Budget == 0)
+    {
+        new_data = IM_ALLOC((size_t)new_capacity * elem_size);
+    }
+    else
+    {
+        // Round up to a size class, then use a free block of that class or of the next one
+        int size_class = 3;
+        while ((1 << size_class) < new_capacity)
+            size_class++;
+        IM_ASSERT(size_class < IM_DRAWLIST_POOL_CLASS_COUNT);
+        for (int n = size_class; n <= size_class + 1 && n < IM_DRAWLIST_POOL_CLASS_COUNT && new_data == NULL; n++)
+            if (!FreeBlocks[type][n].empty())
+            {
+                new_data = FreeBlocks[type][n].back();
+                FreeBlocks[type][n].pop_back();
+                FreeSize -= ((size_t)1 << n) * elem_size;
+                size_class = n;
+                BlocksReused++;
+            }
+        if (new_data == NULL)
+        {
+            new_data = IM_ALLOC(((size_t)1 << size_class) * elem_size);
+            BlocksAllocated++;
+        }
+        new_capacity = 1 << size_class;
+    }
+    if (*p_data)
+    {
+        memcpy(new_data, *p_data, (size_t)size * elem_size);
+        int old_size = size;
+        ReleaseBuffer(type, elem_size, p_data, &old_size, p_capacity);
+    }
+    *p_data = new_data;
+    *p_capacity = new_capacity;
+}
+
+// Blocks which weren't allocated by the pool are accepted too: they are sorted in the largest class they can hold.
+void ImDrawListBufferPool::ReleaseBuffer(int type, size_t elem_size, void** p_data, int* p_size, int* p_capacity)
+{
+    void* data = *p_data;
+    const int capacity = *p_capacity;
+    *p_data = NULL;
+    *p_size = *p_capacity = 0;
+    if (data == NULL)
+        return;
+
+    int size_class = 0;
+    while (size_class + 1 < IM_DRAWLIST_POOL_CLASS_COUNT && (1 << (size_class + 1)) <= capacity)
+        size_class++;
+    const size_t class_bytes = ((size_t)1 << size_class) * elem_size;
+    if (FreeSize + class_bytes > Budget)
+    {
+        IM_FREE(data);
+        if (Budget > 0)
+            BlocksFreed++;
+        return;
+    }
+    FreeBlocks[type][size_class].push_back(data);
+    FreeSize += class_bytes;
+    FreeSizeHighWater = ImMax(FreeSizeHighWater, FreeSize);
+}
+
+void ImDrawListBufferPool::Trim(size_t budget)
+{
+    // Free the largest blocks first
+    for (int size_class = IM_DRAWLIST_POOL_CLASS_COUNT - 1; size_class >= 0 && FreeSize > budget; size_class--)
+        for (int type = 0; type < ImDrawListPoolBuffer_COUNT; type++)
+        {
+            static const size_t elem_sizes[ImDrawListPoolBuffer_COUNT] = { sizeof(ImDrawCmd), sizeof(ImDrawIdx), sizeof(ImDrawVert) };
+            ImVector<void*>& blocks = FreeBlocks[type][size_class];
+            while (!blocks.empty() && FreeSize > budget)
+            {
+                IM_FREE(blocks.back());
+                blocks.pop_back();
+                FreeSize -= ((size_t)1 << size_class) * elem_sizes[type];
+            }
+        }
+    if (budget == 0)
+        for (int type = 0; type < ImDrawListPoolBuffer_COUNT; type++)
+            for (int size_class = 0; size_class < IM_DRAWLIST_POOL_CLASS_COUNT; size_class++)
+                FreeBlocks[type][size_class].clear();
+}
+
+// Grow through the draw list's pool when there is one, so storage released by other draw lists gets reused
+template<typename T>
+static inline void ImDrawListGrowBuffer(ImDrawListBufferPool* pool, ImVector<T>& buf, int new_capacity)
+{
+    if (pool)
+        pool->Reserve(buf, new_capacity);
+    else
+        buf.reserve(new_capacity);
+}
+
 // Initialize before use in a new frame. We always have a command ready in the buffer.
 void ImDrawList::_ResetForNewFrame()
 {
@@ -409,6 +528,8 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    if (CmdBuffer.Capacity == 0)
+        ImDrawListGrowBuffer(_BufferPool, CmdBuffer, CmdBuffer._grow_capacity(1));
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -420,6 +541,7 @@ void ImDrawList::_ResetForNewFrame()
     _Splitter.Clear();
     CmdBuffer.push_back(ImDrawCmd());
     _FringeScale = 1.0f;
+    _CulledPrimCount = 0;
 }
 
 void ImDrawList::_ClearFreeMemory()
@@ -456,6 +578,8 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.IdxOffset = IdxBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
+    if (CmdBuffer.Size == CmdBuffer.Capacity)
+        ImDrawListGrowBuffer(_BufferPool, CmdBuffer, CmdBuffer._grow_capacity(CmdBuffer.Size + 1));
     CmdBuffer.push_back(draw_cmd);
 }
 
@@ -486,6 +610,25 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* callback_data)
     AddDrawCmd(); // Force a new command after us (see comment below)
 }
 
+// Polyline/polygon flavor of _IsCulled(): compute bounding box of 'points' then test it against the current clip rectangle.
+bool ImDrawList::_IsCulled(const ImVec2* points, int points_count, float pad)
+{
+#ifndef IMGUI_DISABLE_DRAWLIST_CPU_CULLING
+    ImVec2 bb_min = points[0];
+    ImVec2 bb_max = points[0];
+    for (int i = 1; i < points_count; i++)
+    {
+        const ImVec2& p = points[i];
+        if (p.x < bb_min.x) bb_min.x = p.x; else if (p.x > bb_max.x) bb_max.x = p.x;
+        if (p.y < bb_min.y) bb_min.y = p.y; else if (p.y > bb_max.y) bb_max.y = p.y;
+    }
+    return _IsCulled(bb_min, bb_max, pad);
+#else
+    IM_UNUSED(points); IM_UNUSED(points_count); IM_UNUSED(pad);
+    return false;
+#endif
+}
+
 // Compare ClipRect, TextureId and VtxOffset with a single memcmp()
 #define ImDrawCmd_HeaderSize                            (IM_OFFSETOF(ImDrawCmd, VtxOffset) + sizeof(unsigned int))
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
@@ -645,10 +788,14 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
+    if (vtx_buffer_old_size + vtx_count > VtxBuffer.Capacity)
+        ImDrawListGrowBuffer(_BufferPool, VtxBuffer, VtxBuffer._grow_capacity(vtx_buffer_old_size + vtx_count));
     VtxBuffer.resize(vtx_buffer_old_size + vtx_count);
     _VtxWritePtr = VtxBuffer.Data + vtx_buffer_old_size;
 
     int idx_buffer_old_size = IdxBuffer.Size;
+    if (idx_buffer_old_size + idx_count > IdxBuffer.Capacity)
+        ImDrawListGrowBuffer(_BufferPool, IdxBuffer, IdxBuffer._grow_capacity(idx_buffer_old_size + idx_count));
     IdxBuffer.resize(idx_buffer_old_size + idx_count);
     _IdxWritePtr = IdxBuffer.Data + idx_buffer_old_size;
 }
@@ -722,6 +869,8 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 {
     if (points_count < 2)
         return;
+    if (_IsCulled(points, points_count, thickness * 0.5f + _FringeScale))
+        return;
 
     const bool closed = (flags & ImDrawFlags_Closed) != 0;
     const ImVec2 opaque_uv = _Data->TexUvWhitePixel;
@@ -745,7 +894,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         const bool use_texture = (Flags & ImDrawListFlags_AntiAliasedLinesUseTex) && (integer_thickness < IM_DRAWLIST_TEX_LINES_WIDTH_MAX) && (fractional_thickness <= 0.00001f) && (AA_SIZE == 1.0f);
 
         // We should never hit this, because NewFrame() doesn't set ImDrawListFlags_AntiAliasedLinesUseTex unless ImFontAtlasFlags_NoBakedLines is off
-        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & ImFontAtlasFlags_NoBakedLines));
+        IM_ASSERT_PARANOID(!use_texture || !(_Data->Font->ContainerAtlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField)));
 
         const int idx_count = use_texture ? (count * 6) : (thick_line ? count * 18 : count * 12);
         const int vtx_count = use_texture ? (points_count * 2) : (thick_line ? points_count * 4 : points_count * 3);
@@ -979,6 +1128,8 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
 {
     if (points_count < 3)
         return;
+    if (_IsCulled(points, points_count, _FringeScale))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
 
@@ -1384,6 +1535,8 @@ void ImDrawList::AddLine(const ImVec2& p1, const ImVec2& p2, ImU32 col, float th
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (_IsCulled(ImMin(p1, p2), ImMax(p1, p2), thickness * 0.5f + _FringeScale + 0.5f))
+        return;
     PathLineTo(p1 + ImVec2(0.5f, 0.5f));
     PathLineTo(p2 + ImVec2(0.5f, 0.5f));
     PathStroke(col, 0, thickness);
@@ -1395,6 +1548,8 @@ void ImDrawList::AddRect(const ImVec2& p_min, const ImVec2& p_max, ImU32 col, fl
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (_IsCulled(p_min, p_max, thickness * 0.5f + _FringeScale))
+        return;
     if (Flags & ImDrawListFlags_AntiAliasedLines)
         PathRect(p_min + ImVec2(0.50f, 0.50f), p_max - ImVec2(0.50f, 0.50f), rounding, flags);
     else
@@ -1406,6 +1561,8 @@ void ImDrawList::AddRectFilled(const ImVec2& p_min, const ImVec2& p_max, ImU32 c
 {
     if ((col & IM_COL32_A_MASK) == 0)
         return;
+    if (_IsCulled(p_min, p_max, _FringeScale))
+        return;
     if (rounding < 0.5f || (flags & ImDrawFlags_RoundCornersMask_) == ImDrawFlags_RoundCornersNone)
     {
         PrimReserve(6, 4);
@@ -1423,6 +1580,8 @@ void ImDrawList::AddRectFilledMultiColor(const ImVec2& p_min, const ImVec2& p_ma
 {
     if (((col_upr_left | col_upr_right | col_bot_right | col_bot_left) & IM_COL32_A_MASK) == 0)
         return;
+    if (_IsCulled(p_min, p_max, 0.0f))
+        return;
 
     const ImVec2 uv = _Data->TexUvWhitePixel;
     PrimReserve(6, 4);
@@ -1484,6 +1643,8 @@ void ImDrawList::AddCircle(const ImVec2& center, float radius, ImU32 col, int nu
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if (_IsCulled(center - ImVec2(radius, radius), center + ImVec2(radius, radius), thickness * 0.5f + _FringeScale))
+        return;
 
     if (num_segments <= 0)
     {
@@ -1508,6 +1669,8 @@ void ImDrawList::AddCircleFilled(const ImVec2& center, float radius, ImU32 col,
 {
     if ((col & IM_COL32_A_MASK) == 0 || radius < 0.5f)
         return;
+    if (_IsCulled(center - ImVec2(radius, radius), center + ImVec2(radius, radius), _FringeScale))
+        return;
 
     if (num_segments <= 0)
     {
@@ -1533,6 +1696,8 @@ void ImDrawList::AddNgon(const ImVec2& center, float radius, ImU32 col, int num_
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (_IsCulled(center - ImVec2(radius, radius), center + ImVec2(radius, radius), thickness * 0.5f + _FringeScale))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1545,6 +1710,8 @@ void ImDrawList::AddNgonFilled(const ImVec2& center, float radius, ImU32 col, in
 {
     if ((col & IM_COL32_A_MASK) == 0 || num_segments <= 2)
         return;
+    if (_IsCulled(center - ImVec2(radius, radius), center + ImVec2(radius, radius), _FringeScale))
+        return;
 
     // Because we are filling a closed shape we remove 1 from the count of segments/points
     const float a_max = (IM_PI * 2.0f) * ((float)num_segments - 1.0f) / (float)num_segments;
@@ -1600,6 +1767,16 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
         clip_rect.z = ImMin(clip_rect.z, cpu_fine_clip_rect->z);
         clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
     }
+
+    // Text only extends right and down from 'pos' (minus small glyph offsets, hence the 'font_size' margin): reject early if it starts past the clip rectangle.
+    // Lines above the clip rectangle are skipped by RenderText().
+#ifndef IMGUI_DISABLE_DRAWLIST_CPU_CULLING
+    if (pos.x - font_size > clip_rect.z || pos.y > clip_rect.w)
+    {
+        _CulledPrimCount++;
+        return;
+    }
+#endif
     font->RenderText(this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip_rect != NULL);
 }
 
@@ -1726,52 +1903,52 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate upper bounds of our final buffer sizes, so commands and indices can be written in a single pass without reallocating.
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
-    ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
-    int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
-        ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
-            ch._CmdBuffer.pop_back();
-
-        if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
-        {
-            // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
-            // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
-            ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
-            {
-                // Merge previous channel last draw command with current channel first draw command if matching.
-                last_cmd->ElemCount += next_cmd->ElemCount;
-                idx_offset += next_cmd->ElemCount;
-                ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
-            }
-        }
-        if (ch._CmdBuffer.Size > 0)
-            last_cmd = &ch._CmdBuffer.back();
-        new_cmd_buffer_count += ch._CmdBuffer.Size;
-        new_idx_buffer_count += ch._IdxBuffer.Size;
-        for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
-        {
-            ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
-            idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
-        }
+        new_cmd_buffer_count += _Channels.Data[i]._CmdBuffer.Size;
+        new_idx_buffer_count += _Channels.Data[i]._IdxBuffer.Size;
     }
-    draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    ImDrawListGrowBuffer(draw_list->_BufferPool, draw_list->CmdBuffer, draw_list->CmdBuffer.Size + new_cmd_buffer_count);
+    if (draw_list->IdxBuffer.Size + new_idx_buffer_count > draw_list->IdxBuffer.Capacity)
+        ImDrawListGrowBuffer(draw_list->_BufferPool, draw_list->IdxBuffer, draw_list->IdxBuffer._grow_capacity(draw_list->IdxBuffer.Size + new_idx_buffer_count));
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
-    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
+    // Leading commands matching the previous channel's last command are merged into it by skipping them, and IdxOffset values are fixed while copying.
+    ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawCmd* last_cmd = (draw_list->CmdBuffer.Size > 0) ? cmd_write - 1 : NULL;
+    unsigned int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
     for (int i = 1; i < _Count; i++)
     {
-        ImDrawChannel& ch = _Channels[i];
-        if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
+        ImDrawChannel& ch = _Channels.Data[i];
+        const ImDrawCmd* cmd_src = ch._CmdBuffer.Data;
+        const ImDrawCmd* cmd_src_end = ch._CmdBuffer.Data + ch._CmdBuffer.Size;
+        if (cmd_src < cmd_src_end && cmd_src_end[-1].ElemCount == 0 && cmd_src_end[-1].UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+            cmd_src_end--;
+
+        // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
+        // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
+        if (cmd_src < cmd_src_end && last_cmd != NULL && ImDrawCmd_HeaderCompare(last_cmd, cmd_src) == 0 && last_cmd->UserCallback == NULL && cmd_src->UserCallback == NULL)
+        {
+            // Merge previous channel last draw command with current channel first draw command if matching.
+            last_cmd->ElemCount += cmd_src->ElemCount;
+            idx_offset += cmd_src->ElemCount;
+            cmd_src++;
+        }
+        for (; cmd_src < cmd_src_end; cmd_src++)
+        {
+            *cmd_write = *cmd_src;
+            cmd_write->IdxOffset = idx_offset;
+            idx_offset += cmd_write->ElemCount;
+            last_cmd = cmd_write++;
+        }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
     }
+    draw_list->CmdBuffer.Size = (int)(cmd_write - draw_list->CmdBuffer.Data);
     draw_list->_IdxWritePtr = idx_write;
 
     // Ensure there's always a non-callback draw command trailing the command-buffer
@@ -1976,7 +2153,10 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
 ImFontAtlas::ImFontAtlas()
 {
     memset(this, 0, sizeof(*this));
+    TexMaxWidth = 4096;
+    TexMaxHeight = 1024 * 32;
     TexGlyphPadding = 1;
+    TexSdfSpread = 4;
     PackIdMouseCursors = PackIdLines = -1;
 }
 
@@ -1989,6 +2169,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicGlyphsDestroy(this); // Holds pointers to ConfigData[] and font data
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -2025,6 +2206,7 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicGlyphsDestroy(this);
     Fonts.clear_delete();
     TexReady = false;
 }
@@ -2075,7 +2257,7 @@ void    ImFontAtlas::GetTexDataAsRGBA32(unsigned char** out_pixels, int* out_wid
 ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
-    IM_ASSERT(font_cfg->FontData != NULL && font_cfg->FontDataSize > 0);
+    IM_ASSERT((font_cfg->FontData != NULL && font_cfg->FontDataSize > 0) || (font_cfg->FontDataCompressed != NULL && font_cfg->FontDataCompressedSize > 0));
     IM_ASSERT(font_cfg->SizePixels > 0.0f);
 
     // Create new font
@@ -2088,7 +2270,11 @@ ImFont* ImFontAtlas::AddFont(const ImFontConfig* font_cfg)
     ImFontConfig& new_font_cfg = ConfigData.back();
     if (new_font_cfg.DstFont == NULL)
         new_font_cfg.DstFont = Fonts.back();
-    if (!new_font_cfg.FontDataOwnedByAtlas)
+    if (new_font_cfg.FontData == NULL)
+    {
+        new_font_cfg.FontDataOwnedByAtlas = true; // Decompressed by Build()
+    }
+    else if (!new_font_cfg.FontDataOwnedByAtlas)
     {
         new_font_cfg.FontData = IM_ALLOC(new_font_cfg.FontDataSize);
         new_font_cfg.FontDataOwnedByAtlas = true;
@@ -2177,8 +2363,22 @@ ImFont* ImFontAtlas::AddFontFromMemoryTTF(void* ttf_data, int ttf_size, float si
     return AddFont(&font_cfg);
 }
 
+// NB: With font_cfg_template->DeferDecompression == true, 'compressed_ttf_data' is only referenced and decompressed by Build(),
+// so that fonts restored by LoadBuildCacheFromMemory() are never decompressed.
 ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_data, int compressed_ttf_size, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
+    if (font_cfg_template != NULL && font_cfg_template->DeferDecompression)
+    {
+        ImFontConfig font_cfg = *font_cfg_template;
+        IM_ASSERT(font_cfg.FontData == NULL);
+        font_cfg.FontDataCompressed = compressed_ttf_data;
+        font_cfg.FontDataCompressedSize = compressed_ttf_size;
+        font_cfg.SizePixels = size_pixels > 0.0f ? size_pixels : font_cfg.SizePixels;
+        if (glyph_ranges)
+            font_cfg.GlyphRanges = glyph_ranges;
+        return AddFont(&font_cfg);
+    }
+
     const unsigned int buf_decompressed_size = stb_decompress_length((const unsigned char*)compressed_ttf_data);
     unsigned char* buf_decompressed_data = (unsigned char*)IM_ALLOC(buf_decompressed_size);
     stb_decompress(buf_decompressed_data, (const unsigned char*)compressed_ttf_data, (unsigned int)compressed_ttf_size);
@@ -2189,12 +2389,14 @@ ImFont* ImFontAtlas::AddFontFromMemoryCompressedTTF(const void* compressed_ttf_d
     return AddFontFromMemoryTTF(buf_decompressed_data, (int)buf_decompressed_size, size_pixels, &font_cfg, glyph_ranges);
 }
 
-ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed_ttf_data_base85, float size_pixels, const ImFontConfig* font_cfg, const ImWchar* glyph_ranges)
+ImFont* ImFontAtlas::AddFontFromMemoryCompressedBase85TTF(const char* compressed_ttf_data_base85, float size_pixels, const ImFontConfig* font_cfg_template, const ImWchar* glyph_ranges)
 {
     int compressed_ttf_size = (((int)strlen(compressed_ttf_data_base85) + 4) / 5) * 4;
     void* compressed_ttf = IM_ALLOC((size_t)compressed_ttf_size);
     Decode85((const unsigned char*)compressed_ttf_data_base85, (unsigned char*)compressed_ttf);
-    ImFont* font = AddFontFromMemoryCompressedTTF(compressed_ttf, compressed_ttf_size, size_pixels, font_cfg, glyph_ranges);
+    ImFontConfig font_cfg = font_cfg_template ? *font_cfg_template : ImFontConfig();
+    font_cfg.DeferDecompression = false; // The decoded buffer is freed below: decompress now
+    ImFont* font = AddFontFromMemoryCompressedTTF(compressed_ttf, compressed_ttf_size, size_pixels, &font_cfg, glyph_ranges);
     IM_FREE(compressed_ttf);
     return font;
 }
@@ -2283,10 +2485,282 @@ bool    ImFontAtlas::Build()
 #endif
     }
 
+    // Decompress font data added with AddFontFromMemoryCompressedTTF() and DeferDecompression == true
+    for (int cfg_n = 0; cfg_n < ConfigData.Size; cfg_n++)
+    {
+        ImFontConfig& cfg = ConfigData[cfg_n];
+        if (cfg.FontData != NULL)
+            continue;
+        const unsigned char* compressed_data = (const unsigned char*)cfg.FontDataCompressed;
+        const unsigned int decompressed_size = stb_decompress_length(compressed_data);
+        cfg.FontData = IM_ALLOC(decompressed_size);
+        cfg.FontDataSize = (int)decompressed_size;
+        cfg.FontDataOwnedByAtlas = true;
+        if (stb_decompress((unsigned char*)cfg.FontData, compressed_data, (unsigned int)cfg.FontDataCompressedSize) != decompressed_size)
+        {
+            IM_ASSERT(0 && "FontDataCompressed is incorrect.");
+            IM_FREE(cfg.FontData);
+            cfg.FontData = NULL;
+            return false;
+        }
+    }
+
     // Build
+    ImFontAtlasDynamicGlyphsDestroy(this);
+    BuildTimeParse = BuildTimePack = BuildTimeRaster = BuildTimeFinish = 0.0f;
+    BuildPackedSurface = 0;
     return builder_io->FontBuilder_Build(this);
 }
 
+// Build cache layout: header, then atlas/custom rects/fonts output data, then Alpha8 pixels.
+// The key hashes every input of the build (font data, configs, atlas settings, custom rects) so that a stale cache is simply ignored.
+// It also covers IMGUI_VERSION_NUM and the size of the structures we copy verbatim, since the file is a raw dump of them.
+static const ImU32 FONT_ATLAS_BUILD_CACHE_MAGIC = 0x43464D49; // "IMFC"
+
+// 64-bit FNV-1a: ImHashData() is a 32-bit CRC, too short for a key whose collisions silently load the wrong atlas
+// (and CRCs of equal length inputs collide whatever the seed, so chaining two of them wouldn't help).
+static ImU64 ImFontAtlasBuildCacheHash(const void* data, size_t data_size, ImU64 hash)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    for (size_t n = 0; n < data_size; n++)
+        hash = (hash ^ p[n]) * 0x100000001B3ULL;
+    return hash;
+}
+
+static ImU64 ImFontAtlasBuildCacheCalcKey(ImFontAtlas* atlas)
+{
+    const int version = IMGUI_VERSION_NUM;
+    ImU64 key = ImFontAtlasBuildCacheHash(&version, sizeof(version), 0xCBF29CE484222325ULL);
+    key = ImFontAtlasBuildCacheHash(&atlas->Flags, sizeof(atlas->Flags), key);
+    const int layout_sizes[] = { (int)sizeof(ImWchar), (int)sizeof(ImFontGlyph), (int)sizeof(ImFontAtlasCustomRect) };
+    key = ImFontAtlasBuildCacheHash(layout_sizes, sizeof(layout_sizes), key);
+    key = ImFontAtlasBuildCacheHash(&atlas->TexDesiredWidth, sizeof(atlas->TexDesiredWidth), key);
+    key = ImFontAtlasBuildCacheHash(&atlas->TexMaxWidth, sizeof(atlas->TexMaxWidth), key);
+    key = ImFontAtlasBuildCacheHash(&atlas->TexMaxHeight, sizeof(atlas->TexMaxHeight), key);
+    key = ImFontAtlasBuildCacheHash(&atlas->TexGlyphPadding, sizeof(atlas->TexGlyphPadding), key);
+    key = ImFontAtlasBuildCacheHash(&atlas->TexSdfSpread, sizeof(atlas->TexSdfSpread), key);
+    key = ImFontAtlasBuildCacheHash(&atlas->FontBuilderFlags, sizeof(atlas->FontBuilderFlags), key);
+#ifdef IMGUI_ENABLE_FREETYPE
+    // Both builders output the same data layout, but not the same pixels and metrics.
+    const int builder_is_freetype = (atlas->FontBuilderIO == NULL || atlas->FontBuilderIO == ImGuiFreeType::GetBuilderForFreeType()) ? 1 : 0;
+    key = ImFontAtlasBuildCacheHash(&builder_is_freetype, sizeof(builder_is_freetype), key);
+#endif
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_n];
+        const int font_idx = r.Font ? atlas->Fonts.index_from_ptr(atlas->Fonts.find(r.Font)) : -1;
+        key = ImFontAtlasBuildCacheHash(&r.Width, sizeof(r.Width), key);
+        key = ImFontAtlasBuildCacheHash(&r.Height, sizeof(r.Height), key);
+        key = ImFontAtlasBuildCacheHash(&r.GlyphID, sizeof(r.GlyphID), key);
+        key = ImFontAtlasBuildCacheHash(&r.GlyphAdvanceX, sizeof(r.GlyphAdvanceX), key);
+        key = ImFontAtlasBuildCacheHash(&r.GlyphOffset, sizeof(r.GlyphOffset), key);
+        key = ImFontAtlasBuildCacheHash(&font_idx, sizeof(font_idx), key);
+    }
+    for (int cfg_n = 0; cfg_n < atlas->ConfigData.Size; cfg_n++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[cfg_n];
+        const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : atlas->GetGlyphRangesDefault();
+        int ranges_count = 0;
+        while (ranges[ranges_count] && ranges[ranges_count + 1])
+            ranges_count += 2;
+        const int dst_idx = atlas->Fonts.index_from_ptr(atlas->Fonts.find(cfg.DstFont));
+        if (cfg.FontDataCompressed != NULL)
+            key = ImFontAtlasBuildCacheHash(cfg.FontDataCompressed, (size_t)cfg.FontDataCompressedSize, key); // Don't decompress for the key
+        else
+            key = ImFontAtlasBuildCacheHash(cfg.FontData, (size_t)cfg.FontDataSize, key);
+        key = ImFontAtlasBuildCacheHash(ranges, ranges_count * sizeof(ImWchar), key);
+        key = ImFontAtlasBuildCacheHash(&dst_idx, sizeof(dst_idx), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.FontNo, sizeof(cfg.FontNo), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.SizePixels, sizeof(cfg.SizePixels), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.OversampleH, sizeof(cfg.OversampleH), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.OversampleV, sizeof(cfg.OversampleV), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.PixelSnapH, sizeof(cfg.PixelSnapH), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.GlyphExtraSpacing, sizeof(cfg.GlyphExtraSpacing), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.GlyphOffset, sizeof(cfg.GlyphOffset), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.GlyphMinAdvanceX, sizeof(cfg.GlyphMinAdvanceX), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.GlyphMaxAdvanceX, sizeof(cfg.GlyphMaxAdvanceX), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.MergeMode, sizeof(cfg.MergeMode), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.FontBuilderFlags, sizeof(cfg.FontBuilderFlags), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.RasterizerMultiply, sizeof(cfg.RasterizerMultiply), key);
+        key = ImFontAtlasBuildCacheHash(&cfg.EllipsisChar, sizeof(cfg.EllipsisChar), key);
+    }
+    return key;
+}
+
+static void ImFontAtlasBuildCacheWrite(ImVector<char>* buf, const void* data, size_t size)
+{
+    const int off = buf->Size;
+    buf->resize(off + (int)size);
+    memcpy(buf->Data + off, data, size);
+}
+
+static bool ImFontAtlasBuildCacheRead(const char** p, const char* p_end, void* out_data, size_t size)
+{
+    if ((size_t)(p_end - *p) < size)
+        return false;
+    memcpy(out_data, *p, size);
+    *p += size;
+    return true;
+}
+
+static bool ImFontAtlasBuildCacheSkip(const char** p, const char* p_end, size_t size)
+{
+    if ((size_t)(p_end - *p) < size)
+        return false;
+    *p += size;
+    return true;
+}
+
+void    ImFontAtlas::SaveBuildCacheToMemory(ImVector<char>* out_buf)
+{
+    out_buf->resize(0);
+    if (DynamicGlyphs != NULL)
+        return; // Not supported with dynamic glyphs: the texture content depends on the glyphs used so far
+    if (TexPixelsUseColors)
+        return; // Not supported with colored glyphs: only Alpha8 pixels are stored
+    IM_ASSERT(TexReady && TexPixelsAlpha8 != NULL && "Build cache requires a built Alpha8 atlas. Call SaveBuildCacheToMemory() before ClearTexData().");
+    const ImU64 key = ImFontAtlasBuildCacheCalcKey(this);
+    const ImU32 header[] = { FONT_ATLAS_BUILD_CACHE_MAGIC, (ImU32)key, (ImU32)(key >> 32), (ImU32)CustomRects.Size, (ImU32)Fonts.Size };
+    ImFontAtlasBuildCacheWrite(out_buf, header, sizeof(header));
+    ImFontAtlasBuildCacheWrite(out_buf, &TexWidth, sizeof(TexWidth));
+    ImFontAtlasBuildCacheWrite(out_buf, &TexHeight, sizeof(TexHeight));
+    ImFontAtlasBuildCacheWrite(out_buf, &TexUvWhitePixel, sizeof(TexUvWhitePixel));
+    ImFontAtlasBuildCacheWrite(out_buf, TexUvLines, sizeof(TexUvLines));
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        const ImFontAtlasCustomRect& r = CustomRects[rect_n];
+        ImFontAtlasBuildCacheWrite(out_buf, &r.X, sizeof(r.X));
+        ImFontAtlasBuildCacheWrite(out_buf, &r.Y, sizeof(r.Y));
+    }
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        const ImFont* font = Fonts[font_n];
+        ImFontAtlasBuildCacheWrite(out_buf, &font->FontSize, sizeof(font->FontSize));
+        ImFontAtlasBuildCacheWrite(out_buf, &font->Ascent, sizeof(font->Ascent));
+        ImFontAtlasBuildCacheWrite(out_buf, &font->Descent, sizeof(font->Descent));
+        ImFontAtlasBuildCacheWrite(out_buf, &font->MetricsTotalSurface, sizeof(font->MetricsTotalSurface));
+        const int config_data_count = font->ConfigDataCount;
+        ImFontAtlasBuildCacheWrite(out_buf, &config_data_count, sizeof(config_data_count));
+        ImFontAtlasBuildCacheWrite(out_buf, &font->Glyphs.Size, sizeof(font->Glyphs.Size));
+        ImFontAtlasBuildCacheWrite(out_buf, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+    }
+    ImFontAtlasBuildCacheWrite(out_buf, TexPixelsAlpha8, (size_t)TexWidth * TexHeight);
+}
+
+bool    ImFontAtlas::SaveBuildCacheToDisk(const char* filename)
+{
+    ImVector<char> buf;
+    SaveBuildCacheToMemory(&buf);
+    if (buf.Size == 0)
+        return false;
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    const bool ret = ImFileWrite(buf.Data, 1, (ImU64)buf.Size, f) == (ImU64)buf.Size;
+    ImFileClose(f);
+    return ret;
+}
+
+bool    ImFontAtlas::LoadBuildCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    if (ConfigData.Size == 0)
+        return false;
+    for (int cfg_n = 0; cfg_n < ConfigData.Size; cfg_n++)
+        if (ConfigData[cfg_n].GlyphRangesDynamic != NULL)
+            return false; // Dynamic glyphs need the stb_truetype builder to run
+
+    // Custom rects for mouse cursors/lines are registered by the builder: register them now so they are part of the key.
+    ImFontAtlasBuildInit(this);
+
+    const char* p = (const char*)data;
+    const char* p_end = p + data_size;
+    ImU32 header[5];
+    if (!ImFontAtlasBuildCacheRead(&p, p_end, header, sizeof(header)))
+        return false;
+    const ImU64 key = ImFontAtlasBuildCacheCalcKey(this);
+    if (header[0] != FONT_ATLAS_BUILD_CACHE_MAGIC || header[1] != (ImU32)key || header[2] != (ImU32)(key >> 32) || header[3] != (ImU32)CustomRects.Size || header[4] != (ImU32)Fonts.Size)
+        return false;
+
+    // Validate the whole file before touching the atlas
+    int tex_width = 0, tex_height = 0;
+    ImVec2 tex_uv_white_pixel;
+    ImVec4 tex_uv_lines[IM_ARRAYSIZE(TexUvLines)];
+    if (!ImFontAtlasBuildCacheRead(&p, p_end, &tex_width, sizeof(tex_width)) || !ImFontAtlasBuildCacheRead(&p, p_end, &tex_height, sizeof(tex_height)))
+        return false;
+    if (!ImFontAtlasBuildCacheRead(&p, p_end, &tex_uv_white_pixel, sizeof(tex_uv_white_pixel)) || !ImFontAtlasBuildCacheRead(&p, p_end, tex_uv_lines, sizeof(tex_uv_lines)))
+        return false;
+    const char* rects_data = p;
+    if (!ImFontAtlasBuildCacheSkip(&p, p_end, (size_t)CustomRects.Size * (sizeof(unsigned short) * 2)))
+        return false;
+    const char* fonts_data = p;
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        int glyphs_count = 0;
+        if (!ImFontAtlasBuildCacheSkip(&p, p_end, sizeof(float) * 3 + sizeof(int) * 2))
+            return false;
+        if (!ImFontAtlasBuildCacheRead(&p, p_end, &glyphs_count, sizeof(glyphs_count)) || glyphs_count < 0)
+            return false;
+        if ((size_t)glyphs_count > (size_t)(p_end - p) / sizeof(ImFontGlyph) || !ImFontAtlasBuildCacheSkip(&p, p_end, (size_t)glyphs_count * sizeof(ImFontGlyph)))
+            return false;
+    }
+    if (tex_width <= 0 || tex_height <= 0 || (size_t)(p_end - p) != (size_t)tex_width * tex_height)
+        return false;
+    const char* pixels_data = p;
+
+    // Restore atlas
+    ImFontAtlasDynamicGlyphsDestroy(this);
+    ClearTexData();
+    TexID = (ImTextureID)NULL;
+    TexWidth = tex_width;
+    TexHeight = tex_height;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = tex_uv_white_pixel;
+    memcpy(TexUvLines, tex_uv_lines, sizeof(TexUvLines));
+    p = rects_data;
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        ImFontAtlasCustomRect& r = CustomRects[rect_n];
+        ImFontAtlasBuildCacheRead(&p, p_end, &r.X, sizeof(r.X));
+        ImFontAtlasBuildCacheRead(&p, p_end, &r.Y, sizeof(r.Y));
+    }
+    TexPixelsAlpha8 = (unsigned char*)IM_ALLOC((size_t)TexWidth * TexHeight);
+    memcpy(TexPixelsAlpha8, pixels_data, (size_t)TexWidth * TexHeight);
+
+    // Restore fonts (same steps as the builder, minus rasterization: the cached glyphs already include custom rect glyphs)
+    for (int cfg_n = 0; cfg_n < ConfigData.Size; cfg_n++)
+        ImFontAtlasBuildSetupFont(this, ConfigData[cfg_n].DstFont, &ConfigData[cfg_n], 0.0f, 0.0f);
+    p = fonts_data;
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        ImFont* font = Fonts[font_n];
+        int glyphs_count = 0, config_data_count = 0;
+        ImFontAtlasBuildCacheRead(&p, p_end, &font->FontSize, sizeof(font->FontSize));
+        ImFontAtlasBuildCacheRead(&p, p_end, &font->Ascent, sizeof(font->Ascent));
+        ImFontAtlasBuildCacheRead(&p, p_end, &font->Descent, sizeof(font->Descent));
+        ImFontAtlasBuildCacheRead(&p, p_end, &font->MetricsTotalSurface, sizeof(font->MetricsTotalSurface));
+        ImFontAtlasBuildCacheRead(&p, p_end, &config_data_count, sizeof(config_data_count));
+        ImFontAtlasBuildCacheRead(&p, p_end, &glyphs_count, sizeof(glyphs_count));
+        font->ConfigDataCount = (short)config_data_count; // Merged sources that added no glyph are skipped by the builder
+        font->Glyphs.resize(glyphs_count);
+        ImFontAtlasBuildCacheRead(&p, p_end, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        font->BuildLookupTable();
+    }
+    TexReady = true;
+    return true;
+}
+
+bool    ImFontAtlas::LoadBuildCacheFromDisk(const char* filename)
+{
+    size_t data_size = 0;
+    void* data = ImFileLoadToMemory(filename, "rb", &data_size);
+    if (!data)
+        return false;
+    const bool ret = LoadBuildCacheFromMemory(data, data_size);
+    IM_FREE(data);
+    return ret;
+}
+
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
 {
     for (unsigned int i = 0; i < 256; i++)
@@ -2330,6 +2804,26 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+// A batch of consecutive glyphs of one source font to rasterize (any thread, any order: every glyph owns its packed rectangle)
+struct ImFontBuildRasterJob
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[] and src_tmp_array[]
+    int                 GlyphsStart;        // First glyph of the batch in src_tmp.GlyphsList[]
+    int                 GlyphsCount;
+};
+
+struct ImFontBuildRasterContext
+{
+    ImFontAtlas*                Atlas;
+    const stbtt_pack_context*   PackContext;
+    ImFontBuildSrcData*         SrcTmp;
+    const ImFontBuildRasterJob* Jobs;
+    int                         JobsCount;
+#ifndef IMGUI_DISABLE_FONT_ATLAS_BUILD_THREADS
+    std::atomic<int>            JobsNext;   // Next job to pick by any thread
+#endif
+};
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2342,9 +2836,100 @@ static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>*
                     out->push_back((int)(((it - it_begin) << 5) + bit_n));
 }
 
+// Render the signed distance field of a glyph with its top-left corner at (x, y) in TexPixelsAlpha8.
+// It covers the glyph bitmap box (as returned by stbtt_GetGlyphBitmapBox) grown by TexSdfSpread on each side. Nothing is written for empty glyphs.
+static void ImFontAtlasBuildRenderGlyphSdf(ImFontAtlas* atlas, const stbtt_fontinfo* info, float scale, int glyph_index_in_font, int x, int y)
+{
+    int w, h, off_x, off_y;
+    unsigned char* sdf = stbtt_GetGlyphSDF(info, scale, glyph_index_in_font, atlas->TexSdfSpread, 128, 127.0f / atlas->TexSdfSpread, &w, &h, &off_x, &off_y);
+    if (sdf == NULL)
+        return;
+    for (int row = 0; row < h; row++)
+        memcpy(atlas->TexPixelsAlpha8 + x + (y + row) * atlas->TexWidth, sdf + row * w, (size_t)w);
+    stbtt_FreeSDF(sdf, NULL);
+}
+
+static void ImFontAtlasBuildRasterJob(ImFontBuildRasterContext* ctx, const ImFontBuildRasterJob& job)
+{
+    ImFontAtlas* atlas = ctx->Atlas;
+    ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    ImFontBuildSrcData& src_tmp = ctx->SrcTmp[job.SrcIndex];
+
+    // Signed distance fields: fill the packed chars the way stbtt_PackFontRangesRenderIntoRects() would (without oversampling)
+    if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+    {
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
+        const int spread = atlas->TexSdfSpread;
+        for (int glyph_i = job.GlyphsStart; glyph_i < job.GlyphsStart + job.GlyphsCount; glyph_i++)
+        {
+            const stbrp_rect& r = src_tmp.Rects[glyph_i];
+            stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
+            if (!r.was_packed)
+                continue;
+            const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
+            int advance, lsb, x0, y0, x1, y1;
+            stbtt_GetGlyphHMetrics(&src_tmp.FontInfo, glyph_index_in_font, &advance, &lsb);
+            stbtt_GetGlyphBitmapBox(&src_tmp.FontInfo, glyph_index_in_font, scale, scale, &x0, &y0, &x1, &y1);
+            const int w = (x0 < x1 && y0 < y1) ? x1 - x0 + spread * 2 : 0;
+            const int h = (x0 < x1 && y0 < y1) ? y1 - y0 + spread * 2 : 0;
+            ImFontAtlasBuildRenderGlyphSdf(atlas, &src_tmp.FontInfo, scale, glyph_index_in_font, r.x, r.y);
+            pc.x0 = (unsigned short)r.x;
+            pc.y0 = (unsigned short)r.y;
+            pc.x1 = (unsigned short)(r.x + w);
+            pc.y1 = (unsigned short)(r.y + h);
+            pc.xoff = (float)(x0 - spread);
+            pc.yoff = (float)(y0 - spread);
+            pc.xoff2 = pc.xoff + w;
+            pc.yoff2 = pc.yoff + h;
+            pc.xadvance = scale * advance;
+        }
+        return;
+    }
+
+    // stbtt_PackFontRangesRenderIntoRects() temporarily writes oversampling settings into the pack context, so each job works on a copy.
+    stbtt_pack_context spc = *ctx->PackContext;
+    stbtt_pack_range range = src_tmp.PackRange;
+    range.array_of_unicode_codepoints = src_tmp.GlyphsList.Data + job.GlyphsStart;
+    range.num_chars = job.GlyphsCount;
+    range.chardata_for_range = src_tmp.PackedChars + job.GlyphsStart;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphsStart;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        stbrp_rect* r = rects;
+        for (int glyph_i = 0; glyph_i < job.GlyphsCount; glyph_i++, r++)
+            if (r->was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+    }
+}
+
+#ifndef IMGUI_DISABLE_FONT_ATLAS_BUILD_THREADS
+static void ImFontAtlasBuildRasterWorker(ImFontBuildRasterContext* ctx)
+{
+    for (int job_n = ctx->JobsNext++; job_n < ctx->JobsCount; job_n = ctx->JobsNext++)
+        ImFontAtlasBuildRasterJob(ctx, ctx->Jobs[job_n]);
+}
+#endif
+
+static void ImFontAtlasDynamicGlyphsInit(ImFontAtlas* atlas, const ImFontBuildSrcData* src_tmp_array, int area_y);
+
+// Lap timer for ImFontAtlas::BuildTimeXXX: return milliseconds elapsed since the previous call and restart.
+static float ImFontAtlasBuildLapTime(std::chrono::steady_clock::time_point* time)
+{
+    const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    const float ms = std::chrono::duration<float, std::milli>(now - *time).count();
+    *time = now;
+    return ms;
+}
+
 static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
+    std::chrono::steady_clock::time_point time = std::chrono::steady_clock::now();
 
     ImFontAtlasBuildInit(atlas);
 
@@ -2434,6 +3019,7 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     for (int dst_i = 0; dst_i < dst_tmp_array.Size; dst_i++)
         dst_tmp_array[dst_i].GlyphsSet.Clear();
     dst_tmp_array.clear();
+    atlas->BuildTimeParse = ImFontAtlasBuildLapTime(&time);
 
     // Allocate packing character data and flag packed characters buffer as non-packed (x0=y0=x1=y1=0)
     // (We technically don't need to zero-clear buf_rects, but let's do it for the sake of sanity)
@@ -2445,7 +3031,6 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     memset(buf_packedchars.Data, 0, (size_t)buf_packedchars.size_in_bytes());
 
     // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
-    int total_surface = 0;
     int buf_rects_out_n = 0;
     int buf_packedchars_out_n = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2470,87 +3055,87 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+        // Signed distance fields are not oversampled, but extend by TexSdfSpread around non-empty glyphs.
         const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
         const int padding = atlas->TexGlyphPadding;
+        const bool sdf = (atlas->Flags & ImFontAtlasFlags_SignedDistanceField) != 0;
+        const int oversample_h = sdf ? 1 : cfg.OversampleH;
+        const int oversample_v = sdf ? 1 : cfg.OversampleV;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
+            const int sdf_spread = (sdf && x0 < x1 && y0 < y1) ? atlas->TexSdfSpread : 0;
+            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + sdf_spread * 2 + padding + oversample_h - 1);
+            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + sdf_spread * 2 + padding + oversample_v - 1);
         }
     }
 
-    // We need a width for the skyline algorithm, any width!
-    // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
-    // User can override TexDesiredWidth and TexGlyphPadding if they wish, otherwise we use a simple heuristic to select the width based on expected surface.
-    const int surface_sqrt = (int)ImSqrt((float)total_surface) + 1;
-    atlas->TexHeight = 0;
-    if (atlas->TexDesiredWidth > 0)
-        atlas->TexWidth = atlas->TexDesiredWidth;
-    else
-        atlas->TexWidth = (surface_sqrt >= 4096 * 0.7f) ? 4096 : (surface_sqrt >= 2048 * 0.7f) ? 2048 : (surface_sqrt >= 1024 * 0.7f) ? 1024 : 512;
-
-    // 5. Start packing
-    // Pack our extra data rectangles first, so it will be on the upper-left corner of our texture (UV will have small values).
-    const int TEX_HEIGHT_MAX = 1024 * 32;
-    stbtt_pack_context spc = {};
-    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, TEX_HEIGHT_MAX, 0, atlas->TexGlyphPadding, NULL);
-    ImFontAtlasBuildPackCustomRects(atlas, spc.pack_info);
-
-    // 6. Pack each source font. No rendering yet, we are working with rectangles in an infinitely tall texture at this point.
-    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbrp_pack_rects((stbrp_context*)spc.pack_info, src_tmp.Rects, src_tmp.GlyphsCount);
-
-        // Extend texture height and mark missing glyphs as non-packed so we won't render them.
-        // FIXME: We are not handling packing failure here (would happen if we got off TEX_HEIGHT_MAX or if a single if larger than TexWidth?)
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
-            if (src_tmp.Rects[glyph_i].was_packed)
-                atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
-    }
+    // 5-6. Select the texture size and pack the custom rects and the glyphs of all sources. No rendering yet.
+    // User can override TexDesiredWidth, TexMaxWidth and TexGlyphPadding if they wish, otherwise we keep the width giving the smallest texture.
+    // Glyphs from ImFontConfig::GlyphRangesDynamic are rasterized on first use into rows reserved below the packed glyphs.
+    bool dynamic_glyphs = false;
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+        dynamic_glyphs |= (atlas->ConfigData[src_i].GlyphRangesDynamic != NULL);
+    const int dynamic_area_y = ImFontAtlasBuildPackRects(atlas, buf_rects.Data, buf_rects.Size);
 
     // 7. Allocate texture
-    atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
+    stbtt_pack_context spc = {};
+    stbtt_PackBegin(&spc, NULL, atlas->TexWidth, atlas->TexHeight, 0, atlas->TexGlyphPadding, NULL);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
     memset(atlas->TexPixelsAlpha8, 0, atlas->TexWidth * atlas->TexHeight);
     spc.pixels = atlas->TexPixelsAlpha8;
-    spc.height = atlas->TexHeight;
+    atlas->BuildTimePack = ImFontAtlasBuildLapTime(&time);
 
     // 8. Render/rasterize font characters into the texture
+    // Glyphs are split in fixed size batches. Each glyph only writes into its own packed rectangle,
+    // so batches can be rasterized by several threads in any order and still produce the exact same texture.
+    const int RASTER_BATCH_GLYPHS = 64;
+    ImVector<ImFontBuildRasterJob> raster_jobs;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += RASTER_BATCH_GLYPHS)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRasterJob job;
+            job.SrcIndex = src_i;
+            job.GlyphsStart = glyph_i;
+            job.GlyphsCount = ImMin(RASTER_BATCH_GLYPHS, src_tmp_array[src_i].GlyphsCount - glyph_i);
+            raster_jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
+
+    ImFontBuildRasterContext raster_ctx;
+    raster_ctx.Atlas = atlas;
+    raster_ctx.PackContext = &spc;
+    raster_ctx.SrcTmp = src_tmp_array.Data;
+    raster_ctx.Jobs = raster_jobs.Data;
+    raster_ctx.JobsCount = raster_jobs.Size;
+#ifndef IMGUI_DISABLE_FONT_ATLAS_BUILD_THREADS
+    const int THREADS_MAX = 16;
+    int threads_count = (atlas->BuildThreadsCount > 0) ? atlas->BuildThreadsCount : (int)std::thread::hardware_concurrency();
+    threads_count = ImClamp(ImMin(threads_count, raster_jobs.Size), 1, THREADS_MAX);
+    raster_ctx.JobsNext = 0;
+    std::thread threads[THREADS_MAX - 1];
+    int threads_started = 0;
+    for (; threads_started < threads_count - 1; threads_started++)
+    {
+        // Workers pull jobs from a shared counter: when a thread can't be started, the ones already running and the calling thread take over its jobs.
+        try { threads[threads_started] = std::thread(ImFontAtlasBuildRasterWorker, &raster_ctx); }
+        catch (const std::system_error&) { break; }
     }
+    ImFontAtlasBuildRasterWorker(&raster_ctx); // The calling thread takes its share of the jobs
+    for (int thread_n = 0; thread_n < threads_started; thread_n++)
+        threads[thread_n].join();
+#else
+    for (int job_n = 0; job_n < raster_ctx.JobsCount; job_n++)
+        ImFontAtlasBuildRasterJob(&raster_ctx, raster_jobs[job_n]);
+#endif
+    raster_jobs.clear();
 
     // End packing
     stbtt_PackEnd(&spc);
-    buf_rects.clear();
+    atlas->BuildTimeRaster = ImFontAtlasBuildLapTime(&time);
 
     // 9. Setup ImFont and glyphs for runtime
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
@@ -2577,7 +3162,9 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
         {
-            // Register glyph
+            // Register glyph (glyphs which didn't fit in the texture are left out)
+            if (!src_tmp.Rects[glyph_i].was_packed)
+                continue;
             const int codepoint = src_tmp.GlyphsList[glyph_i];
             const stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
             stbtt_aligned_quad q;
@@ -2587,10 +3174,17 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
     }
 
+    if (dynamic_glyphs)
+        ImFontAtlasDynamicGlyphsInit(atlas, src_tmp_array.Data, dynamic_area_y);
+
     // Cleanup
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
+    buf_rects.clear();
     src_tmp_array.clear_destruct();
 
     ImFontAtlasBuildFinish(atlas);
+    atlas->BuildTimeFinish = ImFontAtlasBuildLapTime(&time);
     return true;
 }
 
@@ -2601,6 +3195,326 @@ const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
     return &io;
 }
 
+// Dynamic glyphs
+// Codepoints of ImFontConfig::GlyphRangesDynamic which are not in GlyphRanges are left out by Build(). Their IndexAdvanceX[]
+// entry holds a negative value instead, so that FindGlyph() rasterizes them on first use below the packed glyphs.
+// - The dynamic area is split in rows as tall as the bounding box of the source font they belong to.
+// - Each glyph gets a slot as wide as itself. Slots are never freed, only handed over to another glyph of the same source.
+// - Once no row has room left, the least recently used slot wide enough is evicted. Glyphs returned by FindGlyph()
+//   during the current frame are never evicted, as vertices using their UV may already have been emitted.
+// - Glyphs[] capacity is reserved up-front and slots reuse their glyph index, so ImFontGlyph pointers stay valid.
+struct ImFontDynamicSrc
+{
+    ImFontConfig*       Config;             // Pointer within atlas->ConfigData[]
+    stbtt_fontinfo      FontInfo;
+    float               Scale;
+    int                 RowHeight;          // Bounding box height of the font (oversampling and padding included)
+    int                 MinSlotWidth;       // Bound the number of slots, and therefore the Glyphs[] capacity to reserve
+    int                 RowX, RowY;         // Insertion point in the current row of this source (RowY == -1 before the first row)
+};
+
+struct ImFontDynamicSlot
+{
+    int                 SrcIndex;           // Index into Sources[]
+    int                 X, Y, Width;        // Width includes padding
+    int                 GlyphIndex;         // Index into Sources[SrcIndex].Config->DstFont->Glyphs[]
+    int                 LastUsedFrame;
+};
+
+struct ImFontAtlasDynamicGlyphs
+{
+    ImVector<ImFontDynamicSrc>  Sources;
+    ImVector<ImFontDynamicSlot> Slots;
+    int                 AreaY;              // First texture row owned by dynamic glyphs
+    int                 NextRowY;
+    int                 Frame;              // Incremented by ImFontAtlasDynamicGlyphsNewFrame()
+    int                 DirtyX0, DirtyY0, DirtyX1, DirtyY1; // Texture area to upload, empty when DirtyX0 >= DirtyX1
+};
+
+static bool ImFontDynamicGlyphIsUsed(const ImFont* font, int glyph_index)
+{
+    return (font->GlyphsUsedBits.Data[glyph_index >> 5] & ((ImU32)1 << (glyph_index & 31))) != 0;
+}
+
+static void ImFontAtlasDynamicGlyphsInit(ImFontAtlas* atlas, const ImFontBuildSrcData* src_tmp_array, int area_y)
+{
+    ImFontAtlasDynamicGlyphs* dyn = IM_NEW(ImFontAtlasDynamicGlyphs)();
+    dyn->AreaY = dyn->NextRowY = area_y;
+    dyn->Frame = 0;
+    dyn->DirtyX0 = dyn->DirtyY0 = INT_MAX;
+    dyn->DirtyX1 = dyn->DirtyY1 = 0;
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        ImFontConfig& cfg = atlas->ConfigData[src_i];
+        if (cfg.GlyphRangesDynamic == NULL)
+            continue;
+        ImFontDynamicSrc src;
+        src.Config = &cfg;
+        src.FontInfo = src_tmp_array[src_i].FontInfo;
+        src.Scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src.FontInfo, -cfg.SizePixels);
+        int x0, y0, x1, y1;
+        stbtt_GetFontBoundingBox(&src.FontInfo, &x0, &y0, &x1, &y1);
+        if (atlas->Flags & ImFontAtlasFlags_SignedDistanceField)
+            src.RowHeight = (int)ImCeil((y1 - y0) * src.Scale) + 2 + atlas->TexSdfSpread * 2 + atlas->TexGlyphPadding;
+        else
+            src.RowHeight = (int)ImCeil((y1 - y0) * src.Scale * cfg.OversampleV) + 2 + cfg.OversampleV - 1 + atlas->TexGlyphPadding; // +2: glyph boxes are rounded outward
+        src.MinSlotWidth = ImMax(src.RowHeight / 4, atlas->TexGlyphPadding + 1);
+        src.RowX = 0;
+        src.RowY = -1;
+        dyn->Sources.push_back(src);
+    }
+    atlas->DynamicGlyphs = dyn;
+}
+
+void ImFontAtlasDynamicGlyphsDestroy(ImFontAtlas* atlas)
+{
+    if (atlas->DynamicGlyphs == NULL)
+        return;
+    IM_DELETE(atlas->DynamicGlyphs);
+    atlas->DynamicGlyphs = NULL;
+}
+
+// Called by ImGui::NewFrame(): record which glyphs were used by the previous frame, and unprotect them from eviction.
+void ImFontAtlasDynamicGlyphsNewFrame(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    if (dyn == NULL)
+        return;
+    for (int slot_n = 0; slot_n < dyn->Slots.Size; slot_n++)
+    {
+        ImFontDynamicSlot& slot = dyn->Slots[slot_n];
+        if (ImFontDynamicGlyphIsUsed(dyn->Sources[slot.SrcIndex].Config->DstFont, slot.GlyphIndex))
+            slot.LastUsedFrame = dyn->Frame;
+    }
+    for (int src_n = 0; src_n < dyn->Sources.Size; src_n++)
+    {
+        ImVector<ImU32>& used_bits = dyn->Sources[src_n].Config->DstFont->GlyphsUsedBits;
+        if (used_bits.Size > 0)
+            memset(used_bits.Data, 0, (size_t)used_bits.size_in_bytes());
+    }
+    dyn->Frame++;
+}
+
+// Called at the end of ImFont::BuildLookupTable(): mark dynamic codepoints as not rasterized yet.
+void ImFontAtlasDynamicGlyphsSetupLookup(ImFont* font)
+{
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    const int old_index_size = font->IndexLookup.Size;
+    int slots_max = 0;
+    for (int src_n = 0; src_n < dyn->Sources.Size; src_n++)
+    {
+        const ImFontDynamicSrc& src = dyn->Sources[src_n];
+        if (src.Config->DstFont != font)
+            continue;
+        for (const ImWchar* src_range = src.Config->GlyphRangesDynamic; src_range[0] && src_range[1]; src_range += 2)
+            font->GrowIndex((int)src_range[1] + 1);
+        slots_max += ((atlas->TexHeight - dyn->AreaY) / src.RowHeight) * (atlas->TexWidth / src.MinSlotWidth);
+    }
+    if (slots_max == 0)
+        return;
+    for (int i = old_index_size; i < font->IndexAdvanceX.Size; i++)
+        font->IndexAdvanceX[i] = font->FallbackAdvanceX;
+    for (int src_n = 0; src_n < dyn->Sources.Size; src_n++)
+        if (dyn->Sources[src_n].Config->DstFont == font)
+            for (const ImWchar* src_range = dyn->Sources[src_n].Config->GlyphRangesDynamic; src_range[0] && src_range[1]; src_range += 2)
+                for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
+                    if (font->IndexLookup[codepoint] == (ImWchar)-1)
+                        font->IndexAdvanceX[codepoint] = -1.0f;
+
+    // Reserve Glyphs[] for every slot this font may own (+1 for AddGlyph() appending before we move the glyph into its slot).
+    const int fallback_glyph_index = font->Glyphs.index_from_ptr(font->FallbackGlyph);
+    font->Glyphs.reserve(ImMin(font->Glyphs.Size + slots_max + 1, 0xFFFE)); // -1 is reserved in IndexLookup[]
+    font->FallbackGlyph = &font->Glyphs[fallback_glyph_index];
+    font->GlyphsUsedBits.resize((font->Glyphs.Capacity + 31) >> 5);
+    memset(font->GlyphsUsedBits.Data, 0, (size_t)font->GlyphsUsedBits.size_in_bytes());
+}
+
+static ImFontDynamicSlot* ImFontAtlasDynamicGlyphsAllocSlot(ImFontAtlas* atlas, int src_n, int width)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    ImFontDynamicSrc& src = dyn->Sources[src_n];
+    ImFont* font = src.Config->DstFont;
+
+    // Append to the current row of this source, opening a new row if needed
+    if (font->Glyphs.Size + 1 < font->Glyphs.Capacity && width <= atlas->TexWidth)
+    {
+        if ((src.RowY < 0 || src.RowX + width > atlas->TexWidth) && dyn->NextRowY + src.RowHeight <= atlas->TexHeight)
+        {
+            src.RowX = 0;
+            src.RowY = dyn->NextRowY;
+            dyn->NextRowY += src.RowHeight;
+        }
+        if (src.RowY >= 0 && src.RowX + width <= atlas->TexWidth)
+        {
+            ImFontDynamicSlot slot;
+            slot.SrcIndex = src_n;
+            slot.X = src.RowX;
+            slot.Y = src.RowY;
+            slot.Width = width;
+            slot.GlyphIndex = -1;
+            slot.LastUsedFrame = dyn->Frame;
+            src.RowX += width;
+            dyn->Slots.push_back(slot);
+            return &dyn->Slots.back();
+        }
+    }
+
+    // Evict the least recently used glyph of this source which is wide enough and not used by the current frame
+    ImFontDynamicSlot* lru_slot = NULL;
+    for (int slot_n = 0; slot_n < dyn->Slots.Size; slot_n++)
+    {
+        ImFontDynamicSlot& slot = dyn->Slots[slot_n];
+        if (slot.SrcIndex == src_n && slot.Width >= width && !ImFontDynamicGlyphIsUsed(font, slot.GlyphIndex))
+            if (lru_slot == NULL || slot.LastUsedFrame < lru_slot->LastUsedFrame)
+                lru_slot = &slot;
+    }
+    return lru_slot;
+}
+
+// Called by FindGlyph() for a codepoint with a negative IndexAdvanceX[]. Return FallbackGlyph if the glyph cannot be rasterized now.
+const ImFontGlyph* ImFontAtlasDynamicGlyphsLoad(ImFont* font, ImWchar c)
+{
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasDynamicGlyphs* dyn = atlas ? atlas->DynamicGlyphs : NULL;
+    IM_ASSERT((int)c < font->IndexAdvanceX.Size && font->IndexLookup[c] == (ImWchar)-1);
+
+    // Find the first source providing this codepoint
+    ImFontDynamicSrc* src = NULL;
+    int glyph_index_in_font = 0;
+    for (int src_n = 0; dyn != NULL && src_n < dyn->Sources.Size && src == NULL; src_n++)
+    {
+        ImFontDynamicSrc& candidate_src = dyn->Sources[src_n];
+        if (candidate_src.Config->DstFont != font)
+            continue;
+        for (const ImWchar* src_range = candidate_src.Config->GlyphRangesDynamic; src_range[0] && src_range[1] && src == NULL; src_range += 2)
+            if (c >= src_range[0] && c <= src_range[1] && (glyph_index_in_font = stbtt_FindGlyphIndex(&candidate_src.FontInfo, c)) != 0)
+                src = &candidate_src;
+    }
+    if (src == NULL || font->GlyphsUsedBits.Size == 0)
+    {
+        font->IndexAdvanceX[c] = font->FallbackAdvanceX; // Not provided by any source: don't look it up again
+        return font->FallbackGlyph;
+    }
+    IM_ASSERT(atlas->TexPixelsAlpha8 != NULL && "Dynamic glyphs are rasterized into the texture data: don't call ClearTexData()!");
+    if (atlas->TexPixelsAlpha8 == NULL)
+        return font->FallbackGlyph;
+
+    const ImFontConfig& cfg = *src->Config;
+    const int pad = atlas->TexGlyphPadding;
+    const bool sdf = (atlas->Flags & ImFontAtlasFlags_SignedDistanceField) != 0;
+    const int oversample_h = sdf ? 1 : cfg.OversampleH;
+    const int oversample_v = sdf ? 1 : cfg.OversampleV;
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBox(&src->FontInfo, glyph_index_in_font, src->Scale * oversample_h, src->Scale * oversample_v, &x0, &y0, &x1, &y1);
+    if (sdf && x0 < x1 && y0 < y1)
+    {
+        x0 -= atlas->TexSdfSpread;
+        y0 -= atlas->TexSdfSpread;
+        x1 += atlas->TexSdfSpread;
+        y1 += atlas->TexSdfSpread;
+    }
+    const int w = x1 - x0 + oversample_h - 1;
+    const int h = y1 - y0 + oversample_v - 1;
+    if (h + pad > src->RowHeight)
+    {
+        font->IndexAdvanceX[c] = font->FallbackAdvanceX; // Glyph outside of the font bounding box
+        return font->FallbackGlyph;
+    }
+    ImFontDynamicSlot* slot = ImFontAtlasDynamicGlyphsAllocSlot(atlas, dyn->Sources.index_from_ptr(src), ImMax(w + pad, src->MinSlotWidth));
+    if (slot == NULL)
+        return font->FallbackGlyph; // Every slot is used by the current frame: retry on a later call
+
+    // Evict previous glyph
+    if (slot->GlyphIndex >= 0)
+    {
+        const unsigned int evicted_codepoint = font->Glyphs[slot->GlyphIndex].Codepoint;
+        font->IndexLookup[evicted_codepoint] = (ImWchar)-1;
+        font->IndexAdvanceX[evicted_codepoint] = -1.0f;
+    }
+
+    // Rasterize (same steps as stbtt_PackFontRangesRenderIntoRects(), glyph placed after padding on left and top)
+    for (int y = 0; y < src->RowHeight; y++)
+        memset(atlas->TexPixelsAlpha8 + slot->X + (slot->Y + y) * atlas->TexWidth, 0, (size_t)slot->Width);
+    const int tex_x = slot->X + pad;
+    const int tex_y = slot->Y + pad;
+    float sub_x = 0.0f, sub_y = 0.0f;
+    if (sdf)
+        ImFontAtlasBuildRenderGlyphSdf(atlas, &src->FontInfo, src->Scale, glyph_index_in_font, tex_x, tex_y);
+    else
+        stbtt_MakeGlyphBitmapSubpixelPrefilter(&src->FontInfo, atlas->TexPixelsAlpha8 + tex_x + tex_y * atlas->TexWidth, w, h, atlas->TexWidth,
+            src->Scale * cfg.OversampleH, src->Scale * cfg.OversampleV, 0.0f, 0.0f, cfg.OversampleH, cfg.OversampleV, &sub_x, &sub_y, glyph_index_in_font);
+    if (cfg.RasterizerMultiply != 1.0f && !sdf)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, tex_x, tex_y, w, h, atlas->TexWidth * 1);
+    }
+    if (atlas->TexPixelsRGBA32 != NULL)
+        for (int y = 0; y < src->RowHeight; y++)
+        {
+            const unsigned char* src_pixels = atlas->TexPixelsAlpha8 + slot->X + (slot->Y + y) * atlas->TexWidth;
+            unsigned int* dst_pixels = atlas->TexPixelsRGBA32 + slot->X + (slot->Y + y) * atlas->TexWidth;
+            for (int x = 0; x < slot->Width; x++)
+                dst_pixels[x] = IM_COL32(255, 255, 255, src_pixels[x]);
+        }
+
+    // Register glyph (same metrics as stbtt_GetPackedQuad() for glyphs rasterized by Build())
+    int advance, lsb;
+    stbtt_GetGlyphHMetrics(&src->FontInfo, glyph_index_in_font, &advance, &lsb);
+    const float recip_h = 1.0f / oversample_h;
+    const float recip_v = 1.0f / oversample_v;
+    const float font_off_x = cfg.GlyphOffset.x + sub_x;
+    const float font_off_y = cfg.GlyphOffset.y + IM_ROUND(font->Ascent) + sub_y;
+    font->AddGlyph(&cfg, c, x0 * recip_h + font_off_x, y0 * recip_v + font_off_y, (x0 + w) * recip_h + font_off_x, (y0 + h) * recip_v + font_off_y,
+        tex_x * atlas->TexUvScale.x, tex_y * atlas->TexUvScale.y, (tex_x + w) * atlas->TexUvScale.x, (tex_y + h) * atlas->TexUvScale.y, src->Scale * advance);
+    if (slot->GlyphIndex >= 0)
+    {
+        font->Glyphs[slot->GlyphIndex] = font->Glyphs.back();
+        font->Glyphs.pop_back();
+    }
+    else
+    {
+        slot->GlyphIndex = font->Glyphs.Size - 1;
+    }
+    font->DirtyLookupTables = false;
+    font->IndexLookup[c] = (ImWchar)slot->GlyphIndex;
+    font->IndexAdvanceX[c] = font->Glyphs[slot->GlyphIndex].AdvanceX;
+    atlas->LookupGeneration++;
+    font->Used4kPagesMap[(c / 4096) >> 3] |= 1 << ((c / 4096) & 7);
+    font->GlyphsUsedBits[slot->GlyphIndex >> 5] |= (ImU32)1 << (slot->GlyphIndex & 31);
+    slot->LastUsedFrame = dyn->Frame;
+
+    dyn->DirtyX0 = ImMin(dyn->DirtyX0, slot->X);
+    dyn->DirtyY0 = ImMin(dyn->DirtyY0, slot->Y);
+    dyn->DirtyX1 = ImMax(dyn->DirtyX1, slot->X + slot->Width);
+    dyn->DirtyY1 = ImMax(dyn->DirtyY1, slot->Y + src->RowHeight);
+    return &font->Glyphs[slot->GlyphIndex];
+}
+
+bool ImFontAtlas::GetTexDataDirtyRect(int* out_x, int* out_y, int* out_w, int* out_h)
+{
+    ImFontAtlasDynamicGlyphs* dyn = DynamicGlyphs;
+    if (dyn == NULL || dyn->DirtyX0 >= dyn->DirtyX1)
+        return false;
+    *out_x = dyn->DirtyX0;
+    *out_y = dyn->DirtyY0;
+    *out_w = dyn->DirtyX1 - dyn->DirtyX0;
+    *out_h = dyn->DirtyY1 - dyn->DirtyY0;
+    dyn->DirtyX0 = dyn->DirtyY0 = INT_MAX;
+    dyn->DirtyX1 = dyn->DirtyY1 = 0;
+    return true;
+}
+
+#else
+
+// Dynamic glyphs are only supported by the stb_truetype builder: ImFontAtlas::DynamicGlyphs always stays NULL.
+void ImFontAtlasDynamicGlyphsDestroy(ImFontAtlas*) {}
+void ImFontAtlasDynamicGlyphsNewFrame(ImFontAtlas*) {}
+void ImFontAtlasDynamicGlyphsSetupLookup(ImFont*) {}
+const ImFontGlyph* ImFontAtlasDynamicGlyphsLoad(ImFont* font, ImWchar c) { font->IndexAdvanceX[c] = font->FallbackAdvanceX; return font->FallbackGlyph; }
+bool ImFontAtlas::GetTexDataDirtyRect(int*, int*, int*, int*) { return false; }
+
 #endif // IMGUI_ENABLE_STB_TRUETYPE
 
 void ImFontAtlasBuildSetupFont(ImFontAtlas* atlas, ImFont* font, ImFontConfig* font_config, float ascent, float descent)
@@ -2645,6 +3559,107 @@ void ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas, void* stbrp_context_opa
         }
 }
 
+// Pack the custom rects then the glyph rects at a given texture width. Return false if some rectangles didn't fit within TexMaxHeight.
+static bool ImFontAtlasBuildPackRectsAtWidth(ImFontAtlas* atlas, ImVector<stbrp_node>& pack_nodes, stbrp_rect* rects, int rects_count, int tex_width, int* out_height)
+{
+    const int padding = atlas->TexGlyphPadding;
+    stbrp_context pack_context;
+    stbrp_init_target(&pack_context, tex_width - padding, atlas->TexMaxHeight - padding, pack_nodes.Data, tex_width - padding);
+
+    bool all_packed = true;
+    atlas->TexHeight = 0;
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+        atlas->CustomRects[i].X = atlas->CustomRects[i].Y = 0xFFFF;
+    ImFontAtlasBuildPackCustomRects(atlas, &pack_context);
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+        all_packed &= atlas->CustomRects[i].IsPacked();
+
+    stbrp_pack_rects(&pack_context, rects, rects_count);
+    int height = atlas->TexHeight;
+    for (int i = 0; i < rects_count; i++)
+        if (rects[i].was_packed)
+            height = ImMax(height, rects[i].y + rects[i].h);
+        else
+            all_packed = false;
+    *out_height = height;
+    return all_packed;
+}
+
+// Texture height allocated by the builder for a given width and packed height
+static int ImFontAtlasBuildCalcTexHeight(ImFontAtlas* atlas, bool dynamic_glyphs, int tex_width, int packed_height)
+{
+    int tex_height = packed_height;
+    if (dynamic_glyphs)
+        tex_height += (atlas->TexDynamicHeight > 0) ? atlas->TexDynamicHeight : tex_width;
+    return (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (tex_height + 1) : ImUpperPowerOfTwo(tex_height);
+}
+
+// Select the texture size and pack all rectangles: custom rects first (so they are on the upper-left corner of the texture and have small UV values),
+// then the glyphs of all sources at once, so stb_rect_pack sorts them together by height (packing each source separately wastes space at
+// the end of each batch). The bottom-left skyline heuristic gave a denser packing than the best-fit one on height sorted glyphs.
+// Unless TexDesiredWidth is set, the power-of-two widths around the square root of the packed surface are tried and the one giving the
+// smallest texture is kept (the squarest one on ties, which are common as heights are rounded to a power of two as well).
+// Glyphs which don't fit are left with was_packed == 0 and won't be rendered. Set TexWidth, TexHeight and return the height used by the packed rectangles.
+int ImFontAtlasBuildPackRects(ImFontAtlas* atlas, void* stbrp_rects_opaque, int rects_count)
+{
+    stbrp_rect* rects = (stbrp_rect*)stbrp_rects_opaque;
+    const int padding = atlas->TexGlyphPadding;
+    bool dynamic_glyphs = false;
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+        dynamic_glyphs |= (atlas->ConfigData[src_i].GlyphRangesDynamic != NULL);
+
+    int packed_surface = 0;
+    for (int i = 0; i < atlas->CustomRects.Size; i++)
+        packed_surface += atlas->CustomRects[i].Width * atlas->CustomRects[i].Height;
+    for (int i = 0; i < rects_count; i++)
+        packed_surface += rects[i].w * rects[i].h;
+
+    int width_min = atlas->TexDesiredWidth, width_max = atlas->TexDesiredWidth;
+    if (atlas->TexDesiredWidth <= 0)
+    {
+        const int width_square = ImUpperPowerOfTwo((int)ImSqrt((float)packed_surface) + 1);
+        width_max = ImMax(ImMin(width_square * 2, atlas->TexMaxWidth), 512);
+        width_min = ImMin(ImMax(width_square / 2, 512), width_max);
+    }
+    ImVector<stbrp_node> pack_nodes;
+    pack_nodes.resize(width_max);
+
+    int best_width = -1, best_height = 0;
+    ImS64 best_surface = 0;
+    int packed_width = -1;
+    int packed_height = 0;
+    bool all_packed = false;
+    for (int width = width_min; width <= width_max; width *= 2)
+    {
+        // Skip widths which can't beat the best one even with a perfect packing
+        const int height_min = ImFontAtlasBuildCalcTexHeight(atlas, dynamic_glyphs, width, packed_surface / (width - padding));
+        if (best_width != -1 && ((ImS64)width * height_min > best_surface || ((ImS64)width * height_min == best_surface && width >= ImMax(best_width, best_height))))
+            continue;
+        packed_width = width;
+        all_packed = ImFontAtlasBuildPackRectsAtWidth(atlas, pack_nodes, rects, rects_count, width, &packed_height);
+        if (!all_packed)
+            continue;
+        const int height = ImFontAtlasBuildCalcTexHeight(atlas, dynamic_glyphs, width, packed_height);
+        const ImS64 surface = (ImS64)width * height;
+        if (best_width == -1 || surface < best_surface || (surface == best_surface && ImMax(width, height) < ImMax(best_width, best_height)))
+        {
+            best_width = width;
+            best_height = height;
+            best_surface = surface;
+        }
+    }
+    if (best_width == -1)
+        best_width = width_max;
+    if (packed_width != best_width)
+        all_packed = ImFontAtlasBuildPackRectsAtWidth(atlas, pack_nodes, rects, rects_count, best_width, &packed_height);
+    IM_ASSERT_USER_ERROR(all_packed, "Glyphs don't fit in a TexMaxWidth x TexMaxHeight texture: some are left out. Increase TexMaxHeight or reduce the number of glyphs.");
+
+    atlas->TexWidth = best_width;
+    atlas->TexHeight = ImFontAtlasBuildCalcTexHeight(atlas, dynamic_glyphs, best_width, packed_height);
+    atlas->BuildPackedSurface = packed_surface;
+    return packed_height;
+}
+
 void ImFontAtlasBuildRender8bppRectFromString(ImFontAtlas* atlas, int x, int y, int w, int h, const char* in_str, char in_marker_char, unsigned char in_marker_pixel_value)
 {
     IM_ASSERT(x >= 0 && x + w <= atlas->TexWidth);
@@ -2707,7 +3722,7 @@ static void ImFontAtlasBuildRenderDefaultTexData(ImFontAtlas* atlas)
 
 static void ImFontAtlasBuildRenderLinesTexData(ImFontAtlas* atlas)
 {
-    if (atlas->Flags & ImFontAtlasFlags_NoBakedLines)
+    if (atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField))
         return;
 
     // This generates a triangular shape in the texture, with the various line widths stacked on top of each other to allow interpolation between them
@@ -2770,9 +3785,10 @@ void ImFontAtlasBuildInit(ImFontAtlas* atlas)
 
     // Register texture region for thick lines
     // The +2 here is to give space for the end caps, whilst height +1 is to accommodate the fact we have a zero-width row
+    // Not with a signed distance field: lines are baked as coverage, which the renderer's thresholding would distort.
     if (atlas->PackIdLines < 0)
     {
-        if (!(atlas->Flags & ImFontAtlasFlags_NoBakedLines))
+        if (!(atlas->Flags & (ImFontAtlasFlags_NoBakedLines | ImFontAtlasFlags_SignedDistanceField)))
             atlas->PackIdLines = atlas->AddCustomRectRegular(IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 2, IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1);
     }
 }
@@ -3133,6 +4149,7 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    GlyphsUsedBits.clear();
     FallbackGlyph = NULL;
     ContainerAtlas = NULL;
     DirtyLookupTables = true;
@@ -3150,6 +4167,8 @@ static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_cha
 
 void ImFont::BuildLookupTable()
 {
+    if (ContainerAtlas)
+        ContainerAtlas->LookupGeneration++;
     int max_codepoint = 0;
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
@@ -3218,6 +4237,9 @@ void ImFont::BuildLookupTable()
     for (int i = 0; i < max_codepoint + 1; i++)
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+
+    if (ContainerAtlas != NULL && ContainerAtlas->DynamicGlyphs != NULL)
+        ImFontAtlasDynamicGlyphsSetupLookup(this);
 }
 
 // API is designed this way to avoid exposing the 4K page size
@@ -3316,7 +4338,9 @@ const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
         return FallbackGlyph;
     const ImWchar i = IndexLookup.Data[c];
     if (i == (ImWchar)-1)
-        return FallbackGlyph;
+        return (IndexAdvanceX.Data[c] < 0.0f) ? ImFontAtlasDynamicGlyphsLoad((ImFont*)this, c) : FallbackGlyph; // Negative advance: dynamic glyph not rasterized yet
+    if (GlyphsUsedBits.Data != NULL)
+        GlyphsUsedBits.Data[i >> 5] |= (ImU32)1 << (i & 31); // Protect dynamic glyphs from eviction until next frame
     return &Glyphs.Data[i];
 }
 
@@ -3384,7 +4408,9 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        if (char_width < 0.0f)
+            char_width = FindGlyph((ImWchar)c)->AdvanceX; // Dynamic glyph not rasterized yet
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -3429,6 +4455,82 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+// Return the end of the run of printable ASCII characters (0x20..0x7F) starting at 's'.
+static inline const char* ImTextFindPrintableAsciiEnd(const char* s, const char* s_end)
+{
+#if defined(IMGUI_ENABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+    // Bytes >= 0x80 are negative as signed chars, so a single signed comparison catches them along with control characters.
+    const __m128i space = _mm_set1_epi8(' ');
+    while (s_end - s >= 16 && _mm_movemask_epi8(_mm_cmplt_epi8(_mm_loadu_si128((const __m128i*)(const void*)s), space)) == 0)
+        s += 16;
+#endif
+    while (s < s_end && (unsigned char)*s >= ' ' && (unsigned char)*s < 0x80)
+        s++;
+    return s;
+}
+
+// Break text into lines the same way RenderText() does with word-wrapping enabled, without rendering anything.
+// Line N holds the characters in text[out_lines[N * 2] .. out_lines[N * 2 + 1]] (no '\n' in there) and is drawn from the left edge, N line heights below the first one.
+void ImFont::CalcWordWrapLinesA(float scale, const char* text, const char* text_end, float wrap_width, ImVector<int>* out_lines) const
+{
+    out_lines->resize(0);
+    const char* line_begin = text;
+    const char* word_wrap_eol = NULL;
+
+    const char* s = text;
+    while (s < text_end)
+    {
+        // Lines always start at the left edge, so the full wrap width is available (see RenderText())
+        if (!word_wrap_eol)
+        {
+            word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width);
+            if (word_wrap_eol == s)
+                word_wrap_eol++;
+        }
+
+        if (s >= word_wrap_eol)
+        {
+            out_lines->push_back((int)(line_begin - text));
+            out_lines->push_back((int)(s - text));
+            word_wrap_eol = NULL;
+
+            // Wrapping skips upcoming blanks
+            while (s < text_end)
+            {
+                const char c = *s;
+                if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+            }
+            line_begin = s;
+            continue;
+        }
+
+        const char* prev_s = s;
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+        {
+            s += 1;
+        }
+        else
+        {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0) // Malformed UTF-8: RenderText() stops there
+            {
+                s = prev_s;
+                break;
+            }
+        }
+
+        if (c == '\n')
+        {
+            out_lines->push_back((int)(line_begin - text));
+            out_lines->push_back((int)(prev_s - text));
+            line_begin = s;
+        }
+    }
+    out_lines->push_back((int)(line_begin - text));
+    out_lines->push_back((int)(s - text));
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
@@ -3443,9 +4545,27 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     const bool word_wrap_enabled = (wrap_width > 0.0f);
     const char* word_wrap_eol = NULL;
 
+    // Without wrapping or width limit, runs of printable ASCII characters need neither UTF-8 decoding nor per-character checks:
+    // their advances are read straight from the first 128 entries of IndexAdvanceX[].
+    const bool ascii_fast_path = !word_wrap_enabled && max_width >= FLT_MAX && IndexAdvanceX.Size >= 0x80;
+
     const char* s = text_begin;
     while (s < text_end)
     {
+        if (ascii_fast_path)
+        {
+            const char* run_end = ImTextFindPrintableAsciiEnd(s, text_end);
+            for (; s < run_end; s++)
+            {
+                const float char_width = IndexAdvanceX.Data[(unsigned char)*s];
+                if (char_width < 0.0f)
+                    break; // Dynamic glyph not rasterized yet: let the regular path load it
+                line_width += char_width * scale;
+            }
+            if (s >= text_end)
+                break;
+        }
+
         if (word_wrap_enabled)
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
@@ -3501,7 +4621,10 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        if (char_width < 0.0f)
+            char_width = FindGlyph((ImWchar)c)->AdvanceX; // Dynamic glyph not rasterized yet
+        char_width *= scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
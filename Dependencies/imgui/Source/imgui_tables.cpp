@@ -3269,6 +3269,7 @@ void ImGui::TableSaveSettings(ImGuiTable* table)
     }
     settings->SaveFlags &= table->Flags;
     settings->RefScale = save_ref_scale ? table->RefScale : 0.0f;
+    settings->WantSave = true;
 
     MarkIniSettingsDirty();
 }
@@ -3406,12 +3407,25 @@ static void TableSettingsHandler_ReadLine(ImGuiContext*, ImGuiSettingsHandler*,
 
 static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandler* handler, ImGuiTextBuffer* buf)
 {
+    // Entries which weren't saved again since the last call copy their text from g.SettingsTablesIniText instead of formatting it again.
     ImGuiContext& g = *ctx;
+    const int section_start = buf->size();
     for (ImGuiTableSettings* settings = g.SettingsTables.begin(); settings != NULL; settings = g.SettingsTables.next_chunk(settings))
     {
         if (settings->ID == 0) // Skip ditched settings
             continue;
 
+        const int entry_start = buf->size();
+        if (!settings->WantSave && settings->IniTextSize > 0)
+        {
+            const char* text = g.SettingsTablesIniText.begin() + settings->IniTextOffset;
+            buf->append(text, text + settings->IniTextSize);
+            settings->IniTextOffset = entry_start - section_start;
+            continue;
+        }
+        settings->WantSave = false;
+        settings->IniTextSize = 0;
+
         // TableSaveSettings() may clear some of those flags when we establish that the data can be stripped
         // (e.g. Order was unchanged)
         const bool save_size    = (settings->SaveFlags & ImGuiTableFlags_Resizable) != 0;
@@ -3442,7 +3456,11 @@ static void TableSettingsHandler_WriteAll(ImGuiContext* ctx, ImGuiSettingsHandle
             buf->append("\n");
         }
         buf->append("\n");
+        settings->IniTextOffset = entry_start - section_start;
+        settings->IniTextSize = buf->size() - entry_start;
     }
+    g.SettingsTablesIniText.Buf.resize(0);
+    g.SettingsTablesIniText.append(buf->begin() + section_start, buf->end());
 }
 
 void ImGui::TableSettingsAddSettingsHandler()
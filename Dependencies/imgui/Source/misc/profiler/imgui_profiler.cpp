@@ -0,0 +1,574 @@
+// dear imgui: scoped CPU zone profiler, with Chrome trace export
+// (code)
+
+// Each thread owns a ring buffer, written by that thread only: recording a zone is a few relaxed stores and a release store of the write index.
+// Readers copy the ring, then drop the entries the writer may have overwritten in the meantime.
+// Ring buffers are registered in a fixed size table on first use and never freed, so readers never wait on writers nor see a dangling buffer.
+
+#ifndef IMGUI_DEFINE_MATH_OPERATORS
+#define IMGUI_DEFINE_MATH_OPERATORS
+#endif
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "misc/profiler/imgui_profiler.h"
+#include "imgui_internal.h"     // ImFileOpen, ImRect, RenderTextClippedEx
+#include <atomic>               // std::atomic
+#include <chrono>               // std::chrono::steady_clock
+
+#define IMGUI_PROFILER_MAX_DEPTH        32
+IM_STATIC_ASSERT((IMGUI_PROFILER_THREAD_EVENTS & (IMGUI_PROFILER_THREAD_EVENTS - 1)) == 0);
+
+struct ImGuiProfilerRingEvent
+{
+    std::atomic<const char*>    Name;
+    std::atomic<ImU64>          StartNs;
+    std::atomic<ImU64>          EndNs;
+    std::atomic<int>            Depth;
+};
+
+struct ImGuiProfilerThread
+{
+    std::atomic<const char*>    Name;
+    std::atomic<ImU32>          WriteIdx;   // Total number of events written (wraps around)
+    ImGuiProfilerRingEvent      Events[IMGUI_PROFILER_THREAD_EVENTS];
+};
+
+// Per-thread state, only touched by its thread. Zones opened while not capturing have a 0 start time and are not recorded.
+struct ImGuiProfilerThreadState
+{
+    ImGuiProfilerThread*        Thread;
+    int                         Depth;
+    const char*                 ZoneNames[IMGUI_PROFILER_MAX_DEPTH];
+    ImU64                       ZoneStartNs[IMGUI_PROFILER_MAX_DEPTH];
+};
+
+static std::atomic<bool>                    GProfilerCapturing(false);
+static std::atomic<ImU64>                   GProfilerClearNs(0);
+static std::atomic<int>                     GProfilerThreadsCount(0);
+static std::atomic<ImGuiProfilerThread*>    GProfilerThreads[IMGUI_PROFILER_MAX_THREADS];
+static thread_local ImGuiProfilerThreadState GProfilerThreadState;
+
+static ImU64 ImGuiProfilerGetTimeNs()
+{
+    return (ImU64)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Allocate the ring buffer of the calling thread. May run on any thread: call the allocator directly rather than IM_ALLOC(),
+// which reads GImGui, set by the thread owning the context. Returns NULL once IMGUI_PROFILER_MAX_THREADS threads are registered.
+static ImGuiProfilerThread* ImGuiProfilerGetThread()
+{
+    ImGuiProfilerThreadState& ts = GProfilerThreadState;
+    if (ts.Thread != NULL)
+        return ts.Thread;
+    if (GProfilerThreadsCount.load(std::memory_order_relaxed) >= IMGUI_PROFILER_MAX_THREADS)
+        return NULL;
+    const int thread_idx = GProfilerThreadsCount.fetch_add(1, std::memory_order_relaxed);
+    if (thread_idx >= IMGUI_PROFILER_MAX_THREADS)
+        return NULL;
+
+    ImGuiMemAllocFunc alloc_func; ImGuiMemFreeFunc free_func; void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    ImGuiProfilerThread* thread = IM_PLACEMENT_NEW(alloc_func(sizeof(ImGuiProfilerThread), user_data)) ImGuiProfilerThread(); // Zero-initialized
+    GProfilerThreads[thread_idx].store(thread, std::memory_order_release);
+    ts.Thread = thread;
+    return thread;
+}
+
+static void ImGuiProfilerPushEvent(const char* name, ImU64 start_ns, ImU64 end_ns, int depth)
+{
+    ImGuiProfilerThread* thread = ImGuiProfilerGetThread();
+    if (thread == NULL)
+        return;
+    const ImU32 write_idx = thread->WriteIdx.load(std::memory_order_relaxed);
+    ImGuiProfilerRingEvent& ev = thread->Events[write_idx & (IMGUI_PROFILER_THREAD_EVENTS - 1)];
+    // Pairs with the acquire fence of ImGuiProfilerReadThread(): a reader seeing any of the payload stores below also sees WriteIdx == write_idx,
+    // and so counts the slot as being overwritten.
+    std::atomic_thread_fence(std::memory_order_release);
+    ev.Name.store(name, std::memory_order_relaxed);
+    ev.StartNs.store(start_ns, std::memory_order_relaxed);
+    ev.EndNs.store(end_ns, std::memory_order_relaxed);
+    ev.Depth.store(depth, std::memory_order_relaxed);
+    thread->WriteIdx.store(write_idx + 1, std::memory_order_release);
+}
+
+void ImGuiProfiler::BeginCapture()
+{
+    GProfilerCapturing.store(true, std::memory_order_relaxed);
+}
+
+void ImGuiProfiler::EndCapture()
+{
+    GProfilerCapturing.store(false, std::memory_order_relaxed);
+}
+
+bool ImGuiProfiler::IsCapturing()
+{
+    return GProfilerCapturing.load(std::memory_order_relaxed);
+}
+
+void ImGuiProfiler::Clear()
+{
+    GProfilerClearNs.store(ImGuiProfilerGetTimeNs(), std::memory_order_relaxed);
+}
+
+void ImGuiProfiler::SetThreadName(const char* name)
+{
+    if (ImGuiProfilerThread* thread = ImGuiProfilerGetThread())
+        thread->Name.store(name, std::memory_order_relaxed);
+}
+
+void ImGuiProfiler::BeginZone(const char* name)
+{
+    ImGuiProfilerThreadState& ts = GProfilerThreadState;
+    if (ts.Depth < IMGUI_PROFILER_MAX_DEPTH)
+    {
+        ts.ZoneNames[ts.Depth] = name;
+        ts.ZoneStartNs[ts.Depth] = GProfilerCapturing.load(std::memory_order_relaxed) ? ImGuiProfilerGetTimeNs() : 0;
+    }
+    ts.Depth++;
+}
+
+void ImGuiProfiler::EndZone()
+{
+    ImGuiProfilerThreadState& ts = GProfilerThreadState;
+    IM_ASSERT(ts.Depth > 0 && "Mismatched BeginZone()/EndZone() calls");
+    ts.Depth--;
+    if (ts.Depth < IMGUI_PROFILER_MAX_DEPTH && ts.ZoneStartNs[ts.Depth] != 0 && GProfilerCapturing.load(std::memory_order_relaxed))
+        ImGuiProfilerPushEvent(ts.ZoneNames[ts.Depth], ts.ZoneStartNs[ts.Depth], ImGuiProfilerGetTimeNs(), ts.Depth);
+}
+
+void ImGuiProfiler::FrameMark()
+{
+    if (!GProfilerCapturing.load(std::memory_order_relaxed))
+        return;
+    const ImU64 now_ns = ImGuiProfilerGetTimeNs();
+    ImGuiProfilerPushEvent(NULL, now_ns, now_ns, 0);
+}
+
+int ImGuiProfiler::GetThreadCount()
+{
+    return ImMin(GProfilerThreadsCount.load(std::memory_order_relaxed), IMGUI_PROFILER_MAX_THREADS);
+}
+
+// Returns NULL while the thread is being registered.
+const char* ImGuiProfiler::GetThreadName(int thread_idx)
+{
+    IM_ASSERT(thread_idx >= 0 && thread_idx < IMGUI_PROFILER_MAX_THREADS);
+    ImGuiProfilerThread* thread = GProfilerThreads[thread_idx].load(std::memory_order_acquire);
+    return thread ? thread->Name.load(std::memory_order_relaxed) : NULL;
+}
+
+// Append the events of a thread from 'read_idx' (clamped to the events still in the ring), returns the index to read from next time.
+static ImU32 ImGuiProfilerReadThread(int thread_idx, ImU32 read_idx, ImVector<ImGuiProfilerEvent>* out_events)
+{
+    ImGuiProfilerThread* thread = GProfilerThreads[thread_idx].load(std::memory_order_acquire);
+    if (thread == NULL)
+        return read_idx;
+
+    // Copy the ring, then drop the oldest entries if the writer wrapped over them while we were copying.
+    const ImU32 write_idx = thread->WriteIdx.load(std::memory_order_acquire);
+    if (write_idx - read_idx > IMGUI_PROFILER_THREAD_EVENTS)
+        read_idx = write_idx - IMGUI_PROFILER_THREAD_EVENTS;
+    const int out_start = out_events->Size;
+    out_events->reserve(out_start + (int)(write_idx - read_idx));
+    for (ImU32 idx = read_idx; idx != write_idx; idx++)
+    {
+        const ImGuiProfilerRingEvent& src = thread->Events[idx & (IMGUI_PROFILER_THREAD_EVENTS - 1)];
+        ImGuiProfilerEvent ev;
+        ev.Name = src.Name.load(std::memory_order_relaxed);
+        ev.StartNs = src.StartNs.load(std::memory_order_relaxed);
+        ev.EndNs = src.EndNs.load(std::memory_order_relaxed);
+        ev.ThreadIdx = thread_idx;
+        ev.Depth = src.Depth.load(std::memory_order_relaxed);
+        out_events->push_back(ev);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    // The writer may also be storing event 'write_idx_after' (unpublished) into the slot of the oldest one: count it as overwritten.
+    const ImU32 write_idx_after = thread->WriteIdx.load(std::memory_order_relaxed);
+    const ImU32 written_count = write_idx_after + 1 - read_idx;
+    const ImU32 overwritten_count = (written_count > IMGUI_PROFILER_THREAD_EVENTS) ? written_count - IMGUI_PROFILER_THREAD_EVENTS : 0;
+    const int drop_count = (int)ImMin(overwritten_count, write_idx - read_idx);
+    if (drop_count > 0)
+        out_events->erase(out_events->Data + out_start, out_events->Data + out_start + drop_count);
+
+    // Drop the events recorded before Clear()
+    const ImU64 clear_ns = GProfilerClearNs.load(std::memory_order_relaxed);
+    int keep_n = out_start;
+    for (int n = out_start; n < out_events->Size; n++)
+        if (out_events->Data[n].StartNs >= clear_ns)
+            out_events->Data[keep_n++] = out_events->Data[n];
+    out_events->resize(keep_n);
+    return write_idx;
+}
+
+void ImGuiProfiler::GetEvents(ImVector<ImGuiProfilerEvent>* out_events)
+{
+    const int threads_count = GetThreadCount();
+    for (int thread_idx = 0; thread_idx < threads_count; thread_idx++)
+        ImGuiProfilerReadThread(thread_idx, 0, out_events);
+}
+
+void ImGuiProfiler::GetNewEvents(ImVector<ImGuiProfilerEvent>* out_events, ImVector<ImU32>* read_indices)
+{
+    const int threads_count = GetThreadCount();
+    while (read_indices->Size < threads_count)
+        read_indices->push_back(0);
+    for (int thread_idx = 0; thread_idx < threads_count; thread_idx++)
+        (*read_indices)[thread_idx] = ImGuiProfilerReadThread(thread_idx, (*read_indices)[thread_idx], out_events);
+}
+
+static void ImGuiProfilerAppendJsonString(ImGuiTextBuffer* buf, const char* s)
+{
+    buf->append("\"");
+    for (; *s; s++)
+    {
+        if (*s == '"' || *s == '\\')
+            buf->appendf("\\%c", *s);
+        else if ((unsigned char)*s < 0x20)
+            buf->appendf("\\u%04x", (unsigned char)*s);
+        else
+            buf->append(s, s + 1);
+    }
+    buf->append("\"");
+}
+
+// Trace event format: https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+// Zones are written as complete ("X") events and frame marks as global instant ("i") events, with times in microseconds.
+void ImGuiProfiler::ExportChromeTrace(ImGuiTextBuffer* out_buf)
+{
+    ImVector<ImGuiProfilerEvent> events;
+    GetEvents(&events);
+    ImU64 base_ns = events.Size > 0 ? events[0].StartNs : 0;
+    for (int n = 1; n < events.Size; n++)
+        base_ns = ImMin(base_ns, events[n].StartNs);
+
+    out_buf->append("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    bool first = true;
+    const int threads_count = GetThreadCount();
+    for (int thread_idx = 0; thread_idx < threads_count; thread_idx++)
+    {
+        const char* thread_name = GetThreadName(thread_idx);
+        out_buf->appendf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":", first ? "" : ",\n", thread_idx);
+        if (thread_name)
+            ImGuiProfilerAppendJsonString(out_buf, thread_name);
+        else
+            out_buf->appendf("\"Thread %d\"", thread_idx);
+        out_buf->append("}}");
+        first = false;
+    }
+    for (int n = 0; n < events.Size; n++)
+    {
+        const ImGuiProfilerEvent& ev = events[n];
+        out_buf->append(first ? "{\"name\":" : ",\n{\"name\":");
+        ImGuiProfilerAppendJsonString(out_buf, ev.Name ? ev.Name : "Frame");
+        if (ev.Name)
+            out_buf->appendf(",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d}", (ev.StartNs - base_ns) / 1000.0, (ev.EndNs - ev.StartNs) / 1000.0, ev.ThreadIdx);
+        else
+            out_buf->appendf(",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":1,\"tid\":%d}", (ev.StartNs - base_ns) / 1000.0, ev.ThreadIdx);
+        first = false;
+    }
+    out_buf->append("\n]}\n");
+}
+
+bool ImGuiProfiler::ExportChromeTrace(const char* filename)
+{
+    ImFileHandle f = ImFileOpen(filename, "wb");
+    if (!f)
+        return false;
+    ImGuiTextBuffer buf;
+    ExportChromeTrace(&buf);
+    const bool ok = ImFileWrite(buf.c_str(), sizeof(char), (ImU64)buf.size(), f) == (ImU64)buf.size();
+    ImFileClose(f);
+    return ok;
+}
+
+//-----------------------------------------------------------------------------
+// Profiler window
+//-----------------------------------------------------------------------------
+
+#define IMGUI_PROFILER_WINDOW_FRAMES    240     // Frames kept by ShowProfilerWindow()
+
+struct ImGuiProfilerWindowState
+{
+    ImVector<ImU32>                 ReadIndices;
+    ImVector<ImGuiProfilerEvent>    NewEvents;                                  // Scratch buffer for GetNewEvents()
+    ImVector<ImGuiProfilerEvent>    ThreadEvents[IMGUI_PROFILER_MAX_THREADS];   // Zones of each thread, in order of completion
+    ImVector<ImGuiProfilerEvent>    ThreadOuterEvents[IMGUI_PROFILER_MAX_THREADS];  // Zones of depth 0 of each thread, for the frame bars
+    ImVector<ImU64>                 FrameStartNs;                               // Frame marks, frame N spans [FrameStartNs[N], FrameStartNs[N + 1])
+    int                             FrameThreadIdx;                             // Thread recording the frame marks
+    ImU64                           SelectedFrameStartNs;                       // 0: latest complete frame
+    double                          ViewMin, ViewMax;                           // Visible part of the selected frame in the timeline, 0.0f..1.0f = whole frame
+    bool                            Paused;
+    float                           DrawTimeMs;                                 // Time spent in ShowProfilerWindow() on the previous call
+
+    ImGuiProfilerWindowState()      { FrameThreadIdx = 0; SelectedFrameStartNs = 0; ViewMin = 0.0; ViewMax = 1.0; Paused = false; DrawTimeMs = 0.0f; }
+};
+
+static ImGuiProfilerWindowState GProfilerWindowState;
+
+// Index of the first zone ending at or after 'time_ns' (zones of a thread are sorted by end time)
+static int ImGuiProfilerLowerBound(const ImVector<ImGuiProfilerEvent>& events, ImU64 time_ns)
+{
+    int lo = 0, hi = events.Size;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi) >> 1;
+        if (events.Data[mid].EndNs < time_ns)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static ImU32 ImGuiProfilerGetZoneColor(const char* name)
+{
+    const ImU32 hash = ImHashStr(name);
+    return ImColor::HSV((hash & 0xFF) / 255.0f, 0.45f, 0.85f);
+}
+
+static void ImGuiProfilerFetchEvents(ImGuiProfilerWindowState& st)
+{
+    st.NewEvents.resize(0);
+    ImGuiProfiler::GetNewEvents(&st.NewEvents, &st.ReadIndices);
+    for (int n = 0; n < st.NewEvents.Size; n++)
+    {
+        const ImGuiProfilerEvent& ev = st.NewEvents[n];
+        if (ev.Name == NULL)
+        {
+            st.FrameStartNs.push_back(ev.StartNs);
+            st.FrameThreadIdx = ev.ThreadIdx;
+        }
+        else
+        {
+            st.ThreadEvents[ev.ThreadIdx].push_back(ev);
+            if (ev.Depth == 0)
+                st.ThreadOuterEvents[ev.ThreadIdx].push_back(ev);
+        }
+    }
+
+    // Forget the oldest frames, and the zones ending before them once they make up half of the buffer
+    if (st.FrameStartNs.Size > IMGUI_PROFILER_WINDOW_FRAMES)
+        st.FrameStartNs.erase(st.FrameStartNs.Data, st.FrameStartNs.Data + st.FrameStartNs.Size - IMGUI_PROFILER_WINDOW_FRAMES);
+    if (st.FrameStartNs.Size > 0)
+        for (int thread_idx = 0; thread_idx < IMGUI_PROFILER_MAX_THREADS; thread_idx++)
+            for (int outer = 0; outer < 2; outer++)
+            {
+                ImVector<ImGuiProfilerEvent>& events = outer ? st.ThreadOuterEvents[thread_idx] : st.ThreadEvents[thread_idx];
+                const int old_count = ImGuiProfilerLowerBound(events, st.FrameStartNs[0]);
+                if (old_count > 0 && old_count >= events.Size / 2)
+                    events.erase(events.Data, events.Data + old_count);
+            }
+}
+
+// Last frames as bars stacked with the outer zones of the thread recording the frame marks. Click to select a frame.
+static void ImGuiProfilerShowFrameBars(ImGuiProfilerWindowState& st)
+{
+    ImGuiContext& g = *GImGui;
+    const int frames_count = st.FrameStartNs.Size - 1;
+    const ImVec2 size(ImGui::GetContentRegionAvail().x, 80.0f);
+    const ImVec2 pos = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##frames", size);
+    const bool hovered = ImGui::IsItemHovered();
+    const ImRect bb(pos, pos + size);
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->AddRectFilled(bb.Min, bb.Max, ImGui::GetColorU32(ImGuiCol_FrameBg));
+
+    const float bar_width = 4.0f;
+    const int visible_count = ImMin(frames_count, (int)(size.x / bar_width));
+    const int first_frame = frames_count - visible_count;
+    ImU64 max_duration_ns = 16666667; // Fit at least 60 FPS frames
+    for (int frame_n = first_frame; frame_n < frames_count; frame_n++)
+        max_duration_ns = ImMax(max_duration_ns, st.FrameStartNs[frame_n + 1] - st.FrameStartNs[frame_n]);
+    const float scale_y = (size.y - 1.0f) / (float)max_duration_ns;
+    const ImVector<ImGuiProfilerEvent>& events = st.ThreadOuterEvents[st.FrameThreadIdx];
+
+    for (int frame_n = first_frame; frame_n < frames_count; frame_n++)
+    {
+        const ImU64 frame_start_ns = st.FrameStartNs[frame_n];
+        const ImU64 frame_end_ns = st.FrameStartNs[frame_n + 1];
+        const float x0 = bb.Max.x - (frames_count - frame_n) * bar_width;
+        const float x1 = x0 + bar_width - 1.0f;
+        const bool selected = (frame_start_ns == st.SelectedFrameStartNs) || (st.SelectedFrameStartNs == 0 && frame_n == frames_count - 1);
+        if (selected)
+            draw_list->AddRectFilled(ImVec2(x0, bb.Min.y), ImVec2(x1, bb.Max.y), ImGui::GetColorU32(ImGuiCol_Header));
+        draw_list->AddRectFilled(ImVec2(x0, bb.Max.y - (frame_end_ns - frame_start_ns) * scale_y), ImVec2(x1, bb.Max.y), ImGui::GetColorU32(ImGuiCol_PlotHistogram, 0.3f));
+        float y = bb.Max.y;
+        for (int n = ImGuiProfilerLowerBound(events, frame_start_ns); n < events.Size && events[n].StartNs < frame_end_ns; n++)
+            if (events[n].StartNs >= frame_start_ns)
+            {
+                const float h = (ImMin(events[n].EndNs, frame_end_ns) - events[n].StartNs) * scale_y;
+                draw_list->AddRectFilled(ImVec2(x0, y - h), ImVec2(x1, y), ImGuiProfilerGetZoneColor(events[n].Name));
+                y -= h;
+            }
+
+        if (hovered && g.IO.MousePos.x >= x0 && g.IO.MousePos.x < x0 + bar_width)
+        {
+            ImGui::SetTooltip("Frame %d: %.3f ms", frame_n - frames_count, (frame_end_ns - frame_start_ns) / 1000000.0);
+            if (ImGui::IsItemClicked())
+            {
+                st.SelectedFrameStartNs = frame_start_ns;
+                st.ViewMin = 0.0;
+                st.ViewMax = 1.0;
+                st.Paused = true;
+            }
+        }
+    }
+}
+
+// Zones of the selected frame, one lane per thread. Mouse wheel to zoom, drag to pan.
+static void ImGuiProfilerShowTimeline(ImGuiProfilerWindowState& st, ImU64 frame_start_ns, ImU64 frame_end_ns)
+{
+    ImGuiContext& g = *GImGui;
+    const ImVec2 size(ImGui::GetContentRegionAvail().x, ImMax(ImGui::GetContentRegionAvail().y, 50.0f));
+    const ImVec2 pos = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton("##timeline", size);
+    const ImRect bb(pos, pos + size);
+    const double frame_duration_ns = (double)(frame_end_ns - frame_start_ns);
+
+    // Zoom around the mouse, pan by dragging
+    if (ImGui::IsItemHovered() && g.IO.MouseWheel != 0.0f)
+    {
+        const double mouse_t = st.ViewMin + (st.ViewMax - st.ViewMin) * (g.IO.MousePos.x - bb.Min.x) / size.x;
+        const double zoom = g.IO.MouseWheel > 0.0f ? 0.8 : 1.25;
+        st.ViewMin = ImMax(0.0, mouse_t - (mouse_t - st.ViewMin) * zoom);
+        st.ViewMax = ImMin(1.0, mouse_t + (st.ViewMax - mouse_t) * zoom);
+    }
+    if (ImGui::IsItemActive() && g.IO.MouseDelta.x != 0.0f)
+    {
+        const double delta_t = -(double)g.IO.MouseDelta.x / size.x * (st.ViewMax - st.ViewMin);
+        const double clamped_delta_t = ImClamp(delta_t, -st.ViewMin, 1.0 - st.ViewMax);
+        st.ViewMin += clamped_delta_t;
+        st.ViewMax += clamped_delta_t;
+    }
+    const ImU64 view_start_ns = frame_start_ns + (ImU64)(st.ViewMin * frame_duration_ns);
+    const ImU64 view_end_ns = frame_start_ns + (ImU64)(st.ViewMax * frame_duration_ns);
+    const double scale_x = size.x / ImMax(1.0, (double)(view_end_ns - view_start_ns));
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->PushClipRect(bb.Min, bb.Max, true);
+    const float row_height = ImGui::GetTextLineHeight() + 2.0f;
+    const ImU32 text_col = IM_COL32_BLACK;
+    float y = bb.Min.y;
+    const ImGuiProfilerEvent* hovered_zone = NULL;
+    for (int thread_idx = 0; thread_idx < IMGUI_PROFILER_MAX_THREADS && y < bb.Max.y; thread_idx++)
+    {
+        const ImVector<ImGuiProfilerEvent>& events = st.ThreadEvents[thread_idx];
+        const int first_n = ImGuiProfilerLowerBound(events, view_start_ns);
+        if (first_n == events.Size || events[first_n].StartNs > view_end_ns)
+            continue;
+        const char* thread_name = ImGuiProfiler::GetThreadName(thread_idx);
+        if (thread_name)
+            draw_list->AddText(ImVec2(bb.Min.x, y), ImGui::GetColorU32(ImGuiCol_Text), thread_name);
+        else
+            draw_list->AddText(ImVec2(bb.Min.x, y), ImGui::GetColorU32(ImGuiCol_Text), "Thread");
+        y += row_height;
+
+        // Zones narrower than a pixel are only drawn when they don't overlap the previous zone drawn at the same depth
+        float last_x1[IMGUI_PROFILER_MAX_DEPTH];
+        for (int depth = 0; depth < IMGUI_PROFILER_MAX_DEPTH; depth++)
+            last_x1[depth] = -FLT_MAX;
+        int max_depth = 0;
+        for (int n = first_n; n < events.Size; n++)
+        {
+            const ImGuiProfilerEvent& ev = events[n];
+            if (ev.StartNs > view_end_ns)
+            {
+                if (ev.Depth == 0)
+                    break; // Zones completing after an outer zone start after it
+                continue;
+            }
+            max_depth = ImMax(max_depth, ev.Depth);
+            const float x0 = bb.Min.x + (float)((ImMax(ev.StartNs, view_start_ns) - view_start_ns) * scale_x);
+            const float x1 = ImMax(bb.Min.x + (float)((ImMin(ev.EndNs, view_end_ns) - view_start_ns) * scale_x), x0 + 1.0f);
+            if (x1 <= last_x1[ev.Depth])
+                continue;
+            last_x1[ev.Depth] = x1;
+            const ImVec2 zone_min(x0, y + ev.Depth * row_height);
+            const ImVec2 zone_max(x1, zone_min.y + row_height - 1.0f);
+            draw_list->AddRectFilled(zone_min, zone_max, ImGuiProfilerGetZoneColor(ev.Name));
+            if (x1 - x0 > 20.0f)
+            {
+                ImGui::PushStyleColor(ImGuiCol_Text, text_col);
+                ImGui::RenderTextClippedEx(draw_list, zone_min + ImVec2(2.0f, 1.0f), zone_max, ev.Name, NULL, NULL);
+                ImGui::PopStyleColor();
+            }
+            if (ImGui::IsItemHovered() && ImRect(zone_min, zone_max).Contains(g.IO.MousePos))
+                hovered_zone = &ev;
+        }
+        y += (max_depth + 1) * row_height + 4.0f;
+    }
+    draw_list->PopClipRect();
+
+    if (hovered_zone)
+        ImGui::SetTooltip("%s: %.3f ms", hovered_zone->Name, (hovered_zone->EndNs - hovered_zone->StartNs) / 1000000.0);
+}
+
+void ImGuiProfiler::ShowProfilerWindow(bool* p_open)
+{
+    if (!ImGui::Begin("Profiler", p_open))
+    {
+        ImGui::End();
+        return;
+    }
+    IMGUI_PROFILE_ZONE("ImGuiProfiler::ShowProfilerWindow");
+    const ImU64 draw_start_ns = ImGuiProfilerGetTimeNs();
+    ImGuiProfilerWindowState& st = GProfilerWindowState;
+    if (!st.Paused)
+        ImGuiProfilerFetchEvents(st);
+
+    bool capturing = IsCapturing();
+    if (ImGui::Checkbox("Capture", &capturing))
+    {
+        if (capturing)
+            BeginCapture();
+        else
+            EndCapture();
+    }
+    ImGui::SameLine();
+    if (ImGui::Checkbox("Pause", &st.Paused) && !st.Paused)
+        st.SelectedFrameStartNs = 0;
+    ImGui::SameLine();
+    if (ImGui::Button("Clear"))
+    {
+        Clear();
+        st.FrameStartNs.resize(0);
+        for (int thread_idx = 0; thread_idx < IMGUI_PROFILER_MAX_THREADS; thread_idx++)
+        {
+            st.ThreadEvents[thread_idx].resize(0);
+            st.ThreadOuterEvents[thread_idx].resize(0);
+        }
+        st.SelectedFrameStartNs = 0;
+    }
+    ImGui::SameLine();
+    if (ImGui::Button("Export trace"))
+        ExportChromeTrace("imgui_profiler_trace.json");
+    ImGui::SameLine();
+    ImGui::Text("Window: %.3f ms", st.DrawTimeMs);
+
+    // Selected frame, or latest complete frame
+    int frame_n = st.FrameStartNs.Size - 2;
+    if (st.SelectedFrameStartNs != 0)
+        for (int n = 0; n < st.FrameStartNs.Size - 1; n++)
+            if (st.FrameStartNs[n] == st.SelectedFrameStartNs)
+                frame_n = n;
+    if (frame_n < 0)
+    {
+        ImGui::TextDisabled(capturing ? "No complete frame yet: call ImGuiProfiler::FrameMark() once per frame." : "Not capturing.");
+    }
+    else
+    {
+        ImGuiProfilerShowFrameBars(st);
+        const ImU64 frame_start_ns = st.FrameStartNs[frame_n];
+        const ImU64 frame_end_ns = st.FrameStartNs[frame_n + 1];
+        const double view_ms = (frame_end_ns - frame_start_ns) * (st.ViewMax - st.ViewMin) / 1000000.0;
+        ImGui::Text("Frame %d: %.3f ms (showing %.3f ms)", frame_n - (st.FrameStartNs.Size - 1), (frame_end_ns - frame_start_ns) / 1000000.0, view_ms);
+        ImGuiProfilerShowTimeline(st, frame_start_ns, frame_end_ns);
+    }
+
+    st.DrawTimeMs = (ImGuiProfilerGetTimeNs() - draw_start_ns) / 1000000.0f;
+    ImGui::End();
+}
+
+#endif // #ifndef IMGUI_DISABLE
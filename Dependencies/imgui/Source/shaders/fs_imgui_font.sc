@@ -0,0 +1,13 @@
+$input v_color0, v_texcoord0
+
+// Paired with vs_ocornut_imgui, for font atlases uploaded as single channel textures: the coverage is in the red channel.
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_tex, 0);
+
+void main()
+{
+	float alpha = texture2D(s_tex, v_texcoord0).x;
+	gl_FragColor = vec4(v_color0.xyz, v_color0.w * alpha);
+}
@@ -0,0 +1,16 @@
+$input v_color0, v_texcoord0
+
+// Paired with vs_ocornut_imgui, for font atlases built with ImFontAtlasFlags_SignedDistanceField and uploaded as single channel textures.
+// The outline is at 128/255. The edge is smoothed over about one screen pixel whatever the scale the glyphs are drawn at.
+
+#include <bgfx_shader.sh>
+
+SAMPLER2D(s_tex, 0);
+
+void main()
+{
+	float dist = texture2D(s_tex, v_texcoord0).x;
+	vec2 grad = vec2(dFdx(dist), dFdy(dist));
+	float t = saturate((dist - 128.0/255.0) * inversesqrt(max(dot(grad, grad), 1.0e-8)) * 0.70710678 + 0.5);
+	gl_FragColor = vec4(v_color0.xyz, v_color0.w * t * t * (3.0 - 2.0 * t));
+}
@@ -1,6 +1,7 @@
 #include <filesystem>
 #include <iostream>
 #include <stdio.h>
+#include <string.h>
 
 #include <Babylon/AppRuntime.h>
 #include <Babylon/Graphics/Device.h>
@@ -23,6 +24,7 @@
 #include "imgui.h"
 #include "backends/imgui_impl_glfw.h"
 #include "backends/imgui_impl_babylon.h"
+#include "misc/profiler/imgui_profiler.h"
 
 #if TARGET_PLATFORM_LINUX
 #define GLFW_EXPOSE_NATIVE_X11
@@ -42,8 +44,45 @@ bool minimized = false;
 
 #define INITIAL_WIDTH 1920
 #define INITIAL_HEIGHT 1080
+#define IMGUI_FONT_CACHE_FILENAME "imgui_font_atlas.cache"
 
 static bool s_showImgui = false;
+static bool s_showProfiler = false;
+
+// Per-frame ImGui stats export, enabled with --imgui-stats <file.csv|file.json>
+static FILE *s_statsFile = nullptr;
+static bool s_statsJson = false;
+static ImGuiTextBuffer s_statsBuffer;
+
+static void OpenStatsFile(const char *path)
+{
+	s_statsFile = fopen(path, "w");
+	if (!s_statsFile)
+	{
+		std::cerr << "Could not open stats file " << path << std::endl;
+		return;
+	}
+
+	std::string extension = std::filesystem::path(path).extension().string();
+	s_statsJson = (extension == ".json" || extension == ".jsonl");
+	if (!s_statsJson)
+		ImGuiFrameStats::AppendCsvHeader(&s_statsBuffer);
+	ImGui::GetIO().ConfigDebugFrameStats = true;
+}
+
+static void WriteFrameStats()
+{
+	if (!s_statsFile)
+		return;
+
+	const ImGuiFrameStats &stats = ImGui::GetFrameStats();
+	if (s_statsJson)
+		stats.AppendJson(&s_statsBuffer);
+	else
+		stats.AppendCsv(&s_statsBuffer);
+	fwrite(s_statsBuffer.begin(), 1, (size_t)s_statsBuffer.size(), s_statsFile);
+	s_statsBuffer.Buf.resize(0);
+}
 
 static void *glfwNativeWindowHandle(GLFWwindow *_window)
 {
@@ -126,7 +165,7 @@ void RefreshBabylon(GLFWwindow *window)
 	loader.LoadScript("app:///Scripts/meshwriter.min.js");
 	loader.LoadScript("app:///Scripts/game.js");
 
-	ImGui_ImplBabylon_Init( width , height );
+	ImGui_ImplBabylon_Init( width , height, 16.0f, IMGUI_FONT_CACHE_FILENAME );
 }
 
 static void key_callback(GLFWwindow *window, int key, int scancode, int action, int mods)
@@ -139,6 +178,15 @@ static void key_callback(GLFWwindow *window, int key, int scancode, int action,
 	{
 		s_showImgui = !s_showImgui;
 	}
+	else if (key == GLFW_KEY_P && action == GLFW_PRESS)
+	{
+		s_showProfiler = !s_showProfiler;
+		if (s_showProfiler)
+		{
+			s_showImgui = true;
+			ImGuiProfiler::BeginCapture();
+		}
+	}
 }
 
 void mouse_button_callback(GLFWwindow *window, int button, int action, int mods)
@@ -218,7 +266,7 @@ static void change_floor_visibility(bool visible)
 	});
 }
 
-int main()
+int main(int argc, char **argv)
 {
 	if (!glfwInit())
 		exit(EXIT_FAILURE);
@@ -250,6 +298,20 @@ int main()
 
 	ImGui::StyleColorsDark();
 
+	// CPU zones of the main loop, exported with --trace <file.json>
+	const char *traceFile = nullptr;
+	for (int i = 1; i + 1 < argc; i++)
+	{
+		if (strcmp(argv[i], "--imgui-stats") == 0)
+			OpenStatsFile(argv[++i]);
+		else if (strcmp(argv[i], "--trace") == 0)
+			traceFile = argv[++i];
+	}
+
+	ImGuiProfiler::SetThreadName("Main");
+	if (traceFile)
+		ImGuiProfiler::BeginCapture();
+
 	// Setup Platform/Renderer backends
 	ImGui_ImplGlfw_InitForOther(window, true);
 
@@ -262,70 +324,115 @@ int main()
 
 	while (!glfwWindowShouldClose(window))
 	{
+		ImGuiProfiler::FrameMark();
 		if (device)
 		{
-			update->Finish();
-			device->FinishRenderingCurrentFrame();
-			device->StartRenderingCurrentFrame();
-			update->Start();
+			{
+				IMGUI_PROFILE_ZONE("update->Finish");
+				update->Finish();
+			}
+			{
+				IMGUI_PROFILE_ZONE("FinishRenderingCurrentFrame");
+				device->FinishRenderingCurrentFrame();
+			}
+			{
+				IMGUI_PROFILE_ZONE("StartRenderingCurrentFrame");
+				device->StartRenderingCurrentFrame();
+			}
+			{
+				IMGUI_PROFILE_ZONE("update->Start");
+				update->Start();
+			}
+		}
+		{
+			IMGUI_PROFILE_ZONE("glfwPollEvents");
+			glfwPollEvents();
 		}
-		glfwPollEvents();
 
 		// Start the Dear ImGui frame
-		ImGui_ImplBabylon_NewFrame();
-		ImGui_ImplGlfw_NewFrame();
+		{
+			IMGUI_PROFILE_ZONE("ImGui backends NewFrame");
+			ImGui_ImplBabylon_NewFrame();
+			ImGui_ImplGlfw_NewFrame();
+		}
 
-		if (s_showImgui)
+		// With --imgui-stats, frames keep going through ImGui while the overlay is hidden so that a line is written for each of them.
+		if (s_showImgui || s_statsFile)
 		{
-			ImGui::NewFrame();
+			{
+				IMGUI_PROFILE_ZONE("ImGui::NewFrame");
+				ImGui::NewFrame();
+			}
 
-			static float ballSize = 1.0f;
+			if (s_showImgui)
+			{
+				IMGUI_PROFILE_ZONE("Widgets");
 
-			ImGui::Begin("Scene Editor Example");
+				static float ballSize = 1.0f;
 
-			ImGui::Text("Use this controllers to change values in the Babylon scene.");
+				ImGui::Begin("Scene Editor Example");
 
-			if (ImGui::Checkbox("Show ball", &show_ball))
-			{
-				change_ball_visibility(show_ball);
-			}
+				ImGui::Text("Use this controllers to change values in the Babylon scene.");
 
-			if (ImGui::Checkbox("Show floor", &show_floor))
-			{
-				change_floor_visibility(show_floor);
-			}
+				if (ImGui::Checkbox("Show ball", &show_ball))
+				{
+					change_ball_visibility(show_ball);
+				}
 
-			if (ImGui::SliderFloat("Ball Size", &ballSize, 1.0f, 10.0f))
-			{
-				change_ball_size(ballSize);
+				if (ImGui::Checkbox("Show floor", &show_floor))
+				{
+					change_floor_visibility(show_floor);
+				}
+
+				if (ImGui::SliderFloat("Ball Size", &ballSize, 1.0f, 10.0f))
+				{
+					change_ball_size(ballSize);
+				}
+
+				if (ImGui::ColorEdit3("Ball Color", (float *)&ballColor))
+				{
+					change_ball_color(ballColor);
+				}
+
+				if (ImGui::Button("Resume"))
+				{
+					s_showImgui = false;
+				}
+
+				ImGui::SameLine();
+
+				ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+				ImGui::End();
 			}
 
-			if (ImGui::ColorEdit3("Ball Color", (float *)&ballColor))
+			if (s_showImgui && s_showProfiler)
+				ImGuiProfiler::ShowProfilerWindow(&s_showProfiler);
+
 			{
-				change_ball_color(ballColor);
+				IMGUI_PROFILE_ZONE("ImGui::Render");
+				ImGui::Render();
 			}
-
-			if (ImGui::Button("Resume"))
+			if (s_showImgui)
 			{
-				s_showImgui = false;
+				IMGUI_PROFILE_ZONE("ImGui_ImplBabylon_RenderDrawData");
+				ImGui_ImplBabylon_RenderDrawData(ImGui::GetDrawData());
 			}
-
-			ImGui::SameLine();
-
-			ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
-			ImGui::End();
-
-			ImGui::Render();
-			ImGui_ImplBabylon_RenderDrawData(ImGui::GetDrawData());
 		}
+		WriteFrameStats();
 	}
 
+	if (traceFile && !ImGuiProfiler::ExportChromeTrace(traceFile))
+		std::cerr << "Could not write trace file " << traceFile << std::endl;
+
 	Uninitialize();
 
 	// Cleanup
 	ImGui_ImplGlfw_Shutdown();
 	ImGui::DestroyContext();
 
+	if (s_statsFile)
+		fclose(s_statsFile);
+
 	glfwDestroyWindow(window);
 	glfwTerminate();
 	exit(EXIT_SUCCESS);